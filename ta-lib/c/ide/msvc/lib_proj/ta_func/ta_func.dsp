@@ -568,6 +568,14 @@ SOURCE=..\..\..\..\src\ta_func\ta_COSH.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\ta_func\ta_CROSSOVER.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\..\..\src\ta_func\ta_CROSSUNDER.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\ta_func\ta_DEMA.c
 # End Source File
 # Begin Source File
@@ -664,6 +672,10 @@ SOURCE=..\..\..\..\src\ta_func\ta_MACDFIX.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\ta_func\ta_MAD.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\ta_func\ta_MAMA.c
 # End Source File
 # Begin Source File
@@ -680,6 +692,10 @@ SOURCE=..\..\..\..\src\ta_func\ta_MAXINDEX.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\ta_func\ta_MEDIAN.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\ta_func\ta_MEDPRICE.c
 # End Source File
 # Begin Source File
@@ -748,6 +764,10 @@ SOURCE=..\..\..\..\src\ta_func\ta_PPO.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\ta_func\ta_QUANTILE.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\ta_func\ta_ROC.c
 # End Source File
 # Begin Source File
@@ -832,6 +852,10 @@ SOURCE=..\..\..\..\src\ta_func\ta_TEMA.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\ta_func\ta_THRESHOLD_EVENTS.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\ta_func\ta_TRANGE.c
 # End Source File
 # Begin Source File
@@ -874,6 +898,14 @@ SOURCE=..\..\..\..\src\ta_func\ta_WMA.c
 
 SOURCE=..\..\..\..\src\ta_func\ta_utility.c
 # End Source File
+# Begin Source File
+
+SOURCE=..\..\..\..\src\ta_func\ta_ht_dft.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\..\..\src\ta_func\ta_fixed_period.c
+# End Source File
 # End Group
 # Begin Group "Header Files"
 
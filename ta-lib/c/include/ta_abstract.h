@@ -186,6 +186,12 @@ typedef int TA_FuncFlags;
                                           * unstable period. See Documentation.
                                           */
 #define TA_FUNC_FLG_CANDLESTICK 0x10000000 /* Output shall be a candlestick */
+#define TA_FUNC_FLG_INPLACE   0x20000000 /* Any output buffer can be the same as one of the
+                                          * input buffer (in-place calculation). The
+                                          * outputs are written starting at index zero,
+                                          * so an in-place output holds the result of
+                                          * input[outBegIdx+i] at index i.
+                                          */
 
 typedef struct TA_FuncInfo
 {
@@ -497,6 +503,46 @@ TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder *params,
                                      const TA_Real      *volume,
                                      const TA_Real      *openInterest );
 
+/* Pre-calculated index of a series.
+ *
+ * Built once for an input that does not change anymore, the index
+ * allows to calculate SUM, SMA, VAR, STDDEV, MAX, MIN and MIDPOINT
+ * in constant time per output, whatever the period. This is useful
+ * when many calls with different periods are done on the same data.
+ *
+ * The index keeps a pointer on 'inReal': the data must not be
+ * modified or freed while the index is in use.
+ *
+ * The memory used is about (4 + 2*log2(min(nbElement,100000)))
+ * doubles per element.
+ *
+ * The sums and the sums of the squares are from the start of the
+ * series: VAR and STDDEV overflow when the square of the values
+ * times nbElement is beyond the range of a double.
+ */
+typedef struct TA_SeriesIndex
+{
+  /* Implementation is hidden. */
+  void *hiddenData;
+} TA_SeriesIndex;
+
+TA_RetCode TA_SeriesIndexAlloc( const TA_Real *inReal,
+                                TA_Integer nbElement,
+                                TA_SeriesIndex **allocatedIndex );
+
+TA_RetCode TA_SeriesIndexFree( TA_SeriesIndex *index );
+
+/* Same as TA_SetInputParamRealPtr for the data of the index, but the
+ * functions listed above will be calculated from the index (by
+ * TA_CallFunc and TA_CallFuncAtIndices). The other functions simply
+ * use the data of the index.
+ *
+ * An endIdx beyond the data of the index returns TA_OUT_OF_RANGE_END_INDEX.
+ */
+TA_RetCode TA_SetInputParamSeriesIndex( TA_ParamHolder *params,
+                                        unsigned int paramIndex,
+                                        const TA_SeriesIndex *index );
+
 /* Setup the values of the optional input parameters.
  * If an optional input is not set, a default value will be used.
  *
@@ -526,6 +572,65 @@ TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *params,
                                      unsigned int paramIndex,
                                      TA_Real        *out );
 
+/* Compact storage of a TA_Output_Integer output (the candlestick
+ * patterns, HT_TRENDMODE, CROSSOVER etc.), instead of a TA_Integer
+ * per element.
+ *
+ * TA_SetOutputParamInt8Ptr: one signed char per element, for the
+ *    candlestick patterns, CROSSOVER, CROSSUNDER, HT_TRENDMODE and
+ *    THRESHOLD_EVENTS. The other outputs (like the indices of
+ *    MAXINDEX, MININDEX and MINMAXINDEX) do not fit and
+ *    TA_INVALID_PARAM_HOLDER_TYPE is returned. CDLHIKKAKE and
+ *    CDLHIKKAKEMOD store the value divided by 100 (+/-1 for a
+ *    pattern, +/-2 when confirmed), the others store the value.
+ *    TA_INTEGER_DEFAULT is stored as TA_INT8_DEFAULT.
+ *
+ * TA_SetOutputParamBitPtr: one bit per element, set when the value
+ *    is not zero (a pattern or a signal is found). The element 'i'
+ *    is the bit (out[i/8]>>(i%8))&1, the other bits of the bytes
+ *    are not modified.
+ *
+ * The caller is responsible to allocate sufficient memory, that is
+ * (endIdx-startIdx+1) chars, or (endIdx-startIdx+8)/8 bytes for the
+ * bits (endIdx+1 elements when the output is aligned).
+ *
+ * The value is calculated in a small TA_Integer buffer and then
+ * stored, the bandwidth to the output memory is reduced by 4 (or 32)
+ * times. Only TA_CallFunc and TA_CallFuncAligned support the compact
+ * outputs, the other calls return TA_NOT_SUPPORTED.
+ *
+ * TA_SetOutputParamIntegerPtr can be used again to return to
+ * the TA_Integer storage.
+ */
+#define TA_INT8_DEFAULT (-128)
+
+TA_RetCode TA_SetOutputParamInt8Ptr( TA_ParamHolder *params,
+                                     unsigned int paramIndex,
+                                     signed char    *out );
+
+TA_RetCode TA_SetOutputParamBitPtr( TA_ParamHolder *params,
+                                    unsigned int paramIndex,
+                                    unsigned char  *out );
+
+/* By default the first output is always stored at index zero of the
+ * output buffers, and outBegIdx indicates which input it is for.
+ *
+ * When 'aligned' is non-zero, the output for the input at index 'i' is
+ * stored at index 'i' of the output buffers. The outputs from startIdx
+ * to outBegIdx-1 (where there is not enough data for a value) are set
+ * to NaN, or TA_INTEGER_DEFAULT for integer outputs. The outputs before
+ * startIdx are not modified.
+ *
+ * The output buffers must then have at least endIdx+1 elements and,
+ * unlike the default mode, must not be the same as an input.
+ *
+ * This applies to TA_CallFunc and TA_CallFuncSegments (where the index
+ * is relative to each segment). See also TA_CallFuncAligned to do this
+ * for a single call.
+ */
+TA_RetCode TA_SetOutputAligned( TA_ParamHolder *params,
+                                int aligned );
+
 /* Once the optional parameter are set, it is possible to 
  * get the lookback for this call. This information can be
  * used to calculate the optimal size for the output buffers.
@@ -534,6 +639,16 @@ TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *params,
 TA_RetCode TA_GetLookback( const TA_ParamHolder *params,
                            TA_Integer *lookback );
 
+/* Largest lookback of many calls. Useful to size the history
+ * kept for a stream of bars (see TA_BarQueueAlloc): the last
+ * 'maxLookback+1' bars are enough to calculate the last output
+ * of each of these calls (except for the functions with an
+ * unstable period, see TA_SetUnstablePeriod).
+ */
+TA_RetCode TA_GetMaxLookback( const TA_ParamHolder * const *params,
+                              unsigned int nbParams,
+                              TA_Integer *maxLookback );
+
 /* Finally, call the TA function with the parameters. 
  *
  * The TA function who is going to be called was specified
@@ -545,6 +660,314 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *params,
                         TA_Integer           *outBegIdx,
                         TA_Integer           *outNbElement );
 
+/* Same as TA_CallFunc, with the output aligned with the
+ * input (see TA_SetOutputAligned).
+ */
+TA_RetCode TA_CallFuncAligned( const TA_ParamHolder *params,
+                               TA_Integer            startIdx,
+                               TA_Integer            endIdx,
+                               TA_Integer           *outBegIdx,
+                               TA_Integer           *outNbElement );
+
+/* Call the TA function only at some indices of the input.
+ *
+ * 'indices' must be strictly increasing. The output arrays receive
+ * one value per index: output[k] is the value at indices[outBegIdx+k].
+ * Leading indices for which there is not enough data (within the
+ * lookback) are skipped, 'outBegIdx' is how many were skipped.
+ *
+ * The values are those of a TA_CallFunc from the first to the
+ * last index, but only the requested values are stored. When the
+ * output at an index depends only on its lookback window (moving
+ * sum/average, min/max, linear regression, correlation, math
+ * operators etc.), only the windows around the requested indices
+ * are processed. Functions depending on the whole history (EMA,
+ * RSI, SAR etc.) are processed from the first to the last index
+ * and are identical to TA_CallFunc.
+ *
+ * For the window functions, the running sums start at another
+ * index than in TA_CallFunc and round differently: the values are
+ * not always bit identical. The difference is in the last digits
+ * of the sums, it is usually a few units in the last place of the
+ * output. For the differences of sums (VAR, STDDEV, CORREL, BETA,
+ * LINEARREG...) it is relative to the sums, not to the output:
+ * when the deviation is small compared to the mean, the relative
+ * error on the output can reach 1e-6 (the maximum allowed by the
+ * regression tests is a relative error of 1e-3 of the output, or
+ * 1e-6 of the largest output for the values near zero).
+ *
+ * The outputs must not be the same buffers as the inputs.
+ */
+TA_RetCode TA_CallFuncAtIndices( const TA_ParamHolder *params,
+                                 const TA_Integer     *indices,
+                                 TA_Integer            nbIndices,
+                                 TA_Integer           *outBegIdx,
+                                 TA_Integer           *outNbElement );
+
+/* Call the TA function on many short series at once.
+ *
+ * The inputs are the concatenation of 'nbSegment' series. The
+ * segment 's' is from segmentOffsets[s] to segmentOffsets[s+1]-1
+ * (so segmentOffsets has nbSegment+1 elements). Each segment is
+ * calculated as a distinct series: nothing is carried from the
+ * previous segment.
+ *
+ * The output of each segment is stored at the same offset as its
+ * input, so the output buffers must be as large as the inputs.
+ * outBegIdx and outNbElement are arrays of 'nbSegment' elements,
+ * outBegIdx[s] being relative to the start of the segment:
+ *
+ *    output[segmentOffsets[s]+k] is the value for the input at
+ *    segmentOffsets[s]+outBegIdx[s]+k, for k < outNbElement[s].
+ *
+ * A segment shorter than the lookback produces no output.
+ *
+ * Only the checks of the param holder and of the offsets are done
+ * once per call. Each segment is still a call of the TA function,
+ * which validates its parameters and allocates its temporary
+ * buffers (if any) for every segment.
+ */
+TA_RetCode TA_CallFuncSegments( const TA_ParamHolder *params,
+                                const TA_Integer     *segmentOffsets,
+                                TA_Integer            nbSegment,
+                                TA_Integer           *outBegIdx,
+                                TA_Integer           *outNbElement );
+
+
+/* Warm-start checkpoints.
+ *
+ * A function with an unstable period must process a long history
+ * before its output converges. With a checkpoint, the state of the
+ * calculation at the last bar is saved, and a later call resumes
+ * from it with only the new bars. The output is identical to a
+ * calculation from the start of the whole history.
+ *
+ * Supported functions are EMA, RSI, CMO, ATR, T3 and ADX. The
+ * others return TA_NOT_SUPPORTED.
+ *
+ * TA_Checkpoint is a block of bytes that can be stored as-is (in a
+ * file, a database...). It starts with a header (magic number,
+ * version and size of the state) verified when used: a checkpoint
+ * from another version of TA-Lib is rejected with TA_BAD_PARAM. It
+ * is not portable between platforms of different endianness.
+ */
+#define TA_CHECKPOINT_SIZE 128
+
+typedef struct TA_Checkpoint
+{
+   unsigned char data[TA_CHECKPOINT_SIZE];
+} TA_Checkpoint;
+
+/* Same as TA_CallFunc, plus the state at endIdx saved in 'checkpoint'.
+ *
+ * Returns TA_OUT_OF_RANGE_END_INDEX when endIdx is within the lookback
+ * (there is no state yet). This is also the case for the first output
+ * of RSI and CMO with the Metastock compatibility.
+ */
+TA_RetCode TA_CallFuncCheckpoint( const TA_ParamHolder *params,
+                                  TA_Integer            startIdx,
+                                  TA_Integer            endIdx,
+                                  TA_Integer           *outBegIdx,
+                                  TA_Integer           *outNbElement,
+                                  TA_Checkpoint        *checkpoint );
+
+/* Resume the calculation from 'from' for the 'nbBar' bars following
+ * the bar of the checkpoint.
+ *
+ * The inputs are the new bars only: index zero is the bar just after
+ * the one saved in the checkpoint. There is one output per new bar,
+ * output[i] being for the input at index 'i'.
+ *
+ * The optional inputs must be the same as when the checkpoint was
+ * saved. The state at the last new bar is saved in 'to', which can
+ * be the same as 'from'.
+ */
+TA_RetCode TA_CallFuncResume( const TA_ParamHolder *params,
+                              const TA_Checkpoint  *from,
+                              TA_Integer            nbBar,
+                              TA_Integer           *outNbElement,
+                              TA_Checkpoint        *to );
+
+/* Per-function statistics.
+ *
+ * When enabled with TA_StatsEnable, every calculation is accounted
+ * to its function: the direct calls (TA_MA, TA_S_RSI etc.) and the
+ * calculations done through the abstract interface (TA_CallFunc,
+ * TA_CallFuncAtIndices, TA_CallFuncSegments etc.). A call processing
+ * many spans or segments counts once per span/segment. A function
+ * calling another TA function (MA calling SMA, STOCHRSI calling RSI
+ * etc.) is accounted to both.
+ *
+ * The heap bytes are those allocated by the thread of the
+ * calculation, including the functions it calls. The time is
+ * elapsed (wall clock) time, except on the systems with neither a
+ * monotonic clock nor the Windows performance counter, where it is
+ * the processor time of the process (clock()).
+ *
+ * The statistics are kept until TA_StatsReset. They can be enabled
+ * while functions are called from multiple threads: each value is
+ * updated atomically (with GCC, clang and Visual C++), but a copy
+ * taken during the calls may mix values from before and after a
+ * call. When disabled, which is the default, the cost is one test
+ * of a flag per call.
+ */
+typedef struct TA_FuncStats
+{
+   UInt64 nbCall;          /* Number of calculation. */
+   UInt64 nbBar;           /* Sum of the input range (endIdx-startIdx+1). */
+   UInt64 totalTime;       /* Total time in nanoseconds. */
+   UInt64 peakTime;        /* Longest calculation in nanoseconds. */
+   UInt64 allocBytes;      /* Total bytes allocated on the heap. */
+   UInt64 peakAllocBytes;  /* Largest allocation by one calculation. */
+} TA_FuncStats;
+
+/* Enable (non-zero) or disable (zero) the statistics. */
+void TA_StatsEnable( int enable );
+
+/* Reset to zero the statistics of all the functions. */
+void TA_StatsReset( void );
+
+/* Get a copy of the statistics of a function. */
+TA_RetCode TA_GetFuncStats( const TA_FuncHandle *handle,
+                            TA_FuncStats *stats );
+
+/* Result cache.
+ *
+ * A TA_ResultCache keeps the outputs of the latest calculations. When
+ * a param holder is attached to a cache with TA_SetParamHolderCache,
+ * TA_CallFunc first looks for the same calculation in the cache:
+ *
+ *   - Same function, optional inputs and startIdx, on the same series
+ *     up to at least endIdx: the output is copied from the cache.
+ *
+ *   - Same, but the series has grown beyond the cached endIdx: only
+ *     the new bars are calculated when the output at an index depends
+ *     only on its lookback window (moving sum/average, min/max, math
+ *     operators etc.) or when the function supports the checkpoints
+ *     (see TA_CallFuncCheckpoint). The others are calculated again.
+ *
+ *   - Otherwise, the function is called and its output is kept.
+ *
+ * The output is the same as a TA_CallFunc without the cache, except
+ * for the rounding of the running sums when only the new bars are
+ * calculated (as for a TA_CallFunc with another startIdx).
+ *
+ * The aligned output (TA_SetOutputAligned or TA_CallFuncAligned)
+ * also uses the cache, with the same entries as the calls not
+ * aligned.
+ *
+ * When full, the least recently used calculations are evicted. A
+ * calculation taking more than 'maxBytes' by itself is not kept.
+ *
+ * A cache is not thread safe: use one cache per thread.
+ */
+typedef struct TA_ResultCache
+{
+  /* Implementation is hidden. */
+  void *hiddenData;
+} TA_ResultCache;
+
+typedef struct TA_ResultCacheStats
+{
+   UInt64 nbHit;           /* Output copied from the cache. */
+   UInt64 nbExtend;        /* Only the new bars calculated. */
+   UInt64 nbMiss;          /* Whole calculation done. */
+   UInt64 nbEvict;         /* Calculations removed when full. */
+   unsigned int nbEntry;   /* Calculations in the cache. */
+   unsigned int nbBytes;   /* Memory used by these calculations. */
+} TA_ResultCacheStats;
+
+TA_RetCode TA_ResultCacheAlloc( unsigned int maxEntry,
+                                unsigned int maxBytes,
+                                TA_ResultCache **allocatedCache );
+
+TA_RetCode TA_ResultCacheFree( TA_ResultCache *cache );
+
+/* Remove all the calculations. The compatibility and the unstable
+ * periods are part of the key, changing them does not require to
+ * clear the cache.
+ */
+TA_RetCode TA_ResultCacheClear( TA_ResultCache *cache );
+
+TA_RetCode TA_ResultCacheGetStats( const TA_ResultCache *cache,
+                                   TA_ResultCacheStats *stats );
+
+/* Attach a param holder to a cache (NULL to detach).
+ *
+ * 'seriesId' identifies the inputs. 'seriesVersion' must change
+ * whenever a value already seen with this seriesId is modified;
+ * appending new bars after the end keeps the same version. The
+ * data must stay at the same address or be copied as-is: the
+ * cache trusts the identifiers and does not read the data again.
+ *
+ * With a seriesId of zero, the inputs are identified by a hash of
+ * their content within the range used by the calculation. There is
+ * then no need to manage the identifiers, but the output is reused
+ * only for the same startIdx and endIdx.
+ */
+TA_RetCode TA_SetParamHolderCache( TA_ParamHolder *params,
+                                   TA_ResultCache *cache,
+                                   UInt64 seriesId,
+                                   unsigned int seriesVersion );
+
+/* Multiple timeframes.
+ *
+ * A TA_Timeframes holds the bars of a base series (for example one
+ * minute bars) aggregated by some factors (for example 5, 15, 60...),
+ * all done in a single pass on the base series. Each aggregated bar
+ * is made of 'factor' consecutive base bars, starting with the first
+ * one: the open is the first open, the high the highest high, the low
+ * the lowest low, the close the last close and the volume the sum of
+ * the volumes. The last aggregated bar can be incomplete.
+ *
+ * A factor of 1 is the base series itself (no copy).
+ *
+ * The base series must not be modified or freed while in use.
+ * NULL can be used for a price not needed.
+ */
+typedef struct TA_Timeframes
+{
+  /* Implementation is hidden. */
+  void *hiddenData;
+} TA_Timeframes;
+
+TA_RetCode TA_TimeframesAlloc( const TA_Real    *inOpen,
+                               const TA_Real    *inHigh,
+                               const TA_Real    *inLow,
+                               const TA_Real    *inClose,
+                               const TA_Real    *inVolume,
+                               TA_Integer        nbBar,
+                               const TA_Integer *factors,
+                               TA_Integer        nbTimeframe,
+                               TA_Timeframes   **allocatedTimeframes );
+
+TA_RetCode TA_TimeframesFree( TA_Timeframes *timeframes );
+
+/* Calculate the function on all the bars of every timeframe.
+ *
+ * The inputs of the param holder must be the base arrays given to
+ * TA_TimeframesAlloc (price or real inputs). They are replaced by
+ * the corresponding aggregated arrays of each timeframe.
+ *
+ * The output buffers must have nbTimeframe*nbBar elements: the
+ * output of the timeframe 't' starts at output[t*nbBar]. outBegIdx
+ * and outNbElement are arrays of nbTimeframe elements.
+ *
+ * Without projection, output[t*nbBar+k] is the value for the
+ * aggregated bar outBegIdx[t]+k, for k < outNbElement[t].
+ *
+ * With projection, output[t*nbBar+i] is the value for the base bar
+ * 'i': the one of the last aggregated bar completed at or before the
+ * base bar 'i' (never a bar in the future). There is no value (NaN,
+ * or TA_INTEGER_DEFAULT for integer outputs) before the first one.
+ * outBegIdx[t] is then the first base bar with a value and
+ * outNbElement[t] is nbBar-outBegIdx[t] (zero if none).
+ */
+TA_RetCode TA_CallFuncTimeframes( const TA_ParamHolder *params,
+                                  const TA_Timeframes  *timeframes,
+                                  int                   projected,
+                                  TA_Integer           *outBegIdx,
+                                  TA_Integer           *outNbElement );
 
 /* Return XML representation of all the TA functions.
  * The returned array is the same as the ta_func_api.xml file.
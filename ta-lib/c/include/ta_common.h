@@ -41,7 +41,7 @@
  * use the "NEXT AVAILABLE NUMBER" and increment the
  * number in this file.
  *
- * NEXT AVAILABLE NUMBER: 181
+ * NEXT AVAILABLE NUMBER: 189
  */
 #define TA_INTERNAL_ERROR(Id) ((TA_RetCode)(TA_INTERNAL_ERROR+Id))
 
@@ -143,6 +143,148 @@ void TA_SetRetCodeInfo( TA_RetCode theRetCode, TA_RetCodeInfo *retCodeInfo );
 TA_RetCode TA_Initialize( void );
 TA_RetCode TA_Shutdown( void );
 
+/* Bar builder.
+ *
+ * Aggregate a stream of trades into bars. A bar closes:
+ *   TA_BAR_TIME:   when a trade is in a following period. The periods
+ *                  are the multiples of 'threshold' (in the unit of the
+ *                  timestamps) and the timestamp of the bar is the start
+ *                  of its period. Periods without trades have no bar.
+ *   TA_BAR_TICK:   after 'threshold' trades.
+ *   TA_BAR_VOLUME: when the sum of the sizes reaches 'threshold'.
+ *   TA_BAR_DOLLAR: when the sum of price*size reaches 'threshold'.
+ * Except for time bars, the timestamp of a bar is the one of its
+ * first trade and the trade reaching the threshold is the last of
+ * the bar (it is not split between two bars).
+ *
+ * The closed bars are kept in arrays (open, high, low, close, volume
+ * and timestamp) that can be passed as-is to TA_SetInputParamPricePtr
+ * or to the TA functions. Only the last 'maxBar' bars are kept: the
+ * oldest bar is dropped when a new one closes, and the last bars are
+ * always contiguous in memory.
+ *
+ * When 'nbNewBar' bars close, the TA functions can be called only for
+ * these bars (at the end of the arrays), for example with the
+ * TA_CallFuncResume of the last checkpoint.
+ *
+ * The timestamps must be increasing (or equal). A builder is not
+ * thread safe.
+ */
+typedef enum
+{
+   TA_BAR_TIME,
+   TA_BAR_TICK,
+   TA_BAR_VOLUME,
+   TA_BAR_DOLLAR
+} TA_BarType;
+
+typedef struct TA_BarBuilder
+{
+  /* Implementation is hidden. */
+  void *hiddenData;
+} TA_BarBuilder;
+
+typedef struct TA_Bars
+{
+   TA_Integer nbBar;        /* Number of bars in the arrays. */
+   UInt64     firstBar;     /* Number of the first bar since the start. */
+   const Int64   *timestamp;
+   const TA_Real *open;
+   const TA_Real *high;
+   const TA_Real *low;
+   const TA_Real *close;
+   const TA_Real *volume;
+} TA_Bars;
+
+TA_RetCode TA_BarBuilderAlloc( TA_BarType type,
+                               TA_Real threshold,
+                               TA_Integer maxBar,
+                               TA_BarBuilder **allocatedBuilder );
+
+TA_RetCode TA_BarBuilderFree( TA_BarBuilder *builder );
+
+/* Add 'nbTrade' trades. 'nbNewBar' is the number of bars closed by
+ * these trades (it can be more than maxBar).
+ */
+TA_RetCode TA_BarBuilderAdd( TA_BarBuilder *builder,
+                             TA_Integer nbTrade,
+                             const Int64   *timestamp,
+                             const TA_Real *price,
+                             const TA_Real *size,
+                             TA_Integer *nbNewBar );
+
+/* Close the current bar, if any. For time bars, to be called when the
+ * period is over without a trade in the following period, or at the
+ * end of the stream.
+ */
+TA_RetCode TA_BarBuilderFlush( TA_BarBuilder *builder,
+                               TA_Integer *nbNewBar );
+
+/* Get the closed bars. The pointers are valid until the next
+ * TA_BarBuilderAdd, TA_BarBuilderFlush or TA_BarBuilderFree.
+ */
+TA_RetCode TA_BarBuilderGetBars( const TA_BarBuilder *builder,
+                                 TA_Bars *bars );
+
+/* Bar queue.
+ *
+ * Lock-free queue of bars between one producer thread (for example
+ * receiving the market data) and one consumer thread (calculating the
+ * TA functions). Neither side ever waits or allocates memory.
+ *
+ * The consumer keeps the last 'historySize' bars in arrays like the
+ * ones of the bar builder (see TA_Bars). To calculate only the outputs
+ * for the new bars, 'historySize' must be at least the largest lookback
+ * of the functions (see TA_GetMaxLookback) plus the number of bars
+ * popped at once. The new bars are then the last 'nbNewBar' of the
+ * arrays, and a call with startIdx nbBar-nbNewBar and endIdx nbBar-1
+ * calculates only them.
+ *
+ * 'capacity' is the number of bars that can wait in the queue. It is
+ * rounded up to a power of two.
+ *
+ * Only TA_BarQueuePush can be called by the producer thread. Only
+ * TA_BarQueuePop and TA_BarQueueGetBars can be called by the consumer
+ * thread.
+ */
+typedef struct TA_BarQueue
+{
+  /* Implementation is hidden. */
+  void *hiddenData;
+} TA_BarQueue;
+
+TA_RetCode TA_BarQueueAlloc( TA_Integer capacity,
+                             TA_Integer historySize,
+                             TA_BarQueue **allocatedQueue );
+
+TA_RetCode TA_BarQueueFree( TA_BarQueue *queue );
+
+/* Producer: add up to 'nbBar' bars. 'nbPushed' is how many were
+ * added, less than nbBar when the queue is full.
+ */
+TA_RetCode TA_BarQueuePush( TA_BarQueue *queue,
+                            TA_Integer nbBar,
+                            const Int64   *timestamp,
+                            const TA_Real *open,
+                            const TA_Real *high,
+                            const TA_Real *low,
+                            const TA_Real *close,
+                            const TA_Real *volume,
+                            TA_Integer *nbPushed );
+
+/* Consumer: move up to 'maxBar' bars from the queue to the history.
+ * 'nbNewBar' is how many were moved (zero when the queue is empty).
+ */
+TA_RetCode TA_BarQueuePop( TA_BarQueue *queue,
+                           TA_Integer maxBar,
+                           TA_Integer *nbNewBar );
+
+/* Consumer: get the history. The pointers are valid until the next
+ * TA_BarQueuePop or TA_BarQueueFree.
+ */
+TA_RetCode TA_BarQueueGetBars( const TA_BarQueue *queue,
+                               TA_Bars *bars );
+
 #ifdef __cplusplus
 }
 #endif
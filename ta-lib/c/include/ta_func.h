@@ -2725,6 +2725,58 @@ TA_LIB_API TA_RetCode TA_S_COSH( int    startIdx,
 TA_LIB_API int TA_COSH_Lookback( void );
 
 
+/*
+ * TA_CROSSOVER - Series 0 crossing above series 1
+ * 
+ * Input  = double, double
+ * Output = int
+ * 
+ */
+TA_LIB_API TA_RetCode TA_CROSSOVER( int    startIdx,
+                                    int    endIdx,
+                                               const double inReal0[],
+                                               const double inReal1[],
+                                               int          *outBegIdx,
+                                               int          *outNBElement,
+                                               int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_CROSSOVER( int    startIdx,
+                                      int    endIdx,
+                                                 const float  inReal0[],
+                                                 const float  inReal1[],
+                                                 int          *outBegIdx,
+                                                 int          *outNBElement,
+                                                 int           outInteger[] );
+
+TA_LIB_API int TA_CROSSOVER_Lookback( void );
+
+
+/*
+ * TA_CROSSUNDER - Series 0 crossing below series 1
+ * 
+ * Input  = double, double
+ * Output = int
+ * 
+ */
+TA_LIB_API TA_RetCode TA_CROSSUNDER( int    startIdx,
+                                     int    endIdx,
+                                                const double inReal0[],
+                                                const double inReal1[],
+                                                int          *outBegIdx,
+                                                int          *outNBElement,
+                                                int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_CROSSUNDER( int    startIdx,
+                                       int    endIdx,
+                                                  const float  inReal0[],
+                                                  const float  inReal1[],
+                                                  int          *outBegIdx,
+                                                  int          *outNBElement,
+                                                  int           outInteger[] );
+
+TA_LIB_API int TA_CROSSUNDER_Lookback( void );
+
+
 /*
  * TA_DEMA - Double Exponential Moving Average
  * 
@@ -3475,6 +3527,38 @@ TA_LIB_API TA_RetCode TA_S_MACDFIX( int    startIdx,
 TA_LIB_API int TA_MACDFIX_Lookback( int           optInSignalPeriod );  /* From 1 to 100000 */
 
 
+/*
+ * TA_MAD - Median Absolute Deviation
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_LIB_API TA_RetCode TA_MAD( int    startIdx,
+                              int    endIdx,
+                                         const double inReal[],
+                                         int           optInTimePeriod, /* From 2 to 100000 */
+                                         int          *outBegIdx,
+                                         int          *outNBElement,
+                                         double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MAD( int    startIdx,
+                                int    endIdx,
+                                           const float  inReal[],
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           int          *outBegIdx,
+                                           int          *outNBElement,
+                                           double        outReal[] );
+
+TA_LIB_API int TA_MAD_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_MAMA - MESA Adaptive Moving Average
  * 
@@ -3624,6 +3708,38 @@ TA_LIB_API TA_RetCode TA_S_MAXINDEX( int    startIdx,
 TA_LIB_API int TA_MAXINDEX_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
 
+/*
+ * TA_MEDIAN - Median over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_LIB_API TA_RetCode TA_MEDIAN( int    startIdx,
+                                 int    endIdx,
+                                            const double inReal[],
+                                            int           optInTimePeriod, /* From 2 to 100000 */
+                                            int          *outBegIdx,
+                                            int          *outNBElement,
+                                            double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_MEDIAN( int    startIdx,
+                                   int    endIdx,
+                                              const float  inReal[],
+                                              int           optInTimePeriod, /* From 2 to 100000 */
+                                              int          *outBegIdx,
+                                              int          *outNBElement,
+                                              double        outReal[] );
+
+TA_LIB_API int TA_MEDIAN_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_MEDPRICE - Median Price
  * 
@@ -4189,6 +4305,44 @@ TA_LIB_API int TA_PPO_Lookback( int           optInFastPeriod, /* From 2 to 1000
                                          int           optInSlowPeriod, /* From 2 to 100000 */
                                          TA_MAType     optInMAType ); 
 
+/*
+ * TA_QUANTILE - Quantile over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * optInQuantile:(From 0 to 1)
+ *    Fraction of the values of the period below the output (0.5 is the median)
+ * 
+ * 
+ */
+TA_LIB_API TA_RetCode TA_QUANTILE( int    startIdx,
+                                   int    endIdx,
+                                              const double inReal[],
+                                              int           optInTimePeriod, /* From 2 to 100000 */
+                                              double        optInQuantile, /* From 0 to 1 */
+                                              int          *outBegIdx,
+                                              int          *outNBElement,
+                                              double        outReal[] );
+
+TA_LIB_API TA_RetCode TA_S_QUANTILE( int    startIdx,
+                                     int    endIdx,
+                                                const float  inReal[],
+                                                int           optInTimePeriod, /* From 2 to 100000 */
+                                                double        optInQuantile, /* From 0 to 1 */
+                                                int          *outBegIdx,
+                                                int          *outNBElement,
+                                                double        outReal[] );
+
+TA_LIB_API int TA_QUANTILE_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
+                                              double        optInQuantile );  /* From 0 to 1 */
+
+
 /*
  * TA_ROC - Rate of change : ((price/prevPrice)-1)*100
  * 
@@ -4944,6 +5098,38 @@ TA_LIB_API TA_RetCode TA_S_TEMA( int    startIdx,
 TA_LIB_API int TA_TEMA_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
 
+/*
+ * TA_THRESHOLD_EVENTS - Crossings of a threshold
+ * 
+ * Input  = double
+ * Output = int
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInThreshold:(From TA_REAL_MIN to TA_REAL_MAX)
+ *    Level crossed by the input
+ * 
+ * 
+ */
+TA_LIB_API TA_RetCode TA_THRESHOLD_EVENTS( int    startIdx,
+                                           int    endIdx,
+                                                      const double inReal[],
+                                                      double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                      int          *outBegIdx,
+                                                      int          *outNBElement,
+                                                      int           outInteger[] );
+
+TA_LIB_API TA_RetCode TA_S_THRESHOLD_EVENTS( int    startIdx,
+                                             int    endIdx,
+                                                        const float  inReal[],
+                                                        double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                        int          *outBegIdx,
+                                                        int          *outNBElement,
+                                                        int           outInteger[] );
+
+TA_LIB_API int TA_THRESHOLD_EVENTS_Lookback( double        optInThreshold );  /* From TA_REAL_MIN to TA_REAL_MAX */
+
+
 /*
  * TA_TRANGE - True Range
  * 
@@ -0,0 +1,8482 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Important: This file is automatically generated by the utility gen_code.
+ *
+ * Header-only C++ interface to the TA functions (requires C++20).
+ *
+ * Each function of ta_func.h is available in the namespace 'ta' with the
+ * inputs and outputs passed as std::span and the optional inputs as
+ * default arguments:
+ *
+ *    std::vector<double> close(...), sma(close.size());
+ *    ta::Result result = ta::SMA( close, sma, 20 );
+ *    if( result )
+ *       ... sma[0] is the output for close[result.begIdx] ...
+ *
+ * All the elements of the inputs are used (startIdx is zero and endIdx
+ * is the size minus one). The inputs of a function must all have the
+ * same size. An output must have at least the size of the inputs minus
+ * the lookback, otherwise TA_BAD_PARAM is returned.
+ *
+ * There is one overload for double inputs (TA_XXX) and one for float
+ * inputs (TA_S_XXX). The calls go directly to these functions: the
+ * overload is selected at compile time and there is no TA_ParamHolder.
+ *
+ * The lookback is available with ta::XXX_Lookback().
+ */
+
+#ifndef TA_LIB_HPP
+#define TA_LIB_HPP
+
+#include <cstddef>
+#include <climits>
+#include <span>
+
+#ifndef TA_LIBC_H
+   #include "ta_libc.h"
+#endif
+
+namespace ta {
+
+struct Result
+{
+   TA_RetCode retCode;
+   int        begIdx;    /* Index in the inputs of the first output. */
+   int        nbElement; /* Number of elements written in the outputs. */
+
+   explicit operator bool() const noexcept { return retCode == TA_SUCCESS; }
+};
+
+namespace detail {
+
+/* Size of the inputs, or -1 if they do not all have the same size. */
+template<typename Span, typename... Spans>
+inline int nbBar( const Span &first, const Spans &... others ) noexcept
+{
+   if( first.size() > (std::size_t)INT_MAX )
+      return -1;
+   if( ((others.size() != first.size()) || ...) )
+      return -1;
+   return (int)first.size();
+}
+
+/* True when all the outputs can hold the outputs for 'nbBar' inputs.
+ * The lookback is needed only when an output is smaller than the inputs.
+ */
+template<typename Lookback, typename... Spans>
+inline bool outputFits( int nbBar, Lookback lookback, const Spans &... outputs ) noexcept
+{
+   std::size_t minSize;
+   int nbOutput;
+
+   minSize = (std::size_t)nbBar;
+   ((minSize = outputs.size() < minSize? outputs.size() : minSize), ...);
+   if( minSize == (std::size_t)nbBar )
+      return true;
+
+   nbOutput = nbBar-lookback();
+   return (nbOutput <= 0) || (minSize >= (std::size_t)nbOutput);
+}
+
+inline Result badParam() noexcept
+{
+   Result result = { TA_BAD_PARAM, 0, 0 };
+   return result;
+}
+
+} /* namespace detail */
+
+/* ACCBANDS - Acceleration Bands */
+inline int ACCBANDS_Lookback( int optInTimePeriod = 20 ) noexcept
+{
+   return TA_ACCBANDS_Lookback( optInTimePeriod );
+}
+
+inline Result ACCBANDS( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<const double> inClose,
+                        std::span<double> outRealUpperBand,
+                        std::span<double> outRealMiddleBand,
+                        std::span<double> outRealLowerBand,
+                        int optInTimePeriod = 20 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ACCBANDS_Lookback( optInTimePeriod ); }, outRealUpperBand, outRealMiddleBand, outRealLowerBand ) )
+      return detail::badParam();
+
+   result.retCode = TA_ACCBANDS( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outRealUpperBand.data(),
+                                 outRealMiddleBand.data(),
+                                 outRealLowerBand.data() );
+   return result;
+}
+
+inline Result ACCBANDS( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<const float> inClose,
+                        std::span<double> outRealUpperBand,
+                        std::span<double> outRealMiddleBand,
+                        std::span<double> outRealLowerBand,
+                        int optInTimePeriod = 20 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ACCBANDS_Lookback( optInTimePeriod ); }, outRealUpperBand, outRealMiddleBand, outRealLowerBand ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ACCBANDS( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(), inClose.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outRealUpperBand.data(),
+                                   outRealMiddleBand.data(),
+                                   outRealLowerBand.data() );
+   return result;
+}
+
+/* ACOS - Vector Trigonometric ACos */
+inline int ACOS_Lookback() noexcept
+{
+   return TA_ACOS_Lookback();
+}
+
+inline Result ACOS( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ACOS_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ACOS( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ACOS( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ACOS_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ACOS( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* AD - Chaikin A/D Line */
+inline int AD_Lookback() noexcept
+{
+   return TA_AD_Lookback();
+}
+
+inline Result AD( std::span<const double> inHigh,
+                  std::span<const double> inLow,
+                  std::span<const double> inClose,
+                  std::span<const double> inVolume,
+                  std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_AD( 0, nbBar-1,
+                           inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                           &result.begIdx, &result.nbElement,
+                           outReal.data() );
+   return result;
+}
+
+inline Result AD( std::span<const float> inHigh,
+                  std::span<const float> inLow,
+                  std::span<const float> inClose,
+                  std::span<const float> inVolume,
+                  std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_AD( 0, nbBar-1,
+                             inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+/* ADD - Vector Arithmetic Add */
+inline int ADD_Lookback() noexcept
+{
+   return TA_ADD_Lookback();
+}
+
+inline Result ADD( std::span<const double> inReal0,
+                   std::span<const double> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ADD( 0, nbBar-1,
+                            inReal0.data(), inReal1.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result ADD( std::span<const float> inReal0,
+                   std::span<const float> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ADD( 0, nbBar-1,
+                              inReal0.data(), inReal1.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* ADOSC - Chaikin A/D Oscillator */
+inline int ADOSC_Lookback( int optInFastPeriod = 3,
+                           int optInSlowPeriod = 10 ) noexcept
+{
+   return TA_ADOSC_Lookback( optInFastPeriod, optInSlowPeriod );
+}
+
+inline Result ADOSC( std::span<const double> inHigh,
+                     std::span<const double> inLow,
+                     std::span<const double> inClose,
+                     std::span<const double> inVolume,
+                     std::span<double> outReal,
+                     int optInFastPeriod = 3,
+                     int optInSlowPeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADOSC_Lookback( optInFastPeriod, optInSlowPeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ADOSC( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                              optInFastPeriod, optInSlowPeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+inline Result ADOSC( std::span<const float> inHigh,
+                     std::span<const float> inLow,
+                     std::span<const float> inClose,
+                     std::span<const float> inVolume,
+                     std::span<double> outReal,
+                     int optInFastPeriod = 3,
+                     int optInSlowPeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADOSC_Lookback( optInFastPeriod, optInSlowPeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ADOSC( 0, nbBar-1,
+                                inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                                optInFastPeriod, optInSlowPeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+/* ADX - Average Directional Movement Index */
+inline int ADX_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_ADX_Lookback( optInTimePeriod );
+}
+
+inline Result ADX( std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<const double> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ADX( 0, nbBar-1,
+                            inHigh.data(), inLow.data(), inClose.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result ADX( std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<const float> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ADX( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* ADXR - Average Directional Movement Index Rating */
+inline int ADXR_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_ADXR_Lookback( optInTimePeriod );
+}
+
+inline Result ADXR( std::span<const double> inHigh,
+                    std::span<const double> inLow,
+                    std::span<const double> inClose,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADXR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ADXR( 0, nbBar-1,
+                             inHigh.data(), inLow.data(), inClose.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ADXR( std::span<const float> inHigh,
+                    std::span<const float> inLow,
+                    std::span<const float> inClose,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ADXR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ADXR( 0, nbBar-1,
+                               inHigh.data(), inLow.data(), inClose.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* APO - Absolute Price Oscillator */
+inline int APO_Lookback( int optInFastPeriod = 12,
+                         int optInSlowPeriod = 26,
+                         TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_APO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType );
+}
+
+inline Result APO( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInFastPeriod = 12,
+                   int optInSlowPeriod = 26,
+                   TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return APO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_APO( 0, nbBar-1,
+                            inReal.data(),
+                            optInFastPeriod, optInSlowPeriod, optInMAType,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result APO( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInFastPeriod = 12,
+                   int optInSlowPeriod = 26,
+                   TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return APO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_APO( 0, nbBar-1,
+                              inReal.data(),
+                              optInFastPeriod, optInSlowPeriod, optInMAType,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* AROON - Aroon */
+inline int AROON_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_AROON_Lookback( optInTimePeriod );
+}
+
+inline Result AROON( std::span<const double> inHigh,
+                     std::span<const double> inLow,
+                     std::span<double> outAroonDown,
+                     std::span<double> outAroonUp,
+                     int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AROON_Lookback( optInTimePeriod ); }, outAroonDown, outAroonUp ) )
+      return detail::badParam();
+
+   result.retCode = TA_AROON( 0, nbBar-1,
+                              inHigh.data(), inLow.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outAroonDown.data(),
+                              outAroonUp.data() );
+   return result;
+}
+
+inline Result AROON( std::span<const float> inHigh,
+                     std::span<const float> inLow,
+                     std::span<double> outAroonDown,
+                     std::span<double> outAroonUp,
+                     int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AROON_Lookback( optInTimePeriod ); }, outAroonDown, outAroonUp ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_AROON( 0, nbBar-1,
+                                inHigh.data(), inLow.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outAroonDown.data(),
+                                outAroonUp.data() );
+   return result;
+}
+
+/* AROONOSC - Aroon Oscillator */
+inline int AROONOSC_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_AROONOSC_Lookback( optInTimePeriod );
+}
+
+inline Result AROONOSC( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AROONOSC_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_AROONOSC( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result AROONOSC( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AROONOSC_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_AROONOSC( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* ASIN - Vector Trigonometric ASin */
+inline int ASIN_Lookback() noexcept
+{
+   return TA_ASIN_Lookback();
+}
+
+inline Result ASIN( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ASIN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ASIN( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ASIN( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ASIN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ASIN( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* ATAN - Vector Trigonometric ATan */
+inline int ATAN_Lookback() noexcept
+{
+   return TA_ATAN_Lookback();
+}
+
+inline Result ATAN( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ATAN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ATAN( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ATAN( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ATAN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ATAN( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* ATR - Average True Range */
+inline int ATR_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_ATR_Lookback( optInTimePeriod );
+}
+
+inline Result ATR( std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<const double> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ATR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ATR( 0, nbBar-1,
+                            inHigh.data(), inLow.data(), inClose.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result ATR( std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<const float> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ATR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ATR( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* AVGPRICE - Average Price */
+inline int AVGPRICE_Lookback() noexcept
+{
+   return TA_AVGPRICE_Lookback();
+}
+
+inline Result AVGPRICE( std::span<const double> inOpen,
+                        std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<const double> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AVGPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_AVGPRICE( 0, nbBar-1,
+                                 inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result AVGPRICE( std::span<const float> inOpen,
+                        std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<const float> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AVGPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_AVGPRICE( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* AVGDEV - Average Deviation */
+inline int AVGDEV_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_AVGDEV_Lookback( optInTimePeriod );
+}
+
+inline Result AVGDEV( std::span<const double> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AVGDEV_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_AVGDEV( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result AVGDEV( std::span<const float> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return AVGDEV_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_AVGDEV( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* BBANDS - Bollinger Bands */
+inline int BBANDS_Lookback( int optInTimePeriod = 5,
+                            double optInNbDevUp = 2.000000e+0,
+                            double optInNbDevDn = 2.000000e+0,
+                            TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_BBANDS_Lookback( optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType );
+}
+
+inline Result BBANDS( std::span<const double> inReal,
+                      std::span<double> outRealUpperBand,
+                      std::span<double> outRealMiddleBand,
+                      std::span<double> outRealLowerBand,
+                      int optInTimePeriod = 5,
+                      double optInNbDevUp = 2.000000e+0,
+                      double optInNbDevDn = 2.000000e+0,
+                      TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BBANDS_Lookback( optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType ); }, outRealUpperBand, outRealMiddleBand, outRealLowerBand ) )
+      return detail::badParam();
+
+   result.retCode = TA_BBANDS( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+                               &result.begIdx, &result.nbElement,
+                               outRealUpperBand.data(),
+                               outRealMiddleBand.data(),
+                               outRealLowerBand.data() );
+   return result;
+}
+
+inline Result BBANDS( std::span<const float> inReal,
+                      std::span<double> outRealUpperBand,
+                      std::span<double> outRealMiddleBand,
+                      std::span<double> outRealLowerBand,
+                      int optInTimePeriod = 5,
+                      double optInNbDevUp = 2.000000e+0,
+                      double optInNbDevDn = 2.000000e+0,
+                      TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BBANDS_Lookback( optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType ); }, outRealUpperBand, outRealMiddleBand, outRealLowerBand ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_BBANDS( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+                                 &result.begIdx, &result.nbElement,
+                                 outRealUpperBand.data(),
+                                 outRealMiddleBand.data(),
+                                 outRealLowerBand.data() );
+   return result;
+}
+
+/* BETA - Beta */
+inline int BETA_Lookback( int optInTimePeriod = 5 ) noexcept
+{
+   return TA_BETA_Lookback( optInTimePeriod );
+}
+
+inline Result BETA( std::span<const double> inReal0,
+                    std::span<const double> inReal1,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 5 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BETA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_BETA( 0, nbBar-1,
+                             inReal0.data(), inReal1.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result BETA( std::span<const float> inReal0,
+                    std::span<const float> inReal1,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 5 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BETA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_BETA( 0, nbBar-1,
+                               inReal0.data(), inReal1.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* BOP - Balance Of Power */
+inline int BOP_Lookback() noexcept
+{
+   return TA_BOP_Lookback();
+}
+
+inline Result BOP( std::span<const double> inOpen,
+                   std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<const double> inClose,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BOP_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_BOP( 0, nbBar-1,
+                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result BOP( std::span<const float> inOpen,
+                   std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<const float> inClose,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return BOP_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_BOP( 0, nbBar-1,
+                              inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* CCI - Commodity Channel Index */
+inline int CCI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_CCI_Lookback( optInTimePeriod );
+}
+
+inline Result CCI( std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<const double> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CCI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_CCI( 0, nbBar-1,
+                            inHigh.data(), inLow.data(), inClose.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result CCI( std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<const float> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CCI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CCI( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* CDL2CROWS - Two Crows */
+inline int CDL2CROWS_Lookback() noexcept
+{
+   return TA_CDL2CROWS_Lookback();
+}
+
+inline Result CDL2CROWS( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL2CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL2CROWS( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDL2CROWS( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL2CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL2CROWS( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDL3BLACKCROWS - Three Black Crows */
+inline int CDL3BLACKCROWS_Lookback() noexcept
+{
+   return TA_CDL3BLACKCROWS_Lookback();
+}
+
+inline Result CDL3BLACKCROWS( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3BLACKCROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3BLACKCROWS( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDL3BLACKCROWS( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3BLACKCROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3BLACKCROWS( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDL3INSIDE - Three Inside Up/Down */
+inline int CDL3INSIDE_Lookback() noexcept
+{
+   return TA_CDL3INSIDE_Lookback();
+}
+
+inline Result CDL3INSIDE( std::span<const double> inOpen,
+                          std::span<const double> inHigh,
+                          std::span<const double> inLow,
+                          std::span<const double> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3INSIDE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3INSIDE( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CDL3INSIDE( std::span<const float> inOpen,
+                          std::span<const float> inHigh,
+                          std::span<const float> inLow,
+                          std::span<const float> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3INSIDE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3INSIDE( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* CDL3LINESTRIKE - Three-Line Strike  */
+inline int CDL3LINESTRIKE_Lookback() noexcept
+{
+   return TA_CDL3LINESTRIKE_Lookback();
+}
+
+inline Result CDL3LINESTRIKE( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3LINESTRIKE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3LINESTRIKE( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDL3LINESTRIKE( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3LINESTRIKE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3LINESTRIKE( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDL3OUTSIDE - Three Outside Up/Down */
+inline int CDL3OUTSIDE_Lookback() noexcept
+{
+   return TA_CDL3OUTSIDE_Lookback();
+}
+
+inline Result CDL3OUTSIDE( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3OUTSIDE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3OUTSIDE( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDL3OUTSIDE( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3OUTSIDE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3OUTSIDE( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDL3STARSINSOUTH - Three Stars In The South */
+inline int CDL3STARSINSOUTH_Lookback() noexcept
+{
+   return TA_CDL3STARSINSOUTH_Lookback();
+}
+
+inline Result CDL3STARSINSOUTH( std::span<const double> inOpen,
+                                std::span<const double> inHigh,
+                                std::span<const double> inLow,
+                                std::span<const double> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3STARSINSOUTH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3STARSINSOUTH( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result CDL3STARSINSOUTH( std::span<const float> inOpen,
+                                std::span<const float> inHigh,
+                                std::span<const float> inLow,
+                                std::span<const float> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3STARSINSOUTH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3STARSINSOUTH( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* CDL3WHITESOLDIERS - Three Advancing White Soldiers */
+inline int CDL3WHITESOLDIERS_Lookback() noexcept
+{
+   return TA_CDL3WHITESOLDIERS_Lookback();
+}
+
+inline Result CDL3WHITESOLDIERS( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3WHITESOLDIERS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDL3WHITESOLDIERS( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDL3WHITESOLDIERS( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDL3WHITESOLDIERS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDL3WHITESOLDIERS( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLABANDONEDBABY - Abandoned Baby */
+inline int CDLABANDONEDBABY_Lookback( double optInPenetration = 3.000000e-1 ) noexcept
+{
+   return TA_CDLABANDONEDBABY_Lookback( optInPenetration );
+}
+
+inline Result CDLABANDONEDBABY( std::span<const double> inOpen,
+                                std::span<const double> inHigh,
+                                std::span<const double> inLow,
+                                std::span<const double> inClose,
+                                std::span<int> outInteger,
+                                double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLABANDONEDBABY_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLABANDONEDBABY( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         optInPenetration,
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result CDLABANDONEDBABY( std::span<const float> inOpen,
+                                std::span<const float> inHigh,
+                                std::span<const float> inLow,
+                                std::span<const float> inClose,
+                                std::span<int> outInteger,
+                                double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLABANDONEDBABY_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLABANDONEDBABY( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           optInPenetration,
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* CDLADVANCEBLOCK - Advance Block */
+inline int CDLADVANCEBLOCK_Lookback() noexcept
+{
+   return TA_CDLADVANCEBLOCK_Lookback();
+}
+
+inline Result CDLADVANCEBLOCK( std::span<const double> inOpen,
+                               std::span<const double> inHigh,
+                               std::span<const double> inLow,
+                               std::span<const double> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLADVANCEBLOCK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLADVANCEBLOCK( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+inline Result CDLADVANCEBLOCK( std::span<const float> inOpen,
+                               std::span<const float> inHigh,
+                               std::span<const float> inLow,
+                               std::span<const float> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLADVANCEBLOCK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLADVANCEBLOCK( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+/* CDLBELTHOLD - Belt-hold */
+inline int CDLBELTHOLD_Lookback() noexcept
+{
+   return TA_CDLBELTHOLD_Lookback();
+}
+
+inline Result CDLBELTHOLD( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLBELTHOLD_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLBELTHOLD( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLBELTHOLD( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLBELTHOLD_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLBELTHOLD( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLBREAKAWAY - Breakaway */
+inline int CDLBREAKAWAY_Lookback() noexcept
+{
+   return TA_CDLBREAKAWAY_Lookback();
+}
+
+inline Result CDLBREAKAWAY( std::span<const double> inOpen,
+                            std::span<const double> inHigh,
+                            std::span<const double> inLow,
+                            std::span<const double> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLBREAKAWAY_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLBREAKAWAY( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result CDLBREAKAWAY( std::span<const float> inOpen,
+                            std::span<const float> inHigh,
+                            std::span<const float> inLow,
+                            std::span<const float> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLBREAKAWAY_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLBREAKAWAY( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* CDLCLOSINGMARUBOZU - Closing Marubozu */
+inline int CDLCLOSINGMARUBOZU_Lookback() noexcept
+{
+   return TA_CDLCLOSINGMARUBOZU_Lookback();
+}
+
+inline Result CDLCLOSINGMARUBOZU( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCLOSINGMARUBOZU_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLCLOSINGMARUBOZU( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLCLOSINGMARUBOZU( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCLOSINGMARUBOZU_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLCLOSINGMARUBOZU( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLCONCEALBABYSWALL - Concealing Baby Swallow */
+inline int CDLCONCEALBABYSWALL_Lookback() noexcept
+{
+   return TA_CDLCONCEALBABYSWALL_Lookback();
+}
+
+inline Result CDLCONCEALBABYSWALL( std::span<const double> inOpen,
+                                   std::span<const double> inHigh,
+                                   std::span<const double> inLow,
+                                   std::span<const double> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCONCEALBABYSWALL_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLCONCEALBABYSWALL( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+inline Result CDLCONCEALBABYSWALL( std::span<const float> inOpen,
+                                   std::span<const float> inHigh,
+                                   std::span<const float> inLow,
+                                   std::span<const float> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCONCEALBABYSWALL_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLCONCEALBABYSWALL( 0, nbBar-1,
+                                              inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                              &result.begIdx, &result.nbElement,
+                                              outInteger.data() );
+   return result;
+}
+
+/* CDLCOUNTERATTACK - Counterattack */
+inline int CDLCOUNTERATTACK_Lookback() noexcept
+{
+   return TA_CDLCOUNTERATTACK_Lookback();
+}
+
+inline Result CDLCOUNTERATTACK( std::span<const double> inOpen,
+                                std::span<const double> inHigh,
+                                std::span<const double> inLow,
+                                std::span<const double> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCOUNTERATTACK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLCOUNTERATTACK( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result CDLCOUNTERATTACK( std::span<const float> inOpen,
+                                std::span<const float> inHigh,
+                                std::span<const float> inLow,
+                                std::span<const float> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLCOUNTERATTACK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLCOUNTERATTACK( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* CDLDARKCLOUDCOVER - Dark Cloud Cover */
+inline int CDLDARKCLOUDCOVER_Lookback( double optInPenetration = 5.000000e-1 ) noexcept
+{
+   return TA_CDLDARKCLOUDCOVER_Lookback( optInPenetration );
+}
+
+inline Result CDLDARKCLOUDCOVER( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger,
+                                 double optInPenetration = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDARKCLOUDCOVER_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLDARKCLOUDCOVER( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          optInPenetration,
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDLDARKCLOUDCOVER( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger,
+                                 double optInPenetration = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDARKCLOUDCOVER_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLDARKCLOUDCOVER( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            optInPenetration,
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLDOJI - Doji */
+inline int CDLDOJI_Lookback() noexcept
+{
+   return TA_CDLDOJI_Lookback();
+}
+
+inline Result CDLDOJI( std::span<const double> inOpen,
+                       std::span<const double> inHigh,
+                       std::span<const double> inLow,
+                       std::span<const double> inClose,
+                       std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLDOJI( 0, nbBar-1,
+                                inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                &result.begIdx, &result.nbElement,
+                                outInteger.data() );
+   return result;
+}
+
+inline Result CDLDOJI( std::span<const float> inOpen,
+                       std::span<const float> inHigh,
+                       std::span<const float> inLow,
+                       std::span<const float> inClose,
+                       std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLDOJI( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+/* CDLDOJISTAR - Doji Star */
+inline int CDLDOJISTAR_Lookback() noexcept
+{
+   return TA_CDLDOJISTAR_Lookback();
+}
+
+inline Result CDLDOJISTAR( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDOJISTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLDOJISTAR( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLDOJISTAR( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDOJISTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLDOJISTAR( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLDRAGONFLYDOJI - Dragonfly Doji */
+inline int CDLDRAGONFLYDOJI_Lookback() noexcept
+{
+   return TA_CDLDRAGONFLYDOJI_Lookback();
+}
+
+inline Result CDLDRAGONFLYDOJI( std::span<const double> inOpen,
+                                std::span<const double> inHigh,
+                                std::span<const double> inLow,
+                                std::span<const double> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDRAGONFLYDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLDRAGONFLYDOJI( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result CDLDRAGONFLYDOJI( std::span<const float> inOpen,
+                                std::span<const float> inHigh,
+                                std::span<const float> inLow,
+                                std::span<const float> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLDRAGONFLYDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLDRAGONFLYDOJI( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* CDLENGULFING - Engulfing Pattern */
+inline int CDLENGULFING_Lookback() noexcept
+{
+   return TA_CDLENGULFING_Lookback();
+}
+
+inline Result CDLENGULFING( std::span<const double> inOpen,
+                            std::span<const double> inHigh,
+                            std::span<const double> inLow,
+                            std::span<const double> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLENGULFING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLENGULFING( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result CDLENGULFING( std::span<const float> inOpen,
+                            std::span<const float> inHigh,
+                            std::span<const float> inLow,
+                            std::span<const float> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLENGULFING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLENGULFING( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* CDLEVENINGDOJISTAR - Evening Doji Star */
+inline int CDLEVENINGDOJISTAR_Lookback( double optInPenetration = 3.000000e-1 ) noexcept
+{
+   return TA_CDLEVENINGDOJISTAR_Lookback( optInPenetration );
+}
+
+inline Result CDLEVENINGDOJISTAR( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger,
+                                  double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLEVENINGDOJISTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLEVENINGDOJISTAR( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           optInPenetration,
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLEVENINGDOJISTAR( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger,
+                                  double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLEVENINGDOJISTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLEVENINGDOJISTAR( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             optInPenetration,
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLEVENINGSTAR - Evening Star */
+inline int CDLEVENINGSTAR_Lookback( double optInPenetration = 3.000000e-1 ) noexcept
+{
+   return TA_CDLEVENINGSTAR_Lookback( optInPenetration );
+}
+
+inline Result CDLEVENINGSTAR( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger,
+                              double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLEVENINGSTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLEVENINGSTAR( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       optInPenetration,
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLEVENINGSTAR( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger,
+                              double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLEVENINGSTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLEVENINGSTAR( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         optInPenetration,
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLGAPSIDESIDEWHITE - Up/Down-gap side-by-side white lines */
+inline int CDLGAPSIDESIDEWHITE_Lookback() noexcept
+{
+   return TA_CDLGAPSIDESIDEWHITE_Lookback();
+}
+
+inline Result CDLGAPSIDESIDEWHITE( std::span<const double> inOpen,
+                                   std::span<const double> inHigh,
+                                   std::span<const double> inLow,
+                                   std::span<const double> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLGAPSIDESIDEWHITE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLGAPSIDESIDEWHITE( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+inline Result CDLGAPSIDESIDEWHITE( std::span<const float> inOpen,
+                                   std::span<const float> inHigh,
+                                   std::span<const float> inLow,
+                                   std::span<const float> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLGAPSIDESIDEWHITE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLGAPSIDESIDEWHITE( 0, nbBar-1,
+                                              inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                              &result.begIdx, &result.nbElement,
+                                              outInteger.data() );
+   return result;
+}
+
+/* CDLGRAVESTONEDOJI - Gravestone Doji */
+inline int CDLGRAVESTONEDOJI_Lookback() noexcept
+{
+   return TA_CDLGRAVESTONEDOJI_Lookback();
+}
+
+inline Result CDLGRAVESTONEDOJI( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLGRAVESTONEDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLGRAVESTONEDOJI( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDLGRAVESTONEDOJI( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLGRAVESTONEDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLGRAVESTONEDOJI( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLHAMMER - Hammer */
+inline int CDLHAMMER_Lookback() noexcept
+{
+   return TA_CDLHAMMER_Lookback();
+}
+
+inline Result CDLHAMMER( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHAMMER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHAMMER( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDLHAMMER( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHAMMER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHAMMER( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDLHANGINGMAN - Hanging Man */
+inline int CDLHANGINGMAN_Lookback() noexcept
+{
+   return TA_CDLHANGINGMAN_Lookback();
+}
+
+inline Result CDLHANGINGMAN( std::span<const double> inOpen,
+                             std::span<const double> inHigh,
+                             std::span<const double> inLow,
+                             std::span<const double> inClose,
+                             std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHANGINGMAN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHANGINGMAN( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+inline Result CDLHANGINGMAN( std::span<const float> inOpen,
+                             std::span<const float> inHigh,
+                             std::span<const float> inLow,
+                             std::span<const float> inClose,
+                             std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHANGINGMAN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHANGINGMAN( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+/* CDLHARAMI - Harami Pattern */
+inline int CDLHARAMI_Lookback() noexcept
+{
+   return TA_CDLHARAMI_Lookback();
+}
+
+inline Result CDLHARAMI( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHARAMI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHARAMI( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDLHARAMI( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHARAMI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHARAMI( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDLHARAMICROSS - Harami Cross Pattern */
+inline int CDLHARAMICROSS_Lookback() noexcept
+{
+   return TA_CDLHARAMICROSS_Lookback();
+}
+
+inline Result CDLHARAMICROSS( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHARAMICROSS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHARAMICROSS( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLHARAMICROSS( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHARAMICROSS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHARAMICROSS( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLHIGHWAVE - High-Wave Candle */
+inline int CDLHIGHWAVE_Lookback() noexcept
+{
+   return TA_CDLHIGHWAVE_Lookback();
+}
+
+inline Result CDLHIGHWAVE( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIGHWAVE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHIGHWAVE( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLHIGHWAVE( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIGHWAVE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHIGHWAVE( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLHIKKAKE - Hikkake Pattern */
+inline int CDLHIKKAKE_Lookback() noexcept
+{
+   return TA_CDLHIKKAKE_Lookback();
+}
+
+inline Result CDLHIKKAKE( std::span<const double> inOpen,
+                          std::span<const double> inHigh,
+                          std::span<const double> inLow,
+                          std::span<const double> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIKKAKE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHIKKAKE( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CDLHIKKAKE( std::span<const float> inOpen,
+                          std::span<const float> inHigh,
+                          std::span<const float> inLow,
+                          std::span<const float> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIKKAKE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHIKKAKE( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* CDLHIKKAKEMOD - Modified Hikkake Pattern */
+inline int CDLHIKKAKEMOD_Lookback() noexcept
+{
+   return TA_CDLHIKKAKEMOD_Lookback();
+}
+
+inline Result CDLHIKKAKEMOD( std::span<const double> inOpen,
+                             std::span<const double> inHigh,
+                             std::span<const double> inLow,
+                             std::span<const double> inClose,
+                             std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIKKAKEMOD_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHIKKAKEMOD( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+inline Result CDLHIKKAKEMOD( std::span<const float> inOpen,
+                             std::span<const float> inHigh,
+                             std::span<const float> inLow,
+                             std::span<const float> inClose,
+                             std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHIKKAKEMOD_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHIKKAKEMOD( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+/* CDLHOMINGPIGEON - Homing Pigeon */
+inline int CDLHOMINGPIGEON_Lookback() noexcept
+{
+   return TA_CDLHOMINGPIGEON_Lookback();
+}
+
+inline Result CDLHOMINGPIGEON( std::span<const double> inOpen,
+                               std::span<const double> inHigh,
+                               std::span<const double> inLow,
+                               std::span<const double> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHOMINGPIGEON_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLHOMINGPIGEON( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+inline Result CDLHOMINGPIGEON( std::span<const float> inOpen,
+                               std::span<const float> inHigh,
+                               std::span<const float> inLow,
+                               std::span<const float> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLHOMINGPIGEON_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLHOMINGPIGEON( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+/* CDLIDENTICAL3CROWS - Identical Three Crows */
+inline int CDLIDENTICAL3CROWS_Lookback() noexcept
+{
+   return TA_CDLIDENTICAL3CROWS_Lookback();
+}
+
+inline Result CDLIDENTICAL3CROWS( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLIDENTICAL3CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLIDENTICAL3CROWS( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLIDENTICAL3CROWS( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLIDENTICAL3CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLIDENTICAL3CROWS( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLINNECK - In-Neck Pattern */
+inline int CDLINNECK_Lookback() noexcept
+{
+   return TA_CDLINNECK_Lookback();
+}
+
+inline Result CDLINNECK( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLINNECK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLINNECK( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDLINNECK( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLINNECK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLINNECK( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDLINVERTEDHAMMER - Inverted Hammer */
+inline int CDLINVERTEDHAMMER_Lookback() noexcept
+{
+   return TA_CDLINVERTEDHAMMER_Lookback();
+}
+
+inline Result CDLINVERTEDHAMMER( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLINVERTEDHAMMER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLINVERTEDHAMMER( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDLINVERTEDHAMMER( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLINVERTEDHAMMER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLINVERTEDHAMMER( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLKICKING - Kicking */
+inline int CDLKICKING_Lookback() noexcept
+{
+   return TA_CDLKICKING_Lookback();
+}
+
+inline Result CDLKICKING( std::span<const double> inOpen,
+                          std::span<const double> inHigh,
+                          std::span<const double> inLow,
+                          std::span<const double> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLKICKING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLKICKING( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CDLKICKING( std::span<const float> inOpen,
+                          std::span<const float> inHigh,
+                          std::span<const float> inLow,
+                          std::span<const float> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLKICKING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLKICKING( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* CDLKICKINGBYLENGTH - Kicking - bull/bear determined by the longer marubozu */
+inline int CDLKICKINGBYLENGTH_Lookback() noexcept
+{
+   return TA_CDLKICKINGBYLENGTH_Lookback();
+}
+
+inline Result CDLKICKINGBYLENGTH( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLKICKINGBYLENGTH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLKICKINGBYLENGTH( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLKICKINGBYLENGTH( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLKICKINGBYLENGTH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLKICKINGBYLENGTH( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLLADDERBOTTOM - Ladder Bottom */
+inline int CDLLADDERBOTTOM_Lookback() noexcept
+{
+   return TA_CDLLADDERBOTTOM_Lookback();
+}
+
+inline Result CDLLADDERBOTTOM( std::span<const double> inOpen,
+                               std::span<const double> inHigh,
+                               std::span<const double> inLow,
+                               std::span<const double> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLADDERBOTTOM_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLLADDERBOTTOM( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+inline Result CDLLADDERBOTTOM( std::span<const float> inOpen,
+                               std::span<const float> inHigh,
+                               std::span<const float> inLow,
+                               std::span<const float> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLADDERBOTTOM_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLLADDERBOTTOM( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+/* CDLLONGLEGGEDDOJI - Long Legged Doji */
+inline int CDLLONGLEGGEDDOJI_Lookback() noexcept
+{
+   return TA_CDLLONGLEGGEDDOJI_Lookback();
+}
+
+inline Result CDLLONGLEGGEDDOJI( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLONGLEGGEDDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLLONGLEGGEDDOJI( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDLLONGLEGGEDDOJI( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLONGLEGGEDDOJI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLLONGLEGGEDDOJI( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLLONGLINE - Long Line Candle */
+inline int CDLLONGLINE_Lookback() noexcept
+{
+   return TA_CDLLONGLINE_Lookback();
+}
+
+inline Result CDLLONGLINE( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLONGLINE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLLONGLINE( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLLONGLINE( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLLONGLINE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLLONGLINE( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLMARUBOZU - Marubozu */
+inline int CDLMARUBOZU_Lookback() noexcept
+{
+   return TA_CDLMARUBOZU_Lookback();
+}
+
+inline Result CDLMARUBOZU( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMARUBOZU_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLMARUBOZU( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLMARUBOZU( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMARUBOZU_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLMARUBOZU( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLMATCHINGLOW - Matching Low */
+inline int CDLMATCHINGLOW_Lookback() noexcept
+{
+   return TA_CDLMATCHINGLOW_Lookback();
+}
+
+inline Result CDLMATCHINGLOW( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMATCHINGLOW_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLMATCHINGLOW( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLMATCHINGLOW( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMATCHINGLOW_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLMATCHINGLOW( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLMATHOLD - Mat Hold */
+inline int CDLMATHOLD_Lookback( double optInPenetration = 5.000000e-1 ) noexcept
+{
+   return TA_CDLMATHOLD_Lookback( optInPenetration );
+}
+
+inline Result CDLMATHOLD( std::span<const double> inOpen,
+                          std::span<const double> inHigh,
+                          std::span<const double> inLow,
+                          std::span<const double> inClose,
+                          std::span<int> outInteger,
+                          double optInPenetration = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMATHOLD_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLMATHOLD( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   optInPenetration,
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CDLMATHOLD( std::span<const float> inOpen,
+                          std::span<const float> inHigh,
+                          std::span<const float> inLow,
+                          std::span<const float> inClose,
+                          std::span<int> outInteger,
+                          double optInPenetration = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMATHOLD_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLMATHOLD( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     optInPenetration,
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* CDLMORNINGDOJISTAR - Morning Doji Star */
+inline int CDLMORNINGDOJISTAR_Lookback( double optInPenetration = 3.000000e-1 ) noexcept
+{
+   return TA_CDLMORNINGDOJISTAR_Lookback( optInPenetration );
+}
+
+inline Result CDLMORNINGDOJISTAR( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger,
+                                  double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMORNINGDOJISTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLMORNINGDOJISTAR( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           optInPenetration,
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLMORNINGDOJISTAR( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger,
+                                  double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMORNINGDOJISTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLMORNINGDOJISTAR( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             optInPenetration,
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLMORNINGSTAR - Morning Star */
+inline int CDLMORNINGSTAR_Lookback( double optInPenetration = 3.000000e-1 ) noexcept
+{
+   return TA_CDLMORNINGSTAR_Lookback( optInPenetration );
+}
+
+inline Result CDLMORNINGSTAR( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger,
+                              double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMORNINGSTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLMORNINGSTAR( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       optInPenetration,
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLMORNINGSTAR( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger,
+                              double optInPenetration = 3.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLMORNINGSTAR_Lookback( optInPenetration ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLMORNINGSTAR( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         optInPenetration,
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLONNECK - On-Neck Pattern */
+inline int CDLONNECK_Lookback() noexcept
+{
+   return TA_CDLONNECK_Lookback();
+}
+
+inline Result CDLONNECK( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLONNECK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLONNECK( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDLONNECK( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLONNECK_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLONNECK( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDLPIERCING - Piercing Pattern */
+inline int CDLPIERCING_Lookback() noexcept
+{
+   return TA_CDLPIERCING_Lookback();
+}
+
+inline Result CDLPIERCING( std::span<const double> inOpen,
+                           std::span<const double> inHigh,
+                           std::span<const double> inLow,
+                           std::span<const double> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLPIERCING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLPIERCING( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+inline Result CDLPIERCING( std::span<const float> inOpen,
+                           std::span<const float> inHigh,
+                           std::span<const float> inLow,
+                           std::span<const float> inClose,
+                           std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLPIERCING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLPIERCING( 0, nbBar-1,
+                                      inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outInteger.data() );
+   return result;
+}
+
+/* CDLRICKSHAWMAN - Rickshaw Man */
+inline int CDLRICKSHAWMAN_Lookback() noexcept
+{
+   return TA_CDLRICKSHAWMAN_Lookback();
+}
+
+inline Result CDLRICKSHAWMAN( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLRICKSHAWMAN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLRICKSHAWMAN( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLRICKSHAWMAN( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLRICKSHAWMAN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLRICKSHAWMAN( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLRISEFALL3METHODS - Rising/Falling Three Methods */
+inline int CDLRISEFALL3METHODS_Lookback() noexcept
+{
+   return TA_CDLRISEFALL3METHODS_Lookback();
+}
+
+inline Result CDLRISEFALL3METHODS( std::span<const double> inOpen,
+                                   std::span<const double> inHigh,
+                                   std::span<const double> inLow,
+                                   std::span<const double> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLRISEFALL3METHODS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLRISEFALL3METHODS( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+inline Result CDLRISEFALL3METHODS( std::span<const float> inOpen,
+                                   std::span<const float> inHigh,
+                                   std::span<const float> inLow,
+                                   std::span<const float> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLRISEFALL3METHODS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLRISEFALL3METHODS( 0, nbBar-1,
+                                              inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                              &result.begIdx, &result.nbElement,
+                                              outInteger.data() );
+   return result;
+}
+
+/* CDLSEPARATINGLINES - Separating Lines */
+inline int CDLSEPARATINGLINES_Lookback() noexcept
+{
+   return TA_CDLSEPARATINGLINES_Lookback();
+}
+
+inline Result CDLSEPARATINGLINES( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSEPARATINGLINES_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSEPARATINGLINES( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLSEPARATINGLINES( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSEPARATINGLINES_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSEPARATINGLINES( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLSHOOTINGSTAR - Shooting Star */
+inline int CDLSHOOTINGSTAR_Lookback() noexcept
+{
+   return TA_CDLSHOOTINGSTAR_Lookback();
+}
+
+inline Result CDLSHOOTINGSTAR( std::span<const double> inOpen,
+                               std::span<const double> inHigh,
+                               std::span<const double> inLow,
+                               std::span<const double> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSHOOTINGSTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSHOOTINGSTAR( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+inline Result CDLSHOOTINGSTAR( std::span<const float> inOpen,
+                               std::span<const float> inHigh,
+                               std::span<const float> inLow,
+                               std::span<const float> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSHOOTINGSTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSHOOTINGSTAR( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+/* CDLSHORTLINE - Short Line Candle */
+inline int CDLSHORTLINE_Lookback() noexcept
+{
+   return TA_CDLSHORTLINE_Lookback();
+}
+
+inline Result CDLSHORTLINE( std::span<const double> inOpen,
+                            std::span<const double> inHigh,
+                            std::span<const double> inLow,
+                            std::span<const double> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSHORTLINE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSHORTLINE( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result CDLSHORTLINE( std::span<const float> inOpen,
+                            std::span<const float> inHigh,
+                            std::span<const float> inLow,
+                            std::span<const float> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSHORTLINE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSHORTLINE( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* CDLSPINNINGTOP - Spinning Top */
+inline int CDLSPINNINGTOP_Lookback() noexcept
+{
+   return TA_CDLSPINNINGTOP_Lookback();
+}
+
+inline Result CDLSPINNINGTOP( std::span<const double> inOpen,
+                              std::span<const double> inHigh,
+                              std::span<const double> inLow,
+                              std::span<const double> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSPINNINGTOP_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSPINNINGTOP( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+inline Result CDLSPINNINGTOP( std::span<const float> inOpen,
+                              std::span<const float> inHigh,
+                              std::span<const float> inLow,
+                              std::span<const float> inClose,
+                              std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSPINNINGTOP_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSPINNINGTOP( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+/* CDLSTALLEDPATTERN - Stalled Pattern */
+inline int CDLSTALLEDPATTERN_Lookback() noexcept
+{
+   return TA_CDLSTALLEDPATTERN_Lookback();
+}
+
+inline Result CDLSTALLEDPATTERN( std::span<const double> inOpen,
+                                 std::span<const double> inHigh,
+                                 std::span<const double> inLow,
+                                 std::span<const double> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSTALLEDPATTERN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSTALLEDPATTERN( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+inline Result CDLSTALLEDPATTERN( std::span<const float> inOpen,
+                                 std::span<const float> inHigh,
+                                 std::span<const float> inLow,
+                                 std::span<const float> inClose,
+                                 std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSTALLEDPATTERN_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSTALLEDPATTERN( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+/* CDLSTICKSANDWICH - Stick Sandwich */
+inline int CDLSTICKSANDWICH_Lookback() noexcept
+{
+   return TA_CDLSTICKSANDWICH_Lookback();
+}
+
+inline Result CDLSTICKSANDWICH( std::span<const double> inOpen,
+                                std::span<const double> inHigh,
+                                std::span<const double> inLow,
+                                std::span<const double> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSTICKSANDWICH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLSTICKSANDWICH( 0, nbBar-1,
+                                         inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result CDLSTICKSANDWICH( std::span<const float> inOpen,
+                                std::span<const float> inHigh,
+                                std::span<const float> inLow,
+                                std::span<const float> inClose,
+                                std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLSTICKSANDWICH_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLSTICKSANDWICH( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* CDLTAKURI - Takuri (Dragonfly Doji with very long lower shadow) */
+inline int CDLTAKURI_Lookback() noexcept
+{
+   return TA_CDLTAKURI_Lookback();
+}
+
+inline Result CDLTAKURI( std::span<const double> inOpen,
+                         std::span<const double> inHigh,
+                         std::span<const double> inLow,
+                         std::span<const double> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTAKURI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLTAKURI( 0, nbBar-1,
+                                  inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CDLTAKURI( std::span<const float> inOpen,
+                         std::span<const float> inHigh,
+                         std::span<const float> inLow,
+                         std::span<const float> inClose,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTAKURI_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLTAKURI( 0, nbBar-1,
+                                    inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CDLTASUKIGAP - Tasuki Gap */
+inline int CDLTASUKIGAP_Lookback() noexcept
+{
+   return TA_CDLTASUKIGAP_Lookback();
+}
+
+inline Result CDLTASUKIGAP( std::span<const double> inOpen,
+                            std::span<const double> inHigh,
+                            std::span<const double> inLow,
+                            std::span<const double> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTASUKIGAP_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLTASUKIGAP( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result CDLTASUKIGAP( std::span<const float> inOpen,
+                            std::span<const float> inHigh,
+                            std::span<const float> inLow,
+                            std::span<const float> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTASUKIGAP_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLTASUKIGAP( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* CDLTHRUSTING - Thrusting Pattern */
+inline int CDLTHRUSTING_Lookback() noexcept
+{
+   return TA_CDLTHRUSTING_Lookback();
+}
+
+inline Result CDLTHRUSTING( std::span<const double> inOpen,
+                            std::span<const double> inHigh,
+                            std::span<const double> inLow,
+                            std::span<const double> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTHRUSTING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLTHRUSTING( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result CDLTHRUSTING( std::span<const float> inOpen,
+                            std::span<const float> inHigh,
+                            std::span<const float> inLow,
+                            std::span<const float> inClose,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTHRUSTING_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLTHRUSTING( 0, nbBar-1,
+                                       inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* CDLTRISTAR - Tristar Pattern */
+inline int CDLTRISTAR_Lookback() noexcept
+{
+   return TA_CDLTRISTAR_Lookback();
+}
+
+inline Result CDLTRISTAR( std::span<const double> inOpen,
+                          std::span<const double> inHigh,
+                          std::span<const double> inLow,
+                          std::span<const double> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTRISTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLTRISTAR( 0, nbBar-1,
+                                   inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CDLTRISTAR( std::span<const float> inOpen,
+                          std::span<const float> inHigh,
+                          std::span<const float> inLow,
+                          std::span<const float> inClose,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLTRISTAR_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLTRISTAR( 0, nbBar-1,
+                                     inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* CDLUNIQUE3RIVER - Unique 3 River */
+inline int CDLUNIQUE3RIVER_Lookback() noexcept
+{
+   return TA_CDLUNIQUE3RIVER_Lookback();
+}
+
+inline Result CDLUNIQUE3RIVER( std::span<const double> inOpen,
+                               std::span<const double> inHigh,
+                               std::span<const double> inLow,
+                               std::span<const double> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLUNIQUE3RIVER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLUNIQUE3RIVER( 0, nbBar-1,
+                                        inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                        &result.begIdx, &result.nbElement,
+                                        outInteger.data() );
+   return result;
+}
+
+inline Result CDLUNIQUE3RIVER( std::span<const float> inOpen,
+                               std::span<const float> inHigh,
+                               std::span<const float> inLow,
+                               std::span<const float> inClose,
+                               std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLUNIQUE3RIVER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLUNIQUE3RIVER( 0, nbBar-1,
+                                          inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                          &result.begIdx, &result.nbElement,
+                                          outInteger.data() );
+   return result;
+}
+
+/* CDLUPSIDEGAP2CROWS - Upside Gap Two Crows */
+inline int CDLUPSIDEGAP2CROWS_Lookback() noexcept
+{
+   return TA_CDLUPSIDEGAP2CROWS_Lookback();
+}
+
+inline Result CDLUPSIDEGAP2CROWS( std::span<const double> inOpen,
+                                  std::span<const double> inHigh,
+                                  std::span<const double> inLow,
+                                  std::span<const double> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLUPSIDEGAP2CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLUPSIDEGAP2CROWS( 0, nbBar-1,
+                                           inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+inline Result CDLUPSIDEGAP2CROWS( std::span<const float> inOpen,
+                                  std::span<const float> inHigh,
+                                  std::span<const float> inLow,
+                                  std::span<const float> inClose,
+                                  std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLUPSIDEGAP2CROWS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLUPSIDEGAP2CROWS( 0, nbBar-1,
+                                             inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                             &result.begIdx, &result.nbElement,
+                                             outInteger.data() );
+   return result;
+}
+
+/* CDLXSIDEGAP3METHODS - Upside/Downside Gap Three Methods */
+inline int CDLXSIDEGAP3METHODS_Lookback() noexcept
+{
+   return TA_CDLXSIDEGAP3METHODS_Lookback();
+}
+
+inline Result CDLXSIDEGAP3METHODS( std::span<const double> inOpen,
+                                   std::span<const double> inHigh,
+                                   std::span<const double> inLow,
+                                   std::span<const double> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLXSIDEGAP3METHODS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CDLXSIDEGAP3METHODS( 0, nbBar-1,
+                                            inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                            &result.begIdx, &result.nbElement,
+                                            outInteger.data() );
+   return result;
+}
+
+inline Result CDLXSIDEGAP3METHODS( std::span<const float> inOpen,
+                                   std::span<const float> inHigh,
+                                   std::span<const float> inLow,
+                                   std::span<const float> inClose,
+                                   std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CDLXSIDEGAP3METHODS_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CDLXSIDEGAP3METHODS( 0, nbBar-1,
+                                              inOpen.data(), inHigh.data(), inLow.data(), inClose.data(),
+                                              &result.begIdx, &result.nbElement,
+                                              outInteger.data() );
+   return result;
+}
+
+/* CEIL - Vector Ceil */
+inline int CEIL_Lookback() noexcept
+{
+   return TA_CEIL_Lookback();
+}
+
+inline Result CEIL( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CEIL_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_CEIL( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result CEIL( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CEIL_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CEIL( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* CMO - Chande Momentum Oscillator */
+inline int CMO_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_CMO_Lookback( optInTimePeriod );
+}
+
+inline Result CMO( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CMO_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_CMO( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result CMO( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CMO_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CMO( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* CORREL - Pearson's Correlation Coefficient (r) */
+inline int CORREL_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_CORREL_Lookback( optInTimePeriod );
+}
+
+inline Result CORREL( std::span<const double> inReal0,
+                      std::span<const double> inReal1,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CORREL_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_CORREL( 0, nbBar-1,
+                               inReal0.data(), inReal1.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result CORREL( std::span<const float> inReal0,
+                      std::span<const float> inReal1,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CORREL_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CORREL( 0, nbBar-1,
+                                 inReal0.data(), inReal1.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* COS - Vector Trigonometric Cos */
+inline int COS_Lookback() noexcept
+{
+   return TA_COS_Lookback();
+}
+
+inline Result COS( std::span<const double> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return COS_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_COS( 0, nbBar-1,
+                            inReal.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result COS( std::span<const float> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return COS_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_COS( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* COSH - Vector Trigonometric Cosh */
+inline int COSH_Lookback() noexcept
+{
+   return TA_COSH_Lookback();
+}
+
+inline Result COSH( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return COSH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_COSH( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result COSH( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return COSH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_COSH( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* CROSSOVER - Series 0 crossing above series 1 */
+inline int CROSSOVER_Lookback() noexcept
+{
+   return TA_CROSSOVER_Lookback();
+}
+
+inline Result CROSSOVER( std::span<const double> inReal0,
+                         std::span<const double> inReal1,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CROSSOVER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CROSSOVER( 0, nbBar-1,
+                                  inReal0.data(), inReal1.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInteger.data() );
+   return result;
+}
+
+inline Result CROSSOVER( std::span<const float> inReal0,
+                         std::span<const float> inReal1,
+                         std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CROSSOVER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CROSSOVER( 0, nbBar-1,
+                                    inReal0.data(), inReal1.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInteger.data() );
+   return result;
+}
+
+/* CROSSUNDER - Series 0 crossing below series 1 */
+inline int CROSSUNDER_Lookback() noexcept
+{
+   return TA_CROSSUNDER_Lookback();
+}
+
+inline Result CROSSUNDER( std::span<const double> inReal0,
+                          std::span<const double> inReal1,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CROSSUNDER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_CROSSUNDER( 0, nbBar-1,
+                                   inReal0.data(), inReal1.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+inline Result CROSSUNDER( std::span<const float> inReal0,
+                          std::span<const float> inReal1,
+                          std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return CROSSUNDER_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_CROSSUNDER( 0, nbBar-1,
+                                     inReal0.data(), inReal1.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+/* DEMA - Double Exponential Moving Average */
+inline int DEMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_DEMA_Lookback( optInTimePeriod );
+}
+
+inline Result DEMA( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DEMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_DEMA( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result DEMA( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DEMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_DEMA( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* DIV - Vector Arithmetic Div */
+inline int DIV_Lookback() noexcept
+{
+   return TA_DIV_Lookback();
+}
+
+inline Result DIV( std::span<const double> inReal0,
+                   std::span<const double> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DIV_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_DIV( 0, nbBar-1,
+                            inReal0.data(), inReal1.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result DIV( std::span<const float> inReal0,
+                   std::span<const float> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DIV_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_DIV( 0, nbBar-1,
+                              inReal0.data(), inReal1.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* DX - Directional Movement Index */
+inline int DX_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_DX_Lookback( optInTimePeriod );
+}
+
+inline Result DX( std::span<const double> inHigh,
+                  std::span<const double> inLow,
+                  std::span<const double> inClose,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_DX( 0, nbBar-1,
+                           inHigh.data(), inLow.data(), inClose.data(),
+                           optInTimePeriod,
+                           &result.begIdx, &result.nbElement,
+                           outReal.data() );
+   return result;
+}
+
+inline Result DX( std::span<const float> inHigh,
+                  std::span<const float> inLow,
+                  std::span<const float> inClose,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return DX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_DX( 0, nbBar-1,
+                             inHigh.data(), inLow.data(), inClose.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+/* EMA - Exponential Moving Average */
+inline int EMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_EMA_Lookback( optInTimePeriod );
+}
+
+inline Result EMA( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return EMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_EMA( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result EMA( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return EMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_EMA( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* EXP - Vector Arithmetic Exp */
+inline int EXP_Lookback() noexcept
+{
+   return TA_EXP_Lookback();
+}
+
+inline Result EXP( std::span<const double> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return EXP_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_EXP( 0, nbBar-1,
+                            inReal.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result EXP( std::span<const float> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return EXP_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_EXP( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* FLOOR - Vector Floor */
+inline int FLOOR_Lookback() noexcept
+{
+   return TA_FLOOR_Lookback();
+}
+
+inline Result FLOOR( std::span<const double> inReal,
+                     std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return FLOOR_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_FLOOR( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+inline Result FLOOR( std::span<const float> inReal,
+                     std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return FLOOR_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_FLOOR( 0, nbBar-1,
+                                inReal.data(),
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+/* HT_DCPERIOD - Hilbert Transform - Dominant Cycle Period */
+inline int HT_DCPERIOD_Lookback() noexcept
+{
+   return TA_HT_DCPERIOD_Lookback();
+}
+
+inline Result HT_DCPERIOD( std::span<const double> inReal,
+                           std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_DCPERIOD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_DCPERIOD( 0, nbBar-1,
+                                    inReal.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outReal.data() );
+   return result;
+}
+
+inline Result HT_DCPERIOD( std::span<const float> inReal,
+                           std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_DCPERIOD_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_DCPERIOD( 0, nbBar-1,
+                                      inReal.data(),
+                                      &result.begIdx, &result.nbElement,
+                                      outReal.data() );
+   return result;
+}
+
+/* HT_DCPHASE - Hilbert Transform - Dominant Cycle Phase */
+inline int HT_DCPHASE_Lookback() noexcept
+{
+   return TA_HT_DCPHASE_Lookback();
+}
+
+inline Result HT_DCPHASE( std::span<const double> inReal,
+                          std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_DCPHASE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_DCPHASE( 0, nbBar-1,
+                                   inReal.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+inline Result HT_DCPHASE( std::span<const float> inReal,
+                          std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_DCPHASE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_DCPHASE( 0, nbBar-1,
+                                     inReal.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outReal.data() );
+   return result;
+}
+
+/* HT_PHASOR - Hilbert Transform - Phasor Components */
+inline int HT_PHASOR_Lookback() noexcept
+{
+   return TA_HT_PHASOR_Lookback();
+}
+
+inline Result HT_PHASOR( std::span<const double> inReal,
+                         std::span<double> outInPhase,
+                         std::span<double> outQuadrature ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_PHASOR_Lookback(); }, outInPhase, outQuadrature ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_PHASOR( 0, nbBar-1,
+                                  inReal.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outInPhase.data(),
+                                  outQuadrature.data() );
+   return result;
+}
+
+inline Result HT_PHASOR( std::span<const float> inReal,
+                         std::span<double> outInPhase,
+                         std::span<double> outQuadrature ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_PHASOR_Lookback(); }, outInPhase, outQuadrature ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_PHASOR( 0, nbBar-1,
+                                    inReal.data(),
+                                    &result.begIdx, &result.nbElement,
+                                    outInPhase.data(),
+                                    outQuadrature.data() );
+   return result;
+}
+
+/* HT_SINE - Hilbert Transform - SineWave */
+inline int HT_SINE_Lookback() noexcept
+{
+   return TA_HT_SINE_Lookback();
+}
+
+inline Result HT_SINE( std::span<const double> inReal,
+                       std::span<double> outSine,
+                       std::span<double> outLeadSine ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_SINE_Lookback(); }, outSine, outLeadSine ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_SINE( 0, nbBar-1,
+                                inReal.data(),
+                                &result.begIdx, &result.nbElement,
+                                outSine.data(),
+                                outLeadSine.data() );
+   return result;
+}
+
+inline Result HT_SINE( std::span<const float> inReal,
+                       std::span<double> outSine,
+                       std::span<double> outLeadSine ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_SINE_Lookback(); }, outSine, outLeadSine ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_SINE( 0, nbBar-1,
+                                  inReal.data(),
+                                  &result.begIdx, &result.nbElement,
+                                  outSine.data(),
+                                  outLeadSine.data() );
+   return result;
+}
+
+/* HT_TRENDLINE - Hilbert Transform - Instantaneous Trendline */
+inline int HT_TRENDLINE_Lookback() noexcept
+{
+   return TA_HT_TRENDLINE_Lookback();
+}
+
+inline Result HT_TRENDLINE( std::span<const double> inReal,
+                            std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_TRENDLINE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_TRENDLINE( 0, nbBar-1,
+                                     inReal.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outReal.data() );
+   return result;
+}
+
+inline Result HT_TRENDLINE( std::span<const float> inReal,
+                            std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_TRENDLINE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_TRENDLINE( 0, nbBar-1,
+                                       inReal.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outReal.data() );
+   return result;
+}
+
+/* HT_TRENDMODE - Hilbert Transform - Trend vs Cycle Mode */
+inline int HT_TRENDMODE_Lookback() noexcept
+{
+   return TA_HT_TRENDMODE_Lookback();
+}
+
+inline Result HT_TRENDMODE( std::span<const double> inReal,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_TRENDMODE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_HT_TRENDMODE( 0, nbBar-1,
+                                     inReal.data(),
+                                     &result.begIdx, &result.nbElement,
+                                     outInteger.data() );
+   return result;
+}
+
+inline Result HT_TRENDMODE( std::span<const float> inReal,
+                            std::span<int> outInteger ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return HT_TRENDMODE_Lookback(); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_HT_TRENDMODE( 0, nbBar-1,
+                                       inReal.data(),
+                                       &result.begIdx, &result.nbElement,
+                                       outInteger.data() );
+   return result;
+}
+
+/* IMI - Intraday Momentum Index */
+inline int IMI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_IMI_Lookback( optInTimePeriod );
+}
+
+inline Result IMI( std::span<const double> inOpen,
+                   std::span<const double> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return IMI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_IMI( 0, nbBar-1,
+                            inOpen.data(), inClose.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result IMI( std::span<const float> inOpen,
+                   std::span<const float> inClose,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inOpen, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return IMI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_IMI( 0, nbBar-1,
+                              inOpen.data(), inClose.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* KAMA - Kaufman Adaptive Moving Average */
+inline int KAMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_KAMA_Lookback( optInTimePeriod );
+}
+
+inline Result KAMA( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return KAMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_KAMA( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result KAMA( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return KAMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_KAMA( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* LINEARREG - Linear Regression */
+inline int LINEARREG_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_LINEARREG_Lookback( optInTimePeriod );
+}
+
+inline Result LINEARREG( std::span<const double> inReal,
+                         std::span<double> outReal,
+                         int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LINEARREG( 0, nbBar-1,
+                                  inReal.data(),
+                                  optInTimePeriod,
+                                  &result.begIdx, &result.nbElement,
+                                  outReal.data() );
+   return result;
+}
+
+inline Result LINEARREG( std::span<const float> inReal,
+                         std::span<double> outReal,
+                         int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LINEARREG( 0, nbBar-1,
+                                    inReal.data(),
+                                    optInTimePeriod,
+                                    &result.begIdx, &result.nbElement,
+                                    outReal.data() );
+   return result;
+}
+
+/* LINEARREG_ANGLE - Linear Regression Angle */
+inline int LINEARREG_ANGLE_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_LINEARREG_ANGLE_Lookback( optInTimePeriod );
+}
+
+inline Result LINEARREG_ANGLE( std::span<const double> inReal,
+                               std::span<double> outReal,
+                               int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_ANGLE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LINEARREG_ANGLE( 0, nbBar-1,
+                                        inReal.data(),
+                                        optInTimePeriod,
+                                        &result.begIdx, &result.nbElement,
+                                        outReal.data() );
+   return result;
+}
+
+inline Result LINEARREG_ANGLE( std::span<const float> inReal,
+                               std::span<double> outReal,
+                               int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_ANGLE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LINEARREG_ANGLE( 0, nbBar-1,
+                                          inReal.data(),
+                                          optInTimePeriod,
+                                          &result.begIdx, &result.nbElement,
+                                          outReal.data() );
+   return result;
+}
+
+/* LINEARREG_INTERCEPT - Linear Regression Intercept */
+inline int LINEARREG_INTERCEPT_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_LINEARREG_INTERCEPT_Lookback( optInTimePeriod );
+}
+
+inline Result LINEARREG_INTERCEPT( std::span<const double> inReal,
+                                   std::span<double> outReal,
+                                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_INTERCEPT_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LINEARREG_INTERCEPT( 0, nbBar-1,
+                                            inReal.data(),
+                                            optInTimePeriod,
+                                            &result.begIdx, &result.nbElement,
+                                            outReal.data() );
+   return result;
+}
+
+inline Result LINEARREG_INTERCEPT( std::span<const float> inReal,
+                                   std::span<double> outReal,
+                                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_INTERCEPT_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LINEARREG_INTERCEPT( 0, nbBar-1,
+                                              inReal.data(),
+                                              optInTimePeriod,
+                                              &result.begIdx, &result.nbElement,
+                                              outReal.data() );
+   return result;
+}
+
+/* LINEARREG_SLOPE - Linear Regression Slope */
+inline int LINEARREG_SLOPE_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_LINEARREG_SLOPE_Lookback( optInTimePeriod );
+}
+
+inline Result LINEARREG_SLOPE( std::span<const double> inReal,
+                               std::span<double> outReal,
+                               int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_SLOPE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LINEARREG_SLOPE( 0, nbBar-1,
+                                        inReal.data(),
+                                        optInTimePeriod,
+                                        &result.begIdx, &result.nbElement,
+                                        outReal.data() );
+   return result;
+}
+
+inline Result LINEARREG_SLOPE( std::span<const float> inReal,
+                               std::span<double> outReal,
+                               int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LINEARREG_SLOPE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LINEARREG_SLOPE( 0, nbBar-1,
+                                          inReal.data(),
+                                          optInTimePeriod,
+                                          &result.begIdx, &result.nbElement,
+                                          outReal.data() );
+   return result;
+}
+
+/* LN - Vector Log Natural */
+inline int LN_Lookback() noexcept
+{
+   return TA_LN_Lookback();
+}
+
+inline Result LN( std::span<const double> inReal,
+                  std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LN( 0, nbBar-1,
+                           inReal.data(),
+                           &result.begIdx, &result.nbElement,
+                           outReal.data() );
+   return result;
+}
+
+inline Result LN( std::span<const float> inReal,
+                  std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LN( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+/* LOG10 - Vector Log10 */
+inline int LOG10_Lookback() noexcept
+{
+   return TA_LOG10_Lookback();
+}
+
+inline Result LOG10( std::span<const double> inReal,
+                     std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LOG10_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_LOG10( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+inline Result LOG10( std::span<const float> inReal,
+                     std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return LOG10_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_LOG10( 0, nbBar-1,
+                                inReal.data(),
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+/* MA - Moving average */
+inline int MA_Lookback( int optInTimePeriod = 30,
+                        TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_MA_Lookback( optInTimePeriod, optInMAType );
+}
+
+inline Result MA( std::span<const double> inReal,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 30,
+                  TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MA_Lookback( optInTimePeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MA( 0, nbBar-1,
+                           inReal.data(),
+                           optInTimePeriod, optInMAType,
+                           &result.begIdx, &result.nbElement,
+                           outReal.data() );
+   return result;
+}
+
+inline Result MA( std::span<const float> inReal,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 30,
+                  TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MA_Lookback( optInTimePeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MA( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod, optInMAType,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+/* MACD - Moving Average Convergence/Divergence */
+inline int MACD_Lookback( int optInFastPeriod = 12,
+                          int optInSlowPeriod = 26,
+                          int optInSignalPeriod = 9 ) noexcept
+{
+   return TA_MACD_Lookback( optInFastPeriod, optInSlowPeriod, optInSignalPeriod );
+}
+
+inline Result MACD( std::span<const double> inReal,
+                    std::span<double> outMACD,
+                    std::span<double> outMACDSignal,
+                    std::span<double> outMACDHist,
+                    int optInFastPeriod = 12,
+                    int optInSlowPeriod = 26,
+                    int optInSignalPeriod = 9 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACD_Lookback( optInFastPeriod, optInSlowPeriod, optInSignalPeriod ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_MACD( 0, nbBar-1,
+                             inReal.data(),
+                             optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+                             &result.begIdx, &result.nbElement,
+                             outMACD.data(),
+                             outMACDSignal.data(),
+                             outMACDHist.data() );
+   return result;
+}
+
+inline Result MACD( std::span<const float> inReal,
+                    std::span<double> outMACD,
+                    std::span<double> outMACDSignal,
+                    std::span<double> outMACDHist,
+                    int optInFastPeriod = 12,
+                    int optInSlowPeriod = 26,
+                    int optInSignalPeriod = 9 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACD_Lookback( optInFastPeriod, optInSlowPeriod, optInSignalPeriod ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MACD( 0, nbBar-1,
+                               inReal.data(),
+                               optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+                               &result.begIdx, &result.nbElement,
+                               outMACD.data(),
+                               outMACDSignal.data(),
+                               outMACDHist.data() );
+   return result;
+}
+
+/* MACDEXT - MACD with controllable MA type */
+inline int MACDEXT_Lookback( int optInFastPeriod = 12,
+                             TA_MAType optInFastMAType = TA_MAType_SMA,
+                             int optInSlowPeriod = 26,
+                             TA_MAType optInSlowMAType = TA_MAType_SMA,
+                             int optInSignalPeriod = 9,
+                             TA_MAType optInSignalMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_MACDEXT_Lookback( optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType );
+}
+
+inline Result MACDEXT( std::span<const double> inReal,
+                       std::span<double> outMACD,
+                       std::span<double> outMACDSignal,
+                       std::span<double> outMACDHist,
+                       int optInFastPeriod = 12,
+                       TA_MAType optInFastMAType = TA_MAType_SMA,
+                       int optInSlowPeriod = 26,
+                       TA_MAType optInSlowMAType = TA_MAType_SMA,
+                       int optInSignalPeriod = 9,
+                       TA_MAType optInSignalMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACDEXT_Lookback( optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_MACDEXT( 0, nbBar-1,
+                                inReal.data(),
+                                optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+                                &result.begIdx, &result.nbElement,
+                                outMACD.data(),
+                                outMACDSignal.data(),
+                                outMACDHist.data() );
+   return result;
+}
+
+inline Result MACDEXT( std::span<const float> inReal,
+                       std::span<double> outMACD,
+                       std::span<double> outMACDSignal,
+                       std::span<double> outMACDHist,
+                       int optInFastPeriod = 12,
+                       TA_MAType optInFastMAType = TA_MAType_SMA,
+                       int optInSlowPeriod = 26,
+                       TA_MAType optInSlowMAType = TA_MAType_SMA,
+                       int optInSignalPeriod = 9,
+                       TA_MAType optInSignalMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACDEXT_Lookback( optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MACDEXT( 0, nbBar-1,
+                                  inReal.data(),
+                                  optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+                                  &result.begIdx, &result.nbElement,
+                                  outMACD.data(),
+                                  outMACDSignal.data(),
+                                  outMACDHist.data() );
+   return result;
+}
+
+/* MACDFIX - Moving Average Convergence/Divergence Fix 12/26 */
+inline int MACDFIX_Lookback( int optInSignalPeriod = 9 ) noexcept
+{
+   return TA_MACDFIX_Lookback( optInSignalPeriod );
+}
+
+inline Result MACDFIX( std::span<const double> inReal,
+                       std::span<double> outMACD,
+                       std::span<double> outMACDSignal,
+                       std::span<double> outMACDHist,
+                       int optInSignalPeriod = 9 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACDFIX_Lookback( optInSignalPeriod ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_MACDFIX( 0, nbBar-1,
+                                inReal.data(),
+                                optInSignalPeriod,
+                                &result.begIdx, &result.nbElement,
+                                outMACD.data(),
+                                outMACDSignal.data(),
+                                outMACDHist.data() );
+   return result;
+}
+
+inline Result MACDFIX( std::span<const float> inReal,
+                       std::span<double> outMACD,
+                       std::span<double> outMACDSignal,
+                       std::span<double> outMACDHist,
+                       int optInSignalPeriod = 9 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MACDFIX_Lookback( optInSignalPeriod ); }, outMACD, outMACDSignal, outMACDHist ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MACDFIX( 0, nbBar-1,
+                                  inReal.data(),
+                                  optInSignalPeriod,
+                                  &result.begIdx, &result.nbElement,
+                                  outMACD.data(),
+                                  outMACDSignal.data(),
+                                  outMACDHist.data() );
+   return result;
+}
+
+/* MAD - Median Absolute Deviation */
+inline int MAD_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MAD_Lookback( optInTimePeriod );
+}
+
+inline Result MAD( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAD_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MAD( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result MAD( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAD_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MAD( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* MAMA - MESA Adaptive Moving Average */
+inline int MAMA_Lookback( double optInFastLimit = 5.000000e-1,
+                          double optInSlowLimit = 5.000000e-2 ) noexcept
+{
+   return TA_MAMA_Lookback( optInFastLimit, optInSlowLimit );
+}
+
+inline Result MAMA( std::span<const double> inReal,
+                    std::span<double> outMAMA,
+                    std::span<double> outFAMA,
+                    double optInFastLimit = 5.000000e-1,
+                    double optInSlowLimit = 5.000000e-2 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAMA_Lookback( optInFastLimit, optInSlowLimit ); }, outMAMA, outFAMA ) )
+      return detail::badParam();
+
+   result.retCode = TA_MAMA( 0, nbBar-1,
+                             inReal.data(),
+                             optInFastLimit, optInSlowLimit,
+                             &result.begIdx, &result.nbElement,
+                             outMAMA.data(),
+                             outFAMA.data() );
+   return result;
+}
+
+inline Result MAMA( std::span<const float> inReal,
+                    std::span<double> outMAMA,
+                    std::span<double> outFAMA,
+                    double optInFastLimit = 5.000000e-1,
+                    double optInSlowLimit = 5.000000e-2 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAMA_Lookback( optInFastLimit, optInSlowLimit ); }, outMAMA, outFAMA ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MAMA( 0, nbBar-1,
+                               inReal.data(),
+                               optInFastLimit, optInSlowLimit,
+                               &result.begIdx, &result.nbElement,
+                               outMAMA.data(),
+                               outFAMA.data() );
+   return result;
+}
+
+/* MAVP - Moving average with variable period */
+inline int MAVP_Lookback( int optInMinPeriod = 2,
+                          int optInMaxPeriod = 30,
+                          TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_MAVP_Lookback( optInMinPeriod, optInMaxPeriod, optInMAType );
+}
+
+inline Result MAVP( std::span<const double> inReal,
+                    std::span<const double> inPeriods,
+                    std::span<double> outReal,
+                    int optInMinPeriod = 2,
+                    int optInMaxPeriod = 30,
+                    TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal, inPeriods );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAVP_Lookback( optInMinPeriod, optInMaxPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MAVP( 0, nbBar-1,
+                             inReal.data(), inPeriods.data(),
+                             optInMinPeriod, optInMaxPeriod, optInMAType,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result MAVP( std::span<const float> inReal,
+                    std::span<const float> inPeriods,
+                    std::span<double> outReal,
+                    int optInMinPeriod = 2,
+                    int optInMaxPeriod = 30,
+                    TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal, inPeriods );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAVP_Lookback( optInMinPeriod, optInMaxPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MAVP( 0, nbBar-1,
+                               inReal.data(), inPeriods.data(),
+                               optInMinPeriod, optInMaxPeriod, optInMAType,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* MAX - Highest value over a specified period */
+inline int MAX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MAX_Lookback( optInTimePeriod );
+}
+
+inline Result MAX( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MAX( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result MAX( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MAX( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* MAXINDEX - Index of highest value over a specified period */
+inline int MAXINDEX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MAXINDEX_Lookback( optInTimePeriod );
+}
+
+inline Result MAXINDEX( std::span<const double> inReal,
+                        std::span<int> outInteger,
+                        int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAXINDEX_Lookback( optInTimePeriod ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_MAXINDEX( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outInteger.data() );
+   return result;
+}
+
+inline Result MAXINDEX( std::span<const float> inReal,
+                        std::span<int> outInteger,
+                        int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MAXINDEX_Lookback( optInTimePeriod ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MAXINDEX( 0, nbBar-1,
+                                   inReal.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+/* MEDIAN - Median over period */
+inline int MEDIAN_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MEDIAN_Lookback( optInTimePeriod );
+}
+
+inline Result MEDIAN( std::span<const double> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MEDIAN_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MEDIAN( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result MEDIAN( std::span<const float> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MEDIAN_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MEDIAN( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* MEDPRICE - Median Price */
+inline int MEDPRICE_Lookback() noexcept
+{
+   return TA_MEDPRICE_Lookback();
+}
+
+inline Result MEDPRICE( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MEDPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MEDPRICE( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(),
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result MEDPRICE( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MEDPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MEDPRICE( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* MFI - Money Flow Index */
+inline int MFI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MFI_Lookback( optInTimePeriod );
+}
+
+inline Result MFI( std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<const double> inClose,
+                   std::span<const double> inVolume,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MFI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MFI( 0, nbBar-1,
+                            inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result MFI( std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<const float> inClose,
+                   std::span<const float> inVolume,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MFI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MFI( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(), inVolume.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* MIDPOINT - MidPoint over period */
+inline int MIDPOINT_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MIDPOINT_Lookback( optInTimePeriod );
+}
+
+inline Result MIDPOINT( std::span<const double> inReal,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIDPOINT_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MIDPOINT( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result MIDPOINT( std::span<const float> inReal,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIDPOINT_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MIDPOINT( 0, nbBar-1,
+                                   inReal.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* MIDPRICE - Midpoint Price over period */
+inline int MIDPRICE_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MIDPRICE_Lookback( optInTimePeriod );
+}
+
+inline Result MIDPRICE( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIDPRICE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MIDPRICE( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result MIDPRICE( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIDPRICE_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MIDPRICE( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* MIN - Lowest value over a specified period */
+inline int MIN_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MIN_Lookback( optInTimePeriod );
+}
+
+inline Result MIN( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIN_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MIN( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result MIN( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MIN_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MIN( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* MININDEX - Index of lowest value over a specified period */
+inline int MININDEX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MININDEX_Lookback( optInTimePeriod );
+}
+
+inline Result MININDEX( std::span<const double> inReal,
+                        std::span<int> outInteger,
+                        int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MININDEX_Lookback( optInTimePeriod ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_MININDEX( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outInteger.data() );
+   return result;
+}
+
+inline Result MININDEX( std::span<const float> inReal,
+                        std::span<int> outInteger,
+                        int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MININDEX_Lookback( optInTimePeriod ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MININDEX( 0, nbBar-1,
+                                   inReal.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outInteger.data() );
+   return result;
+}
+
+/* MINMAX - Lowest and highest values over a specified period */
+inline int MINMAX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MINMAX_Lookback( optInTimePeriod );
+}
+
+inline Result MINMAX( std::span<const double> inReal,
+                      std::span<double> outMin,
+                      std::span<double> outMax,
+                      int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINMAX_Lookback( optInTimePeriod ); }, outMin, outMax ) )
+      return detail::badParam();
+
+   result.retCode = TA_MINMAX( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outMin.data(),
+                               outMax.data() );
+   return result;
+}
+
+inline Result MINMAX( std::span<const float> inReal,
+                      std::span<double> outMin,
+                      std::span<double> outMax,
+                      int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINMAX_Lookback( optInTimePeriod ); }, outMin, outMax ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MINMAX( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outMin.data(),
+                                 outMax.data() );
+   return result;
+}
+
+/* MINMAXINDEX - Indexes of lowest and highest values over a specified period */
+inline int MINMAXINDEX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_MINMAXINDEX_Lookback( optInTimePeriod );
+}
+
+inline Result MINMAXINDEX( std::span<const double> inReal,
+                           std::span<int> outMinIdx,
+                           std::span<int> outMaxIdx,
+                           int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINMAXINDEX_Lookback( optInTimePeriod ); }, outMinIdx, outMaxIdx ) )
+      return detail::badParam();
+
+   result.retCode = TA_MINMAXINDEX( 0, nbBar-1,
+                                    inReal.data(),
+                                    optInTimePeriod,
+                                    &result.begIdx, &result.nbElement,
+                                    outMinIdx.data(),
+                                    outMaxIdx.data() );
+   return result;
+}
+
+inline Result MINMAXINDEX( std::span<const float> inReal,
+                           std::span<int> outMinIdx,
+                           std::span<int> outMaxIdx,
+                           int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINMAXINDEX_Lookback( optInTimePeriod ); }, outMinIdx, outMaxIdx ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MINMAXINDEX( 0, nbBar-1,
+                                      inReal.data(),
+                                      optInTimePeriod,
+                                      &result.begIdx, &result.nbElement,
+                                      outMinIdx.data(),
+                                      outMaxIdx.data() );
+   return result;
+}
+
+/* MINUS_DI - Minus Directional Indicator */
+inline int MINUS_DI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MINUS_DI_Lookback( optInTimePeriod );
+}
+
+inline Result MINUS_DI( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<const double> inClose,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINUS_DI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MINUS_DI( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result MINUS_DI( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<const float> inClose,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINUS_DI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MINUS_DI( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(), inClose.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* MINUS_DM - Minus Directional Movement */
+inline int MINUS_DM_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_MINUS_DM_Lookback( optInTimePeriod );
+}
+
+inline Result MINUS_DM( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINUS_DM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MINUS_DM( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(),
+                                 optInTimePeriod,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result MINUS_DM( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MINUS_DM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MINUS_DM( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(),
+                                   optInTimePeriod,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* MOM - Momentum */
+inline int MOM_Lookback( int optInTimePeriod = 10 ) noexcept
+{
+   return TA_MOM_Lookback( optInTimePeriod );
+}
+
+inline Result MOM( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MOM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MOM( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result MOM( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MOM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MOM( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* MULT - Vector Arithmetic Mult */
+inline int MULT_Lookback() noexcept
+{
+   return TA_MULT_Lookback();
+}
+
+inline Result MULT( std::span<const double> inReal0,
+                    std::span<const double> inReal1,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MULT_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_MULT( 0, nbBar-1,
+                             inReal0.data(), inReal1.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result MULT( std::span<const float> inReal0,
+                    std::span<const float> inReal1,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return MULT_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_MULT( 0, nbBar-1,
+                               inReal0.data(), inReal1.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* NATR - Normalized Average True Range */
+inline int NATR_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_NATR_Lookback( optInTimePeriod );
+}
+
+inline Result NATR( std::span<const double> inHigh,
+                    std::span<const double> inLow,
+                    std::span<const double> inClose,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return NATR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_NATR( 0, nbBar-1,
+                             inHigh.data(), inLow.data(), inClose.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result NATR( std::span<const float> inHigh,
+                    std::span<const float> inLow,
+                    std::span<const float> inClose,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return NATR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_NATR( 0, nbBar-1,
+                               inHigh.data(), inLow.data(), inClose.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* OBV - On Balance Volume */
+inline int OBV_Lookback() noexcept
+{
+   return TA_OBV_Lookback();
+}
+
+inline Result OBV( std::span<const double> inReal,
+                   std::span<const double> inVolume,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return OBV_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_OBV( 0, nbBar-1,
+                            inReal.data(), inVolume.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result OBV( std::span<const float> inReal,
+                   std::span<const float> inVolume,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal, inVolume );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return OBV_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_OBV( 0, nbBar-1,
+                              inReal.data(), inVolume.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* PLUS_DI - Plus Directional Indicator */
+inline int PLUS_DI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_PLUS_DI_Lookback( optInTimePeriod );
+}
+
+inline Result PLUS_DI( std::span<const double> inHigh,
+                       std::span<const double> inLow,
+                       std::span<const double> inClose,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PLUS_DI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_PLUS_DI( 0, nbBar-1,
+                                inHigh.data(), inLow.data(), inClose.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+inline Result PLUS_DI( std::span<const float> inHigh,
+                       std::span<const float> inLow,
+                       std::span<const float> inClose,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PLUS_DI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_PLUS_DI( 0, nbBar-1,
+                                  inHigh.data(), inLow.data(), inClose.data(),
+                                  optInTimePeriod,
+                                  &result.begIdx, &result.nbElement,
+                                  outReal.data() );
+   return result;
+}
+
+/* PLUS_DM - Plus Directional Movement */
+inline int PLUS_DM_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_PLUS_DM_Lookback( optInTimePeriod );
+}
+
+inline Result PLUS_DM( std::span<const double> inHigh,
+                       std::span<const double> inLow,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PLUS_DM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_PLUS_DM( 0, nbBar-1,
+                                inHigh.data(), inLow.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+inline Result PLUS_DM( std::span<const float> inHigh,
+                       std::span<const float> inLow,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PLUS_DM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_PLUS_DM( 0, nbBar-1,
+                                  inHigh.data(), inLow.data(),
+                                  optInTimePeriod,
+                                  &result.begIdx, &result.nbElement,
+                                  outReal.data() );
+   return result;
+}
+
+/* PPO - Percentage Price Oscillator */
+inline int PPO_Lookback( int optInFastPeriod = 12,
+                         int optInSlowPeriod = 26,
+                         TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   return TA_PPO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType );
+}
+
+inline Result PPO( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInFastPeriod = 12,
+                   int optInSlowPeriod = 26,
+                   TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PPO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_PPO( 0, nbBar-1,
+                            inReal.data(),
+                            optInFastPeriod, optInSlowPeriod, optInMAType,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result PPO( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInFastPeriod = 12,
+                   int optInSlowPeriod = 26,
+                   TA_MAType optInMAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return PPO_Lookback( optInFastPeriod, optInSlowPeriod, optInMAType ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_PPO( 0, nbBar-1,
+                              inReal.data(),
+                              optInFastPeriod, optInSlowPeriod, optInMAType,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* QUANTILE - Quantile over period */
+inline int QUANTILE_Lookback( int optInTimePeriod = 14,
+                              double optInQuantile = 5.000000e-1 ) noexcept
+{
+   return TA_QUANTILE_Lookback( optInTimePeriod, optInQuantile );
+}
+
+inline Result QUANTILE( std::span<const double> inReal,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14,
+                        double optInQuantile = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return QUANTILE_Lookback( optInTimePeriod, optInQuantile ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_QUANTILE( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod, optInQuantile,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result QUANTILE( std::span<const float> inReal,
+                        std::span<double> outReal,
+                        int optInTimePeriod = 14,
+                        double optInQuantile = 5.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return QUANTILE_Lookback( optInTimePeriod, optInQuantile ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_QUANTILE( 0, nbBar-1,
+                                   inReal.data(),
+                                   optInTimePeriod, optInQuantile,
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* ROC - Rate of change : ((price/prevPrice)-1)*100 */
+inline int ROC_Lookback( int optInTimePeriod = 10 ) noexcept
+{
+   return TA_ROC_Lookback( optInTimePeriod );
+}
+
+inline Result ROC( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROC_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ROC( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result ROC( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROC_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ROC( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* ROCP - Rate of change Percentage: (price-prevPrice)/prevPrice */
+inline int ROCP_Lookback( int optInTimePeriod = 10 ) noexcept
+{
+   return TA_ROCP_Lookback( optInTimePeriod );
+}
+
+inline Result ROCP( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCP_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ROCP( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ROCP( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCP_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ROCP( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* ROCR - Rate of change ratio: (price/prevPrice) */
+inline int ROCR_Lookback( int optInTimePeriod = 10 ) noexcept
+{
+   return TA_ROCR_Lookback( optInTimePeriod );
+}
+
+inline Result ROCR( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ROCR( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result ROCR( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ROCR( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* ROCR100 - Rate of change ratio 100 scale: (price/prevPrice)*100 */
+inline int ROCR100_Lookback( int optInTimePeriod = 10 ) noexcept
+{
+   return TA_ROCR100_Lookback( optInTimePeriod );
+}
+
+inline Result ROCR100( std::span<const double> inReal,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCR100_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ROCR100( 0, nbBar-1,
+                                inReal.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+inline Result ROCR100( std::span<const float> inReal,
+                       std::span<double> outReal,
+                       int optInTimePeriod = 10 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ROCR100_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ROCR100( 0, nbBar-1,
+                                  inReal.data(),
+                                  optInTimePeriod,
+                                  &result.begIdx, &result.nbElement,
+                                  outReal.data() );
+   return result;
+}
+
+/* RSI - Relative Strength Index */
+inline int RSI_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_RSI_Lookback( optInTimePeriod );
+}
+
+inline Result RSI( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return RSI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_RSI( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result RSI( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return RSI_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_RSI( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* SAR - Parabolic SAR */
+inline int SAR_Lookback( double optInAcceleration = 2.000000e-2,
+                         double optInMaximum = 2.000000e-1 ) noexcept
+{
+   return TA_SAR_Lookback( optInAcceleration, optInMaximum );
+}
+
+inline Result SAR( std::span<const double> inHigh,
+                   std::span<const double> inLow,
+                   std::span<double> outReal,
+                   double optInAcceleration = 2.000000e-2,
+                   double optInMaximum = 2.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SAR_Lookback( optInAcceleration, optInMaximum ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SAR( 0, nbBar-1,
+                            inHigh.data(), inLow.data(),
+                            optInAcceleration, optInMaximum,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result SAR( std::span<const float> inHigh,
+                   std::span<const float> inLow,
+                   std::span<double> outReal,
+                   double optInAcceleration = 2.000000e-2,
+                   double optInMaximum = 2.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SAR_Lookback( optInAcceleration, optInMaximum ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SAR( 0, nbBar-1,
+                              inHigh.data(), inLow.data(),
+                              optInAcceleration, optInMaximum,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* SAREXT - Parabolic SAR - Extended */
+inline int SAREXT_Lookback( double optInStartValue = 0.000000e+0,
+                            double optInOffsetOnReverse = 0.000000e+0,
+                            double optInAccelerationInitLong = 2.000000e-2,
+                            double optInAccelerationLong = 2.000000e-2,
+                            double optInAccelerationMaxLong = 2.000000e-1,
+                            double optInAccelerationInitShort = 2.000000e-2,
+                            double optInAccelerationShort = 2.000000e-2,
+                            double optInAccelerationMaxShort = 2.000000e-1 ) noexcept
+{
+   return TA_SAREXT_Lookback( optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort );
+}
+
+inline Result SAREXT( std::span<const double> inHigh,
+                      std::span<const double> inLow,
+                      std::span<double> outReal,
+                      double optInStartValue = 0.000000e+0,
+                      double optInOffsetOnReverse = 0.000000e+0,
+                      double optInAccelerationInitLong = 2.000000e-2,
+                      double optInAccelerationLong = 2.000000e-2,
+                      double optInAccelerationMaxLong = 2.000000e-1,
+                      double optInAccelerationInitShort = 2.000000e-2,
+                      double optInAccelerationShort = 2.000000e-2,
+                      double optInAccelerationMaxShort = 2.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SAREXT_Lookback( optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SAREXT( 0, nbBar-1,
+                               inHigh.data(), inLow.data(),
+                               optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result SAREXT( std::span<const float> inHigh,
+                      std::span<const float> inLow,
+                      std::span<double> outReal,
+                      double optInStartValue = 0.000000e+0,
+                      double optInOffsetOnReverse = 0.000000e+0,
+                      double optInAccelerationInitLong = 2.000000e-2,
+                      double optInAccelerationLong = 2.000000e-2,
+                      double optInAccelerationMaxLong = 2.000000e-1,
+                      double optInAccelerationInitShort = 2.000000e-2,
+                      double optInAccelerationShort = 2.000000e-2,
+                      double optInAccelerationMaxShort = 2.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SAREXT_Lookback( optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SAREXT( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(),
+                                 optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* SIN - Vector Trigonometric Sin */
+inline int SIN_Lookback() noexcept
+{
+   return TA_SIN_Lookback();
+}
+
+inline Result SIN( std::span<const double> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SIN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SIN( 0, nbBar-1,
+                            inReal.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result SIN( std::span<const float> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SIN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SIN( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* SINH - Vector Trigonometric Sinh */
+inline int SINH_Lookback() noexcept
+{
+   return TA_SINH_Lookback();
+}
+
+inline Result SINH( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SINH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SINH( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result SINH( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SINH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SINH( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* SMA - Simple Moving Average */
+inline int SMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_SMA_Lookback( optInTimePeriod );
+}
+
+inline Result SMA( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SMA( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result SMA( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SMA( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* SQRT - Vector Square Root */
+inline int SQRT_Lookback() noexcept
+{
+   return TA_SQRT_Lookback();
+}
+
+inline Result SQRT( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SQRT_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SQRT( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result SQRT( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SQRT_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SQRT( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* STDDEV - Standard Deviation */
+inline int STDDEV_Lookback( int optInTimePeriod = 5,
+                            double optInNbDev = 1.000000e+0 ) noexcept
+{
+   return TA_STDDEV_Lookback( optInTimePeriod, optInNbDev );
+}
+
+inline Result STDDEV( std::span<const double> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 5,
+                      double optInNbDev = 1.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STDDEV_Lookback( optInTimePeriod, optInNbDev ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_STDDEV( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod, optInNbDev,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result STDDEV( std::span<const float> inReal,
+                      std::span<double> outReal,
+                      int optInTimePeriod = 5,
+                      double optInNbDev = 1.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STDDEV_Lookback( optInTimePeriod, optInNbDev ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_STDDEV( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod, optInNbDev,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* STOCH - Stochastic */
+inline int STOCH_Lookback( int optInFastK_Period = 5,
+                           int optInSlowK_Period = 3,
+                           TA_MAType optInSlowK_MAType = TA_MAType_SMA,
+                           int optInSlowD_Period = 3,
+                           TA_MAType optInSlowD_MAType = TA_MAType_SMA ) noexcept
+{
+   return TA_STOCH_Lookback( optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType );
+}
+
+inline Result STOCH( std::span<const double> inHigh,
+                     std::span<const double> inLow,
+                     std::span<const double> inClose,
+                     std::span<double> outSlowK,
+                     std::span<double> outSlowD,
+                     int optInFastK_Period = 5,
+                     int optInSlowK_Period = 3,
+                     TA_MAType optInSlowK_MAType = TA_MAType_SMA,
+                     int optInSlowD_Period = 3,
+                     TA_MAType optInSlowD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCH_Lookback( optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType ); }, outSlowK, outSlowD ) )
+      return detail::badParam();
+
+   result.retCode = TA_STOCH( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(),
+                              optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+                              &result.begIdx, &result.nbElement,
+                              outSlowK.data(),
+                              outSlowD.data() );
+   return result;
+}
+
+inline Result STOCH( std::span<const float> inHigh,
+                     std::span<const float> inLow,
+                     std::span<const float> inClose,
+                     std::span<double> outSlowK,
+                     std::span<double> outSlowD,
+                     int optInFastK_Period = 5,
+                     int optInSlowK_Period = 3,
+                     TA_MAType optInSlowK_MAType = TA_MAType_SMA,
+                     int optInSlowD_Period = 3,
+                     TA_MAType optInSlowD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCH_Lookback( optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType ); }, outSlowK, outSlowD ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_STOCH( 0, nbBar-1,
+                                inHigh.data(), inLow.data(), inClose.data(),
+                                optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+                                &result.begIdx, &result.nbElement,
+                                outSlowK.data(),
+                                outSlowD.data() );
+   return result;
+}
+
+/* STOCHF - Stochastic Fast */
+inline int STOCHF_Lookback( int optInFastK_Period = 5,
+                            int optInFastD_Period = 3,
+                            TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   return TA_STOCHF_Lookback( optInFastK_Period, optInFastD_Period, optInFastD_MAType );
+}
+
+inline Result STOCHF( std::span<const double> inHigh,
+                      std::span<const double> inLow,
+                      std::span<const double> inClose,
+                      std::span<double> outFastK,
+                      std::span<double> outFastD,
+                      int optInFastK_Period = 5,
+                      int optInFastD_Period = 3,
+                      TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCHF_Lookback( optInFastK_Period, optInFastD_Period, optInFastD_MAType ); }, outFastK, outFastD ) )
+      return detail::badParam();
+
+   result.retCode = TA_STOCHF( 0, nbBar-1,
+                               inHigh.data(), inLow.data(), inClose.data(),
+                               optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                               &result.begIdx, &result.nbElement,
+                               outFastK.data(),
+                               outFastD.data() );
+   return result;
+}
+
+inline Result STOCHF( std::span<const float> inHigh,
+                      std::span<const float> inLow,
+                      std::span<const float> inClose,
+                      std::span<double> outFastK,
+                      std::span<double> outFastD,
+                      int optInFastK_Period = 5,
+                      int optInFastD_Period = 3,
+                      TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCHF_Lookback( optInFastK_Period, optInFastD_Period, optInFastD_MAType ); }, outFastK, outFastD ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_STOCHF( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                                 &result.begIdx, &result.nbElement,
+                                 outFastK.data(),
+                                 outFastD.data() );
+   return result;
+}
+
+/* STOCHRSI - Stochastic Relative Strength Index */
+inline int STOCHRSI_Lookback( int optInTimePeriod = 14,
+                              int optInFastK_Period = 5,
+                              int optInFastD_Period = 3,
+                              TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   return TA_STOCHRSI_Lookback( optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType );
+}
+
+inline Result STOCHRSI( std::span<const double> inReal,
+                        std::span<double> outFastK,
+                        std::span<double> outFastD,
+                        int optInTimePeriod = 14,
+                        int optInFastK_Period = 5,
+                        int optInFastD_Period = 3,
+                        TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCHRSI_Lookback( optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType ); }, outFastK, outFastD ) )
+      return detail::badParam();
+
+   result.retCode = TA_STOCHRSI( 0, nbBar-1,
+                                 inReal.data(),
+                                 optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                                 &result.begIdx, &result.nbElement,
+                                 outFastK.data(),
+                                 outFastD.data() );
+   return result;
+}
+
+inline Result STOCHRSI( std::span<const float> inReal,
+                        std::span<double> outFastK,
+                        std::span<double> outFastD,
+                        int optInTimePeriod = 14,
+                        int optInFastK_Period = 5,
+                        int optInFastD_Period = 3,
+                        TA_MAType optInFastD_MAType = TA_MAType_SMA ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return STOCHRSI_Lookback( optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType ); }, outFastK, outFastD ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_STOCHRSI( 0, nbBar-1,
+                                   inReal.data(),
+                                   optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+                                   &result.begIdx, &result.nbElement,
+                                   outFastK.data(),
+                                   outFastD.data() );
+   return result;
+}
+
+/* SUB - Vector Arithmetic Substraction */
+inline int SUB_Lookback() noexcept
+{
+   return TA_SUB_Lookback();
+}
+
+inline Result SUB( std::span<const double> inReal0,
+                   std::span<const double> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SUB_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SUB( 0, nbBar-1,
+                            inReal0.data(), inReal1.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result SUB( std::span<const float> inReal0,
+                   std::span<const float> inReal1,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal0, inReal1 );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SUB_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SUB( 0, nbBar-1,
+                              inReal0.data(), inReal1.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* SUM - Summation */
+inline int SUM_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_SUM_Lookback( optInTimePeriod );
+}
+
+inline Result SUM( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SUM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_SUM( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result SUM( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return SUM_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_SUM( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* T3 - Triple Exponential Moving Average (T3) */
+inline int T3_Lookback( int optInTimePeriod = 5,
+                        double optInVFactor = 7.000000e-1 ) noexcept
+{
+   return TA_T3_Lookback( optInTimePeriod, optInVFactor );
+}
+
+inline Result T3( std::span<const double> inReal,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 5,
+                  double optInVFactor = 7.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return T3_Lookback( optInTimePeriod, optInVFactor ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_T3( 0, nbBar-1,
+                           inReal.data(),
+                           optInTimePeriod, optInVFactor,
+                           &result.begIdx, &result.nbElement,
+                           outReal.data() );
+   return result;
+}
+
+inline Result T3( std::span<const float> inReal,
+                  std::span<double> outReal,
+                  int optInTimePeriod = 5,
+                  double optInVFactor = 7.000000e-1 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return T3_Lookback( optInTimePeriod, optInVFactor ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_T3( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod, optInVFactor,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+/* TAN - Vector Trigonometric Tan */
+inline int TAN_Lookback() noexcept
+{
+   return TA_TAN_Lookback();
+}
+
+inline Result TAN( std::span<const double> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TAN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TAN( 0, nbBar-1,
+                            inReal.data(),
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result TAN( std::span<const float> inReal,
+                   std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TAN_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TAN( 0, nbBar-1,
+                              inReal.data(),
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* TANH - Vector Trigonometric Tanh */
+inline int TANH_Lookback() noexcept
+{
+   return TA_TANH_Lookback();
+}
+
+inline Result TANH( std::span<const double> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TANH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TANH( 0, nbBar-1,
+                             inReal.data(),
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result TANH( std::span<const float> inReal,
+                    std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TANH_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TANH( 0, nbBar-1,
+                               inReal.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* TEMA - Triple Exponential Moving Average */
+inline int TEMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_TEMA_Lookback( optInTimePeriod );
+}
+
+inline Result TEMA( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TEMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TEMA( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result TEMA( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TEMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TEMA( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* THRESHOLD_EVENTS - Crossings of a threshold */
+inline int THRESHOLD_EVENTS_Lookback( double optInThreshold = 0.000000e+0 ) noexcept
+{
+   return TA_THRESHOLD_EVENTS_Lookback( optInThreshold );
+}
+
+inline Result THRESHOLD_EVENTS( std::span<const double> inReal,
+                                std::span<int> outInteger,
+                                double optInThreshold = 0.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return THRESHOLD_EVENTS_Lookback( optInThreshold ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_THRESHOLD_EVENTS( 0, nbBar-1,
+                                         inReal.data(),
+                                         optInThreshold,
+                                         &result.begIdx, &result.nbElement,
+                                         outInteger.data() );
+   return result;
+}
+
+inline Result THRESHOLD_EVENTS( std::span<const float> inReal,
+                                std::span<int> outInteger,
+                                double optInThreshold = 0.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return THRESHOLD_EVENTS_Lookback( optInThreshold ); }, outInteger ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_THRESHOLD_EVENTS( 0, nbBar-1,
+                                           inReal.data(),
+                                           optInThreshold,
+                                           &result.begIdx, &result.nbElement,
+                                           outInteger.data() );
+   return result;
+}
+
+/* TRANGE - True Range */
+inline int TRANGE_Lookback() noexcept
+{
+   return TA_TRANGE_Lookback();
+}
+
+inline Result TRANGE( std::span<const double> inHigh,
+                      std::span<const double> inLow,
+                      std::span<const double> inClose,
+                      std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRANGE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TRANGE( 0, nbBar-1,
+                               inHigh.data(), inLow.data(), inClose.data(),
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result TRANGE( std::span<const float> inHigh,
+                      std::span<const float> inLow,
+                      std::span<const float> inClose,
+                      std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRANGE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TRANGE( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* TRIMA - Triangular Moving Average */
+inline int TRIMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_TRIMA_Lookback( optInTimePeriod );
+}
+
+inline Result TRIMA( std::span<const double> inReal,
+                     std::span<double> outReal,
+                     int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRIMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TRIMA( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+inline Result TRIMA( std::span<const float> inReal,
+                     std::span<double> outReal,
+                     int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRIMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TRIMA( 0, nbBar-1,
+                                inReal.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+/* TRIX - 1-day Rate-Of-Change (ROC) of a Triple Smooth EMA */
+inline int TRIX_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_TRIX_Lookback( optInTimePeriod );
+}
+
+inline Result TRIX( std::span<const double> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRIX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TRIX( 0, nbBar-1,
+                             inReal.data(),
+                             optInTimePeriod,
+                             &result.begIdx, &result.nbElement,
+                             outReal.data() );
+   return result;
+}
+
+inline Result TRIX( std::span<const float> inReal,
+                    std::span<double> outReal,
+                    int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TRIX_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TRIX( 0, nbBar-1,
+                               inReal.data(),
+                               optInTimePeriod,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+/* TSF - Time Series Forecast */
+inline int TSF_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_TSF_Lookback( optInTimePeriod );
+}
+
+inline Result TSF( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TSF_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TSF( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result TSF( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TSF_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TSF( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* TYPPRICE - Typical Price */
+inline int TYPPRICE_Lookback() noexcept
+{
+   return TA_TYPPRICE_Lookback();
+}
+
+inline Result TYPPRICE( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<const double> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TYPPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_TYPPRICE( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result TYPPRICE( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<const float> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return TYPPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_TYPPRICE( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* ULTOSC - Ultimate Oscillator */
+inline int ULTOSC_Lookback( int optInTimePeriod1 = 7,
+                            int optInTimePeriod2 = 14,
+                            int optInTimePeriod3 = 28 ) noexcept
+{
+   return TA_ULTOSC_Lookback( optInTimePeriod1, optInTimePeriod2, optInTimePeriod3 );
+}
+
+inline Result ULTOSC( std::span<const double> inHigh,
+                      std::span<const double> inLow,
+                      std::span<const double> inClose,
+                      std::span<double> outReal,
+                      int optInTimePeriod1 = 7,
+                      int optInTimePeriod2 = 14,
+                      int optInTimePeriod3 = 28 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ULTOSC_Lookback( optInTimePeriod1, optInTimePeriod2, optInTimePeriod3 ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_ULTOSC( 0, nbBar-1,
+                               inHigh.data(), inLow.data(), inClose.data(),
+                               optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+                               &result.begIdx, &result.nbElement,
+                               outReal.data() );
+   return result;
+}
+
+inline Result ULTOSC( std::span<const float> inHigh,
+                      std::span<const float> inLow,
+                      std::span<const float> inClose,
+                      std::span<double> outReal,
+                      int optInTimePeriod1 = 7,
+                      int optInTimePeriod2 = 14,
+                      int optInTimePeriod3 = 28 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return ULTOSC_Lookback( optInTimePeriod1, optInTimePeriod2, optInTimePeriod3 ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_ULTOSC( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+/* VAR - Variance */
+inline int VAR_Lookback( int optInTimePeriod = 5,
+                         double optInNbDev = 1.000000e+0 ) noexcept
+{
+   return TA_VAR_Lookback( optInTimePeriod, optInNbDev );
+}
+
+inline Result VAR( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 5,
+                   double optInNbDev = 1.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return VAR_Lookback( optInTimePeriod, optInNbDev ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_VAR( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod, optInNbDev,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result VAR( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 5,
+                   double optInNbDev = 1.000000e+0 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return VAR_Lookback( optInTimePeriod, optInNbDev ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_VAR( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod, optInNbDev,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+/* WCLPRICE - Weighted Close Price */
+inline int WCLPRICE_Lookback() noexcept
+{
+   return TA_WCLPRICE_Lookback();
+}
+
+inline Result WCLPRICE( std::span<const double> inHigh,
+                        std::span<const double> inLow,
+                        std::span<const double> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WCLPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_WCLPRICE( 0, nbBar-1,
+                                 inHigh.data(), inLow.data(), inClose.data(),
+                                 &result.begIdx, &result.nbElement,
+                                 outReal.data() );
+   return result;
+}
+
+inline Result WCLPRICE( std::span<const float> inHigh,
+                        std::span<const float> inLow,
+                        std::span<const float> inClose,
+                        std::span<double> outReal ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WCLPRICE_Lookback(); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_WCLPRICE( 0, nbBar-1,
+                                   inHigh.data(), inLow.data(), inClose.data(),
+                                   &result.begIdx, &result.nbElement,
+                                   outReal.data() );
+   return result;
+}
+
+/* WILLR - Williams' %R */
+inline int WILLR_Lookback( int optInTimePeriod = 14 ) noexcept
+{
+   return TA_WILLR_Lookback( optInTimePeriod );
+}
+
+inline Result WILLR( std::span<const double> inHigh,
+                     std::span<const double> inLow,
+                     std::span<const double> inClose,
+                     std::span<double> outReal,
+                     int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WILLR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_WILLR( 0, nbBar-1,
+                              inHigh.data(), inLow.data(), inClose.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+inline Result WILLR( std::span<const float> inHigh,
+                     std::span<const float> inLow,
+                     std::span<const float> inClose,
+                     std::span<double> outReal,
+                     int optInTimePeriod = 14 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inHigh, inLow, inClose );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WILLR_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_WILLR( 0, nbBar-1,
+                                inHigh.data(), inLow.data(), inClose.data(),
+                                optInTimePeriod,
+                                &result.begIdx, &result.nbElement,
+                                outReal.data() );
+   return result;
+}
+
+/* WMA - Weighted Moving Average */
+inline int WMA_Lookback( int optInTimePeriod = 30 ) noexcept
+{
+   return TA_WMA_Lookback( optInTimePeriod );
+}
+
+inline Result WMA( std::span<const double> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_WMA( 0, nbBar-1,
+                            inReal.data(),
+                            optInTimePeriod,
+                            &result.begIdx, &result.nbElement,
+                            outReal.data() );
+   return result;
+}
+
+inline Result WMA( std::span<const float> inReal,
+                   std::span<double> outReal,
+                   int optInTimePeriod = 30 ) noexcept
+{
+   Result result = { TA_SUCCESS, 0, 0 };
+   int nbBar;
+
+   nbBar = detail::nbBar( inReal );
+   if( (nbBar < 0) ||
+       !detail::outputFits( nbBar,
+                            [&]{ return WMA_Lookback( optInTimePeriod ); }, outReal ) )
+      return detail::badParam();
+
+   result.retCode = TA_S_WMA( 0, nbBar-1,
+                              inReal.data(),
+                              optInTimePeriod,
+                              &result.begIdx, &result.nbElement,
+                              outReal.data() );
+   return result;
+}
+
+} /* namespace ta */
+
+#endif
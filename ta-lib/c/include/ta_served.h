@@ -0,0 +1,141 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TA_SERVED_H
+#define TA_SERVED_H
+
+/* Protocol between the ta_served daemon and its clients.
+ *
+ * ta_served calculates the TA functions for the other processes of
+ * the host (see c/src/tools/ta_served/ReadMe.txt).
+ *
+ * A client connects to the Unix socket of the daemon and writes one
+ * TA_ServedRequest for each calculation. The daemon writes back one
+ * TA_ServedResponse for each request. Many requests can be sent
+ * before reading the responses, they may then come back in a
+ * different order (use 'requestId').
+ *
+ * The inputs and outputs are not part of these messages. They are
+ * in POSIX shared memory segments (shm_open) created by the client,
+ * the request only gives where they are. The daemon maps the same
+ * segments and the TA function reads and writes them directly.
+ *
+ * The values are in the native byte order and alignment: the client
+ * and the daemon are always on the same host.
+ */
+
+#ifndef TA_DEFS_H
+   #include "ta_defs.h"
+#endif
+
+#define TA_SERVED_MAGIC          0x54415344 /* "TASD" */
+#define TA_SERVED_DEFAULT_SOCKET "/tmp/ta_served.sock"
+
+#define TA_SERVED_MAX_NAME      64  /* Including the terminating zero. */
+#define TA_SERVED_MAX_ARRAY     16
+#define TA_SERVED_MAX_OPTINPUT  16
+#define TA_SERVED_MAX_OUTPUT    4
+
+/* TA_ServedRequest.flags */
+#define TA_SERVED_FLG_NO_CACHE  0x00000001 /* Do not use the result cache. */
+
+typedef struct
+{
+   unsigned int magic;     /* TA_SERVED_MAGIC */
+   unsigned int requestId; /* Returned as-is in the response. */
+   unsigned int flags;
+
+   /* Name of the function, ex: "SMA". */
+   char funcName[TA_SERVED_MAX_NAME];
+
+   /* Names of the shared memory segments, as given to shm_open. The
+    * outputs can be in the same segment as the inputs.
+    */
+   char inSegment[TA_SERVED_MAX_NAME];
+   char outSegment[TA_SERVED_MAX_NAME];
+
+   /* Same meaning as for TA_CallFunc. */
+   int startIdx;
+   int endIdx;
+
+   /* Optional inputs in the order of the function (the integer ones
+    * are converted to int, TA_BAD_PARAM when not within the range of
+    * an int). The ones not specified take their default.
+    */
+   unsigned int nbOptInput;
+   double optInput[TA_SERVED_MAX_OPTINPUT];
+
+   /* Offset in bytes of each input array in 'inSegment', in the order
+    * of the inputs of the function. A price input takes one array for
+    * each of its components, in the order open, high, low, close,
+    * volume and open interest.
+    *
+    * The arrays are TA_Real (double), except for the TA_Input_Integer
+    * inputs (int). The elements from 0 to endIdx must be in the segment.
+    */
+   unsigned int nbInArray;
+   UInt64 inOffset[TA_SERVED_MAX_ARRAY];
+
+   /* Offset in bytes of each output in 'outSegment', with room for
+    * endIdx-startIdx+1 elements (double, or int for TA_Output_Integer).
+    */
+   unsigned int nbOutput;
+   UInt64 outOffset[TA_SERVED_MAX_OUTPUT];
+
+   /* The result cache is shared by all the clients: the same inSegment,
+    * inOffset and seriesVersion are assumed to be the same data.
+    *
+    * Change the version when a value already in the segment is modified.
+    * Appending new bars after the previous endIdx does not need a new
+    * version (only the new bars are then calculated when possible).
+    */
+   unsigned int seriesVersion;
+} TA_ServedRequest;
+
+/* TA_ServedResponse.cacheResult */
+#define TA_SERVED_CACHE_NONE    0 /* Calculated without the cache. */
+#define TA_SERVED_CACHE_MISS    1 /* Calculated and kept in the cache. */
+#define TA_SERVED_CACHE_HIT     2 /* Copied from the cache. */
+#define TA_SERVED_CACHE_EXTEND  3 /* Only the new bars calculated. */
+
+typedef struct
+{
+   unsigned int magic;     /* TA_SERVED_MAGIC */
+   unsigned int requestId;
+   int retCode;            /* TA_RetCode */
+   int outBegIdx;
+   int outNbElement;
+   unsigned int cacheResult;
+} TA_ServedResponse;
+
+#endif
@@ -123,6 +123,8 @@ EXCEL_GLUE_CODE_WITH_2_PARAM(CMO)
 EXCEL_GLUE_CODE_WITH_3_PARAM(CORREL)
 EXCEL_GLUE_CODE_WITH_1_PARAM(COS)
 EXCEL_GLUE_CODE_WITH_1_PARAM(COSH)
+EXCEL_GLUE_CODE_WITH_2_PARAM(CROSSOVER)
+EXCEL_GLUE_CODE_WITH_2_PARAM(CROSSUNDER)
 EXCEL_GLUE_CODE_WITH_2_PARAM(DEMA)
 EXCEL_GLUE_CODE_WITH_2_PARAM(DIV)
 EXCEL_GLUE_CODE_WITH_4_PARAM(DX)
@@ -147,10 +149,12 @@ EXCEL_GLUE_CODE_WITH_3_PARAM(MA)
 EXCEL_GLUE_CODE_WITH_4_PARAM(MACD)
 EXCEL_GLUE_CODE_WITH_7_PARAM(MACDEXT)
 EXCEL_GLUE_CODE_WITH_2_PARAM(MACDFIX)
+EXCEL_GLUE_CODE_WITH_2_PARAM(MAD)
 EXCEL_GLUE_CODE_WITH_3_PARAM(MAMA)
 EXCEL_GLUE_CODE_WITH_5_PARAM(MAVP)
 EXCEL_GLUE_CODE_WITH_2_PARAM(MAX)
 EXCEL_GLUE_CODE_WITH_2_PARAM(MAXINDEX)
+EXCEL_GLUE_CODE_WITH_2_PARAM(MEDIAN)
 EXCEL_GLUE_CODE_WITH_2_PARAM(MEDPRICE)
 EXCEL_GLUE_CODE_WITH_5_PARAM(MFI)
 EXCEL_GLUE_CODE_WITH_2_PARAM(MIDPOINT)
@@ -168,6 +172,7 @@ EXCEL_GLUE_CODE_WITH_2_PARAM(OBV)
 EXCEL_GLUE_CODE_WITH_4_PARAM(PLUS_DI)
 EXCEL_GLUE_CODE_WITH_3_PARAM(PLUS_DM)
 EXCEL_GLUE_CODE_WITH_4_PARAM(PPO)
+EXCEL_GLUE_CODE_WITH_3_PARAM(QUANTILE)
 EXCEL_GLUE_CODE_WITH_2_PARAM(ROC)
 EXCEL_GLUE_CODE_WITH_2_PARAM(ROCP)
 EXCEL_GLUE_CODE_WITH_2_PARAM(ROCR)
@@ -189,6 +194,7 @@ EXCEL_GLUE_CODE_WITH_3_PARAM(T3)
 EXCEL_GLUE_CODE_WITH_1_PARAM(TAN)
 EXCEL_GLUE_CODE_WITH_1_PARAM(TANH)
 EXCEL_GLUE_CODE_WITH_2_PARAM(TEMA)
+EXCEL_GLUE_CODE_WITH_2_PARAM(THRESHOLD_EVENTS)
 EXCEL_GLUE_CODE_WITH_3_PARAM(TRANGE)
 EXCEL_GLUE_CODE_WITH_2_PARAM(TRIMA)
 EXCEL_GLUE_CODE_WITH_2_PARAM(TRIX)
@@ -60,8 +60,10 @@
 #include <stddef.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
 #include "ta_common.h"
 #include "ta_memory.h"
+#include "ta_global.h"
 #include "ta_abstract.h"
 #include "ta_def_ui.h"
 #include "ta_frame_priv.h"
@@ -119,6 +121,14 @@ extern const unsigned int TA_DEF_TableASize, TA_DEF_TableBSize,
    #define min(a, b)  (((a) < (b)) ? (a) : (b))
 #endif
 
+/* Limited by the outBitmap, one bit per output. */
+#define TA_MAX_NB_OUTPUT 32
+
+/* Number of elements calculated at once for the compact outputs,
+ * small enough for the TA_Integer outputs to stay in the cache.
+ */
+#define TA_COMPACT_CHUNK 1024
+
 typedef struct 
 {
    unsigned int magicNumber;
@@ -142,8 +152,70 @@ typedef struct
                                        const char **stringPtr );
 #endif
 
+static TA_RetCode callFunction( const TA_ParamHolderPriv *params,
+                                TA_Integer  startIdx,
+                                TA_Integer  endIdx,
+                                TA_Integer *outBegIdx,
+                                TA_Integer *outNbElement );
+static TA_RetCode callAligned( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement );
+static TA_RetCode callCompact( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement );
+static void storeOutput( const TA_ParamHolderOutput *output,
+                         const TA_ParamHolderOutput *chunkOutput,
+                         TA_Integer outIdx,
+                         TA_Integer nbElement );
+static void padOutput( const TA_ParamHolderOutput *output,
+                       TA_Integer startIdx,
+                       TA_Integer endIdx );
+static TA_RetCode setOutputCompact( TA_ParamHolder *param,
+                                    unsigned int paramIndex,
+                                    TA_CompactType compactType,
+                                    void *out );
+static int getInt8Divisor( const TA_FuncInfo *funcInfo );
+static TA_RetCode callFrame( const TA_FuncDef *funcDef,
+                             TA_FrameFunction function,
+                             const TA_ParamHolderPriv *params,
+                             TA_Integer  startIdx,
+                             TA_Integer  endIdx,
+                             TA_Integer *outBegIdx,
+                             TA_Integer *outNbElement );
+
 /**** Local variables definitions.     ****/
 
+/* Functions (in addition to the "Math Operators", "Math Transform"
+ * and "Price Transform" groups) for which the output at a given
+ * index depends only on the inputs within its lookback window.
+ * The event functions are listed even if they are "Math Operators",
+ * they must not depend on their group.
+ *
+ * Must be kept sorted, it is searched with a binary search.
+ */
+static const char *TA_WindowFuncNames[] =
+{
+   "ACCBANDS", "AROON", "AROONOSC", "BETA", "BOP", "CCI", "CORREL",
+   "CROSSOVER", "CROSSUNDER", "IMI", "LINEARREG", "LINEARREG_ANGLE",
+   "LINEARREG_INTERCEPT", "LINEARREG_SLOPE", "MAD", "MEDIAN", "MFI",
+   "MIDPOINT", "MIDPRICE", "MOM", "QUANTILE", "ROC", "ROCP", "ROCR",
+   "ROCR100", "SMA", "STDDEV", "THRESHOLD_EVENTS", "TRANGE", "TRIMA",
+   "TSF", "ULTOSC", "VAR", "WILLR", "WMA"
+};
+
+/* Functions (in addition to the "Pattern Recognition" group) with
+ * integer outputs small enough to be stored as int8. The indices
+ * output by MAXINDEX, MININDEX and MINMAXINDEX are not bounded.
+ */
+static const char *TA_Int8FuncNames[] =
+{
+   "CROSSOVER", "CROSSUNDER", "HT_TRENDMODE", "THRESHOLD_EVENTS"
+};
+
 static const TA_FuncDef **TA_DEF_Tables[26] =
 {
    &TA_DEF_TableA, &TA_DEF_TableB, &TA_DEF_TableC, &TA_DEF_TableD, &TA_DEF_TableE,
@@ -810,6 +882,7 @@ TA_RetCode TA_SetInputParamIntegerPtr( TA_ParamHolder *param,
 
    /* keep a copy of the provided parameter. */
    paramHolderPriv->in[paramIndex].data.inInteger = value; 
+   paramHolderPriv->in[paramIndex].index = NULL;
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
@@ -855,6 +928,7 @@ TA_RetCode TA_SetInputParamRealPtr( TA_ParamHolder *param,
 
    /* keep a copy of the provided parameter. */
    paramHolderPriv->in[paramIndex].data.inReal = value; 
+   paramHolderPriv->in[paramIndex].index = NULL;
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
@@ -862,6 +936,38 @@ TA_RetCode TA_SetInputParamRealPtr( TA_ParamHolder *param,
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetInputParamSeriesIndex( TA_ParamHolder *param,
+                                        unsigned int paramIndex,
+                                        const TA_SeriesIndex *index )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+   const TA_SeriesIndexPriv *indexPriv;
+   TA_RetCode retCode;
+
+   if( (param == NULL) || (index == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   indexPriv = (const TA_SeriesIndexPriv *)(index->hiddenData);
+   if( !indexPriv || (indexPriv->magicNumber != TA_SERIES_INDEX_MAGIC_NB) )
+   {
+      return TA_BAD_OBJECT;
+   }
+
+   /* The index is also a regular input for the functions
+    * who cannot use it.
+    */
+   retCode = TA_SetInputParamRealPtr( param, paramIndex, indexPriv->data );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   paramHolderPriv->in[paramIndex].index = index;
+
+   return TA_SUCCESS;
+}
+
 TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder     *param,
                                      unsigned int        paramIndex,
                                      const TA_Real      *open,
@@ -1057,6 +1163,9 @@ TA_RetCode TA_SetOutputParamIntegerPtr( TA_ParamHolder *param,
 
    /* keep a copy of the provided parameter. */
    paramHolderPriv->out[paramIndex].data.outInteger = out; 
+   paramHolderPriv->out[paramIndex].compactType = TA_Compact_None;
+   paramHolderPriv->out[paramIndex].compactOut  = NULL;
+   paramHolderPriv->compactBitmap &= ~(1<<paramIndex);
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->outBitmap &= ~(1<<paramIndex);
@@ -1064,6 +1173,20 @@ TA_RetCode TA_SetOutputParamIntegerPtr( TA_ParamHolder *param,
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetOutputParamInt8Ptr( TA_ParamHolder *param,
+                                     unsigned int paramIndex,
+                                     signed char    *out )
+{
+   return setOutputCompact( param, paramIndex, TA_Compact_Int8, out );
+}
+
+TA_RetCode TA_SetOutputParamBitPtr( TA_ParamHolder *param,
+                                    unsigned int paramIndex,
+                                    unsigned char  *out )
+{
+   return setOutputCompact( param, paramIndex, TA_Compact_Bit, out );
+}
+
 TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *param,
                                      unsigned int paramIndex,
                                      TA_Real        *out )
@@ -1109,6 +1232,52 @@ TA_RetCode TA_SetOutputParamRealPtr( TA_ParamHolder *param,
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_SetOutputAligned( TA_ParamHolder *param,
+                                int aligned )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+
+   if( param == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   paramHolderPriv->alignedOutput = aligned? 1 : 0;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SetParamHolderCache( TA_ParamHolder *param,
+                                   TA_ResultCache *cache,
+                                   UInt64 seriesId,
+                                   unsigned int seriesVersion )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+
+   if( param == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   paramHolderPriv->cache         = cache;
+   paramHolderPriv->seriesId      = seriesId;
+   paramHolderPriv->seriesVersion = seriesVersion;
+
+   return TA_SUCCESS;
+}
+
 TA_RetCode TA_GetLookback( const TA_ParamHolder *param, TA_Integer *lookback )
 {   
    const TA_ParamHolderPriv *paramHolderPriv;
@@ -1143,6 +1312,30 @@ TA_RetCode TA_GetLookback( const TA_ParamHolder *param, TA_Integer *lookback )
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_GetMaxLookback( const TA_ParamHolder * const *params,
+                              unsigned int nbParams,
+                              TA_Integer *maxLookback )
+{
+   TA_RetCode retCode;
+   TA_Integer lookback;
+   unsigned int i;
+
+   if( !params || !maxLookback )
+      return TA_BAD_PARAM;
+
+   *maxLookback = 0;
+   for( i=0; i < nbParams; i++ )
+   {
+      retCode = TA_GetLookback( params[i], &lookback );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      if( lookback > *maxLookback )
+         *maxLookback = lookback;
+   }
+
+   return TA_SUCCESS;
+}
+
 /* Finally, call a TA function with the parameters. */
 TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
                         TA_Integer            startIdx,
@@ -1190,11 +1383,492 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    if( !function ) return TA_INTERNAL_ERROR(2);
 
    /* Perform the function call. */
-   retCode = (*function)( paramHolderPriv, startIdx, endIdx,
-                          outBegIdx, outNbElement );
+   if( paramHolderPriv->compactBitmap != 0 )
+      retCode = callCompact( paramHolderPriv, startIdx, endIdx,
+                             outBegIdx, outNbElement );
+   else if( paramHolderPriv->alignedOutput )
+      retCode = callAligned( paramHolderPriv, startIdx, endIdx,
+                             outBegIdx, outNbElement );
+   else if( paramHolderPriv->cache )
+      retCode = TA_ResultCacheCall( paramHolderPriv, startIdx, endIdx,
+                                    outBegIdx, outNbElement );
+   else
+      retCode = callFunction( paramHolderPriv, startIdx, endIdx,
+                              outBegIdx, outNbElement );
    return retCode;
 }
 
+/* Same as TA_CallFunc, but the output is always aligned with the input. */
+TA_RetCode TA_CallFuncAligned( const TA_ParamHolder *param,
+                               TA_Integer            startIdx,
+                               TA_Integer            endIdx,
+                               TA_Integer           *outBegIdx,
+                               TA_Integer           *outNbElement )
+{
+   TA_ParamHolder alignedParam;
+   TA_ParamHolderPriv alignedParamPriv;
+   const TA_ParamHolderPriv *paramHolderPriv;
+
+   if( param == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   alignedParamPriv = *paramHolderPriv;
+   alignedParamPriv.alignedOutput = 1;
+   alignedParam.hiddenData = &alignedParamPriv;
+
+   return TA_CallFunc( &alignedParam, startIdx, endIdx, outBegIdx, outNbElement );
+}
+
+/* Call a TA function only at the specified indices. */
+TA_RetCode TA_CallFuncAtIndices( const TA_ParamHolder *param,
+                                 const TA_Integer     *indices,
+                                 TA_Integer            nbIndices,
+                                 TA_Integer           *outBegIdx,
+                                 TA_Integer           *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+   TA_ParamHolderPriv spanParams;
+   TA_ParamHolderOutput *spanOutput;
+   TA_Real *scratch;
+
+   const TA_FuncDef *funcDef;
+   const TA_FuncInfo *funcInfo;
+   TA_FrameFunction function;
+   TA_FrameLookback lookbackFunction;
+
+   TA_Integer lookback, maxGap, firstIdx, maxSpan;
+   TA_Integer i, j, k, callStart, spanStart, spanSize;
+   TA_Integer spanBegIdx, spanNbElement;
+   TA_StatsCall statsCall;
+   unsigned int outIdx, nbOutput;
+   int isDense;
+
+   if( (param == NULL) ||
+       (indices == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *outBegIdx = 0;
+   *outNbElement = 0;
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Check that all parameters are initialize (except the optInput). */
+   if( paramHolderPriv->inBitmap != 0 )
+   {
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+   }
+
+   if( paramHolderPriv->outBitmap != 0 )
+   {
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+   }
+
+   /* The compact outputs are supported only by TA_CallFunc. */
+   if( paramHolderPriv->compactBitmap != 0 )
+   {
+      return TA_NOT_SUPPORTED;
+   }
+
+   /* Get the pointer on the function and its lookback. */
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+   funcDef = (const TA_FuncDef *)funcInfo->handle;
+   if( !funcDef ) return TA_INTERNAL_ERROR(2);
+   function = funcDef->function;
+   if( !function ) return TA_INTERNAL_ERROR(2);
+   lookbackFunction = funcDef->lookback;
+   if( !lookbackFunction ) return TA_INTERNAL_ERROR(2);
+
+   /* The indices must be positive and strictly increasing. */
+   if( nbIndices < 1 )
+      return TA_BAD_PARAM;
+   if( indices[0] < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   for( i=1; i < nbIndices; i++ )
+   {
+      if( indices[i] <= indices[i-1] )
+         return TA_BAD_PARAM;
+   }
+
+   /* Use the series index when the function can be calculated from it. */
+   if( paramHolderPriv->in[0].index )
+   {
+      if( TA_Globals->statsEnabled )
+      {
+         TA_StatsCallBegin( &statsCall );
+         retCode = TA_SeriesIndexCallAtIndices( paramHolderPriv, indices, nbIndices,
+                                                outBegIdx, outNbElement );
+         if( retCode != TA_NOT_SUPPORTED )
+            TA_StatsCallEnd( funcDef->stats, &statsCall, nbIndices );
+      }
+      else
+         retCode = TA_SeriesIndexCallAtIndices( paramHolderPriv, indices, nbIndices,
+                                                outBegIdx, outNbElement );
+      if( retCode != TA_NOT_SUPPORTED )
+         return retCode;
+   }
+
+   /* Skip the indices for which there is not enough data
+    * to calculate a value.
+    */
+   lookback = (TA_Integer)(*lookbackFunction)( paramHolderPriv );
+   firstIdx = 0;
+   while( (firstIdx < nbIndices) && (indices[firstIdx] < lookback) )
+      firstIdx++;
+
+   if( firstIdx == nbIndices )
+      return TA_SUCCESS;
+
+   /* The indices are grouped in spans, each span being
+    * calculated with a single call to the function.
+    *
+    * When the output at an index depends only on its lookback
+    * window, a new span is started whenever the gap with the
+    * previous index is larger than the lookback (calculating the
+    * gap would cost more than reading a new lookback window).
+    *
+    * For all other functions the output depends on where the
+    * calculation is started, so a single call is done from the
+    * first to the last index. This gives the same values as a
+    * TA_CallFunc from the first to the last index.
+    */
+   if( TA_IsWindowFunc( funcInfo ) )
+      maxGap = lookback+1;
+   else
+      maxGap = INT_MAX;
+
+   /* First pass: find the largest span that cannot be written
+    * directly in the caller output.
+    */
+   maxSpan = 0;
+   for( i=firstIdx; i < nbIndices; i=j+1 )
+   {
+      j = i;
+      while( (j+1 < nbIndices) && ((indices[j+1]-indices[j]) <= maxGap) )
+         j++;
+      spanStart = (maxGap == INT_MAX)? indices[0] : indices[i];
+      if( spanStart < lookback )
+         spanStart = lookback;
+      spanSize = indices[j]-spanStart+1;
+      if( (spanSize != (j-i+1)) && (spanSize > maxSpan) )
+         maxSpan = spanSize;
+   }
+
+   nbOutput = funcInfo->nbOutput;
+   spanOutput = (TA_ParamHolderOutput *)TA_Malloc( nbOutput*sizeof(TA_ParamHolderOutput) );
+   if( !spanOutput )
+      return TA_ALLOC_ERR;
+
+   scratch = NULL;
+   if( maxSpan > 0 )
+   {
+      scratch = (TA_Real *)TA_Malloc( nbOutput*maxSpan*sizeof(TA_Real) );
+      if( !scratch )
+      {
+         TA_Free( spanOutput );
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   /* Work on a copy of the parameters where only the
+    * output pointers are changed for each span.
+    */
+   spanParams = *paramHolderPriv;
+   spanParams.out = spanOutput;
+   for( outIdx=0; outIdx < nbOutput; outIdx++ )
+      spanOutput[outIdx].outputInfo = paramHolderPriv->out[outIdx].outputInfo;
+
+   /* Second pass: calculate each span. */
+   retCode = TA_SUCCESS;
+   for( i=firstIdx; i < nbIndices; i=j+1 )
+   {
+      j = i;
+      while( (j+1 < nbIndices) && ((indices[j+1]-indices[j]) <= maxGap) )
+         j++;
+      callStart = (maxGap == INT_MAX)? indices[0] : indices[i];
+      spanStart = (callStart < lookback)? lookback : callStart;
+      spanSize  = indices[j]-spanStart+1;
+      isDense   = (spanSize == (j-i+1));
+
+      for( outIdx=0; outIdx < nbOutput; outIdx++ )
+      {
+         if( spanOutput[outIdx].outputInfo->type == TA_Output_Integer )
+         {
+            if( isDense )
+               spanOutput[outIdx].data.outInteger = &paramHolderPriv->out[outIdx].data.outInteger[i-firstIdx];
+            else
+               spanOutput[outIdx].data.outInteger = (TA_Integer *)&scratch[outIdx*maxSpan];
+         }
+         else
+         {
+            if( isDense )
+               spanOutput[outIdx].data.outReal = &paramHolderPriv->out[outIdx].data.outReal[i-firstIdx];
+            else
+               spanOutput[outIdx].data.outReal = &scratch[outIdx*maxSpan];
+         }
+      }
+
+      retCode = callFrame( funcDef, function, &spanParams, callStart, indices[j],
+                           &spanBegIdx, &spanNbElement );
+      if( retCode != TA_SUCCESS )
+         break;
+
+      if( (spanBegIdx != spanStart) || (spanNbElement != spanSize) )
+      {
+         retCode = TA_INTERNAL_ERROR(3);
+         break;
+      }
+
+      /* Gather the requested values from the scratch buffer. */
+      if( !isDense )
+      {
+         for( outIdx=0; outIdx < nbOutput; outIdx++ )
+         {
+            if( spanOutput[outIdx].outputInfo->type == TA_Output_Integer )
+            {
+               for( k=i; k <= j; k++ )
+                  paramHolderPriv->out[outIdx].data.outInteger[k-firstIdx] = spanOutput[outIdx].data.outInteger[indices[k]-spanStart];
+            }
+            else
+            {
+               for( k=i; k <= j; k++ )
+                  paramHolderPriv->out[outIdx].data.outReal[k-firstIdx] = spanOutput[outIdx].data.outReal[indices[k]-spanStart];
+            }
+         }
+      }
+   }
+
+   if( scratch )
+      TA_Free( scratch );
+   TA_Free( spanOutput );
+
+   if( retCode == TA_SUCCESS )
+   {
+      *outBegIdx    = firstIdx;
+      *outNbElement = nbIndices-firstIdx;
+   }
+
+   return retCode;
+}
+
+/* Call a TA function independently on each segment of the inputs. */
+TA_RetCode TA_CallFuncSegments( const TA_ParamHolder *param,
+                                const TA_Integer     *segmentOffsets,
+                                TA_Integer            nbSegment,
+                                TA_Integer           *outBegIdx,
+                                TA_Integer           *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_ParamHolderPriv *paramHolderPriv;
+   TA_ParamHolderPriv segmentParams;
+   TA_ParamHolderInput  *segmentInput;
+   TA_ParamHolderOutput *segmentOutput;
+   const TA_ParamHolderInput  *input;
+   const TA_ParamHolderOutput *output;
+
+   const TA_FuncDef *funcDef;
+   const TA_FuncInfo *funcInfo;
+   TA_FrameFunction function;
+
+   TA_Integer i, offset, nbElement;
+   unsigned int j, nbInput, nbOutput;
+
+   if( (param == NULL) ||
+       (segmentOffsets == NULL) ||
+       (outBegIdx == NULL) ||
+       (outNbElement == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Check that all parameters are initialize (except the optInput). */
+   if( paramHolderPriv->inBitmap != 0 )
+   {
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+   }
+
+   if( paramHolderPriv->outBitmap != 0 )
+   {
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+   }
+
+   /* The compact outputs are supported only by TA_CallFunc. */
+   if( paramHolderPriv->compactBitmap != 0 )
+   {
+      return TA_NOT_SUPPORTED;
+   }
+
+   /* Get the pointer on the function */
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+   funcDef = (const TA_FuncDef *)funcInfo->handle;
+   if( !funcDef ) return TA_INTERNAL_ERROR(2);
+   function = funcDef->function;
+   if( !function ) return TA_INTERNAL_ERROR(2);
+
+   /* The offsets must be positive and increasing (empty
+    * segments are allowed).
+    */
+   if( nbSegment < 1 )
+      return TA_BAD_PARAM;
+   if( segmentOffsets[0] < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   for( i=0; i < nbSegment; i++ )
+   {
+      if( segmentOffsets[i+1] < segmentOffsets[i] )
+         return TA_BAD_PARAM;
+   }
+
+   /* Work on a copy of the parameters where the input and output
+    * pointers are moved at the start of each segment. Each segment
+    * is then processed like a distinct series starting at index zero.
+    * The function itself validates the optional inputs and allocates
+    * its temporary buffers again for each segment.
+    */
+   nbInput  = funcInfo->nbInput;
+   nbOutput = funcInfo->nbOutput;
+   segmentInput = (TA_ParamHolderInput *)TA_Malloc( nbInput*sizeof(TA_ParamHolderInput) +
+                                                    nbOutput*sizeof(TA_ParamHolderOutput) );
+   if( !segmentInput )
+      return TA_ALLOC_ERR;
+   segmentOutput = (TA_ParamHolderOutput *)&segmentInput[nbInput];
+
+   segmentParams = *paramHolderPriv;
+   segmentParams.in  = segmentInput;
+   segmentParams.out = segmentOutput;
+   for( j=0; j < nbInput; j++ )
+   {
+      segmentInput[j] = paramHolderPriv->in[j];
+
+      /* The index is for the whole series, not for a segment. */
+      segmentInput[j].index = NULL;
+   }
+   for( j=0; j < nbOutput; j++ )
+      segmentOutput[j] = paramHolderPriv->out[j];
+
+   #define OFFSET_PTR(x) { if( input->data.x ) segmentInput[j].data.x = input->data.x+offset; }
+
+   retCode = TA_SUCCESS;
+   for( i=0; i < nbSegment; i++ )
+   {
+      offset    = segmentOffsets[i];
+      nbElement = segmentOffsets[i+1]-offset;
+      outBegIdx[i]    = 0;
+      outNbElement[i] = 0;
+      if( nbElement == 0 )
+         continue;
+
+      for( j=0; j < nbInput; j++ )
+      {
+         input = &paramHolderPriv->in[j];
+         switch( input->inputInfo->type )
+         {
+         case TA_Input_Price:
+            OFFSET_PTR(inPrice.open);
+            OFFSET_PTR(inPrice.high);
+            OFFSET_PTR(inPrice.low);
+            OFFSET_PTR(inPrice.close);
+            OFFSET_PTR(inPrice.volume);
+            OFFSET_PTR(inPrice.openInterest);
+            break;
+         case TA_Input_Real:
+            OFFSET_PTR(inReal);
+            break;
+         case TA_Input_Integer:
+            OFFSET_PTR(inInteger);
+            break;
+         }
+      }
+
+      for( j=0; j < nbOutput; j++ )
+      {
+         output = &paramHolderPriv->out[j];
+         if( output->outputInfo->type == TA_Output_Integer )
+            segmentOutput[j].data.outInteger = output->data.outInteger+offset;
+         else
+            segmentOutput[j].data.outReal = output->data.outReal+offset;
+      }
+
+      if( segmentParams.alignedOutput )
+         retCode = callAligned( &segmentParams, 0, nbElement-1,
+                                &outBegIdx[i], &outNbElement[i] );
+      else
+         retCode = callFrame( funcDef, function, &segmentParams, 0, nbElement-1,
+                              &outBegIdx[i], &outNbElement[i] );
+      if( retCode != TA_SUCCESS )
+         break;
+   }
+
+   #undef OFFSET_PTR
+
+   TA_Free( segmentInput );
+
+   return retCode;
+}
+
+void TA_StatsEnable( int enable )
+{
+   TA_Globals->statsEnabled = enable? 1 : 0;
+}
+
+void TA_StatsReset( void )
+{
+   const TA_FuncDef **funcDefTable;
+   unsigned int i, j, funcDefTableSize;
+
+   for( i=0; i < 26; i++ )
+   {
+      funcDefTable = TA_DEF_Tables[i];
+      funcDefTableSize = *TA_DEF_TablesSize[i];
+      for( j=0; j < funcDefTableSize; j++ )
+         TA_StatsClear( funcDefTable[j]->stats );
+   }
+}
+
+TA_RetCode TA_GetFuncStats( const TA_FuncHandle *handle,
+                            TA_FuncStats *stats )
+{
+   const TA_FuncDef *funcDef;
+
+   if( !handle || !stats )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   funcDef = (const TA_FuncDef *)handle;
+   if( funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB )
+   {
+      return TA_INVALID_HANDLE;
+   }
+
+   TA_StatsCopy( stats, funcDef->stats );
+
+   return TA_SUCCESS;
+}
+
 /**** Local functions definitions.     ****/
 static TA_RetCode getGroupId( const char *groupString, unsigned int *groupId )
 {
@@ -1311,3 +1985,477 @@ static TA_RetCode getGroupSize( TA_GroupId groupId, unsigned int *groupSize )
       return TA_SUCCESS;
    #endif
 }
+
+int TA_IsWindowFunc( const TA_FuncInfo *funcInfo )
+{
+   int low, high, mid, cmp;
+
+   if( (strcmp( funcInfo->group, "Math Operators"  ) == 0) ||
+       (strcmp( funcInfo->group, "Math Transform"  ) == 0) ||
+       (strcmp( funcInfo->group, "Price Transform" ) == 0) )
+      return 1;
+
+   low  = 0;
+   high = (int)(sizeof(TA_WindowFuncNames)/sizeof(char *))-1;
+   while( low <= high )
+   {
+      mid = (low+high)/2;
+      cmp = strcmp( funcInfo->name, TA_WindowFuncNames[mid] );
+      if( cmp == 0 )
+         return 1;
+      if( cmp < 0 )
+         high = mid-1;
+      else
+         low = mid+1;
+   }
+
+   return 0;
+}
+
+/* Call the function, from the series index when possible. */
+static TA_RetCode callFunction( const TA_ParamHolderPriv *params,
+                                TA_Integer  startIdx,
+                                TA_Integer  endIdx,
+                                TA_Integer *outBegIdx,
+                                TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   const TA_FuncDef *funcDef;
+
+   funcDef = (const TA_FuncDef *)params->funcInfo->handle;
+
+   if( params->in[0].index )
+   {
+      retCode = callFrame( funcDef, TA_SeriesIndexCall, params,
+                           startIdx, endIdx, outBegIdx, outNbElement );
+      if( retCode != TA_NOT_SUPPORTED )
+         return retCode;
+   }
+
+   return callFrame( funcDef, funcDef->function, params,
+                     startIdx, endIdx, outBegIdx, outNbElement );
+}
+
+/* Call a frame function, accounting the calculation to the
+ * statistics of funcDef when these are enabled. The frame
+ * function of funcDef calls the TA function, which accounts
+ * itself.
+ */
+static TA_RetCode callFrame( const TA_FuncDef *funcDef,
+                             TA_FrameFunction function,
+                             const TA_ParamHolderPriv *params,
+                             TA_Integer  startIdx,
+                             TA_Integer  endIdx,
+                             TA_Integer *outBegIdx,
+                             TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_StatsCall statsCall;
+
+   if( !TA_Globals->statsEnabled || (function == funcDef->function) )
+      return (*function)( params, startIdx, endIdx, outBegIdx, outNbElement );
+
+   TA_StatsCallBegin( &statsCall );
+   retCode = (*function)( params, startIdx, endIdx, outBegIdx, outNbElement );
+
+   /* A series index not supporting the function did nothing. */
+   if( retCode != TA_NOT_SUPPORTED )
+      TA_StatsCallEnd( funcDef->stats, &statsCall, endIdx-startIdx+1 );
+
+   return retCode;
+}
+
+/* Call the function with the output at the same index as the input.
+ *
+ * The output pointers are moved to where the first output will be
+ * (known from the lookback) so the function directly writes at the
+ * right place, then the range without output is filled with NaN.
+ *
+ * With a result cache, the output is taken from the cache the same
+ * way (the cache entries are shared with the calls not aligned).
+ */
+static TA_RetCode callAligned( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_ParamHolderPriv alignedParams;
+   TA_ParamHolderOutput alignedOutput[TA_MAX_NB_OUTPUT];
+   const TA_FuncDef *funcDef;
+   TA_Integer lookback, begIdx, padEndIdx, i;
+   unsigned int j, nbOutput;
+   TA_Real nan;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   nbOutput = params->funcInfo->nbOutput;
+   if( nbOutput > TA_MAX_NB_OUTPUT )
+      return TA_INTERNAL_ERROR(3);
+
+   /* A negative lookback is for invalid optional inputs, the
+    * function will return the error without writing anything.
+    */
+   funcDef  = (const TA_FuncDef *)params->funcInfo->handle;
+   lookback = (TA_Integer)(*funcDef->lookback)( params );
+   begIdx   = (startIdx > lookback)? startIdx : lookback;
+   if( begIdx > endIdx )
+      begIdx = endIdx;
+
+   alignedParams = *params;
+   alignedParams.out = alignedOutput;
+   alignedParams.alignedOutput = 0;
+   for( j=0; j < nbOutput; j++ )
+   {
+      alignedOutput[j] = params->out[j];
+      if( alignedOutput[j].outputInfo->type == TA_Output_Integer )
+         alignedOutput[j].data.outInteger += begIdx;
+      else
+         alignedOutput[j].data.outReal += begIdx;
+   }
+
+   if( params->cache )
+      retCode = TA_ResultCacheCall( &alignedParams, startIdx, endIdx,
+                                    outBegIdx, outNbElement );
+   else
+      retCode = callFunction( &alignedParams, startIdx, endIdx,
+                              outBegIdx, outNbElement );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( *outNbElement == 0 )
+      padEndIdx = endIdx+1;
+   else
+   {
+      padEndIdx = *outBegIdx;
+
+      /* Should not happen: the lookback is verified to
+       * always match the outBegIdx by the regression tests.
+       */
+      if( *outBegIdx != begIdx )
+      {
+         for( j=0; j < nbOutput; j++ )
+         {
+            if( params->out[j].outputInfo->type == TA_Output_Integer )
+               memmove( &params->out[j].data.outInteger[*outBegIdx],
+                        &params->out[j].data.outInteger[begIdx],
+                        (*outNbElement)*sizeof(TA_Integer) );
+            else
+               memmove( &params->out[j].data.outReal[*outBegIdx],
+                        &params->out[j].data.outReal[begIdx],
+                        (*outNbElement)*sizeof(TA_Real) );
+         }
+      }
+   }
+
+   /* Fill the lookback with NaN (or TA_INTEGER_DEFAULT). */
+   nan = TA_GetNaN();
+   for( j=0; j < nbOutput; j++ )
+   {
+      if( params->out[j].outputInfo->type == TA_Output_Integer )
+      {
+         for( i=startIdx; i < padEndIdx; i++ )
+            params->out[j].data.outInteger[i] = TA_INTEGER_DEFAULT;
+      }
+      else
+      {
+         for( i=startIdx; i < padEndIdx; i++ )
+            params->out[j].data.outReal[i] = nan;
+      }
+   }
+
+   return TA_SUCCESS;
+}
+
+/* Calculate the function in a TA_Integer scratch buffer and
+ * store the compact outputs from it (see TA_SetOutputParamInt8Ptr).
+ *
+ * When the output does not depend on where the calculation starts,
+ * this is done in chunks of TA_COMPACT_CHUNK elements, else (or with
+ * a result cache) the whole range is calculated at once.
+ */
+static TA_RetCode callCompact( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_ParamHolderPriv chunkParams;
+   TA_ParamHolderOutput chunkOutput[TA_MAX_NB_OUTPUT];
+   TA_Real *scratch;
+   TA_Integer chunkSize, chunkStart, chunkEnd;
+   TA_Integer chunkBegIdx, chunkNbElement, outIdx, padEndIdx;
+   unsigned int j, nbOutput;
+
+   *outBegIdx = 0;
+   *outNbElement = 0;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   nbOutput = params->funcInfo->nbOutput;
+   if( nbOutput > TA_MAX_NB_OUTPUT )
+      return TA_INTERNAL_ERROR(188);
+
+   chunkSize = endIdx-startIdx+1;
+   if( !params->cache && TA_IsWindowFunc( params->funcInfo ) &&
+       (chunkSize > TA_COMPACT_CHUNK) )
+      chunkSize = TA_COMPACT_CHUNK;
+
+   scratch = (TA_Real *)TA_Malloc( nbOutput*chunkSize*sizeof(TA_Real) );
+   if( !scratch )
+      return TA_ALLOC_ERR;
+
+   /* All the outputs of the chunks are in the scratch buffer. */
+   chunkParams = *params;
+   chunkParams.out = chunkOutput;
+   chunkParams.compactBitmap = 0;
+   chunkParams.alignedOutput = 0;
+   for( j=0; j < nbOutput; j++ )
+   {
+      chunkOutput[j] = params->out[j];
+      chunkOutput[j].compactType = TA_Compact_None;
+      if( chunkOutput[j].outputInfo->type == TA_Output_Integer )
+         chunkOutput[j].data.outInteger = (TA_Integer *)&scratch[j*chunkSize];
+      else
+         chunkOutput[j].data.outReal = &scratch[j*chunkSize];
+   }
+
+   retCode = TA_SUCCESS;
+   for( chunkStart=startIdx; chunkStart <= endIdx; chunkStart += chunkSize )
+   {
+      chunkEnd = chunkStart+chunkSize-1;
+      if( chunkEnd > endIdx )
+         chunkEnd = endIdx;
+
+      if( params->cache )
+         retCode = TA_ResultCacheCall( &chunkParams, chunkStart, chunkEnd,
+                                       &chunkBegIdx, &chunkNbElement );
+      else
+         retCode = callFunction( &chunkParams, chunkStart, chunkEnd,
+                                 &chunkBegIdx, &chunkNbElement );
+      if( retCode != TA_SUCCESS )
+         break;
+
+      if( chunkNbElement == 0 )
+         continue;
+
+      if( *outNbElement == 0 )
+         *outBegIdx = chunkBegIdx;
+      else if( chunkBegIdx != *outBegIdx+*outNbElement )
+      {
+         retCode = TA_INTERNAL_ERROR(183);
+         break;
+      }
+
+      outIdx = params->alignedOutput? chunkBegIdx : *outNbElement;
+      for( j=0; j < nbOutput; j++ )
+         storeOutput( &params->out[j], &chunkOutput[j], outIdx, chunkNbElement );
+      *outNbElement += chunkNbElement;
+   }
+
+   TA_Free( scratch );
+
+   if( retCode != TA_SUCCESS )
+   {
+      *outBegIdx = 0;
+      *outNbElement = 0;
+      return retCode;
+   }
+
+   /* Same as callAligned for the elements without a value. */
+   if( params->alignedOutput )
+   {
+      padEndIdx = (*outNbElement == 0)? endIdx+1 : *outBegIdx;
+      for( j=0; j < nbOutput; j++ )
+         padOutput( &params->out[j], startIdx, padEndIdx-1 );
+   }
+
+   return TA_SUCCESS;
+}
+
+/* Store nbElement outputs of a chunk at outIdx of the caller output. */
+static void storeOutput( const TA_ParamHolderOutput *output,
+                         const TA_ParamHolderOutput *chunkOutput,
+                         TA_Integer outIdx,
+                         TA_Integer nbElement )
+{
+   const TA_Integer *in;
+   signed char *outInt8;
+   unsigned char *outBit;
+   unsigned char mask;
+   TA_Integer i, value;
+
+   in = chunkOutput->data.outInteger;
+
+   switch( output->compactType )
+   {
+   case TA_Compact_Int8:
+      outInt8 = (signed char *)output->compactOut+outIdx;
+      for( i=0; i < nbElement; i++ )
+      {
+         value = in[i];
+         if( value == TA_INTEGER_DEFAULT )
+            outInt8[i] = TA_INT8_DEFAULT;
+         else
+            outInt8[i] = (signed char)(value/output->int8Divisor);
+      }
+      break;
+
+   case TA_Compact_Bit:
+      outBit = (unsigned char *)output->compactOut;
+      for( i=0; i < nbElement; i++ )
+      {
+         mask = (unsigned char)(1<<((outIdx+i)&7));
+         if( in[i] != 0 )
+            outBit[(outIdx+i)>>3] |= mask;
+         else
+            outBit[(outIdx+i)>>3] &= (unsigned char)~mask;
+      }
+      break;
+
+   default:
+      if( output->outputInfo->type == TA_Output_Integer )
+         memcpy( &output->data.outInteger[outIdx], in,
+                 nbElement*sizeof(TA_Integer) );
+      else
+         memcpy( &output->data.outReal[outIdx], chunkOutput->data.outReal,
+                 nbElement*sizeof(TA_Real) );
+      break;
+   }
+}
+
+/* Set the elements from startIdx to endIdx to "no value". */
+static void padOutput( const TA_ParamHolderOutput *output,
+                       TA_Integer startIdx,
+                       TA_Integer endIdx )
+{
+   unsigned char *outBit;
+   TA_Integer i;
+   TA_Real nan;
+
+   switch( output->compactType )
+   {
+   case TA_Compact_Int8:
+      for( i=startIdx; i <= endIdx; i++ )
+         ((signed char *)output->compactOut)[i] = TA_INT8_DEFAULT;
+      break;
+
+   case TA_Compact_Bit:
+      outBit = (unsigned char *)output->compactOut;
+      for( i=startIdx; i <= endIdx; i++ )
+         outBit[i>>3] &= (unsigned char)~(1<<(i&7));
+      break;
+
+   default:
+      nan = TA_GetNaN();
+      for( i=startIdx; i <= endIdx; i++ )
+      {
+         if( output->outputInfo->type == TA_Output_Integer )
+            output->data.outInteger[i] = TA_INTEGER_DEFAULT;
+         else
+            output->data.outReal[i] = nan;
+      }
+      break;
+   }
+}
+
+/* Common to TA_SetOutputParamInt8Ptr and TA_SetOutputParamBitPtr. */
+static TA_RetCode setOutputCompact( TA_ParamHolder *param,
+                                    unsigned int paramIndex,
+                                    TA_CompactType compactType,
+                                    void *out )
+{
+   TA_ParamHolderPriv *paramHolderPriv;
+   const TA_OutputParameterInfo *paramInfo;
+   const TA_FuncInfo *funcInfo;
+
+   if( (param == NULL) || (out == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Make sure this index really exist. */
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+
+   if( paramIndex >= funcInfo->nbOutput )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   /* Only the integer outputs can be compacted. */
+   paramInfo = paramHolderPriv->out[paramIndex].outputInfo;
+   if( !paramInfo ) return TA_INTERNAL_ERROR(2);
+   if( paramInfo->type != TA_Output_Integer )
+   {
+      return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   /* The int8 must keep all the values distinct. */
+   if( compactType == TA_Compact_Int8 )
+   {
+      paramHolderPriv->out[paramIndex].int8Divisor = getInt8Divisor( funcInfo );
+      if( paramHolderPriv->out[paramIndex].int8Divisor == 0 )
+         return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   paramHolderPriv->out[paramIndex].data.outInteger = NULL;
+   paramHolderPriv->out[paramIndex].compactType = compactType;
+   paramHolderPriv->out[paramIndex].compactOut  = out;
+   paramHolderPriv->compactBitmap |= (1<<paramIndex);
+
+   /* This parameter is now initialized, clear the corresponding bit. */
+   paramHolderPriv->outBitmap &= ~(1<<paramIndex);
+
+   return TA_SUCCESS;
+}
+
+/* Divisor of the values stored as int8, or zero when the
+ * values of the function do not fit in an int8.
+ */
+static int getInt8Divisor( const TA_FuncInfo *funcInfo )
+{
+   unsigned int i;
+
+   if( strcmp( funcInfo->group, "Pattern Recognition" ) == 0 )
+   {
+      /* The strength of the pattern, +/-100 or +/-200 when confirmed. */
+      if( (strcmp( funcInfo->name, "CDLHIKKAKE"    ) == 0) ||
+          (strcmp( funcInfo->name, "CDLHIKKAKEMOD" ) == 0) )
+         return 100;
+      return 1;
+   }
+
+   for( i=0; i < sizeof(TA_Int8FuncNames)/sizeof(char *); i++ )
+   {
+      if( strcmp( funcInfo->name, TA_Int8FuncNames[i] ) == 0 )
+         return 1;
+   }
+
+   return 0;
+}
+
+TA_Real TA_GetNaN( void )
+{
+#ifdef NAN
+   return (TA_Real)NAN;
+#else
+   /* Volatile to avoid the division by zero at compile time. */
+   volatile TA_Real zero = 0.0;
+   return zero/zero;
+#endif
+}
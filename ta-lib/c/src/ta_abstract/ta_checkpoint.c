@@ -0,0 +1,753 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Warm-start checkpoints: save the state of a recursive calculation
+ *   (EMA, Wilder's smoothing) at the last bar and resume it later
+ *   with only the new bars.
+ *
+ *   The resume replicates exactly the arithmetic of the loops of the
+ *   TA functions, so the output is identical to a full recalculation.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_abstract.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+extern const TA_FuncDef TA_DEF_EMA;
+extern const TA_FuncDef TA_DEF_RSI;
+extern const TA_FuncDef TA_DEF_CMO;
+extern const TA_FuncDef TA_DEF_ATR;
+extern const TA_FuncDef TA_DEF_T3;
+extern const TA_FuncDef TA_DEF_ADX;
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Increment when the meaning of the state changes. */
+#define TA_CHECKPOINT_VERSION 2
+
+typedef enum
+{
+   TA_CHECKPOINT_EMA,
+   TA_CHECKPOINT_RSI,
+   TA_CHECKPOINT_CMO,
+   TA_CHECKPOINT_ATR,
+   TA_CHECKPOINT_T3,
+   TA_CHECKPOINT_ADX
+} TA_CheckpointType;
+
+/* Content of TA_Checkpoint. Copied with memcpy since the
+ * bytes of the caller may not be aligned.
+ *
+ * The header (magicNumber, version and size) stays first in all
+ * the versions, so that a checkpoint saved by another version of
+ * the library, or by a build with another layout, is rejected.
+ *
+ * optInReal is the volume factor of T3, zero for the others.
+ *
+ * state[] is:
+ *   EMA: previous EMA.
+ *   RSI/CMO: previous value, average gain, average loss.
+ *   ATR: previous ATR, previous close.
+ *   T3: the 6 chained EMAs.
+ *   ADX: see TA_AdxState.
+ */
+typedef struct
+{
+   unsigned int magicNumber;
+   unsigned int version;
+   unsigned int size;
+   TA_Integer   nbState;
+   char         funcName[16];
+   TA_Integer   period;
+   TA_Real      optInReal;
+   TA_Real      state[8];
+} TA_CheckpointPriv;
+
+/* Fails to compile when TA_CheckpointPriv does not fit in a TA_Checkpoint. */
+typedef char TA_CheckpointSizeCheck[(sizeof(TA_CheckpointPriv) <= TA_CHECKPOINT_SIZE)? 1 : -1];
+
+/* State of ADX, in this order in state[]. */
+typedef struct
+{
+   TA_Real prevHigh;
+   TA_Real prevLow;
+   TA_Real prevClose;
+   TA_Real prevMinusDM;
+   TA_Real prevPlusDM;
+   TA_Real prevTR;
+   TA_Real prevADX;
+} TA_AdxState;
+
+#define ADX_NB_STATE (sizeof(TA_AdxState)/sizeof(TA_Real))
+#define T3_NB_STATE  6
+
+/**** Local functions declarations.    ****/
+static TA_RetCode getCheckpointType( const TA_ParamHolder *param,
+                                     const TA_ParamHolderPriv **params,
+                                     TA_CheckpointType *type );
+
+static TA_Real gainLossOutput( TA_CheckpointType type,
+                               TA_Real prevGain, TA_Real prevLoss );
+
+static void t3State( TA_Integer period, const TA_Real *inReal,
+                     TA_Integer first, TA_Integer last, TA_Real *e );
+
+static TA_Real t3Output( const TA_Real *e, TA_Real vFactor );
+
+static void adxState( TA_Integer period,
+                      const TA_Real *inHigh, const TA_Real *inLow, const TA_Real *inClose,
+                      TA_Integer first, TA_Integer last, TA_AdxState *s );
+
+static void adxNext( TA_AdxState *s, TA_Integer period,
+                     TA_Real high, TA_Real low, TA_Real close );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_CallFuncCheckpoint( const TA_ParamHolder *param,
+                                  TA_Integer            startIdx,
+                                  TA_Integer            endIdx,
+                                  TA_Integer           *outBegIdx,
+                                  TA_Integer           *outNbElement,
+                                  TA_Checkpoint        *checkpoint )
+{
+   const TA_ParamHolderPriv *params;
+   TA_CheckpointType type;
+   TA_CheckpointPriv priv;
+   TA_RetCode retCode;
+   TA_Integer lookback, period, today, i;
+   const TA_Real *inReal;
+   TA_Real prevValue, prevGain, prevLoss, prevClose, tempValue1, tempValue2;
+   TA_Real lastOutput, optInReal;
+   TA_Real e[T3_NB_STATE];
+   TA_AdxState adx;
+
+   if( !checkpoint || !outBegIdx || !outNbElement )
+      return TA_BAD_PARAM;
+
+   retCode = getCheckpointType( param, &params, &type );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( (startIdx < 0) || (endIdx < startIdx) )
+      return TA_BAD_PARAM;
+
+   retCode = TA_GetLookback( param, &lookback );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+   if( lookback < 0 )
+      return TA_BAD_PARAM;
+
+   period = params->optIn[0].data.optInInteger;
+   optInReal = (type == TA_CHECKPOINT_T3)? params->optIn[1].data.optInReal : 0.0;
+   memset( &priv, 0, sizeof(priv) );
+   prevValue = prevGain = prevLoss = prevClose = 0.0;
+
+   /* Whatever is needed from the inputs is taken before the call,
+    * because the output may be the same buffer as an input.
+    */
+   if( startIdx < lookback )
+      startIdx = lookback;
+
+   switch( type )
+   {
+   case TA_CHECKPOINT_RSI:
+   case TA_CHECKPOINT_CMO:
+      /* Same initialization as the classic RSI/CMO (the first output
+       * particular to Metastock does not change the state).
+       */
+      inReal = params->in[0].data.inReal;
+      today = startIdx-lookback;
+      if( today+period > endIdx )
+         return TA_OUT_OF_RANGE_END_INDEX;
+
+      prevValue = inReal[today++];
+      for( i=period; i > 0; i-- )
+      {
+         tempValue1 = inReal[today++];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+      }
+      prevLoss /= period;
+      prevGain /= period;
+
+      while( today <= endIdx )
+      {
+         tempValue1 = inReal[today++];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+
+         prevLoss *= (period-1);
+         prevGain *= (period-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+
+         prevLoss /= period;
+         prevGain /= period;
+      }
+      break;
+
+   case TA_CHECKPOINT_ATR:
+      if( startIdx > endIdx )
+         return TA_OUT_OF_RANGE_END_INDEX;
+      prevClose = params->in[0].data.inPrice.close[endIdx];
+      break;
+
+   case TA_CHECKPOINT_EMA:
+      if( startIdx > endIdx )
+         return TA_OUT_OF_RANGE_END_INDEX;
+      break;
+
+   case TA_CHECKPOINT_T3:
+      if( startIdx > endIdx )
+         return TA_OUT_OF_RANGE_END_INDEX;
+      t3State( period, params->in[0].data.inReal, startIdx-lookback, endIdx, e );
+      break;
+
+   case TA_CHECKPOINT_ADX:
+      if( startIdx > endIdx )
+         return TA_OUT_OF_RANGE_END_INDEX;
+      adxState( period,
+                params->in[0].data.inPrice.high,
+                params->in[0].data.inPrice.low,
+                params->in[0].data.inPrice.close,
+                startIdx-lookback, endIdx, &adx );
+      break;
+   }
+
+   retCode = TA_CallFunc( param, startIdx, endIdx, outBegIdx, outNbElement );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   if( (*outNbElement <= 0) || (*outBegIdx+*outNbElement-1 != endIdx) )
+      return TA_INTERNAL_ERROR(184);
+
+   if( params->alignedOutput )
+      lastOutput = params->out[0].data.outReal[endIdx];
+   else
+      lastOutput = params->out[0].data.outReal[*outNbElement-1];
+
+   /* For the functions with a state replicated here, the state
+    * must give back the last output.
+    */
+   switch( type )
+   {
+   case TA_CHECKPOINT_EMA:
+      priv.nbState  = 1;
+      priv.state[0] = lastOutput;
+      break;
+
+   case TA_CHECKPOINT_RSI:
+   case TA_CHECKPOINT_CMO:
+      if( gainLossOutput( type, prevGain, prevLoss ) != lastOutput )
+         return TA_INTERNAL_ERROR(185);
+      priv.nbState  = 3;
+      priv.state[0] = prevValue;
+      priv.state[1] = prevGain;
+      priv.state[2] = prevLoss;
+      break;
+
+   case TA_CHECKPOINT_ATR:
+      priv.nbState  = 2;
+      priv.state[0] = lastOutput;
+      priv.state[1] = prevClose;
+      break;
+
+   case TA_CHECKPOINT_T3:
+      if( t3Output( e, optInReal ) != lastOutput )
+         return TA_INTERNAL_ERROR(186);
+      priv.nbState = T3_NB_STATE;
+      memcpy( priv.state, e, sizeof(e) );
+      break;
+
+   case TA_CHECKPOINT_ADX:
+      if( adx.prevADX != lastOutput )
+         return TA_INTERNAL_ERROR(187);
+      priv.nbState = ADX_NB_STATE;
+      memcpy( priv.state, &adx, sizeof(adx) );
+      break;
+   }
+
+   priv.magicNumber = TA_CHECKPOINT_MAGIC_NB;
+   priv.version     = TA_CHECKPOINT_VERSION;
+   priv.size        = sizeof(priv);
+   strncpy( priv.funcName, params->funcInfo->name, sizeof(priv.funcName)-1 );
+   priv.period      = period;
+   priv.optInReal   = optInReal;
+
+   memset( checkpoint, 0, sizeof(TA_Checkpoint) );
+   memcpy( checkpoint->data, &priv, sizeof(priv) );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallFuncResume( const TA_ParamHolder *param,
+                              const TA_Checkpoint  *from,
+                              TA_Integer            nbBar,
+                              TA_Integer           *outNbElement,
+                              TA_Checkpoint        *to )
+{
+   const TA_ParamHolderPriv *params;
+   TA_CheckpointType type;
+   TA_CheckpointPriv priv;
+   TA_RetCode retCode;
+   TA_Integer period, today;
+   const TA_Real *inReal, *inHigh, *inLow, *inClose;
+   TA_Real *outReal;
+   TA_Real prevValue, prevGain, prevLoss, prevATR, prevClose, prevMA, optInK_1;
+   TA_Real tempValue1, tempValue2, tempLT, tempHT, tempCY, greatest, val2, val3;
+   TA_Real optInReal, k, one_minus_k;
+   TA_Real e[T3_NB_STATE];
+   TA_AdxState adx;
+
+   if( !from || !to || !outNbElement || (nbBar < 0) )
+      return TA_BAD_PARAM;
+
+   *outNbElement = 0;
+
+   retCode = getCheckpointType( param, &params, &type );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Verify that the checkpoint is from this version and for
+    * this function and optional inputs.
+    */
+   memcpy( &priv, from->data, sizeof(priv) );
+   period = params->optIn[0].data.optInInteger;
+   optInReal = (type == TA_CHECKPOINT_T3)? params->optIn[1].data.optInReal : 0.0;
+   if( (priv.magicNumber != TA_CHECKPOINT_MAGIC_NB) ||
+       (priv.version != TA_CHECKPOINT_VERSION) ||
+       (priv.size != sizeof(priv)) ||
+       (priv.funcName[sizeof(priv.funcName)-1] != '\0') ||
+       (strcmp( priv.funcName, params->funcInfo->name ) != 0) ||
+       (priv.period != period) ||
+       (priv.optInReal != optInReal) )
+      return TA_BAD_PARAM;
+
+   /* There is one output per new bar, at the same index (so the
+    * aligned and default output are the same). Each input is read
+    * before its output is written, so the output can be the
+    * same buffer as an input.
+    */
+   outReal = params->out[0].data.outReal;
+
+   switch( type )
+   {
+   case TA_CHECKPOINT_EMA:
+      inReal   = params->in[0].data.inReal;
+      optInK_1 = PER_TO_K( period );
+      prevMA   = priv.state[0];
+      for( today=0; today < nbBar; today++ )
+      {
+         prevMA = ((inReal[today]-prevMA)*optInK_1) + prevMA;
+         outReal[today] = prevMA;
+      }
+      priv.state[0] = prevMA;
+      break;
+
+   case TA_CHECKPOINT_RSI:
+   case TA_CHECKPOINT_CMO:
+      inReal    = params->in[0].data.inReal;
+      prevValue = priv.state[0];
+      prevGain  = priv.state[1];
+      prevLoss  = priv.state[2];
+      for( today=0; today < nbBar; today++ )
+      {
+         tempValue1 = inReal[today];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+
+         prevLoss *= (period-1);
+         prevGain *= (period-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+
+         prevLoss /= period;
+         prevGain /= period;
+         outReal[today] = gainLossOutput( type, prevGain, prevLoss );
+      }
+      priv.state[0] = prevValue;
+      priv.state[1] = prevGain;
+      priv.state[2] = prevLoss;
+      break;
+
+   case TA_CHECKPOINT_ATR:
+      inHigh    = params->in[0].data.inPrice.high;
+      inLow     = params->in[0].data.inPrice.low;
+      inClose   = params->in[0].data.inPrice.close;
+      prevATR   = priv.state[0];
+      prevClose = priv.state[1];
+      for( today=0; today < nbBar; today++ )
+      {
+         /* Same as TRANGE. */
+         tempLT = inLow[today];
+         tempHT = inHigh[today];
+         tempCY = prevClose;
+         prevClose = inClose[today];
+         greatest = tempHT - tempLT;
+
+         val2 = std_fabs( tempCY - tempHT );
+         if( val2 > greatest )
+            greatest = val2;
+
+         val3 = std_fabs( tempCY - tempLT  );
+         if( val3 > greatest )
+            greatest = val3;
+
+         /* Wilder's smoothing, none for a period of 1. */
+         if( period <= 1 )
+            prevATR = greatest;
+         else
+         {
+            prevATR *= period - 1;
+            prevATR += greatest;
+            prevATR /= period;
+         }
+         outReal[today] = prevATR;
+      }
+      priv.state[0] = prevATR;
+      priv.state[1] = prevClose;
+      break;
+
+   case TA_CHECKPOINT_T3:
+      inReal = params->in[0].data.inReal;
+      memcpy( e, priv.state, sizeof(e) );
+      k = 2.0/(period+1.0);
+      one_minus_k = 1.0-k;
+      for( today=0; today < nbBar; today++ )
+      {
+         e[0] = (k*inReal[today])+(one_minus_k*e[0]);
+         e[1] = (k*e[0])+(one_minus_k*e[1]);
+         e[2] = (k*e[1])+(one_minus_k*e[2]);
+         e[3] = (k*e[2])+(one_minus_k*e[3]);
+         e[4] = (k*e[3])+(one_minus_k*e[4]);
+         e[5] = (k*e[4])+(one_minus_k*e[5]);
+         outReal[today] = t3Output( e, optInReal );
+      }
+      memcpy( priv.state, e, sizeof(e) );
+      break;
+
+   case TA_CHECKPOINT_ADX:
+      inHigh  = params->in[0].data.inPrice.high;
+      inLow   = params->in[0].data.inPrice.low;
+      inClose = params->in[0].data.inPrice.close;
+      memcpy( &adx, priv.state, sizeof(adx) );
+      for( today=0; today < nbBar; today++ )
+      {
+         adxNext( &adx, period, inHigh[today], inLow[today], inClose[today] );
+         outReal[today] = adx.prevADX;
+      }
+      memcpy( priv.state, &adx, sizeof(adx) );
+      break;
+   }
+
+   memcpy( to->data, &priv, sizeof(priv) );
+   *outNbElement = nbBar;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode getCheckpointType( const TA_ParamHolder *param,
+                                     const TA_ParamHolderPriv **params,
+                                     TA_CheckpointType *type )
+{
+   const TA_ParamHolderPriv *paramHolderPriv;
+   const TA_FuncDef *funcDef;
+
+   if( param == NULL )
+      return TA_BAD_PARAM;
+
+   paramHolderPriv = (const TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   if( paramHolderPriv->inBitmap != 0 )
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+
+   if( paramHolderPriv->outBitmap != 0 )
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+
+   funcDef = (const TA_FuncDef *)paramHolderPriv->funcInfo->handle;
+   if( funcDef == &TA_DEF_EMA )
+      *type = TA_CHECKPOINT_EMA;
+   else if( funcDef == &TA_DEF_RSI )
+      *type = TA_CHECKPOINT_RSI;
+   else if( funcDef == &TA_DEF_CMO )
+      *type = TA_CHECKPOINT_CMO;
+   else if( funcDef == &TA_DEF_ATR )
+      *type = TA_CHECKPOINT_ATR;
+   else if( funcDef == &TA_DEF_T3 )
+      *type = TA_CHECKPOINT_T3;
+   else if( funcDef == &TA_DEF_ADX )
+      *type = TA_CHECKPOINT_ADX;
+   else
+      return TA_NOT_SUPPORTED;
+
+   *params = paramHolderPriv;
+
+   return TA_SUCCESS;
+}
+
+/* Output of RSI or CMO from the smoothed gain and loss. */
+static TA_Real gainLossOutput( TA_CheckpointType type,
+                               TA_Real prevGain, TA_Real prevLoss )
+{
+   TA_Real tempValue1;
+
+   tempValue1 = prevGain+prevLoss;
+   if( TA_IS_ZERO(tempValue1) )
+      return 0.0;
+
+   if( type == TA_CHECKPOINT_CMO )
+      return 100.0*((prevGain-prevLoss)/tempValue1);
+
+   return 100.0*(prevGain/tempValue1);
+}
+
+/* The 6 chained EMAs of T3 at 'last', initialized from 'first'
+ * (same as TA_T3: each EMA starts with the average of the first
+ * values of the previous one).
+ */
+static void t3State( TA_Integer period, const TA_Real *inReal,
+                     TA_Integer first, TA_Integer last, TA_Real *e )
+{
+   TA_Integer today, i, j, m;
+   TA_Real k, one_minus_k, tempReal;
+
+   k = 2.0/(period+1.0);
+   one_minus_k = 1.0-k;
+   today = first;
+
+   tempReal = inReal[today++];
+   for( i=period-1; i > 0 ; i-- )
+      tempReal += inReal[today++];
+   e[0] = tempReal / period;
+
+   for( j=1; j < T3_NB_STATE; j++ )
+   {
+      tempReal = e[j-1];
+      for( i=period-1; i > 0 ; i-- )
+      {
+         e[0] = (k*inReal[today++])+(one_minus_k*e[0]);
+         for( m=1; m < j; m++ )
+            e[m] = (k*e[m-1])+(one_minus_k*e[m]);
+         tempReal += e[j-1];
+      }
+      e[j] = tempReal / period;
+   }
+
+   while( today <= last )
+   {
+      e[0] = (k*inReal[today++])+(one_minus_k*e[0]);
+      for( m=1; m < T3_NB_STATE; m++ )
+         e[m] = (k*e[m-1])+(one_minus_k*e[m]);
+   }
+}
+
+/* Output of T3 from its 6 EMAs. */
+static TA_Real t3Output( const TA_Real *e, TA_Real vFactor )
+{
+   TA_Real c1, c2, c3, c4, tempReal;
+
+   tempReal = vFactor * vFactor;
+   c1 = -(tempReal * vFactor);
+   c2 = 3.0 * (tempReal - c1);
+   c3 = -6.0 * tempReal - 3.0 * (vFactor-c1);
+   c4 = 1.0 + 3.0 * vFactor - c1 + 3.0 * tempReal;
+
+   return c1*e[5]+c2*e[4]+c3*e[3]+c4*e[2];
+}
+
+/* Same as TRANGE, as calculated by TA_ADX. */
+#define TRUE_RANGE(TH,TL,YC,OUT) {\
+   OUT = TH-TL; \
+   tempReal2 = std_fabs(TH-YC); \
+   if( tempReal2 > OUT ) \
+      OUT = tempReal2; \
+   tempReal2 = std_fabs(TL-YC); \
+   if( tempReal2 > OUT ) \
+      OUT = tempReal2; \
+}
+
+/* State of ADX at 'last', initialized from 'first' (same as TA_ADX:
+ * sums of the first DM and TR, then the average of the first DX).
+ */
+static void adxState( TA_Integer period,
+                      const TA_Real *inHigh, const TA_Real *inLow, const TA_Real *inClose,
+                      TA_Integer first, TA_Integer last, TA_AdxState *s )
+{
+   TA_Integer today, i;
+   TA_Real tempReal, tempReal2, diffP, diffM, minusDI, plusDI, sumDX;
+
+   s->prevMinusDM = 0.0;
+   s->prevPlusDM  = 0.0;
+   s->prevTR      = 0.0;
+   today          = first;
+   s->prevHigh    = inHigh[today];
+   s->prevLow     = inLow[today];
+   s->prevClose   = inClose[today];
+   i              = period-1;
+   while( i-- > 0 )
+   {
+      today++;
+      tempReal    = inHigh[today];
+      diffP       = tempReal-s->prevHigh;
+      s->prevHigh = tempReal;
+
+      tempReal    = inLow[today];
+      diffM       = s->prevLow-tempReal;
+      s->prevLow  = tempReal;
+
+      if( (diffM > 0) && (diffP < diffM) )
+         s->prevMinusDM += diffM;
+      else if( (diffP > 0) && (diffP > diffM) )
+         s->prevPlusDM += diffP;
+
+      TRUE_RANGE(s->prevHigh,s->prevLow,s->prevClose,tempReal);
+      s->prevTR += tempReal;
+      s->prevClose = inClose[today];
+   }
+
+   sumDX = 0.0;
+   i = period;
+   while( i-- > 0 )
+   {
+      today++;
+      tempReal    = inHigh[today];
+      diffP       = tempReal-s->prevHigh;
+      s->prevHigh = tempReal;
+
+      tempReal    = inLow[today];
+      diffM       = s->prevLow-tempReal;
+      s->prevLow  = tempReal;
+
+      s->prevMinusDM -= s->prevMinusDM/period;
+      s->prevPlusDM  -= s->prevPlusDM/period;
+
+      if( (diffM > 0) && (diffP < diffM) )
+         s->prevMinusDM += diffM;
+      else if( (diffP > 0) && (diffP > diffM) )
+         s->prevPlusDM += diffP;
+
+      TRUE_RANGE(s->prevHigh,s->prevLow,s->prevClose,tempReal);
+      s->prevTR = s->prevTR - (s->prevTR/period) + tempReal;
+      s->prevClose = inClose[today];
+
+      if( !TA_IS_ZERO(s->prevTR) )
+      {
+         minusDI  = 100.0*(s->prevMinusDM/s->prevTR);
+         plusDI   = 100.0*(s->prevPlusDM/s->prevTR);
+         tempReal = minusDI+plusDI;
+         if( !TA_IS_ZERO(tempReal) )
+            sumDX  += 100.0 * (std_fabs(minusDI-plusDI)/tempReal);
+      }
+   }
+
+   s->prevADX = sumDX / period;
+
+   while( today < last )
+   {
+      today++;
+      adxNext( s, period, inHigh[today], inLow[today], inClose[today] );
+   }
+}
+
+/* One more bar of ADX after its initialization. */
+static void adxNext( TA_AdxState *s, TA_Integer period,
+                     TA_Real high, TA_Real low, TA_Real close )
+{
+   TA_Real tempReal, tempReal2, diffP, diffM, minusDI, plusDI;
+
+   diffP       = high-s->prevHigh;
+   s->prevHigh = high;
+   diffM       = s->prevLow-low;
+   s->prevLow  = low;
+
+   s->prevMinusDM -= s->prevMinusDM/period;
+   s->prevPlusDM  -= s->prevPlusDM/period;
+
+   if( (diffM > 0) && (diffP < diffM) )
+      s->prevMinusDM += diffM;
+   else if( (diffP > 0) && (diffP > diffM) )
+      s->prevPlusDM += diffP;
+
+   TRUE_RANGE(s->prevHigh,s->prevLow,s->prevClose,tempReal);
+   s->prevTR = s->prevTR - (s->prevTR/period) + tempReal;
+   s->prevClose = close;
+
+   if( !TA_IS_ZERO(s->prevTR) )
+   {
+      minusDI  = 100.0*(s->prevMinusDM/s->prevTR);
+      plusDI   = 100.0*(s->prevPlusDM/s->prevTR);
+      tempReal = minusDI+plusDI;
+      if( !TA_IS_ZERO(tempReal) )
+      {
+         tempReal = 100.0*(std_fabs(minusDI-plusDI)/tempReal);
+         s->prevADX = ((s->prevADX*(period-1))+tempReal)/period;
+      }
+   }
+}
@@ -169,10 +169,19 @@ typedef struct
    /* Entry point of the TA function and its lookback function. */
    const TA_FrameFunction function;
    const TA_FrameLookback lookback;
+
+   /* Statistics, updated only when enabled with TA_StatsEnable.
+    * This is TA_STATS_XXX, also updated by the TA function itself.
+    */
+   TA_FuncStats * const stats;
 } TA_FuncDef;
 
 /* The following MACROs are helpers being used in
  * the tables\table<a..z>.c files.
+ *
+ * All TA functions are required to support outputs being the same
+ * buffers as the inputs, consequently TA_FUNC_FLG_INPLACE is always
+ * added to the flags.
  */
 #if !defined( TA_GEN_CODE )
    /* This definition is used when compiling the end-user library. */
@@ -183,6 +192,7 @@ typedef struct
                          flags ) \
    \
    TA_FuncInfo TA_INFO_##name; \
+   TA_FuncStats TA_STATS_##name; \
    \
    const TA_FuncDef TA_DEF_##name = \
    { \
@@ -193,7 +203,8 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       TA_##name##_FramePP, \
-      TA_##name##_FramePPLB \
+      TA_##name##_FramePPLB, \
+      &TA_STATS_##name \
    }; \
    TA_FuncInfo TA_INFO_##name = \
    { \
@@ -201,7 +212,7 @@ typedef struct
       (const char * const)groupId##String, \
       (const char * const)hint, \
       (const char * const)camelCaseName, \
-      (const int)flags, \
+      (const int)(flags|TA_FUNC_FLG_INPLACE), \
       (sizeof(TA_##name##_Inputs)   / sizeof(TA_InputParameterInfo *))   - 1, \
       (sizeof(TA_##name##_OptInputs)/ sizeof(TA_OptInputParameterInfo *))- 1, \
       (sizeof(TA_##name##_Outputs)  / sizeof(TA_OutputParameterInfo *))  - 1, \
@@ -219,6 +230,7 @@ typedef struct
                          flags ) \
    \
    TA_FuncInfo TA_INFO_##name; \
+   static TA_FuncStats TA_STATS_##name; \
    \
    const TA_FuncDef TA_DEF_##name = \
    { \
@@ -229,7 +241,8 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       NULL, \
-      NULL \
+      NULL, \
+      &TA_STATS_##name \
    }; \
    TA_FuncInfo TA_INFO_##name = \
    { \
@@ -237,7 +250,7 @@ typedef struct
       (const char * const)groupId##String, \
       (const char * const)hint, \
       (const char * const)camelCaseName, \
-      (const int)flags, \
+      (const int)(flags|TA_FUNC_FLG_INPLACE), \
       (sizeof(TA_##name##_Inputs)   / sizeof(TA_InputParameterInfo *))   - 1, \
       (sizeof(TA_##name##_OptInputs)/ sizeof(TA_OptInputParameterInfo *))- 1, \
       (sizeof(TA_##name##_Outputs)  / sizeof(TA_OutputParameterInfo *))  - 1, \
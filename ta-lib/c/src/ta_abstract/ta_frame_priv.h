@@ -72,6 +72,9 @@ typedef struct
 
    const TA_InputParameterInfo *inputInfo;
 
+   /* Optional pre-calculated index of the input (see TA_SeriesIndexAlloc). */
+   const TA_SeriesIndex *index;
+
 } TA_ParamHolderInput;
 
 typedef struct
@@ -86,6 +89,13 @@ typedef struct
 
 } TA_ParamHolderOptInput;
 
+typedef enum
+{
+   TA_Compact_None,
+   TA_Compact_Int8,
+   TA_Compact_Bit
+} TA_CompactType;
+
 typedef struct
 {
    union TA_ParamHolderOutputData
@@ -94,6 +104,15 @@ typedef struct
       TA_Integer     *outInteger;
    } data;
 
+   /* Compact storage of an integer output, data is then not used
+    * (see TA_SetOutputParamInt8Ptr and TA_SetOutputParamBitPtr).
+    */
+   TA_CompactType  compactType;
+   void           *compactOut;
+
+   /* The int8 stored is the value divided by this. */
+   int             int8Divisor;
+
    const TA_OutputParameterInfo *outputInfo;
 } TA_ParamHolderOutput;
 
@@ -114,6 +133,17 @@ typedef struct
    unsigned int inBitmap;
    unsigned int outBitmap;
 
+   /* Indicate which outputs have a compact storage (same bit order). */
+   unsigned int compactBitmap;
+
+   /* Output at the same index as the input (see TA_SetOutputAligned). */
+   int alignedOutput;
+
+   /* Result cache and identity of the inputs (see TA_SetParamHolderCache). */
+   TA_ResultCache *cache;
+   UInt64 seriesId;
+   unsigned int seriesVersion;
+
    const TA_FuncInfo *funcInfo;
 } TA_ParamHolderPriv;
 
@@ -125,4 +155,68 @@ typedef TA_RetCode (*TA_FrameFunction)( const TA_ParamHolderPriv *params,
 
 typedef unsigned int (*TA_FrameLookback)( const TA_ParamHolderPriv *params );
 
+/* Pre-calculated index of a series (hidden data of TA_SeriesIndex).
+ *
+ * sum and sumSq are the prefix sums (nbElement+1 elements) of the
+ * values and their squares, after subtracting 'shift' from each
+ * value (the mean of the series). sumLow and sumSqLow are the
+ * rounding errors of these sums, so that the difference between
+ * two prefix sums is as precise as summing the window.
+ *
+ * highest[k] and lowest[k] are sparse tables: element i is the
+ * max/min of the values in the range [i,i+2^k-1]. The level zero
+ * is not needed (all the min/max functions have a period of at
+ * least 2) and is not allocated.
+ */
+#define TA_SERIES_INDEX_MAX_LEVEL 17
+
+typedef struct
+{
+   unsigned int magicNumber;
+
+   const TA_Real *data;
+   TA_Integer     nbElement;
+
+   TA_Real  shift;
+   TA_Real *sum;
+   TA_Real *sumLow;
+   TA_Real *sumSq;
+   TA_Real *sumSqLow;
+
+   unsigned int nbLevel;
+   TA_Real *highest[TA_SERIES_INDEX_MAX_LEVEL];
+   TA_Real *lowest[TA_SERIES_INDEX_MAX_LEVEL];
+} TA_SeriesIndexPriv;
+
+/* Calculate the function from the index attached to its first input.
+ * Return TA_NOT_SUPPORTED when the function cannot be calculated
+ * that way, in which case the normal function must be called.
+ */
+TA_RetCode TA_SeriesIndexCall( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement );
+
+TA_RetCode TA_SeriesIndexCallAtIndices( const TA_ParamHolderPriv *params,
+                                        const TA_Integer *indices,
+                                        TA_Integer  nbIndices,
+                                        TA_Integer *outBegIdx,
+                                        TA_Integer *outNbElement );
+
+/* Non-zero when the output at an index depends only on the inputs
+ * within its lookback window (not on where the calculation starts).
+ */
+int TA_IsWindowFunc( const TA_FuncInfo *funcInfo );
+
+/* NaN used for the outputs without a value. */
+TA_Real TA_GetNaN( void );
+
+/* TA_CallFunc for a param holder with a result cache. */
+TA_RetCode TA_ResultCacheCall( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement );
+
 #endif
@@ -4495,299 +4495,223 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
 ,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
 ,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x44,0x45,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09
-,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x45,0x4D,0x41
-,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x65,0x6D,0x61,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20
-,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76
-,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x43,0x52,0x4F,0x53,0x53,0x4F,0x56,0x45,0x52,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x43,0x52,0x4F,0x53,0x53,0x4F,0x56,0x45,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x43,0x72,0x6F,0x73,0x73,0x4F,0x76,0x65,0x72,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
+,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x65,0x72,0x69,0x65,0x73,0x20,0x30,0x20,0x63,0x72
+,0x6F,0x73,0x73,0x69,0x6E,0x67,0x20,0x61,0x62,0x6F,0x76,0x65,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x20
+,0x31,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65
+,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
 ,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
-,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30
-,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x30,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
 ,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
 ,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
-,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x44,0x49,0x56,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x49,0x56,0x3C,0x2F,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x69,0x76,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68
-,0x6D,0x65,0x74,0x69,0x63,0x20,0x44,0x69,0x76,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
-,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
-,0x6E,0x52,0x65,0x61,0x6C,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
-,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65
+,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x43,0x52,0x4F,0x53,0x53,0x55,0x4E,0x44,0x45
+,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x43,0x52,0x4F,0x53,0x53,0x55,0x4E,0x44,0x45,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x72,0x6F,0x73,0x73,0x55,0x6E,0x64,0x65,0x72,0x3C,0x2F,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x65,0x72,0x69,0x65,0x73,0x20
+,0x30,0x20,0x63,0x72,0x6F,0x73,0x73,0x69,0x6E,0x67,0x20,0x62,0x65,0x6C,0x6F,0x77,0x20,0x73,0x65,0x72
+,0x69,0x65,0x73,0x20,0x31,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68
+,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
+,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61
+,0x6C,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
 ,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
 ,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
 ,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x44,0x58,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x44
-,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x78,0x3C,0x2F,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x69,0x72,0x65,0x63,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x44,0x45,0x4D,0x41,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x44,0x45,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x65
+,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F
+,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C
 ,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
-,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55
-,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67
-,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48
-,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73
-,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20
-,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65
-,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x44,0x49,0x56,0x20,0x2D,0x2D,0x3E,0x0A
+,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x49,0x56
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x69,0x76,0x3C,0x2F,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20
+,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x44,0x69,0x76,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
+,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C
+,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
 ,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x45
-,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x45,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x45,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41
-,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65
-,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
 ,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
 ,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
 ,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
-,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
-,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x45,0x58
-,0x50,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
-,0x6F,0x6E,0x3E,0x45,0x58,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x45
-,0x78,0x70,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56
-,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x45,0x78,0x70
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E
-,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x46,0x4C,0x4F,0x4F,0x52
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x46,0x4C,0x4F,0x4F,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x46,0x6C,0x6F,0x6F,0x72,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x46,0x6C,0x6F,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C
-,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x44,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x44,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x44
+,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x44,0x69
+,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x20,0x49
+,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E
+,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75
+,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
 ,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61
-,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x44,0x43,0x50,0x45,0x52,0x49,0x4F,0x44
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x48,0x54,0x5F,0x44,0x43,0x50,0x45,0x52,0x49,0x4F,0x44,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
-,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
-,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x44,0x63,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74
-,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F,0x6D,0x69,0x6E,0x61,0x6E
-,0x74,0x20,0x43,0x79,0x63,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
-,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20
-,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
-,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
 ,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C
+,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65
+,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
@@ -4799,54 +4723,73 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
 ,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
-,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x44,0x43,0x50,0x48,0x41,0x53,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09
-,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x44
-,0x43,0x50,0x48,0x41,0x53,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48
-,0x74,0x44,0x63,0x50,0x68,0x61,0x73,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x21,0x2D,0x2D,0x20,0x45,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x45,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x45,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
 ,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F
-,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F,0x6D,0x69,0x6E,0x61,0x6E,0x74,0x20,0x43,0x79,0x63,0x6C,0x65,0x20
-,0x50,0x68,0x61,0x73,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C
-,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x50,0x48
-,0x41,0x53,0x4F,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
-,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x50,0x48,0x41,0x53,0x4F,0x52,0x3C,0x2F,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x50,0x68,0x61,0x73,0x6F,0x72,0x3C,0x2F,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74
-,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x50,0x68,0x61,0x73,0x6F,0x72,0x20
-,0x43,0x6F,0x6D,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x73,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47
+,0x74,0x69,0x6F,0x6E,0x3E,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76
+,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47
 ,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
+,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
+,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72
+,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D
+,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21
+,0x2D,0x2D,0x20,0x45,0x58,0x50,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x45,0x58,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x61,0x6D,0x65,0x3E,0x45,0x78,0x70,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69
+,0x63,0x20,0x45,0x78,0x70,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68
+,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
 ,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
 ,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
 ,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
@@ -4859,71 +4802,328 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
 ,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x50,0x68,0x61,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x51,0x75,0x61,0x64,0x72
-,0x61,0x74,0x75,0x72,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68
-,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
 ,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
 ,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
-,0x48,0x54,0x5F,0x53,0x49,0x4E,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x53,0x49,0x4E,0x45,0x3C,0x2F,0x41,0x62
-,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
-,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x53,0x69,0x6E,0x65,0x3C,0x2F,0x43,0x61,0x6D
-,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20
-,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x53,0x69,0x6E,0x65,0x57,0x61,0x76,0x65
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64
-,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73
-,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x53,0x69
-,0x6E,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x46,0x4C,0x4F,0x4F,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x46,0x4C,0x4F,0x4F,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x6C,0x6F,0x6F,0x72,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x46,0x6C,0x6F,0x6F,0x72,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73
+,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
 ,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
 ,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
 ,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
-,0x75,0x74,0x4C,0x65,0x61,0x64,0x53,0x69,0x6E,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
+,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x44,0x43,0x50
+,0x45,0x52,0x49,0x4F,0x44,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x44,0x43,0x50,0x45,0x52,0x49,0x4F,0x44,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x44,0x63,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69
+,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F
+,0x6D,0x69,0x6E,0x61,0x6E,0x74,0x20,0x43,0x79,0x63,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69
+,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74
+,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61
+,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x44,0x43,0x50,0x48,0x41,0x53,0x45,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x48,0x54,0x5F,0x44,0x43,0x50,0x48,0x41,0x53,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x61,0x6D,0x65,0x3E,0x48,0x74,0x44,0x63,0x50,0x68,0x61,0x73,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C
+,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72
+,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x44,0x6F,0x6D,0x69,0x6E,0x61,0x6E,0x74,0x20,0x43
+,0x79,0x63,0x6C,0x65,0x20,0x50,0x68,0x61,0x73,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69
+,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61
+,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x48,0x54,0x5F,0x50,0x48,0x41,0x53,0x4F,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x50,0x48,0x41,0x53,0x4F,0x52
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x50,0x68,0x61,0x73,0x6F
+,0x72,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69
+,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x50,0x68
+,0x61,0x73,0x6F,0x72,0x20,0x43,0x6F,0x6D,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x73,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F
+,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65
+,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
+,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x50,0x68,0x61,0x73,0x65
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x51,0x75,0x61,0x64,0x72,0x61,0x74,0x75,0x72,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
 ,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
 ,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
 ,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
 ,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
 ,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
-,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4C,0x49,0x4E,0x45,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48
-,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4C,0x49,0x4E,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x43,0x61,0x6D
-,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20
-,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x49,0x6E,0x73,0x74,0x61,0x6E,0x74,0x61
-,0x6E,0x65,0x6F,0x75,0x73,0x20,0x54,0x72,0x65,0x6E,0x64,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F
+,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x53,0x49,0x4E,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46
+,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x53,0x49,0x4E
+,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x53,0x69,0x6E,0x65
+,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C
+,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x53,0x69,0x6E
+,0x65,0x57,0x61,0x76,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C
+,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
+,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x6F,0x75,0x74,0x53,0x69,0x6E,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
+,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4C,0x65,0x61,0x64,0x53,0x69,0x6E,0x65,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4C,0x49
+,0x4E,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4C,0x49,0x4E,0x45,0x3C,0x2F,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
+,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x6C,0x69,0x6E,0x65
+,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C
+,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x49,0x6E,0x73
+,0x74,0x61,0x6E,0x74,0x61,0x6E,0x65,0x6F,0x75,0x73,0x20,0x54,0x72,0x65,0x6E,0x64,0x6C,0x69,0x6E,0x65
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53
+,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72
+,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
+,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
+,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E
+,0x44,0x4D,0x4F,0x44,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4D,0x4F,0x44,0x45,0x3C
+,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x4D
+,0x6F,0x64,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x48,0x69,0x6C,0x62,0x65,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20
+,0x54,0x72,0x65,0x6E,0x64,0x20,0x76,0x73,0x20,0x43,0x79,0x63,0x6C,0x65,0x20,0x4D,0x6F,0x64,0x65,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69
+,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74
+,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E
+,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x49,0x4D,0x49,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x4D
+,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x49,0x6D,0x69,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x74,0x72,0x61,0x64
+,0x61,0x79,0x20,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64
+,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73
+,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4F,0x70,0x65,0x6E,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x70,0x65
+,0x6E,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F
+,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
+,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C
+,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x4B,0x41,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4B,0x41,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x4B,0x61,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x4B,0x61,0x75,0x66,0x6D,0x61,0x6E,0x20,0x41,0x64,0x61,0x70,0x74,0x69,0x76,0x65
+,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F
 ,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
 ,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65
 ,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
@@ -4938,1271 +5138,165 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
 ,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4D,0x4F,0x44,0x45
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x48,0x54,0x5F,0x54,0x52,0x45,0x4E,0x44,0x4D,0x4F,0x44,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x74,0x54,0x72,0x65,0x6E,0x64,0x4D,0x6F,0x64,0x65,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x6C,0x62,0x65
-,0x72,0x74,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x20,0x2D,0x20,0x54,0x72,0x65,0x6E,0x64
-,0x20,0x76,0x73,0x20,0x43,0x79,0x63,0x6C,0x65,0x20,0x4D,0x6F,0x64,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x43,0x79,0x63,0x6C,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
-,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20
-,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
-,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x49,0x4D,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x4D,0x49,0x3C,0x2F,0x41,0x62
-,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
-,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x49,0x6D,0x69,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x74,0x72,0x61,0x64,0x61,0x79,0x20,0x4D,0x6F
-,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F
-,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65
-,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4F,0x70,0x65,0x6E,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x70,0x65,0x6E,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4B,0x41,0x4D,0x41,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x4B,0x41,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4B,0x61
-,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4B
-,0x61,0x75,0x66,0x6D,0x61,0x6E,0x20,0x41,0x64,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x4D,0x6F,0x76,0x69
-,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72
-,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E
-,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20
-,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
-,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
-,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
-,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52
-,0x45,0x47,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61
-,0x72,0x52,0x65,0x67,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76
-,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E
-,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20
-,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
-,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
-,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
-,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x41,0x4E,0x47,0x4C,0x45,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C
-,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x41,0x4E,0x47,0x4C,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x41,0x6E,0x67,0x6C
-,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x69
-,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x20,0x41,0x6E,0x67,0x6C
-,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69
-,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
-,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
-,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
-,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C
-,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
-,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
-,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
-,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
-,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
-,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x49,0x4E,0x54,0x45,0x52,0x43,0x45,0x50,0x54,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x49,0x4E,0x54,0x45,0x52,0x43,0x45,0x50,0x54
-,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52
-,0x65,0x67,0x49,0x6E,0x74,0x65,0x72,0x63,0x65,0x70,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65
-,0x73,0x73,0x69,0x6F,0x6E,0x20,0x49,0x6E,0x74,0x65,0x72,0x63,0x65,0x70,0x74,0x3C,0x2F,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
-,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C
-,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61
-,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20
-,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65
-,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C
-,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x53,0x4C,0x4F,0x50,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09
-,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x49,0x4E,0x45
-,0x41,0x52,0x52,0x45,0x47,0x5F,0x53,0x4C,0x4F,0x50,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x53,0x6C,0x6F,0x70,0x65,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x69,0x6E,0x65,0x61
-,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x20,0x53,0x6C,0x6F,0x70,0x65,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65
-,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
-,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69
-,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
-,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x4E,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x4C,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6E,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F
-,0x72,0x20,0x4C,0x6F,0x67,0x20,0x4E,0x61,0x74,0x75,0x72,0x61,0x6C,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x4F,0x47,0x31,0x30,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x4F,0x47,0x31,0x30
-,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x67,0x31,0x30,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F
-,0x72,0x20,0x4C,0x6F,0x67,0x31,0x30,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61
-,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52
-,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
-,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
-,0x2D,0x20,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
-,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
-,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x61,0x76
-,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72
-,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20
-,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
-,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D
-,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65
-,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61
-,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x43,0x44,0x3C
-,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x63,0x64,0x3C,0x2F,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20
-,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x2F
-,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73
-,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46
-,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72
-,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x32,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53
-,0x6C,0x6F,0x77,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72
-,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x36,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53
-,0x69,0x67,0x6E,0x61,0x6C,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20
-,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70
-,0x65,0x72,0x69,0x6F,0x64,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65
-,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x48,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x45,0x58,0x54,0x20,0x2D,0x2D,0x3E,0x0A
-,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x43
-,0x44,0x45,0x58,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x63
-,0x64,0x45,0x78,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x4D,0x41,0x43,0x44,0x20,0x77,0x69,0x74,0x68,0x20,0x63,0x6F,0x6E,0x74,0x72,0x6F,0x6C,0x6C,0x61
-,0x62,0x6C,0x65,0x20,0x4D,0x41,0x20,0x74,0x79,0x70,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
-,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
-,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x46,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F
-,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x32,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x46,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70
-,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20
-,0x66,0x6F,0x72,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77
-,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D
-,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68
-,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
-,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x36,0x3C,0x2F,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77
-,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66
-,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20
-,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20
-,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x50
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74
-,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20
-,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x29,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41
-,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69
-,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
-,0x75,0x74,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x3E,0x48,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61
-,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21
-,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x46,0x49,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x43,0x44,0x46,0x49,0x58,0x3C
-,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x63,0x64,0x46,0x69,0x78,0x3C
-,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69
-,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76,0x65,0x72,0x67,0x65,0x6E
-,0x63,0x65,0x2F,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x20,0x46,0x69,0x78,0x20,0x31,0x32
-,0x2F,0x32,0x36,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74
-,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E
-,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x50
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74
-,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20
-,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x29,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D
-,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
-,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x48
-,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D
-,0x20,0x4D,0x41,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
-,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x45,0x53,0x41,0x20,0x41,0x64,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x4D
-,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C
-,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20
-,0x4C,0x69,0x6D,0x69,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x55,0x70,0x70,0x65,0x72
-,0x20,0x6C,0x69,0x6D,0x69,0x74,0x20,0x75,0x73,0x65,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64
-,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x61,0x6C,0x67,0x6F,0x72,0x69,0x74,0x68,0x6D,0x3C,0x2F,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
-,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x39,0x2E,0x39,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E
-,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x38,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x4C,0x69,0x6D,0x69
-,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F,0x77,0x65,0x72,0x20,0x6C,0x69,0x6D
-,0x69,0x74,0x20,0x75,0x73,0x65,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x61,0x70,0x74,0x69
-,0x76,0x65,0x20,0x61,0x6C,0x67,0x6F,0x72,0x69,0x74,0x68,0x6D,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
-,0x6D,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x39,0x2E
-,0x39,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50
-,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x36
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x2E,0x30,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x4D,0x41,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x6F,0x75,0x74,0x46,0x41,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
-,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x56,0x50,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E
-,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x56,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65
-,0x56,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x61,0x76
-,0x65,0x72,0x61,0x67,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x20
-,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65
-,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x50,0x65,0x72,0x69,0x6F,0x64,0x73
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x50,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x61,0x6C,0x75,0x65,0x20,0x6C,0x65
-,0x73,0x73,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C
-,0x20,0x62,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
-,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56
-,0x61,0x6C,0x75,0x65,0x20,0x68,0x69,0x67,0x68,0x65,0x72,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C,0x20,0x62,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64
-,0x20,0x74,0x6F,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65
-,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70
-,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x58,0x20,0x2D
-,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x4D,0x41,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x78,0x3C
-,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x67,0x68
-,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65
-,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
-,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
-,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x4D,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65,0x78,0x20,0x6F,0x66,0x20,0x68,0x69,0x67
-,0x68,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70
-,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C
-,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69
-,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E
-,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
-,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33
-,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74
-,0x65,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x45,0x44,0x50,0x52,0x49,0x43,0x45
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x4D,0x45,0x44,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x4D,0x65,0x64,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x65,0x64,0x69,0x61,0x6E,0x20,0x50,0x72,0x69,0x63,0x65
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x50,0x72,0x69,0x63,0x65,0x20,0x54,0x72,0x61
-,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72
-,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
+,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
+,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
+,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x49
+,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73
+,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73
+,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
 ,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x46,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x46,0x49,0x3C,0x2F,0x41,0x62
-,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
-,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x66,0x69,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x6E,0x65,0x79,0x20,0x46,0x6C,0x6F,0x77,0x20
-,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65
-,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
+,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
+,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43
-,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69
-,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E
-,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
-,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31
-,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x44,0x50,0x4F,0x49,0x4E,0x54,0x20,0x2D,0x2D,0x3E
-,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49
-,0x44,0x50,0x4F,0x49,0x4E,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D
-,0x69,0x64,0x50,0x6F,0x69,0x6E,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x64,0x50,0x6F,0x69,0x6E,0x74,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65
-,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C
-,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
+,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x41,0x4E,0x47
+,0x4C,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x41,0x4E,0x47,0x4C,0x45,0x3C
+,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65
+,0x67,0x41,0x6E,0x67,0x6C,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E
+,0x20,0x41,0x6E,0x67,0x6C,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61
+,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
+,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
+,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
+,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x49,0x4E,0x54,0x45,0x52
+,0x43,0x45,0x50,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x49,0x4E,0x54,0x45
+,0x52,0x43,0x45,0x50,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69
+,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x49,0x6E,0x74,0x65,0x72,0x63,0x65,0x70,0x74,0x3C,0x2F,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20
+,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x20,0x49,0x6E,0x74,0x65,0x72,0x63,0x65,0x70,0x74
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63
+,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
 ,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
 ,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
 ,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
@@ -6223,7 +5317,284 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
 ,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
 ,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
-,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
+,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
+,0x21,0x2D,0x2D,0x20,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x53,0x4C,0x4F,0x50,0x45,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x4C,0x49,0x4E,0x45,0x41,0x52,0x52,0x45,0x47,0x5F,0x53,0x4C,0x4F,0x50,0x45,0x3C,0x2F,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
+,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x69,0x6E,0x65,0x61,0x72,0x52,0x65,0x67,0x53,0x6C
+,0x6F,0x70,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x4C,0x69,0x6E,0x65,0x61,0x72,0x20,0x52,0x65,0x67,0x72,0x65,0x73,0x73,0x69,0x6F,0x6E,0x20,0x53,0x6C
+,0x6F,0x70,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73
+,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72
+,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20
+,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
+,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
+,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
+,0x2D,0x20,0x4C,0x4E,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x4C,0x6E,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x4C,0x6F,0x67,0x20,0x4E,0x61,0x74,0x75,0x72,0x61,0x6C,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66
+,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
+,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4C,0x4F,0x47,0x31,0x30,0x20,0x2D
+,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x4C,0x4F,0x47,0x31,0x30,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F
+,0x67,0x31,0x30,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x4C,0x6F,0x67,0x31,0x30,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
+,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
+,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C
+,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69
+,0x6E,0x67,0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72
+,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
+,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
+,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x20,0x2D
+,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x63
+,0x64,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F
+,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76,0x65,0x72,0x67
+,0x65,0x6E,0x63,0x65,0x2F,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63
+,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x31,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x32,0x36,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72
+,0x20,0x74,0x68,0x65,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62
+,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
 ,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
 ,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
 ,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
@@ -6233,150 +5604,325 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
 ,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
 ,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53
+,0x69,0x67,0x6E,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68
+,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
 ,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
-,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x44,0x50,0x52,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46
-,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x44,0x50,0x52,0x49
-,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x64,0x50,0x72
-,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x48,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x45,0x58,0x54
+,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x4D,0x41,0x43,0x44,0x45,0x58,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x4D,0x61,0x63,0x64,0x45,0x78,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x43,0x44,0x20,0x77,0x69,0x74,0x68,0x20,0x63,0x6F,0x6E,0x74
+,0x72,0x6F,0x6C,0x6C,0x61,0x62,0x6C,0x65,0x20,0x4D,0x41,0x20,0x74,0x79,0x70,0x65,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69
+,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
+,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x31,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65
+,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66
+,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x36
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79
+,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65
+,0x20,0x66,0x6F,0x72,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67
+,0x6E,0x61,0x6C,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
 ,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x4D,0x69,0x64,0x70,0x6F,0x69,0x6E,0x74,0x20,0x50,0x72,0x69,0x63,0x65,0x20,0x6F,0x76,0x65,0x72,0x20
-,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65
-,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
-,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x69
+,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
+,0x69,0x6F,0x64,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
+,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67,0x6E,0x61,0x6C,0x20,0x4D,0x41,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76
+,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x73,0x69,0x67,0x6E
+,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20
+,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69
+,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x48,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
+,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x43,0x44,0x46,0x49,0x58,0x20,0x2D,0x2D,0x3E,0x0A
+,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x43
+,0x44,0x46,0x49,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x63
+,0x64,0x46,0x69,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x43,0x6F,0x6E,0x76
+,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x2F,0x44,0x69,0x76,0x65,0x72,0x67,0x65,0x6E,0x63,0x65,0x20,0x46
+,0x69,0x78,0x20,0x31,0x32,0x2F,0x32,0x36,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D
+,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x69,0x67
+,0x6E,0x61,0x6C,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x69
+,0x67,0x6E,0x61,0x6C,0x20,0x6C,0x69,0x6E,0x65,0x20,0x28,0x6E,0x62,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
+,0x69,0x6F,0x64,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
+,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x39,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
+,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x53,0x69,0x67,0x6E,0x61,0x6C,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65
 ,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
 ,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x20,0x2D,0x2D,0x3E
-,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49
-,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F,0x77,0x65,0x73,0x74
-,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66
-,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
+,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x41,0x43,0x44,0x48,0x69,0x73,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x3E,0x48,0x69,0x73,0x74,0x6F,0x67,0x72,0x61,0x6D,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46
+,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A
+,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x44,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x44,0x3C,0x2F,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
+,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x65,0x64,0x69,0x61,0x6E,0x41,0x62,0x73,0x44,0x65,0x76,0x3C
+,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x65,0x64,0x69
+,0x61,0x6E,0x20,0x41,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x20,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69
+,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
+,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C
+,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
 ,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54
-,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
-,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61
-,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x49,0x4E,0x44,0x45,0x58,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D
-,0x49,0x4E,0x49,0x4E,0x44,0x45,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x4D,0x69,0x6E,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65,0x78,0x20,0x6F,0x66,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74
-,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66
-,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x4D,0x41,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x4D,0x61,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x4D,0x45,0x53,0x41,0x20,0x41,0x64,0x61,0x70,0x74,0x69,0x76,0x65,0x20,0x4D,0x6F
+,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65
+,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
 ,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
@@ -6387,112 +5933,239 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
 ,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
 ,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65
-,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20,0x4C
+,0x69,0x6D,0x69,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x55,0x70,0x70,0x65,0x72,0x20
+,0x6C,0x69,0x6D,0x69,0x74,0x20,0x75,0x73,0x65,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x61
+,0x70,0x74,0x69,0x76,0x65,0x20,0x61,0x6C,0x67,0x6F,0x72,0x69,0x74,0x68,0x6D,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x39,0x2E,0x39,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32
+,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x38,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x2E
+,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x4C,0x69,0x6D,0x69,0x74
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F,0x77,0x65,0x72,0x20,0x6C,0x69,0x6D,0x69
+,0x74,0x20,0x75,0x73,0x65,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x61,0x64,0x61,0x70,0x74,0x69,0x76
+,0x65,0x20,0x61,0x6C,0x67,0x6F,0x72,0x69,0x74,0x68,0x6D,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
 ,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
-,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
-,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
-,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09
-,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x4D
-,0x41,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x4D,0x61
-,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F
-,0x77,0x65,0x73,0x74,0x20,0x61,0x6E,0x64,0x20,0x68,0x69,0x67,0x68,0x65,0x73,0x74,0x20,0x76,0x61,0x6C
-,0x75,0x65,0x73,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64
-,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61
-,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x39,0x2E,0x39
+,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72
+,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x36,0x2E
+,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x4D,0x41,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x6F,0x75,0x74,0x46,0x41,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44
+,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21
+,0x2D,0x2D,0x20,0x4D,0x41,0x56,0x50,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x41,0x56,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x56
+,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C
+,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x61,0x76,0x65
+,0x72,0x61,0x67,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72
+,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x50,0x65,0x72,0x69,0x6F,0x64,0x73,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
 ,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x61,0x6C,0x75,0x65,0x20,0x6C,0x65,0x73
+,0x73,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C,0x20
+,0x62,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E
+,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32
+,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x61
+,0x6C,0x75,0x65,0x20,0x68,0x69,0x67,0x68,0x65,0x72,0x20,0x74,0x68,0x61,0x6E,0x20,0x6D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x20,0x77,0x69,0x6C,0x6C,0x20,0x62,0x65,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x64,0x20
+,0x74,0x6F,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72
+,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
 ,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65
-,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D
-,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
+,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
+,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x58,0x20,0x2D,0x2D
+,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D
+,0x41,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x61,0x78,0x3C,0x2F
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x48,0x69,0x67,0x68,0x65
+,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63
+,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
 ,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x61,0x78
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
-,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x20
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52
+,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x20
 ,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
 ,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76
-,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
-,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x4D,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x43,0x61
-,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65,0x78,0x65,0x73
-,0x20,0x6F,0x66,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74,0x20,0x61,0x6E,0x64,0x20,0x68,0x69,0x67,0x68,0x65
-,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65
+,0x3E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x4D,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65,0x78,0x20,0x6F,0x66,0x20,0x68,0x69,0x67,0x68
+,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65
 ,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
 ,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
 ,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
@@ -6532,34 +6205,81 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
 ,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x49
-,0x64,0x78,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x4D,0x61,0x78,0x49,0x64,0x78,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E
-,0x55,0x53,0x5F,0x44,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
-,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x49,0x3C,0x2F,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x44,0x49,0x3C,0x2F,0x43,0x61,0x6D
-,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x20,0x44,0x69
-,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x3C
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65
+,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x45,0x44,0x49,0x41,0x4E,0x20,0x2D,0x2D
+,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D
+,0x45,0x44,0x49,0x41,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x65
+,0x64,0x69,0x61,0x6E,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4D,0x65,0x64,0x69,0x61,0x6E,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C
 ,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
-,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55
-,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F
+,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
+,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
+,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72
+,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D
+,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21
+,0x2D,0x2D,0x20,0x4D,0x45,0x44,0x50,0x52,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x45,0x44,0x50,0x52,0x49,0x43
+,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x65,0x64,0x50,0x72,0x69
+,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D
+,0x65,0x64,0x69,0x61,0x6E,0x20,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x50,0x72,0x69,0x63,0x65,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67
 ,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
 ,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
 ,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
@@ -6571,37 +6291,8 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C
 ,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77
 ,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
 ,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73
-,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20
-,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65
-,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
-,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
 ,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
 ,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
@@ -6613,30 +6304,39 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
 ,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D
-,0x49,0x4E,0x55,0x53,0x5F,0x44,0x4D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x4D,0x3C,0x2F,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x44,0x4D,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x20
-,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20
-,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
-,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69
-,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x46,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x4D,0x46,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x4D,0x66,0x69,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x4D,0x6F,0x6E,0x65,0x79,0x20,0x46,0x6C,0x6F,0x77,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69
+,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74
+,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
 ,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F
-,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D
+,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
 ,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
 ,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
@@ -6648,7 +6348,7 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
 ,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65
 ,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F
 ,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D
 ,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
@@ -6674,201 +6374,435 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
 ,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D
-,0x4F,0x4D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x4D,0x4F,0x4D,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x4D,0x6F,0x6D,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D
-,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
-,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30
-,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
-,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x55,0x4C,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x55,0x4C,0x54,0x3C,0x2F,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x75,0x6C,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72
-,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x4D,0x75,0x6C,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31
+,0x49,0x44,0x50,0x4F,0x49,0x4E,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x44,0x50,0x4F,0x49,0x4E,0x54,0x3C,0x2F,0x41
+,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x64,0x50,0x6F,0x69,0x6E,0x74,0x3C,0x2F
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x64,0x50,0x6F
+,0x69,0x6E,0x74,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65
+,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
+,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
+,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
+,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x44,0x50,0x52
+,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
+,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x44,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x64,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x64,0x70,0x6F,0x69,0x6E,0x74,0x20
+,0x50,0x72,0x69,0x63,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64
+,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65
+,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
+,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
+,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F,0x77,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76
+,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65
+,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72
+,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
+,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C
+,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x4D,0x49,0x4E,0x49,0x4E,0x44,0x45,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62
+,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x49,0x4E,0x44,0x45,0x58,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x49,0x6E,0x64,0x65,0x78,0x3C
+,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65
+,0x78,0x20,0x6F,0x66,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x6F,0x76
+,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65
+,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
+,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x6F,0x75,0x74,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D
+,0x49,0x4E,0x4D,0x41,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x4D,0x61,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
+,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C,0x6F,0x77,0x65,0x73,0x74,0x20,0x61,0x6E,0x64,0x20
+,0x68,0x69,0x67,0x68,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x6F,0x76,0x65,0x72,0x20
+,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74
+,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
+,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
+,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
+,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x61,0x78,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D
+,0x49,0x4E,0x4D,0x41,0x58,0x49,0x4E,0x44,0x45,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
+,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
+,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49,0x4E,0x4D,0x41,0x58,0x49,0x4E
+,0x44,0x45,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x69,0x6E,0x4D
+,0x61,0x78,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x49,0x6E,0x64,0x65,0x78,0x65,0x73,0x20,0x6F,0x66,0x20,0x6C,0x6F,0x77,0x65,0x73
+,0x74,0x20,0x61,0x6E,0x64,0x20,0x68,0x69,0x67,0x68,0x65,0x73,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x73
+,0x20,0x6F,0x76,0x65,0x72,0x20,0x61,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x64,0x20,0x70,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20
+,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
 ,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
 ,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
 ,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
 ,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4E
-,0x41,0x54,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x41,0x54,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x4E,0x61,0x74,0x72,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x69,0x6E,0x49,0x64,0x78,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x4D,0x61,0x78,0x49,0x64,0x78
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C
+,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x49,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x49
+,0x4E,0x55,0x53,0x5F,0x44,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D
+,0x69,0x6E,0x75,0x73,0x44,0x49,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
 ,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x4E,0x6F,0x72,0x6D,0x61,0x6C,0x69,0x7A,0x65,0x64,0x20,0x41,0x76,0x65,0x72,0x61,0x67
-,0x65,0x20,0x54,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79,0x20,0x49,0x6E,0x64,0x69,0x63,0x61
-,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62
-,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x6F,0x6E,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73
+,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
 ,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
-,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
-,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4F,0x42,0x56,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4F
-,0x42,0x56,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x62,0x76,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4F,0x6E,0x20,0x42,0x61
-,0x6C,0x61,0x6E,0x63,0x65,0x20,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73
-,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
 ,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
 ,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
 ,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x50,0x4C,0x55,0x53,0x5F,0x44,0x49
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x50,0x4C,0x55,0x53,0x5F,0x44,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x50,0x6C,0x75,0x73,0x44,0x49,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x4D,0x20,0x2D
+,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x4D,0x49,0x4E,0x55,0x53,0x5F,0x44,0x4D,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x44,0x4D,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
 ,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x6C,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x69,0x6E,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
 ,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
 ,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
 ,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
@@ -6877,42 +6811,520 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
 ,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
 ,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x4F,0x4D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x4F,0x4D,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x6F,0x6D,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
+,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4D,0x55
+,0x4C,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x4D,0x55,0x4C,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x4D,0x75,0x6C,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20
+,0x4D,0x75,0x6C,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20
+,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
+,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x4E,0x41,0x54,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09
+,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x41,0x54,0x52
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4E,0x61,0x74,0x72,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x6F,0x72,0x6D,0x61,0x6C
+,0x69,0x7A,0x65,0x64,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x54,0x72,0x75,0x65,0x20,0x52,0x61
+,0x6E,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x61,0x74,0x69
+,0x6C,0x69,0x74,0x79,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F
+,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43
+,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
+,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
+,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
+,0x3C,0x21,0x2D,0x2D,0x20,0x4F,0x42,0x56,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62
+,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x4F,0x42,0x56,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x62,0x76,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4F,0x6E,0x20,0x42,0x61,0x6C,0x61,0x6E,0x63,0x65,0x20,0x56,0x6F,0x6C
+,0x75,0x6D,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65
+,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D
+,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x56
+,0x6F,0x6C,0x75,0x6D,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
+,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
+,0x21,0x2D,0x2D,0x20,0x50,0x4C,0x55,0x53,0x5F,0x44,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x4C,0x55,0x53,0x5F,0x44,0x49
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x50,0x6C,0x75,0x73,0x44,0x49,0x3C
+,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x6C,0x75,0x73
+,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74
+,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75
+,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C
+,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73
+,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43
+,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72
+,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20
+,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
+,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
+,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
+,0x2D,0x20,0x50,0x4C,0x55,0x53,0x5F,0x44,0x4D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x4C,0x55,0x53,0x5F,0x44,0x4D,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x50,0x6C,0x75,0x73,0x44,0x4D,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x6C,0x75,0x73,0x20,0x44
+,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
+,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55
+,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67
+,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48
+,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x50,0x50
+,0x4F,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x50,0x50,0x4F,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x50
+,0x70,0x6F,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50
+,0x65,0x72,0x63,0x65,0x6E,0x74,0x61,0x67,0x65,0x20,0x50,0x72,0x69,0x63,0x65,0x20,0x4F,0x73,0x63,0x69
+,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D
+,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
+,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65
+,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E
+,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32
+,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
+,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65
+,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E
+,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32
+,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x36,0x3C,0x2F,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79
+,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20
+,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
+,0x3C,0x21,0x2D,0x2D,0x20,0x51,0x55,0x41,0x4E,0x54,0x49,0x4C,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x51,0x55,0x41,0x4E,0x54
+,0x49,0x4C,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x51,0x75,0x61,0x6E
+,0x74,0x69,0x6C,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x51,0x75,0x61,0x6E,0x74,0x69,0x6C,0x65,0x20,0x6F,0x76,0x65,0x72,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69
+,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20
+,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
+,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
+,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x51
+,0x75,0x61,0x6E,0x74,0x69,0x6C,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x46,0x72,0x61
+,0x63,0x74,0x69,0x6F,0x6E,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20
+,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x62,0x65,0x6C,0x6F,0x77,0x20
+,0x74,0x68,0x65,0x20,0x6F,0x75,0x74,0x70,0x75,0x74,0x20,0x28,0x30,0x2E,0x35,0x20,0x69,0x73,0x20,0x74
+,0x68,0x65,0x20,0x6D,0x65,0x64,0x69,0x61,0x6E,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65
+,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x39,0x2E,0x35
+,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30,0x30
+,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
 ,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
 ,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
@@ -6926,119 +7338,91 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
 ,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
 ,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x50,0x4C,0x55,0x53,0x5F,0x44,0x4D,0x20,0x2D
-,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x50,0x4C,0x55,0x53,0x5F,0x44,0x4D,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x50,0x6C,0x75,0x73,0x44,0x4D,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x50,0x6C,0x75,0x73,0x20,0x44,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x20
-,0x4D,0x6F,0x76,0x65,0x6D,0x65,0x6E,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D
-,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x20,0x2D,0x2D,0x3E,0x0A,0x09
+,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x4F,0x43,0x3C
+,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x3C,0x2F,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20
+,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x3A,0x20,0x28,0x28,0x70,0x72,0x69,0x63,0x65,0x2F,0x70,0x72,0x65
+,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2D,0x31,0x29,0x2A,0x31,0x30,0x30,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
+,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61
+,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30
+,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
+,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
+,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x50,0x20,0x2D,0x2D
+,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x52
+,0x4F,0x43,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x50
+,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74
+,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x50,0x65,0x72,0x63,0x65,0x6E,0x74,0x61
+,0x67,0x65,0x3A,0x20,0x28,0x70,0x72,0x69,0x63,0x65,0x2D,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65
+,0x29,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
+,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
 ,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
-,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34
-,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
-,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x50,0x50,0x4F,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x50,0x4F,0x3C,0x2F,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x50,0x70,0x6F,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x65,0x72,0x63,0x65,0x6E,0x74,0x61,0x67,0x65,0x20,0x50
-,0x72,0x69,0x63,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72
-,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63
-,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
-,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x61,0x73,0x74,0x20,0x4D,0x41,0x3C,0x2F,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
-,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
-,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x31,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
-,0x64,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x73,0x6C,0x6F,0x77,0x20,0x4D,0x41,0x3C,0x2F,0x53
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
 ,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
 ,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
 ,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
 ,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
 ,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
@@ -7049,97 +7433,143 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
 ,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
 ,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x32,0x36,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
 ,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72
-,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
-,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
-,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x52
-,0x4F,0x43,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74,0x65,0x20
-,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x3A,0x20,0x28,0x28,0x70,0x72,0x69,0x63,0x65,0x2F
-,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2D,0x31,0x29,0x2A,0x31,0x30,0x30,0x3C,0x2F,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64
-,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
-,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x50
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09
+,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x4F,0x43,0x52
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x52,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74,0x65,0x20,0x6F
+,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x72,0x61,0x74,0x69,0x6F,0x3A,0x20,0x28,0x70,0x72,0x69
+,0x63,0x65,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
+,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74
+,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x52,0x31,0x30,0x30,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x52,0x4F,0x43,0x52,0x31,0x30,0x30,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x52,0x6F,0x63,0x52,0x31,0x30,0x30,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20
+,0x72,0x61,0x74,0x69,0x6F,0x20,0x31,0x30,0x30,0x20,0x73,0x63,0x61,0x6C,0x65,0x3A,0x20,0x28,0x70,0x72
+,0x69,0x63,0x65,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2A,0x31,0x30,0x30,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E
+,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
+,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
+,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
+,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
+,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x53,0x49
 ,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
 ,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x52,0x4F,0x43,0x50,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52
-,0x6F,0x63,0x50,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x50,0x65,0x72,0x63,0x65
-,0x6E,0x74,0x61,0x67,0x65,0x3A,0x20,0x28,0x70,0x72,0x69,0x63,0x65,0x2D,0x70,0x72,0x65,0x76,0x50,0x72
-,0x69,0x63,0x65,0x29,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61
-,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
+,0x6E,0x3E,0x52,0x53,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x73
+,0x69,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x65
+,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74,0x72,0x65,0x6E,0x67,0x74,0x68,0x20,0x49,0x6E,0x64,0x65
+,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D
+,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
 ,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
 ,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
@@ -7157,7 +7587,7 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54
 ,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
 ,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30
 ,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
 ,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
@@ -7168,7 +7598,7 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
 ,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
 ,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
 ,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
 ,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
 ,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
@@ -7182,454 +7612,263 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
 ,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
 ,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x52,0x20,0x2D,0x2D
-,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x52
-,0x4F,0x43,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x52
-,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74
-,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E,0x67,0x65,0x20,0x72,0x61,0x74,0x69,0x6F,0x3A,0x20,0x28
-,0x70,0x72,0x69,0x63,0x65,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x3C,0x2F,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
-,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69
-,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x41,0x52,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x41
+,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x61,0x72,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x61,0x72,0x61,0x62,0x6F
+,0x6C,0x69,0x63,0x20,0x53,0x41,0x52,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76
+,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
 ,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x52,0x4F,0x43,0x52,0x31
-,0x30,0x30,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x52,0x4F,0x43,0x52,0x31,0x30,0x30,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x52,0x6F,0x63,0x52,0x31,0x30,0x30,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x61,0x74,0x65,0x20,0x6F,0x66,0x20,0x63,0x68,0x61,0x6E
-,0x67,0x65,0x20,0x72,0x61,0x74,0x69,0x6F,0x20,0x31,0x30,0x30,0x20,0x73,0x63,0x61,0x6C,0x65,0x3A,0x20
-,0x28,0x70,0x72,0x69,0x63,0x65,0x2F,0x70,0x72,0x65,0x76,0x50,0x72,0x69,0x63,0x65,0x29,0x2A,0x31,0x30
-,0x30,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D
-,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
-,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66
-,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
-,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C
-,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
-,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
-,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
-,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
-,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
-,0x52,0x53,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x52,0x53,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
-,0x3E,0x52,0x73,0x69,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x52,0x65,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74,0x72,0x65,0x6E,0x67,0x74,0x68,0x20,0x49
-,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E
-,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
-,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x41,0x52,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x53,0x41,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x61,0x72
-,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x61,0x72
-,0x61,0x62,0x6F,0x6C,0x69,0x63,0x20,0x53,0x41,0x52,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72
-,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69
-,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C
 ,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20
-,0x46,0x61,0x63,0x74,0x6F,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65
-,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x75,0x73,0x65,0x64
-,0x20,0x75,0x70,0x20,0x74,0x6F,0x20,0x74,0x68,0x65,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76
-,0x61,0x6C,0x75,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30
-,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B
-,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50
-,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30
-,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x41,0x46,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20
-,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C
-,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x34,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30
-,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x41,0x52,0x45,0x58
-,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
-,0x6F,0x6E,0x3E,0x53,0x41,0x52,0x45,0x58,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x53,0x61,0x72,0x45,0x78,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x50,0x61,0x72,0x61,0x62,0x6F,0x6C,0x69,0x63,0x20,0x53,0x41,0x52,0x20,0x2D
-,0x20,0x45,0x78,0x74,0x65,0x6E,0x64,0x65,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
-,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67
-,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63
+,0x74,0x6F,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72
+,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x75,0x73,0x65,0x64,0x20,0x75,0x70
+,0x20,0x74,0x6F,0x20,0x74,0x68,0x65,0x20,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75
+,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
+,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C
+,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63
+,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
+,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63
+,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72
+,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x34,0x2E
+,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x41,0x52,0x45,0x58,0x54,0x20,0x2D
+,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x53,0x41,0x52,0x45,0x58,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53
+,0x61,0x72,0x45,0x78,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x50,0x61,0x72,0x61,0x62,0x6F,0x6C,0x69,0x63,0x20,0x53,0x41,0x52,0x20,0x2D,0x20,0x45,0x78
+,0x74,0x65,0x6E,0x64,0x65,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65
+,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F
 ,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x61,0x72,0x74,0x20,0x56,0x61,0x6C,0x75,0x65,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x61,0x72,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x61
-,0x6E,0x64,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x2E,0x20,0x30,0x20,0x66,0x6F,0x72,0x20
-,0x41,0x75,0x74,0x6F,0x2C,0x20,0x26,0x67,0x74,0x3B,0x30,0x20,0x66,0x6F,0x72,0x20,0x4C,0x6F,0x6E,0x67
-,0x2C,0x20,0x26,0x6C,0x74,0x3B,0x30,0x20,0x66,0x6F,0x72,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37
-,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73
-,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x30
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x30
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
 ,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x66,0x66,0x73,0x65
-,0x74,0x20,0x6F,0x6E,0x20,0x52,0x65,0x76,0x65,0x72,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x50,0x65,0x72,0x63,0x65,0x6E,0x74,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x61,0x64,0x64
-,0x65,0x64,0x2F,0x72,0x65,0x6D,0x6F,0x76,0x65,0x64,0x20,0x74,0x6F,0x20,0x69,0x6E,0x69,0x74,0x69,0x61
-,0x6C,0x20,0x73,0x74,0x6F,0x70,0x20,0x6F,0x6E,0x20,0x73,0x68,0x6F,0x72,0x74,0x2F,0x6C,0x6F,0x6E,0x67
-,0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x61,0x6C,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
-,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65
-,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x35
-,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
-,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32
-,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x4C,0x6F,0x6E,0x67,0x3C,0x2F,0x4E
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x53,0x74,0x61,0x72,0x74,0x20,0x56,0x61,0x6C,0x75,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x61,0x72,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x61,0x6E,0x64,0x20
+,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x2E,0x20,0x30,0x20,0x66,0x6F,0x72,0x20,0x41,0x75,0x74
+,0x6F,0x2C,0x20,0x26,0x67,0x74,0x3B,0x30,0x20,0x66,0x6F,0x72,0x20,0x4C,0x6F,0x6E,0x67,0x2C,0x20,0x26
+,0x6C,0x74,0x3B,0x30,0x20,0x66,0x6F,0x72,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69
+,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E
+,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x30,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x30,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
+,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4F,0x66,0x66,0x73,0x65,0x74,0x20,0x6F
+,0x6E,0x20,0x52,0x65,0x76,0x65,0x72,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x50
+,0x65,0x72,0x63,0x65,0x6E,0x74,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x61,0x64,0x64,0x65,0x64,0x2F
+,0x72,0x65,0x6D,0x6F,0x76,0x65,0x64,0x20,0x74,0x6F,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x73
+,0x74,0x6F,0x70,0x20,0x6F,0x6E,0x20,0x73,0x68,0x6F,0x72,0x74,0x2F,0x6C,0x6F,0x6E,0x67,0x20,0x72,0x65
+,0x76,0x65,0x72,0x73,0x61,0x6C,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30
+,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x35,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B
+,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x4C,0x6F,0x6E,0x67,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63
+,0x74,0x6F,0x72,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F
+,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B
+,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
+,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69
+,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x39,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x4C
+,0x6F,0x6E,0x67,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72
+,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65
+,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
+,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D
+,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E
+,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30
+,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30
+,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32
+,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x4D,0x61,0x78,0x20,0x4C,0x6F
+,0x6E,0x67,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61
+,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20
+,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64
+,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F
+,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E
+,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63
+,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x34,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
+,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
+,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30
+,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x4E
 ,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
 ,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20
 ,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65
-,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74
-,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33
-,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72
-,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x39,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41
-,0x46,0x20,0x4C,0x6F,0x6E,0x67,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65
-,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x66,0x6F,0x72,0x20
-,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C
-,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
-,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69
-,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E
-,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E
-,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x4D,0x61,0x78
-,0x20,0x4C,0x6F,0x6E,0x67,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C
-,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D
-,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x4C,0x6F,0x6E
-,0x67,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
-,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
-,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30
-,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50
-,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x34
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20,0x49,0x6E,0x69,0x74,0x20,0x53,0x68,0x6F,0x72,0x74
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69
-,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x6C,0x20,0x76,0x61
-,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69
-,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30
-,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69
-,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x39,0x30,0x30
-,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
-,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
-,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2D,0x32,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x41,0x46,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72
 ,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63
 ,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
 ,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
@@ -7637,99 +7876,156 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30
 ,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
 ,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B
-,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50
-,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
-,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30
-,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x41,0x46,0x20,0x4D,0x61,0x78,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x41,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F
-,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20
-,0x74,0x68,0x65,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30
-,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73
-,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x34,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
-,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D
-,0x20,0x53,0x49,0x4E,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
-,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x49,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x53,0x69,0x6E,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50
+,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x39,0x30,0x30,0x30,0x30,0x30
+,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C
+,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x41,0x46,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41,0x63
+,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x66,0x6F
+,0x72,0x20,0x74,0x68,0x65,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F
+,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
+,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C
+,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63
+,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
+,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x41,0x46,0x20
+,0x4D,0x61,0x78,0x20,0x53,0x68,0x6F,0x72,0x74,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x41
+,0x63,0x63,0x65,0x6C,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x20,0x6D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x65
+,0x20,0x53,0x68,0x6F,0x72,0x74,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E
+,0x3E,0x34,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x32,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x34,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
+,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x49
+,0x4E,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x53,0x49,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53
+,0x69,0x6E,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56
+,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20
+,0x53,0x69,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54
+,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x49
+,0x4E,0x48,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x53,0x49,0x4E,0x48,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x53,0x69,0x6E,0x68,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
 ,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
 ,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72
-,0x69,0x63,0x20,0x53,0x69,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74
-,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
-,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
-,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D
-,0x20,0x53,0x49,0x4E,0x48,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
+,0x69,0x63,0x20,0x53,0x69,0x6E,0x68,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61
+,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52
+,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
+,0x2D,0x20,0x53,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
 ,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
-,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x49,0x4E,0x48,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x53,0x69,0x6E,0x68,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D
-,0x65,0x74,0x72,0x69,0x63,0x20,0x53,0x69,0x6E,0x68,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x53,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x53,0x69,0x6D,0x70,0x6C,0x65,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65
+,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C
+,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
+,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
+,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
 ,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
 ,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
@@ -7737,90 +8033,30 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
 ,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
 ,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
-,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E
-,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62
-,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
-,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
-,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x69,0x6D,0x70,0x6C,0x65,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20
-,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76
-,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
-,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30
-,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
-,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
-,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x51,0x52,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x51,0x52,0x54,0x3C,0x2F,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x71,0x72,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x53,0x71
-,0x75,0x61,0x72,0x65,0x20,0x52,0x6F,0x6F,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
-,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
-,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69
-,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65
+,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44
+,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
 ,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
@@ -7832,120 +8068,172 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E
 ,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C
-,0x21,0x2D,0x2D,0x20,0x53,0x54,0x44,0x44,0x45,0x56,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x44,0x44,0x45,0x56,0x3C,0x2F
-,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
-,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x64,0x44,0x65,0x76,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x61,0x6E,0x64,0x61
-,0x72,0x64,0x20,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
-,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x21,0x2D,0x2D,0x20,0x53,0x51,0x52,0x54,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62
+,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x51,0x52,0x54,0x3C,0x2F,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
+,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x71,0x72,0x74,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
+,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20,0x53,0x71,0x75,0x61,0x72
+,0x65,0x20,0x52,0x6F,0x6F,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74
+,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D
+,0x20,0x53,0x54,0x44,0x44,0x45,0x56,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x44,0x44,0x45,0x56,0x3C,0x2F,0x41,0x62,0x62
+,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43
+,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x64,0x44,0x65,0x76,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x20
+,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
+,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C
+,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69
+,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E
+,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x62,0x20,0x6F,0x66,0x20,0x64,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37
+,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
+,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73
+,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x2D
+,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
 ,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
 ,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x4E,0x62,0x20,0x6F,0x66,0x20,0x64,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37
-,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65
-,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x2D,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
-,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
-,0x6E,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69
-,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09
-,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x54,0x4F,0x43,0x48,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E
-,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x4F,0x43,0x48,0x3C,0x2F,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x6F,0x63,0x68,0x3C,0x2F,0x43,0x61,0x6D
-,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74
-,0x69,0x63,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75
-,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E
+,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D
+,0x2D,0x20,0x53,0x54,0x4F,0x43,0x48,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
+,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x4F,0x43,0x48,0x3C,0x2F,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
+,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x6F,0x63,0x68,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
+,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
+,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
 ,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
 ,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46
-,0x61,0x73,0x74,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x54,0x69,0x6D,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x62,0x75
-,0x69,0x6C,0x64,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x6C,0x69
-,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74
+,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54
+,0x69,0x6D,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x62,0x75,0x69,0x6C,0x64
+,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x6C,0x69,0x6E,0x65,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
+,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61
+,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F
+,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20
+,0x6C,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F
+,0x20,0x33,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
 ,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
 ,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
 ,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69
@@ -7958,156 +8246,27 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
 ,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
 ,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67
-,0x20,0x66,0x6F,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x53,0x6C,0x6F,0x77
-,0x2D,0x4B,0x20,0x6C,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74
-,0x20,0x74,0x6F,0x20,0x33,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
-,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x4D,0x41
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F
-,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53,0x6C,0x6F
-,0x77,0x2D,0x4B,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F
-,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67
-,0x20,0x66,0x6F,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x53,0x6C,0x6F,0x77
-,0x2D,0x44,0x20,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
-,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
-,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C
-,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
-,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
-,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
-,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20
-,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20
-,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53
-,0x6C,0x6F,0x77,0x2D,0x44,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79
-,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x6F,0x75,0x74,0x53,0x6C,0x6F,0x77,0x4B,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x53,0x6C,0x6F,0x77
-,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C
-,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x54,0x4F,0x43
-,0x48,0x46,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x4F,0x43,0x48,0x46,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x53,0x74,0x6F,0x63,0x68,0x46,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x20,0x46,0x61,0x73
-,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D
-,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x4B,0x20,0x4D,0x41,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E
+,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x4B
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x75,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
 ,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61
-,0x73,0x74,0x2D,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x54,0x69,0x6D,0x65,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x62,0x75,0x69
-,0x6C,0x64,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x6C,0x69,0x6E
-,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F
-,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30
-,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F,0x64
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
-,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20
-,0x66,0x6F,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D
-,0x44,0x20,0x6C,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20
-,0x74,0x6F,0x20,0x33,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F
+,0x72,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20
+,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
 ,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
 ,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
 ,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69
@@ -8125,10 +8284,10 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74
 ,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x4D,0x41,0x3C
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x6C,0x6F,0x77,0x2D,0x44,0x20,0x4D,0x41,0x3C
 ,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
 ,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76
-,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x46,0x61,0x73,0x74
+,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x53,0x6C,0x6F,0x77
 ,0x2D,0x44,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
 ,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C
 ,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
@@ -8140,65 +8299,50 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
 ,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
 ,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x46,0x61,0x73,0x74,0x4B,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
-,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53
-,0x54,0x4F,0x43,0x48,0x52,0x53,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x4F,0x43,0x48,0x52,0x53,0x49,0x3C,0x2F,0x41
-,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65
-,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x6F,0x63,0x68,0x52,0x73,0x69,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68
-,0x61,0x73,0x74,0x69,0x63,0x20,0x52,0x65,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74,0x72,0x65,0x6E
-,0x67,0x74,0x68,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
-,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C
-,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65
-,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52
-,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F
-,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E
-,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32
-,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x74,0x53,0x6C,0x6F,0x77,0x4B,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73
+,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x53,0x6C,0x6F,0x77,0x44,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x44,0x61,0x73,0x68,0x65,0x64,0x20,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x54,0x4F,0x43,0x48,0x46,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x53,0x54,0x4F,0x43,0x48,0x46,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x53,0x74,0x6F,0x63,0x68,0x46,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74,0x69,0x63,0x20,0x46,0x61,0x73,0x74,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E
+,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
+,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43
+,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
 ,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D
 ,0x4B,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
@@ -8223,15 +8367,241 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
 ,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
 ,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72
-,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x6C
-,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F,0x20
-,0x33,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
+,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72
+,0x20,0x6D,0x61,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x6C
+,0x69,0x6E,0x65,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F,0x20
+,0x33,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
+,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30
+,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
+,0x61,0x6C,0x75,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67
+,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x3C
+,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x46,0x61
+,0x73,0x74,0x4B,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
+,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
+,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x54,0x4F,0x43
+,0x48,0x52,0x53,0x49,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x54,0x4F,0x43,0x48,0x52,0x53,0x49,0x3C,0x2F,0x41,0x62,0x62,0x72
+,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
+,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x74,0x6F,0x63,0x68,0x52,0x73,0x69,0x3C,0x2F,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x74,0x6F,0x63,0x68,0x61,0x73,0x74
+,0x69,0x63,0x20,0x52,0x65,0x6C,0x61,0x74,0x69,0x76,0x65,0x20,0x53,0x74,0x72,0x65,0x6E,0x67,0x74,0x68
+,0x20,0x49,0x6E,0x64,0x65,0x78,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D
+,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x69,0x6D,0x65,0x20
+,0x70,0x65,0x72,0x69,0x6F,0x64,0x20,0x66,0x6F,0x72,0x20,0x62,0x75,0x69,0x6C,0x64,0x69,0x6E,0x67,0x20
+,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x4B,0x20,0x6C,0x69,0x6E,0x65,0x3C,0x2F,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69
+,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x66,0x6F,0x72,0x20,0x6D,0x61
+,0x6B,0x69,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x6C,0x69,0x6E,0x65
+,0x2E,0x20,0x55,0x73,0x75,0x61,0x6C,0x6C,0x79,0x20,0x73,0x65,0x74,0x20,0x74,0x6F,0x20,0x33,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
+,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
+,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76
+,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x4B
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x46,0x61,0x73,0x74,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x55,0x42,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x55
+,0x42,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x75,0x62,0x3C,0x2F,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72
+,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x53,0x75,0x62,0x73,0x74,0x72,0x61,0x63
+,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20
+,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
+,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
+,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x55,0x4D,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x55,0x4D,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x75,0x6D,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x75,0x6D,0x6D,0x61,0x74,0x69,0x6F,0x6E
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72
+,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52
+,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
+,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
+,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F
+,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
 ,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F
 ,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
+,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D
 ,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30
 ,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
 ,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30
@@ -8242,63 +8612,206 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
 ,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
 ,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x33,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46,0x61,0x73,0x74,0x2D,0x44,0x20,0x4D,0x41,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x65,0x20,0x6F,0x66,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67
-,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x66,0x6F,0x72,0x20,0x46,0x61,0x73,0x74,0x2D,0x44,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4D,0x41,0x20,0x54,0x79,0x70,0x65,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
-,0x65,0x3E,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x46,0x61
-,0x73,0x74,0x4B,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x46,0x61,0x73,0x74,0x44,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61
+,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F
+,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E
+,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x33,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x33
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x33,0x3C,0x2F,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x45
+,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76
+,0x65,0x72,0x61,0x67,0x65,0x20,0x28,0x54,0x33,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
+,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72
+,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C,0x65,0x20,0x50
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72
+,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20
+,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
+,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
+,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x56,0x6F,0x6C,0x75,0x6D
+,0x65,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x6F
+,0x6C,0x75,0x6D,0x65,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
+,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x2E,0x30
+,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72
+,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E
+,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D
+,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x37,0x2E,0x30,0x30,0x30,0x30
+,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x41,0x4E,0x20,0x2D,0x2D,0x3E,0x0A
+,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x41,0x4E
+,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43
+,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x61,0x6E,0x3C,0x2F,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74,0x6F,0x72,0x20
+,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x54,0x61,0x6E,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F
+,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
+,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x41,0x4E,0x48,0x20,0x2D,0x2D,0x3E
+,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x41
+,0x4E,0x48,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x61,0x6E,0x68,0x3C
+,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74
+,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x54,0x61,0x6E
+,0x68,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61
+,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
+,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
 ,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
 ,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
 ,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x55,0x42,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x53,0x55,0x42,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x75,0x62
-,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63
-,0x74,0x6F,0x72,0x20,0x41,0x72,0x69,0x74,0x68,0x6D,0x65,0x74,0x69,0x63,0x20,0x53,0x75,0x62,0x73,0x74
-,0x72,0x61,0x63,0x74,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61
-,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52
-,0x65,0x61,0x6C,0x30,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75
-,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x31,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x45,0x4D,0x41
+,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
+,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x54,0x45,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54
+,0x65,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D
+,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
+,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C
+,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
+,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64
+,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30
+,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
+,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
+,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
 ,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
 ,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
 ,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
@@ -8309,127 +8822,256 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
 ,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
 ,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x53,0x55,0x4D,0x20,0x2D,0x2D,0x3E
-,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x55
-,0x4D,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x75,0x6D,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x53,0x75,0x6D,0x6D,0x61,0x74
-,0x69,0x6F,0x6E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F
-,0x70,0x65,0x72,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x48,0x52,0x45,0x53,0x48,0x4F
+,0x4C,0x44,0x5F,0x45,0x56,0x45,0x4E,0x54,0x53,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
+,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
+,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x48,0x52,0x45,0x53,0x48,0x4F,0x4C,0x44
+,0x5F,0x45,0x56,0x45,0x4E,0x54,0x53,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x68,0x72,0x65,0x73,0x68,0x6F,0x6C,0x64,0x45,0x76,0x65,0x6E,0x74,0x73,0x3C,0x2F,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
+,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x43,0x72,0x6F,0x73,0x73,0x69,0x6E,0x67
+,0x73,0x20,0x6F,0x66,0x20,0x61,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6F,0x6C,0x64,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x4F,0x70,0x65,0x72,0x61,0x74,0x6F,0x72
+,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x68,0x72,0x65,0x73,0x68,0x6F,0x6C,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4C
+,0x65,0x76,0x65,0x6C,0x20,0x63,0x72,0x6F,0x73,0x73,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20
+,0x69,0x6E,0x70,0x75,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30
+,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30
+,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69
+,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x2E,0x30,0x30,0x30
+,0x30,0x30,0x30,0x65,0x2B,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x31,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65
+,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x49,0x6E
+,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x52,0x41,0x4E,0x47,0x45,0x20
+,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
+,0x3E,0x54,0x52,0x41,0x4E,0x47,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x72,0x75,0x65,0x52,0x61,0x6E,0x67,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79,0x20,0x49,0x6E
+,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09
 ,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
 ,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
 ,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52
+,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52
 ,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
-,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65
-,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65
-,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69
-,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
-,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75
-,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56
-,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41
-,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
-,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x33,0x20
-,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x54,0x33,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x33,0x3C,0x2F
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x69,0x70,0x6C
-,0x65,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67
-,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x28,0x54,0x33,0x29,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75
-,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C
-,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x55,0x6E,0x73,0x74,0x61,0x62,0x6C
-,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43
+,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
+,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
 ,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
 ,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20
-,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62
-,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x56,0x6F
-,0x6C,0x75,0x6D,0x65,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46
+,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A
+,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x52,0x49,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69
+,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x52,0x49,0x4D,0x41,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x72,0x69,0x6D,0x61,0x3C,0x2F,0x43,0x61
+,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x69,0x61,0x6E,0x67,0x75
+,0x6C,0x61,0x72,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F
+,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09
+,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75
+,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61
+,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
+,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
+,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
+,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
+,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
+,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D
+,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
+,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
+,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
+,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
+,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x52
+,0x49,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
+,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
+,0x69,0x6F,0x6E,0x3E,0x54,0x52,0x49,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x54,0x72,0x69,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x31,0x2D,0x64,0x61,0x79,0x20,0x52,0x61,0x74,0x65,0x2D,0x4F,0x66,0x2D,0x43,0x68,0x61,0x6E
+,0x67,0x65,0x20,0x28,0x52,0x4F,0x43,0x29,0x20,0x6F,0x66,0x20,0x61,0x20,0x54,0x72,0x69,0x70,0x6C,0x65
+,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x20,0x45,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72
+,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
+,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
+,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
 ,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x56,0x6F,0x6C,0x75,0x6D,0x65,0x20,0x46,0x61,0x63,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x30,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C
-,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x35,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2D,0x32,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x37,0x2E,0x30
-,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
+,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
+,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
+,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
+,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
+,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
+,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
+,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
+,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x53,0x46,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
+,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x53,0x46,0x3C,0x2F
+,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D
+,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x73,0x66,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x69,0x6D,0x65,0x20,0x53,0x65,0x72,0x69
+,0x65,0x73,0x20,0x46,0x6F,0x72,0x65,0x63,0x61,0x73,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F
+,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E
+,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
+,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69
+,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30
+,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E
+,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63
+,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
+,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
 ,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
 ,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
@@ -8443,227 +9085,165 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
 ,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x41,0x4E,0x20,0x2D
-,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x54,0x41,0x4E,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x61,0x6E,0x3C
-,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x65,0x63,0x74
-,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20,0x54,0x61,0x6E
-,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20,0x54,0x72,0x61,0x6E
-,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61
+,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x59,0x50,0x50,0x52
+,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
+,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x59,0x50,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
+,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x79,0x70,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65
+,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44
+,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x69,0x63,0x61,0x6C,0x20,0x50
+,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x50,0x72,0x69,0x63,0x65
+,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E
+,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E
+,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46
+,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61
 ,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x41,0x4E,0x48,0x20
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
+,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
+,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
+,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
+,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
+,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x55,0x4C,0x54,0x4F,0x53,0x43,0x20
 ,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
 ,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E
-,0x3E,0x54,0x41,0x4E,0x48,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x61
-,0x6E,0x68,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56
-,0x65,0x63,0x74,0x6F,0x72,0x20,0x54,0x72,0x69,0x67,0x6F,0x6E,0x6F,0x6D,0x65,0x74,0x72,0x69,0x63,0x20
-,0x54,0x61,0x6E,0x68,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x61,0x74,0x68,0x20
-,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65
-,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54
-,0x45,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
-,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x45,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
-,0x65,0x3E,0x54,0x65,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x3E,0x55,0x4C,0x54,0x4F,0x53,0x43,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
+,0x55,0x6C,0x74,0x4F,0x73,0x63,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
 ,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x54,0x72,0x69,0x70,0x6C,0x65,0x20,0x45,0x78,0x70,0x6F,0x6E,0x65,0x6E,0x74,0x69,0x61
-,0x6C,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68
-,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
-,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69
-,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
-,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
-,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x52,0x41,0x4E
-,0x47,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x54,0x52,0x41,0x4E,0x47,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x54,0x72,0x75,0x65,0x52,0x61,0x6E,0x67,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x75,0x65,0x20,0x52,0x61,0x6E,0x67,0x65,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x56,0x6F,0x6C,0x61,0x74,0x69,0x6C,0x69,0x74,0x79
-,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61
-,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C
-,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x52,0x49,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09
-,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A
-,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x52,0x49,0x4D
-,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x72,0x69,0x6D,0x61,0x3C
-,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x72,0x69,0x61
-,0x6E,0x67,0x75,0x6C,0x61,0x72,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67
-,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
-,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20
-,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65
-,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x6F,0x6E,0x3E,0x55,0x6C,0x74,0x69,0x6D,0x61,0x74,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C,0x6C,0x61,0x74
+,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75
+,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
+,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72
 ,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
-,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52
-,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
 ,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70
-,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69
-,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F
-,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E
-,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61
-,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32
-,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
-,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46
-,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63
-,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D
-,0x20,0x54,0x52,0x49,0x58,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61
-,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76
-,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x52,0x49,0x58,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
-,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x54,0x72,0x69,0x78,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x31,0x2D,0x64,0x61,0x79,0x20,0x52,0x61,0x74,0x65,0x2D,0x4F,0x66,0x2D,0x43
-,0x68,0x61,0x6E,0x67,0x65,0x20,0x28,0x52,0x4F,0x43,0x29,0x20,0x6F,0x66,0x20,0x61,0x20,0x54,0x72,0x69
-,0x70,0x6C,0x65,0x20,0x53,0x6D,0x6F,0x6F,0x74,0x68,0x20,0x45,0x4D,0x41,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
+,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
+,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
+,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70
+,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x46
+,0x69,0x72,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66,0x6F,0x72,0x20
+,0x31,0x73,0x74,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x2E,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65
+,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75
+,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
+,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67
+,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30
+,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x37,0x3C,0x2F,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
+,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x53,0x65,0x63
+,0x6F,0x6E,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E
+,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66,0x72,0x6F,0x20,0x32
+,0x6E,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63
+,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49
+,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52
+,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E
+,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61
+,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75
+,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65
+,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
+,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66
+,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
+,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
+,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x68,0x69,0x72
+,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
+,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66,0x6F,0x72,0x20,0x33,0x72,0x64
+,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74
+,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E
+,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C
+,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69
+,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72
+,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
+,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
+,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
+,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65
+,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x38,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75
+,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
+,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
+,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20
+,0x56,0x41,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46
+,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
+,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x41,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
+,0x3E,0x56,0x61,0x72,0x69,0x61,0x6E,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
+,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x61,0x72,0x69,0x61,0x6E,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72
 ,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61
-,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
+,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74
+,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65
 ,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
 ,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
 ,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44
@@ -8692,200 +9272,125 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
 ,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52
 ,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61
-,0x6C,0x75,0x65,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E
-,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75
-,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x53,0x46,0x20,0x2D,0x2D,0x3E
-,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x53
-,0x46,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x73,0x66,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x69,0x6D,0x65,0x20,0x53
-,0x65,0x72,0x69,0x65,0x73,0x20,0x46,0x6F,0x72,0x65,0x63,0x61,0x73,0x74,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61
-,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C
-,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70
-,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67
-,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D
-,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75
-,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61
-,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45
-,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64
-,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
+,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
+,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x62,0x20,0x6F,0x66,0x20,0x64,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
+,0x6E,0x73,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x3C,0x2F
+,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30,0x30,0x30,0x30
+,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B
+,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x50
+,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74
+,0x61,0x72,0x74,0x3E,0x2D,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75
+,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30
+,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
+,0x6D,0x65,0x6E,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C,0x2F,0x53,0x75
 ,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
 ,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61
-,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74
-,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
-,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67
-,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C
-,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x54,0x59
-,0x50,0x50,0x52,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
-,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65
-,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x59,0x50,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62
-,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C
-,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x79,0x70,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43
-,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F
-,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x54,0x79,0x70,0x69,0x63,0x61
-,0x6C,0x20,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x50,0x72
-,0x69,0x63,0x65,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
-,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
-,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
-,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E
-,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72
-,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
-,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C
-,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61
-,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
-,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x55,0x4C,0x54,0x4F
-,0x53,0x43,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74
-,0x69,0x6F,0x6E,0x3E,0x55,0x4C,0x54,0x4F,0x53,0x43,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
-,0x6D,0x65,0x3E,0x55,0x6C,0x74,0x4F,0x73,0x63,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x55,0x6C,0x74,0x69,0x6D,0x61,0x74,0x65,0x20,0x4F,0x73,0x63,0x69,0x6C
-,0x6C,0x61,0x74,0x6F,0x72,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65
-,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F
-,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71
-,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
+,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
+,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
+,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x57,0x43,0x4C,0x50,0x52,0x49,0x43,0x45,0x20,0x2D,0x2D,0x3E,0x0A
+,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x57,0x43,0x4C
+,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
+,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x57,0x63
+,0x6C,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
+,0x6F,0x6E,0x3E,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20,0x43,0x6C,0x6F,0x73,0x65,0x20,0x50,0x72
+,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x50,0x72,0x69,0x63,0x65,0x20
+,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
+,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F
+,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C
+,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75
 ,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
+,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
+,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D
+,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
+,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
+,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
+,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
 ,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65
-,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72
-,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09
-,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D
-,0x65,0x3E,0x46,0x69,0x72,0x73,0x74,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66
-,0x6F,0x72,0x20,0x31,0x73,0x74,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x2E,0x3C,0x2F,0x53,0x68,0x6F,0x72
-,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
-,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
-,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
-,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
-,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x37,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x53,0x65,0x63,0x6F,0x6E,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69
-,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66,0x72
-,0x6F,0x20,0x32,0x6E,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44
-,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
-,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D
-,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09
-,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65
-,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30
-,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D
-,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F
-,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41
-,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54
-,0x68,0x69,0x72,0x64,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x61,0x72,0x73,0x20,0x66,0x6F,0x72,0x20
-,0x33,0x72,0x64,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
+,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65
+,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C
+,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74
+,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
+,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C
+,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
+,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
+,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x57,0x49,0x4C,0x4C,0x52,0x20,0x2D,0x2D
+,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F
+,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x57
+,0x49,0x4C,0x4C,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A
+,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x57,0x69,0x6C
+,0x6C,0x52,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
+,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x57
+,0x69,0x6C,0x6C,0x69,0x61,0x6D,0x73,0x26,0x61,0x70,0x6F,0x73,0x3B,0x20,0x25,0x52,0x3C,0x2F,0x53,0x68
+,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47
+,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49,0x6E,0x64,0x69
+,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
+,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
+,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
+,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65
+,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71
+,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F
+,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
+,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65
+,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
+,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
+,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65
+,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F
+,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72
+,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
 ,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
 ,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
 ,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D
-,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
+,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D
 ,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D
 ,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53
 ,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74
@@ -8895,7 +9400,7 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30
 ,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
 ,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x32,0x38,0x3C,0x2F,0x44,0x65
+,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C,0x2F,0x44,0x65
 ,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74
 ,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
 ,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
@@ -8910,244 +9415,63 @@ static const char TA_FunctionDescriptionXMLArray[] =
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61
 ,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21
-,0x2D,0x2D,0x20,0x56,0x41,0x52,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
+,0x2D,0x2D,0x20,0x57,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69
 ,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65
-,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x41,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
+,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x57,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69
 ,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E
-,0x61,0x6D,0x65,0x3E,0x56,0x61,0x72,0x69,0x61,0x6E,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43
-,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x56,0x61,0x72,0x69,0x61,0x6E,0x63,0x65,0x3C,0x2F,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C
-,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x20,0x46,0x75
-,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09
-,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x61,0x6D,0x65,0x3E,0x57,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61
+,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
+,0x69,0x6F,0x6E,0x3E,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20,0x4D,0x6F,0x76,0x69,0x6E,0x67,0x20
+,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
+,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4F,0x76
+,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70
+,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C
+,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09
+,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
+,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
+,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20
+,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
+,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09
+,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D
+,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
+,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
+,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
+,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
+,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D
+,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
+,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75
+,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72
+,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
+,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E
+,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
+,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D
+,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73
+,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67
+,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
+,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
+,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31
+,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72
+,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
+,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x33,0x30
+,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
+,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
+,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
+,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70
 ,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70
 ,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73
-,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61
-,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E
-,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72
-,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72
-,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x3C,0x2F,0x4D,0x69,0x6E
-,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E
-,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64
-,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C
-,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x35,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C
-,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69
-,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x44,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x73,0x3C
-,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x62,0x20,0x6F,0x66,0x20,0x64,0x65,0x76,0x69,0x61
-,0x74,0x69,0x6F,0x6E,0x73,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74
-,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C
-,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x2D,0x33,0x2E,0x30,0x30
-,0x30,0x30,0x30,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x33,0x2E,0x30,0x30,0x30,0x30,0x30
-,0x30,0x65,0x2B,0x33,0x37,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x50,0x72,0x65,0x63,0x69,0x73,0x69,0x6F,0x6E,0x3E,0x32,0x3C,0x2F,0x50,0x72,0x65,0x63,0x69
-,0x73,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65
-,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x2D,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x32,0x2E,0x30,0x30
-,0x30,0x30,0x30,0x30,0x65,0x2B,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E
-,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E
-,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x32,0x2E,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2D,0x31,0x3C
-,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44
-,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x2E,0x30,0x30,0x30,0x30,0x30,0x30
-,0x65,0x2B,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
-,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x57,0x43,0x4C,0x50,0x52,0x49,0x43,0x45,0x20,0x2D
-,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E
-,0x57,0x43,0x4C,0x50,0x52,0x49,0x43,0x45,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69
-,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
-,0x3E,0x57,0x63,0x6C,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69
-,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20,0x43,0x6C,0x6F,0x73,0x65
-,0x20,0x50,0x72,0x69,0x63,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x50,0x72,0x69
-,0x63,0x65,0x20,0x54,0x72,0x61,0x6E,0x73,0x66,0x6F,0x72,0x6D,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49
-,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61
-,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x3C
-,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52
-,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79
-,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65
-,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61
-,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70
-,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75
-,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72
-,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69
-,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E
-,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x57,0x49,0x4C,0x4C,0x52
-,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63
-,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x57,0x49,0x4C,0x4C,0x52,0x3C,0x2F,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F
-,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E
-,0x57,0x69,0x6C,0x6C,0x52,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73,0x65,0x4E,0x61,0x6D,0x65
-,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F
-,0x6E,0x3E,0x57,0x69,0x6C,0x6C,0x69,0x61,0x6D,0x73,0x26,0x61,0x70,0x6F,0x73,0x3B,0x20,0x25,0x52,0x3C
-,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09
-,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x4D,0x6F,0x6D,0x65,0x6E,0x74,0x75,0x6D,0x20,0x49
-,0x6E,0x64,0x69,0x63,0x61,0x74,0x6F,0x72,0x73,0x3C,0x2F,0x47,0x72,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54
-,0x79,0x70,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x48,0x69,0x67,0x68,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E
-,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E
-,0x61,0x6D,0x65,0x3E,0x4C,0x6F,0x77,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E
-,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61
-,0x6D,0x65,0x3E,0x43,0x6C,0x6F,0x73,0x65,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C
-,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65
-,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F
-,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x54,0x69,0x6D,0x65
-,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x4E,0x75,0x6D
-,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74
-,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79
-,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x69,0x6E,0x69
-,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x4D,0x61
-,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74
-,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67
-,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75
-,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53
-,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x31,0x30
-,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x31,0x34,0x3C
-,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
-,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E
-,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x75,0x74,0x70,0x75
-,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65
-,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C,0x2F
-,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
-,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F,0x46
-,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A,0x0A
-,0x09,0x3C,0x21,0x2D,0x2D,0x20,0x57,0x4D,0x41,0x20,0x2D,0x2D,0x3E,0x0A,0x09,0x3C,0x46,0x69,0x6E,0x61
-,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x41,0x62
-,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x57,0x4D,0x41,0x3C,0x2F,0x41,0x62,0x62,0x72
-,0x65,0x76,0x69,0x61,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61
-,0x73,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x57,0x6D,0x61,0x3C,0x2F,0x43,0x61,0x6D,0x65,0x6C,0x43,0x61,0x73
-,0x65,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72
-,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x57,0x65,0x69,0x67,0x68,0x74,0x65,0x64,0x20,0x4D,0x6F,0x76,0x69
-,0x6E,0x67,0x20,0x41,0x76,0x65,0x72,0x61,0x67,0x65,0x3C,0x2F,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73
-,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x3C,0x47,0x72,0x6F,0x75,0x70,0x49,0x64
-,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x20,0x53,0x74,0x75,0x64,0x69,0x65,0x73,0x3C,0x2F,0x47,0x72
-,0x6F,0x75,0x70,0x49,0x64,0x3E,0x0A,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09
-,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4F,0x76,0x65,0x72,0x6C,0x61,0x70,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x3E
-,0x0A,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69
-,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75
-,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62
-,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x69,0x6E,0x52,0x65,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A
-,0x09,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64,0x49,0x6E,0x70,0x75,0x74,0x41,0x72
-,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x64
-,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F
-,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74
-,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74
-,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E
-,0x54,0x69,0x6D,0x65,0x20,0x50,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x09,0x3C,0x53,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E
-,0x3E,0x4E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x70,0x65,0x72,0x69,0x6F,0x64,0x3C,0x2F,0x53
-,0x68,0x6F,0x72,0x74,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x3C,0x54,0x79,0x70,0x65,0x3E,0x49,0x6E,0x74,0x65,0x67,0x65,0x72,0x3C,0x2F,0x54,0x79,0x70,0x65
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x52,0x61,0x6E,0x67,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C
-,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x32,0x3C,0x2F,0x4D,0x69,0x6E,0x69,0x6D,0x75,0x6D,0x3E,0x0A
-,0x09,0x09,0x09,0x09,0x09,0x3C,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x31,0x30,0x30,0x30,0x30,0x30
-,0x3C,0x2F,0x4D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x53,0x75,0x67
-,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F
-,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x53,0x74,0x61,0x72,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09
-,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x31,0x30,0x30,0x30,0x30
-,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x45,0x6E,0x64,0x3E,0x0A,0x09,0x09,0x09
-,0x09,0x09,0x3C,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E
-,0x74,0x3E,0x31,0x30,0x30,0x30,0x30,0x30,0x3C,0x2F,0x53,0x75,0x67,0x67,0x65,0x73,0x74,0x65,0x64,0x49
-,0x6E,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x52,0x61,0x6E,0x67
-,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65
-,0x3E,0x33,0x30,0x3C,0x2F,0x44,0x65,0x66,0x61,0x75,0x6C,0x74,0x56,0x61,0x6C,0x75,0x65,0x3E,0x0A,0x09
-,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49,0x6E,0x70,0x75,0x74,0x41,0x72,0x67
-,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F,0x4F,0x70,0x74,0x69,0x6F,0x6E,0x61,0x6C,0x49
-,0x6E,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x3C,0x4F,0x75
-,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x4F
-,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C
-,0x54,0x79,0x70,0x65,0x3E,0x44,0x6F,0x75,0x62,0x6C,0x65,0x20,0x41,0x72,0x72,0x61,0x79,0x3C,0x2F,0x54
-,0x79,0x70,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65
-,0x61,0x6C,0x3C,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73
-,0x3E,0x0A,0x09,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46
-,0x6C,0x61,0x67,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09
-,0x09,0x3C,0x2F,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A
-,0x09,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
-,0x3E,0x0A,0x0A,0x0A,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74
-,0x69,0x6F,0x6E,0x73,0x3E,0x0A};
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x4E,0x61,0x6D,0x65,0x3E,0x6F,0x75,0x74,0x52,0x65,0x61,0x6C,0x3C
+,0x2F,0x4E,0x61,0x6D,0x65,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09
+,0x09,0x09,0x09,0x09,0x3C,0x46,0x6C,0x61,0x67,0x3E,0x4C,0x69,0x6E,0x65,0x3C,0x2F,0x46,0x6C,0x61,0x67
+,0x3E,0x0A,0x09,0x09,0x09,0x09,0x3C,0x2F,0x46,0x6C,0x61,0x67,0x73,0x3E,0x0A,0x09,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x3E,0x0A,0x09,0x09,0x3C,0x2F
+,0x4F,0x75,0x74,0x70,0x75,0x74,0x41,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x3E,0x0A,0x09,0x3C,0x2F
+,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x3E,0x0A,0x0A
+,0x0A,0x3C,0x2F,0x46,0x69,0x6E,0x61,0x6E,0x63,0x69,0x61,0x6C,0x46,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E
+,0x73,0x3E,0x0A};
 
 const char *TA_FunctionDescriptionXML()
 {
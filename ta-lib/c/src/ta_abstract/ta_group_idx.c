@@ -133,6 +133,8 @@ extern const TA_FuncDef TA_DEF_CMO;
 extern const TA_FuncDef TA_DEF_CORREL;
 extern const TA_FuncDef TA_DEF_COS;
 extern const TA_FuncDef TA_DEF_COSH;
+extern const TA_FuncDef TA_DEF_CROSSOVER;
+extern const TA_FuncDef TA_DEF_CROSSUNDER;
 extern const TA_FuncDef TA_DEF_DEMA;
 extern const TA_FuncDef TA_DEF_DIV;
 extern const TA_FuncDef TA_DEF_DX;
@@ -157,10 +159,12 @@ extern const TA_FuncDef TA_DEF_MA;
 extern const TA_FuncDef TA_DEF_MACD;
 extern const TA_FuncDef TA_DEF_MACDEXT;
 extern const TA_FuncDef TA_DEF_MACDFIX;
+extern const TA_FuncDef TA_DEF_MAD;
 extern const TA_FuncDef TA_DEF_MAMA;
 extern const TA_FuncDef TA_DEF_MAVP;
 extern const TA_FuncDef TA_DEF_MAX;
 extern const TA_FuncDef TA_DEF_MAXINDEX;
+extern const TA_FuncDef TA_DEF_MEDIAN;
 extern const TA_FuncDef TA_DEF_MEDPRICE;
 extern const TA_FuncDef TA_DEF_MFI;
 extern const TA_FuncDef TA_DEF_MIDPOINT;
@@ -178,6 +182,7 @@ extern const TA_FuncDef TA_DEF_OBV;
 extern const TA_FuncDef TA_DEF_PLUS_DI;
 extern const TA_FuncDef TA_DEF_PLUS_DM;
 extern const TA_FuncDef TA_DEF_PPO;
+extern const TA_FuncDef TA_DEF_QUANTILE;
 extern const TA_FuncDef TA_DEF_ROC;
 extern const TA_FuncDef TA_DEF_ROCP;
 extern const TA_FuncDef TA_DEF_ROCR;
@@ -199,6 +204,7 @@ extern const TA_FuncDef TA_DEF_T3;
 extern const TA_FuncDef TA_DEF_TAN;
 extern const TA_FuncDef TA_DEF_TANH;
 extern const TA_FuncDef TA_DEF_TEMA;
+extern const TA_FuncDef TA_DEF_THRESHOLD_EVENTS;
 extern const TA_FuncDef TA_DEF_TRANGE;
 extern const TA_FuncDef TA_DEF_TRIMA;
 extern const TA_FuncDef TA_DEF_TRIX;
@@ -212,6 +218,8 @@ extern const TA_FuncDef TA_DEF_WMA;
 
 const TA_FuncDef *TA_PerGroupFunc_0[] = {
 &TA_DEF_ADD,
+&TA_DEF_CROSSOVER,
+&TA_DEF_CROSSUNDER,
 &TA_DEF_DIV,
 &TA_DEF_MAX,
 &TA_DEF_MAXINDEX,
@@ -222,6 +230,7 @@ const TA_FuncDef *TA_PerGroupFunc_0[] = {
 &TA_DEF_MULT,
 &TA_DEF_SUB,
 &TA_DEF_SUM,
+&TA_DEF_THRESHOLD_EVENTS,
 NULL };
 #define SIZE_GROUP_0 ((sizeof(TA_PerGroupFunc_0)/sizeof(const TA_FuncDef *))-1)
 
@@ -396,6 +405,9 @@ const TA_FuncDef *TA_PerGroupFunc_8[] = {
 &TA_DEF_LINEARREG_ANGLE,
 &TA_DEF_LINEARREG_INTERCEPT,
 &TA_DEF_LINEARREG_SLOPE,
+&TA_DEF_MAD,
+&TA_DEF_MEDIAN,
+&TA_DEF_QUANTILE,
 &TA_DEF_STDDEV,
 &TA_DEF_TSF,
 &TA_DEF_VAR,
@@ -208,6 +208,10 @@
 #define TA_COS cos
 #define TA_COSH_Lookback coshLookback
 #define TA_COSH cosh
+#define TA_CROSSOVER_Lookback crossOverLookback
+#define TA_CROSSOVER crossOver
+#define TA_CROSSUNDER_Lookback crossUnderLookback
+#define TA_CROSSUNDER crossUnder
 #define TA_DEMA_Lookback demaLookback
 #define TA_DEMA dema
 #define TA_DIV_Lookback divLookback
@@ -256,6 +260,8 @@
 #define TA_MACDEXT macdExt
 #define TA_MACDFIX_Lookback macdFixLookback
 #define TA_MACDFIX macdFix
+#define TA_MAD_Lookback medianAbsDevLookback
+#define TA_MAD medianAbsDev
 #define TA_MAMA_Lookback mamaLookback
 #define TA_MAMA mama
 #define TA_MAVP_Lookback movingAverageVariablePeriodLookback
@@ -264,6 +270,8 @@
 #define TA_MAX max
 #define TA_MAXINDEX_Lookback maxIndexLookback
 #define TA_MAXINDEX maxIndex
+#define TA_MEDIAN_Lookback medianLookback
+#define TA_MEDIAN median
 #define TA_MEDPRICE_Lookback medPriceLookback
 #define TA_MEDPRICE medPrice
 #define TA_MFI_Lookback mfiLookback
@@ -298,6 +306,8 @@
 #define TA_PLUS_DM plusDM
 #define TA_PPO_Lookback ppoLookback
 #define TA_PPO ppo
+#define TA_QUANTILE_Lookback quantileLookback
+#define TA_QUANTILE quantile
 #define TA_ROC_Lookback rocLookback
 #define TA_ROC roc
 #define TA_ROCP_Lookback rocPLookback
@@ -340,6 +350,8 @@
 #define TA_TANH tanh
 #define TA_TEMA_Lookback temaLookback
 #define TA_TEMA tema
+#define TA_THRESHOLD_EVENTS_Lookback thresholdEventsLookback
+#define TA_THRESHOLD_EVENTS thresholdEvents
 #define TA_TRANGE_Lookback trueRangeLookback
 #define TA_TRANGE trueRange
 #define TA_TRIMA_Lookback trimaLookback
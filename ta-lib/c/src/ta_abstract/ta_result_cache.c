@@ -0,0 +1,835 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Cache of the outputs of the abstract calls (see TA_SetParamHolderCache).
+ *
+ *   The entries are in a hash table for the lookup and in a doubly
+ *   linked list, from the most to the least recently used, for the
+ *   eviction.
+ *
+ *   The output of an entry is kept from its outBegIdx, as returned
+ *   by TA_CallFunc. The TA functions are causal (the output at an
+ *   index depends only on the input up to that index), so an entry
+ *   calculated up to 'endIdx' can serve any call up to that endIdx.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_global.h"
+#include "ta_abstract.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+#include "ta_magic_nb.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct TA_CacheEntry
+{
+   /* Key of the calculation. With a seriesId of zero, 'version' is the
+    * hash of the inputs and the entry is only for the same endIdx.
+    */
+   UInt64 hash;
+   const TA_FuncInfo *funcInfo;
+   UInt64 seriesId;
+   UInt64 version;
+   UInt64 globalsHash;
+   TA_Integer startIdx;
+   union TA_ParamHolderOptInData *optIn;
+
+   /* Output for the inputs from outBegIdx to outBegIdx+outNbElement-1,
+    * calculated up to endIdx. The buffers have 'capacity' elements.
+    */
+   TA_Integer endIdx;
+   TA_Integer outBegIdx;
+   TA_Integer outNbElement;
+   TA_Integer capacity;
+   void **buffer;
+
+   /* Param holder outputs pointing in the buffers. */
+   TA_ParamHolderOutput *out;
+
+   /* Inputs shifted to the first new bar when resuming. */
+   TA_ParamHolderInput *in;
+
+   /* State at endIdx when the function supports the checkpoints. */
+   int hasCheckpoint;
+   TA_Checkpoint checkpoint;
+
+   unsigned int nbBytes;
+
+   struct TA_CacheEntry *nextInBucket;
+   struct TA_CacheEntry *prev; /* More recently used. */
+   struct TA_CacheEntry *next; /* Less recently used. */
+} TA_CacheEntry;
+
+typedef struct
+{
+   unsigned int magicNumber;
+
+   unsigned int maxEntry;
+   unsigned int maxBytes;
+
+   /* Hash table, nbBucket is a power of two. */
+   unsigned int nbBucket;
+   TA_CacheEntry **bucket;
+
+   /* Most and least recently used. */
+   TA_CacheEntry *head;
+   TA_CacheEntry *tail;
+
+   TA_ResultCacheStats stats;
+} TA_ResultCachePriv;
+
+/**** Local functions declarations.    ****/
+static UInt64 hashBytes( UInt64 hash, const void *data, size_t size );
+static UInt64 hashInputs( const TA_ParamHolderPriv *params,
+                          TA_Integer startIdx, TA_Integer endIdx );
+static UInt64 hashGlobals( void );
+static int isSameKey( const TA_CacheEntry *entry,
+                      const TA_CacheEntry *key,
+                      const TA_ParamHolderPriv *params );
+
+static TA_CacheEntry *allocEntry( const TA_CacheEntry *key,
+                                  const TA_ParamHolderPriv *params,
+                                  TA_Integer capacity );
+static void freeEntry( TA_CacheEntry *entry );
+static TA_RetCode growEntry( TA_ResultCachePriv *cachePriv,
+                             TA_CacheEntry *entry,
+                             TA_Integer capacity );
+static void setEntryOutput( TA_CacheEntry *entry, TA_Integer offset );
+
+static TA_RetCode calcEntry( const TA_ParamHolderPriv *params,
+                             TA_CacheEntry *entry,
+                             TA_Integer endIdx );
+static TA_RetCode extendEntry( TA_ResultCachePriv *cachePriv,
+                               const TA_ParamHolderPriv *params,
+                               TA_CacheEntry *entry,
+                               TA_Integer endIdx );
+static void copyOutput( const TA_ParamHolderPriv *params,
+                        const TA_CacheEntry *entry,
+                        TA_Integer endIdx,
+                        TA_Integer *outBegIdx,
+                        TA_Integer *outNbElement );
+
+static void insertEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry );
+static void removeEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry );
+static void touchEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry );
+static void evictEntries( TA_ResultCachePriv *cachePriv );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_ResultCacheAlloc( unsigned int maxEntry,
+                                unsigned int maxBytes,
+                                TA_ResultCache **allocatedCache )
+{
+   TA_ResultCache *newCache;
+   TA_ResultCachePriv *cachePriv;
+   unsigned int nbBucket;
+
+   if( !allocatedCache )
+      return TA_BAD_PARAM;
+
+   *allocatedCache = NULL;
+
+   if( (maxEntry == 0) || (maxBytes == 0) )
+      return TA_BAD_PARAM;
+
+   newCache = (TA_ResultCache *)TA_Malloc( sizeof(TA_ResultCache) + sizeof(TA_ResultCachePriv) );
+   if( !newCache )
+      return TA_ALLOC_ERR;
+
+   memset( newCache, 0, sizeof(TA_ResultCache) + sizeof(TA_ResultCachePriv) );
+   cachePriv = (TA_ResultCachePriv *)(((char *)newCache)+sizeof(TA_ResultCache));
+   cachePriv->magicNumber = TA_RESULT_CACHE_MAGIC_NB;
+   cachePriv->maxEntry    = maxEntry;
+   cachePriv->maxBytes    = maxBytes;
+   newCache->hiddenData   = cachePriv;
+
+   /* About one entry per bucket when full. */
+   nbBucket = 16;
+   while( (nbBucket < maxEntry) && (nbBucket < 0x100000) )
+      nbBucket <<= 1;
+
+   cachePriv->bucket = (TA_CacheEntry **)TA_Malloc( nbBucket*sizeof(TA_CacheEntry *) );
+   if( !cachePriv->bucket )
+   {
+      TA_Free( newCache );
+      return TA_ALLOC_ERR;
+   }
+   memset( cachePriv->bucket, 0, nbBucket*sizeof(TA_CacheEntry *) );
+   cachePriv->nbBucket = nbBucket;
+
+   *allocatedCache = newCache;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResultCacheFree( TA_ResultCache *cache )
+{
+   TA_ResultCachePriv *cachePriv;
+   TA_RetCode retCode;
+
+   retCode = TA_ResultCacheClear( cache );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   cachePriv = (TA_ResultCachePriv *)cache->hiddenData;
+   cachePriv->magicNumber = 0;
+   FREE_IF_NOT_NULL( cachePriv->bucket );
+   TA_Free( cache );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResultCacheClear( TA_ResultCache *cache )
+{
+   TA_ResultCachePriv *cachePriv;
+
+   if( !cache )
+      return TA_BAD_PARAM;
+
+   cachePriv = (TA_ResultCachePriv *)cache->hiddenData;
+   if( !cachePriv || (cachePriv->magicNumber != TA_RESULT_CACHE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   while( cachePriv->head )
+      removeEntry( cachePriv, cachePriv->head );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResultCacheGetStats( const TA_ResultCache *cache,
+                                   TA_ResultCacheStats *stats )
+{
+   const TA_ResultCachePriv *cachePriv;
+
+   if( !cache || !stats )
+      return TA_BAD_PARAM;
+
+   cachePriv = (const TA_ResultCachePriv *)cache->hiddenData;
+   if( !cachePriv || (cachePriv->magicNumber != TA_RESULT_CACHE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   *stats = cachePriv->stats;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ResultCacheCall( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement )
+{
+   TA_ResultCachePriv *cachePriv;
+   const TA_FuncDef *funcDef;
+   TA_CacheEntry key, *entry;
+   TA_ParamHolderPriv direct;
+   TA_ParamHolder holder;
+   TA_Integer lookback, i;
+   UInt64 hash, nbBytes;
+   TA_RetCode retCode;
+
+   cachePriv = (TA_ResultCachePriv *)params->cache->hiddenData;
+   if( !cachePriv || (cachePriv->magicNumber != TA_RESULT_CACHE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   funcDef = (const TA_FuncDef *)params->funcInfo->handle;
+
+   /* Build the key. */
+   memset( &key, 0, sizeof(key) );
+   key.funcInfo = params->funcInfo;
+   key.seriesId = params->seriesId;
+   key.startIdx = startIdx;
+   key.endIdx   = endIdx;
+   if( key.seriesId )
+      key.version = params->seriesVersion;
+   else
+   {
+      lookback = (*funcDef->lookback)( params );
+      key.version = hashInputs( params, startIdx > lookback? startIdx-lookback : 0, endIdx );
+   }
+   key.globalsHash = hashGlobals();
+
+   hash = hashBytes( key.globalsHash, &key.funcInfo, sizeof(key.funcInfo) );
+   hash = hashBytes( hash, &key.seriesId, sizeof(key.seriesId) );
+   hash = hashBytes( hash, &key.version, sizeof(key.version) );
+   hash = hashBytes( hash, &key.startIdx, sizeof(key.startIdx) );
+   if( !key.seriesId )
+      hash = hashBytes( hash, &key.endIdx, sizeof(key.endIdx) );
+   for( i=0; i < (TA_Integer)params->funcInfo->nbOptInput; i++ )
+      hash = hashBytes( hash, &params->optIn[i].data, sizeof(params->optIn[i].data) );
+   key.hash = hash;
+
+   /* Lookup. */
+   entry = cachePriv->bucket[hash&(cachePriv->nbBucket-1)];
+   while( entry && !isSameKey( entry, &key, params ) )
+      entry = entry->nextInBucket;
+
+   if( entry )
+   {
+      if( endIdx > entry->endIdx )
+      {
+         retCode = extendEntry( cachePriv, params, entry, endIdx );
+         if( retCode != TA_SUCCESS )
+         {
+            removeEntry( cachePriv, entry );
+            return retCode;
+         }
+         cachePriv->stats.nbExtend++;
+      }
+      else
+         cachePriv->stats.nbHit++;
+
+      touchEntry( cachePriv, entry );
+      copyOutput( params, entry, endIdx, outBegIdx, outNbElement );
+      evictEntries( cachePriv );
+      return TA_SUCCESS;
+   }
+
+   cachePriv->stats.nbMiss++;
+
+   /* A calculation larger than the cache is done directly. */
+   nbBytes = sizeof(TA_CacheEntry) +
+             (UInt64)params->funcInfo->nbOutput*(endIdx-startIdx+1)*sizeof(TA_Real);
+   if( nbBytes > cachePriv->maxBytes )
+   {
+      direct = *params;
+      direct.cache = NULL;
+      holder.hiddenData = &direct;
+      return TA_CallFunc( &holder, startIdx, endIdx, outBegIdx, outNbElement );
+   }
+
+   entry = allocEntry( &key, params, endIdx-startIdx+1 );
+   if( !entry )
+      return TA_ALLOC_ERR;
+
+   retCode = calcEntry( params, entry, endIdx );
+   if( retCode != TA_SUCCESS )
+   {
+      freeEntry( entry );
+      return retCode;
+   }
+
+   insertEntry( cachePriv, entry );
+   copyOutput( params, entry, endIdx, outBegIdx, outNbElement );
+   evictEntries( cachePriv );
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* FNV-1a */
+static UInt64 hashBytes( UInt64 hash, const void *data, size_t size )
+{
+   const unsigned char *bytes;
+   UInt64 prime;
+   size_t i;
+
+   prime = (((UInt64)0x100)<<32)|0x1B3;
+   bytes = (const unsigned char *)data;
+   for( i=0; i < size; i++ )
+   {
+      hash ^= bytes[i];
+      hash *= prime;
+   }
+
+   return hash;
+}
+
+/* Hash of the inputs from startIdx to endIdx. */
+static UInt64 hashInputs( const TA_ParamHolderPriv *params,
+                          TA_Integer startIdx, TA_Integer endIdx )
+{
+   const TA_ParamHolderInput *in;
+   const TA_Real *price[6];
+   size_t nbElement;
+   unsigned int i, j;
+   UInt64 hash;
+
+   hash = (((UInt64)0xCBF29CE4)<<32)|0x84222325;
+   nbElement = (size_t)(endIdx-startIdx+1);
+   for( i=0; i < params->funcInfo->nbInput; i++ )
+   {
+      in = &params->in[i];
+      switch( in->inputInfo->type )
+      {
+      case TA_Input_Real:
+         hash = hashBytes( hash, in->data.inReal+startIdx, nbElement*sizeof(TA_Real) );
+         break;
+      case TA_Input_Integer:
+         hash = hashBytes( hash, in->data.inInteger+startIdx, nbElement*sizeof(TA_Integer) );
+         break;
+      case TA_Input_Price:
+         price[0] = in->data.inPrice.open;
+         price[1] = in->data.inPrice.high;
+         price[2] = in->data.inPrice.low;
+         price[3] = in->data.inPrice.close;
+         price[4] = in->data.inPrice.volume;
+         price[5] = in->data.inPrice.openInterest;
+         for( j=0; j < 6; j++ )
+         {
+            if( price[j] )
+               hash = hashBytes( hash, price[j]+startIdx, nbElement*sizeof(TA_Real) );
+         }
+         break;
+      }
+   }
+
+   return hash;
+}
+
+/* Hash of the global settings changing the output. */
+static UInt64 hashGlobals( void )
+{
+   UInt64 hash;
+
+   hash = (((UInt64)0xCBF29CE4)<<32)|0x84222325;
+   hash = hashBytes( hash, &TA_Globals->compatibility, sizeof(TA_Globals->compatibility) );
+   hash = hashBytes( hash, TA_Globals->unstablePeriod, sizeof(TA_Globals->unstablePeriod) );
+
+   return hash;
+}
+
+static int isSameKey( const TA_CacheEntry *entry,
+                      const TA_CacheEntry *key,
+                      const TA_ParamHolderPriv *params )
+{
+   const TA_OptInputParameterInfo *optInputInfo;
+   unsigned int i;
+
+   if( (entry->hash        != key->hash)        ||
+       (entry->funcInfo    != key->funcInfo)    ||
+       (entry->seriesId    != key->seriesId)    ||
+       (entry->version     != key->version)     ||
+       (entry->globalsHash != key->globalsHash) ||
+       (entry->startIdx    != key->startIdx) )
+      return 0;
+
+   if( !key->seriesId && (entry->endIdx != key->endIdx) )
+      return 0;
+
+   for( i=0; i < params->funcInfo->nbOptInput; i++ )
+   {
+      optInputInfo = params->optIn[i].optInputInfo;
+      if( (optInputInfo->type == TA_OptInput_RealRange) ||
+          (optInputInfo->type == TA_OptInput_RealList) )
+      {
+         if( memcmp( &entry->optIn[i].optInReal, &params->optIn[i].data.optInReal, sizeof(TA_Real) ) != 0 )
+            return 0;
+      }
+      else if( entry->optIn[i].optInInteger != params->optIn[i].data.optInInteger )
+         return 0;
+   }
+
+   return 1;
+}
+
+/* Allocate an entry for the key, with no output yet. */
+static TA_CacheEntry *allocEntry( const TA_CacheEntry *key,
+                                  const TA_ParamHolderPriv *params,
+                                  TA_Integer capacity )
+{
+   TA_CacheEntry *entry;
+   const TA_FuncInfo *funcInfo;
+   unsigned int i, size;
+
+   funcInfo = params->funcInfo;
+   size = sizeof(TA_CacheEntry) +
+          funcInfo->nbOptInput*sizeof(union TA_ParamHolderOptInData) +
+          funcInfo->nbOutput*(sizeof(void *)+sizeof(TA_ParamHolderOutput)) +
+          funcInfo->nbInput*sizeof(TA_ParamHolderInput);
+
+   entry = (TA_CacheEntry *)TA_Malloc( size );
+   if( !entry )
+      return NULL;
+
+   *entry = *key;
+   entry->optIn  = (union TA_ParamHolderOptInData *)(entry+1);
+   entry->buffer = (void **)(entry->optIn+funcInfo->nbOptInput);
+   entry->out    = (TA_ParamHolderOutput *)(entry->buffer+funcInfo->nbOutput);
+   entry->in     = (TA_ParamHolderInput *)(entry->out+funcInfo->nbOutput);
+   entry->nbBytes = size;
+   entry->capacity = 0;
+   entry->outBegIdx = 0;
+   entry->outNbElement = 0;
+   entry->hasCheckpoint = 0;
+   entry->nextInBucket = entry->prev = entry->next = NULL;
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+      entry->optIn[i] = params->optIn[i].data;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      entry->buffer[i] = NULL;
+      entry->out[i].outputInfo = params->out[i].outputInfo;
+   }
+
+   if( growEntry( NULL, entry, capacity ) != TA_SUCCESS )
+   {
+      freeEntry( entry );
+      return NULL;
+   }
+
+   return entry;
+}
+
+static void freeEntry( TA_CacheEntry *entry )
+{
+   unsigned int i;
+
+   for( i=0; i < entry->funcInfo->nbOutput; i++ )
+      FREE_IF_NOT_NULL( entry->buffer[i] );
+
+   TA_Free( entry );
+}
+
+/* Grow the output buffers to at least 'capacity' elements. */
+static TA_RetCode growEntry( TA_ResultCachePriv *cachePriv,
+                             TA_CacheEntry *entry,
+                             TA_Integer capacity )
+{
+   unsigned int i, elementSize, nbBytes;
+   void *newBuffer;
+
+   if( capacity <= entry->capacity )
+      return TA_SUCCESS;
+
+   /* Room for the following bars when growing an existing entry. */
+   if( (entry->capacity > 0) && (capacity < 2*entry->capacity) )
+      capacity = 2*entry->capacity;
+
+   nbBytes = 0;
+   for( i=0; i < entry->funcInfo->nbOutput; i++ )
+   {
+      if( entry->out[i].outputInfo->type == TA_Output_Integer )
+         elementSize = sizeof(TA_Integer);
+      else
+         elementSize = sizeof(TA_Real);
+
+      newBuffer = TA_Realloc( entry->buffer[i], capacity*elementSize );
+      if( !newBuffer )
+         return TA_ALLOC_ERR;
+      entry->buffer[i] = newBuffer;
+      nbBytes += (capacity-entry->capacity)*elementSize;
+   }
+
+   entry->capacity = capacity;
+   entry->nbBytes += nbBytes;
+   if( cachePriv )
+      cachePriv->stats.nbBytes += nbBytes;
+
+   return TA_SUCCESS;
+}
+
+/* Point the param holder outputs of the entry at 'offset' in the buffers. */
+static void setEntryOutput( TA_CacheEntry *entry, TA_Integer offset )
+{
+   unsigned int i;
+
+   for( i=0; i < entry->funcInfo->nbOutput; i++ )
+   {
+      if( entry->out[i].outputInfo->type == TA_Output_Integer )
+         entry->out[i].data.outInteger = ((TA_Integer *)entry->buffer[i])+offset;
+      else
+         entry->out[i].data.outReal = ((TA_Real *)entry->buffer[i])+offset;
+   }
+}
+
+/* Calculate the entry from its startIdx up to endIdx, saving a
+ * checkpoint when the function supports it.
+ */
+static TA_RetCode calcEntry( const TA_ParamHolderPriv *params,
+                             TA_CacheEntry *entry,
+                             TA_Integer endIdx )
+{
+   TA_ParamHolderPriv calc;
+   TA_ParamHolder holder;
+   TA_RetCode retCode;
+
+   calc = *params;
+   calc.cache = NULL;
+   calc.out   = entry->out;
+   holder.hiddenData = &calc;
+   setEntryOutput( entry, 0 );
+
+   entry->hasCheckpoint = 0;
+   retCode = TA_NOT_SUPPORTED;
+   if( entry->seriesId && !TA_IsWindowFunc( params->funcInfo ) )
+   {
+      retCode = TA_CallFuncCheckpoint( &holder, entry->startIdx, endIdx,
+                                       &entry->outBegIdx, &entry->outNbElement,
+                                       &entry->checkpoint );
+      if( retCode == TA_SUCCESS )
+         entry->hasCheckpoint = 1;
+   }
+
+   if( (retCode == TA_NOT_SUPPORTED) || (retCode == TA_OUT_OF_RANGE_END_INDEX) )
+      retCode = TA_CallFunc( &holder, entry->startIdx, endIdx,
+                             &entry->outBegIdx, &entry->outNbElement );
+
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   entry->endIdx = endIdx;
+
+   return TA_SUCCESS;
+}
+
+/* Calculate the bars after the endIdx of the entry up to 'endIdx'. */
+static TA_RetCode extendEntry( TA_ResultCachePriv *cachePriv,
+                               const TA_ParamHolderPriv *params,
+                               TA_CacheEntry *entry,
+                               TA_Integer endIdx )
+{
+   TA_ParamHolderPriv calc;
+   TA_ParamHolder holder;
+   TA_ParamHolderInput *in;
+   TA_Integer nbNewBar, firstIdx, outBegIdx, outNbElement;
+   unsigned int i;
+   TA_RetCode retCode;
+
+   nbNewBar = endIdx-entry->endIdx;
+   retCode = growEntry( cachePriv, entry, entry->outNbElement+nbNewBar );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   calc = *params;
+   calc.cache = NULL;
+   calc.out   = entry->out;
+   holder.hiddenData = &calc;
+   setEntryOutput( entry, entry->outNbElement );
+   firstIdx = entry->endIdx+1;
+
+   if( TA_IsWindowFunc( params->funcInfo ) )
+   {
+      /* Same output as if calculated from the startIdx. */
+      retCode = TA_CallFunc( &holder, firstIdx, endIdx,
+                             &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+
+      if( outNbElement > 0 )
+      {
+         if( entry->outNbElement == 0 )
+            entry->outBegIdx = outBegIdx;
+         else if( outBegIdx != entry->outBegIdx+entry->outNbElement )
+            return TA_INTERNAL_ERROR(181);
+         entry->outNbElement += outNbElement;
+      }
+   }
+   else if( entry->hasCheckpoint )
+   {
+      /* Resume with the inputs starting at the first new bar. */
+      for( i=0; i < params->funcInfo->nbInput; i++ )
+      {
+         in = &entry->in[i];
+         *in = params->in[i];
+         in->index = NULL;
+         switch( in->inputInfo->type )
+         {
+         case TA_Input_Real:
+            in->data.inReal += firstIdx;
+            break;
+         case TA_Input_Integer:
+            in->data.inInteger += firstIdx;
+            break;
+         case TA_Input_Price:
+            if( in->data.inPrice.open )         in->data.inPrice.open += firstIdx;
+            if( in->data.inPrice.high )         in->data.inPrice.high += firstIdx;
+            if( in->data.inPrice.low )          in->data.inPrice.low += firstIdx;
+            if( in->data.inPrice.close )        in->data.inPrice.close += firstIdx;
+            if( in->data.inPrice.volume )       in->data.inPrice.volume += firstIdx;
+            if( in->data.inPrice.openInterest ) in->data.inPrice.openInterest += firstIdx;
+            break;
+         }
+      }
+      calc.in = entry->in;
+
+      retCode = TA_CallFuncResume( &holder, &entry->checkpoint, nbNewBar,
+                                   &outNbElement, &entry->checkpoint );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      if( outNbElement != nbNewBar )
+         return TA_INTERNAL_ERROR(182);
+      entry->outNbElement += outNbElement;
+   }
+   else
+   {
+      /* Depends on the whole history: calculate again. */
+      retCode = growEntry( cachePriv, entry, endIdx-entry->startIdx+1 );
+      if( retCode != TA_SUCCESS )
+         return retCode;
+      return calcEntry( params, entry, endIdx );
+   }
+
+   entry->endIdx = endIdx;
+
+   return TA_SUCCESS;
+}
+
+/* Copy to the caller the output of the entry up to endIdx. */
+static void copyOutput( const TA_ParamHolderPriv *params,
+                        const TA_CacheEntry *entry,
+                        TA_Integer endIdx,
+                        TA_Integer *outBegIdx,
+                        TA_Integer *outNbElement )
+{
+   TA_Integer nbElement;
+   unsigned int i;
+
+   nbElement = endIdx-entry->outBegIdx+1;
+   if( nbElement > entry->outNbElement )
+      nbElement = entry->outNbElement;
+
+   if( nbElement <= 0 )
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+      return;
+   }
+
+   for( i=0; i < params->funcInfo->nbOutput; i++ )
+   {
+      if( params->out[i].outputInfo->type == TA_Output_Integer )
+         memcpy( params->out[i].data.outInteger, entry->buffer[i], nbElement*sizeof(TA_Integer) );
+      else
+         memcpy( params->out[i].data.outReal, entry->buffer[i], nbElement*sizeof(TA_Real) );
+   }
+
+   *outBegIdx    = entry->outBegIdx;
+   *outNbElement = nbElement;
+}
+
+/* Add the entry as the most recently used. */
+static void insertEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry )
+{
+   TA_CacheEntry **bucket;
+
+   bucket = &cachePriv->bucket[entry->hash&(cachePriv->nbBucket-1)];
+   entry->nextInBucket = *bucket;
+   *bucket = entry;
+
+   entry->prev = NULL;
+   entry->next = cachePriv->head;
+   if( cachePriv->head )
+      cachePriv->head->prev = entry;
+   else
+      cachePriv->tail = entry;
+   cachePriv->head = entry;
+
+   cachePriv->stats.nbEntry++;
+   cachePriv->stats.nbBytes += entry->nbBytes;
+}
+
+static void removeEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry )
+{
+   TA_CacheEntry **bucket;
+
+   bucket = &cachePriv->bucket[entry->hash&(cachePriv->nbBucket-1)];
+   while( *bucket != entry )
+      bucket = &(*bucket)->nextInBucket;
+   *bucket = entry->nextInBucket;
+
+   if( entry->prev )
+      entry->prev->next = entry->next;
+   else
+      cachePriv->head = entry->next;
+   if( entry->next )
+      entry->next->prev = entry->prev;
+   else
+      cachePriv->tail = entry->prev;
+
+   cachePriv->stats.nbEntry--;
+   cachePriv->stats.nbBytes -= entry->nbBytes;
+   freeEntry( entry );
+}
+
+/* Move the entry in front of the list. */
+static void touchEntry( TA_ResultCachePriv *cachePriv, TA_CacheEntry *entry )
+{
+   if( cachePriv->head == entry )
+      return;
+
+   entry->prev->next = entry->next;
+   if( entry->next )
+      entry->next->prev = entry->prev;
+   else
+      cachePriv->tail = entry->prev;
+
+   entry->prev = NULL;
+   entry->next = cachePriv->head;
+   cachePriv->head->prev = entry;
+   cachePriv->head = entry;
+}
+
+/* Remove the least recently used entries until within the limits. */
+static void evictEntries( TA_ResultCachePriv *cachePriv )
+{
+   while( cachePriv->tail &&
+          ((cachePriv->stats.nbEntry > cachePriv->maxEntry) ||
+           (cachePriv->stats.nbBytes > cachePriv->maxBytes)) )
+   {
+      removeEntry( cachePriv, cachePriv->tail );
+      cachePriv->stats.nbEvict++;
+   }
+}
@@ -0,0 +1,472 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Pre-calculated index of a series (prefix sums and sparse tables)
+ *   allowing TA_CallFunc to calculate SUM, SMA, VAR, STDDEV, MAX, MIN
+ *   and MIDPOINT in constant time per output, whatever the period.
+ *
+ *   The index is built once for an immutable series and can then be
+ *   attached to the input of any number of TA_ParamHolder.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_abstract.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+extern const TA_FuncDef TA_DEF_SUM;
+extern const TA_FuncDef TA_DEF_SMA;
+extern const TA_FuncDef TA_DEF_VAR;
+extern const TA_FuncDef TA_DEF_STDDEV;
+extern const TA_FuncDef TA_DEF_MAX;
+extern const TA_FuncDef TA_DEF_MIN;
+extern const TA_FuncDef TA_DEF_MIDPOINT;
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_SERIES_QUERY_SUM,
+   TA_SERIES_QUERY_SMA,
+   TA_SERIES_QUERY_VAR,
+   TA_SERIES_QUERY_STDDEV,
+   TA_SERIES_QUERY_MAX,
+   TA_SERIES_QUERY_MIN,
+   TA_SERIES_QUERY_MIDPOINT
+} TA_SeriesQueryType;
+
+typedef struct
+{
+   TA_SeriesQueryType type;
+   const TA_SeriesIndexPriv *index;
+   TA_Integer   lookback;
+   TA_Integer   period;
+   TA_Real      nbDev;
+
+   /* Sparse table level and width covering the period. */
+   unsigned int level;
+   TA_Integer   width;
+} TA_SeriesQuery;
+
+/* Add 'value' to the sum 'high', accumulating the rounding
+ * error of the addition in 'low' (Knuth two-sum).
+ */
+#define TWO_SUM(high,low,value) \
+   { \
+      newSum   = high+(value); \
+      bVirtual = newSum-high; \
+      low     += (high-(newSum-bVirtual))+((value)-bVirtual); \
+      high     = newSum; \
+   }
+
+/* Sum of the 'period' elements ending at 'idx' from a prefix sum. */
+#define WINDOW_SUM(high,low) \
+   ((high[idx+1]-high[trailingIdx])+(low[idx+1]-low[trailingIdx]))
+
+/**** Local functions declarations.    ****/
+static TA_RetCode initQuery( const TA_ParamHolderPriv *params, TA_SeriesQuery *query );
+static TA_Real queryValue( const TA_SeriesQuery *query, TA_Integer idx );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SeriesIndexAlloc( const TA_Real *inReal,
+                                TA_Integer nbElement,
+                                TA_SeriesIndex **allocatedIndex )
+{
+   TA_SeriesIndex *newIndex;
+   TA_SeriesIndexPriv *indexPriv;
+   TA_Real tempReal, sum, sumLow, sumSq, sumSqLow, newSum, bVirtual;
+   TA_Integer i, width, size;
+   unsigned int level;
+
+   if( !allocatedIndex )
+      return TA_BAD_PARAM;
+
+   *allocatedIndex = NULL;
+
+   if( !inReal || (nbElement <= 0) )
+      return TA_BAD_PARAM;
+
+   newIndex = (TA_SeriesIndex *)TA_Malloc( sizeof(TA_SeriesIndex) + sizeof(TA_SeriesIndexPriv) );
+   if( !newIndex )
+      return TA_ALLOC_ERR;
+
+   memset( newIndex, 0, sizeof(TA_SeriesIndex) + sizeof(TA_SeriesIndexPriv) );
+   indexPriv = (TA_SeriesIndexPriv *)(((char *)newIndex)+sizeof(TA_SeriesIndex));
+   indexPriv->magicNumber = TA_SERIES_INDEX_MAGIC_NB;
+   indexPriv->data        = inReal;
+   indexPriv->nbElement   = nbElement;
+   newIndex->hiddenData   = indexPriv;
+
+   /* From this point, TA_SeriesIndexFree can be safely called. */
+
+   /* Prefix sums of the values minus their mean. */
+   sum = 0.0;
+   for( i=0; i < nbElement; i++ )
+      sum += inReal[i];
+   indexPriv->shift = sum/nbElement;
+
+   indexPriv->sum      = (TA_Real *)TA_Malloc( sizeof(TA_Real)*(nbElement+1) );
+   indexPriv->sumLow   = (TA_Real *)TA_Malloc( sizeof(TA_Real)*(nbElement+1) );
+   indexPriv->sumSq    = (TA_Real *)TA_Malloc( sizeof(TA_Real)*(nbElement+1) );
+   indexPriv->sumSqLow = (TA_Real *)TA_Malloc( sizeof(TA_Real)*(nbElement+1) );
+   if( !indexPriv->sum || !indexPriv->sumLow || !indexPriv->sumSq || !indexPriv->sumSqLow )
+   {
+      TA_SeriesIndexFree( newIndex );
+      return TA_ALLOC_ERR;
+   }
+
+   sum      = 0.0;
+   sumLow   = 0.0;
+   sumSq    = 0.0;
+   sumSqLow = 0.0;
+   indexPriv->sum[0]      = 0.0;
+   indexPriv->sumLow[0]   = 0.0;
+   indexPriv->sumSq[0]    = 0.0;
+   indexPriv->sumSqLow[0] = 0.0;
+   for( i=0; i < nbElement; i++ )
+   {
+      tempReal = inReal[i]-indexPriv->shift;
+      TWO_SUM( sum, sumLow, tempReal );
+      TWO_SUM( sumSq, sumSqLow, tempReal*tempReal );
+      indexPriv->sum[i+1]      = sum;
+      indexPriv->sumLow[i+1]   = sumLow;
+      indexPriv->sumSq[i+1]    = sumSq;
+      indexPriv->sumSqLow[i+1] = sumSqLow;
+   }
+
+   /* Sparse tables, each level is built from the previous one. */
+   for( level=1; level < TA_SERIES_INDEX_MAX_LEVEL; level++ )
+   {
+      width = 1<<level;
+      if( width > nbElement )
+         break;
+
+      size = nbElement-width+1;
+      indexPriv->highest[level] = (TA_Real *)TA_Malloc( sizeof(TA_Real)*size );
+      indexPriv->lowest[level]  = (TA_Real *)TA_Malloc( sizeof(TA_Real)*size );
+      if( !indexPriv->highest[level] || !indexPriv->lowest[level] )
+      {
+         TA_SeriesIndexFree( newIndex );
+         return TA_ALLOC_ERR;
+      }
+      indexPriv->nbLevel = level+1;
+
+      width >>= 1;
+      if( level == 1 )
+      {
+         for( i=0; i < size; i++ )
+         {
+            indexPriv->highest[1][i] = inReal[i] > inReal[i+1]? inReal[i] : inReal[i+1];
+            indexPriv->lowest[1][i]  = inReal[i] < inReal[i+1]? inReal[i] : inReal[i+1];
+         }
+      }
+      else
+      {
+         for( i=0; i < size; i++ )
+         {
+            tempReal = indexPriv->highest[level-1][i+width];
+            if( indexPriv->highest[level-1][i] > tempReal )
+               tempReal = indexPriv->highest[level-1][i];
+            indexPriv->highest[level][i] = tempReal;
+
+            tempReal = indexPriv->lowest[level-1][i+width];
+            if( indexPriv->lowest[level-1][i] < tempReal )
+               tempReal = indexPriv->lowest[level-1][i];
+            indexPriv->lowest[level][i] = tempReal;
+         }
+      }
+   }
+
+   *allocatedIndex = newIndex;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SeriesIndexFree( TA_SeriesIndex *indexToFree )
+{
+   TA_SeriesIndexPriv *indexPriv;
+   unsigned int level;
+
+   if( !indexToFree )
+      return TA_SUCCESS;
+
+   indexPriv = (TA_SeriesIndexPriv *)(indexToFree->hiddenData);
+   if( !indexPriv || (indexPriv->magicNumber != TA_SERIES_INDEX_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   FREE_IF_NOT_NULL( indexPriv->sum );
+   FREE_IF_NOT_NULL( indexPriv->sumLow );
+   FREE_IF_NOT_NULL( indexPriv->sumSq );
+   FREE_IF_NOT_NULL( indexPriv->sumSqLow );
+   for( level=0; level < TA_SERIES_INDEX_MAX_LEVEL; level++ )
+   {
+      FREE_IF_NOT_NULL( indexPriv->highest[level] );
+      FREE_IF_NOT_NULL( indexPriv->lowest[level] );
+   }
+
+   /* Invalidate the structure to detect later use. */
+   indexPriv->magicNumber = 0;
+   TA_Free( indexToFree );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SeriesIndexCall( const TA_ParamHolderPriv *params,
+                               TA_Integer  startIdx,
+                               TA_Integer  endIdx,
+                               TA_Integer *outBegIdx,
+                               TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_SeriesQuery query;
+   TA_Real *out;
+   TA_Integer i;
+
+   retCode = initQuery( params, &query );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* Same validation as the TA functions. */
+   if( startIdx < 0 )
+      return TA_OUT_OF_RANGE_START_INDEX;
+   if( (endIdx < 0) || (endIdx < startIdx) || (endIdx >= query.index->nbElement) )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   if( startIdx < query.lookback )
+      startIdx = query.lookback;
+
+   if( startIdx > endIdx )
+   {
+      *outBegIdx = 0;
+      *outNbElement = 0;
+      return TA_SUCCESS;
+   }
+
+   /* The index does not read the input, so the output
+    * can be the same buffer as the input.
+    */
+   out = params->out[0].data.outReal;
+   for( i=startIdx; i <= endIdx; i++ )
+      out[i-startIdx] = queryValue( &query, i );
+
+   *outBegIdx    = startIdx;
+   *outNbElement = endIdx-startIdx+1;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SeriesIndexCallAtIndices( const TA_ParamHolderPriv *params,
+                                        const TA_Integer *indices,
+                                        TA_Integer  nbIndices,
+                                        TA_Integer *outBegIdx,
+                                        TA_Integer *outNbElement )
+{
+   TA_RetCode retCode;
+   TA_SeriesQuery query;
+   TA_Real *out;
+   TA_Integer i, firstIdx;
+
+   retCode = initQuery( params, &query );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   /* The indices were already verified by the caller to be
+    * positive and strictly increasing.
+    */
+   if( indices[nbIndices-1] >= query.index->nbElement )
+      return TA_OUT_OF_RANGE_END_INDEX;
+
+   firstIdx = 0;
+   while( (firstIdx < nbIndices) && (indices[firstIdx] < query.lookback) )
+      firstIdx++;
+
+   out = params->out[0].data.outReal;
+   for( i=firstIdx; i < nbIndices; i++ )
+      out[i-firstIdx] = queryValue( &query, indices[i] );
+
+   if( firstIdx == nbIndices )
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+   }
+   else
+   {
+      *outBegIdx    = firstIdx;
+      *outNbElement = nbIndices-firstIdx;
+   }
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode initQuery( const TA_ParamHolderPriv *params, TA_SeriesQuery *query )
+{
+   const TA_FuncDef *funcDef;
+   const TA_SeriesIndexPriv *indexPriv;
+   TA_Integer lookback;
+
+   funcDef = (const TA_FuncDef *)params->funcInfo->handle;
+
+   if( funcDef == &TA_DEF_SUM )
+      query->type = TA_SERIES_QUERY_SUM;
+   else if( funcDef == &TA_DEF_SMA )
+      query->type = TA_SERIES_QUERY_SMA;
+   else if( funcDef == &TA_DEF_VAR )
+      query->type = TA_SERIES_QUERY_VAR;
+   else if( funcDef == &TA_DEF_STDDEV )
+      query->type = TA_SERIES_QUERY_STDDEV;
+   else if( funcDef == &TA_DEF_MAX )
+      query->type = TA_SERIES_QUERY_MAX;
+   else if( funcDef == &TA_DEF_MIN )
+      query->type = TA_SERIES_QUERY_MIN;
+   else if( funcDef == &TA_DEF_MIDPOINT )
+      query->type = TA_SERIES_QUERY_MIDPOINT;
+   else
+      return TA_NOT_SUPPORTED;
+
+   indexPriv = (const TA_SeriesIndexPriv *)params->in[0].index->hiddenData;
+   if( indexPriv->magicNumber != TA_SERIES_INDEX_MAGIC_NB )
+      return TA_BAD_OBJECT;
+
+   /* The lookback validates the optional inputs, and for all
+    * these functions the period is the lookback plus one.
+    */
+   lookback = (TA_Integer)(*funcDef->lookback)( params );
+   if( lookback < 0 )
+      return TA_BAD_PARAM;
+
+   query->index    = indexPriv;
+   query->lookback = lookback;
+   query->period   = lookback+1;
+   query->nbDev    = 1.0;
+   if( query->type == TA_SERIES_QUERY_STDDEV )
+   {
+      query->nbDev = params->optIn[1].data.optInReal;
+      if( query->nbDev == TA_REAL_DEFAULT )
+         query->nbDev = 1.0;
+   }
+
+   /* Largest power of two not exceeding the period. */
+   query->level = 0;
+   while( (TA_Integer)(2<<query->level) <= query->period )
+      query->level++;
+   query->width = 1<<query->level;
+
+   /* When the sparse table level does not exist, the period is
+    * longer than the series and there is nothing to calculate
+    * (the lookback is beyond the end of the data).
+    */
+
+   return TA_SUCCESS;
+}
+
+static TA_Real queryValue( const TA_SeriesQuery *query, TA_Integer idx )
+{
+   const TA_SeriesIndexPriv *indexPriv;
+   TA_Integer trailingIdx;
+   TA_Real sum, sumSq, highest, lowest, tempReal;
+
+   indexPriv   = query->index;
+   trailingIdx = idx-query->lookback;
+
+   switch( query->type )
+   {
+   case TA_SERIES_QUERY_SUM:
+      sum = WINDOW_SUM( indexPriv->sum, indexPriv->sumLow );
+      return sum+(query->period*indexPriv->shift);
+
+   case TA_SERIES_QUERY_SMA:
+      sum = WINDOW_SUM( indexPriv->sum, indexPriv->sumLow );
+      return (sum/query->period)+indexPriv->shift;
+
+   case TA_SERIES_QUERY_VAR:
+   case TA_SERIES_QUERY_STDDEV:
+      /* The variance does not change when subtracting the shift. */
+      sum   = WINDOW_SUM( indexPriv->sum, indexPriv->sumLow )/query->period;
+      sumSq = WINDOW_SUM( indexPriv->sumSq, indexPriv->sumSqLow )/query->period;
+      tempReal = sumSq-(sum*sum);
+      if( query->type == TA_SERIES_QUERY_VAR )
+         return tempReal;
+      if( TA_IS_ZERO_OR_NEG(tempReal) )
+         return 0.0;
+      return sqrt(tempReal)*query->nbDev;
+
+   default:
+      break;
+   }
+
+   /* The period is covered by two (possibly overlapping)
+    * ranges of the sparse table.
+    */
+   highest = indexPriv->highest[query->level][trailingIdx];
+   tempReal = indexPriv->highest[query->level][idx-query->width+1];
+   if( tempReal > highest )
+      highest = tempReal;
+
+   lowest = indexPriv->lowest[query->level][trailingIdx];
+   tempReal = indexPriv->lowest[query->level][idx-query->width+1];
+   if( tempReal < lowest )
+      lowest = tempReal;
+
+   if( query->type == TA_SERIES_QUERY_MAX )
+      return highest;
+   if( query->type == TA_SERIES_QUERY_MIN )
+      return lowest;
+
+   return (highest+lowest)/2.0;
+}
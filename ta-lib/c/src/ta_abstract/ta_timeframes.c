@@ -0,0 +1,476 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Evaluation of a function on many timeframes aggregated from the
+ *   same base series (see TA_TimeframesAlloc).
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include "ta_common.h"
+#include "ta_memory.h"
+#include "ta_magic_nb.h"
+#include "ta_abstract.h"
+#include "ta_def_ui.h"
+#include "ta_frame_priv.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Columns of a timeframe. */
+#define TA_TF_OPEN   0
+#define TA_TF_HIGH   1
+#define TA_TF_LOW    2
+#define TA_TF_CLOSE  3
+#define TA_TF_VOLUME 4
+#define TA_TF_NB_COL 5
+
+typedef struct
+{
+   unsigned int magicNumber;
+
+   TA_Integer nbBar;
+   TA_Integer nbTimeframe;
+   const TA_Real *base[TA_TF_NB_COL];
+
+   /* Per timeframe. */
+   TA_Integer *factor;
+   TA_Integer *nbAggBar;
+
+   /* Aggregated columns [t*TA_TF_NB_COL+col], NULL for the
+    * factor 1 and for the columns without base data.
+    */
+   TA_Real **aggregated;
+   TA_Real  *buffer;
+} TA_TimeframesPriv;
+
+/**** Local functions declarations.    ****/
+static void aggregate( TA_TimeframesPriv *tfPriv );
+static const TA_Real *getColumn( const TA_TimeframesPriv *tfPriv,
+                                 TA_Integer t, int col );
+static int findColumn( const TA_TimeframesPriv *tfPriv, const TA_Real *data );
+static void project( const TA_ParamHolderPriv *params,
+                     TA_Integer factor, TA_Integer nbBar,
+                     TA_Integer *outBegIdx, TA_Integer *outNbElement );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_TimeframesAlloc( const TA_Real    *inOpen,
+                               const TA_Real    *inHigh,
+                               const TA_Real    *inLow,
+                               const TA_Real    *inClose,
+                               const TA_Real    *inVolume,
+                               TA_Integer        nbBar,
+                               const TA_Integer *factors,
+                               TA_Integer        nbTimeframe,
+                               TA_Timeframes   **allocatedTimeframes )
+{
+   TA_Timeframes *newTimeframes;
+   TA_TimeframesPriv *tfPriv;
+   TA_Integer t, nbAggBar, size;
+   size_t nbElement;
+   int col;
+
+   if( !allocatedTimeframes )
+      return TA_BAD_PARAM;
+
+   *allocatedTimeframes = NULL;
+
+   if( (nbBar <= 0) || !factors || (nbTimeframe <= 0) )
+      return TA_BAD_PARAM;
+
+   if( !inOpen && !inHigh && !inLow && !inClose && !inVolume )
+      return TA_BAD_PARAM;
+
+   for( t=0; t < nbTimeframe; t++ )
+   {
+      if( factors[t] <= 0 )
+         return TA_BAD_PARAM;
+   }
+
+   size = sizeof(TA_Timeframes) + sizeof(TA_TimeframesPriv) +
+          nbTimeframe*(2*sizeof(TA_Integer)+TA_TF_NB_COL*sizeof(TA_Real *));
+   newTimeframes = (TA_Timeframes *)TA_Malloc( size );
+   if( !newTimeframes )
+      return TA_ALLOC_ERR;
+
+   memset( newTimeframes, 0, size );
+   tfPriv = (TA_TimeframesPriv *)(((char *)newTimeframes)+sizeof(TA_Timeframes));
+   tfPriv->magicNumber = TA_TIMEFRAMES_MAGIC_NB;
+   tfPriv->nbBar       = nbBar;
+   tfPriv->nbTimeframe = nbTimeframe;
+   tfPriv->base[TA_TF_OPEN]   = inOpen;
+   tfPriv->base[TA_TF_HIGH]   = inHigh;
+   tfPriv->base[TA_TF_LOW]    = inLow;
+   tfPriv->base[TA_TF_CLOSE]  = inClose;
+   tfPriv->base[TA_TF_VOLUME] = inVolume;
+   tfPriv->aggregated = (TA_Real **)(tfPriv+1);
+   tfPriv->factor     = (TA_Integer *)(tfPriv->aggregated+nbTimeframe*TA_TF_NB_COL);
+   tfPriv->nbAggBar   = tfPriv->factor+nbTimeframe;
+   newTimeframes->hiddenData = tfPriv;
+
+   /* One buffer for all the aggregated columns. */
+   nbElement = 0;
+   for( t=0; t < nbTimeframe; t++ )
+   {
+      nbAggBar = (nbBar+factors[t]-1)/factors[t];
+      tfPriv->factor[t]   = factors[t];
+      tfPriv->nbAggBar[t] = nbAggBar;
+      if( factors[t] == 1 )
+         continue;
+      for( col=0; col < TA_TF_NB_COL; col++ )
+      {
+         if( tfPriv->base[col] )
+            nbElement += nbAggBar;
+      }
+   }
+
+   if( nbElement > 0 )
+   {
+      tfPriv->buffer = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+      if( !tfPriv->buffer )
+      {
+         TA_Free( newTimeframes );
+         return TA_ALLOC_ERR;
+      }
+   }
+
+   nbElement = 0;
+   for( t=0; t < nbTimeframe; t++ )
+   {
+      if( factors[t] == 1 )
+         continue;
+      for( col=0; col < TA_TF_NB_COL; col++ )
+      {
+         if( !tfPriv->base[col] )
+            continue;
+         tfPriv->aggregated[t*TA_TF_NB_COL+col] = tfPriv->buffer+nbElement;
+         nbElement += tfPriv->nbAggBar[t];
+      }
+   }
+
+   aggregate( tfPriv );
+
+   *allocatedTimeframes = newTimeframes;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_TimeframesFree( TA_Timeframes *timeframes )
+{
+   TA_TimeframesPriv *tfPriv;
+
+   if( !timeframes )
+      return TA_BAD_PARAM;
+
+   tfPriv = (TA_TimeframesPriv *)timeframes->hiddenData;
+   if( !tfPriv || (tfPriv->magicNumber != TA_TIMEFRAMES_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   tfPriv->magicNumber = 0;
+   FREE_IF_NOT_NULL( tfPriv->buffer );
+   TA_Free( timeframes );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_CallFuncTimeframes( const TA_ParamHolder *param,
+                                  const TA_Timeframes  *timeframes,
+                                  int                   projected,
+                                  TA_Integer           *outBegIdx,
+                                  TA_Integer           *outNbElement )
+{
+   const TA_ParamHolderPriv *params;
+   const TA_TimeframesPriv *tfPriv;
+   const TA_FuncInfo *funcInfo;
+   const TA_PricePtrs *basePrice;
+   TA_ParamHolderPriv tfParams;
+   TA_ParamHolder tfHolder;
+   TA_ParamHolderInput *tfInput;
+   TA_ParamHolderOutput *tfOutput;
+   TA_PricePtrs *price;
+   TA_Integer t, offset;
+   unsigned int i;
+   int *column;
+   TA_RetCode retCode;
+
+   if( !param || !timeframes || !outBegIdx || !outNbElement )
+      return TA_BAD_PARAM;
+
+   params = (const TA_ParamHolderPriv *)(param->hiddenData);
+   if( params->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+      return TA_INVALID_PARAM_HOLDER;
+
+   if( params->inBitmap != 0 )
+      return TA_INPUT_NOT_ALL_INITIALIZE;
+
+   if( params->outBitmap != 0 )
+      return TA_OUTPUT_NOT_ALL_INITIALIZE;
+
+   /* The compact outputs are supported only by TA_CallFunc. */
+   if( params->compactBitmap != 0 )
+      return TA_NOT_SUPPORTED;
+
+   tfPriv = (const TA_TimeframesPriv *)timeframes->hiddenData;
+   if( !tfPriv || (tfPriv->magicNumber != TA_TIMEFRAMES_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   funcInfo = params->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+
+   tfInput = (TA_ParamHolderInput *)TA_Malloc( funcInfo->nbInput*(sizeof(TA_ParamHolderInput)+6*sizeof(int)) +
+                                               funcInfo->nbOutput*sizeof(TA_ParamHolderOutput) );
+   if( !tfInput )
+      return TA_ALLOC_ERR;
+   tfOutput = (TA_ParamHolderOutput *)(tfInput+funcInfo->nbInput);
+   column   = (int *)(tfOutput+funcInfo->nbOutput);
+
+   /* Find the base column of each input. */
+   retCode = TA_SUCCESS;
+   for( i=0; (i < funcInfo->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      tfInput[i] = params->in[i];
+      tfInput[i].index = NULL;
+      switch( params->in[i].inputInfo->type )
+      {
+      case TA_Input_Price:
+         basePrice = &params->in[i].data.inPrice;
+         column[i*6+0] = basePrice->open?         findColumn( tfPriv, basePrice->open )   : TA_TF_NB_COL;
+         column[i*6+1] = basePrice->high?         findColumn( tfPriv, basePrice->high )   : TA_TF_NB_COL;
+         column[i*6+2] = basePrice->low?          findColumn( tfPriv, basePrice->low )    : TA_TF_NB_COL;
+         column[i*6+3] = basePrice->close?        findColumn( tfPriv, basePrice->close )  : TA_TF_NB_COL;
+         column[i*6+4] = basePrice->volume?       findColumn( tfPriv, basePrice->volume ) : TA_TF_NB_COL;
+         column[i*6+5] = basePrice->openInterest? -1 : TA_TF_NB_COL;
+         for( t=0; t < 6; t++ )
+         {
+            if( column[i*6+t] < 0 )
+               retCode = TA_BAD_PARAM;
+         }
+         break;
+      case TA_Input_Real:
+         column[i*6] = findColumn( tfPriv, params->in[i].data.inReal );
+         if( column[i*6] < 0 )
+            retCode = TA_BAD_PARAM;
+         break;
+      default:
+         retCode = TA_NOT_SUPPORTED;
+         break;
+      }
+   }
+
+   tfParams = *params;
+   tfParams.in  = tfInput;
+   tfParams.out = tfOutput;
+   tfParams.alignedOutput = 0;
+   tfParams.cache = NULL;
+   tfHolder.hiddenData = &tfParams;
+
+   for( t=0; (t < tfPriv->nbTimeframe) && (retCode == TA_SUCCESS); t++ )
+   {
+      for( i=0; i < funcInfo->nbInput; i++ )
+      {
+         if( params->in[i].inputInfo->type == TA_Input_Real )
+         {
+            tfInput[i].data.inReal = getColumn( tfPriv, t, column[i*6] );
+            continue;
+         }
+         price = &tfInput[i].data.inPrice;
+         price->open   = getColumn( tfPriv, t, column[i*6+0] );
+         price->high   = getColumn( tfPriv, t, column[i*6+1] );
+         price->low    = getColumn( tfPriv, t, column[i*6+2] );
+         price->close  = getColumn( tfPriv, t, column[i*6+3] );
+         price->volume = getColumn( tfPriv, t, column[i*6+4] );
+      }
+
+      offset = t*tfPriv->nbBar;
+      for( i=0; i < funcInfo->nbOutput; i++ )
+      {
+         tfOutput[i] = params->out[i];
+         if( tfOutput[i].outputInfo->type == TA_Output_Integer )
+            tfOutput[i].data.outInteger += offset;
+         else
+            tfOutput[i].data.outReal += offset;
+      }
+
+      retCode = TA_CallFunc( &tfHolder, 0, tfPriv->nbAggBar[t]-1,
+                             &outBegIdx[t], &outNbElement[t] );
+      if( (retCode == TA_SUCCESS) && projected )
+         project( &tfParams, tfPriv->factor[t], tfPriv->nbBar,
+                  &outBegIdx[t], &outNbElement[t] );
+   }
+
+   TA_Free( tfInput );
+
+   return retCode;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Aggregate all the timeframes in one pass on the base series. */
+static void aggregate( TA_TimeframesPriv *tfPriv )
+{
+   const TA_Real *open, *high, *low, *close, *volume;
+   TA_Real **aggregated;
+   TA_Integer i, t, k, factor;
+
+   open   = tfPriv->base[TA_TF_OPEN];
+   high   = tfPriv->base[TA_TF_HIGH];
+   low    = tfPriv->base[TA_TF_LOW];
+   close  = tfPriv->base[TA_TF_CLOSE];
+   volume = tfPriv->base[TA_TF_VOLUME];
+
+   for( i=0; i < tfPriv->nbBar; i++ )
+   {
+      for( t=0; t < tfPriv->nbTimeframe; t++ )
+      {
+         factor = tfPriv->factor[t];
+         if( factor == 1 )
+            continue;
+
+         aggregated = &tfPriv->aggregated[t*TA_TF_NB_COL];
+         k = i/factor;
+         if( i == k*factor )
+         {
+            /* First base bar of the aggregated bar. */
+            if( open )   aggregated[TA_TF_OPEN][k]   = open[i];
+            if( high )   aggregated[TA_TF_HIGH][k]   = high[i];
+            if( low )    aggregated[TA_TF_LOW][k]    = low[i];
+            if( volume ) aggregated[TA_TF_VOLUME][k] = volume[i];
+         }
+         else
+         {
+            if( high && (high[i] > aggregated[TA_TF_HIGH][k]) )
+               aggregated[TA_TF_HIGH][k] = high[i];
+            if( low && (low[i] < aggregated[TA_TF_LOW][k]) )
+               aggregated[TA_TF_LOW][k] = low[i];
+            if( volume )
+               aggregated[TA_TF_VOLUME][k] += volume[i];
+         }
+         if( close )
+            aggregated[TA_TF_CLOSE][k] = close[i];
+      }
+   }
+}
+
+/* Data of a column for a timeframe (NULL for TA_TF_NB_COL). */
+static const TA_Real *getColumn( const TA_TimeframesPriv *tfPriv,
+                                 TA_Integer t, int col )
+{
+   if( col >= TA_TF_NB_COL )
+      return NULL;
+
+   if( tfPriv->factor[t] == 1 )
+      return tfPriv->base[col];
+
+   return tfPriv->aggregated[t*TA_TF_NB_COL+col];
+}
+
+/* Column of the base series at this address, -1 if none. */
+static int findColumn( const TA_TimeframesPriv *tfPriv, const TA_Real *data )
+{
+   int col;
+
+   for( col=0; col < TA_TF_NB_COL; col++ )
+   {
+      if( data && (tfPriv->base[col] == data) )
+         return col;
+   }
+
+   return -1;
+}
+
+/* Spread the output of the aggregated bars on the base bars.
+ *
+ * Done in-place from the last base bar: the value for the base bar
+ * 'i' is never read after 'i' is written since it comes from an
+ * aggregated bar at or before 'i'.
+ */
+static void project( const TA_ParamHolderPriv *params,
+                     TA_Integer factor, TA_Integer nbBar,
+                     TA_Integer *outBegIdx, TA_Integer *outNbElement )
+{
+   TA_Integer i, k, firstIdx;
+   unsigned int j;
+   TA_Real nan;
+
+   /* First base bar completing an aggregated bar with a value. */
+   if( *outNbElement > 0 )
+      firstIdx = (*outBegIdx+1)*factor-1;
+   else
+      firstIdx = nbBar;
+
+   nan = TA_GetNaN();
+   for( j=0; j < params->funcInfo->nbOutput; j++ )
+   {
+      for( i=nbBar-1; i >= 0; i-- )
+      {
+         k = (i+1)/factor-1-*outBegIdx;
+         if( params->out[j].outputInfo->type == TA_Output_Integer )
+            params->out[j].data.outInteger[i] = (i < firstIdx)? TA_INTEGER_DEFAULT : params->out[j].data.outInteger[k];
+         else
+            params->out[j].data.outReal[i] = (i < firstIdx)? nan : params->out[j].data.outReal[k];
+      }
+   }
+
+   if( firstIdx < nbBar )
+   {
+      *outBegIdx    = firstIdx;
+      *outNbElement = nbBar-firstIdx;
+   }
+   else
+   {
+      *outBegIdx    = 0;
+      *outNbElement = 0;
+   }
+}
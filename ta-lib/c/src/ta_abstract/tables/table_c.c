@@ -1796,6 +1796,54 @@ DEF_MATH_UNARY_OPERATOR( COS, "Vector Trigonometric Cos", "Cos" )
 DEF_MATH_UNARY_OPERATOR( COSH, "Vector Trigonometric Cosh", "Cosh" )
 /* COSH END */
 
+/* CROSSOVER BEGIN */
+static const TA_InputParameterInfo    *TA_CROSSOVER_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real0,
+  &TA_DEF_UI_Input_Real1,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_CROSSOVER_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Integer,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_CROSSOVER_OptInputs[] = { NULL };
+
+DEF_FUNCTION( CROSSOVER,                   /* name */
+              TA_GroupId_MathOperators,    /* groupId */
+              "Series 0 crossing above series 1", /* hint */
+              "CrossOver",                 /* CamelCase name */
+              0                            /* flags */
+             );
+/* CROSSOVER END */
+
+/* CROSSUNDER BEGIN */
+static const TA_InputParameterInfo    *TA_CROSSUNDER_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real0,
+  &TA_DEF_UI_Input_Real1,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_CROSSUNDER_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Integer,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_CROSSUNDER_OptInputs[] = { NULL };
+
+DEF_FUNCTION( CROSSUNDER,                  /* name */
+              TA_GroupId_MathOperators,    /* groupId */
+              "Series 0 crossing below series 1", /* hint */
+              "CrossUnder",                /* CamelCase name */
+              0                            /* flags */
+             );
+/* CROSSUNDER END */
+
 /****************************************************************************
  * Step 2 - Add your TA function to the table.
  *          Keep in alphabetical order. Must be NULL terminated.
@@ -1869,6 +1917,8 @@ const TA_FuncDef *TA_DEF_TableC[] =
    ADD_TO_TABLE(CORREL),
    ADD_TO_TABLE(COS),
    ADD_TO_TABLE(COSH),
+   ADD_TO_TABLE(CROSSOVER),
+   ADD_TO_TABLE(CROSSUNDER),
    NULL
 };
 
@@ -230,6 +230,32 @@ DEF_FUNCTION( MACDFIX,                    /* name */
              );
 /* MACDFIX END */
 
+/* MAD BEGIN */
+static const TA_InputParameterInfo    *TA_MAD_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_MAD_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Real,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_MAD_OptInputs[] =
+{ &TA_DEF_UI_TimePeriod_14_MINIMUM2,
+  NULL
+};
+
+DEF_FUNCTION( MAD,                          /* name */
+              TA_GroupId_Statistic,         /* groupId */
+              "Median Absolute Deviation",  /* hint */
+              "MedianAbsDev",               /* CamelCase name */
+              0                             /* flags */
+             );
+/* MAD END */
+
 /* MAMA BEGIN */
 const TA_RealRange TA_DEF_MAMA_FastLimit =
 {
@@ -391,6 +417,32 @@ DEF_FUNCTION( MAXINDEX,                  /* name */
              );
 /* MAXINDEX END */
 
+/* MEDIAN BEGIN */
+static const TA_InputParameterInfo    *TA_MEDIAN_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_MEDIAN_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Real,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_MEDIAN_OptInputs[] =
+{ &TA_DEF_UI_TimePeriod_14_MINIMUM2,
+  NULL
+};
+
+DEF_FUNCTION( MEDIAN,                     /* name */
+              TA_GroupId_Statistic,       /* groupId */
+              "Median over period",       /* hint */
+              "Median",                   /* CamelCase name */
+              TA_FUNC_FLG_OVERLAP         /* flags */
+             );
+/* MEDIAN END */
+
 /* MEDPRICE BEGIN */
 static const TA_InputParameterInfo    *TA_MEDPRICE_Inputs[]    =
 {
@@ -707,10 +759,12 @@ const TA_FuncDef *TA_DEF_TableM[] =
    ADD_TO_TABLE(MACD),
    ADD_TO_TABLE(MACDEXT),
    ADD_TO_TABLE(MACDFIX),
+   ADD_TO_TABLE(MAD),
    ADD_TO_TABLE(MAMA),
    ADD_TO_TABLE(MAVP),
    ADD_TO_TABLE(MAX),
    ADD_TO_TABLE(MAXINDEX),
+   ADD_TO_TABLE(MEDIAN),
    ADD_TO_TABLE(MEDPRICE),
    ADD_TO_TABLE(MFI),
    ADD_TO_TABLE(MIDPOINT),
@@ -48,7 +48,56 @@
  *
  ****************************************************************************/
 
-/* None */
+/* QUANTILE BEGIN */
+static const TA_RealRange TA_DEF_Quantile =
+{
+   0.0,   /* min */
+   1.0,   /* max */
+   2,     /* precision */
+   0.05,  /* suggested start */
+   0.95,  /* suggested end   */
+   0.05   /* suggested increment */
+};
+
+static const TA_OptInputParameterInfo TA_DEF_UI_Quantile =
+{
+   TA_OptInput_RealRange, /* type */
+   "optInQuantile",       /* paramName */
+   0,                     /* flags */
+
+   "Quantile",            /* displayName */
+   (const void *)&TA_DEF_Quantile, /* dataSet */
+   0.5, /* defaultValue */
+   "Fraction of the values of the period below the output (0.5 is the median)", /* hint */
+
+   NULL /* CamelCase name */
+};
+
+static const TA_InputParameterInfo    *TA_QUANTILE_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_QUANTILE_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Real,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_QUANTILE_OptInputs[] =
+{ &TA_DEF_UI_TimePeriod_14_MINIMUM2,
+  &TA_DEF_UI_Quantile,
+  NULL
+};
+
+DEF_FUNCTION( QUANTILE,                   /* name */
+              TA_GroupId_Statistic,       /* groupId */
+              "Quantile over period",     /* hint */
+              "Quantile",                 /* CamelCase name */
+              TA_FUNC_FLG_OVERLAP         /* flags */
+             );
+/* QUANTILE END */
 
 /****************************************************************************
  * Step 2 - Add your TA function to the table.
@@ -56,6 +105,7 @@
  ****************************************************************************/
 const TA_FuncDef *TA_DEF_TableQ[] =
 {
+   ADD_TO_TABLE(QUANTILE),
    NULL
 };
 
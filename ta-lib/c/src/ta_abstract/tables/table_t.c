@@ -122,6 +122,56 @@ DEF_FUNCTION( TEMA,                       /* name */
              );
 /* TEMA END */
 
+/* THRESHOLD_EVENTS BEGIN */
+static const TA_RealRange TA_DEF_Threshold =
+{
+   TA_REAL_MIN,    /* min */
+   TA_REAL_MAX,    /* max */
+   2,              /* precision */
+   0.0,            /* suggested start */
+   100.0,          /* suggested end   */
+   10.0            /* suggested increment */
+};
+
+static const TA_OptInputParameterInfo TA_DEF_UI_Threshold =
+{
+   TA_OptInput_RealRange, /* type */
+   "optInThreshold",      /* paramName */
+   0,                     /* flags */
+
+   "Threshold",           /* displayName */
+   (const void *)&TA_DEF_Threshold, /* dataSet */
+   0.0, /* defaultValue */
+   "Level crossed by the input", /* hint */
+
+   NULL /* CamelCase name */
+};
+
+static const TA_InputParameterInfo    *TA_THRESHOLD_EVENTS_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real,
+  NULL
+};
+
+static const TA_OutputParameterInfo   *TA_THRESHOLD_EVENTS_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Integer,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_THRESHOLD_EVENTS_OptInputs[] =
+{ &TA_DEF_UI_Threshold,
+  NULL
+};
+
+DEF_FUNCTION( THRESHOLD_EVENTS,            /* name */
+              TA_GroupId_MathOperators,    /* groupId */
+              "Crossings of a threshold",  /* hint */
+              "ThresholdEvents",           /* CamelCase name */
+              0                            /* flags */
+             );
+/* THRESHOLD_EVENTS END */
+
 /* TRANGE BEGIN */
 static const TA_InputParameterInfo    *TA_TRANGE_Inputs[]    =
 {
@@ -256,6 +306,7 @@ const TA_FuncDef *TA_DEF_TableT[] =
    ADD_TO_TABLE(TAN),
    ADD_TO_TABLE(TANH),
    ADD_TO_TABLE(TEMA),
+   ADD_TO_TABLE(THRESHOLD_EVENTS),
    ADD_TO_TABLE(TRANGE),
    ADD_TO_TABLE(TRIMA),
    ADD_TO_TABLE(TRIX),
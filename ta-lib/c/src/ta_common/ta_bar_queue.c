@@ -0,0 +1,422 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Single producer / single consumer lock-free queue of bars (see
+ *   TA_BarQueueAlloc).
+ *
+ *   'head' is only written by the producer and 'tail' only by the
+ *   consumer. Both are always increasing (modulo 2^32) and the slot
+ *   of a bar is its number masked by capacity-1. A bar is written
+ *   before 'head' is released, and read before 'tail' is released,
+ *   so the other thread never sees a slot being written.
+ *
+ *   The history of the consumer is kept like in ta_bars.c: arrays of
+ *   2*historySize elements with each bar written twice, for the last
+ *   bars to always be contiguous.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+
+#if defined( _MSC_VER )
+   #include <windows.h>
+#endif
+
+#include "ta_common.h"
+#include "ta_magic_nb.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* Keep the indices of each thread on distinct cache lines. */
+#define TA_CACHE_LINE_SIZE 64
+
+typedef struct
+{
+   /* Bars waiting in the queue. */
+   Int64   *timestamp;
+   TA_Real *open;
+   TA_Real *high;
+   TA_Real *low;
+   TA_Real *close;
+   TA_Real *volume;
+} TA_BarArrays;
+
+typedef struct
+{
+   unsigned int magicNumber;
+   unsigned int capacity; /* Power of two. */
+   TA_Integer   historySize;
+
+   TA_BarArrays queue;   /* 'capacity' elements.      */
+   TA_BarArrays history; /* 2*historySize elements.   */
+   UInt64       nbBar;   /* Bars moved to the history. */
+
+   char padding1[TA_CACHE_LINE_SIZE];
+
+   /* Producer. */
+   volatile unsigned int head;
+   unsigned int producerTail;
+
+   char padding2[TA_CACHE_LINE_SIZE];
+
+   /* Consumer. */
+   volatile unsigned int tail;
+   unsigned int consumerHead;
+
+   char padding3[TA_CACHE_LINE_SIZE];
+} TA_BarQueuePriv;
+
+/**** Local functions declarations.    ****/
+static unsigned int loadAcquire( volatile unsigned int *ptr );
+static void storeRelease( volatile unsigned int *ptr, unsigned int value );
+static TA_RetCode allocArrays( TA_BarArrays *arrays, size_t nbElement );
+static void freeArrays( TA_BarArrays *arrays );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_BarQueueAlloc( TA_Integer capacity,
+                             TA_Integer historySize,
+                             TA_BarQueue **allocatedQueue )
+{
+   TA_BarQueue *newQueue;
+   TA_BarQueuePriv *queuePriv;
+   unsigned int size;
+
+   if( !allocatedQueue )
+      return TA_BAD_PARAM;
+
+   *allocatedQueue = NULL;
+
+   if( (capacity <= 0) || (capacity > 0x40000000) || (historySize <= 0) )
+      return TA_BAD_PARAM;
+
+   newQueue = (TA_BarQueue *)TA_Malloc( sizeof(TA_BarQueue) + sizeof(TA_BarQueuePriv) );
+   if( !newQueue )
+      return TA_ALLOC_ERR;
+
+   memset( newQueue, 0, sizeof(TA_BarQueue) + sizeof(TA_BarQueuePriv) );
+   queuePriv = (TA_BarQueuePriv *)(((char *)newQueue)+sizeof(TA_BarQueue));
+   queuePriv->magicNumber = TA_BAR_QUEUE_MAGIC_NB;
+   queuePriv->historySize = historySize;
+   newQueue->hiddenData   = queuePriv;
+
+   size = 1;
+   while( size < (unsigned int)capacity )
+      size <<= 1;
+   queuePriv->capacity = size;
+
+   /* From this point, TA_BarQueueFree can be safely called. */
+   if( (allocArrays( &queuePriv->queue, size ) != TA_SUCCESS) ||
+       (allocArrays( &queuePriv->history, 2*(size_t)historySize ) != TA_SUCCESS) )
+   {
+      TA_BarQueueFree( newQueue );
+      return TA_ALLOC_ERR;
+   }
+
+   *allocatedQueue = newQueue;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarQueueFree( TA_BarQueue *queue )
+{
+   TA_BarQueuePriv *queuePriv;
+
+   if( !queue )
+      return TA_BAD_PARAM;
+
+   queuePriv = (TA_BarQueuePriv *)queue->hiddenData;
+   if( !queuePriv || (queuePriv->magicNumber != TA_BAR_QUEUE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   queuePriv->magicNumber = 0;
+   freeArrays( &queuePriv->queue );
+   freeArrays( &queuePriv->history );
+   TA_Free( queue );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarQueuePush( TA_BarQueue *queue,
+                            TA_Integer nbBar,
+                            const Int64   *timestamp,
+                            const TA_Real *open,
+                            const TA_Real *high,
+                            const TA_Real *low,
+                            const TA_Real *close,
+                            const TA_Real *volume,
+                            TA_Integer *nbPushed )
+{
+   TA_BarQueuePriv *queuePriv;
+   TA_BarArrays *arrays;
+   unsigned int head, nbFree, slot, mask;
+   TA_Integer i;
+
+   if( !queue || !nbPushed )
+      return TA_BAD_PARAM;
+
+   *nbPushed = 0;
+
+   queuePriv = (TA_BarQueuePriv *)queue->hiddenData;
+   if( !queuePriv || (queuePriv->magicNumber != TA_BAR_QUEUE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( nbBar < 0 )
+      return TA_BAD_PARAM;
+   if( (nbBar > 0) && (!timestamp || !open || !high || !low || !close || !volume) )
+      return TA_BAD_PARAM;
+
+   /* The tail seen last time is refreshed only when the queue
+    * looks full, to not read the cache line of the consumer.
+    */
+   head   = queuePriv->head;
+   nbFree = queuePriv->capacity-(head-queuePriv->producerTail);
+   if( nbFree < (unsigned int)nbBar )
+   {
+      queuePriv->producerTail = loadAcquire( &queuePriv->tail );
+      nbFree = queuePriv->capacity-(head-queuePriv->producerTail);
+   }
+   if( (unsigned int)nbBar < nbFree )
+      nbFree = (unsigned int)nbBar;
+
+   arrays = &queuePriv->queue;
+   mask   = queuePriv->capacity-1;
+   for( i=0; i < (TA_Integer)nbFree; i++ )
+   {
+      slot = (head+i)&mask;
+      arrays->timestamp[slot] = timestamp[i];
+      arrays->open[slot]      = open[i];
+      arrays->high[slot]      = high[i];
+      arrays->low[slot]       = low[i];
+      arrays->close[slot]     = close[i];
+      arrays->volume[slot]    = volume[i];
+   }
+
+   if( nbFree > 0 )
+      storeRelease( &queuePriv->head, head+nbFree );
+
+   *nbPushed = (TA_Integer)nbFree;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarQueuePop( TA_BarQueue *queue,
+                           TA_Integer maxBar,
+                           TA_Integer *nbNewBar )
+{
+   TA_BarQueuePriv *queuePriv;
+   TA_BarArrays *arrays, *history;
+   unsigned int tail, nbReady, slot, mask;
+   TA_Integer i, idx;
+
+   if( !queue || !nbNewBar )
+      return TA_BAD_PARAM;
+
+   *nbNewBar = 0;
+
+   queuePriv = (TA_BarQueuePriv *)queue->hiddenData;
+   if( !queuePriv || (queuePriv->magicNumber != TA_BAR_QUEUE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( maxBar < 0 )
+      return TA_BAD_PARAM;
+
+   tail    = queuePriv->tail;
+   nbReady = queuePriv->consumerHead-tail;
+   if( nbReady < (unsigned int)maxBar )
+   {
+      queuePriv->consumerHead = loadAcquire( &queuePriv->head );
+      nbReady = queuePriv->consumerHead-tail;
+   }
+   if( (unsigned int)maxBar < nbReady )
+      nbReady = (unsigned int)maxBar;
+
+   arrays  = &queuePriv->queue;
+   history = &queuePriv->history;
+   mask    = queuePriv->capacity-1;
+   for( i=0; i < (TA_Integer)nbReady; i++ )
+   {
+      slot = (tail+i)&mask;
+      idx  = (TA_Integer)(queuePriv->nbBar%queuePriv->historySize);
+
+      history->timestamp[idx] = arrays->timestamp[slot];
+      history->open[idx]      = arrays->open[slot];
+      history->high[idx]      = arrays->high[slot];
+      history->low[idx]       = arrays->low[slot];
+      history->close[idx]     = arrays->close[slot];
+      history->volume[idx]    = arrays->volume[slot];
+
+      idx += queuePriv->historySize;
+      history->timestamp[idx] = arrays->timestamp[slot];
+      history->open[idx]      = arrays->open[slot];
+      history->high[idx]      = arrays->high[slot];
+      history->low[idx]       = arrays->low[slot];
+      history->close[idx]     = arrays->close[slot];
+      history->volume[idx]    = arrays->volume[slot];
+
+      queuePriv->nbBar++;
+   }
+
+   if( nbReady > 0 )
+      storeRelease( &queuePriv->tail, tail+nbReady );
+
+   *nbNewBar = (TA_Integer)nbReady;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarQueueGetBars( const TA_BarQueue *queue,
+                               TA_Bars *bars )
+{
+   const TA_BarQueuePriv *queuePriv;
+   TA_Integer nbBar, start;
+
+   if( !queue || !bars )
+      return TA_BAD_PARAM;
+
+   queuePriv = (const TA_BarQueuePriv *)queue->hiddenData;
+   if( !queuePriv || (queuePriv->magicNumber != TA_BAR_QUEUE_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( queuePriv->nbBar < (UInt64)queuePriv->historySize )
+      nbBar = (TA_Integer)queuePriv->nbBar;
+   else
+      nbBar = queuePriv->historySize;
+
+   /* The last bar is at 'idx+historySize', the previous ones just before. */
+   if( nbBar > 0 )
+      start = (TA_Integer)((queuePriv->nbBar-1)%queuePriv->historySize)+queuePriv->historySize-nbBar+1;
+   else
+      start = 0;
+
+   bars->nbBar     = nbBar;
+   bars->firstBar  = queuePriv->nbBar-nbBar;
+   bars->timestamp = queuePriv->history.timestamp+start;
+   bars->open      = queuePriv->history.open+start;
+   bars->high      = queuePriv->history.high+start;
+   bars->low       = queuePriv->history.low+start;
+   bars->close     = queuePriv->history.close+start;
+   bars->volume    = queuePriv->history.volume+start;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+
+/* Read an index written by the other thread: what was written
+ * before it was released is visible after this read.
+ */
+static unsigned int loadAcquire( volatile unsigned int *ptr )
+{
+#if defined( __GNUC__ ) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)))
+   return __atomic_load_n( ptr, __ATOMIC_ACQUIRE );
+#elif defined( __GNUC__ )
+   unsigned int value;
+   value = *ptr;
+   __sync_synchronize();
+   return value;
+#elif defined( _MSC_VER )
+   unsigned int value;
+   value = *ptr;
+   MemoryBarrier();
+   return value;
+#else
+   /* Platforms with a strong memory ordering only. */
+   return *ptr;
+#endif
+}
+
+/* Write an index for the other thread, after everything before. */
+static void storeRelease( volatile unsigned int *ptr, unsigned int value )
+{
+#if defined( __GNUC__ ) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)))
+   __atomic_store_n( ptr, value, __ATOMIC_RELEASE );
+#elif defined( __GNUC__ )
+   __sync_synchronize();
+   *ptr = value;
+#elif defined( _MSC_VER )
+   MemoryBarrier();
+   *ptr = value;
+#else
+   *ptr = value;
+#endif
+}
+
+static TA_RetCode allocArrays( TA_BarArrays *arrays, size_t nbElement )
+{
+   arrays->timestamp = (Int64 *)TA_Malloc( nbElement*sizeof(Int64) );
+   arrays->open      = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   arrays->high      = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   arrays->low       = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   arrays->close     = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   arrays->volume    = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+
+   if( !arrays->timestamp || !arrays->open || !arrays->high ||
+       !arrays->low || !arrays->close || !arrays->volume )
+      return TA_ALLOC_ERR;
+
+   return TA_SUCCESS;
+}
+
+static void freeArrays( TA_BarArrays *arrays )
+{
+   FREE_IF_NOT_NULL( arrays->timestamp );
+   FREE_IF_NOT_NULL( arrays->open );
+   FREE_IF_NOT_NULL( arrays->high );
+   FREE_IF_NOT_NULL( arrays->low );
+   FREE_IF_NOT_NULL( arrays->close );
+   FREE_IF_NOT_NULL( arrays->volume );
+}
@@ -0,0 +1,385 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ */
+
+/* Description:
+ *   Aggregation of a stream of trades into time, tick, volume or
+ *   dollar bars (see TA_BarBuilderAlloc).
+ *
+ *   The arrays of the closed bars have 2*maxBar elements and each bar
+ *   is written twice, at 'slot' and 'slot+maxBar'. The last maxBar
+ *   bars are then always contiguous without ever moving the data.
+ */
+
+/**** Headers ****/
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_common.h"
+#include "ta_magic_nb.h"
+#include "ta_memory.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef struct
+{
+   unsigned int magicNumber;
+
+   TA_BarType type;
+   TA_Real    threshold;
+   Int64      period; /* Time bars only. */
+   TA_Integer maxBar;
+
+   /* Closed bars (2*maxBar elements each). */
+   Int64   *timestamp;
+   TA_Real *open;
+   TA_Real *high;
+   TA_Real *low;
+   TA_Real *close;
+   TA_Real *volume;
+   UInt64   nbClosed;
+
+   /* Bar being built. 'amount' is what is compared to the threshold. */
+   int     hasBar;
+   Int64   barTimestamp;
+   TA_Real barOpen;
+   TA_Real barHigh;
+   TA_Real barLow;
+   TA_Real barClose;
+   TA_Real barVolume;
+   TA_Real amount;
+
+   Int64 lastTimestamp;
+} TA_BarBuilderPriv;
+
+/**** Local functions declarations.    ****/
+static void closeBar( TA_BarBuilderPriv *builderPriv );
+static Int64 periodStart( Int64 timestamp, Int64 period );
+
+/**** Local variables definitions.     ****/
+/* None */
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_BarBuilderAlloc( TA_BarType type,
+                               TA_Real threshold,
+                               TA_Integer maxBar,
+                               TA_BarBuilder **allocatedBuilder )
+{
+   TA_BarBuilder *newBuilder;
+   TA_BarBuilderPriv *builderPriv;
+   size_t nbElement;
+
+   if( !allocatedBuilder )
+      return TA_BAD_PARAM;
+
+   *allocatedBuilder = NULL;
+
+   if( (type > TA_BAR_DOLLAR) || !(threshold > 0.0) || (maxBar <= 0) )
+      return TA_BAD_PARAM;
+
+   if( (type == TA_BAR_TIME) && (threshold != floor(threshold)) )
+      return TA_BAD_PARAM;
+
+   newBuilder = (TA_BarBuilder *)TA_Malloc( sizeof(TA_BarBuilder) + sizeof(TA_BarBuilderPriv) );
+   if( !newBuilder )
+      return TA_ALLOC_ERR;
+
+   memset( newBuilder, 0, sizeof(TA_BarBuilder) + sizeof(TA_BarBuilderPriv) );
+   builderPriv = (TA_BarBuilderPriv *)(((char *)newBuilder)+sizeof(TA_BarBuilder));
+   builderPriv->magicNumber = TA_BAR_BUILDER_MAGIC_NB;
+   builderPriv->type        = type;
+   builderPriv->threshold   = threshold;
+   builderPriv->period      = (Int64)threshold;
+   builderPriv->maxBar      = maxBar;
+   newBuilder->hiddenData   = builderPriv;
+
+   /* From this point, TA_BarBuilderFree can be safely called. */
+   nbElement = 2*(size_t)maxBar;
+   builderPriv->timestamp = (Int64 *)TA_Malloc( nbElement*sizeof(Int64) );
+   builderPriv->open      = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   builderPriv->high      = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   builderPriv->low       = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   builderPriv->close     = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   builderPriv->volume    = (TA_Real *)TA_Malloc( nbElement*sizeof(TA_Real) );
+   if( !builderPriv->timestamp || !builderPriv->open || !builderPriv->high ||
+       !builderPriv->low || !builderPriv->close || !builderPriv->volume )
+   {
+      TA_BarBuilderFree( newBuilder );
+      return TA_ALLOC_ERR;
+   }
+
+   *allocatedBuilder = newBuilder;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarBuilderFree( TA_BarBuilder *builder )
+{
+   TA_BarBuilderPriv *builderPriv;
+
+   if( !builder )
+      return TA_BAD_PARAM;
+
+   builderPriv = (TA_BarBuilderPriv *)builder->hiddenData;
+   if( !builderPriv || (builderPriv->magicNumber != TA_BAR_BUILDER_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   builderPriv->magicNumber = 0;
+   FREE_IF_NOT_NULL( builderPriv->timestamp );
+   FREE_IF_NOT_NULL( builderPriv->open );
+   FREE_IF_NOT_NULL( builderPriv->high );
+   FREE_IF_NOT_NULL( builderPriv->low );
+   FREE_IF_NOT_NULL( builderPriv->close );
+   FREE_IF_NOT_NULL( builderPriv->volume );
+   TA_Free( builder );
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarBuilderAdd( TA_BarBuilder *builder,
+                             TA_Integer nbTrade,
+                             const Int64   *timestamp,
+                             const TA_Real *price,
+                             const TA_Real *size,
+                             TA_Integer *nbNewBar )
+{
+   TA_BarBuilderPriv *builderPriv;
+   TA_Integer i, nbClosed;
+   Int64 tradeTimestamp, tradePeriod;
+   TA_Real tradePrice, tradeSize;
+
+   if( !builder || !nbNewBar )
+      return TA_BAD_PARAM;
+
+   *nbNewBar = 0;
+
+   builderPriv = (TA_BarBuilderPriv *)builder->hiddenData;
+   if( !builderPriv || (builderPriv->magicNumber != TA_BAR_BUILDER_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( nbTrade < 0 )
+      return TA_BAD_PARAM;
+   if( (nbTrade > 0) && (!timestamp || !price || !size) )
+      return TA_BAD_PARAM;
+
+   nbClosed = 0;
+   for( i=0; i < nbTrade; i++ )
+   {
+      tradeTimestamp = timestamp[i];
+      tradePrice     = price[i];
+      tradeSize      = size[i];
+
+      if( (tradeTimestamp < builderPriv->lastTimestamp) && (builderPriv->nbClosed || builderPriv->hasBar) )
+      {
+         *nbNewBar = nbClosed;
+         return TA_BAD_PARAM;
+      }
+      if( !(tradeSize >= 0.0) || (tradePrice != tradePrice) )
+      {
+         *nbNewBar = nbClosed;
+         return TA_BAD_PARAM;
+      }
+      builderPriv->lastTimestamp = tradeTimestamp;
+
+      if( builderPriv->type == TA_BAR_TIME )
+      {
+         tradePeriod = periodStart( tradeTimestamp, builderPriv->period );
+         if( builderPriv->hasBar && (tradePeriod != builderPriv->barTimestamp) )
+         {
+            closeBar( builderPriv );
+            nbClosed++;
+         }
+      }
+      else
+         tradePeriod = tradeTimestamp;
+
+      if( !builderPriv->hasBar )
+      {
+         builderPriv->hasBar       = 1;
+         builderPriv->barTimestamp = tradePeriod;
+         builderPriv->barOpen      = tradePrice;
+         builderPriv->barHigh      = tradePrice;
+         builderPriv->barLow       = tradePrice;
+         builderPriv->barVolume    = 0.0;
+         builderPriv->amount       = 0.0;
+      }
+      else
+      {
+         if( tradePrice > builderPriv->barHigh )
+            builderPriv->barHigh = tradePrice;
+         if( tradePrice < builderPriv->barLow )
+            builderPriv->barLow = tradePrice;
+      }
+      builderPriv->barClose   = tradePrice;
+      builderPriv->barVolume += tradeSize;
+
+      switch( builderPriv->type )
+      {
+      case TA_BAR_TIME:
+         continue;
+      case TA_BAR_TICK:
+         builderPriv->amount += 1.0;
+         break;
+      case TA_BAR_VOLUME:
+         builderPriv->amount += tradeSize;
+         break;
+      case TA_BAR_DOLLAR:
+         builderPriv->amount += tradePrice*tradeSize;
+         break;
+      }
+
+      if( builderPriv->amount >= builderPriv->threshold )
+      {
+         closeBar( builderPriv );
+         nbClosed++;
+      }
+   }
+
+   *nbNewBar = nbClosed;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarBuilderFlush( TA_BarBuilder *builder,
+                               TA_Integer *nbNewBar )
+{
+   TA_BarBuilderPriv *builderPriv;
+
+   if( !builder || !nbNewBar )
+      return TA_BAD_PARAM;
+
+   *nbNewBar = 0;
+
+   builderPriv = (TA_BarBuilderPriv *)builder->hiddenData;
+   if( !builderPriv || (builderPriv->magicNumber != TA_BAR_BUILDER_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( builderPriv->hasBar )
+   {
+      closeBar( builderPriv );
+      *nbNewBar = 1;
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_BarBuilderGetBars( const TA_BarBuilder *builder,
+                                 TA_Bars *bars )
+{
+   const TA_BarBuilderPriv *builderPriv;
+   TA_Integer nbBar, start;
+
+   if( !builder || !bars )
+      return TA_BAD_PARAM;
+
+   builderPriv = (const TA_BarBuilderPriv *)builder->hiddenData;
+   if( !builderPriv || (builderPriv->magicNumber != TA_BAR_BUILDER_MAGIC_NB) )
+      return TA_BAD_OBJECT;
+
+   if( builderPriv->nbClosed < (UInt64)builderPriv->maxBar )
+      nbBar = (TA_Integer)builderPriv->nbClosed;
+   else
+      nbBar = builderPriv->maxBar;
+
+   /* The last bar is at 'slot+maxBar', the previous ones just before. */
+   if( nbBar > 0 )
+      start = (TA_Integer)((builderPriv->nbClosed-1)%builderPriv->maxBar)+builderPriv->maxBar-nbBar+1;
+   else
+      start = 0;
+
+   bars->nbBar     = nbBar;
+   bars->firstBar  = builderPriv->nbClosed-nbBar;
+   bars->timestamp = builderPriv->timestamp+start;
+   bars->open      = builderPriv->open+start;
+   bars->high      = builderPriv->high+start;
+   bars->low       = builderPriv->low+start;
+   bars->close     = builderPriv->close+start;
+   bars->volume    = builderPriv->volume+start;
+
+   return TA_SUCCESS;
+}
+
+/**** Local functions definitions.     ****/
+static void closeBar( TA_BarBuilderPriv *builderPriv )
+{
+   TA_Integer slot;
+
+   slot = (TA_Integer)(builderPriv->nbClosed%builderPriv->maxBar);
+
+   builderPriv->timestamp[slot] = builderPriv->barTimestamp;
+   builderPriv->open[slot]      = builderPriv->barOpen;
+   builderPriv->high[slot]      = builderPriv->barHigh;
+   builderPriv->low[slot]       = builderPriv->barLow;
+   builderPriv->close[slot]     = builderPriv->barClose;
+   builderPriv->volume[slot]    = builderPriv->barVolume;
+
+   slot += builderPriv->maxBar;
+   builderPriv->timestamp[slot] = builderPriv->barTimestamp;
+   builderPriv->open[slot]      = builderPriv->barOpen;
+   builderPriv->high[slot]      = builderPriv->barHigh;
+   builderPriv->low[slot]       = builderPriv->barLow;
+   builderPriv->close[slot]     = builderPriv->barClose;
+   builderPriv->volume[slot]    = builderPriv->barVolume;
+
+   builderPriv->nbClosed++;
+   builderPriv->hasBar = 0;
+}
+
+/* Start of the period of a timestamp (rounded toward minus infinity). */
+static Int64 periodStart( Int64 timestamp, Int64 period )
+{
+   Int64 start;
+
+   start = (timestamp/period)*period;
+   if( start > timestamp )
+      start -= period;
+
+   return start;
+}
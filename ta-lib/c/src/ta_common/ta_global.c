@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
+ *  AG       agent <agent@local>
  *
  *
  * Change history:
@@ -48,6 +49,8 @@
  *              and call to TA_RestoreCandleDefaultSettings in TA_Initialize
  *  041106 MF   Add prefix to theGlobals to avoid clash with other libs.
  *  040707 MF   Change global initialization to eliminate Mac OS X link error.
+ *  101826 AG   Add the accounting of the per-function statistics.
+ *  101826 AG   Update the statistics atomically.
  */
 
 /* Description:
@@ -62,7 +65,13 @@
 #include "ta_common.h"
 #include "ta_magic_nb.h"
 #include "ta_global.h"
+#include "ta_memory.h"
 #include "ta_func.h"
+#include "ta_abstract.h"
+
+#if defined( WIN32 ) || defined( _MSC_VER )
+   #include <windows.h>
+#endif
 
 #ifdef TA_LIB_PRO
 /* Section for code distributed with TA-Lib Pro only. */
@@ -77,18 +86,47 @@
 /**** Global variables definitions.    ****/
 
 /* The entry point for all globals */
-TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
+TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}},0};
 
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
 /**** Local declarations.              ****/
-/* None */
+
+/* Storage class of a variable with one instance per thread. Without
+ * it (other compilers), the heap bytes of the statistics are wrong
+ * when calculating from multiple threads.
+ */
+#if defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#elif defined( __GNUC__ )
+   #define TA_THREAD_LOCAL __thread
+#else
+   #define TA_THREAD_LOCAL
+#endif
+
+/* The atomic operations on the statistics. Without them (other
+ * compilers), the statistics are wrong when calculating from multiple
+ * threads.
+ */
+#if defined( __GNUC__ ) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)))
+   #define TA_ATOMIC_BUILTINS
+#elif defined( __GNUC__ )
+   #define TA_SYNC_BUILTINS
+#endif
 
 /**** Local functions declarations.    ****/
-/* None */
+static UInt64 getNanoTime( void );
+static void atomicAdd( UInt64 *ptr, UInt64 value );
+static void atomicMax( UInt64 *ptr, UInt64 value );
+static UInt64 atomicLoad( UInt64 *ptr );
+static void atomicStore( UInt64 *ptr, UInt64 value );
 
 /**** Local variables definitions.     ****/
-/* None */
+
+/* Bytes allocated with TA_Malloc by this thread while the statistics
+ * are enabled. Only the difference between two values is used.
+ */
+static TA_THREAD_LOCAL UInt64 statsAllocBytes;
 
 /**** Global functions definitions.   ****/
 TA_RetCode TA_Initialize( void )
@@ -122,6 +160,59 @@ TA_RetCode TA_Shutdown( void )
    return TA_SUCCESS;
 }
 
+void *TA_StatsMalloc( size_t size )
+{
+   if( TA_Globals->statsEnabled )
+      statsAllocBytes += (UInt64)size;
+
+   return malloc( size );
+}
+
+void TA_StatsCallBegin( TA_StatsCall *statsCall )
+{
+   statsCall->startAllocBytes = statsAllocBytes;
+   statsCall->startTime = getNanoTime();
+}
+
+void TA_StatsCallEnd( struct TA_FuncStats *stats,
+                      const TA_StatsCall *statsCall,
+                      int nbBar )
+{
+   UInt64 elapsed, allocBytes;
+
+   elapsed = getNanoTime()-statsCall->startTime;
+   allocBytes = statsAllocBytes-statsCall->startAllocBytes;
+
+   /* The same function can be called from many threads. */
+   atomicAdd( &stats->nbCall, 1 );
+   if( nbBar > 0 )
+      atomicAdd( &stats->nbBar, (UInt64)nbBar );
+   atomicAdd( &stats->totalTime, elapsed );
+   atomicMax( &stats->peakTime, elapsed );
+   atomicAdd( &stats->allocBytes, allocBytes );
+   atomicMax( &stats->peakAllocBytes, allocBytes );
+}
+
+void TA_StatsCopy( struct TA_FuncStats *to, struct TA_FuncStats *from )
+{
+   to->nbCall         = atomicLoad( &from->nbCall );
+   to->nbBar          = atomicLoad( &from->nbBar );
+   to->totalTime      = atomicLoad( &from->totalTime );
+   to->peakTime       = atomicLoad( &from->peakTime );
+   to->allocBytes     = atomicLoad( &from->allocBytes );
+   to->peakAllocBytes = atomicLoad( &from->peakAllocBytes );
+}
+
+void TA_StatsClear( struct TA_FuncStats *stats )
+{
+   atomicStore( &stats->nbCall, 0 );
+   atomicStore( &stats->nbBar, 0 );
+   atomicStore( &stats->totalTime, 0 );
+   atomicStore( &stats->peakTime, 0 );
+   atomicStore( &stats->allocBytes, 0 );
+   atomicStore( &stats->peakAllocBytes, 0 );
+}
+
 TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType, 
                                  TA_RangeType rangeType, 
                                  int avgPeriod, 
@@ -181,6 +272,106 @@ TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
 }
 
 /**** Local functions definitions.     ****/
-/* None */
 
+/* Monotonic wall clock time in nanoseconds, for the statistics.
+ *
+ * clock() is used only on systems having neither the performance
+ * counter of Windows nor CLOCK_MONOTONIC: it is the processor time
+ * of the whole process, not the elapsed time, so the time of the
+ * statistics then includes the other threads and excludes the time
+ * waiting (page faults etc.).
+ */
+static UInt64 getNanoTime( void )
+{
+#if defined( WIN32 )
+   LARGE_INTEGER counter, frequency;
+
+   QueryPerformanceCounter( &counter );
+   QueryPerformanceFrequency( &frequency );
+   return (UInt64)(counter.QuadPart/frequency.QuadPart)*1000000000 +
+          (UInt64)(counter.QuadPart%frequency.QuadPart)*1000000000/(UInt64)frequency.QuadPart;
+#elif defined( CLOCK_MONOTONIC )
+   struct timespec ts;
 
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (UInt64)ts.tv_sec*1000000000 + (UInt64)ts.tv_nsec;
+#else
+   return (UInt64)clock()*1000000000/CLOCKS_PER_SEC;
+#endif
+}
+
+
+
+/* Add to a statistic shared by the threads. */
+static void atomicAdd( UInt64 *ptr, UInt64 value )
+{
+#if defined( TA_ATOMIC_BUILTINS )
+   __atomic_fetch_add( ptr, value, __ATOMIC_RELAXED );
+#elif defined( TA_SYNC_BUILTINS )
+   __sync_fetch_and_add( ptr, value );
+#elif defined( _MSC_VER )
+   InterlockedExchangeAdd64( (volatile LONGLONG *)ptr, (LONGLONG)value );
+#else
+   *ptr += value;
+#endif
+}
+
+/* Keep the largest value, retried when another thread changed it. */
+static void atomicMax( UInt64 *ptr, UInt64 value )
+{
+   UInt64 current;
+
+   current = atomicLoad( ptr );
+   while( value > current )
+   {
+#if defined( TA_ATOMIC_BUILTINS )
+      if( __atomic_compare_exchange_n( ptr, &current, value, 0,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+         return;
+#elif defined( TA_SYNC_BUILTINS )
+      if( __sync_bool_compare_and_swap( ptr, current, value ) )
+         return;
+      current = atomicLoad( ptr );
+#elif defined( _MSC_VER )
+      if( (UInt64)InterlockedCompareExchange64( (volatile LONGLONG *)ptr,
+                                                (LONGLONG)value,
+                                                (LONGLONG)current ) == current )
+         return;
+      current = atomicLoad( ptr );
+#else
+      *ptr = value;
+      return;
+#endif
+   }
+}
+
+/* Read a statistic without a torn value (64 bits on a 32 bits system). */
+static UInt64 atomicLoad( UInt64 *ptr )
+{
+#if defined( TA_ATOMIC_BUILTINS )
+   return __atomic_load_n( ptr, __ATOMIC_RELAXED );
+#elif defined( TA_SYNC_BUILTINS )
+   return __sync_fetch_and_add( ptr, 0 );
+#elif defined( _MSC_VER )
+   return (UInt64)InterlockedCompareExchange64( (volatile LONGLONG *)ptr, 0, 0 );
+#else
+   return *ptr;
+#endif
+}
+
+static void atomicStore( UInt64 *ptr, UInt64 value )
+{
+#if defined( TA_ATOMIC_BUILTINS )
+   __atomic_store_n( ptr, value, __ATOMIC_RELAXED );
+#elif defined( TA_SYNC_BUILTINS )
+   UInt64 current;
+
+   current = *ptr;
+   while( !__sync_bool_compare_and_swap( ptr, current, value ) )
+      current = *ptr;
+#elif defined( _MSC_VER )
+   InterlockedExchange64( (volatile LONGLONG *)ptr, (LONGLONG)value );
+#else
+   *ptr = value;
+#endif
+}
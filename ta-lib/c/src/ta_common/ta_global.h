@@ -109,6 +109,9 @@ typedef struct
    /* For handling the candlestick global settings */
    TA_CandleSetting candleSettings[TA_AllCandleSettings];
 
+   /* For the per-function statistics (see TA_StatsEnable). */
+   unsigned int statsEnabled;
+
 } TA_LibcPriv;
 
 /* The following global is used all over the place 
@@ -116,4 +119,33 @@ typedef struct
  */
 extern TA_LibcPriv *TA_Globals;
 
+/* Accounting of one calculation to the statistics of its function
+ * (see TA_StatsEnable), done by each TA function when the statistics
+ * are enabled:
+ *
+ *    TA_StatsCallBegin( &statsCall );
+ *    ... calculation ...
+ *    TA_StatsCallEnd( &TA_STATS_XXX, &statsCall, endIdx-startIdx+1 );
+ *
+ * The heap bytes allocated with TA_Malloc are counted per thread: a
+ * calculation accounts the bytes allocated by its own thread between
+ * the two calls, including those of the TA functions it calls.
+ */
+struct TA_FuncStats;
+
+typedef struct
+{
+   UInt64 startTime;
+   UInt64 startAllocBytes;
+} TA_StatsCall;
+
+void TA_StatsCallBegin( TA_StatsCall *statsCall );
+void TA_StatsCallEnd( struct TA_FuncStats *stats,
+                      const TA_StatsCall *statsCall,
+                      int nbBar );
+
+/* Read and reset the statistics while other threads may update them. */
+void TA_StatsCopy( struct TA_FuncStats *to, struct TA_FuncStats *from );
+void TA_StatsClear( struct TA_FuncStats *stats );
+
 #endif
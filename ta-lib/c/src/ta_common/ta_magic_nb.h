@@ -27,5 +27,11 @@
 #define TA_PMREPORT_MAGIC_NB            0xA210B210
 #define TA_TRADEREPORT_MAGIC_NB         0xA211B211
 #define TA_HISTORY_MAGIC_NB             0xA212B212
+#define TA_SERIES_INDEX_MAGIC_NB        0xA213B213
+#define TA_CHECKPOINT_MAGIC_NB          0xA214B214
+#define TA_RESULT_CACHE_MAGIC_NB        0xA215B215
+#define TA_BAR_BUILDER_MAGIC_NB         0xA216B216
+#define TA_TIMEFRAMES_MAGIC_NB          0xA217B217
+#define TA_BAR_QUEUE_MAGIC_NB           0xA218B218
 
 #endif
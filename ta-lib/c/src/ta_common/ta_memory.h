@@ -8,8 +8,13 @@
 
    #include <stdlib.h> 
 
+   /* Same as malloc, but the bytes are counted for the
+    * per-function statistics when these are enabled.
+    */
+   void *TA_StatsMalloc( size_t size );
+
    /* Interface macros */
-   #define TA_Malloc(a)       malloc(a)
+   #define TA_Malloc(a)       TA_StatsMalloc(a)
    #define TA_Realloc(a,b)    realloc((a),(b))
    #define TA_Free(a)         free(a)
 
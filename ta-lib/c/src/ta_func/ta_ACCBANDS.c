@@ -159,17 +159,17 @@
 /* Generated */                          double        outRealMiddleBand[],
 /* Generated */                          double        outRealLowerBand[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_ACCBANDS( int    startIdx,
-/* Generated */                                    int    endIdx,
-/* Generated */                                               const double inHigh[],
-/* Generated */                                               const double inLow[],
-/* Generated */                                               const double inClose[],
-/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                               int          *outBegIdx,
-/* Generated */                                               int          *outNBElement,
-/* Generated */                                               double        outRealUpperBand[],
-/* Generated */                                               double        outRealMiddleBand[],
-/* Generated */                                               double        outRealLowerBand[] )
+/* Generated */ static TA_RetCode TA_ACCBANDS_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const double inHigh[],
+/* Generated */                                            const double inLow[],
+/* Generated */                                            const double inClose[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outRealUpperBand[],
+/* Generated */                                            double        outRealMiddleBand[],
+/* Generated */                                            double        outRealLowerBand[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -382,17 +382,17 @@
 /* Generated */                          double        outRealMiddleBand[],
 /* Generated */                          double        outRealLowerBand[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_ACCBANDS( int    startIdx,
-/* Generated */                           int    endIdx,
-/* Generated */                           const float  inHigh[],
-/* Generated */                           const float  inLow[],
-/* Generated */                           const float  inClose[],
-/* Generated */                           int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                           int          *outBegIdx,
-/* Generated */                           int          *outNBElement,
-/* Generated */                           double        outRealUpperBand[],
-/* Generated */                           double        outRealMiddleBand[],
-/* Generated */                           double        outRealLowerBand[] )
+/* Generated */ static TA_RetCode TA_S_ACCBANDS_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const float  inHigh[],
+/* Generated */                                              const float  inLow[],
+/* Generated */                                              const float  inClose[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outRealUpperBand[],
+/* Generated */                                              double        outRealMiddleBand[],
+/* Generated */                                              double        outRealLowerBand[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -509,6 +509,70 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_ACCBANDS;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_ACCBANDS( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const double inHigh[],
+/* Generated */                                               const double inLow[],
+/* Generated */                                               const double inClose[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outRealUpperBand[],
+/* Generated */                                               double        outRealMiddleBand[],
+/* Generated */                                               double        outRealLowerBand[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_ACCBANDS_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_ACCBANDS_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ACCBANDS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_ACCBANDS( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const float  inHigh[],
+/* Generated */                                                 const float  inLow[],
+/* Generated */                                                 const float  inClose[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 double        outRealUpperBand[],
+/* Generated */                                                 double        outRealMiddleBand[],
+/* Generated */                                                 double        outRealLowerBand[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_ACCBANDS_Calc( startIdx, endIdx,
+/* Generated */                                  inHigh, inLow, inClose,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_ACCBANDS_Calc( startIdx, endIdx,
+/* Generated */                                  inHigh, inLow, inClose,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ACCBANDS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -142,15 +142,15 @@
 /* Generated */                    MInteger     outNBElement,
 /* Generated */                    double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_AD( int    startIdx,
-/* Generated */                              int    endIdx,
-/* Generated */                                         const double inHigh[],
-/* Generated */                                         const double inLow[],
-/* Generated */                                         const double inClose[],
-/* Generated */                                         const double inVolume[],
-/* Generated */                                         int          *outBegIdx,
-/* Generated */                                         int          *outNBElement,
-/* Generated */                                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_AD_Calc( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                      const double inHigh[],
+/* Generated */                                      const double inLow[],
+/* Generated */                                      const double inClose[],
+/* Generated */                                      const double inVolume[],
+/* Generated */                                      int          *outBegIdx,
+/* Generated */                                      int          *outNBElement,
+/* Generated */                                      double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -270,15 +270,15 @@
 /* Generated */                    MInteger     outNBElement,
 /* Generated */                    double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_AD( int    startIdx,
-/* Generated */                     int    endIdx,
-/* Generated */                     const float  inHigh[],
-/* Generated */                     const float  inLow[],
-/* Generated */                     const float  inClose[],
-/* Generated */                     const float  inVolume[],
-/* Generated */                     int          *outBegIdx,
-/* Generated */                     int          *outNBElement,
-/* Generated */                     double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_AD_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const float  inHigh[],
+/* Generated */                                        const float  inLow[],
+/* Generated */                                        const float  inClose[],
+/* Generated */                                        const float  inVolume[],
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int nbBar, currentBar, outIdx;
@@ -319,6 +319,62 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_AD;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_AD( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                                         const double inHigh[],
+/* Generated */                                         const double inLow[],
+/* Generated */                                         const double inClose[],
+/* Generated */                                         const double inVolume[],
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_AD_Calc( startIdx, endIdx,
+/* Generated */                          inHigh, inLow, inClose, inVolume,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_AD_Calc( startIdx, endIdx,
+/* Generated */                          inHigh, inLow, inClose, inVolume,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_AD( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const float  inHigh[],
+/* Generated */                                           const float  inLow[],
+/* Generated */                                           const float  inClose[],
+/* Generated */                                           const float  inVolume[],
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_AD_Calc( startIdx, endIdx,
+/* Generated */                            inHigh, inLow, inClose, inVolume,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_AD_Calc( startIdx, endIdx,
+/* Generated */                            inHigh, inLow, inClose, inVolume,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
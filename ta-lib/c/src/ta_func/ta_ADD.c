@@ -132,13 +132,13 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_ADD( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inReal0[],
-/* Generated */                                          const double inReal1[],
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_ADD_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inReal0[],
+/* Generated */                                       const double inReal1[],
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -228,13 +228,13 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_ADD( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inReal0[],
-/* Generated */                      const float  inReal1[],
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_ADD_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inReal0[],
+/* Generated */                                         const float  inReal1[],
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx;
@@ -270,6 +270,58 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_ADD;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_ADD( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inReal0[],
+/* Generated */                                          const double inReal1[],
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_ADD_Calc( startIdx, endIdx,
+/* Generated */                           inReal0, inReal1,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_ADD_Calc( startIdx, endIdx,
+/* Generated */                           inReal0, inReal1,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ADD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_ADD( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inReal0[],
+/* Generated */                                            const float  inReal1[],
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_ADD_Calc( startIdx, endIdx,
+/* Generated */                             inReal0, inReal1,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_ADD_Calc( startIdx, endIdx,
+/* Generated */                             inReal0, inReal1,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ADD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -180,17 +180,17 @@
 /* Generated */                       MInteger     outNBElement,
 /* Generated */                       double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_ADOSC( int    startIdx,
-/* Generated */                                 int    endIdx,
-/* Generated */                                            const double inHigh[],
-/* Generated */                                            const double inLow[],
-/* Generated */                                            const double inClose[],
-/* Generated */                                            const double inVolume[],
-/* Generated */                                            int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                                            int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                                            int          *outBegIdx,
-/* Generated */                                            int          *outNBElement,
-/* Generated */                                            double        outReal[] )
+/* Generated */ static TA_RetCode TA_ADOSC_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const double inHigh[],
+/* Generated */                                         const double inLow[],
+/* Generated */                                         const double inClose[],
+/* Generated */                                         const double inVolume[],
+/* Generated */                                         int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                         int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -394,17 +394,17 @@
 /* Generated */                       MInteger     outNBElement,
 /* Generated */                       double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_ADOSC( int    startIdx,
-/* Generated */                        int    endIdx,
-/* Generated */                        const float  inHigh[],
-/* Generated */                        const float  inLow[],
-/* Generated */                        const float  inClose[],
-/* Generated */                        const float  inVolume[],
-/* Generated */                        int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                        int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                        int          *outBegIdx,
-/* Generated */                        int          *outNBElement,
-/* Generated */                        double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_ADOSC_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const float  inHigh[],
+/* Generated */                                           const float  inLow[],
+/* Generated */                                           const float  inClose[],
+/* Generated */                                           const float  inVolume[],
+/* Generated */                                           int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                           int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int today, outIdx, lookbackTotal;
@@ -486,6 +486,70 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_ADOSC;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_ADOSC( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const double inHigh[],
+/* Generated */                                            const double inLow[],
+/* Generated */                                            const double inClose[],
+/* Generated */                                            const double inVolume[],
+/* Generated */                                            int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                            int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_ADOSC_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose, inVolume,
+/* Generated */                             optInFastPeriod, optInSlowPeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_ADOSC_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose, inVolume,
+/* Generated */                             optInFastPeriod, optInSlowPeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ADOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_ADOSC( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const float  inHigh[],
+/* Generated */                                              const float  inLow[],
+/* Generated */                                              const float  inClose[],
+/* Generated */                                              const float  inVolume[],
+/* Generated */                                              int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                              int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_ADOSC_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow, inClose, inVolume,
+/* Generated */                               optInFastPeriod, optInSlowPeriod,
+/* Generated */                               outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_ADOSC_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow, inClose, inVolume,
+/* Generated */                               optInFastPeriod, optInSlowPeriod,
+/* Generated */                               outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ADOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
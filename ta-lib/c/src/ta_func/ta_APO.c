@@ -179,15 +179,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_APO( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inReal[],
-/* Generated */                                          int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                                          int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                                          TA_MAType     optInMAType,
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_APO_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inReal[],
+/* Generated */                                       int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                       int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                       TA_MAType     optInMAType,
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -439,15 +439,15 @@ TA_RetCode TA_PREFIX(INT_PO)( int    startIdx,
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_APO( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inReal[],
-/* Generated */                      int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                      int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                      TA_MAType     optInMAType,
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_APO_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inReal[],
+/* Generated */                                         int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                         int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                         TA_MAType     optInMAType,
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ARRAY_REF(tempBuffer);
@@ -610,6 +610,66 @@ TA_RetCode TA_PREFIX(INT_PO)( int    startIdx,
 /* Generated */ }
 /* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_APO;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_APO( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                          int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                          TA_MAType     optInMAType,
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_APO_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInFastPeriod, optInSlowPeriod, optInMAType,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_APO_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInFastPeriod, optInSlowPeriod, optInMAType,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_APO, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_APO( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                            int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                            TA_MAType     optInMAType,
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_APO_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInFastPeriod, optInSlowPeriod, optInMAType,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_APO_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInFastPeriod, optInSlowPeriod, optInMAType,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_APO, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -153,15 +153,15 @@
 /* Generated */                       double        outAroonDown[],
 /* Generated */                       double        outAroonUp[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_AROON( int    startIdx,
-/* Generated */                                 int    endIdx,
-/* Generated */                                            const double inHigh[],
-/* Generated */                                            const double inLow[],
-/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                            int          *outBegIdx,
-/* Generated */                                            int          *outNBElement,
-/* Generated */                                            double        outAroonDown[],
-/* Generated */                                            double        outAroonUp[] )
+/* Generated */ static TA_RetCode TA_AROON_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const double inHigh[],
+/* Generated */                                         const double inLow[],
+/* Generated */                                         int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outAroonDown[],
+/* Generated */                                         double        outAroonUp[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -349,15 +349,15 @@
 /* Generated */                       double        outAroonDown[],
 /* Generated */                       double        outAroonUp[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_AROON( int    startIdx,
-/* Generated */                        int    endIdx,
-/* Generated */                        const float  inHigh[],
-/* Generated */                        const float  inLow[],
-/* Generated */                        int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                        int          *outBegIdx,
-/* Generated */                        int          *outNBElement,
-/* Generated */                        double        outAroonDown[],
-/* Generated */                        double        outAroonUp[] )
+/* Generated */ static TA_RetCode TA_S_AROON_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const float  inHigh[],
+/* Generated */                                           const float  inLow[],
+/* Generated */                                           int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outAroonDown[],
+/* Generated */                                           double        outAroonUp[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp, factor;
@@ -454,6 +454,66 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_AROON;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_AROON( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const double inHigh[],
+/* Generated */                                            const double inLow[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outAroonDown[],
+/* Generated */                                            double        outAroonUp[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_AROON_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outAroonDown, outAroonUp );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_AROON_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outAroonDown, outAroonUp );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AROON, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_AROON( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const float  inHigh[],
+/* Generated */                                              const float  inLow[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outAroonDown[],
+/* Generated */                                              double        outAroonUp[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_AROON_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow,
+/* Generated */                               optInTimePeriod,
+/* Generated */                               outBegIdx, outNBElement, outAroonDown, outAroonUp );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_AROON_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow,
+/* Generated */                               optInTimePeriod,
+/* Generated */                               outBegIdx, outNBElement, outAroonDown, outAroonUp );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AROON, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -151,14 +151,14 @@
 /* Generated */                          MInteger     outNBElement,
 /* Generated */                          double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_AROONOSC( int    startIdx,
-/* Generated */                                    int    endIdx,
-/* Generated */                                               const double inHigh[],
-/* Generated */                                               const double inLow[],
-/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                               int          *outBegIdx,
-/* Generated */                                               int          *outNBElement,
-/* Generated */                                               double        outReal[] )
+/* Generated */ static TA_RetCode TA_AROONOSC_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const double inHigh[],
+/* Generated */                                            const double inLow[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -357,14 +357,14 @@
 /* Generated */                          MInteger     outNBElement,
 /* Generated */                          double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_AROONOSC( int    startIdx,
-/* Generated */                           int    endIdx,
-/* Generated */                           const float  inHigh[],
-/* Generated */                           const float  inLow[],
-/* Generated */                           int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                           int          *outBegIdx,
-/* Generated */                           int          *outNBElement,
-/* Generated */                           double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_AROONOSC_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const float  inHigh[],
+/* Generated */                                              const float  inLow[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double lowest, highest, tmp, factor, aroon;
@@ -459,6 +459,64 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_AROONOSC;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_AROONOSC( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const double inHigh[],
+/* Generated */                                               const double inLow[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_AROONOSC_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_AROONOSC_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AROONOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_AROONOSC( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const float  inHigh[],
+/* Generated */                                                 const float  inLow[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_AROONOSC_Calc( startIdx, endIdx,
+/* Generated */                                  inHigh, inLow,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_AROONOSC_Calc( startIdx, endIdx,
+/* Generated */                                  inHigh, inLow,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_AROONOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -129,12 +129,12 @@
 /* Generated */                      MInteger     outNBElement,
 /* Generated */                      double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_ASIN( int    startIdx,
-/* Generated */                                int    endIdx,
-/* Generated */                                           const double inReal[],
-/* Generated */                                           int          *outBegIdx,
-/* Generated */                                           int          *outNBElement,
-/* Generated */                                           double        outReal[] )
+/* Generated */ static TA_RetCode TA_ASIN_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const double inReal[],
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -213,12 +213,12 @@
 /* Generated */                      MInteger     outNBElement,
 /* Generated */                      double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_ASIN( int    startIdx,
-/* Generated */                       int    endIdx,
-/* Generated */                       const float  inReal[],
-/* Generated */                       int          *outBegIdx,
-/* Generated */                       int          *outNBElement,
-/* Generated */                       double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_ASIN_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const float  inReal[],
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx;
@@ -248,6 +248,56 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_ASIN;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_ASIN( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_ASIN_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_ASIN_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ASIN, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_ASIN( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_ASIN_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_ASIN_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ASIN, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -200,18 +200,18 @@
 /* Generated */                        double        outRealMiddleBand[],
 /* Generated */                        double        outRealLowerBand[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_BBANDS( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inReal[],
-/* Generated */                                             int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                             double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                                             double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                                             TA_MAType     optInMAType,
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outRealUpperBand[],
-/* Generated */                                             double        outRealMiddleBand[],
-/* Generated */                                             double        outRealLowerBand[] )
+/* Generated */ static TA_RetCode TA_BBANDS_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                          double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                          TA_MAType     optInMAType,
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outRealUpperBand[],
+/* Generated */                                          double        outRealMiddleBand[],
+/* Generated */                                          double        outRealLowerBand[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -482,18 +482,18 @@
 /* Generated */                        double        outRealMiddleBand[],
 /* Generated */                        double        outRealLowerBand[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_BBANDS( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inReal[],
-/* Generated */                         int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                         double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                         double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                         TA_MAType     optInMAType,
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outRealUpperBand[],
-/* Generated */                         double        outRealMiddleBand[],
-/* Generated */                         double        outRealLowerBand[] )
+/* Generated */ static TA_RetCode TA_S_BBANDS_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                            double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                            TA_MAType     optInMAType,
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outRealUpperBand[],
+/* Generated */                                            double        outRealMiddleBand[],
+/* Generated */                                            double        outRealLowerBand[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -650,6 +650,72 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_BBANDS;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_BBANDS( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inReal[],
+/* Generated */                                             int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                             double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                             double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                             TA_MAType     optInMAType,
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outRealUpperBand[],
+/* Generated */                                             double        outRealMiddleBand[],
+/* Generated */                                             double        outRealLowerBand[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_BBANDS_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+/* Generated */                              outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_BBANDS_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+/* Generated */                              outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_BBANDS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_BBANDS( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               double        optInNbDevUp, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                               double        optInNbDevDn, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                               TA_MAType     optInMAType,
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outRealUpperBand[],
+/* Generated */                                               double        outRealMiddleBand[],
+/* Generated */                                               double        outRealLowerBand[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_BBANDS_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+/* Generated */                                outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_BBANDS_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInNbDevUp, optInNbDevDn, optInMAType,
+/* Generated */                                outBegIdx, outNBElement, outRealUpperBand, outRealMiddleBand, outRealLowerBand );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_BBANDS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
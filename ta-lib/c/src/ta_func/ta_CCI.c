@@ -155,15 +155,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_CCI( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inHigh[],
-/* Generated */                                          const double inLow[],
-/* Generated */                                          const double inClose[],
-/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_CCI_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inHigh[],
+/* Generated */                                       const double inLow[],
+/* Generated */                                       const double inClose[],
+/* Generated */                                       int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -340,15 +340,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_CCI( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inHigh[],
-/* Generated */                      const float  inLow[],
-/* Generated */                      const float  inClose[],
-/* Generated */                      int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_CCI_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inHigh[],
+/* Generated */                                         const float  inLow[],
+/* Generated */                                         const float  inClose[],
+/* Generated */                                         int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double tempReal, tempReal2, theAverage, lastValue;
@@ -420,6 +420,66 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_CCI;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_CCI( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inHigh[],
+/* Generated */                                          const double inLow[],
+/* Generated */                                          const double inClose[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_CCI_Calc( startIdx, endIdx,
+/* Generated */                           inHigh, inLow, inClose,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_CCI_Calc( startIdx, endIdx,
+/* Generated */                           inHigh, inLow, inClose,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CCI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_CCI( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inHigh[],
+/* Generated */                                            const float  inLow[],
+/* Generated */                                            const float  inClose[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_CCI_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_CCI_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CCI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -141,15 +141,15 @@
 /* Generated */                              MInteger     outNBElement,
 /* Generated */                              int           outInteger[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_CDLENGULFING( int    startIdx,
-/* Generated */                                        int    endIdx,
-/* Generated */                                                   const double inOpen[],
-/* Generated */                                                   const double inHigh[],
-/* Generated */                                                   const double inLow[],
-/* Generated */                                                   const double inClose[],
-/* Generated */                                                   int          *outBegIdx,
-/* Generated */                                                   int          *outNBElement,
-/* Generated */                                                   int           outInteger[] )
+/* Generated */ static TA_RetCode TA_CDLENGULFING_Calc( int    startIdx,
+/* Generated */                                         int    endIdx,
+/* Generated */                                                const double inOpen[],
+/* Generated */                                                const double inHigh[],
+/* Generated */                                                const double inLow[],
+/* Generated */                                                const double inClose[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                int           outInteger[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -291,15 +291,15 @@
 /* Generated */                              MInteger     outNBElement,
 /* Generated */                              int           outInteger[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_CDLENGULFING( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                               const float  inOpen[],
-/* Generated */                               const float  inHigh[],
-/* Generated */                               const float  inLow[],
-/* Generated */                               const float  inClose[],
-/* Generated */                               int          *outBegIdx,
-/* Generated */                               int          *outNBElement,
-/* Generated */                               int           outInteger[] )
+/* Generated */ static TA_RetCode TA_S_CDLENGULFING_Calc( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                                  const float  inOpen[],
+/* Generated */                                                  const float  inHigh[],
+/* Generated */                                                  const float  inLow[],
+/* Generated */                                                  const float  inClose[],
+/* Generated */                                                  int          *outBegIdx,
+/* Generated */                                                  int          *outNBElement,
+/* Generated */                                                  int           outInteger[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */     int i, outIdx, lookbackTotal;
@@ -358,6 +358,62 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_CDLENGULFING;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_CDLENGULFING( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                                   const double inOpen[],
+/* Generated */                                                   const double inHigh[],
+/* Generated */                                                   const double inLow[],
+/* Generated */                                                   const double inClose[],
+/* Generated */                                                   int          *outBegIdx,
+/* Generated */                                                   int          *outNBElement,
+/* Generated */                                                   int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_CDLENGULFING_Calc( startIdx, endIdx,
+/* Generated */                                    inOpen, inHigh, inLow, inClose,
+/* Generated */                                    outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_CDLENGULFING_Calc( startIdx, endIdx,
+/* Generated */                                    inOpen, inHigh, inLow, inClose,
+/* Generated */                                    outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CDLENGULFING, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_CDLENGULFING( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                                     const float  inOpen[],
+/* Generated */                                                     const float  inHigh[],
+/* Generated */                                                     const float  inLow[],
+/* Generated */                                                     const float  inClose[],
+/* Generated */                                                     int          *outBegIdx,
+/* Generated */                                                     int          *outNBElement,
+/* Generated */                                                     int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_CDLENGULFING_Calc( startIdx, endIdx,
+/* Generated */                                      inOpen, inHigh, inLow, inClose,
+/* Generated */                                      outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_CDLENGULFING_Calc( startIdx, endIdx,
+/* Generated */                                      inOpen, inHigh, inLow, inClose,
+/* Generated */                                      outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CDLENGULFING, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -151,14 +151,14 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_CORREL( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inReal0[],
-/* Generated */                                             const double inReal1[],
-/* Generated */                                             int           optInTimePeriod, /* From 1 to 100000 */
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outReal[] )
+/* Generated */ static TA_RetCode TA_CORREL_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inReal0[],
+/* Generated */                                          const double inReal1[],
+/* Generated */                                          int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -320,14 +320,14 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_CORREL( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inReal0[],
-/* Generated */                         const float  inReal1[],
-/* Generated */                         int           optInTimePeriod, /* From 1 to 100000 */
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_CORREL_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inReal0[],
+/* Generated */                                            const float  inReal1[],
+/* Generated */                                            int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */     double sumXY, sumX, sumY, sumX2, sumY2, x, y, trailingX, trailingY;
@@ -407,6 +407,64 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_CORREL;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_CORREL( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inReal0[],
+/* Generated */                                             const double inReal1[],
+/* Generated */                                             int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_CORREL_Calc( startIdx, endIdx,
+/* Generated */                              inReal0, inReal1,
+/* Generated */                              optInTimePeriod,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_CORREL_Calc( startIdx, endIdx,
+/* Generated */                              inReal0, inReal1,
+/* Generated */                              optInTimePeriod,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CORREL, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_CORREL( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inReal0[],
+/* Generated */                                               const float  inReal1[],
+/* Generated */                                               int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_CORREL_Calc( startIdx, endIdx,
+/* Generated */                                inReal0, inReal1,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_CORREL_Calc( startIdx, endIdx,
+/* Generated */                                inReal0, inReal1,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CORREL, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
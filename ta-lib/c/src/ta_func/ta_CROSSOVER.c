@@ -0,0 +1,337 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101826 AG     Initial Version
+ */
+
+/**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+/* All code within this section is automatically
+ * generated by gen_code. Any modification will be lost
+ * next time gen_code is run.
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */    #include "TA-Lib-Core.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode::InternalError)
+/* Generated */    namespace TicTacTec { namespace TA { namespace Library {
+/* Generated */ #elif defined( _JAVA )
+/* Generated */    #include "ta_defs.h"
+/* Generated */    #include "ta_java_defs.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode.InternalError)
+/* Generated */ #else
+/* Generated */    #include <string.h>
+/* Generated */    #include <math.h>
+/* Generated */    #include "ta_func.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_UTILITY_H
+/* Generated */    #include "ta_utility.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_MEMORY_H
+/* Generated */    #include "ta_memory.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #define TA_PREFIX(x) TA_##x
+/* Generated */ #define INPUT_TYPE   double
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ int Core::CrossOverLookback( void )
+/* Generated */ 
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public int crossOverLookback(  )
+/* Generated */ 
+/* Generated */ #else
+/* Generated */ TA_LIB_API int TA_CROSSOVER_Lookback( void )
+/* Generated */ 
+/* Generated */ #endif
+/**** END GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+/* Generated */ /* No parameters to validate. */
+/**** END GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+
+   /* insert lookback code here. */
+
+   /* The previous value is needed to detect a cross. */
+   return 1;
+}
+
+/**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+/*
+ * TA_CROSSOVER - Series 0 crossing above series 1
+ * 
+ * Input  = double, double
+ * Output = int
+ * 
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::CrossOver( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           SubArray<double>^ inReal0,
+/* Generated */                                           SubArray<double>^ inReal1,
+/* Generated */                                           [Out]int%    outBegIdx,
+/* Generated */                                           [Out]int%    outNBElement,
+/* Generated */                                           SubArray<int>^  outInteger )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::CrossOver( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           cli::array<double>^ inReal0,
+/* Generated */                                           cli::array<double>^ inReal1,
+/* Generated */                                           [Out]int%    outBegIdx,
+/* Generated */                                           [Out]int%    outNBElement,
+/* Generated */                                           cli::array<int>^  outInteger )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode crossOver( int    startIdx,
+/* Generated */                           int    endIdx,
+/* Generated */                           double       inReal0[],
+/* Generated */                           double       inReal1[],
+/* Generated */                           MInteger     outBegIdx,
+/* Generated */                           MInteger     outNBElement,
+/* Generated */                           int           outInteger[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_CROSSOVER_Calc( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                             const double inReal0[],
+/* Generated */                                             const double inReal1[],
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             int           outInteger[] )
+/* Generated */ #endif
+/**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+   int i, outIdx;
+
+/**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */ 
+/* Generated */    /* Validate the requested output range. */
+/* Generated */    if( startIdx < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */    if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !inReal0 ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    if( !inReal1 ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    #endif /* !defined(_JAVA)*/
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !outInteger )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #endif /* !defined(_JAVA) */
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/* Generated */ 
+/**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+
+   /* Insert TA function code here. */
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < 1 )
+      startIdx = 1;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* inReal0 crosses above inReal1 when it was at or below
+    * inReal1 on the previous bar and is above it now.
+    * The output is 100 at the bar of the cross, else 0.
+    *
+    * Both comparisons are always evaluated ('&' instead
+    * of '&&'), so the loop has no branch and can be
+    * vectorized by the compiler.
+    */
+   outIdx = 0;
+   for( i=startIdx; i <= endIdx; i++ )
+      outInteger[outIdx++] = ((inReal0[i] > inReal1[i]) & (inReal0[i-1] <= inReal1[i-1]))? 100 : 0;
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+
+/**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #define  USE_SINGLE_PRECISION_INPUT
+/* Generated */ #undef  TA_LIB_PRO
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    #undef   TA_PREFIX
+/* Generated */    #define  TA_PREFIX(x) TA_S_##x
+/* Generated */ #endif
+/* Generated */ #undef   INPUT_TYPE
+/* Generated */ #define  INPUT_TYPE float
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::CrossOver( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           SubArray<float>^ inReal0,
+/* Generated */                                           SubArray<float>^ inReal1,
+/* Generated */                                           [Out]int%    outBegIdx,
+/* Generated */                                           [Out]int%    outNBElement,
+/* Generated */                                           SubArray<int>^  outInteger )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::CrossOver( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                           cli::array<float>^ inReal0,
+/* Generated */                                           cli::array<float>^ inReal1,
+/* Generated */                                           [Out]int%    outBegIdx,
+/* Generated */                                           [Out]int%    outNBElement,
+/* Generated */                                           cli::array<int>^  outInteger )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode crossOver( int    startIdx,
+/* Generated */                           int    endIdx,
+/* Generated */                           float        inReal0[],
+/* Generated */                           float        inReal1[],
+/* Generated */                           MInteger     outBegIdx,
+/* Generated */                           MInteger     outNBElement,
+/* Generated */                           int           outInteger[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_S_CROSSOVER_Calc( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                               const float  inReal0[],
+/* Generated */                                               const float  inReal1[],
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               int           outInteger[] )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int i, outIdx;
+/* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */     if( startIdx < 0 )
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */     if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !inReal0 ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( !inReal1 ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !outInteger )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */  #endif 
+/* Generated */    if( startIdx < 1 )
+/* Generated */       startIdx = 1;
+/* Generated */    if( startIdx > endIdx )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    outIdx = 0;
+/* Generated */    for( i=startIdx; i <= endIdx; i++ )
+/* Generated */       outInteger[outIdx++] = ((inReal0[i] > inReal1[i]) & (inReal0[i-1] <= inReal1[i-1]))? 100 : 0;
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_CROSSOVER;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_CROSSOVER( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                                const double inReal0[],
+/* Generated */                                                const double inReal1[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_CROSSOVER_Calc( startIdx, endIdx,
+/* Generated */                                 inReal0, inReal1,
+/* Generated */                                 outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_CROSSOVER_Calc( startIdx, endIdx,
+/* Generated */                                 inReal0, inReal1,
+/* Generated */                                 outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CROSSOVER, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_CROSSOVER( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                                  const float  inReal0[],
+/* Generated */                                                  const float  inReal1[],
+/* Generated */                                                  int          *outBegIdx,
+/* Generated */                                                  int          *outNBElement,
+/* Generated */                                                  int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_CROSSOVER_Calc( startIdx, endIdx,
+/* Generated */                                   inReal0, inReal1,
+/* Generated */                                   outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_CROSSOVER_Calc( startIdx, endIdx,
+/* Generated */                                   inReal0, inReal1,
+/* Generated */                                   outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_CROSSOVER, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ }}} // Close namespace TicTacTec.TA.Lib
+/* Generated */ #endif
+/**** END GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+
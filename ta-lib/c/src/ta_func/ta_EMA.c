@@ -147,13 +147,13 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_EMA( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inReal[],
-/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_EMA_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inReal[],
+/* Generated */                                       int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -255,6 +255,12 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
    double tempReal, prevMA;
    int i, today, outIdx, lookbackTotal;
 
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
    /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
     * but sometime there is exception. This
     * is why both value are parameters.
@@ -391,13 +397,13 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_EMA( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inReal[],
-/* Generated */                      int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_EMA_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inReal[],
+/* Generated */                                         int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -465,6 +471,10 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
 /* Generated */ {
 /* Generated */    double tempReal, prevMA;
 /* Generated */    int i, today, outIdx, lookbackTotal;
+/* Generated */    #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+/* Generated */                              outBegIdx, outNBElement, outReal ))
+/* Generated */    #endif
 /* Generated */    lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
 /* Generated */    if( startIdx < lookbackTotal )
 /* Generated */       startIdx = lookbackTotal;
@@ -503,6 +513,62 @@ TA_RetCode TA_PREFIX(INT_EMA)( int               startIdx,
 /* Generated */ }
 /* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_EMA;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_EMA( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_EMA_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_EMA_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_EMA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_EMA( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_EMA_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_EMA_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_EMA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
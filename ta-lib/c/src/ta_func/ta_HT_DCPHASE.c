@@ -140,12 +140,12 @@
 /* Generated */                           MInteger     outNBElement,
 /* Generated */                           double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_HT_DCPHASE( int    startIdx,
-/* Generated */                                      int    endIdx,
-/* Generated */                                                 const double inReal[],
-/* Generated */                                                 int          *outBegIdx,
-/* Generated */                                                 int          *outNBElement,
-/* Generated */                                                 double        outReal[] )
+/* Generated */ static TA_RetCode TA_HT_DCPHASE_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const double inReal[],
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -177,7 +177,7 @@
    double I1ForOddPrev2,  I1ForOddPrev3;
    double I1ForEvenPrev2, I1ForEvenPrev3;
 
-   double rad2Deg, constDeg2RadBy360;
+   double rad2Deg;
 
    double todayValue, smoothPeriod;
 
@@ -187,7 +187,6 @@
     */
    #define SMOOTH_PRICE_SIZE 50
    CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
-   int idx;
 
    /* Variable used to calculate the dominant cycle phase */
    int DCPeriodInt;
@@ -222,7 +221,6 @@
    /* Constant */
    tempReal = std_atan(1);
    rad2Deg = 45.0/tempReal;
-   constDeg2RadBy360 = tempReal*8.0;
 
    /* Identify the minimum number of price bar needed
     * to calculate at least one output.
@@ -402,24 +400,7 @@
       /* Compute Dominant Cycle Phase */
       DCPeriod    = smoothPeriod+0.5;
       DCPeriodInt = (int)DCPeriod;
-      realPart = 0.0;
-      imagPart = 0.0;
-
-      /* idx is used to iterate for up to 50 of the last
-       * value of smoothPrice.
-       */
-      idx = smoothPrice_Idx;
-      for( i=0; i < DCPeriodInt; i++ )
-      {
-         tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-         tempReal2 = smoothPrice[idx];
-         realPart += std_sin(tempReal)*tempReal2;
-         imagPart += std_cos(tempReal)*tempReal2;
-         if( idx == 0 )
-            idx = SMOOTH_PRICE_SIZE-1;
-         else
-            idx--;
-      }
+      DO_HT_DFT( smoothPrice, DCPeriodInt, realPart, imagPart );
 
       tempReal = std_fabs(imagPart);
       if( tempReal > 0.0 )
@@ -487,12 +468,12 @@
 /* Generated */                           MInteger     outNBElement,
 /* Generated */                           double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_HT_DCPHASE( int    startIdx,
-/* Generated */                             int    endIdx,
-/* Generated */                             const float  inReal[],
-/* Generated */                             int          *outBegIdx,
-/* Generated */                             int          *outNBElement,
-/* Generated */                             double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_HT_DCPHASE_Calc( int    startIdx,
+/* Generated */                                         int    endIdx,
+/* Generated */                                                const float  inReal[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx, i;
@@ -513,11 +494,10 @@
 /* Generated */    double Q2, I2, prevQ2, prevI2, Re, Im;
 /* Generated */    double I1ForOddPrev2,  I1ForOddPrev3;
 /* Generated */    double I1ForEvenPrev2, I1ForEvenPrev3;
-/* Generated */    double rad2Deg, constDeg2RadBy360;
+/* Generated */    double rad2Deg;
 /* Generated */    double todayValue, smoothPeriod;
 /* Generated */    #define SMOOTH_PRICE_SIZE 50
 /* Generated */    CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
-/* Generated */    int idx;
 /* Generated */    int DCPeriodInt;
 /* Generated */    double DCPhase, DCPeriod, imagPart, realPart;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -536,7 +516,6 @@
 /* Generated */    CIRCBUF_INIT_LOCAL_ONLY(smoothPrice,double);
 /* Generated */    tempReal = std_atan(1);
 /* Generated */    rad2Deg = 45.0/tempReal;
-/* Generated */    constDeg2RadBy360 = tempReal*8.0;
 /* Generated */    lookbackTotal = 63 + TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_HT_DCPHASE,HtDcPhase);
 /* Generated */    if( startIdx < lookbackTotal )
 /* Generated */       startIdx = lookbackTotal;
@@ -639,20 +618,7 @@
 /* Generated */       smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
 /* Generated */       DCPeriod    = smoothPeriod+0.5;
 /* Generated */       DCPeriodInt = (int)DCPeriod;
-/* Generated */       realPart = 0.0;
-/* Generated */       imagPart = 0.0;
-/* Generated */       idx = smoothPrice_Idx;
-/* Generated */       for( i=0; i < DCPeriodInt; i++ )
-/* Generated */       {
-/* Generated */          tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-/* Generated */          tempReal2 = smoothPrice[idx];
-/* Generated */          realPart += std_sin(tempReal)*tempReal2;
-/* Generated */          imagPart += std_cos(tempReal)*tempReal2;
-/* Generated */          if( idx == 0 )
-/* Generated */             idx = SMOOTH_PRICE_SIZE-1;
-/* Generated */          else
-/* Generated */             idx--;
-/* Generated */       }
+/* Generated */       DO_HT_DFT( smoothPrice, DCPeriodInt, realPart, imagPart );
 /* Generated */       tempReal = std_fabs(imagPart);
 /* Generated */       if( tempReal > 0.0 )
 /* Generated */          DCPhase = std_atan(realPart/imagPart)*rad2Deg;
@@ -680,6 +646,56 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_HT_DCPHASE;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_HT_DCPHASE( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const double inReal[],
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_HT_DCPHASE_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_HT_DCPHASE_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_DCPHASE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_HT_DCPHASE( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                                   const float  inReal[],
+/* Generated */                                                   int          *outBegIdx,
+/* Generated */                                                   int          *outNBElement,
+/* Generated */                                                   double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_HT_DCPHASE_Calc( startIdx, endIdx,
+/* Generated */                                    inReal,
+/* Generated */                                    outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_HT_DCPHASE_Calc( startIdx, endIdx,
+/* Generated */                                    inReal,
+/* Generated */                                    outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_DCPHASE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -136,13 +136,13 @@
 /* Generated */                          double        outInPhase[],
 /* Generated */                          double        outQuadrature[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_HT_PHASOR( int    startIdx,
-/* Generated */                                     int    endIdx,
-/* Generated */                                                const double inReal[],
-/* Generated */                                                int          *outBegIdx,
-/* Generated */                                                int          *outNBElement,
-/* Generated */                                                double        outInPhase[],
-/* Generated */                                                double        outQuadrature[] )
+/* Generated */ static TA_RetCode TA_HT_PHASOR_Calc( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                             const double inReal[],
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outInPhase[],
+/* Generated */                                             double        outQuadrature[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -428,13 +428,13 @@
 /* Generated */                          double        outInPhase[],
 /* Generated */                          double        outQuadrature[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_HT_PHASOR( int    startIdx,
-/* Generated */                            int    endIdx,
-/* Generated */                            const float  inReal[],
-/* Generated */                            int          *outBegIdx,
-/* Generated */                            int          *outNBElement,
-/* Generated */                            double        outInPhase[],
-/* Generated */                            double        outQuadrature[] )
+/* Generated */ static TA_RetCode TA_S_HT_PHASOR_Calc( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                               const float  inReal[],
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outInPhase[],
+/* Generated */                                               double        outQuadrature[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx, i;
@@ -583,6 +583,58 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_HT_PHASOR;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_HT_PHASOR( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                                const double inReal[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outInPhase[],
+/* Generated */                                                double        outQuadrature[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_HT_PHASOR_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 outBegIdx, outNBElement, outInPhase, outQuadrature );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_HT_PHASOR_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 outBegIdx, outNBElement, outInPhase, outQuadrature );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_PHASOR, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_HT_PHASOR( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                                  const float  inReal[],
+/* Generated */                                                  int          *outBegIdx,
+/* Generated */                                                  int          *outNBElement,
+/* Generated */                                                  double        outInPhase[],
+/* Generated */                                                  double        outQuadrature[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_HT_PHASOR_Calc( startIdx, endIdx,
+/* Generated */                                   inReal,
+/* Generated */                                   outBegIdx, outNBElement, outInPhase, outQuadrature );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_HT_PHASOR_Calc( startIdx, endIdx,
+/* Generated */                                   inReal,
+/* Generated */                                   outBegIdx, outNBElement, outInPhase, outQuadrature );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_PHASOR, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
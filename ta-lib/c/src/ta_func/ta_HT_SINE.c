@@ -143,13 +143,13 @@
 /* Generated */                        double        outSine[],
 /* Generated */                        double        outLeadSine[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_HT_SINE( int    startIdx,
-/* Generated */                                   int    endIdx,
-/* Generated */                                              const double inReal[],
-/* Generated */                                              int          *outBegIdx,
-/* Generated */                                              int          *outNBElement,
-/* Generated */                                              double        outSine[],
-/* Generated */                                              double        outLeadSine[] )
+/* Generated */ static TA_RetCode TA_HT_SINE_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outSine[],
+/* Generated */                                           double        outLeadSine[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -181,7 +181,7 @@
    double I1ForOddPrev2,  I1ForOddPrev3;
    double I1ForEvenPrev2, I1ForEvenPrev3;
 
-   double rad2Deg, deg2Rad, constDeg2RadBy360;
+   double rad2Deg, deg2Rad;
 
    double todayValue, smoothPeriod;
 
@@ -191,7 +191,6 @@
     */
    #define SMOOTH_PRICE_SIZE 50
    CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
-   int idx;
 
    /* Variable used to calculate the dominant cycle phase */
    int DCPeriodInt;
@@ -230,7 +229,6 @@
    tempReal = std_atan(1);
    rad2Deg = 45.0/tempReal;
    deg2Rad = 1.0/rad2Deg;
-   constDeg2RadBy360 = tempReal*8.0;
 
    /* Identify the minimum number of price bar needed
     * to calculate at least one output.
@@ -410,24 +408,7 @@
       /* Compute Dominant Cycle Phase */
       DCPeriod    = smoothPeriod+0.5;
       DCPeriodInt = (int)DCPeriod;
-      realPart = 0.0;
-      imagPart = 0.0;
-
-      /* idx is used to iterate for up to 50 of the last
-       * value of smoothPrice.
-       */
-      idx = smoothPrice_Idx;
-      for( i=0; i < DCPeriodInt; i++ )
-      {
-         tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-         tempReal2 = smoothPrice[idx];
-         realPart += std_sin(tempReal)*tempReal2;
-         imagPart += std_cos(tempReal)*tempReal2;
-         if( idx == 0 )
-            idx = SMOOTH_PRICE_SIZE-1;
-         else
-            idx--;
-      }
+      DO_HT_DFT( smoothPrice, DCPeriodInt, realPart, imagPart );
 
       tempReal = std_fabs(imagPart);
       if( tempReal > 0.0 )
@@ -499,13 +480,13 @@
 /* Generated */                        double        outSine[],
 /* Generated */                        double        outLeadSine[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_HT_SINE( int    startIdx,
-/* Generated */                          int    endIdx,
-/* Generated */                          const float  inReal[],
-/* Generated */                          int          *outBegIdx,
-/* Generated */                          int          *outNBElement,
-/* Generated */                          double        outSine[],
-/* Generated */                          double        outLeadSine[] )
+/* Generated */ static TA_RetCode TA_S_HT_SINE_Calc( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outSine[],
+/* Generated */                                             double        outLeadSine[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx, i;
@@ -526,11 +507,10 @@
 /* Generated */    double Q2, I2, prevQ2, prevI2, Re, Im;
 /* Generated */    double I1ForOddPrev2,  I1ForOddPrev3;
 /* Generated */    double I1ForEvenPrev2, I1ForEvenPrev3;
-/* Generated */    double rad2Deg, deg2Rad, constDeg2RadBy360;
+/* Generated */    double rad2Deg, deg2Rad;
 /* Generated */    double todayValue, smoothPeriod;
 /* Generated */    #define SMOOTH_PRICE_SIZE 50
 /* Generated */    CIRCBUF_PROLOG(smoothPrice,double,SMOOTH_PRICE_SIZE);
-/* Generated */    int idx;
 /* Generated */    int DCPeriodInt;
 /* Generated */    double DCPhase, DCPeriod, imagPart, realPart;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -552,7 +532,6 @@
 /* Generated */    tempReal = std_atan(1);
 /* Generated */    rad2Deg = 45.0/tempReal;
 /* Generated */    deg2Rad = 1.0/rad2Deg;
-/* Generated */    constDeg2RadBy360 = tempReal*8.0;
 /* Generated */    lookbackTotal = 63 + TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_HT_SINE,HtSine);
 /* Generated */    if( startIdx < lookbackTotal )
 /* Generated */       startIdx = lookbackTotal;
@@ -655,20 +634,7 @@
 /* Generated */       smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
 /* Generated */       DCPeriod    = smoothPeriod+0.5;
 /* Generated */       DCPeriodInt = (int)DCPeriod;
-/* Generated */       realPart = 0.0;
-/* Generated */       imagPart = 0.0;
-/* Generated */       idx = smoothPrice_Idx;
-/* Generated */       for( i=0; i < DCPeriodInt; i++ )
-/* Generated */       {
-/* Generated */          tempReal  = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-/* Generated */          tempReal2 = smoothPrice[idx];
-/* Generated */          realPart += std_sin(tempReal)*tempReal2;
-/* Generated */          imagPart += std_cos(tempReal)*tempReal2;
-/* Generated */          if( idx == 0 )
-/* Generated */             idx = SMOOTH_PRICE_SIZE-1;
-/* Generated */          else
-/* Generated */             idx--;
-/* Generated */       }
+/* Generated */       DO_HT_DFT( smoothPrice, DCPeriodInt, realPart, imagPart );
 /* Generated */       tempReal = std_fabs(imagPart);
 /* Generated */       if( tempReal > 0.0 )
 /* Generated */          DCPhase = std_atan(realPart/imagPart)*rad2Deg;
@@ -697,6 +663,58 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_HT_SINE;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_HT_SINE( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const double inReal[],
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outSine[],
+/* Generated */                                              double        outLeadSine[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_HT_SINE_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               outBegIdx, outNBElement, outSine, outLeadSine );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_HT_SINE_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               outBegIdx, outNBElement, outSine, outLeadSine );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_SINE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_HT_SINE( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                                const float  inReal[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outSine[],
+/* Generated */                                                double        outLeadSine[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_HT_SINE_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 outBegIdx, outNBElement, outSine, outLeadSine );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_HT_SINE_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 outBegIdx, outNBElement, outSine, outLeadSine );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_SINE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
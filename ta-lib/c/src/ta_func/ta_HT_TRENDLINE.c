@@ -140,12 +140,12 @@
 /* Generated */                             MInteger     outNBElement,
 /* Generated */                             double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_HT_TRENDLINE( int    startIdx,
-/* Generated */                                        int    endIdx,
-/* Generated */                                                   const double inReal[],
-/* Generated */                                                   int          *outBegIdx,
-/* Generated */                                                   int          *outNBElement,
-/* Generated */                                                   double        outReal[] )
+/* Generated */ static TA_RetCode TA_HT_TRENDLINE_Calc( int    startIdx,
+/* Generated */                                         int    endIdx,
+/* Generated */                                                const double inReal[],
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -469,12 +469,12 @@
 /* Generated */                             MInteger     outNBElement,
 /* Generated */                             double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_HT_TRENDLINE( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                               const float  inReal[],
-/* Generated */                               int          *outBegIdx,
-/* Generated */                               int          *outNBElement,
-/* Generated */                               double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_HT_TRENDLINE_Calc( int    startIdx,
+/* Generated */                                           int    endIdx,
+/* Generated */                                                  const float  inReal[],
+/* Generated */                                                  int          *outBegIdx,
+/* Generated */                                                  int          *outNBElement,
+/* Generated */                                                  double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx, i;
@@ -642,6 +642,56 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_HT_TRENDLINE;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_HT_TRENDLINE( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                                   const double inReal[],
+/* Generated */                                                   int          *outBegIdx,
+/* Generated */                                                   int          *outNBElement,
+/* Generated */                                                   double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_HT_TRENDLINE_Calc( startIdx, endIdx,
+/* Generated */                                    inReal,
+/* Generated */                                    outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_HT_TRENDLINE_Calc( startIdx, endIdx,
+/* Generated */                                    inReal,
+/* Generated */                                    outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_TRENDLINE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_HT_TRENDLINE( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                                     const float  inReal[],
+/* Generated */                                                     int          *outBegIdx,
+/* Generated */                                                     int          *outNBElement,
+/* Generated */                                                     double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_HT_TRENDLINE_Calc( startIdx, endIdx,
+/* Generated */                                      inReal,
+/* Generated */                                      outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_HT_TRENDLINE_Calc( startIdx, endIdx,
+/* Generated */                                      inReal,
+/* Generated */                                      outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_HT_TRENDLINE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
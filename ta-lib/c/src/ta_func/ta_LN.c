@@ -129,12 +129,12 @@
 /* Generated */                    MInteger     outNBElement,
 /* Generated */                    double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_LN( int    startIdx,
-/* Generated */                              int    endIdx,
-/* Generated */                                         const double inReal[],
-/* Generated */                                         int          *outBegIdx,
-/* Generated */                                         int          *outNBElement,
-/* Generated */                                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_LN_Calc( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                      const double inReal[],
+/* Generated */                                      int          *outBegIdx,
+/* Generated */                                      int          *outNBElement,
+/* Generated */                                      double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -216,12 +216,12 @@
 /* Generated */                    MInteger     outNBElement,
 /* Generated */                    double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_LN( int    startIdx,
-/* Generated */                     int    endIdx,
-/* Generated */                     const float  inReal[],
-/* Generated */                     int          *outBegIdx,
-/* Generated */                     int          *outNBElement,
-/* Generated */                     double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_LN_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const float  inReal[],
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx;
@@ -253,6 +253,56 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_LN;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_LN( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                                         const double inReal[],
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_LN_Calc( startIdx, endIdx,
+/* Generated */                          inReal,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_LN_Calc( startIdx, endIdx,
+/* Generated */                          inReal,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_LN, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_LN( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const float  inReal[],
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_LN_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_LN_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_LN, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -210,14 +210,14 @@
 /* Generated */                               MInteger     outNBElement,
 /* Generated */                               double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MA( int    startIdx,
-/* Generated */                              int    endIdx,
-/* Generated */                                         const double inReal[],
-/* Generated */                                         int           optInTimePeriod, /* From 1 to 100000 */
-/* Generated */                                         TA_MAType     optInMAType,
-/* Generated */                                         int          *outBegIdx,
-/* Generated */                                         int          *outNBElement,
-/* Generated */                                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_MA_Calc( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                      const double inReal[],
+/* Generated */                                      int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                      TA_MAType     optInMAType,
+/* Generated */                                      int          *outBegIdx,
+/* Generated */                                      int          *outNBElement,
+/* Generated */                                      double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -380,14 +380,14 @@
 /* Generated */                               MInteger     outNBElement,
 /* Generated */                               double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MA( int    startIdx,
-/* Generated */                     int    endIdx,
-/* Generated */                     const float  inReal[],
-/* Generated */                     int           optInTimePeriod, /* From 1 to 100000 */
-/* Generated */                     TA_MAType     optInMAType,
-/* Generated */                     int          *outBegIdx,
-/* Generated */                     int          *outNBElement,
-/* Generated */                     double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_MA_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const float  inReal[],
+/* Generated */                                        int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                        TA_MAType     optInMAType,
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ARRAY_REF(dummyBuffer);
@@ -479,6 +479,64 @@
 /* Generated */    return retCode;
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MA;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MA( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                                         const double inReal[],
+/* Generated */                                         int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                         TA_MAType     optInMAType,
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MA_Calc( startIdx, endIdx,
+/* Generated */                          inReal,
+/* Generated */                          optInTimePeriod, optInMAType,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MA_Calc( startIdx, endIdx,
+/* Generated */                          inReal,
+/* Generated */                          optInTimePeriod, optInMAType,
+/* Generated */                          outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MA( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const float  inReal[],
+/* Generated */                                           int           optInTimePeriod, /* From 1 to 100000 */
+/* Generated */                                           TA_MAType     optInMAType,
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MA_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInTimePeriod, optInMAType,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MA_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInTimePeriod, optInMAType,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -205,17 +205,17 @@
 /* Generated */                      double        outMACDSignal[],
 /* Generated */                      double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MACD( int    startIdx,
-/* Generated */                                int    endIdx,
-/* Generated */                                           const double inReal[],
-/* Generated */                                           int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                                           int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                                           int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                                           int          *outBegIdx,
-/* Generated */                                           int          *outNBElement,
-/* Generated */                                           double        outMACD[],
-/* Generated */                                           double        outMACDSignal[],
-/* Generated */                                           double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_MACD_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const double inReal[],
+/* Generated */                                        int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                        int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                        int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outMACD[],
+/* Generated */                                        double        outMACDSignal[],
+/* Generated */                                        double        outMACDHist[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -574,17 +574,17 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
 /* Generated */                      double        outMACDSignal[],
 /* Generated */                      double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MACD( int    startIdx,
-/* Generated */                       int    endIdx,
-/* Generated */                       const float  inReal[],
-/* Generated */                       int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                       int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                       int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                       int          *outBegIdx,
-/* Generated */                       int          *outNBElement,
-/* Generated */                       double        outMACD[],
-/* Generated */                       double        outMACDSignal[],
-/* Generated */                       double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_S_MACD_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const float  inReal[],
+/* Generated */                                          int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                          int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                          int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outMACD[],
+/* Generated */                                          double        outMACDSignal[],
+/* Generated */                                          double        outMACDHist[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -797,6 +797,70 @@ TA_RetCode TA_PREFIX(INT_MACD)( int    startIdx,
 /* Generated */ }
 /* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MACD;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MACD( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                           int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                           int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outMACD[],
+/* Generated */                                           double        outMACDSignal[],
+/* Generated */                                           double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MACD_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+/* Generated */                            outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MACD_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+/* Generated */                            outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MACD( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                             int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                             int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outMACD[],
+/* Generated */                                             double        outMACDSignal[],
+/* Generated */                                             double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MACD_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+/* Generated */                              outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MACD_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInFastPeriod, optInSlowPeriod, optInSignalPeriod,
+/* Generated */                              outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
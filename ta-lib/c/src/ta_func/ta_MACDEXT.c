@@ -237,20 +237,20 @@
 /* Generated */                         double        outMACDSignal[],
 /* Generated */                         double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MACDEXT( int    startIdx,
-/* Generated */                                   int    endIdx,
-/* Generated */                                              const double inReal[],
-/* Generated */                                              int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                                              TA_MAType     optInFastMAType,
-/* Generated */                                              int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                                              TA_MAType     optInSlowMAType,
-/* Generated */                                              int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                                              TA_MAType     optInSignalMAType,
-/* Generated */                                              int          *outBegIdx,
-/* Generated */                                              int          *outNBElement,
-/* Generated */                                              double        outMACD[],
-/* Generated */                                              double        outMACDSignal[],
-/* Generated */                                              double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_MACDEXT_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                           TA_MAType     optInFastMAType,
+/* Generated */                                           int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                           TA_MAType     optInSlowMAType,
+/* Generated */                                           int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                           TA_MAType     optInSignalMAType,
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outMACD[],
+/* Generated */                                           double        outMACDSignal[],
+/* Generated */                                           double        outMACDHist[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -538,20 +538,20 @@
 /* Generated */                         double        outMACDSignal[],
 /* Generated */                         double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MACDEXT( int    startIdx,
-/* Generated */                          int    endIdx,
-/* Generated */                          const float  inReal[],
-/* Generated */                          int           optInFastPeriod, /* From 2 to 100000 */
-/* Generated */                          TA_MAType     optInFastMAType,
-/* Generated */                          int           optInSlowPeriod, /* From 2 to 100000 */
-/* Generated */                          TA_MAType     optInSlowMAType,
-/* Generated */                          int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                          TA_MAType     optInSignalMAType,
-/* Generated */                          int          *outBegIdx,
-/* Generated */                          int          *outNBElement,
-/* Generated */                          double        outMACD[],
-/* Generated */                          double        outMACDSignal[],
-/* Generated */                          double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_S_MACDEXT_Calc( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                             TA_MAType     optInFastMAType,
+/* Generated */                                             int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                             TA_MAType     optInSlowMAType,
+/* Generated */                                             int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                             TA_MAType     optInSignalMAType,
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outMACD[],
+/* Generated */                                             double        outMACDSignal[],
+/* Generated */                                             double        outMACDHist[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ARRAY_REF( slowMABuffer );
@@ -712,6 +712,76 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MACDEXT;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MACDEXT( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const double inReal[],
+/* Generated */                                              int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                              TA_MAType     optInFastMAType,
+/* Generated */                                              int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                              TA_MAType     optInSlowMAType,
+/* Generated */                                              int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                              TA_MAType     optInSignalMAType,
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outMACD[],
+/* Generated */                                              double        outMACDSignal[],
+/* Generated */                                              double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MACDEXT_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+/* Generated */                               outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MACDEXT_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+/* Generated */                               outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACDEXT, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MACDEXT( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                                const float  inReal[],
+/* Generated */                                                int           optInFastPeriod, /* From 2 to 100000 */
+/* Generated */                                                TA_MAType     optInFastMAType,
+/* Generated */                                                int           optInSlowPeriod, /* From 2 to 100000 */
+/* Generated */                                                TA_MAType     optInSlowMAType,
+/* Generated */                                                int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                                TA_MAType     optInSignalMAType,
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outMACD[],
+/* Generated */                                                double        outMACDSignal[],
+/* Generated */                                                double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MACDEXT_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+/* Generated */                                 outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MACDEXT_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 optInFastPeriod, optInFastMAType, optInSlowPeriod, optInSlowMAType, optInSignalPeriod, optInSignalMAType,
+/* Generated */                                 outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACDEXT, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -160,15 +160,15 @@
 /* Generated */                         double        outMACDSignal[],
 /* Generated */                         double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MACDFIX( int    startIdx,
-/* Generated */                                   int    endIdx,
-/* Generated */                                              const double inReal[],
-/* Generated */                                              int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                                              int          *outBegIdx,
-/* Generated */                                              int          *outNBElement,
-/* Generated */                                              double        outMACD[],
-/* Generated */                                              double        outMACDSignal[],
-/* Generated */                                              double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_MACDFIX_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outMACD[],
+/* Generated */                                           double        outMACDSignal[],
+/* Generated */                                           double        outMACDHist[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -262,15 +262,15 @@
 /* Generated */                         double        outMACDSignal[],
 /* Generated */                         double        outMACDHist[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MACDFIX( int    startIdx,
-/* Generated */                          int    endIdx,
-/* Generated */                          const float  inReal[],
-/* Generated */                          int           optInSignalPeriod, /* From 1 to 100000 */
-/* Generated */                          int          *outBegIdx,
-/* Generated */                          int          *outNBElement,
-/* Generated */                          double        outMACD[],
-/* Generated */                          double        outMACDSignal[],
-/* Generated */                          double        outMACDHist[] )
+/* Generated */ static TA_RetCode TA_S_MACDFIX_Calc( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outMACD[],
+/* Generated */                                             double        outMACDSignal[],
+/* Generated */                                             double        outMACDHist[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
@@ -305,6 +305,66 @@
 /* Generated */                                    outMACDHist );
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MACDFIX;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MACDFIX( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const double inReal[],
+/* Generated */                                              int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outMACD[],
+/* Generated */                                              double        outMACDSignal[],
+/* Generated */                                              double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MACDFIX_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               optInSignalPeriod,
+/* Generated */                               outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MACDFIX_Calc( startIdx, endIdx,
+/* Generated */                               inReal,
+/* Generated */                               optInSignalPeriod,
+/* Generated */                               outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACDFIX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MACDFIX( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                                const float  inReal[],
+/* Generated */                                                int           optInSignalPeriod, /* From 1 to 100000 */
+/* Generated */                                                int          *outBegIdx,
+/* Generated */                                                int          *outNBElement,
+/* Generated */                                                double        outMACD[],
+/* Generated */                                                double        outMACDSignal[],
+/* Generated */                                                double        outMACDHist[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MACDFIX_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 optInSignalPeriod,
+/* Generated */                                 outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MACDFIX_Calc( startIdx, endIdx,
+/* Generated */                                 inReal,
+/* Generated */                                 optInSignalPeriod,
+/* Generated */                                 outBegIdx, outNBElement, outMACD, outMACDSignal, outMACDHist );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MACDFIX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -0,0 +1,324 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101826 AG     Initial Version
+ */
+
+/**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+/* All code within this section is automatically
+ * generated by gen_code. Any modification will be lost
+ * next time gen_code is run.
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */    #include "TA-Lib-Core.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode::InternalError)
+/* Generated */    namespace TicTacTec { namespace TA { namespace Library {
+/* Generated */ #elif defined( _JAVA )
+/* Generated */    #include "ta_defs.h"
+/* Generated */    #include "ta_java_defs.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode.InternalError)
+/* Generated */ #else
+/* Generated */    #include <string.h>
+/* Generated */    #include <math.h>
+/* Generated */    #include "ta_func.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_UTILITY_H
+/* Generated */    #include "ta_utility.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_MEMORY_H
+/* Generated */    #include "ta_memory.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #define TA_PREFIX(x) TA_##x
+/* Generated */ #define INPUT_TYPE   double
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ int Core::MedianAbsDevLookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public int medianAbsDevLookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #else
+/* Generated */ TA_LIB_API int TA_MAD_Lookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #endif
+/**** END GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return -1;
+/* Generated */ 
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/**** END GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+
+   /* insert lookback code here. */
+   return optInTimePeriod-1;
+}
+
+/**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+/*
+ * TA_MAD - Median Absolute Deviation
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::MedianAbsDev( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              SubArray<double>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              SubArray<double>^  outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::MedianAbsDev( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              cli::array<double>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              cli::array<double>^  outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode medianAbsDev( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                              double       inReal[],
+/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                              MInteger     outBegIdx,
+/* Generated */                              MInteger     outNBElement,
+/* Generated */                              double        outReal[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_MAD_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inReal[],
+/* Generated */                                       int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
+/* Generated */ #endif
+/**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */ 
+/* Generated */    /* Validate the requested output range. */
+/* Generated */    if( startIdx < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */    if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    #endif /* !defined(_JAVA)*/
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !outReal )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #endif /* !defined(_JAVA) */
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/* Generated */ 
+/**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+
+   /* Insert TA function code here. */
+
+   /* Median of the absolute deviations from the median of the
+    * period. The result is not scaled (multiply by 1.4826 for an
+    * estimate of the standard deviation of a normal distribution).
+    */
+   return FUNCTION_CALL(INT_QUANTILE)( startIdx, endIdx, inReal,
+                                       optInTimePeriod, 0.5, 1,
+                                       outBegIdx, outNBElement, outReal );
+}
+
+/**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #define  USE_SINGLE_PRECISION_INPUT
+/* Generated */ #undef  TA_LIB_PRO
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    #undef   TA_PREFIX
+/* Generated */    #define  TA_PREFIX(x) TA_S_##x
+/* Generated */ #endif
+/* Generated */ #undef   INPUT_TYPE
+/* Generated */ #define  INPUT_TYPE float
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::MedianAbsDev( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              SubArray<float>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              SubArray<double>^  outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::MedianAbsDev( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              cli::array<float>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              cli::array<double>^  outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode medianAbsDev( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                              float        inReal[],
+/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                              MInteger     outBegIdx,
+/* Generated */                              MInteger     outNBElement,
+/* Generated */                              double        outReal[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_S_MAD_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inReal[],
+/* Generated */                                         int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */     if( startIdx < 0 )
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */     if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */     if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */        optInTimePeriod = 14;
+/* Generated */     else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !outReal )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */  #endif 
+/* Generated */    return FUNCTION_CALL(INT_QUANTILE)( startIdx, endIdx, inReal,
+/* Generated */                                        optInTimePeriod, 0.5, 1,
+/* Generated */                                        outBegIdx, outNBElement, outReal );
+/* Generated */ }
+/* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MAD;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MAD( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MAD_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MAD_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MAD( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MAD_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MAD_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAD, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ }}} // Close namespace TicTacTec.TA.Lib
+/* Generated */ #endif
+/**** END GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+
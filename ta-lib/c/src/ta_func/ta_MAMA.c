@@ -189,15 +189,15 @@
 /* Generated */                      double        outMAMA[],
 /* Generated */                      double        outFAMA[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MAMA( int    startIdx,
-/* Generated */                                int    endIdx,
-/* Generated */                                           const double inReal[],
-/* Generated */                                           double        optInFastLimit, /* From 0.01 to 0.99 */
-/* Generated */                                           double        optInSlowLimit, /* From 0.01 to 0.99 */
-/* Generated */                                           int          *outBegIdx,
-/* Generated */                                           int          *outNBElement,
-/* Generated */                                           double        outMAMA[],
-/* Generated */                                           double        outFAMA[] )
+/* Generated */ static TA_RetCode TA_MAMA_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const double inReal[],
+/* Generated */                                        double        optInFastLimit, /* From 0.01 to 0.99 */
+/* Generated */                                        double        optInSlowLimit, /* From 0.01 to 0.99 */
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outMAMA[],
+/* Generated */                                        double        outFAMA[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -531,15 +531,15 @@
 /* Generated */                      double        outMAMA[],
 /* Generated */                      double        outFAMA[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MAMA( int    startIdx,
-/* Generated */                       int    endIdx,
-/* Generated */                       const float  inReal[],
-/* Generated */                       double        optInFastLimit, /* From 0.01 to 0.99 */
-/* Generated */                       double        optInSlowLimit, /* From 0.01 to 0.99 */
-/* Generated */                       int          *outBegIdx,
-/* Generated */                       int          *outNBElement,
-/* Generated */                       double        outMAMA[],
-/* Generated */                       double        outFAMA[] )
+/* Generated */ static TA_RetCode TA_S_MAMA_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const float  inReal[],
+/* Generated */                                          double        optInFastLimit, /* From 0.01 to 0.99 */
+/* Generated */                                          double        optInSlowLimit, /* From 0.01 to 0.99 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outMAMA[],
+/* Generated */                                          double        outFAMA[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int outIdx, i;
@@ -718,6 +718,66 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MAMA;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MAMA( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           double        optInFastLimit, /* From 0.01 to 0.99 */
+/* Generated */                                           double        optInSlowLimit, /* From 0.01 to 0.99 */
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outMAMA[],
+/* Generated */                                           double        outFAMA[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MAMA_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInFastLimit, optInSlowLimit,
+/* Generated */                            outBegIdx, outNBElement, outMAMA, outFAMA );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MAMA_Calc( startIdx, endIdx,
+/* Generated */                            inReal,
+/* Generated */                            optInFastLimit, optInSlowLimit,
+/* Generated */                            outBegIdx, outNBElement, outMAMA, outFAMA );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAMA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MAMA( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             double        optInFastLimit, /* From 0.01 to 0.99 */
+/* Generated */                                             double        optInSlowLimit, /* From 0.01 to 0.99 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outMAMA[],
+/* Generated */                                             double        outFAMA[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MAMA_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInFastLimit, optInSlowLimit,
+/* Generated */                              outBegIdx, outNBElement, outMAMA, outFAMA );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MAMA_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInFastLimit, optInSlowLimit,
+/* Generated */                              outBegIdx, outNBElement, outMAMA, outFAMA );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAMA, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -36,12 +36,14 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       agent <agent@local>
  *
  * Change history:
  *
  *  MMDDYY BY     Description
  *  -------------------------------------------------------------------
  *  021807 MF     Initial Version
+ *  101826 AG     Fix output calculated in-place with many periods.
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -174,16 +176,16 @@
 /* Generated */                                             MInteger     outNBElement,
 /* Generated */                                             double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MAVP( int    startIdx,
-/* Generated */                                int    endIdx,
-/* Generated */                                           const double inReal[],
-/* Generated */                                           const double inPeriods[],
-/* Generated */                                           int           optInMinPeriod, /* From 2 to 100000 */
-/* Generated */                                           int           optInMaxPeriod, /* From 2 to 100000 */
-/* Generated */                                           TA_MAType     optInMAType,
-/* Generated */                                           int          *outBegIdx,
-/* Generated */                                           int          *outNBElement,
-/* Generated */                                           double        outReal[] )
+/* Generated */ static TA_RetCode TA_MAVP_Calc( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                        const double inReal[],
+/* Generated */                                        const double inPeriods[],
+/* Generated */                                        int           optInMinPeriod, /* From 2 to 100000 */
+/* Generated */                                        int           optInMaxPeriod, /* From 2 to 100000 */
+/* Generated */                                        TA_MAType     optInMAType,
+/* Generated */                                        int          *outBegIdx,
+/* Generated */                                        int          *outNBElement,
+/* Generated */                                        double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -191,6 +193,7 @@
    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
    ARRAY_INT_REF(localPeriodArray);
    ARRAY_REF(localOutputArray);
+   ARRAY_REF(outArray);
    VALUE_HANDLE_INT(localBegIdx);
    VALUE_HANDLE_INT(localNbElement);
    ENUM_DECLARATION(RetCode) retCode;
@@ -289,6 +292,31 @@
       localPeriodArray[i] = tempInt;
    }
 
+   /* The MA of each period is calculated from inReal. When the
+    * output is the same buffer, the outputs are kept aside until
+    * all the periods are done.
+    */
+   #if defined(USE_SINGLE_PRECISION_INPUT)
+      outArray = outReal;
+   #elif defined( USE_SUBARRAY )
+      /* The sub-arrays cannot be compared, assume the worst. */
+      ARRAY_ALLOC(outArray,outputSize);
+   #else
+      if( outReal == inReal )
+         ARRAY_ALLOC(outArray,outputSize);
+      else
+         outArray = outReal;
+   #endif
+
+   #if !defined(_JAVA)
+      if( !outArray )
+      {
+         ARRAY_FREE(localOutputArray);
+         ARRAY_INT_FREE(localPeriodArray);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+   #endif
+
    /* Process each element of the input. 
     * For each possible period value, the MA is calculated 
 	* only once.
@@ -314,6 +342,7 @@
 
            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
 		   {
+              ARRAY_FREE_COND( outArray != outReal, outArray );
               ARRAY_FREE(localOutputArray);
 			  ARRAY_INT_FREE(localPeriodArray);
               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
@@ -321,18 +350,24 @@
               return retCode;
 	       }
 		   
-		   outReal[i] = localOutputArray[i];
+		   outArray[i] = localOutputArray[i];
 		   for( j=i+1; j < outputSize; j++ )
 		   {
 			   if( localPeriodArray[j] == curPeriod )
 			   {
 				   localPeriodArray[j] = 0; /* Flag to avoid recalculation */
-				   outReal[j] = localOutputArray[j];
+				   outArray[j] = localOutputArray[j];
 			   }
 		   }		   
 	   }
    }
 
+   if( outArray != outReal )
+   {
+      ARRAY_MEMMOVE( outReal, 0, outArray, 0, outputSize );
+      ARRAY_FREE(outArray);
+   }
+
    ARRAY_FREE(localOutputArray);
    ARRAY_INT_FREE(localPeriodArray);
 
@@ -386,21 +421,22 @@
 /* Generated */                                             MInteger     outNBElement,
 /* Generated */                                             double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MAVP( int    startIdx,
-/* Generated */                       int    endIdx,
-/* Generated */                       const float  inReal[],
-/* Generated */                       const float  inPeriods[],
-/* Generated */                       int           optInMinPeriod, /* From 2 to 100000 */
-/* Generated */                       int           optInMaxPeriod, /* From 2 to 100000 */
-/* Generated */                       TA_MAType     optInMAType,
-/* Generated */                       int          *outBegIdx,
-/* Generated */                       int          *outNBElement,
-/* Generated */                       double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_MAVP_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const float  inReal[],
+/* Generated */                                          const float  inPeriods[],
+/* Generated */                                          int           optInMinPeriod, /* From 2 to 100000 */
+/* Generated */                                          int           optInMaxPeriod, /* From 2 to 100000 */
+/* Generated */                                          TA_MAType     optInMAType,
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
 /* Generated */    ARRAY_INT_REF(localPeriodArray);
 /* Generated */    ARRAY_REF(localOutputArray);
+/* Generated */    ARRAY_REF(outArray);
 /* Generated */    VALUE_HANDLE_INT(localBegIdx);
 /* Generated */    VALUE_HANDLE_INT(localNbElement);
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -463,6 +499,24 @@
 /* Generated */           tempInt = optInMaxPeriod;
 /* Generated */       localPeriodArray[i] = tempInt;
 /* Generated */    }
+/* Generated */    #if defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */       outArray = outReal;
+/* Generated */    #elif defined( USE_SUBARRAY )
+/* Generated */       ARRAY_ALLOC(outArray,outputSize);
+/* Generated */    #else
+/* Generated */       if( outReal == inReal )
+/* Generated */          ARRAY_ALLOC(outArray,outputSize);
+/* Generated */       else
+/* Generated */          outArray = outReal;
+/* Generated */    #endif
+/* Generated */    #if !defined(_JAVA)
+/* Generated */       if( !outArray )
+/* Generated */       {
+/* Generated */          ARRAY_FREE(localOutputArray);
+/* Generated */          ARRAY_INT_FREE(localPeriodArray);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */    #endif
 /* Generated */    for( i=0; i < outputSize; i++ )
 /* Generated */    {
 /* Generated */ 	   curPeriod = localPeriodArray[i];
@@ -473,23 +527,29 @@
 /* Generated */ 									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
 /* Generated */            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
 /* Generated */ 		   {
+/* Generated */               ARRAY_FREE_COND( outArray != outReal, outArray );
 /* Generated */               ARRAY_FREE(localOutputArray);
 /* Generated */ 			  ARRAY_INT_FREE(localPeriodArray);
 /* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
 /* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */               return retCode;
 /* Generated */ 	       }
-/* Generated */ 		   outReal[i] = localOutputArray[i];
+/* Generated */ 		   outArray[i] = localOutputArray[i];
 /* Generated */ 		   for( j=i+1; j < outputSize; j++ )
 /* Generated */ 		   {
 /* Generated */ 			   if( localPeriodArray[j] == curPeriod )
 /* Generated */ 			   {
 /* Generated */ 				   localPeriodArray[j] = 0; 
-/* Generated */ 				   outReal[j] = localOutputArray[j];
+/* Generated */ 				   outArray[j] = localOutputArray[j];
 /* Generated */ 			   }
 /* Generated */ 		   }		   
 /* Generated */ 	   }
 /* Generated */    }
+/* Generated */    if( outArray != outReal )
+/* Generated */    {
+/* Generated */       ARRAY_MEMMOVE( outReal, 0, outArray, 0, outputSize );
+/* Generated */       ARRAY_FREE(outArray);
+/* Generated */    }
 /* Generated */    ARRAY_FREE(localOutputArray);
 /* Generated */    ARRAY_INT_FREE(localPeriodArray);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
@@ -497,6 +557,68 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MAVP;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MAVP( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                           const double inReal[],
+/* Generated */                                           const double inPeriods[],
+/* Generated */                                           int           optInMinPeriod, /* From 2 to 100000 */
+/* Generated */                                           int           optInMaxPeriod, /* From 2 to 100000 */
+/* Generated */                                           TA_MAType     optInMAType,
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MAVP_Calc( startIdx, endIdx,
+/* Generated */                            inReal, inPeriods,
+/* Generated */                            optInMinPeriod, optInMaxPeriod, optInMAType,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MAVP_Calc( startIdx, endIdx,
+/* Generated */                            inReal, inPeriods,
+/* Generated */                            optInMinPeriod, optInMaxPeriod, optInMAType,
+/* Generated */                            outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAVP, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MAVP( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const float  inReal[],
+/* Generated */                                             const float  inPeriods[],
+/* Generated */                                             int           optInMinPeriod, /* From 2 to 100000 */
+/* Generated */                                             int           optInMaxPeriod, /* From 2 to 100000 */
+/* Generated */                                             TA_MAType     optInMAType,
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MAVP_Calc( startIdx, endIdx,
+/* Generated */                              inReal, inPeriods,
+/* Generated */                              optInMinPeriod, optInMaxPeriod, optInMAType,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MAVP_Calc( startIdx, endIdx,
+/* Generated */                              inReal, inPeriods,
+/* Generated */                              optInMinPeriod, optInMaxPeriod, optInMAType,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAVP, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -146,13 +146,13 @@
 /* Generated */                          MInteger     outNBElement,
 /* Generated */                          int           outInteger[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MAXINDEX( int    startIdx,
-/* Generated */                                    int    endIdx,
-/* Generated */                                               const double inReal[],
-/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                               int          *outBegIdx,
-/* Generated */                                               int          *outNBElement,
-/* Generated */                                               int           outInteger[] )
+/* Generated */ static TA_RetCode TA_MAXINDEX_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const double inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            int           outInteger[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -295,13 +295,13 @@
 /* Generated */                          MInteger     outNBElement,
 /* Generated */                          int           outInteger[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MAXINDEX( int    startIdx,
-/* Generated */                           int    endIdx,
-/* Generated */                           const float  inReal[],
-/* Generated */                           int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                           int          *outBegIdx,
-/* Generated */                           int          *outNBElement,
-/* Generated */                           int           outInteger[] )
+/* Generated */ static TA_RetCode TA_S_MAXINDEX_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const float  inReal[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              int           outInteger[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double highest, tmp;
@@ -370,6 +370,62 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MAXINDEX;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MAXINDEX( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const double inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAXINDEX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MAXINDEX( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const float  inReal[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod,
+/* Generated */                                  outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MAXINDEX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -149,14 +149,14 @@
 /* Generated */                        double        outMin[],
 /* Generated */                        double        outMax[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MINMAX( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inReal[],
-/* Generated */                                             int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outMin[],
-/* Generated */                                             double        outMax[] )
+/* Generated */ static TA_RetCode TA_MINMAX_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outMin[],
+/* Generated */                                          double        outMax[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -330,14 +330,14 @@
 /* Generated */                        double        outMin[],
 /* Generated */                        double        outMax[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MINMAX( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inReal[],
-/* Generated */                         int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outMin[],
-/* Generated */                         double        outMax[] )
+/* Generated */ static TA_RetCode TA_S_MINMAX_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outMin[],
+/* Generated */                                            double        outMax[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double highest, lowest, tmpHigh, tmpLow;
@@ -432,6 +432,64 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MINMAX;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MINMAX( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inReal[],
+/* Generated */                                             int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outMin[],
+/* Generated */                                             double        outMax[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MINMAX_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInTimePeriod,
+/* Generated */                              outBegIdx, outNBElement, outMin, outMax );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MINMAX_Calc( startIdx, endIdx,
+/* Generated */                              inReal,
+/* Generated */                              optInTimePeriod,
+/* Generated */                              outBegIdx, outNBElement, outMin, outMax );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MINMAX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MINMAX( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outMin[],
+/* Generated */                                               double        outMax[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MINMAX_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outMin, outMax );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MINMAX_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod,
+/* Generated */                                outBegIdx, outNBElement, outMin, outMax );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MINMAX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -149,14 +149,14 @@
 /* Generated */                             int           outMinIdx[],
 /* Generated */                             int           outMaxIdx[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_MINMAXINDEX( int    startIdx,
-/* Generated */                                       int    endIdx,
-/* Generated */                                                  const double inReal[],
-/* Generated */                                                  int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                                  int          *outBegIdx,
-/* Generated */                                                  int          *outNBElement,
-/* Generated */                                                  int           outMinIdx[],
-/* Generated */                                                  int           outMaxIdx[] )
+/* Generated */ static TA_RetCode TA_MINMAXINDEX_Calc( int    startIdx,
+/* Generated */                                        int    endIdx,
+/* Generated */                                               const double inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               int           outMinIdx[],
+/* Generated */                                               int           outMaxIdx[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -330,14 +330,14 @@
 /* Generated */                             int           outMinIdx[],
 /* Generated */                             int           outMaxIdx[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_MINMAXINDEX( int    startIdx,
-/* Generated */                              int    endIdx,
-/* Generated */                              const float  inReal[],
-/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                              int          *outBegIdx,
-/* Generated */                              int          *outNBElement,
-/* Generated */                              int           outMinIdx[],
-/* Generated */                              int           outMaxIdx[] )
+/* Generated */ static TA_RetCode TA_S_MINMAXINDEX_Calc( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                                 const float  inReal[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 int           outMinIdx[],
+/* Generated */                                                 int           outMaxIdx[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double highest, lowest, tmpHigh, tmpLow;
@@ -432,6 +432,64 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_MINMAXINDEX;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_MINMAXINDEX( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                                  const double inReal[],
+/* Generated */                                                  int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                  int          *outBegIdx,
+/* Generated */                                                  int          *outNBElement,
+/* Generated */                                                  int           outMinIdx[],
+/* Generated */                                                  int           outMaxIdx[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_MINMAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                   inReal,
+/* Generated */                                   optInTimePeriod,
+/* Generated */                                   outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_MINMAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                   inReal,
+/* Generated */                                   optInTimePeriod,
+/* Generated */                                   outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MINMAXINDEX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_MINMAXINDEX( int    startIdx,
+/* Generated */                                         int    endIdx,
+/* Generated */                                                    const float  inReal[],
+/* Generated */                                                    int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                    int          *outBegIdx,
+/* Generated */                                                    int          *outNBElement,
+/* Generated */                                                    int           outMinIdx[],
+/* Generated */                                                    int           outMaxIdx[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_MINMAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                     inReal,
+/* Generated */                                     optInTimePeriod,
+/* Generated */                                     outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_MINMAXINDEX_Calc( startIdx, endIdx,
+/* Generated */                                     inReal,
+/* Generated */                                     optInTimePeriod,
+/* Generated */                                     outBegIdx, outNBElement, outMinIdx, outMaxIdx );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_MINMAXINDEX, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
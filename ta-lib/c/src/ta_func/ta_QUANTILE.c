@@ -0,0 +1,922 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101826 AG     Initial Version
+ */
+
+/* The values of the period are kept in a circular buffer ('key') and
+ * ordered in a treap: a binary search tree on the values, balanced by
+ * a random priority given to each node. The nodes are the slots of the
+ * circular buffer and know the size of their subtree, so the value at
+ * any rank is found in O(log period). The oldest value is replaced by
+ * removing its slot from the tree and inserting it again with the new
+ * value, also in O(log period).
+ *
+ * All the links are in the 'tree' array, TREE_NULL is the null node.
+ */
+#define TREE_NULL      (-1)
+#define TREE_LEFT(x)   tree[(x)]
+#define TREE_RIGHT(x)  tree[optInTimePeriod+(x)]
+#define TREE_PARENT(x) tree[(2*optInTimePeriod)+(x)]
+#define TREE_SIZE(x)   tree[(3*optInTimePeriod)+(x)]
+#define TREE_PRIO(x)   tree[(4*optInTimePeriod)+(x)]
+#define TREE_SUBSIZE(x) (((x)==TREE_NULL)?0:TREE_SIZE(x))
+
+/* Move the node 'x' above its parent. The order of the values
+ * is unchanged, the sizes of the two nodes are updated.
+ */
+#define TREE_ROTATE_UP(x) { \
+   treeParent = TREE_PARENT(x); \
+   treeGrandParent = TREE_PARENT(treeParent); \
+   if( TREE_LEFT(treeParent) == (x) ) { \
+      treeChild = TREE_RIGHT(x); \
+      TREE_LEFT(treeParent) = treeChild; \
+      TREE_RIGHT(x) = treeParent; \
+   } else { \
+      treeChild = TREE_LEFT(x); \
+      TREE_RIGHT(treeParent) = treeChild; \
+      TREE_LEFT(x) = treeParent; \
+   } \
+   if( treeChild != TREE_NULL ) \
+      TREE_PARENT(treeChild) = treeParent; \
+   TREE_PARENT(treeParent) = (x); \
+   TREE_PARENT(x) = treeGrandParent; \
+   if( treeGrandParent == TREE_NULL ) \
+      treeRoot = (x); \
+   else if( TREE_LEFT(treeGrandParent) == treeParent ) \
+      TREE_LEFT(treeGrandParent) = (x); \
+   else \
+      TREE_RIGHT(treeGrandParent) = (x); \
+   TREE_SIZE(x) = TREE_SIZE(treeParent); \
+   TREE_SIZE(treeParent) = 1+TREE_SUBSIZE(TREE_LEFT(treeParent))+TREE_SUBSIZE(TREE_RIGHT(treeParent)); \
+}
+
+/* Set 'v' to the value at rank 'r' (0 is the smallest). */
+#define TREE_SELECT(r,v) { \
+   treeRank = (r); \
+   treeNode = treeRoot; \
+   while( treeRank != TREE_SUBSIZE(TREE_LEFT(treeNode)) ) { \
+      if( treeRank < TREE_SUBSIZE(TREE_LEFT(treeNode)) ) \
+         treeNode = TREE_LEFT(treeNode); \
+      else { \
+         treeRank -= TREE_SUBSIZE(TREE_LEFT(treeNode))+1; \
+         treeNode = TREE_RIGHT(treeNode); \
+      } \
+   } \
+   v = key[treeNode]; \
+}
+
+/**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+/* All code within this section is automatically
+ * generated by gen_code. Any modification will be lost
+ * next time gen_code is run.
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */    #include "TA-Lib-Core.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode::InternalError)
+/* Generated */    namespace TicTacTec { namespace TA { namespace Library {
+/* Generated */ #elif defined( _JAVA )
+/* Generated */    #include "ta_defs.h"
+/* Generated */    #include "ta_java_defs.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode.InternalError)
+/* Generated */ #else
+/* Generated */    #include <string.h>
+/* Generated */    #include <math.h>
+/* Generated */    #include "ta_func.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_UTILITY_H
+/* Generated */    #include "ta_utility.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_MEMORY_H
+/* Generated */    #include "ta_memory.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #define TA_PREFIX(x) TA_##x
+/* Generated */ #define INPUT_TYPE   double
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ int Core::QuantileLookback( int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                           double        optInQuantile )  /* From 0 to 1 */
+/* Generated */ 
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public int quantileLookback( int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                            double        optInQuantile )  /* From 0 to 1 */
+/* Generated */ 
+/* Generated */ #else
+/* Generated */ TA_LIB_API int TA_QUANTILE_Lookback( int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               double        optInQuantile )  /* From 0 to 1 */
+/* Generated */ 
+/* Generated */ #endif
+/**** END GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return -1;
+/* Generated */ 
+/* Generated */    if( optInQuantile == TA_REAL_DEFAULT )
+/* Generated */       optInQuantile = 5.000000e-1;
+/* Generated */    else if( (optInQuantile < 0.000000e+0) ||/* Generated */  (optInQuantile > 1.000000e+0) )
+/* Generated */       return -1;
+/* Generated */ 
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/**** END GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+
+   /* insert lookback code here. */
+   return optInTimePeriod-1;
+}
+
+/**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+/*
+ * TA_QUANTILE - Quantile over period
+ * 
+ * Input  = double
+ * Output = double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * optInQuantile:(From 0 to 1)
+ *    Fraction of the values of the period below the output (0.5 is the median)
+ * 
+ * 
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::Quantile( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                          SubArray<double>^ inReal,
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                          [Out]int%    outBegIdx,
+/* Generated */                                          [Out]int%    outNBElement,
+/* Generated */                                          SubArray<double>^  outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::Quantile( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                          cli::array<double>^ inReal,
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                          [Out]int%    outBegIdx,
+/* Generated */                                          [Out]int%    outNBElement,
+/* Generated */                                          cli::array<double>^  outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode quantile( int    startIdx,
+/* Generated */                          int    endIdx,
+/* Generated */                          double       inReal[],
+/* Generated */                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                          MInteger     outBegIdx,
+/* Generated */                          MInteger     outNBElement,
+/* Generated */                          double        outReal[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_QUANTILE_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const double inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ #endif
+/**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */ 
+/* Generated */    /* Validate the requested output range. */
+/* Generated */    if( startIdx < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */    if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    #endif /* !defined(_JAVA)*/
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    if( optInQuantile == TA_REAL_DEFAULT )
+/* Generated */       optInQuantile = 5.000000e-1;
+/* Generated */    else if( (optInQuantile < 0.000000e+0) ||/* Generated */  (optInQuantile > 1.000000e+0) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !outReal )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #endif /* !defined(_JAVA) */
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/* Generated */ 
+/**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+
+   /* Insert TA function code here. */
+   return FUNCTION_CALL(INT_QUANTILE)( startIdx, endIdx, inReal,
+                                       optInTimePeriod, optInQuantile, 0,
+                                       outBegIdx, outNBElement, outReal );
+}
+
+/* Internal function shared with MEDIAN and MAD.
+ *
+ * When 'calcAbsDev' is not zero, the output is the quantile of the
+ * absolute deviations from the quantile of the values.
+ */
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+  // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+enum class Core::RetCode Core::TA_INT_QUANTILE( int    startIdx,
+                                                int    endIdx,
+                                                SubArray<double>^ inReal,
+                                                int    optInTimePeriod,
+                                                double optInQuantile,
+                                                int    calcAbsDev,
+                                                [Out]int% outBegIdx,
+                                                [Out]int% outNBElement,
+                                                SubArray<double>^ outReal )
+#elif defined( _MANAGED )
+enum class Core::RetCode Core::TA_INT_QUANTILE( int    startIdx,
+                                                int    endIdx,
+                                                cli::array<INPUT_TYPE>^ inReal,
+                                                int    optInTimePeriod,
+                                                double optInQuantile,
+                                                int    calcAbsDev,
+                                                [Out]int% outBegIdx,
+                                                [Out]int% outNBElement,
+                                                cli::array<double>^ outReal )
+#elif defined( _JAVA )
+public RetCode TA_INT_QUANTILE( int        startIdx,
+                                int        endIdx,
+                                INPUT_TYPE inReal[],
+                                int        optInTimePeriod,
+                                double     optInQuantile,
+                                int        calcAbsDev,
+                                MInteger   outBegIdx,
+                                MInteger   outNBElement,
+                                double     outReal[] )
+#else
+TA_RetCode TA_PREFIX(INT_QUANTILE)( int    startIdx,
+                                    int    endIdx,
+                                    const INPUT_TYPE *inReal,
+                                    int    optInTimePeriod,
+                                    double optInQuantile,
+                                    int    calcAbsDev,
+                                    int   *outBegIdx,
+                                    int   *outNBElement,
+                                    double *outReal )
+#endif
+{
+   ARRAY_REF(key);
+   ARRAY_INT_REF(tree);
+   double fraction, value, highValue, center, tempReal, tempReal2;
+   int i, outIdx, nbInitialElementNeeded, lowRank, nbRank, nbBelow, nbAbove;
+   int slot, node, child, seed, rank, j, lo, hi, mid;
+   int treeRoot, treeParent, treeGrandParent, treeChild, treeNode, treeRank;
+
+   nbInitialElementNeeded = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < nbInitialElementNeeded )
+      startIdx = nbInitialElementNeeded;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* The quantile is interpolated between the values at 'lowRank'
+    * and 'lowRank+1' of the period.
+    */
+   fraction = optInQuantile*(optInTimePeriod-1);
+   lowRank  = (int)fraction;
+   fraction -= lowRank;
+   if( lowRank >= optInTimePeriod-1 )
+   {
+      lowRank  = optInTimePeriod-1;
+      fraction = 0.0;
+   }
+   nbRank = (fraction > 0.0)? 2 : 1;
+
+   ARRAY_ALLOC(key, optInTimePeriod);
+   #if !defined(_JAVA)
+      if( !key )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+   #endif
+
+   ARRAY_INT_ALLOC(tree, 5*optInTimePeriod);
+   #if !defined(_JAVA)
+      if( !tree )
+      {
+         ARRAY_FREE(key);
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+   #endif
+
+   /* Pseudo-random priorities (Park-Miller, without overflow
+    * on 32 bits). Always the same, so is the output.
+    */
+   seed = 1;
+   for( slot=0; slot < optInTimePeriod; slot++ )
+   {
+      seed = 16807*(seed%127773) - 2836*(seed/127773);
+      if( seed <= 0 )
+         seed += 2147483647;
+      TREE_PRIO(slot) = seed;
+   }
+
+   treeRoot = TREE_NULL;
+   slot = 0;
+   outIdx = 0;
+   i = startIdx-nbInitialElementNeeded;
+   do
+   {
+      /* Remove the oldest value from the tree (the slot is
+       * moved down to a leaf, then unlinked).
+       */
+      if( (treeRoot != TREE_NULL) && (TREE_SIZE(treeRoot) == optInTimePeriod) )
+      {
+         while( (TREE_LEFT(slot) != TREE_NULL) && (TREE_RIGHT(slot) != TREE_NULL) )
+         {
+            if( TREE_PRIO(TREE_LEFT(slot)) > TREE_PRIO(TREE_RIGHT(slot)) )
+               child = TREE_LEFT(slot);
+            else
+               child = TREE_RIGHT(slot);
+            TREE_ROTATE_UP(child);
+         }
+
+         child = (TREE_LEFT(slot) != TREE_NULL)? TREE_LEFT(slot) : TREE_RIGHT(slot);
+         node = TREE_PARENT(slot);
+         if( child != TREE_NULL )
+            TREE_PARENT(child) = node;
+         if( node == TREE_NULL )
+            treeRoot = child;
+         else if( TREE_LEFT(node) == slot )
+            TREE_LEFT(node) = child;
+         else
+            TREE_RIGHT(node) = child;
+
+         while( node != TREE_NULL )
+         {
+            TREE_SIZE(node)--;
+            node = TREE_PARENT(node);
+         }
+      }
+
+      /* Insert the new value as a leaf, then move it up
+       * until its priority is below its parent.
+       */
+      key[slot] = inReal[i++];
+      TREE_LEFT(slot)   = TREE_NULL;
+      TREE_RIGHT(slot)  = TREE_NULL;
+      TREE_PARENT(slot) = TREE_NULL;
+      TREE_SIZE(slot)   = 1;
+      if( treeRoot == TREE_NULL )
+         treeRoot = slot;
+      else
+      {
+         node = treeRoot;
+         for( ;; )
+         {
+            TREE_SIZE(node)++;
+            if( key[slot] < key[node] )
+            {
+               if( TREE_LEFT(node) == TREE_NULL )
+               {
+                  TREE_LEFT(node) = slot;
+                  break;
+               }
+               node = TREE_LEFT(node);
+            }
+            else
+            {
+               if( TREE_RIGHT(node) == TREE_NULL )
+               {
+                  TREE_RIGHT(node) = slot;
+                  break;
+               }
+               node = TREE_RIGHT(node);
+            }
+         }
+         TREE_PARENT(slot) = node;
+
+         while( (TREE_PARENT(slot) != TREE_NULL) &&
+                (TREE_PRIO(slot) > TREE_PRIO(TREE_PARENT(slot))) )
+         {
+            TREE_ROTATE_UP(slot);
+         }
+      }
+
+      if( ++slot == optInTimePeriod )
+         slot = 0;
+
+      if( i > startIdx )
+      {
+         TREE_SELECT(lowRank,value);
+         if( nbRank == 2 )
+         {
+            TREE_SELECT(lowRank+1,highValue);
+            value += fraction*(highValue-value);
+         }
+
+         if( calcAbsDev != 0 )
+         {
+            /* The deviations are two increasing sequences:
+             *    below(j) = center - (value at rank lowRank-j)
+             *    above(j) = (value at rank lowRank+1+j) - center
+             * The deviation at 'rank' is found with a binary search
+             * on how many of the 'rank+1' smallest deviations are
+             * from 'below' (O(log(period)^2)).
+             */
+            center  = value;
+            nbBelow = lowRank+1;
+            nbAbove = optInTimePeriod-nbBelow;
+            for( j=0; j < nbRank; j++ )
+            {
+               rank = lowRank+j;
+               lo = rank+1-nbAbove;
+               if( lo < 0 )
+                  lo = 0;
+               hi = rank+1;
+               if( hi > nbBelow )
+                  hi = nbBelow;
+               while( lo < hi )
+               {
+                  mid = (lo+hi)>>1;
+                  TREE_SELECT(nbBelow+rank-mid,tempReal);
+                  TREE_SELECT(lowRank-mid,tempReal2);
+                  if( (tempReal-center) > (center-tempReal2) )
+                     lo = mid+1;
+                  else
+                     hi = mid;
+               }
+
+               /* 'lo' deviations from 'below', the others from 'above'. */
+               tempReal = 0.0;
+               if( lo > 0 )
+               {
+                  TREE_SELECT(lowRank-lo+1,tempReal2);
+                  tempReal = center-tempReal2;
+               }
+               if( lo < rank+1 )
+               {
+                  TREE_SELECT(nbBelow+rank-lo,tempReal2);
+                  if( (tempReal2-center) > tempReal )
+                     tempReal = tempReal2-center;
+               }
+
+               if( j == 0 )
+                  value = tempReal;
+               else
+                  value += fraction*(tempReal-value);
+            }
+         }
+
+         outReal[outIdx++] = value;
+      }
+   } while( i <= endIdx );
+
+   ARRAY_FREE(key);
+   ARRAY_INT_FREE(tree);
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
+
+/**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #define  USE_SINGLE_PRECISION_INPUT
+/* Generated */ #undef  TA_LIB_PRO
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    #undef   TA_PREFIX
+/* Generated */    #define  TA_PREFIX(x) TA_S_##x
+/* Generated */ #endif
+/* Generated */ #undef   INPUT_TYPE
+/* Generated */ #define  INPUT_TYPE float
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::Quantile( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                          SubArray<float>^ inReal,
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                          [Out]int%    outBegIdx,
+/* Generated */                                          [Out]int%    outNBElement,
+/* Generated */                                          SubArray<double>^  outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::Quantile( int    startIdx,
+/* Generated */                                          int    endIdx,
+/* Generated */                                          cli::array<float>^ inReal,
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                          [Out]int%    outBegIdx,
+/* Generated */                                          [Out]int%    outNBElement,
+/* Generated */                                          cli::array<double>^  outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode quantile( int    startIdx,
+/* Generated */                          int    endIdx,
+/* Generated */                          float        inReal[],
+/* Generated */                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                          double        optInQuantile, /* From 0 to 1 */
+/* Generated */                          MInteger     outBegIdx,
+/* Generated */                          MInteger     outNBElement,
+/* Generated */                          double        outReal[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_S_QUANTILE_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const float  inReal[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outReal[] )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */     if( startIdx < 0 )
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */     if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */     if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */        optInTimePeriod = 14;
+/* Generated */     else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( optInQuantile == TA_REAL_DEFAULT )
+/* Generated */        optInQuantile = 5.000000e-1;
+/* Generated */     else if( (optInQuantile < 0.000000e+0) ||  (optInQuantile > 1.000000e+0) )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !outReal )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */  #endif 
+/* Generated */    return FUNCTION_CALL(INT_QUANTILE)( startIdx, endIdx, inReal,
+/* Generated */                                        optInTimePeriod, optInQuantile, 0,
+/* Generated */                                        outBegIdx, outNBElement, outReal );
+/* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */   // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::TA_INT_QUANTILE( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 SubArray<double>^ inReal,
+/* Generated */                                                 int    optInTimePeriod,
+/* Generated */                                                 double optInQuantile,
+/* Generated */                                                 int    calcAbsDev,
+/* Generated */                                                 [Out]int% outBegIdx,
+/* Generated */                                                 [Out]int% outNBElement,
+/* Generated */                                                 SubArray<double>^ outReal )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::TA_INT_QUANTILE( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                                 int    optInTimePeriod,
+/* Generated */                                                 double optInQuantile,
+/* Generated */                                                 int    calcAbsDev,
+/* Generated */                                                 [Out]int% outBegIdx,
+/* Generated */                                                 [Out]int% outNBElement,
+/* Generated */                                                 cli::array<double>^ outReal )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode TA_INT_QUANTILE( int        startIdx,
+/* Generated */                                 int        endIdx,
+/* Generated */                                 INPUT_TYPE inReal[],
+/* Generated */                                 int        optInTimePeriod,
+/* Generated */                                 double     optInQuantile,
+/* Generated */                                 int        calcAbsDev,
+/* Generated */                                 MInteger   outBegIdx,
+/* Generated */                                 MInteger   outNBElement,
+/* Generated */                                 double     outReal[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_QUANTILE)( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                     const INPUT_TYPE *inReal,
+/* Generated */                                     int    optInTimePeriod,
+/* Generated */                                     double optInQuantile,
+/* Generated */                                     int    calcAbsDev,
+/* Generated */                                     int   *outBegIdx,
+/* Generated */                                     int   *outNBElement,
+/* Generated */                                     double *outReal )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    ARRAY_REF(key);
+/* Generated */    ARRAY_INT_REF(tree);
+/* Generated */    double fraction, value, highValue, center, tempReal, tempReal2;
+/* Generated */    int i, outIdx, nbInitialElementNeeded, lowRank, nbRank, nbBelow, nbAbove;
+/* Generated */    int slot, node, child, seed, rank, j, lo, hi, mid;
+/* Generated */    int treeRoot, treeParent, treeGrandParent, treeChild, treeNode, treeRank;
+/* Generated */    nbInitialElementNeeded = (optInTimePeriod-1);
+/* Generated */    if( startIdx < nbInitialElementNeeded )
+/* Generated */       startIdx = nbInitialElementNeeded;
+/* Generated */    if( startIdx > endIdx )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    fraction = optInQuantile*(optInTimePeriod-1);
+/* Generated */    lowRank  = (int)fraction;
+/* Generated */    fraction -= lowRank;
+/* Generated */    if( lowRank >= optInTimePeriod-1 )
+/* Generated */    {
+/* Generated */       lowRank  = optInTimePeriod-1;
+/* Generated */       fraction = 0.0;
+/* Generated */    }
+/* Generated */    nbRank = (fraction > 0.0)? 2 : 1;
+/* Generated */    ARRAY_ALLOC(key, optInTimePeriod);
+/* Generated */    #if !defined(_JAVA)
+/* Generated */       if( !key )
+/* Generated */       {
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */    #endif
+/* Generated */    ARRAY_INT_ALLOC(tree, 5*optInTimePeriod);
+/* Generated */    #if !defined(_JAVA)
+/* Generated */       if( !tree )
+/* Generated */       {
+/* Generated */          ARRAY_FREE(key);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */    #endif
+/* Generated */    seed = 1;
+/* Generated */    for( slot=0; slot < optInTimePeriod; slot++ )
+/* Generated */    {
+/* Generated */       seed = 16807*(seed%127773) - 2836*(seed/127773);
+/* Generated */       if( seed <= 0 )
+/* Generated */          seed += 2147483647;
+/* Generated */       TREE_PRIO(slot) = seed;
+/* Generated */    }
+/* Generated */    treeRoot = TREE_NULL;
+/* Generated */    slot = 0;
+/* Generated */    outIdx = 0;
+/* Generated */    i = startIdx-nbInitialElementNeeded;
+/* Generated */    do
+/* Generated */    {
+/* Generated */       if( (treeRoot != TREE_NULL) && (TREE_SIZE(treeRoot) == optInTimePeriod) )
+/* Generated */       {
+/* Generated */          while( (TREE_LEFT(slot) != TREE_NULL) && (TREE_RIGHT(slot) != TREE_NULL) )
+/* Generated */          {
+/* Generated */             if( TREE_PRIO(TREE_LEFT(slot)) > TREE_PRIO(TREE_RIGHT(slot)) )
+/* Generated */                child = TREE_LEFT(slot);
+/* Generated */             else
+/* Generated */                child = TREE_RIGHT(slot);
+/* Generated */             TREE_ROTATE_UP(child);
+/* Generated */          }
+/* Generated */          child = (TREE_LEFT(slot) != TREE_NULL)? TREE_LEFT(slot) : TREE_RIGHT(slot);
+/* Generated */          node = TREE_PARENT(slot);
+/* Generated */          if( child != TREE_NULL )
+/* Generated */             TREE_PARENT(child) = node;
+/* Generated */          if( node == TREE_NULL )
+/* Generated */             treeRoot = child;
+/* Generated */          else if( TREE_LEFT(node) == slot )
+/* Generated */             TREE_LEFT(node) = child;
+/* Generated */          else
+/* Generated */             TREE_RIGHT(node) = child;
+/* Generated */          while( node != TREE_NULL )
+/* Generated */          {
+/* Generated */             TREE_SIZE(node)--;
+/* Generated */             node = TREE_PARENT(node);
+/* Generated */          }
+/* Generated */       }
+/* Generated */       key[slot] = inReal[i++];
+/* Generated */       TREE_LEFT(slot)   = TREE_NULL;
+/* Generated */       TREE_RIGHT(slot)  = TREE_NULL;
+/* Generated */       TREE_PARENT(slot) = TREE_NULL;
+/* Generated */       TREE_SIZE(slot)   = 1;
+/* Generated */       if( treeRoot == TREE_NULL )
+/* Generated */          treeRoot = slot;
+/* Generated */       else
+/* Generated */       {
+/* Generated */          node = treeRoot;
+/* Generated */          for( ;; )
+/* Generated */          {
+/* Generated */             TREE_SIZE(node)++;
+/* Generated */             if( key[slot] < key[node] )
+/* Generated */             {
+/* Generated */                if( TREE_LEFT(node) == TREE_NULL )
+/* Generated */                {
+/* Generated */                   TREE_LEFT(node) = slot;
+/* Generated */                   break;
+/* Generated */                }
+/* Generated */                node = TREE_LEFT(node);
+/* Generated */             }
+/* Generated */             else
+/* Generated */             {
+/* Generated */                if( TREE_RIGHT(node) == TREE_NULL )
+/* Generated */                {
+/* Generated */                   TREE_RIGHT(node) = slot;
+/* Generated */                   break;
+/* Generated */                }
+/* Generated */                node = TREE_RIGHT(node);
+/* Generated */             }
+/* Generated */          }
+/* Generated */          TREE_PARENT(slot) = node;
+/* Generated */          while( (TREE_PARENT(slot) != TREE_NULL) &&
+/* Generated */                 (TREE_PRIO(slot) > TREE_PRIO(TREE_PARENT(slot))) )
+/* Generated */          {
+/* Generated */             TREE_ROTATE_UP(slot);
+/* Generated */          }
+/* Generated */       }
+/* Generated */       if( ++slot == optInTimePeriod )
+/* Generated */          slot = 0;
+/* Generated */       if( i > startIdx )
+/* Generated */       {
+/* Generated */          TREE_SELECT(lowRank,value);
+/* Generated */          if( nbRank == 2 )
+/* Generated */          {
+/* Generated */             TREE_SELECT(lowRank+1,highValue);
+/* Generated */             value += fraction*(highValue-value);
+/* Generated */          }
+/* Generated */          if( calcAbsDev != 0 )
+/* Generated */          {
+/* Generated */             center  = value;
+/* Generated */             nbBelow = lowRank+1;
+/* Generated */             nbAbove = optInTimePeriod-nbBelow;
+/* Generated */             for( j=0; j < nbRank; j++ )
+/* Generated */             {
+/* Generated */                rank = lowRank+j;
+/* Generated */                lo = rank+1-nbAbove;
+/* Generated */                if( lo < 0 )
+/* Generated */                   lo = 0;
+/* Generated */                hi = rank+1;
+/* Generated */                if( hi > nbBelow )
+/* Generated */                   hi = nbBelow;
+/* Generated */                while( lo < hi )
+/* Generated */                {
+/* Generated */                   mid = (lo+hi)>>1;
+/* Generated */                   TREE_SELECT(nbBelow+rank-mid,tempReal);
+/* Generated */                   TREE_SELECT(lowRank-mid,tempReal2);
+/* Generated */                   if( (tempReal-center) > (center-tempReal2) )
+/* Generated */                      lo = mid+1;
+/* Generated */                   else
+/* Generated */                      hi = mid;
+/* Generated */                }
+/* Generated */                tempReal = 0.0;
+/* Generated */                if( lo > 0 )
+/* Generated */                {
+/* Generated */                   TREE_SELECT(lowRank-lo+1,tempReal2);
+/* Generated */                   tempReal = center-tempReal2;
+/* Generated */                }
+/* Generated */                if( lo < rank+1 )
+/* Generated */                {
+/* Generated */                   TREE_SELECT(nbBelow+rank-lo,tempReal2);
+/* Generated */                   if( (tempReal2-center) > tempReal )
+/* Generated */                      tempReal = tempReal2-center;
+/* Generated */                }
+/* Generated */                if( j == 0 )
+/* Generated */                   value = tempReal;
+/* Generated */                else
+/* Generated */                   value += fraction*(tempReal-value);
+/* Generated */             }
+/* Generated */          }
+/* Generated */          outReal[outIdx++] = value;
+/* Generated */       }
+/* Generated */    } while( i <= endIdx );
+/* Generated */    ARRAY_FREE(key);
+/* Generated */    ARRAY_INT_FREE(tree);
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_QUANTILE;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_QUANTILE( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const double inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_QUANTILE_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInQuantile,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_QUANTILE_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInQuantile,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_QUANTILE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_QUANTILE( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const float  inReal[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 double        optInQuantile, /* From 0 to 1 */
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_QUANTILE_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod, optInQuantile,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_QUANTILE_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod, optInQuantile,
+/* Generated */                                  outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_QUANTILE, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ }}} // Close namespace TicTacTec.TA.Lib
+/* Generated */ #endif
+/**** END GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+
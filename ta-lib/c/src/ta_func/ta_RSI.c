@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       agent <agent@local>
  *
  *
  * Change history:
@@ -45,6 +46,7 @@
  *  112400 MF   Template creation.
  *  052603 MF   Adapt code to compile with .NET Managed C++
  *  062804 MF   Resolve div by zero bug on limit case.
+ *  101826 AG   Move the calculation in TA_INT_RSI (fixed-period copies).
  */
 
 /**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
@@ -153,26 +155,17 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_RSI( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inReal[],
-/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_RSI_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inReal[],
+/* Generated */                                       int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* Insert local variables here. */
-   int outIdx;
-
-   int today, lookbackTotal, unstablePeriod, i;
-   double prevGain, prevLoss, prevValue, savePrevValue;
-   double tempValue1, tempValue2;
-
-   #if defined( USE_SINGLE_PRECISION_INPUT )
-        ARRAY_MEMMOVEMIX_VAR;
-   #endif
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -203,6 +196,62 @@
 /**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 
    /* Insert TA function code here. */
+   return FUNCTION_CALL(INT_RSI)( startIdx, endIdx,
+                                  inReal, optInTimePeriod,
+                                  outBegIdx, outNBElement, outReal );
+}
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+   // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+ enum class Core::RetCode Core::TA_INT_RSI( int     startIdx,
+                                            int     endIdx,
+                                            SubArray<double>^ inReal,
+                                            int     optInTimePeriod,
+                                            [Out]int% outBegIdx,
+                                            [Out]int% outNBElement,
+                                            SubArray<double>^  outReal)
+#elif defined( _MANAGED )
+ enum class Core::RetCode Core::TA_INT_RSI( int     startIdx,
+                                            int     endIdx,
+                                            cli::array<INPUT_TYPE>^ inReal,
+                                            int     optInTimePeriod,
+                                            [Out]int% outBegIdx,
+                                            [Out]int% outNBElement,
+                                            cli::array<double>^  outReal)
+#elif defined( _JAVA )
+RetCode TA_INT_RSI( int    startIdx,
+                    int    endIdx,
+                    INPUT_TYPE inReal[],
+                    int      optInTimePeriod, /* From 2 to 100000 */
+                    MInteger outBegIdx,
+                    MInteger outNBElement,
+                    double   outReal[] )
+#else
+TA_RetCode TA_PREFIX(INT_RSI)( int    startIdx,
+                               int    endIdx,
+                               const INPUT_TYPE *inReal,
+                               int      optInTimePeriod, /* From 2 to 100000 */
+                               int     *outBegIdx,
+                               int     *outNBElement,
+                               double  *outReal )
+#endif
+{
+   int outIdx;
+   int today, lookbackTotal, unstablePeriod, i;
+   double prevGain, prevLoss, prevValue, savePrevValue;
+   double tempValue1, tempValue2;
+   #if defined( USE_SINGLE_PRECISION_INPUT )
+        ARRAY_MEMMOVEMIX_VAR;
+   #endif
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_RSI_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
 
    /* The following algorithm is base on the original 
     * work from Wilder's and shall represent the
@@ -419,6 +468,8 @@
    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 }
 
+#endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -455,22 +506,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_RSI( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inReal[],
-/* Generated */                      int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_RSI_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inReal[],
+/* Generated */                                         int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    int outIdx;
-/* Generated */    int today, lookbackTotal, unstablePeriod, i;
-/* Generated */    double prevGain, prevLoss, prevValue, savePrevValue;
-/* Generated */    double tempValue1, tempValue2;
-/* Generated */    #if defined( USE_SINGLE_PRECISION_INPUT )
-/* Generated */         ARRAY_MEMMOVEMIX_VAR;
-/* Generated */    #endif
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -488,6 +532,58 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
+/* Generated */    return FUNCTION_CALL(INT_RSI)( startIdx, endIdx,
+/* Generated */                                   inReal, optInTimePeriod,
+/* Generated */                                   outBegIdx, outNBElement, outReal );
+/* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */    // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */  enum class Core::RetCode Core::TA_INT_RSI( int     startIdx,
+/* Generated */                                             int     endIdx,
+/* Generated */                                             SubArray<double>^ inReal,
+/* Generated */                                             int     optInTimePeriod,
+/* Generated */                                             [Out]int% outBegIdx,
+/* Generated */                                             [Out]int% outNBElement,
+/* Generated */                                             SubArray<double>^  outReal)
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */  enum class Core::RetCode Core::TA_INT_RSI( int     startIdx,
+/* Generated */                                             int     endIdx,
+/* Generated */                                             cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                             int     optInTimePeriod,
+/* Generated */                                             [Out]int% outBegIdx,
+/* Generated */                                             [Out]int% outNBElement,
+/* Generated */                                             cli::array<double>^  outReal)
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ RetCode TA_INT_RSI( int    startIdx,
+/* Generated */                     int    endIdx,
+/* Generated */                     INPUT_TYPE inReal[],
+/* Generated */                     int      optInTimePeriod, 
+/* Generated */                     MInteger outBegIdx,
+/* Generated */                     MInteger outNBElement,
+/* Generated */                     double   outReal[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_RSI)( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                const INPUT_TYPE *inReal,
+/* Generated */                                int      optInTimePeriod, 
+/* Generated */                                int     *outBegIdx,
+/* Generated */                                int     *outNBElement,
+/* Generated */                                double  *outReal )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int outIdx;
+/* Generated */    int today, lookbackTotal, unstablePeriod, i;
+/* Generated */    double prevGain, prevLoss, prevValue, savePrevValue;
+/* Generated */    double tempValue1, tempValue2;
+/* Generated */    #if defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */         ARRAY_MEMMOVEMIX_VAR;
+/* Generated */    #endif
+/* Generated */    #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    TA_INT_RSI_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+/* Generated */                              outBegIdx, outNBElement, outReal ))
+/* Generated */    #endif
 /* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
 /* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */    lookbackTotal = LOOKBACK_CALL(RSI)( optInTimePeriod );
@@ -607,6 +703,63 @@
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
+/* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_RSI;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_RSI( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inReal[],
+/* Generated */                                          int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_RSI_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_RSI_Calc( startIdx, endIdx,
+/* Generated */                           inReal,
+/* Generated */                           optInTimePeriod,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_RSI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_RSI( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_RSI_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_RSI_Calc( startIdx, endIdx,
+/* Generated */                             inReal,
+/* Generated */                             optInTimePeriod,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_RSI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
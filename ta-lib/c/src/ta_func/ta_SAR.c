@@ -176,15 +176,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_SAR( int    startIdx,
-/* Generated */                               int    endIdx,
-/* Generated */                                          const double inHigh[],
-/* Generated */                                          const double inLow[],
-/* Generated */                                          double        optInAcceleration, /* From 0 to TA_REAL_MAX */
-/* Generated */                                          double        optInMaximum, /* From 0 to TA_REAL_MAX */
-/* Generated */                                          int          *outBegIdx,
-/* Generated */                                          int          *outNBElement,
-/* Generated */                                          double        outReal[] )
+/* Generated */ static TA_RetCode TA_SAR_Calc( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                       const double inHigh[],
+/* Generated */                                       const double inLow[],
+/* Generated */                                       double        optInAcceleration, /* From 0 to TA_REAL_MAX */
+/* Generated */                                       double        optInMaximum, /* From 0 to TA_REAL_MAX */
+/* Generated */                                       int          *outBegIdx,
+/* Generated */                                       int          *outNBElement,
+/* Generated */                                       double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -541,15 +541,15 @@
 /* Generated */                     MInteger     outNBElement,
 /* Generated */                     double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_SAR( int    startIdx,
-/* Generated */                      int    endIdx,
-/* Generated */                      const float  inHigh[],
-/* Generated */                      const float  inLow[],
-/* Generated */                      double        optInAcceleration, /* From 0 to TA_REAL_MAX */
-/* Generated */                      double        optInMaximum, /* From 0 to TA_REAL_MAX */
-/* Generated */                      int          *outBegIdx,
-/* Generated */                      int          *outNBElement,
-/* Generated */                      double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_SAR_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const float  inHigh[],
+/* Generated */                                         const float  inLow[],
+/* Generated */                                         double        optInAcceleration, /* From 0 to TA_REAL_MAX */
+/* Generated */                                         double        optInMaximum, /* From 0 to TA_REAL_MAX */
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -715,6 +715,66 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_SAR;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_SAR( int    startIdx,
+/* Generated */                               int    endIdx,
+/* Generated */                                          const double inHigh[],
+/* Generated */                                          const double inLow[],
+/* Generated */                                          double        optInAcceleration, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInMaximum, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_SAR_Calc( startIdx, endIdx,
+/* Generated */                           inHigh, inLow,
+/* Generated */                           optInAcceleration, optInMaximum,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_SAR_Calc( startIdx, endIdx,
+/* Generated */                           inHigh, inLow,
+/* Generated */                           optInAcceleration, optInMaximum,
+/* Generated */                           outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_SAR, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_SAR( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const float  inHigh[],
+/* Generated */                                            const float  inLow[],
+/* Generated */                                            double        optInAcceleration, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInMaximum, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_SAR_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow,
+/* Generated */                             optInAcceleration, optInMaximum,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_SAR_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow,
+/* Generated */                             optInAcceleration, optInMaximum,
+/* Generated */                             outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_SAR, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
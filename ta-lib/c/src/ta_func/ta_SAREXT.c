@@ -272,21 +272,21 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_SAREXT( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inHigh[],
-/* Generated */                                             const double inLow[],
-/* Generated */                                             double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                                             double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outReal[] )
+/* Generated */ static TA_RetCode TA_SAREXT_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inHigh[],
+/* Generated */                                          const double inLow[],
+/* Generated */                                          double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                          double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -755,21 +755,21 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_SAREXT( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inHigh[],
-/* Generated */                         const float  inLow[],
-/* Generated */                         double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
-/* Generated */                         double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                         double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_SAREXT_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inHigh[],
+/* Generated */                                            const float  inLow[],
+/* Generated */                                            double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                            double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -994,6 +994,78 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_SAREXT;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_SAREXT( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inHigh[],
+/* Generated */                                             const double inLow[],
+/* Generated */                                             double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                             double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_SAREXT_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow,
+/* Generated */                              optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_SAREXT_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow,
+/* Generated */                              optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_SAREXT, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_SAREXT( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inHigh[],
+/* Generated */                                               const float  inLow[],
+/* Generated */                                               double        optInStartValue, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                               double        optInOffsetOnReverse, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationInitLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationMaxLong, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationInitShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               double        optInAccelerationMaxShort, /* From 0 to TA_REAL_MAX */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_SAREXT_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow,
+/* Generated */                                optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_SAREXT_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow,
+/* Generated */                                optInStartValue, optInOffsetOnReverse, optInAccelerationInitLong, optInAccelerationLong, optInAccelerationMaxLong, optInAccelerationInitShort, optInAccelerationShort, optInAccelerationMaxShort,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_SAREXT, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
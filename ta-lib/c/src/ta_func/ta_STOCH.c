@@ -226,20 +226,20 @@
 /* Generated */                       double        outSlowK[],
 /* Generated */                       double        outSlowD[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_STOCH( int    startIdx,
-/* Generated */                                 int    endIdx,
-/* Generated */                                            const double inHigh[],
-/* Generated */                                            const double inLow[],
-/* Generated */                                            const double inClose[],
-/* Generated */                                            int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                                            int           optInSlowK_Period, /* From 1 to 100000 */
-/* Generated */                                            TA_MAType     optInSlowK_MAType,
-/* Generated */                                            int           optInSlowD_Period, /* From 1 to 100000 */
-/* Generated */                                            TA_MAType     optInSlowD_MAType,
-/* Generated */                                            int          *outBegIdx,
-/* Generated */                                            int          *outNBElement,
-/* Generated */                                            double        outSlowK[],
-/* Generated */                                            double        outSlowD[] )
+/* Generated */ static TA_RetCode TA_STOCH_Calc( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                         const double inHigh[],
+/* Generated */                                         const double inLow[],
+/* Generated */                                         const double inClose[],
+/* Generated */                                         int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                         int           optInSlowK_Period, /* From 1 to 100000 */
+/* Generated */                                         TA_MAType     optInSlowK_MAType,
+/* Generated */                                         int           optInSlowD_Period, /* From 1 to 100000 */
+/* Generated */                                         TA_MAType     optInSlowD_MAType,
+/* Generated */                                         int          *outBegIdx,
+/* Generated */                                         int          *outNBElement,
+/* Generated */                                         double        outSlowK[],
+/* Generated */                                         double        outSlowD[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -398,6 +398,11 @@
     *
     * If the output is the same as the input, great
     * we just save ourself one memory allocation.
+    *
+    * Only the K output can be re-used. The D output is
+    * written by the MA while the K are still being read,
+    * so when only outSlowD is the same as an input a
+    * temporary buffer is still needed.
     */
    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
       bufferIsAllocated = 0;
@@ -416,12 +421,6 @@
       {
          tempBuffer = outSlowK;
       }
-      else if( (outSlowD == inHigh) ||
-               (outSlowD == inLow)  ||
-               (outSlowD == inClose) )
-      {
-         tempBuffer = outSlowD;
-      }
       else
       {
          #if !defined( _MANAGED ) && !defined(_JAVA)
@@ -613,20 +612,20 @@
 /* Generated */                       double        outSlowK[],
 /* Generated */                       double        outSlowD[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_STOCH( int    startIdx,
-/* Generated */                        int    endIdx,
-/* Generated */                        const float  inHigh[],
-/* Generated */                        const float  inLow[],
-/* Generated */                        const float  inClose[],
-/* Generated */                        int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                        int           optInSlowK_Period, /* From 1 to 100000 */
-/* Generated */                        TA_MAType     optInSlowK_MAType,
-/* Generated */                        int           optInSlowD_Period, /* From 1 to 100000 */
-/* Generated */                        TA_MAType     optInSlowD_MAType,
-/* Generated */                        int          *outBegIdx,
-/* Generated */                        int          *outNBElement,
-/* Generated */                        double        outSlowK[],
-/* Generated */                        double        outSlowD[] )
+/* Generated */ static TA_RetCode TA_S_STOCH_Calc( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                           const float  inHigh[],
+/* Generated */                                           const float  inLow[],
+/* Generated */                                           const float  inClose[],
+/* Generated */                                           int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                           int           optInSlowK_Period, /* From 1 to 100000 */
+/* Generated */                                           TA_MAType     optInSlowK_MAType,
+/* Generated */                                           int           optInSlowD_Period, /* From 1 to 100000 */
+/* Generated */                                           TA_MAType     optInSlowD_MAType,
+/* Generated */                                           int          *outBegIdx,
+/* Generated */                                           int          *outNBElement,
+/* Generated */                                           double        outSlowK[],
+/* Generated */                                           double        outSlowD[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -707,12 +706,6 @@
 /* Generated */       {
 /* Generated */          tempBuffer = outSlowK;
 /* Generated */       }
-/* Generated */       else if( (outSlowD == inHigh) ||
-/* Generated */                (outSlowD == inLow)  ||
-/* Generated */                (outSlowD == inClose) )
-/* Generated */       {
-/* Generated */          tempBuffer = outSlowD;
-/* Generated */       }
 /* Generated */       else
 /* Generated */       {
 /* Generated */          #if !defined( _MANAGED ) && !defined(_JAVA)
@@ -811,6 +804,76 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_STOCH;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_STOCH( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                            const double inHigh[],
+/* Generated */                                            const double inLow[],
+/* Generated */                                            const double inClose[],
+/* Generated */                                            int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                            int           optInSlowK_Period, /* From 1 to 100000 */
+/* Generated */                                            TA_MAType     optInSlowK_MAType,
+/* Generated */                                            int           optInSlowD_Period, /* From 1 to 100000 */
+/* Generated */                                            TA_MAType     optInSlowD_MAType,
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outSlowK[],
+/* Generated */                                            double        outSlowD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_STOCH_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose,
+/* Generated */                             optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+/* Generated */                             outBegIdx, outNBElement, outSlowK, outSlowD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_STOCH_Calc( startIdx, endIdx,
+/* Generated */                             inHigh, inLow, inClose,
+/* Generated */                             optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+/* Generated */                             outBegIdx, outNBElement, outSlowK, outSlowD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCH, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_STOCH( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                              const float  inHigh[],
+/* Generated */                                              const float  inLow[],
+/* Generated */                                              const float  inClose[],
+/* Generated */                                              int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                              int           optInSlowK_Period, /* From 1 to 100000 */
+/* Generated */                                              TA_MAType     optInSlowK_MAType,
+/* Generated */                                              int           optInSlowD_Period, /* From 1 to 100000 */
+/* Generated */                                              TA_MAType     optInSlowD_MAType,
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outSlowK[],
+/* Generated */                                              double        outSlowD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_STOCH_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow, inClose,
+/* Generated */                               optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+/* Generated */                               outBegIdx, outNBElement, outSlowK, outSlowD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_STOCH_Calc( startIdx, endIdx,
+/* Generated */                               inHigh, inLow, inClose,
+/* Generated */                               optInFastK_Period, optInSlowK_Period, optInSlowK_MAType, optInSlowD_Period, optInSlowD_MAType,
+/* Generated */                               outBegIdx, outNBElement, outSlowK, outSlowD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCH, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
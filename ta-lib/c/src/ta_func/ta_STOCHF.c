@@ -193,18 +193,18 @@
 /* Generated */                        double        outFastK[],
 /* Generated */                        double        outFastD[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_STOCHF( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inHigh[],
-/* Generated */                                             const double inLow[],
-/* Generated */                                             const double inClose[],
-/* Generated */                                             int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                                             int           optInFastD_Period, /* From 1 to 100000 */
-/* Generated */                                             TA_MAType     optInFastD_MAType,
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outFastK[],
-/* Generated */                                             double        outFastD[] )
+/* Generated */ static TA_RetCode TA_STOCHF_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inHigh[],
+/* Generated */                                          const double inLow[],
+/* Generated */                                          const double inClose[],
+/* Generated */                                          int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                          int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                          TA_MAType     optInFastD_MAType,
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outFastK[],
+/* Generated */                                          double        outFastD[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -350,6 +350,11 @@
     *
     * If the output is the same as the input, great
     * we just save ourself one memory allocation.
+    *
+    * Only the K output can be re-used. The D output is
+    * written by the MA while the K are still being read,
+    * so when only outFastD is the same as an input a
+    * temporary buffer is still needed.
     */
    #if !defined( _MANAGED ) && !defined(USE_SINGLE_PRECISION_INPUT) && !defined( _JAVA )
       bufferIsAllocated = 0;
@@ -368,12 +373,6 @@
       {
          tempBuffer = outFastK;
       }
-      else if( (outFastD == inHigh) ||
-               (outFastD == inLow)  ||
-               (outFastD == inClose) )
-      {
-         tempBuffer = outFastD;
-      }
       else
       {
          #if !defined( _MANAGED ) && !defined( _JAVA )
@@ -548,18 +547,18 @@
 /* Generated */                        double        outFastK[],
 /* Generated */                        double        outFastD[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_STOCHF( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inHigh[],
-/* Generated */                         const float  inLow[],
-/* Generated */                         const float  inClose[],
-/* Generated */                         int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                         int           optInFastD_Period, /* From 1 to 100000 */
-/* Generated */                         TA_MAType     optInFastD_MAType,
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outFastK[],
-/* Generated */                         double        outFastD[] )
+/* Generated */ static TA_RetCode TA_S_STOCHF_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inHigh[],
+/* Generated */                                            const float  inLow[],
+/* Generated */                                            const float  inClose[],
+/* Generated */                                            int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                            int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                            TA_MAType     optInFastD_MAType,
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outFastK[],
+/* Generated */                                            double        outFastD[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -629,12 +628,6 @@
 /* Generated */       {
 /* Generated */          tempBuffer = outFastK;
 /* Generated */       }
-/* Generated */       else if( (outFastD == inHigh) ||
-/* Generated */                (outFastD == inLow)  ||
-/* Generated */                (outFastD == inClose) )
-/* Generated */       {
-/* Generated */          tempBuffer = outFastD;
-/* Generated */       }
 /* Generated */       else
 /* Generated */       {
 /* Generated */          #if !defined( _MANAGED ) && !defined( _JAVA )
@@ -729,6 +722,72 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_STOCHF;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_STOCHF( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inHigh[],
+/* Generated */                                             const double inLow[],
+/* Generated */                                             const double inClose[],
+/* Generated */                                             int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                             int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                             TA_MAType     optInFastD_MAType,
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outFastK[],
+/* Generated */                                             double        outFastD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_STOCHF_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow, inClose,
+/* Generated */                              optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                              outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_STOCHF_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow, inClose,
+/* Generated */                              optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                              outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCHF, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_STOCHF( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inHigh[],
+/* Generated */                                               const float  inLow[],
+/* Generated */                                               const float  inClose[],
+/* Generated */                                               int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                               int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                               TA_MAType     optInFastD_MAType,
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outFastK[],
+/* Generated */                                               double        outFastD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_STOCHF_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_STOCHF_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCHF, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
@@ -198,17 +198,17 @@
 /* Generated */                          double        outFastK[],
 /* Generated */                          double        outFastD[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_STOCHRSI( int    startIdx,
-/* Generated */                                    int    endIdx,
-/* Generated */                                               const double inReal[],
-/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                                               int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                                               int           optInFastD_Period, /* From 1 to 100000 */
-/* Generated */                                               TA_MAType     optInFastD_MAType,
-/* Generated */                                               int          *outBegIdx,
-/* Generated */                                               int          *outNBElement,
-/* Generated */                                               double        outFastK[],
-/* Generated */                                               double        outFastD[] )
+/* Generated */ static TA_RetCode TA_STOCHRSI_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const double inReal[],
+/* Generated */                                            int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                            int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                            int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                            TA_MAType     optInFastD_MAType,
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outFastK[],
+/* Generated */                                            double        outFastD[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -410,17 +410,17 @@
 /* Generated */                          double        outFastK[],
 /* Generated */                          double        outFastD[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_STOCHRSI( int    startIdx,
-/* Generated */                           int    endIdx,
-/* Generated */                           const float  inReal[],
-/* Generated */                           int           optInTimePeriod, /* From 2 to 100000 */
-/* Generated */                           int           optInFastK_Period, /* From 1 to 100000 */
-/* Generated */                           int           optInFastD_Period, /* From 1 to 100000 */
-/* Generated */                           TA_MAType     optInFastD_MAType,
-/* Generated */                           int          *outBegIdx,
-/* Generated */                           int          *outNBElement,
-/* Generated */                           double        outFastK[],
-/* Generated */                           double        outFastD[] )
+/* Generated */ static TA_RetCode TA_S_STOCHRSI_Calc( int    startIdx,
+/* Generated */                                       int    endIdx,
+/* Generated */                                              const float  inReal[],
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                              int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                              TA_MAType     optInFastD_MAType,
+/* Generated */                                              int          *outBegIdx,
+/* Generated */                                              int          *outNBElement,
+/* Generated */                                              double        outFastK[],
+/* Generated */                                              double        outFastD[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    ARRAY_REF(tempRSIBuffer);
@@ -513,6 +513,70 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_STOCHRSI;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_STOCHRSI( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const double inReal[],
+/* Generated */                                               int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                               int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                               int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                               TA_MAType     optInFastD_MAType,
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outFastK[],
+/* Generated */                                               double        outFastD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_STOCHRSI_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_STOCHRSI_Calc( startIdx, endIdx,
+/* Generated */                                inReal,
+/* Generated */                                optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCHRSI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_STOCHRSI( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                                 const float  inReal[],
+/* Generated */                                                 int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                                 int           optInFastK_Period, /* From 1 to 100000 */
+/* Generated */                                                 int           optInFastD_Period, /* From 1 to 100000 */
+/* Generated */                                                 TA_MAType     optInFastD_MAType,
+/* Generated */                                                 int          *outBegIdx,
+/* Generated */                                                 int          *outNBElement,
+/* Generated */                                                 double        outFastK[],
+/* Generated */                                                 double        outFastD[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_STOCHRSI_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                  outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_STOCHRSI_Calc( startIdx, endIdx,
+/* Generated */                                  inReal,
+/* Generated */                                  optInTimePeriod, optInFastK_Period, optInFastD_Period, optInFastD_MAType,
+/* Generated */                                  outBegIdx, outNBElement, outFastK, outFastD );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_STOCHRSI, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
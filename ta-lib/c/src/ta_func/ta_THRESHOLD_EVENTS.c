@@ -0,0 +1,364 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  MMDDYY BY     Description
+ *  -------------------------------------------------------------------
+ *  101826 AG     Initial Version
+ */
+
+/**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+/* All code within this section is automatically
+ * generated by gen_code. Any modification will be lost
+ * next time gen_code is run.
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */    #include "TA-Lib-Core.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode::InternalError)
+/* Generated */    namespace TicTacTec { namespace TA { namespace Library {
+/* Generated */ #elif defined( _JAVA )
+/* Generated */    #include "ta_defs.h"
+/* Generated */    #include "ta_java_defs.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode.InternalError)
+/* Generated */ #else
+/* Generated */    #include <string.h>
+/* Generated */    #include <math.h>
+/* Generated */    #include "ta_func.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_UTILITY_H
+/* Generated */    #include "ta_utility.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_MEMORY_H
+/* Generated */    #include "ta_memory.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #define TA_PREFIX(x) TA_##x
+/* Generated */ #define INPUT_TYPE   double
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ int Core::ThresholdEventsLookback( double        optInThreshold )  /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */ 
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public int thresholdEventsLookback( double        optInThreshold )  /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */ 
+/* Generated */ #else
+/* Generated */ TA_LIB_API int TA_THRESHOLD_EVENTS_Lookback( double        optInThreshold )  /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */ 
+/* Generated */ #endif
+/**** END GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */    if( optInThreshold == TA_REAL_DEFAULT )
+/* Generated */       optInThreshold = 0.000000e+0;
+/* Generated */    else if( (optInThreshold < -3.000000e+37) ||/* Generated */  (optInThreshold > 3.000000e+37) )
+/* Generated */       return -1;
+/* Generated */ 
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/**** END GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+
+   /* insert lookback code here. */
+
+   /* The previous value is needed to detect a cross. */
+   return 1;
+}
+
+/**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+/*
+ * TA_THRESHOLD_EVENTS - Crossings of a threshold
+ * 
+ * Input  = double
+ * Output = int
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInThreshold:(From TA_REAL_MIN to TA_REAL_MAX)
+ *    Level crossed by the input
+ * 
+ * 
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::ThresholdEvents( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 SubArray<double>^ inReal,
+/* Generated */                                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                 [Out]int%    outBegIdx,
+/* Generated */                                                 [Out]int%    outNBElement,
+/* Generated */                                                 SubArray<int>^  outInteger )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::ThresholdEvents( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 cli::array<double>^ inReal,
+/* Generated */                                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                 [Out]int%    outBegIdx,
+/* Generated */                                                 [Out]int%    outNBElement,
+/* Generated */                                                 cli::array<int>^  outInteger )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode thresholdEvents( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                 double       inReal[],
+/* Generated */                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                 MInteger     outBegIdx,
+/* Generated */                                 MInteger     outNBElement,
+/* Generated */                                 int           outInteger[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_THRESHOLD_EVENTS_Calc( int    startIdx,
+/* Generated */                                             int    endIdx,
+/* Generated */                                                    const double inReal[],
+/* Generated */                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                    int          *outBegIdx,
+/* Generated */                                                    int          *outNBElement,
+/* Generated */                                                    int           outInteger[] )
+/* Generated */ #endif
+/**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+   int i, outIdx;
+
+/**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */ 
+/* Generated */    /* Validate the requested output range. */
+/* Generated */    if( startIdx < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */    if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    #endif /* !defined(_JAVA)*/
+/* Generated */    if( optInThreshold == TA_REAL_DEFAULT )
+/* Generated */       optInThreshold = 0.000000e+0;
+/* Generated */    else if( (optInThreshold < -3.000000e+37) ||/* Generated */  (optInThreshold > 3.000000e+37) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !outInteger )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #endif /* !defined(_JAVA) */
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/* Generated */ 
+/**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+
+   /* Insert TA function code here. */
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < 1 )
+      startIdx = 1;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* The output is 100 when the input crosses above the
+    * threshold (at or below on the previous bar, above now),
+    * -100 when it crosses below, else 0.
+    *
+    * Same as CROSSOVER/CROSSUNDER, the loop has no branch.
+    */
+   outIdx = 0;
+   for( i=startIdx; i <= endIdx; i++ )
+   {
+      outInteger[outIdx++] = (((inReal[i] > optInThreshold) & (inReal[i-1] <= optInThreshold))? 100 : 0)
+                            -(((inReal[i] < optInThreshold) & (inReal[i-1] >= optInThreshold))? 100 : 0);
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+
+/**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #define  USE_SINGLE_PRECISION_INPUT
+/* Generated */ #undef  TA_LIB_PRO
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    #undef   TA_PREFIX
+/* Generated */    #define  TA_PREFIX(x) TA_S_##x
+/* Generated */ #endif
+/* Generated */ #undef   INPUT_TYPE
+/* Generated */ #define  INPUT_TYPE float
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::ThresholdEvents( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 SubArray<float>^ inReal,
+/* Generated */                                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                 [Out]int%    outBegIdx,
+/* Generated */                                                 [Out]int%    outNBElement,
+/* Generated */                                                 SubArray<int>^  outInteger )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::ThresholdEvents( int    startIdx,
+/* Generated */                                                 int    endIdx,
+/* Generated */                                                 cli::array<float>^ inReal,
+/* Generated */                                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                 [Out]int%    outBegIdx,
+/* Generated */                                                 [Out]int%    outNBElement,
+/* Generated */                                                 cli::array<int>^  outInteger )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode thresholdEvents( int    startIdx,
+/* Generated */                                 int    endIdx,
+/* Generated */                                 float        inReal[],
+/* Generated */                                 double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                 MInteger     outBegIdx,
+/* Generated */                                 MInteger     outNBElement,
+/* Generated */                                 int           outInteger[] )
+/* Generated */ #else
+/* Generated */ static TA_RetCode TA_S_THRESHOLD_EVENTS_Calc( int    startIdx,
+/* Generated */                                               int    endIdx,
+/* Generated */                                                      const float  inReal[],
+/* Generated */                                                      double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                      int          *outBegIdx,
+/* Generated */                                                      int          *outNBElement,
+/* Generated */                                                      int           outInteger[] )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int i, outIdx;
+/* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */     if( startIdx < 0 )
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */     if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */     if( optInThreshold == TA_REAL_DEFAULT )
+/* Generated */        optInThreshold = 0.000000e+0;
+/* Generated */     else if( (optInThreshold < -3.000000e+37) ||  (optInThreshold > 3.000000e+37) )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !outInteger )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */  #endif 
+/* Generated */    if( startIdx < 1 )
+/* Generated */       startIdx = 1;
+/* Generated */    if( startIdx > endIdx )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    outIdx = 0;
+/* Generated */    for( i=startIdx; i <= endIdx; i++ )
+/* Generated */    {
+/* Generated */       outInteger[outIdx++] = (((inReal[i] > optInThreshold) & (inReal[i-1] <= optInThreshold))? 100 : 0)
+/* Generated */                             -(((inReal[i] < optInThreshold) & (inReal[i-1] >= optInThreshold))? 100 : 0);
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_THRESHOLD_EVENTS;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_THRESHOLD_EVENTS( int    startIdx,
+/* Generated */                                            int    endIdx,
+/* Generated */                                                       const double inReal[],
+/* Generated */                                                       double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                       int          *outBegIdx,
+/* Generated */                                                       int          *outNBElement,
+/* Generated */                                                       int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_THRESHOLD_EVENTS_Calc( startIdx, endIdx,
+/* Generated */                                        inReal,
+/* Generated */                                        optInThreshold,
+/* Generated */                                        outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_THRESHOLD_EVENTS_Calc( startIdx, endIdx,
+/* Generated */                                        inReal,
+/* Generated */                                        optInThreshold,
+/* Generated */                                        outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_THRESHOLD_EVENTS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_THRESHOLD_EVENTS( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                                         const float  inReal[],
+/* Generated */                                                         double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+/* Generated */                                                         int          *outBegIdx,
+/* Generated */                                                         int          *outNBElement,
+/* Generated */                                                         int           outInteger[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_THRESHOLD_EVENTS_Calc( startIdx, endIdx,
+/* Generated */                                          inReal,
+/* Generated */                                          optInThreshold,
+/* Generated */                                          outBegIdx, outNBElement, outInteger );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_THRESHOLD_EVENTS_Calc( startIdx, endIdx,
+/* Generated */                                          inReal,
+/* Generated */                                          optInThreshold,
+/* Generated */                                          outBegIdx, outNBElement, outInteger );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_THRESHOLD_EVENTS, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ }}} // Close namespace TicTacTec.TA.Lib
+/* Generated */ #endif
+/**** END GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+
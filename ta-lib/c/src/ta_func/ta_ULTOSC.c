@@ -185,17 +185,17 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_LIB_API TA_RetCode TA_ULTOSC( int    startIdx,
-/* Generated */                                  int    endIdx,
-/* Generated */                                             const double inHigh[],
-/* Generated */                                             const double inLow[],
-/* Generated */                                             const double inClose[],
-/* Generated */                                             int           optInTimePeriod1, /* From 1 to 100000 */
-/* Generated */                                             int           optInTimePeriod2, /* From 1 to 100000 */
-/* Generated */                                             int           optInTimePeriod3, /* From 1 to 100000 */
-/* Generated */                                             int          *outBegIdx,
-/* Generated */                                             int          *outNBElement,
-/* Generated */                                             double        outReal[] )
+/* Generated */ static TA_RetCode TA_ULTOSC_Calc( int    startIdx,
+/* Generated */                                   int    endIdx,
+/* Generated */                                          const double inHigh[],
+/* Generated */                                          const double inLow[],
+/* Generated */                                          const double inClose[],
+/* Generated */                                          int           optInTimePeriod1, /* From 1 to 100000 */
+/* Generated */                                          int           optInTimePeriod2, /* From 1 to 100000 */
+/* Generated */                                          int           optInTimePeriod3, /* From 1 to 100000 */
+/* Generated */                                          int          *outBegIdx,
+/* Generated */                                          int          *outNBElement,
+/* Generated */                                          double        outReal[] )
 /* Generated */ #endif
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
@@ -436,17 +436,17 @@
 /* Generated */                        MInteger     outNBElement,
 /* Generated */                        double        outReal[] )
 /* Generated */ #else
-/* Generated */ TA_RetCode TA_S_ULTOSC( int    startIdx,
-/* Generated */                         int    endIdx,
-/* Generated */                         const float  inHigh[],
-/* Generated */                         const float  inLow[],
-/* Generated */                         const float  inClose[],
-/* Generated */                         int           optInTimePeriod1, /* From 1 to 100000 */
-/* Generated */                         int           optInTimePeriod2, /* From 1 to 100000 */
-/* Generated */                         int           optInTimePeriod3, /* From 1 to 100000 */
-/* Generated */                         int          *outBegIdx,
-/* Generated */                         int          *outNBElement,
-/* Generated */                         double        outReal[] )
+/* Generated */ static TA_RetCode TA_S_ULTOSC_Calc( int    startIdx,
+/* Generated */                                     int    endIdx,
+/* Generated */                                            const float  inHigh[],
+/* Generated */                                            const float  inLow[],
+/* Generated */                                            const float  inClose[],
+/* Generated */                                            int           optInTimePeriod1, /* From 1 to 100000 */
+/* Generated */                                            int           optInTimePeriod2, /* From 1 to 100000 */
+/* Generated */                                            int           optInTimePeriod3, /* From 1 to 100000 */
+/* Generated */                                            int          *outBegIdx,
+/* Generated */                                            int          *outNBElement,
+/* Generated */                                            double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    double a1Total, a2Total, a3Total;
@@ -585,6 +585,70 @@
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ extern struct TA_FuncStats TA_STATS_ULTOSC;
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_ULTOSC( int    startIdx,
+/* Generated */                                  int    endIdx,
+/* Generated */                                             const double inHigh[],
+/* Generated */                                             const double inLow[],
+/* Generated */                                             const double inClose[],
+/* Generated */                                             int           optInTimePeriod1, /* From 1 to 100000 */
+/* Generated */                                             int           optInTimePeriod2, /* From 1 to 100000 */
+/* Generated */                                             int           optInTimePeriod3, /* From 1 to 100000 */
+/* Generated */                                             int          *outBegIdx,
+/* Generated */                                             int          *outNBElement,
+/* Generated */                                             double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_ULTOSC_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow, inClose,
+/* Generated */                              optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_ULTOSC_Calc( startIdx, endIdx,
+/* Generated */                              inHigh, inLow, inClose,
+/* Generated */                              optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+/* Generated */                              outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ULTOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ 
+/* Generated */ TA_LIB_API TA_RetCode TA_S_ULTOSC( int    startIdx,
+/* Generated */                                    int    endIdx,
+/* Generated */                                               const float  inHigh[],
+/* Generated */                                               const float  inLow[],
+/* Generated */                                               const float  inClose[],
+/* Generated */                                               int           optInTimePeriod1, /* From 1 to 100000 */
+/* Generated */                                               int           optInTimePeriod2, /* From 1 to 100000 */
+/* Generated */                                               int           optInTimePeriod3, /* From 1 to 100000 */
+/* Generated */                                               int          *outBegIdx,
+/* Generated */                                               int          *outNBElement,
+/* Generated */                                               double        outReal[] )
+/* Generated */ {
+/* Generated */    TA_StatsCall statsCall;
+/* Generated */    TA_RetCode retCode;
+/* Generated */ 
+/* Generated */    if( !TA_Globals->statsEnabled )
+/* Generated */       return TA_S_ULTOSC_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */ 
+/* Generated */    TA_StatsCallBegin( &statsCall );
+/* Generated */    retCode = TA_S_ULTOSC_Calc( startIdx, endIdx,
+/* Generated */                                inHigh, inLow, inClose,
+/* Generated */                                optInTimePeriod1, optInTimePeriod2, optInTimePeriod3,
+/* Generated */                                outBegIdx, outNBElement, outReal );
+/* Generated */    TA_StatsCallEnd( &TA_STATS_ULTOSC, &statsCall, endIdx-startIdx+1 );
+/* Generated */    return retCode;
+/* Generated */ }
+/* Generated */ #endif
+/* Generated */ 
 /* Generated */ #if defined( _MANAGED )
 /* Generated */ }}} // Close namespace TicTacTec.TA.Lib
 /* Generated */ #endif
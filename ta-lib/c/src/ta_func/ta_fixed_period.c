@@ -0,0 +1,3016 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Important: This file is automatically generated by the utility gen_code.
+ *
+ * Copies of some internal kernels with the period fixed at compile
+ * time. The kernels and periods are listed in 'fixedPeriodKernels'
+ * of gen_code.c.
+ *
+ * The body of each copy is the same text as the original kernel, so
+ * the output is the same. Only the loops depending on the period can
+ * be unrolled or simplified by the compiler.
+ */
+#include <string.h>
+#include <math.h>
+#include "ta_func.h"
+
+/* The copies must not dispatch to themselves. */
+#define TA_FIXED_PERIOD_NO_DISPATCH
+
+#include "ta_utility.h"
+#include "ta_memory.h"
+
+#define TA_PREFIX(x) TA_##x
+#define INPUT_TYPE   double
+
+TA_RetCode TA_PREFIX(INT_SMA_P9)( int    startIdx,
+                                  int    endIdx,
+                                  const INPUT_TYPE *inReal,
+                                  int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                  int     *outBegIdx,
+                                  int     *outNBElement,
+                                  double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 9
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P12)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 12
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P14)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 14
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P20)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 20
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P26)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 26
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P50)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 50
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P200)( int    startIdx,
+                                    int    endIdx,
+                                    const INPUT_TYPE *inReal,
+                                    int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                    int     *outBegIdx,
+                                    int     *outNBElement,
+                                    double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 200
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P9)( int               startIdx,
+                                  int               endIdx,
+                                  const INPUT_TYPE *inReal,
+                                  int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                  double            optInK_1,          /* Ratio for calculation of EMA. */
+                                  int              *outBegIdx,
+                                  int              *outNBElement,
+                                  double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 9
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P12)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 12
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P20)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 20
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P26)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 26
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P50)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 50
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P200)( int               startIdx,
+                                    int               endIdx,
+                                    const INPUT_TYPE *inReal,
+                                    int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                    double            optInK_1,          /* Ratio for calculation of EMA. */
+                                    int              *outBegIdx,
+                                    int              *outNBElement,
+                                    double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 200
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_RSI_P14)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 2 to 100000 */
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   int outIdx;
+   int today, lookbackTotal, unstablePeriod, i;
+   double prevGain, prevLoss, prevValue, savePrevValue;
+   double tempValue1, tempValue2;
+   #if defined( USE_SINGLE_PRECISION_INPUT )
+        ARRAY_MEMMOVEMIX_VAR;
+   #endif
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 14
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_RSI_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* The following algorithm is base on the original 
+    * work from Wilder's and shall represent the
+    * original idea behind the classic RSI.
+    *
+    * Metastock is starting the calculation one price
+    * bar earlier. To make this possible, they assume
+    * that the very first bar will be identical to the
+    * previous one (no gain or loss).
+    */
+
+   /* If changing this function, please check also CMO 
+    * which is mostly identical (just different in one step 
+    * of calculation).
+    */
+
+   VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+   VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+   
+   /* Adjust startIdx to account for the lookback period. */
+   lookbackTotal = LOOKBACK_CALL(RSI)( optInTimePeriod );
+
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+
+   outIdx = 0; /* Index into the output. */
+
+   /* Trap special case where the period is '1'.
+    * In that case, just copy the input into the
+    * output for the requested range (as-is !)
+    */
+   if( optInTimePeriod == 1 )
+   {
+      VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+      i = (endIdx-startIdx)+1;
+      VALUE_HANDLE_DEREF(outNBElement) = i;
+      #if defined( USE_SINGLE_PRECISION_INPUT )
+        ARRAY_MEMMOVEMIX( outReal, 0, inReal, startIdx, i );
+      #else
+        ARRAY_MEMMOVE( outReal, 0, inReal, startIdx, i );
+      #endif
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Accumulate Wilder's "Average Gain" and "Average Loss" 
+    * among the initial period.
+    */
+   today = startIdx-lookbackTotal;
+   prevValue = inReal[today];
+
+   unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi);
+
+   /* If there is no unstable period,
+    * calculate the 'additional' initial
+    * price bar who is particuliar to
+    * metastock.
+    * If there is an unstable period,
+    * no need to calculate since this
+    * first value will be surely skip.
+    */
+   if( (unstablePeriod == 0) && 
+       (TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_METASTOCK,Metastock)))
+   {
+      /* Preserve prevValue because it may get 
+       * overwritten by the output.
+       *(because output ptr could be the same as input ptr).
+       */
+      savePrevValue = prevValue;
+
+      /* No unstable period, so must calculate first output
+       * particular to Metastock.
+       * (Metastock re-use the first price bar, so there
+       *  is no loss/gain at first. Beats me why they
+       *  are doing all this).
+       */
+      prevGain = 0.0;
+      prevLoss = 0.0;
+      for( i=optInTimePeriod; i > 0; i-- )
+      {
+         tempValue1 = inReal[today++];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+      }
+
+
+      tempValue1 = prevLoss/optInTimePeriod;
+      tempValue2 = prevGain/optInTimePeriod;
+
+      /* Write the output. */
+      tempValue1 = tempValue2+tempValue1;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100*(tempValue2/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+
+      /* Are we done? */
+      if( today > endIdx )
+      {
+         VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+         VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+         return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+      }
+
+      /* Start over for the next price bar. */
+      today -= optInTimePeriod;
+      prevValue = savePrevValue;
+   }
+
+
+   /* Remaining of the processing is identical
+    * for both Classic calculation and Metastock.
+    */
+   prevGain = 0.0;
+   prevLoss = 0.0;
+   today++;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+   }
+
+   
+   /* Subsequent prevLoss and prevGain are smoothed
+    * using the previous values (Wilder's approach).
+    *  1) Multiply the previous by 'period-1'. 
+    *  2) Add today value.
+    *  3) Divide by 'period'.
+    */
+   prevLoss /= optInTimePeriod;
+   prevGain /= optInTimePeriod;
+
+   /* Often documentation present the RSI calculation as follow:
+    *    RSI = 100 - (100 / 1 + (prevGain/prevLoss))
+    *
+    * The following is equivalent:
+    *    RSI = 100 * (prevGain/(prevGain+prevLoss))
+    *
+    * The second equation is used here for speed optimization.
+    */
+   if( today > startIdx )
+   {
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+   else
+   {
+      /* Skip the unstable period. Do the processing 
+       * but do not write it in the output.
+       */   
+      while( today < startIdx )
+      {
+         tempValue1 = inReal[today];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+
+         prevLoss *= (optInTimePeriod-1);
+         prevGain *= (optInTimePeriod-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+
+         prevLoss /= optInTimePeriod;
+         prevGain /= optInTimePeriod;
+
+         today++;
+      }
+   }
+
+   /* Unstable period skipped... now continue
+    * processing if needed.
+    */
+   while( today <= endIdx )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+
+      prevLoss *= (optInTimePeriod-1);
+      prevGain *= (optInTimePeriod-1);
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+
+      prevLoss /= optInTimePeriod;
+      prevGain /= optInTimePeriod;
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+#define  USE_SINGLE_PRECISION_INPUT
+#undef   TA_PREFIX
+#define  TA_PREFIX(x) TA_S_##x
+#undef   INPUT_TYPE
+#define  INPUT_TYPE float
+
+TA_RetCode TA_PREFIX(INT_SMA_P9)( int    startIdx,
+                                  int    endIdx,
+                                  const INPUT_TYPE *inReal,
+                                  int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                  int     *outBegIdx,
+                                  int     *outNBElement,
+                                  double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 9
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P12)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 12
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P14)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 14
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P20)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 20
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P26)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 26
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P50)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 50
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_SMA_P200)( int    startIdx,
+                                    int    endIdx,
+                                    const INPUT_TYPE *inReal,
+                                    int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */                       
+                                    int     *outBegIdx,
+                                    int     *outNBElement,
+                                    double  *outReal )
+{
+   double periodTotal, tempReal;
+   int i, outIdx, trailingIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 200
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_SMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = (optInTimePeriod-1);
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Do the MA calculation using tight loops. */
+   /* Add-up the initial period, except for the last value. */
+   periodTotal = 0;
+   trailingIdx = startIdx-lookbackTotal;
+   
+   i=trailingIdx;
+   if( optInTimePeriod > 1 )
+   {
+      while( i < startIdx )
+         periodTotal += inReal[i++];
+   }
+
+   /* Proceed with the calculation for the requested range.
+    * Note that this algorithm allows the inReal and
+    * outReal to be the same buffer.
+    */
+   outIdx = 0;
+   do
+   {
+      periodTotal += inReal[i++];
+      tempReal = periodTotal;
+      periodTotal -= inReal[trailingIdx++];
+      outReal[outIdx++] = tempReal / optInTimePeriod;
+   } while( i <= endIdx );
+
+   /* All done. Indicate the output limits and return. */
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+   VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P9)( int               startIdx,
+                                  int               endIdx,
+                                  const INPUT_TYPE *inReal,
+                                  int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                  double            optInK_1,          /* Ratio for calculation of EMA. */
+                                  int              *outBegIdx,
+                                  int              *outNBElement,
+                                  double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 9
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P12)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 12
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P20)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 20
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P26)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 26
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P50)( int               startIdx,
+                                   int               endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                   double            optInK_1,          /* Ratio for calculation of EMA. */
+                                   int              *outBegIdx,
+                                   int              *outNBElement,
+                                   double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 50
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_EMA_P200)( int               startIdx,
+                                    int               endIdx,
+                                    const INPUT_TYPE *inReal,
+                                    int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                                    double            optInK_1,          /* Ratio for calculation of EMA. */
+                                    int              *outBegIdx,
+                                    int              *outNBElement,
+                                    double           *outReal )
+{
+   double tempReal, prevMA;
+   int i, today, outIdx, lookbackTotal;
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 200
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_EMA_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod, optInK_1,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* Ususally, optInK_1 = 2 / (optInTimePeriod + 1),
+    * but sometime there is exception. This
+    * is why both value are parameters.
+    */
+
+   /* Identify the minimum number of price bar needed
+    * to calculate at least one output.
+    */
+   lookbackTotal = LOOKBACK_CALL(EMA)( optInTimePeriod );
+
+   /* Move up the start index if there is not
+    * enough initial data.
+    */
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+
+   /* Do the EMA calculation using tight loops. */
+   
+   /* The first EMA is calculated differently. It
+    * then become the seed for subsequent EMA.
+    *
+    * The algorithm for this seed vary widely.
+    * Only 3 are implemented here:
+    *
+    * TA_MA_CLASSIC:
+    *    Use a simple MA of the first 'period'.
+    *    This is the approach most widely documented.
+    *
+    * TA_MA_METASTOCK:
+    *    Use first price bar value as a seed
+    *    from the begining of all the available
+    *    data.
+    *
+    * TA_MA_TRADESTATION:
+    *    Use 4th price bar as a seed, except when
+    *    period is 1 who use 2th price bar or something
+    *    like that... (not an obvious one...).
+    */
+   if( TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_DEFAULT,Default) )
+   {
+      today = startIdx-lookbackTotal;
+      i = optInTimePeriod;
+      tempReal = 0.0;
+      while( i-- > 0 )
+         tempReal += inReal[today++];
+
+      prevMA = tempReal / optInTimePeriod;
+   }
+   else
+   {
+      prevMA = inReal[0];
+      today = 1;
+
+      /* !!! Tradestation not supported yet.
+      case TA_MA_TRADESTATION:
+         prevMA = inReal[startIdx-1];
+         if( optInTimePeriod == 1 )
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 1;
+         else
+            VALUE_HANDLE_DEREF(outBegIdx)_0 = 3;
+       */
+   }
+
+   /* At this point, prevMA is the first EMA (the seed for
+    * the rest).
+    * 'today' keep track of where the processing is within the
+    * input.
+    */
+
+   /* Skip the unstable period. Do the processing 
+    * but do not write it in the output.
+    */   
+   while( today <= startIdx )
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+
+   /* Write the first value. */
+   outReal[0] = prevMA;
+   outIdx = 1;
+
+   /* Calculate the remaining range. */
+   while( today <= endIdx )
+   {
+      prevMA = ((inReal[today++]-prevMA)*optInK_1) + prevMA;
+      outReal[outIdx++] = prevMA;
+   }
+
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
+TA_RetCode TA_PREFIX(INT_RSI_P14)( int    startIdx,
+                                   int    endIdx,
+                                   const INPUT_TYPE *inReal,
+                                   int      optInTimePeriod, /* From 2 to 100000 */
+                                   int     *outBegIdx,
+                                   int     *outNBElement,
+                                   double  *outReal )
+{
+   int outIdx;
+   int today, lookbackTotal, unstablePeriod, i;
+   double prevGain, prevLoss, prevValue, savePrevValue;
+   double tempValue1, tempValue2;
+   #if defined( USE_SINGLE_PRECISION_INPUT )
+        ARRAY_MEMMOVEMIX_VAR;
+   #endif
+
+   (void)optInTimePeriod;
+#define optInTimePeriod 14
+
+   /* Use the copy specialized for this period, if any. */
+   #if !defined( _MANAGED ) && !defined( _JAVA )
+   TA_INT_RSI_FIXED_PERIOD(( startIdx, endIdx, inReal, optInTimePeriod,
+                             outBegIdx, outNBElement, outReal ))
+   #endif
+
+   /* The following algorithm is base on the original 
+    * work from Wilder's and shall represent the
+    * original idea behind the classic RSI.
+    *
+    * Metastock is starting the calculation one price
+    * bar earlier. To make this possible, they assume
+    * that the very first bar will be identical to the
+    * previous one (no gain or loss).
+    */
+
+   /* If changing this function, please check also CMO 
+    * which is mostly identical (just different in one step 
+    * of calculation).
+    */
+
+   VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+   VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+   
+   /* Adjust startIdx to account for the lookback period. */
+   lookbackTotal = LOOKBACK_CALL(RSI)( optInTimePeriod );
+
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+
+   outIdx = 0; /* Index into the output. */
+
+   /* Trap special case where the period is '1'.
+    * In that case, just copy the input into the
+    * output for the requested range (as-is !)
+    */
+   if( optInTimePeriod == 1 )
+   {
+      VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+      i = (endIdx-startIdx)+1;
+      VALUE_HANDLE_DEREF(outNBElement) = i;
+      #if defined( USE_SINGLE_PRECISION_INPUT )
+        ARRAY_MEMMOVEMIX( outReal, 0, inReal, startIdx, i );
+      #else
+        ARRAY_MEMMOVE( outReal, 0, inReal, startIdx, i );
+      #endif
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   /* Accumulate Wilder's "Average Gain" and "Average Loss" 
+    * among the initial period.
+    */
+   today = startIdx-lookbackTotal;
+   prevValue = inReal[today];
+
+   unstablePeriod = TA_GLOBALS_UNSTABLE_PERIOD(TA_FUNC_UNST_RSI,Rsi);
+
+   /* If there is no unstable period,
+    * calculate the 'additional' initial
+    * price bar who is particuliar to
+    * metastock.
+    * If there is an unstable period,
+    * no need to calculate since this
+    * first value will be surely skip.
+    */
+   if( (unstablePeriod == 0) && 
+       (TA_GLOBALS_COMPATIBILITY == ENUM_VALUE(Compatibility,TA_COMPATIBILITY_METASTOCK,Metastock)))
+   {
+      /* Preserve prevValue because it may get 
+       * overwritten by the output.
+       *(because output ptr could be the same as input ptr).
+       */
+      savePrevValue = prevValue;
+
+      /* No unstable period, so must calculate first output
+       * particular to Metastock.
+       * (Metastock re-use the first price bar, so there
+       *  is no loss/gain at first. Beats me why they
+       *  are doing all this).
+       */
+      prevGain = 0.0;
+      prevLoss = 0.0;
+      for( i=optInTimePeriod; i > 0; i-- )
+      {
+         tempValue1 = inReal[today++];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+      }
+
+
+      tempValue1 = prevLoss/optInTimePeriod;
+      tempValue2 = prevGain/optInTimePeriod;
+
+      /* Write the output. */
+      tempValue1 = tempValue2+tempValue1;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100*(tempValue2/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+
+      /* Are we done? */
+      if( today > endIdx )
+      {
+         VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+         VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+         return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+      }
+
+      /* Start over for the next price bar. */
+      today -= optInTimePeriod;
+      prevValue = savePrevValue;
+   }
+
+
+   /* Remaining of the processing is identical
+    * for both Classic calculation and Metastock.
+    */
+   prevGain = 0.0;
+   prevLoss = 0.0;
+   today++;
+   for( i=optInTimePeriod; i > 0; i-- )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+   }
+
+   
+   /* Subsequent prevLoss and prevGain are smoothed
+    * using the previous values (Wilder's approach).
+    *  1) Multiply the previous by 'period-1'. 
+    *  2) Add today value.
+    *  3) Divide by 'period'.
+    */
+   prevLoss /= optInTimePeriod;
+   prevGain /= optInTimePeriod;
+
+   /* Often documentation present the RSI calculation as follow:
+    *    RSI = 100 - (100 / 1 + (prevGain/prevLoss))
+    *
+    * The following is equivalent:
+    *    RSI = 100 * (prevGain/(prevGain+prevLoss))
+    *
+    * The second equation is used here for speed optimization.
+    */
+   if( today > startIdx )
+   {
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+   else
+   {
+      /* Skip the unstable period. Do the processing 
+       * but do not write it in the output.
+       */   
+      while( today < startIdx )
+      {
+         tempValue1 = inReal[today];
+         tempValue2 = tempValue1 - prevValue;
+         prevValue  = tempValue1;
+
+         prevLoss *= (optInTimePeriod-1);
+         prevGain *= (optInTimePeriod-1);
+         if( tempValue2 < 0 )
+            prevLoss -= tempValue2;
+         else
+            prevGain += tempValue2;
+
+         prevLoss /= optInTimePeriod;
+         prevGain /= optInTimePeriod;
+
+         today++;
+      }
+   }
+
+   /* Unstable period skipped... now continue
+    * processing if needed.
+    */
+   while( today <= endIdx )
+   {
+      tempValue1 = inReal[today++];
+      tempValue2 = tempValue1 - prevValue;
+      prevValue  = tempValue1;
+
+      prevLoss *= (optInTimePeriod-1);
+      prevGain *= (optInTimePeriod-1);
+      if( tempValue2 < 0 )
+         prevLoss -= tempValue2;
+      else
+         prevGain += tempValue2;
+
+      prevLoss /= optInTimePeriod;
+      prevGain /= optInTimePeriod;
+      tempValue1 = prevGain+prevLoss;
+      if( !TA_IS_ZERO(tempValue1) )
+         outReal[outIdx++] = 100.0*(prevGain/tempValue1);
+      else
+         outReal[outIdx++] = 0.0;
+   }
+
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+#undef optInTimePeriod
+
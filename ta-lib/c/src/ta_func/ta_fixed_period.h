@@ -0,0 +1,322 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Important: This file is automatically generated by the utility gen_code.
+ *
+ * Internal kernels specialized for the most used periods (see
+ * ta_fixed_period.c).
+ *
+ * TA_XXX_FIXED_PERIOD is used at the start of the kernel XXX. When
+ * optInTimePeriod has a specialized copy, the copy is called with the
+ * same parameters and its return value is returned. Else nothing is
+ * done and the kernel continues with the original calculation.
+ */
+#ifndef TA_FIXED_PERIOD_H
+#define TA_FIXED_PERIOD_H
+
+#ifndef TA_DEFS_H
+   #include "ta_defs.h"
+#endif
+
+TA_RetCode TA_INT_SMA_P9( int    startIdx,
+                          int    endIdx,
+                          const double *inReal,
+                          int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                          int     *outBegIdx,
+                          int     *outNBElement,
+                          double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P9( int    startIdx,
+                            int    endIdx,
+                            const float *inReal,
+                            int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                            int     *outBegIdx,
+                            int     *outNBElement,
+                            double  *outReal );
+
+TA_RetCode TA_INT_SMA_P12( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P12( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+TA_RetCode TA_INT_SMA_P14( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P14( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+TA_RetCode TA_INT_SMA_P20( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P20( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+TA_RetCode TA_INT_SMA_P26( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P26( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+TA_RetCode TA_INT_SMA_P50( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P50( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+TA_RetCode TA_INT_SMA_P200( int    startIdx,
+                            int    endIdx,
+                            const double *inReal,
+                            int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                            int     *outBegIdx,
+                            int     *outNBElement,
+                            double  *outReal );
+
+TA_RetCode TA_S_INT_SMA_P200( int    startIdx,
+                              int    endIdx,
+                              const float *inReal,
+                              int      optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                              int     *outBegIdx,
+                              int     *outNBElement,
+                              double  *outReal );
+
+TA_RetCode TA_INT_EMA_P9( int               startIdx,
+                          int               endIdx,
+                          const double *inReal,
+                          int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                          double            optInK_1,          /* Ratio for calculation of EMA. */
+                          int              *outBegIdx,
+                          int              *outNBElement,
+                          double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P9( int               startIdx,
+                            int               endIdx,
+                            const float *inReal,
+                            int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                            double            optInK_1,          /* Ratio for calculation of EMA. */
+                            int              *outBegIdx,
+                            int              *outNBElement,
+                            double           *outReal );
+
+TA_RetCode TA_INT_EMA_P12( int               startIdx,
+                           int               endIdx,
+                           const double *inReal,
+                           int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           double            optInK_1,          /* Ratio for calculation of EMA. */
+                           int              *outBegIdx,
+                           int              *outNBElement,
+                           double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P12( int               startIdx,
+                             int               endIdx,
+                             const float *inReal,
+                             int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             double            optInK_1,          /* Ratio for calculation of EMA. */
+                             int              *outBegIdx,
+                             int              *outNBElement,
+                             double           *outReal );
+
+TA_RetCode TA_INT_EMA_P20( int               startIdx,
+                           int               endIdx,
+                           const double *inReal,
+                           int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           double            optInK_1,          /* Ratio for calculation of EMA. */
+                           int              *outBegIdx,
+                           int              *outNBElement,
+                           double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P20( int               startIdx,
+                             int               endIdx,
+                             const float *inReal,
+                             int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             double            optInK_1,          /* Ratio for calculation of EMA. */
+                             int              *outBegIdx,
+                             int              *outNBElement,
+                             double           *outReal );
+
+TA_RetCode TA_INT_EMA_P26( int               startIdx,
+                           int               endIdx,
+                           const double *inReal,
+                           int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           double            optInK_1,          /* Ratio for calculation of EMA. */
+                           int              *outBegIdx,
+                           int              *outNBElement,
+                           double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P26( int               startIdx,
+                             int               endIdx,
+                             const float *inReal,
+                             int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             double            optInK_1,          /* Ratio for calculation of EMA. */
+                             int              *outBegIdx,
+                             int              *outNBElement,
+                             double           *outReal );
+
+TA_RetCode TA_INT_EMA_P50( int               startIdx,
+                           int               endIdx,
+                           const double *inReal,
+                           int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                           double            optInK_1,          /* Ratio for calculation of EMA. */
+                           int              *outBegIdx,
+                           int              *outNBElement,
+                           double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P50( int               startIdx,
+                             int               endIdx,
+                             const float *inReal,
+                             int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                             double            optInK_1,          /* Ratio for calculation of EMA. */
+                             int              *outBegIdx,
+                             int              *outNBElement,
+                             double           *outReal );
+
+TA_RetCode TA_INT_EMA_P200( int               startIdx,
+                            int               endIdx,
+                            const double *inReal,
+                            int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                            double            optInK_1,          /* Ratio for calculation of EMA. */
+                            int              *outBegIdx,
+                            int              *outNBElement,
+                            double           *outReal );
+
+TA_RetCode TA_S_INT_EMA_P200( int               startIdx,
+                              int               endIdx,
+                              const float *inReal,
+                              int               optInTimePeriod, /* From 1 to TA_INTEGER_MAX */
+                              double            optInK_1,          /* Ratio for calculation of EMA. */
+                              int              *outBegIdx,
+                              int              *outNBElement,
+                              double           *outReal );
+
+TA_RetCode TA_INT_RSI_P14( int    startIdx,
+                           int    endIdx,
+                           const double *inReal,
+                           int      optInTimePeriod, /* From 2 to 100000 */
+                           int     *outBegIdx,
+                           int     *outNBElement,
+                           double  *outReal );
+
+TA_RetCode TA_S_INT_RSI_P14( int    startIdx,
+                             int    endIdx,
+                             const float *inReal,
+                             int      optInTimePeriod, /* From 2 to 100000 */
+                             int     *outBegIdx,
+                             int     *outNBElement,
+                             double  *outReal );
+
+#if defined( TA_FIXED_PERIOD_NO_DISPATCH )
+   #define TA_INT_SMA_FIXED_PERIOD(args)
+   #define TA_INT_EMA_FIXED_PERIOD(args)
+   #define TA_INT_RSI_FIXED_PERIOD(args)
+#else
+   #define TA_INT_SMA_FIXED_PERIOD(args) \
+   switch( optInTimePeriod ) \
+   { \
+   case 9:   return TA_PREFIX(INT_SMA_P9) args; \
+   case 12:  return TA_PREFIX(INT_SMA_P12) args; \
+   case 14:  return TA_PREFIX(INT_SMA_P14) args; \
+   case 20:  return TA_PREFIX(INT_SMA_P20) args; \
+   case 26:  return TA_PREFIX(INT_SMA_P26) args; \
+   case 50:  return TA_PREFIX(INT_SMA_P50) args; \
+   case 200: return TA_PREFIX(INT_SMA_P200) args; \
+   default:  break; \
+   }
+   #define TA_INT_EMA_FIXED_PERIOD(args) \
+   switch( optInTimePeriod ) \
+   { \
+   case 9:   return TA_PREFIX(INT_EMA_P9) args; \
+   case 12:  return TA_PREFIX(INT_EMA_P12) args; \
+   case 20:  return TA_PREFIX(INT_EMA_P20) args; \
+   case 26:  return TA_PREFIX(INT_EMA_P26) args; \
+   case 50:  return TA_PREFIX(INT_EMA_P50) args; \
+   case 200: return TA_PREFIX(INT_EMA_P200) args; \
+   default:  break; \
+   }
+   #define TA_INT_RSI_FIXED_PERIOD(args) \
+   switch( optInTimePeriod ) \
+   { \
+   case 14:  return TA_PREFIX(INT_RSI_P14) args; \
+   default:  break; \
+   }
+#endif
+#endif
@@ -0,0 +1,2764 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Important: This file is automatically generated by the utility gen_code.
+ *
+ * Sine and cosine tables used by the dominant cycle phase of HT_DCPHASE,
+ * HT_SINE and HT_TRENDMODE (see DO_HT_DFT in ta_utility.h).
+ *
+ * For each period from 1 to TA_HT_DFT_MAX_PERIOD, the row of the period
+ * starts at 'period*(period-1)/2' and has the sine and cosine of
+ * 'i*360/period' degrees for i from 0 to period-1. The values are the
+ * same as calculated by the original loop, so the output of these
+ * functions is unchanged.
+ */
+#include <math.h>
+#include "ta_utility.h"
+
+static const double TA_HTDFTSin[TA_HT_DFT_TABLE_SIZE] = {
+   /* Period 1 */
+   0,
+   /* Period 2 */
+   0,
+   1.2246467991473532e-16,
+   /* Period 3 */
+   0,
+   0.86602540378443871,
+   -0.86602540378443837,
+   /* Period 4 */
+   0,
+   1,
+   1.2246467991473532e-16,
+   -1,
+   /* Period 5 */
+   0,
+   0.95105651629515353,
+   0.58778525229247325,
+   -0.58778525229247303,
+   -0.95105651629515364,
+   /* Period 6 */
+   0,
+   0.8660254037844386,
+   0.86602540378443871,
+   1.2246467991473532e-16,
+   -0.86602540378443837,
+   -0.8660254037844386,
+   /* Period 7 */
+   0,
+   0.7818314824680298,
+   0.97492791218182362,
+   0.43388373911755823,
+   -0.43388373911755801,
+   -0.97492791218182362,
+   -0.78183148246802991,
+   /* Period 8 */
+   0,
+   0.70710678118654746,
+   1,
+   0.70710678118654757,
+   1.2246467991473532e-16,
+   -0.70710678118654746,
+   -1,
+   -0.70710678118654768,
+   /* Period 9 */
+   0,
+   0.64278760968653925,
+   0.98480775301220802,
+   0.86602540378443871,
+   0.34202014332566888,
+   -0.34202014332566866,
+   -0.86602540378443837,
+   -0.98480775301220813,
+   -0.64278760968653958,
+   /* Period 10 */
+   0,
+   0.58778525229247314,
+   0.95105651629515353,
+   0.95105651629515364,
+   0.58778525229247325,
+   1.2246467991473532e-16,
+   -0.58778525229247303,
+   -0.95105651629515353,
+   -0.95105651629515364,
+   -0.58778525229247336,
+   /* Period 11 */
+   0,
+   0.54064081745559756,
+   0.90963199535451833,
+   0.9898214418809328,
+   0.75574957435425827,
+   0.28173255684142967,
+   -0.28173255684142939,
+   -0.75574957435425816,
+   -0.98982144188093268,
+   -0.90963199535451855,
+   -0.54064081745559744,
+   /* Period 12 */
+   0,
+   0.49999999999999994,
+   0.8660254037844386,
+   1,
+   0.86602540378443871,
+   0.49999999999999994,
+   1.2246467991473532e-16,
+   -0.49999999999999972,
+   -0.86602540378443837,
+   -1,
+   -0.8660254037844386,
+   -0.50000000000000044,
+   /* Period 13 */
+   0,
+   0.46472317204376851,
+   0.82298386589365635,
+   0.99270887409805397,
+   0.93501624268541483,
+   0.66312265824079519,
+   0.23931566428755768,
+   -0.23931566428755743,
+   -0.66312265824079497,
+   -0.93501624268541472,
+   -0.99270887409805397,
+   -0.82298386589365702,
+   -0.4647231720437684,
+   /* Period 14 */
+   0,
+   0.43388373911755812,
+   0.7818314824680298,
+   0.97492791218182362,
+   0.97492791218182362,
+   0.78183148246802991,
+   0.43388373911755823,
+   1.2246467991473532e-16,
+   -0.43388373911755801,
+   -0.78183148246802969,
+   -0.97492791218182362,
+   -0.97492791218182384,
+   -0.78183148246802991,
+   -0.43388373911755751,
+   /* Period 15 */
+   0,
+   0.40673664307580015,
+   0.74314482547739413,
+   0.95105651629515353,
+   0.9945218953682734,
+   0.86602540378443871,
+   0.58778525229247325,
+   0.20791169081775931,
+   -0.20791169081775907,
+   -0.58778525229247303,
+   -0.86602540378443837,
+   -0.99452189536827329,
+   -0.95105651629515364,
+   -0.74314482547739402,
+   -0.40673664307580015,
+   /* Period 16 */
+   0,
+   0.38268343236508978,
+   0.70710678118654746,
+   0.92387953251128674,
+   1,
+   0.92387953251128674,
+   0.70710678118654757,
+   0.38268343236508989,
+   1.2246467991473532e-16,
+   -0.38268343236508967,
+   -0.70710678118654746,
+   -0.92387953251128652,
+   -1,
+   -0.92387953251128663,
+   -0.70710678118654768,
+   -0.38268343236509039,
+   /* Period 17 */
+   0,
+   0.36124166618715292,
+   0.67369564364655721,
+   0.89516329135506234,
+   0.99573417629503447,
+   0.96182564317281904,
+   0.7980172272802396,
+   0.52643216287735606,
+   0.18374951781657037,
+   -0.18374951781657012,
+   -0.52643216287735584,
+   -0.79801722728023894,
+   -0.96182564317281904,
+   -0.99573417629503447,
+   -0.89516329135506256,
+   -0.67369564364655776,
+   -0.36124166618715303,
+   /* Period 18 */
+   0,
+   0.34202014332566871,
+   0.64278760968653925,
+   0.8660254037844386,
+   0.98480775301220802,
+   0.98480775301220802,
+   0.86602540378443871,
+   0.64278760968653947,
+   0.34202014332566888,
+   1.2246467991473532e-16,
+   -0.34202014332566866,
+   -0.64278760968653892,
+   -0.86602540378443837,
+   -0.98480775301220802,
+   -0.98480775301220813,
+   -0.86602540378443904,
+   -0.64278760968653958,
+   -0.3420201433256686,
+   /* Period 19 */
+   0,
+   0.32469946920468346,
+   0.61421271268966782,
+   0.83716647826252855,
+   0.96940026593933037,
+   0.99658449300666985,
+   0.9157733266550574,
+   0.73572391067313181,
+   0.47594739303707367,
+   0.16459459028073403,
+   -0.16459459028073378,
+   -0.47594739303707312,
+   -0.73572391067313159,
+   -0.91577332665505762,
+   -0.99658449300666985,
+   -0.96940026593933049,
+   -0.83716647826252877,
+   -0.61421271268966737,
+   -0.32469946920468373,
+   /* Period 20 */
+   0,
+   0.3090169943749474,
+   0.58778525229247314,
+   0.80901699437494745,
+   0.95105651629515353,
+   1,
+   0.95105651629515364,
+   0.80901699437494745,
+   0.58778525229247325,
+   0.30901699437494751,
+   1.2246467991473532e-16,
+   -0.3090169943749469,
+   -0.58778525229247303,
+   -0.80901699437494734,
+   -0.95105651629515353,
+   -1,
+   -0.95105651629515364,
+   -0.80901699437494756,
+   -0.58778525229247336,
+   -0.30901699437494762,
+   /* Period 21 */
+   0,
+   0.29475517441090421,
+   0.56332005806362206,
+   0.7818314824680298,
+   0.93087374864420425,
+   0.99720379718118013,
+   0.97492791218182362,
+   0.86602540378443871,
+   0.68017273777091936,
+   0.43388373911755823,
+   0.14904226617617472,
+   -0.14904226617617403,
+   -0.43388373911755801,
+   -0.68017273777091947,
+   -0.86602540378443837,
+   -0.97492791218182362,
+   -0.99720379718118013,
+   -0.93087374864420414,
+   -0.78183148246802991,
+   -0.56332005806362273,
+   -0.29475517441090471,
+   /* Period 22 */
+   0,
+   0.28173255684142967,
+   0.54064081745559756,
+   0.75574957435425827,
+   0.90963199535451833,
+   0.98982144188093268,
+   0.9898214418809328,
+   0.90963199535451844,
+   0.75574957435425827,
+   0.54064081745559778,
+   0.28173255684142967,
+   5.6655388976479796e-16,
+   -0.28173255684142939,
+   -0.54064081745559756,
+   -0.75574957435425816,
+   -0.909631995354518,
+   -0.98982144188093268,
+   -0.9898214418809328,
+   -0.90963199535451855,
+   -0.75574957435425871,
+   -0.54064081745559744,
+   -0.28173255684142978,
+   /* Period 23 */
+   0,
+   0.26979677115702427,
+   0.51958395003543356,
+   0.73083596427812403,
+   0.88788521840237522,
+   0.97908408768232291,
+   0.99766876919053915,
+   0.94226092211882051,
+   0.81696989301044209,
+   0.63108794432605297,
+   0.3984010898462414,
+   0.13616664909624709,
+   -0.1361666490962464,
+   -0.39840108984624156,
+   -0.63108794432605275,
+   -0.81696989301044198,
+   -0.9422609221188204,
+   -0.99766876919053926,
+   -0.97908408768232302,
+   -0.88788521840237555,
+   -0.73083596427812403,
+   -0.51958395003543356,
+   -0.26979677115702522,
+   /* Period 24 */
+   0,
+   0.25881904510252074,
+   0.49999999999999994,
+   0.70710678118654746,
+   0.8660254037844386,
+   0.96592582628906831,
+   1,
+   0.96592582628906831,
+   0.86602540378443871,
+   0.70710678118654757,
+   0.49999999999999994,
+   0.25881904510252102,
+   1.2246467991473532e-16,
+   -0.25881904510252079,
+   -0.49999999999999972,
+   -0.70710678118654713,
+   -0.86602540378443837,
+   -0.96592582628906831,
+   -1,
+   -0.96592582628906842,
+   -0.8660254037844386,
+   -0.70710678118654768,
+   -0.50000000000000044,
+   -0.25881904510252157,
+   /* Period 25 */
+   0,
+   0.24868988716485479,
+   0.48175367410171532,
+   0.68454710592868862,
+   0.84432792550201508,
+   0.95105651629515353,
+   0.99802672842827156,
+   0.98228725072868872,
+   0.90482705246601947,
+   0.77051324277578925,
+   0.58778525229247325,
+   0.36812455268467814,
+   0.12533323356430454,
+   -0.12533323356430429,
+   -0.36812455268467792,
+   -0.58778525229247269,
+   -0.77051324277578936,
+   -0.9048270524660198,
+   -0.98228725072868872,
+   -0.99802672842827156,
+   -0.95105651629515364,
+   -0.84432792550201496,
+   -0.68454710592868895,
+   -0.4817536741017161,
+   -0.24868988716485535,
+   /* Period 26 */
+   0,
+   0.23931566428755774,
+   0.46472317204376851,
+   0.66312265824079519,
+   0.82298386589365635,
+   0.93501624268541483,
+   0.99270887409805397,
+   0.99270887409805397,
+   0.93501624268541483,
+   0.82298386589365646,
+   0.66312265824079519,
+   0.46472317204376906,
+   0.23931566428755768,
+   -3.2162452993532732e-16,
+   -0.23931566428755743,
+   -0.46472317204376806,
+   -0.66312265824079497,
+   -0.82298386589365635,
+   -0.93501624268541472,
+   -0.99270887409805397,
+   -0.99270887409805397,
+   -0.93501624268541483,
+   -0.82298386589365702,
+   -0.66312265824079553,
+   -0.4647231720437684,
+   -0.23931566428755779,
+   /* Period 27 */
+   0,
+   0.23061587074244017,
+   0.44879918020046217,
+   0.64278760968653925,
+   0.80212319275504373,
+   0.918216106880274,
+   0.98480775301220802,
+   0.99830815827126818,
+   0.9579895123154889,
+   0.86602540378443871,
+   0.72737364157304885,
+   0.54950897807080623,
+   0.34202014332566888,
+   0.11609291412522993,
+   -0.11609291412523012,
+   -0.34202014332566821,
+   -0.54950897807080601,
+   -0.72737364157304862,
+   -0.86602540378443837,
+   -0.95798951231548879,
+   -0.99830815827126818,
+   -0.98480775301220802,
+   -0.91821610688027411,
+   -0.80212319275504396,
+   -0.64278760968653958,
+   -0.44879918020046244,
+   -0.23061587074243958,
+   /* Period 28 */
+   0,
+   0.22252093395631439,
+   0.43388373911755812,
+   0.62348980185873348,
+   0.7818314824680298,
+   0.90096886790241915,
+   0.97492791218182362,
+   1,
+   0.97492791218182362,
+   0.90096886790241915,
+   0.78183148246802991,
+   0.62348980185873393,
+   0.43388373911755823,
+   0.22252093395631409,
+   1.2246467991473532e-16,
+   -0.22252093395631384,
+   -0.43388373911755801,
+   -0.62348980185873382,
+   -0.78183148246802969,
+   -0.90096886790241903,
+   -0.97492791218182362,
+   -1,
+   -0.97492791218182384,
+   -0.90096886790241926,
+   -0.78183148246802991,
+   -0.62348980185873371,
+   -0.43388373911755751,
+   -0.22252093395631464,
+   /* Period 29 */
+   0,
+   0.21497044021102407,
+   0.4198891015602646,
+   0.60517421519376524,
+   0.76216205512763646,
+   0.88351204444602294,
+   0.96354999251922302,
+   0.99853341385112382,
+   0.98682652254152614,
+   0.92897671981679153,
+   0.82768899815689057,
+   0.68769945885342354,
+   0.51555385717702162,
+   0.31930153013597978,
+   0.10811901842394192,
+   -0.10811901842394124,
+   -0.31930153013597995,
+   -0.51555385717702185,
+   -0.6876994588534231,
+   -0.82768899815689045,
+   -0.92897671981679142,
+   -0.98682652254152614,
+   -0.99853341385112393,
+   -0.96354999251922313,
+   -0.88351204444602283,
+   -0.76216205512763624,
+   -0.60517421519376491,
+   -0.41988910156026493,
+   -0.21497044021102438,
+   /* Period 30 */
+   0,
+   0.20791169081775931,
+   0.40673664307580015,
+   0.58778525229247314,
+   0.74314482547739413,
+   0.8660254037844386,
+   0.95105651629515353,
+   0.99452189536827329,
+   0.9945218953682734,
+   0.95105651629515364,
+   0.86602540378443871,
+   0.74314482547739447,
+   0.58778525229247325,
+   0.40673664307580004,
+   0.20791169081775931,
+   5.6655388976479796e-16,
+   -0.20791169081775907,
+   -0.40673664307580021,
+   -0.58778525229247303,
+   -0.74314482547739402,
+   -0.86602540378443837,
+   -0.95105651629515353,
+   -0.99452189536827329,
+   -0.9945218953682734,
+   -0.95105651629515364,
+   -0.8660254037844386,
+   -0.74314482547739402,
+   -0.58778525229247336,
+   -0.40673664307580015,
+   -0.20791169081775898,
+   /* Period 31 */
+   0,
+   0.20129852008866006,
+   0.39435585511331855,
+   0.57126821509479231,
+   0.72479278722911988,
+   0.84864425749475092,
+   0.93775213214708042,
+   0.98846832432811138,
+   0.99871650717105276,
+   0.96807711886620429,
+   0.89780453957074158,
+   0.79077573693769887,
+   0.65137248272222226,
+   0.48530196253108104,
+   0.29936312297335804,
+   0.10116832198743272,
+   -0.10116832198743204,
+   -0.29936312297335821,
+   -0.48530196253108082,
+   -0.65137248272222203,
+   -0.79077573693769865,
+   -0.89780453957074169,
+   -0.96807711886620407,
+   -0.99871650717105276,
+   -0.98846832432811138,
+   -0.93775213214708042,
+   -0.84864425749475103,
+   -0.72479278722911999,
+   -0.57126821509479242,
+   -0.39435585511331872,
+   -0.20129852008866114,
+   /* Period 32 */
+   0,
+   0.19509032201612825,
+   0.38268343236508978,
+   0.55557023301960218,
+   0.70710678118654746,
+   0.83146961230254524,
+   0.92387953251128674,
+   0.98078528040323043,
+   1,
+   0.98078528040323043,
+   0.92387953251128674,
+   0.83146961230254546,
+   0.70710678118654757,
+   0.55557023301960218,
+   0.38268343236508989,
+   0.19509032201612861,
+   1.2246467991473532e-16,
+   -0.19509032201612836,
+   -0.38268343236508967,
+   -0.55557023301960196,
+   -0.70710678118654746,
+   -0.83146961230254524,
+   -0.92387953251128652,
+   -0.98078528040323032,
+   -1,
+   -0.98078528040323043,
+   -0.92387953251128663,
+   -0.83146961230254546,
+   -0.70710678118654768,
+   -0.55557023301960218,
+   -0.38268343236509039,
+   -0.19509032201612872,
+   /* Period 33 */
+   0,
+   0.18925124436041019,
+   0.37166245566032752,
+   0.54064081745559756,
+   0.69007901148211193,
+   0.81457595205033573,
+   0.90963199535451833,
+   0.97181156832354165,
+   0.99886733918300796,
+   0.9898214418809328,
+   0.94500081871466846,
+   0.86602540378443871,
+   0.75574957435425827,
+   0.61815898622060506,
+   0.45822652172741052,
+   0.28173255684143006,
+   0.09505604330418288,
+   -0.09505604330418263,
+   -0.28173255684142939,
+   -0.45822652172740991,
+   -0.61815898622060528,
+   -0.75574957435425849,
+   -0.86602540378443837,
+   -0.94500081871466834,
+   -0.98982144188093268,
+   -0.99886733918300796,
+   -0.97181156832354165,
+   -0.90963199535451855,
+   -0.81457595205033584,
+   -0.69007901148211204,
+   -0.54064081745559822,
+   -0.37166245566032807,
+   -0.18925124436041063,
+   /* Period 34 */
+   0,
+   0.18374951781657034,
+   0.36124166618715292,
+   0.52643216287735572,
+   0.67369564364655721,
+   0.79801722728023949,
+   0.89516329135506234,
+   0.96182564317281904,
+   0.99573417629503447,
+   0.99573417629503458,
+   0.96182564317281904,
+   0.89516329135506256,
+   0.7980172272802396,
+   0.6736956436465571,
+   0.52643216287735606,
+   0.36124166618715331,
+   0.18374951781657037,
+   1.2246467991473532e-16,
+   -0.18374951781657012,
+   -0.3612416661871527,
+   -0.52643216287735584,
+   -0.67369564364655721,
+   -0.79801722728023894,
+   -0.89516329135506201,
+   -0.96182564317281904,
+   -0.99573417629503458,
+   -0.99573417629503447,
+   -0.96182564317281904,
+   -0.89516329135506256,
+   -0.79801722728023972,
+   -0.67369564364655776,
+   -0.52643216287735617,
+   -0.36124166618715303,
+   -0.18374951781657006,
+   /* Period 35 */
+   0,
+   0.17855689479863665,
+   0.35137482408134268,
+   0.51289927740590613,
+   0.65793872593971259,
+   0.7818314824680298,
+   0.880595531856738,
+   0.95105651629515353,
+   0.9909497617679347,
+   0.9989930665413147,
+   0.97492791218182362,
+   0.91952777255145079,
+   0.83457325372130264,
+   0.72279486382739155,
+   0.58778525229247325,
+   0.43388373911755823,
+   0.26603684556667523,
+   0.08963930890343362,
+   -0.089639308903433371,
+   -0.26603684556667501,
+   -0.43388373911755801,
+   -0.58778525229247303,
+   -0.72279486382739111,
+   -0.83457325372130253,
+   -0.91952777255145057,
+   -0.97492791218182362,
+   -0.99899306654131459,
+   -0.99094976176793481,
+   -0.95105651629515364,
+   -0.88059553185673811,
+   -0.78183148246802991,
+   -0.65793872593971281,
+   -0.51289927740590635,
+   -0.35137482408134291,
+   -0.17855689479863687,
+   /* Period 36 */
+   0,
+   0.17364817766693033,
+   0.34202014332566871,
+   0.49999999999999994,
+   0.64278760968653925,
+   0.76604444311897801,
+   0.8660254037844386,
+   0.93969262078590832,
+   0.98480775301220802,
+   1,
+   0.98480775301220802,
+   0.93969262078590843,
+   0.86602540378443871,
+   0.76604444311897801,
+   0.64278760968653947,
+   0.50000000000000033,
+   0.34202014332566888,
+   0.17364817766693028,
+   1.2246467991473532e-16,
+   -0.17364817766693003,
+   -0.34202014332566866,
+   -0.50000000000000011,
+   -0.64278760968653892,
+   -0.7660444431189779,
+   -0.86602540378443837,
+   -0.93969262078590843,
+   -0.98480775301220802,
+   -1,
+   -0.98480775301220813,
+   -0.93969262078590832,
+   -0.86602540378443904,
+   -0.76604444311897812,
+   -0.64278760968653958,
+   -0.49999999999999967,
+   -0.3420201433256686,
+   -0.17364817766693039,
+   /* Period 37 */
+   0,
+   0.16900082032184907,
+   0.33313979474205757,
+   0.48769494381363454,
+   0.62821999729564226,
+   0.75067230525272433,
+   0.85152913773331129,
+   0.92788902729650935,
+   0.97755523894768614,
+   0.99909896620468142,
+   0.99190043525887683,
+   0.95616673473925107,
+   0.89292585814956849,
+   0.80399713036694054,
+   0.6919388689775462,
+   0.55997478613759544,
+   0.41190124824399282,
+   0.25197806138512502,
+   0.084805924475509498,
+   -0.084805924475508818,
+   -0.25197806138512518,
+   -0.4119012482439926,
+   -0.55997478613759488,
+   -0.69193886897754608,
+   -0.80399713036694065,
+   -0.89292585814956837,
+   -0.95616673473925096,
+   -0.99190043525887683,
+   -0.99909896620468153,
+   -0.97755523894768614,
+   -0.92788902729650946,
+   -0.85152913773331174,
+   -0.75067230525272455,
+   -0.62821999729564226,
+   -0.48769494381363421,
+   -0.33313979474205768,
+   -0.16900082032184968,
+   /* Period 38 */
+   0,
+   0.16459459028073389,
+   0.32469946920468346,
+   0.47594739303707356,
+   0.61421271268966782,
+   0.73572391067313159,
+   0.83716647826252855,
+   0.9157733266550574,
+   0.96940026593933037,
+   0.99658449300666985,
+   0.99658449300666985,
+   0.96940026593933049,
+   0.9157733266550574,
+   0.83716647826252844,
+   0.73572391067313181,
+   0.61421271268966793,
+   0.47594739303707367,
+   0.32469946920468323,
+   0.16459459028073403,
+   1.2246467991473532e-16,
+   -0.16459459028073378,
+   -0.3246994692046834,
+   -0.47594739303707312,
+   -0.61421271268966737,
+   -0.73572391067313159,
+   -0.83716647826252855,
+   -0.91577332665505762,
+   -0.96940026593933037,
+   -0.99658449300666985,
+   -0.99658449300666985,
+   -0.96940026593933049,
+   -0.91577332665505773,
+   -0.83716647826252877,
+   -0.73572391067313159,
+   -0.61421271268966737,
+   -0.47594739303707417,
+   -0.32469946920468373,
+   -0.16459459028073373,
+   /* Period 39 */
+   0,
+   0.16041128085776024,
+   0.31666799380147248,
+   0.46472317204376851,
+   0.60074226423797883,
+   0.72120244734381456,
+   0.82298386589365635,
+   0.90345043461038221,
+   0.96051811163137224,
+   0.99270887409805397,
+   0.99918899817156959,
+   0.97979065204226778,
+   0.93501624268541483,
+   0.86602540378443849,
+   0.77460496182765459,
+   0.66312265824079553,
+   0.53446582612780125,
+   0.39196660986007514,
+   0.23931566428755768,
+   0.080466568716726083,
+   -0.080466568716725834,
+   -0.23931566428755788,
+   -0.39196660986007448,
+   -0.53446582612780069,
+   -0.66312265824079497,
+   -0.7746049618276547,
+   -0.86602540378443882,
+   -0.93501624268541472,
+   -0.97979065204226767,
+   -0.99918899817156959,
+   -0.99270887409805408,
+   -0.96051811163137246,
+   -0.90345043461038244,
+   -0.82298386589365657,
+   -0.72120244734381467,
+   -0.60074226423797894,
+   -0.4647231720437684,
+   -0.3166679938014722,
+   -0.16041128085776063,
+   /* Period 40 */
+   0,
+   0.15643446504023087,
+   0.3090169943749474,
+   0.45399049973954675,
+   0.58778525229247314,
+   0.70710678118654746,
+   0.80901699437494745,
+   0.89100652418836779,
+   0.95105651629515353,
+   0.98768834059513777,
+   1,
+   0.98768834059513777,
+   0.95105651629515364,
+   0.8910065241883679,
+   0.80901699437494745,
+   0.70710678118654757,
+   0.58778525229247325,
+   0.45399049973954686,
+   0.30901699437494751,
+   0.15643446504023098,
+   1.2246467991473532e-16,
+   -0.15643446504023073,
+   -0.3090169943749469,
+   -0.45399049973954669,
+   -0.58778525229247303,
+   -0.70710678118654746,
+   -0.80901699437494734,
+   -0.89100652418836779,
+   -0.95105651629515353,
+   -0.98768834059513766,
+   -1,
+   -0.98768834059513777,
+   -0.95105651629515364,
+   -0.89100652418836801,
+   -0.80901699437494756,
+   -0.70710678118654768,
+   -0.58778525229247336,
+   -0.45399049973954697,
+   -0.30901699437494762,
+   -0.15643446504023112,
+   /* Period 41 */
+   0,
+   0.1526492842188745,
+   0.30172059859519235,
+   0.44371983786695968,
+   0.57531866021862066,
+   0.69343250079224172,
+   0.7952928712734264,
+   0.87851225091094232,
+   0.94114004797956163,
+   0.98170831999685493,
+   0.99926618105081,
+   0.99340208975967514,
+   0.96425349545314099,
+   0.91250361647654998,
+   0.83936542613194998,
+   0.7465532216119628,
+   0.63624244232655969,
+   0.51101867944711032,
+   0.37381707184076884,
+   0.22785350890313777,
+   0.07654925283649594,
+   -0.07654925283649569,
+   -0.2278535089031371,
+   -0.37381707184076862,
+   -0.5110186794471101,
+   -0.63624244232655991,
+   -0.74655322161196258,
+   -0.83936542613194964,
+   -0.91250361647654987,
+   -0.96425349545314099,
+   -0.99340208975967503,
+   -0.99926618105081,
+   -0.98170831999685493,
+   -0.94114004797956163,
+   -0.87851225091094232,
+   -0.79529287127342674,
+   -0.69343250079224183,
+   -0.57531866021862044,
+   -0.44371983786696001,
+   -0.30172059859519235,
+   -0.15264928421887508,
+   /* Period 42 */
+   0,
+   0.14904226617617444,
+   0.29475517441090421,
+   0.43388373911755812,
+   0.56332005806362206,
+   0.68017273777091936,
+   0.7818314824680298,
+   0.8660254037844386,
+   0.93087374864420425,
+   0.97492791218182362,
+   0.99720379718118013,
+   0.99720379718118013,
+   0.97492791218182362,
+   0.93087374864420425,
+   0.86602540378443871,
+   0.78183148246802991,
+   0.68017273777091936,
+   0.56332005806362184,
+   0.43388373911755823,
+   0.2947551744109046,
+   0.14904226617617472,
+   1.2246467991473532e-16,
+   -0.14904226617617403,
+   -0.29475517441090393,
+   -0.43388373911755801,
+   -0.56332005806362206,
+   -0.68017273777091947,
+   -0.78183148246802969,
+   -0.86602540378443837,
+   -0.93087374864420436,
+   -0.97492791218182362,
+   -0.99720379718118013,
+   -0.99720379718118013,
+   -0.97492791218182362,
+   -0.93087374864420414,
+   -0.86602540378443904,
+   -0.78183148246802991,
+   -0.68017273777091913,
+   -0.56332005806362273,
+   -0.43388373911755834,
+   -0.29475517441090471,
+   -0.14904226617617528,
+   /* Period 43 */
+   0,
+   0.14560116773500487,
+   0.28809909936523759,
+   0.42445669887581505,
+   0.55176774077044588,
+   0.66731881122223935,
+   0.76864713977853205,
+   0.85359308903734643,
+   0.92034618356915943,
+   0.96748369705742532,
+   0.99400097523994591,
+   0.99933284837023939,
+   0.98336567682946618,
+   0.9464397731576093,
+   0.88934214888251895,
+   0.81328974073556548,
+   0.71990347375799579,
+   0.61117371409784937,
+   0.48941784781108544,
+   0.35723088980113288,
+   0.21743017558155725,
+   0.072995314660907556,
+   -0.072995314660906863,
+   -0.21743017558155656,
+   -0.35723088980113266,
+   -0.4894178478110856,
+   -0.6111737140978496,
+   -0.71990347375799568,
+   -0.81328974073556537,
+   -0.88934214888251883,
+   -0.94643977315760919,
+   -0.98336567682946596,
+   -0.99933284837023939,
+   -0.99400097523994591,
+   -0.96748369705742532,
+   -0.92034618356915965,
+   -0.85359308903734632,
+   -0.76864713977853205,
+   -0.66731881122223957,
+   -0.55176774077044621,
+   -0.42445669887581561,
+   -0.28809909936523831,
+   -0.14560116773500492,
+   /* Period 44 */
+   0,
+   0.14231483827328514,
+   0.28173255684142967,
+   0.41541501300188638,
+   0.54064081745559756,
+   0.6548607339452851,
+   0.75574957435425827,
+   0.84125353283118109,
+   0.90963199535451833,
+   0.95949297361449737,
+   0.98982144188093268,
+   1,
+   0.9898214418809328,
+   0.95949297361449737,
+   0.90963199535451844,
+   0.84125353283118143,
+   0.75574957435425827,
+   0.65486073394528521,
+   0.54064081745559778,
+   0.41541501300188671,
+   0.28173255684142967,
+   0.14231483827328517,
+   5.6655388976479796e-16,
+   -0.14231483827328492,
+   -0.28173255684142939,
+   -0.41541501300188649,
+   -0.54064081745559756,
+   -0.65486073394528499,
+   -0.75574957435425816,
+   -0.84125353283118121,
+   -0.909631995354518,
+   -0.95949297361449737,
+   -0.98982144188093268,
+   -1,
+   -0.9898214418809328,
+   -0.95949297361449748,
+   -0.90963199535451855,
+   -0.84125353283118098,
+   -0.75574957435425871,
+   -0.65486073394528554,
+   -0.54064081745559744,
+   -0.41541501300188721,
+   -0.28173255684142978,
+   -0.14231483827328531,
+   /* Period 45 */
+   0,
+   0.13917310096006544,
+   0.27563735581699916,
+   0.40673664307580015,
+   0.5299192642332049,
+   0.64278760968653925,
+   0.74314482547739413,
+   0.82903757255504174,
+   0.89879404629916704,
+   0.95105651629515353,
+   0.98480775301220802,
+   0.99939082701909576,
+   0.9945218953682734,
+   0.97029572627599647,
+   0.92718385456678742,
+   0.86602540378443871,
+   0.78801075360672201,
+   0.69465837045899714,
+   0.58778525229247325,
+   0.46947156278589108,
+   0.34202014332566888,
+   0.20791169081775931,
+   0.069756473744125524,
+   -0.069756473744124831,
+   -0.20791169081775907,
+   -0.34202014332566866,
+   -0.46947156278589086,
+   -0.58778525229247303,
+   -0.69465837045899737,
+   -0.78801075360672213,
+   -0.86602540378443837,
+   -0.92718385456678731,
+   -0.97029572627599647,
+   -0.9945218953682734,
+   -0.99939082701909576,
+   -0.98480775301220813,
+   -0.95105651629515364,
+   -0.89879404629916704,
+   -0.82903757255504207,
+   -0.74314482547739458,
+   -0.64278760968653958,
+   -0.52991926423320579,
+   -0.40673664307580015,
+   -0.27563735581699977,
+   -0.13917310096006588,
+   /* Period 46 */
+   0,
+   0.13616664909624659,
+   0.26979677115702427,
+   0.39840108984624145,
+   0.51958395003543356,
+   0.63108794432605275,
+   0.73083596427812403,
+   0.81696989301044198,
+   0.88788521840237522,
+   0.9422609221188204,
+   0.97908408768232291,
+   0.99766876919053915,
+   0.99766876919053915,
+   0.97908408768232291,
+   0.94226092211882051,
+   0.88788521840237522,
+   0.81696989301044209,
+   0.73083596427812392,
+   0.63108794432605297,
+   0.51958395003543389,
+   0.3984010898462414,
+   0.26979677115702427,
+   0.13616664909624709,
+   1.2246467991473532e-16,
+   -0.1361666490962464,
+   -0.26979677115702444,
+   -0.39840108984624156,
+   -0.51958395003543323,
+   -0.63108794432605275,
+   -0.73083596427812403,
+   -0.81696989301044198,
+   -0.887885218402375,
+   -0.9422609221188204,
+   -0.97908408768232291,
+   -0.99766876919053926,
+   -0.99766876919053915,
+   -0.97908408768232302,
+   -0.94226092211882051,
+   -0.88788521840237555,
+   -0.81696989301044221,
+   -0.73083596427812403,
+   -0.63108794432605309,
+   -0.51958395003543356,
+   -0.3984010898462419,
+   -0.26979677115702522,
+   -0.13616664909624632,
+   /* Period 47 */
+   0,
+   0.13328695537377883,
+   0.26419540187128598,
+   0.39038927516349481,
+   0.50961664259191741,
+   0.61974988896024485,
+   0.71882368387792928,
+   0.80507005312756286,
+   0.8769499282066715,
+   0.93318061104160255,
+   0.97275866376503717,
+   0.99497781508850403,
+   0.99944156373025461,
+   0.98607025399002857,
+   0.95510249720691243,
+   0.90709091373434081,
+   0.84289227141679712,
+   0.76365219654733207,
+   0.67078473013922346,
+   0.56594709433059542,
+   0.45101011921610212,
+   0.32802485783956892,
+   0.19918598510383628,
+   0.066792633745121704,
+   -0.066792633745121455,
+   -0.19918598510383606,
+   -0.32802485783956908,
+   -0.45101011921610151,
+   -0.56594709433059487,
+   -0.67078473013922357,
+   -0.76365219654733185,
+   -0.84289227141679701,
+   -0.9070909137343407,
+   -0.95510249720691243,
+   -0.98607025399002857,
+   -0.99944156373025461,
+   -0.99497781508850403,
+   -0.97275866376503717,
+   -0.93318061104160288,
+   -0.87694992820667184,
+   -0.8050700531275633,
+   -0.71882368387792972,
+   -0.61974988896024463,
+   -0.50961664259191786,
+   -0.3903892751634952,
+   -0.26419540187128632,
+   -0.13328695537377913,
+   /* Period 48 */
+   0,
+   0.13052619222005157,
+   0.25881904510252074,
+   0.38268343236508978,
+   0.49999999999999994,
+   0.60876142900872066,
+   0.70710678118654746,
+   0.79335334029123517,
+   0.8660254037844386,
+   0.92387953251128674,
+   0.96592582628906831,
+   0.99144486137381038,
+   1,
+   0.99144486137381038,
+   0.96592582628906831,
+   0.92387953251128685,
+   0.86602540378443871,
+   0.79335334029123517,
+   0.70710678118654757,
+   0.60876142900872088,
+   0.49999999999999994,
+   0.38268343236508989,
+   0.25881904510252102,
+   0.13052619222005199,
+   1.2246467991473532e-16,
+   -0.13052619222005177,
+   -0.25881904510252079,
+   -0.38268343236508967,
+   -0.49999999999999972,
+   -0.60876142900872066,
+   -0.70710678118654713,
+   -0.79335334029123494,
+   -0.86602540378443837,
+   -0.92387953251128685,
+   -0.96592582628906831,
+   -0.99144486137381038,
+   -1,
+   -0.99144486137381049,
+   -0.96592582628906842,
+   -0.92387953251128696,
+   -0.8660254037844386,
+   -0.79335334029123572,
+   -0.70710678118654768,
+   -0.60876142900872088,
+   -0.50000000000000044,
+   -0.38268343236508956,
+   -0.25881904510252157,
+   -0.13052619222005168,
+   /* Period 49 */
+   0,
+   0.127877161684506,
+   0.25365458390950735,
+   0.37526700487937409,
+   0.49071755200393785,
+   0.59811053049121599,
+   0.69568255060348638,
+   0.7818314824680298,
+   0.85514276300534608,
+   0.9144126230158125,
+   0.95866785303666058,
+   0.98718178341445006,
+   0.99948621620068789,
+   0.99537911294919823,
+   0.97492791218182362,
+   0.93846842204976044,
+   0.88659930637300011,
+   0.82017225459695575,
+   0.7402779970753155,
+   0.64822839530778875,
+   0.54553490121054871,
+   0.43388373911755823,
+   0.31510821802362127,
+   0.19115862870137254,
+   0.064070219980713231,
+   -0.064070219980712995,
+   -0.19115862870137229,
+   -0.3151082180236206,
+   -0.43388373911755801,
+   -0.54553490121054848,
+   -0.6482283953077882,
+   -0.74027799707531527,
+   -0.82017225459695564,
+   -0.886599306373,
+   -0.93846842204976055,
+   -0.97492791218182362,
+   -0.99537911294919823,
+   -0.99948621620068789,
+   -0.98718178341445029,
+   -0.9586678530366608,
+   -0.9144126230158125,
+   -0.85514276300534642,
+   -0.78183148246802991,
+   -0.69568255060348694,
+   -0.59811053049121699,
+   -0.49071755200393785,
+   -0.37526700487937459,
+   -0.25365458390950751,
+   -0.12787716168450664,
+   /* Period 50 */
+   0,
+   0.12533323356430426,
+   0.24868988716485479,
+   0.36812455268467792,
+   0.48175367410171532,
+   0.58778525229247314,
+   0.68454710592868862,
+   0.77051324277578925,
+   0.84432792550201508,
+   0.90482705246601958,
+   0.95105651629515353,
+   0.98228725072868861,
+   0.99802672842827156,
+   0.99802672842827156,
+   0.98228725072868872,
+   0.95105651629515364,
+   0.90482705246601947,
+   0.84432792550201496,
+   0.77051324277578925,
+   0.68454710592868884,
+   0.58778525229247325,
+   0.48175367410171521,
+   0.36812455268467814,
+   0.24868988716485524,
+   0.12533323356430454,
+   1.2246467991473532e-16,
+   -0.12533323356430429,
+   -0.24868988716485457,
+   -0.36812455268467792,
+   -0.48175367410171538,
+   -0.58778525229247269,
+   -0.68454710592868839,
+   -0.77051324277578936,
+   -0.8443279255020153,
+   -0.9048270524660198,
+   -0.95105651629515353,
+   -0.98228725072868872,
+   -0.99802672842827156,
+   -0.99802672842827156,
+   -0.98228725072868872,
+   -0.95105651629515364,
+   -0.90482705246601991,
+   -0.84432792550201496,
+   -0.77051324277578959,
+   -0.68454710592868895,
+   -0.58778525229247336,
+   -0.4817536741017161,
+   -0.36812455268467786,
+   -0.24868988716485535,
+   -0.12533323356430465
+};
+
+static const double TA_HTDFTCos[TA_HT_DFT_TABLE_SIZE] = {
+   /* Period 1 */
+   1,
+   /* Period 2 */
+   1,
+   -1,
+   /* Period 3 */
+   1,
+   -0.49999999999999978,
+   -0.50000000000000044,
+   /* Period 4 */
+   1,
+   6.123233995736766e-17,
+   -1,
+   -1.8369701987210297e-16,
+   /* Period 5 */
+   1,
+   0.30901699437494745,
+   -0.80901699437494734,
+   -0.80901699437494756,
+   0.30901699437494723,
+   /* Period 6 */
+   1,
+   0.50000000000000011,
+   -0.49999999999999978,
+   -1,
+   -0.50000000000000044,
+   0.50000000000000011,
+   /* Period 7 */
+   1,
+   0.62348980185873359,
+   -0.22252093395631434,
+   -0.90096886790241903,
+   -0.90096886790241915,
+   -0.22252093395631459,
+   0.62348980185873337,
+   /* Period 8 */
+   1,
+   0.70710678118654757,
+   6.123233995736766e-17,
+   -0.70710678118654746,
+   -1,
+   -0.70710678118654768,
+   -1.8369701987210297e-16,
+   0.70710678118654735,
+   /* Period 9 */
+   1,
+   0.76604444311897801,
+   0.17364817766693041,
+   -0.49999999999999978,
+   -0.93969262078590832,
+   -0.93969262078590843,
+   -0.50000000000000044,
+   0.17364817766692997,
+   0.76604444311897779,
+   /* Period 10 */
+   1,
+   0.80901699437494745,
+   0.30901699437494745,
+   -0.30901699437494734,
+   -0.80901699437494734,
+   -1,
+   -0.80901699437494756,
+   -0.30901699437494756,
+   0.30901699437494723,
+   0.80901699437494734,
+   /* Period 11 */
+   1,
+   0.84125353283118121,
+   0.41541501300188644,
+   -0.142314838273285,
+   -0.65486073394528499,
+   -0.95949297361449737,
+   -0.95949297361449748,
+   -0.65486073394528521,
+   -0.14231483827328523,
+   0.41541501300188605,
+   0.84125353283118121,
+   /* Period 12 */
+   1,
+   0.86602540378443871,
+   0.50000000000000011,
+   6.123233995736766e-17,
+   -0.49999999999999978,
+   -0.86602540378443871,
+   -1,
+   -0.86602540378443882,
+   -0.50000000000000044,
+   -1.8369701987210297e-16,
+   0.50000000000000011,
+   0.86602540378443837,
+   /* Period 13 */
+   1,
+   0.88545602565320991,
+   0.56806474673115592,
+   0.12053668025532301,
+   -0.35460488704253545,
+   -0.74851074817110119,
+   -0.97094181742605201,
+   -0.97094181742605212,
+   -0.7485107481711013,
+   -0.3546048870425359,
+   0.1205366802553232,
+   0.56806474673115481,
+   0.88545602565321002,
+   /* Period 14 */
+   1,
+   0.90096886790241915,
+   0.62348980185873359,
+   0.22252093395631445,
+   -0.22252093395631434,
+   -0.62348980185873348,
+   -0.90096886790241903,
+   -1,
+   -0.90096886790241915,
+   -0.62348980185873371,
+   -0.22252093395631459,
+   0.22252093395631334,
+   0.62348980185873337,
+   0.90096886790241937,
+   /* Period 15 */
+   1,
+   0.91354545764260087,
+   0.66913060635885824,
+   0.30901699437494745,
+   -0.10452846326765333,
+   -0.49999999999999978,
+   -0.80901699437494734,
+   -0.97814760073380569,
+   -0.97814760073380569,
+   -0.80901699437494756,
+   -0.50000000000000044,
+   -0.10452846326765423,
+   0.30901699437494723,
+   0.66913060635885846,
+   0.91354545764260098,
+   /* Period 16 */
+   1,
+   0.92387953251128674,
+   0.70710678118654757,
+   0.38268343236508984,
+   6.123233995736766e-17,
+   -0.38268343236508973,
+   -0.70710678118654746,
+   -0.92387953251128674,
+   -1,
+   -0.92387953251128685,
+   -0.70710678118654768,
+   -0.38268343236509034,
+   -1.8369701987210297e-16,
+   0.38268343236509,
+   0.70710678118654735,
+   0.92387953251128652,
+   /* Period 17 */
+   1,
+   0.93247222940435581,
+   0.73900891722065909,
+   0.44573835577653831,
+   0.092268359463302016,
+   -0.27366299007208289,
+   -0.60263463637925629,
+   -0.85021713572961399,
+   -0.98297309968390179,
+   -0.98297309968390179,
+   -0.8502171357296141,
+   -0.60263463637925718,
+   -0.27366299007208311,
+   0.092268359463302432,
+   0.4457383557765377,
+   0.73900891722065853,
+   0.93247222940435581,
+   /* Period 18 */
+   1,
+   0.93969262078590843,
+   0.76604444311897801,
+   0.50000000000000011,
+   0.17364817766693041,
+   -0.1736481776669303,
+   -0.49999999999999978,
+   -0.7660444431189779,
+   -0.93969262078590832,
+   -1,
+   -0.93969262078590843,
+   -0.76604444311897835,
+   -0.50000000000000044,
+   -0.17364817766693033,
+   0.17364817766692997,
+   0.49999999999999933,
+   0.76604444311897779,
+   0.93969262078590843,
+   /* Period 19 */
+   1,
+   0.94581724170063464,
+   0.78914050939639357,
+   0.54694815812242692,
+   0.24548548714079924,
+   -0.082579345472332269,
+   -0.40169542465296942,
+   -0.67728157162574087,
+   -0.87947375120648896,
+   -0.98636130340272232,
+   -0.98636130340272243,
+   -0.8794737512064893,
+   -0.6772815716257411,
+   -0.40169542465296904,
+   -0.082579345472332741,
+   0.24548548714079879,
+   0.54694815812242659,
+   0.78914050939639391,
+   0.94581724170063464,
+   /* Period 20 */
+   1,
+   0.95105651629515353,
+   0.80901699437494745,
+   0.58778525229247314,
+   0.30901699437494745,
+   6.123233995736766e-17,
+   -0.30901699437494734,
+   -0.58778525229247303,
+   -0.80901699437494734,
+   -0.95105651629515353,
+   -1,
+   -0.95105651629515375,
+   -0.80901699437494756,
+   -0.58778525229247325,
+   -0.30901699437494756,
+   -1.8369701987210297e-16,
+   0.30901699437494723,
+   0.58778525229247292,
+   0.80901699437494734,
+   0.95105651629515353,
+   /* Period 21 */
+   1,
+   0.95557280578614068,
+   0.82623877431599491,
+   0.62348980185873359,
+   0.36534102436639498,
+   0.074730093586424393,
+   -0.22252093395631434,
+   -0.49999999999999978,
+   -0.73305187182982634,
+   -0.90096886790241903,
+   -0.98883082622512852,
+   -0.98883082622512863,
+   -0.90096886790241915,
+   -0.73305187182982623,
+   -0.50000000000000044,
+   -0.22252093395631459,
+   0.074730093586424365,
+   0.36534102436639537,
+   0.62348980185873337,
+   0.82623877431599446,
+   0.95557280578614057,
+   /* Period 22 */
+   1,
+   0.95949297361449737,
+   0.84125353283118121,
+   0.6548607339452851,
+   0.41541501300188644,
+   0.14231483827328512,
+   -0.142314838273285,
+   -0.41541501300188632,
+   -0.65486073394528499,
+   -0.84125353283118109,
+   -0.95949297361449737,
+   -1,
+   -0.95949297361449748,
+   -0.84125353283118121,
+   -0.65486073394528521,
+   -0.41541501300188716,
+   -0.14231483827328523,
+   0.14231483827328487,
+   0.41541501300188605,
+   0.65486073394528455,
+   0.84125353283118121,
+   0.95949297361449737,
+   /* Period 23 */
+   1,
+   0.96291728734779924,
+   0.85441940454648857,
+   0.68255314321865412,
+   0.4600650377311522,
+   0.20345601305263375,
+   -0.068242413364670879,
+   -0.33487961217098616,
+   -0.57668032211486708,
+   -0.77571129070441969,
+   -0.91721130150545305,
+   -0.99068594603633064,
+   -0.99068594603633076,
+   -0.91721130150545294,
+   -0.7757112907044198,
+   -0.57668032211486719,
+   -0.33487961217098638,
+   -0.068242413364670462,
+   0.20345601305263331,
+   0.46006503773115159,
+   0.68255314321865423,
+   0.85441940454648857,
+   0.96291728734779902,
+   /* Period 24 */
+   1,
+   0.96592582628906831,
+   0.86602540378443871,
+   0.70710678118654757,
+   0.50000000000000011,
+   0.25881904510252074,
+   6.123233995736766e-17,
+   -0.25881904510252063,
+   -0.49999999999999978,
+   -0.70710678118654746,
+   -0.86602540378443871,
+   -0.9659258262890682,
+   -1,
+   -0.96592582628906831,
+   -0.86602540378443882,
+   -0.70710678118654791,
+   -0.50000000000000044,
+   -0.25881904510252063,
+   -1.8369701987210297e-16,
+   0.2588190451025203,
+   0.50000000000000011,
+   0.70710678118654735,
+   0.86602540378443837,
+   0.96592582628906809,
+   /* Period 25 */
+   1,
+   0.96858316112863108,
+   0.87630668004386358,
+   0.72896862742141155,
+   0.53582679497899655,
+   0.30901699437494745,
+   0.062790519529313527,
+   -0.1873813145857246,
+   -0.42577929156507272,
+   -0.63742398974868975,
+   -0.80901699437494734,
+   -0.92977648588825135,
+   -0.99211470131447776,
+   -0.99211470131447788,
+   -0.92977648588825146,
+   -0.80901699437494778,
+   -0.63742398974868952,
+   -0.42577929156507216,
+   -0.18738131458572463,
+   0.062790519529312833,
+   0.30901699437494723,
+   0.53582679497899677,
+   0.72896862742141122,
+   0.87630668004386314,
+   0.96858316112863097,
+   /* Period 26 */
+   1,
+   0.97094181742605201,
+   0.88545602565320991,
+   0.74851074817110108,
+   0.56806474673115592,
+   0.35460488704253557,
+   0.12053668025532301,
+   -0.12053668025532288,
+   -0.35460488704253545,
+   -0.5680647467311557,
+   -0.74851074817110119,
+   -0.88545602565320958,
+   -0.97094181742605201,
+   -1,
+   -0.97094181742605212,
+   -0.88545602565321013,
+   -0.7485107481711013,
+   -0.56806474673115592,
+   -0.3546048870425359,
+   -0.12053668025532357,
+   0.1205366802553232,
+   0.35460488704253557,
+   0.56806474673115481,
+   0.74851074817110075,
+   0.88545602565321002,
+   0.97094181742605201,
+   /* Period 27 */
+   1,
+   0.97304487057982381,
+   0.89363264032341228,
+   0.76604444311897801,
+   0.59715859170278618,
+   0.3960797660391569,
+   0.17364817766693041,
+   -0.058144828910475774,
+   -0.28680323271109021,
+   -0.49999999999999978,
+   -0.68624163786873349,
+   -0.83548781141293627,
+   -0.93969262078590832,
+   -0.99323835774194302,
+   -0.99323835774194302,
+   -0.93969262078590854,
+   -0.83548781141293649,
+   -0.6862416378687336,
+   -0.50000000000000044,
+   -0.28680323271109065,
+   -0.058144828910476239,
+   0.17364817766693083,
+   0.39607976603915651,
+   0.59715859170278585,
+   0.76604444311897779,
+   0.89363264032341216,
+   0.97304487057982403,
+   /* Period 28 */
+   1,
+   0.97492791218182362,
+   0.90096886790241915,
+   0.7818314824680298,
+   0.62348980185873359,
+   0.43388373911755818,
+   0.22252093395631445,
+   6.123233995736766e-17,
+   -0.22252093395631434,
+   -0.43388373911755806,
+   -0.62348980185873348,
+   -0.78183148246802947,
+   -0.90096886790241903,
+   -0.97492791218182373,
+   -1,
+   -0.97492791218182373,
+   -0.90096886790241915,
+   -0.78183148246802958,
+   -0.62348980185873371,
+   -0.43388373911755829,
+   -0.22252093395631459,
+   -1.8369701987210297e-16,
+   0.22252093395631334,
+   0.43388373911755795,
+   0.62348980185873337,
+   0.78183148246802969,
+   0.90096886790241937,
+   0.97492791218182351,
+   /* Period 29 */
+   1,
+   0.97662055571008666,
+   0.90757541967095701,
+   0.79609306570564375,
+   0.64738628478182769,
+   0.46840844069979015,
+   0.26752833852922075,
+   0.05413890858541761,
+   -0.16178199655276473,
+   -0.37013815533991423,
+   -0.56118706536238228,
+   -0.72599549192313062,
+   -0.85685717616758927,
+   -0.94765317118280246,
+   -0.9941379571543596,
+   -0.99413795715435971,
+   -0.94765317118280246,
+   -0.85685717616758916,
+   -0.72599549192313106,
+   -0.5611870653623825,
+   -0.37013815533991445,
+   -0.16178199655276476,
+   0.054138908585416701,
+   0.26752833852922009,
+   0.46840844069979032,
+   0.64738628478182791,
+   0.79609306570564398,
+   0.9075754196709569,
+   0.97662055571008666,
+   /* Period 30 */
+   1,
+   0.97814760073380569,
+   0.91354545764260087,
+   0.80901699437494745,
+   0.66913060635885824,
+   0.50000000000000011,
+   0.30901699437494745,
+   0.10452846326765346,
+   -0.10452846326765333,
+   -0.30901699437494734,
+   -0.49999999999999978,
+   -0.6691306063588579,
+   -0.80901699437494734,
+   -0.91354545764260098,
+   -0.97814760073380569,
+   -1,
+   -0.97814760073380569,
+   -0.91354545764260087,
+   -0.80901699437494756,
+   -0.66913060635885846,
+   -0.50000000000000044,
+   -0.30901699437494756,
+   -0.10452846326765423,
+   0.10452846326765299,
+   0.30901699437494723,
+   0.50000000000000011,
+   0.66913060635885846,
+   0.80901699437494734,
+   0.91354545764260098,
+   0.97814760073380569,
+   /* Period 31 */
+   1,
+   0.97952994125249448,
+   0.9189578116202306,
+   0.82076344120727629,
+   0.68896691907568663,
+   0.52896401032696239,
+   0.34730525284482028,
+   0.1514277775045767,
+   -0.050649168838712642,
+   -0.25065253225872042,
+   -0.44039415155763439,
+   -0.61210598254766257,
+   -0.75875812269279086,
+   -0.87434661614458209,
+   -0.95413925640004882,
+   -0.99486932339189504,
+   -0.99486932339189516,
+   -0.95413925640004882,
+   -0.8743466161445822,
+   -0.75875812269279108,
+   -0.61210598254766269,
+   -0.44039415155763423,
+   -0.25065253225872131,
+   -0.050649168838713551,
+   0.15142777750457667,
+   0.34730525284482028,
+   0.52896401032696239,
+   0.68896691907568652,
+   0.82076344120727629,
+   0.9189578116202306,
+   0.97952994125249426,
+   /* Period 32 */
+   1,
+   0.98078528040323043,
+   0.92387953251128674,
+   0.83146961230254524,
+   0.70710678118654757,
+   0.55557023301960229,
+   0.38268343236508984,
+   0.19509032201612833,
+   6.123233995736766e-17,
+   -0.19509032201612819,
+   -0.38268343236508973,
+   -0.55557023301960196,
+   -0.70710678118654746,
+   -0.83146961230254535,
+   -0.92387953251128674,
+   -0.98078528040323043,
+   -1,
+   -0.98078528040323043,
+   -0.92387953251128685,
+   -0.83146961230254546,
+   -0.70710678118654768,
+   -0.55557023301960218,
+   -0.38268343236509034,
+   -0.19509032201612866,
+   -1.8369701987210297e-16,
+   0.1950903220161283,
+   0.38268343236509,
+   0.55557023301960184,
+   0.70710678118654735,
+   0.83146961230254524,
+   0.92387953251128652,
+   0.98078528040323032,
+   /* Period 33 */
+   1,
+   0.98192869726270671,
+   0.92836793301607257,
+   0.84125353283118121,
+   0.7237340381050702,
+   0.58005690957119815,
+   0.41541501300188644,
+   0.23575893550942728,
+   0.047581915823742403,
+   -0.142314838273285,
+   -0.32706796331742166,
+   -0.49999999999999978,
+   -0.65486073394528499,
+   -0.78605309474278751,
+   -0.88883544865492337,
+   -0.95949297361449726,
+   -0.99547192257308459,
+   -0.99547192257308459,
+   -0.95949297361449748,
+   -0.8888354486549237,
+   -0.78605309474278739,
+   -0.65486073394528488,
+   -0.50000000000000044,
+   -0.32706796331742188,
+   -0.14231483827328523,
+   0.047581915823742382,
+   0.23575893550942748,
+   0.41541501300188605,
+   0.58005690957119793,
+   0.72373403810507009,
+   0.84125353283118076,
+   0.92836793301607234,
+   0.9819286972627066,
+   /* Period 34 */
+   1,
+   0.98297309968390179,
+   0.93247222940435581,
+   0.85021713572961422,
+   0.73900891722065909,
+   0.60263463637925641,
+   0.44573835577653831,
+   0.273662990072083,
+   0.092268359463302016,
+   -0.092268359463301891,
+   -0.27366299007208289,
+   -0.44573835577653781,
+   -0.60263463637925629,
+   -0.73900891722065931,
+   -0.85021713572961399,
+   -0.9324722294043557,
+   -0.98297309968390179,
+   -1,
+   -0.98297309968390179,
+   -0.93247222940435592,
+   -0.8502171357296141,
+   -0.73900891722065909,
+   -0.60263463637925718,
+   -0.44573835577653886,
+   -0.27366299007208311,
+   -0.092268359463301919,
+   0.092268359463302432,
+   0.27366299007208278,
+   0.4457383557765377,
+   0.60263463637925618,
+   0.73900891722065853,
+   0.85021713572961388,
+   0.93247222940435581,
+   0.98297309968390179,
+   /* Period 35 */
+   1,
+   0.98392958859862967,
+   0.9362348706397372,
+   0.8584487936018661,
+   0.75307146600361097,
+   0.62348980185873359,
+   0.47386866247299869,
+   0.30901699437494745,
+   0.13423326581765554,
+   -0.044864830350514862,
+   -0.22252093395631434,
+   -0.39302503165392333,
+   -0.55089698145210242,
+   -0.69106264898686465,
+   -0.80901699437494734,
+   -0.90096886790241903,
+   -0.96396286069585324,
+   -0.99597429399523907,
+   -0.99597429399523907,
+   -0.96396286069585335,
+   -0.90096886790241915,
+   -0.80901699437494756,
+   -0.69106264898686509,
+   -0.55089698145210264,
+   -0.39302503165392377,
+   -0.22252093395631459,
+   -0.044864830350515104,
+   0.1342332658176553,
+   0.30901699437494723,
+   0.47386866247299847,
+   0.62348980185873337,
+   0.75307146600361075,
+   0.85844879360186599,
+   0.93623487063973709,
+   0.98392958859862967,
+   /* Period 36 */
+   1,
+   0.98480775301220802,
+   0.93969262078590843,
+   0.86602540378443871,
+   0.76604444311897801,
+   0.64278760968653936,
+   0.50000000000000011,
+   0.34202014332566882,
+   0.17364817766693041,
+   6.123233995736766e-17,
+   -0.1736481776669303,
+   -0.34202014332566849,
+   -0.49999999999999978,
+   -0.64278760968653936,
+   -0.7660444431189779,
+   -0.86602540378443849,
+   -0.93969262078590832,
+   -0.98480775301220802,
+   -1,
+   -0.98480775301220813,
+   -0.93969262078590843,
+   -0.8660254037844386,
+   -0.76604444311897835,
+   -0.64278760968653947,
+   -0.50000000000000044,
+   -0.34202014332566855,
+   -0.17364817766693033,
+   -1.8369701987210297e-16,
+   0.17364817766692997,
+   0.34202014332566899,
+   0.49999999999999933,
+   0.64278760968653925,
+   0.76604444311897779,
+   0.86602540378443882,
+   0.93969262078590843,
+   0.98480775301220802,
+   /* Period 37 */
+   1,
+   0.98561591034770846,
+   0.94287744546108421,
+   0.87301411316118815,
+   0.77803575431843952,
+   0.66067472339008149,
+   0.52430728355723166,
+   0.37285647778030861,
+   0.21067926999572642,
+   0.042441203196148462,
+   -0.12701781974687876,
+   -0.2928227712765501,
+   -0.45020374481767339,
+   -0.59463317630428658,
+   -0.72195609395452442,
+   -0.82850964924384207,
+   -0.91122849038813558,
+   -0.96773294693349887,
+   -0.99639748854252652,
+   -0.99639748854252652,
+   -0.96773294693349887,
+   -0.91122849038813569,
+   -0.82850964924384241,
+   -0.72195609395452465,
+   -0.59463317630428647,
+   -0.45020374481767361,
+   -0.29282277127655032,
+   -0.1270178197468792,
+   0.042441203196148219,
+   0.21067926999572661,
+   0.37285647778030839,
+   0.52430728355723111,
+   0.66067472339008115,
+   0.77803575431843952,
+   0.87301411316118838,
+   0.9428774454610841,
+   0.98561591034770835,
+   /* Period 38 */
+   1,
+   0.98636130340272232,
+   0.94581724170063464,
+   0.87947375120648907,
+   0.78914050939639357,
+   0.6772815716257411,
+   0.54694815812242692,
+   0.40169542465296953,
+   0.24548548714079924,
+   0.082579345472332394,
+   -0.082579345472332269,
+   -0.2454854871407989,
+   -0.40169542465296942,
+   -0.54694815812242703,
+   -0.67728157162574087,
+   -0.78914050939639346,
+   -0.87947375120648896,
+   -0.94581724170063475,
+   -0.98636130340272232,
+   -1,
+   -0.98636130340272243,
+   -0.94581724170063475,
+   -0.8794737512064893,
+   -0.78914050939639391,
+   -0.6772815716257411,
+   -0.54694815812242692,
+   -0.40169542465296904,
+   -0.24548548714079912,
+   -0.082579345472332741,
+   0.082579345472332366,
+   0.24548548714079879,
+   0.4016954246529687,
+   0.54694815812242659,
+   0.67728157162574121,
+   0.78914050939639391,
+   0.87947375120648874,
+   0.94581724170063464,
+   0.98636130340272243,
+   /* Period 39 */
+   1,
+   0.98705026263791285,
+   0.94853644194714548,
+   0.88545602565320991,
+   0.79944276340350118,
+   0.69272435350959938,
+   0.56806474673115592,
+   0.42869256140305423,
+   0.27821746391645275,
+   0.12053668025532301,
+   -0.040265940109415123,
+   -0.20002569377604412,
+   -0.35460488704253545,
+   -0.50000000000000022,
+   -0.63244537559537717,
+   -0.74851074817110086,
+   -0.8451900855437946,
+   -0.91997944365882423,
+   -0.97094181742605201,
+   -0.99675730813420993,
+   -0.99675730813421004,
+   -0.97094181742605201,
+   -0.91997944365882445,
+   -0.84519008554379504,
+   -0.7485107481711013,
+   -0.63244537559537706,
+   -0.49999999999999961,
+   -0.3546048870425359,
+   -0.20002569377604457,
+   -0.040265940109415144,
+   0.12053668025532233,
+   0.27821746391645208,
+   0.42869256140305378,
+   0.56806474673115559,
+   0.69272435350959927,
+   0.79944276340350118,
+   0.88545602565321002,
+   0.94853644194714559,
+   0.98705026263791285,
+   /* Period 40 */
+   1,
+   0.98768834059513777,
+   0.95105651629515353,
+   0.8910065241883679,
+   0.80901699437494745,
+   0.70710678118654757,
+   0.58778525229247314,
+   0.4539904997395468,
+   0.30901699437494745,
+   0.15643446504023092,
+   6.123233995736766e-17,
+   -0.15643446504023059,
+   -0.30901699437494734,
+   -0.45399049973954669,
+   -0.58778525229247303,
+   -0.70710678118654746,
+   -0.80901699437494734,
+   -0.89100652418836779,
+   -0.95105651629515353,
+   -0.98768834059513766,
+   -1,
+   -0.98768834059513777,
+   -0.95105651629515375,
+   -0.8910065241883679,
+   -0.80901699437494756,
+   -0.70710678118654768,
+   -0.58778525229247325,
+   -0.45399049973954692,
+   -0.30901699437494756,
+   -0.15643446504023104,
+   -1.8369701987210297e-16,
+   0.15643446504023067,
+   0.30901699437494723,
+   0.45399049973954664,
+   0.58778525229247292,
+   0.70710678118654735,
+   0.80901699437494734,
+   0.89100652418836779,
+   0.95105651629515353,
+   0.98768834059513766,
+   /* Period 41 */
+   1,
+   0.98828042378034853,
+   0.95339639205493054,
+   0.8961655569610556,
+   0.81792936076671763,
+   0.72052159360078705,
+   0.60622541096663807,
+   0.47771981851226297,
+   0.3380168784085027,
+   0.19039110916466842,
+   0.038302733690035493,
+   -0.11468342539840018,
+   -0.26498150219666156,
+   -0.4090686371713399,
+   -0.54356755000122103,
+   -0.66532570016556525,
+   -0.77148917982194298,
+   -0.8595696069872012,
+   -0.92750245110209462,
+   -0.97369542387777896,
+   -0.99706580118374044,
+   -0.99706580118374044,
+   -0.97369542387777919,
+   -0.92750245110209473,
+   -0.85956960698720131,
+   -0.77148917982194287,
+   -0.66532570016556536,
+   -0.54356755000122159,
+   -0.40906863717134012,
+   -0.26498150219666156,
+   -0.11468342539840087,
+   0.03830273369003525,
+   0.19039110916466861,
+   0.33801687840850247,
+   0.47771981851226297,
+   0.60622541096663762,
+   0.72052159360078694,
+   0.81792936076671774,
+   0.89616555696105549,
+   0.95339639205493054,
+   0.98828042378034842,
+   /* Period 42 */
+   1,
+   0.98883082622512852,
+   0.95557280578614068,
+   0.90096886790241915,
+   0.82623877431599491,
+   0.73305187182982634,
+   0.62348980185873359,
+   0.50000000000000011,
+   0.36534102436639498,
+   0.22252093395631445,
+   0.074730093586424393,
+   -0.074730093586424046,
+   -0.22252093395631434,
+   -0.3653410243663951,
+   -0.49999999999999978,
+   -0.62348980185873348,
+   -0.73305187182982634,
+   -0.82623877431599502,
+   -0.90096886790241903,
+   -0.95557280578614057,
+   -0.98883082622512852,
+   -1,
+   -0.98883082622512863,
+   -0.95557280578614079,
+   -0.90096886790241915,
+   -0.82623877431599491,
+   -0.73305187182982623,
+   -0.62348980185873371,
+   -0.50000000000000044,
+   -0.36534102436639487,
+   -0.22252093395631459,
+   -0.074730093586424726,
+   0.074730093586424365,
+   0.22252093395631423,
+   0.36534102436639537,
+   0.49999999999999933,
+   0.62348980185873337,
+   0.73305187182982656,
+   0.82623877431599446,
+   0.90096886790241903,
+   0.95557280578614057,
+   0.98883082622512841,
+   /* Period 43 */
+   1,
+   0.98934336807511025,
+   0.95760059990840596,
+   0.90544823749314662,
+   0.83399781788987792,
+   0.74477218274378187,
+   0.63967302155889127,
+   0.52094034048793025,
+   0.39110472049015599,
+   0.25293338239168067,
+   0.10937120837787452,
+   -0.036522023057658504,
+   -0.18163685097943635,
+   -0.32288040477144636,
+   -0.45724232330463849,
+   -0.58185891555795266,
+   -0.69407419522063396,
+   -0.79149648842925402,
+   -0.87204940814380771,
+   -0.93401610873254792,
+   -0.97607587755592706,
+   -0.99733228366355164,
+   -0.99733228366355176,
+   -0.97607587755592728,
+   -0.93401610873254803,
+   -0.8720494081438076,
+   -0.79149648842925391,
+   -0.69407419522063407,
+   -0.58185891555795288,
+   -0.45724232330463871,
+   -0.32288040477144664,
+   -0.18163685097943705,
+   -0.036522023057658747,
+   0.10937120837787428,
+   0.25293338239168045,
+   0.39110472049015554,
+   0.52094034048793048,
+   0.63967302155889127,
+   0.74477218274378176,
+   0.8339978178898777,
+   0.9054482374931464,
+   0.95760059990840574,
+   0.98934336807511014,
+   /* Period 44 */
+   1,
+   0.98982144188093268,
+   0.95949297361449737,
+   0.90963199535451844,
+   0.84125353283118121,
+   0.75574957435425827,
+   0.6548607339452851,
+   0.54064081745559767,
+   0.41541501300188644,
+   0.28173255684142978,
+   0.14231483827328512,
+   2.8327694488239898e-16,
+   -0.142314838273285,
+   -0.28173255684142967,
+   -0.41541501300188632,
+   -0.54064081745559722,
+   -0.65486073394528499,
+   -0.75574957435425816,
+   -0.84125353283118109,
+   -0.90963199535451822,
+   -0.95949297361449737,
+   -0.98982144188093268,
+   -1,
+   -0.9898214418809328,
+   -0.95949297361449748,
+   -0.90963199535451833,
+   -0.84125353283118121,
+   -0.75574957435425838,
+   -0.65486073394528521,
+   -0.54064081745559744,
+   -0.41541501300188716,
+   -0.28173255684142973,
+   -0.14231483827328523,
+   -1.8369701987210297e-16,
+   0.14231483827328487,
+   0.28173255684142934,
+   0.41541501300188605,
+   0.54064081745559789,
+   0.65486073394528455,
+   0.75574957435425782,
+   0.84125353283118121,
+   0.909631995354518,
+   0.95949297361449737,
+   0.98982144188093268,
+   /* Period 45 */
+   1,
+   0.99026806874157036,
+   0.96126169593831889,
+   0.91354545764260087,
+   0.84804809615642596,
+   0.76604444311897801,
+   0.66913060635885824,
+   0.55919290347074679,
+   0.43837114678907746,
+   0.30901699437494745,
+   0.17364817766693041,
+   0.03489949670250108,
+   -0.10452846326765333,
+   -0.24192189559966779,
+   -0.37460659341591207,
+   -0.49999999999999978,
+   -0.61566147532565829,
+   -0.71933980033865119,
+   -0.80901699437494734,
+   -0.88294759285892677,
+   -0.93969262078590832,
+   -0.97814760073380569,
+   -0.9975640502598242,
+   -0.99756405025982431,
+   -0.97814760073380569,
+   -0.93969262078590843,
+   -0.88294759285892688,
+   -0.80901699437494756,
+   -0.71933980033865108,
+   -0.61566147532565807,
+   -0.50000000000000044,
+   -0.37460659341591229,
+   -0.24192189559966779,
+   -0.10452846326765336,
+   0.034899496702501281,
+   0.17364817766692997,
+   0.30901699437494723,
+   0.4383711467890774,
+   0.55919290347074624,
+   0.66913060635885779,
+   0.76604444311897779,
+   0.8480480961564254,
+   0.91354545764260098,
+   0.96126169593831867,
+   0.99026806874157025,
+   /* Period 46 */
+   1,
+   0.99068594603633076,
+   0.96291728734779924,
+   0.91721130150545305,
+   0.85441940454648857,
+   0.7757112907044198,
+   0.68255314321865412,
+   0.57668032211486719,
+   0.4600650377311522,
+   0.33487961217098627,
+   0.20345601305263375,
+   0.068242413364671226,
+   -0.068242413364670879,
+   -0.20345601305263386,
+   -0.33487961217098616,
+   -0.46006503773115209,
+   -0.57668032211486708,
+   -0.68255314321865423,
+   -0.77571129070441969,
+   -0.85441940454648835,
+   -0.91721130150545305,
+   -0.96291728734779924,
+   -0.99068594603633064,
+   -1,
+   -0.99068594603633076,
+   -0.96291728734779924,
+   -0.91721130150545294,
+   -0.85441940454648879,
+   -0.7757112907044198,
+   -0.68255314321865412,
+   -0.57668032211486719,
+   -0.4600650377311527,
+   -0.33487961217098638,
+   -0.20345601305263367,
+   -0.068242413364670462,
+   0.068242413364670976,
+   0.20345601305263331,
+   0.33487961217098605,
+   0.46006503773115159,
+   0.57668032211486697,
+   0.68255314321865423,
+   0.77571129070441958,
+   0.85441940454648857,
+   0.91721130150545283,
+   0.96291728734779902,
+   0.99068594603633076,
+   /* Period 47 */
+   1,
+   0.99107748815478014,
+   0.96446917505437657,
+   0.92064988667642877,
+   0.86040157926013938,
+   0.784799385278661,
+   0.69519242767464229,
+   0.59317974472935531,
+   0.48058175518668383,
+   0.3594077728375128,
+   0.23182015026752842,
+   0.10009569162409844,
+   -0.033414977007674519,
+   -0.16632935458313003,
+   -0.29627558088563383,
+   -0.42093476242833489,
+   -0.53808235316337261,
+   -0.64562785155880242,
+   -0.74165210564795758,
+   -0.82444156034176008,
+   -0.89251883585988112,
+   -0.9446690916079189,
+   -0.97996170503658675,
+   -0.99776687862315316,
+   -0.99776687862315316,
+   -0.97996170503658686,
+   -0.94466909160791879,
+   -0.89251883585988145,
+   -0.82444156034176053,
+   -0.74165210564795747,
+   -0.64562785155880253,
+   -0.53808235316337283,
+   -0.42093476242833511,
+   -0.29627558088563405,
+   -0.16632935458313006,
+   -0.033414977007674547,
+   0.10009569162409843,
+   0.23182015026752839,
+   0.35940777283751218,
+   0.48058175518668322,
+   0.59317974472935475,
+   0.69519242767464184,
+   0.78479938527866122,
+   0.86040157926013916,
+   0.92064988667642866,
+   0.96446917505437646,
+   0.99107748815478003,
+   /* Period 48 */
+   1,
+   0.99144486137381038,
+   0.96592582628906831,
+   0.92387953251128674,
+   0.86602540378443871,
+   0.79335334029123517,
+   0.70710678118654757,
+   0.60876142900872066,
+   0.50000000000000011,
+   0.38268343236508984,
+   0.25881904510252074,
+   0.13052619222005171,
+   6.123233995736766e-17,
+   -0.1305261922200516,
+   -0.25881904510252063,
+   -0.3826834323650895,
+   -0.49999999999999978,
+   -0.60876142900872066,
+   -0.70710678118654746,
+   -0.79335334029123505,
+   -0.86602540378443871,
+   -0.92387953251128674,
+   -0.9659258262890682,
+   -0.99144486137381038,
+   -1,
+   -0.99144486137381038,
+   -0.96592582628906831,
+   -0.92387953251128685,
+   -0.86602540378443882,
+   -0.79335334029123517,
+   -0.70710678118654791,
+   -0.60876142900872088,
+   -0.50000000000000044,
+   -0.3826834323650895,
+   -0.25881904510252063,
+   -0.13052619222005163,
+   -1.8369701987210297e-16,
+   0.13052619222005127,
+   0.2588190451025203,
+   0.38268343236508917,
+   0.50000000000000011,
+   0.60876142900871988,
+   0.70710678118654735,
+   0.79335334029123494,
+   0.86602540378443837,
+   0.92387953251128685,
+   0.96592582628906809,
+   0.99144486137381038,
+   /* Period 49 */
+   1,
+   0.99179001382324616,
+   0.96729486303902945,
+   0.92691675734602175,
+   0.87131870412338941,
+   0.80141362186795662,
+   0.7183493500977276,
+   0.62348980185873359,
+   0.51839256831052516,
+   0.40478334312239378,
+   0.28452758663103245,
+   0.15959989503337954,
+   0.032051577571655332,
+   -0.096023025907681761,
+   -0.22252093395631434,
+   -0.34536505442130749,
+   -0.46253829024083509,
+   -0.57211666012216977,
+   -0.6723008902613169,
+   -0.7614459583691342,
+   -0.8380881048918406,
+   -0.90096886790241903,
+   -0.94905574701066853,
+   -0.98155915699106533,
+   -0.99794539275033634,
+   -0.99794539275033634,
+   -0.98155915699106533,
+   -0.94905574701066864,
+   -0.90096886790241915,
+   -0.83808810489184082,
+   -0.76144595836913465,
+   -0.67230089026131701,
+   -0.57211666012217,
+   -0.46253829024083531,
+   -0.34536505442130733,
+   -0.22252093395631459,
+   -0.096023025907681567,
+   0.03205157757165486,
+   0.1595998950333784,
+   0.284527586631032,
+   0.40478334312239372,
+   0.51839256831052449,
+   0.62348980185873337,
+   0.71834935009772705,
+   0.80141362186795595,
+   0.87131870412338941,
+   0.92691675734602164,
+   0.96729486303902934,
+   0.99179001382324605,
+   /* Period 50 */
+   1,
+   0.99211470131447788,
+   0.96858316112863108,
+   0.92977648588825146,
+   0.87630668004386358,
+   0.80901699437494745,
+   0.72896862742141155,
+   0.63742398974868975,
+   0.53582679497899655,
+   0.42577929156507266,
+   0.30901699437494745,
+   0.18738131458572474,
+   0.062790519529313527,
+   -0.062790519529313402,
+   -0.1873813145857246,
+   -0.30901699437494712,
+   -0.42577929156507272,
+   -0.53582679497899688,
+   -0.63742398974868975,
+   -0.72896862742141133,
+   -0.80901699437494734,
+   -0.87630668004386358,
+   -0.92977648588825135,
+   -0.96858316112863097,
+   -0.99211470131447776,
+   -1,
+   -0.99211470131447788,
+   -0.96858316112863119,
+   -0.92977648588825146,
+   -0.87630668004386347,
+   -0.80901699437494778,
+   -0.72896862742141177,
+   -0.63742398974868952,
+   -0.53582679497899632,
+   -0.42577929156507216,
+   -0.30901699437494756,
+   -0.18738131458572463,
+   -0.062790519529313207,
+   0.062790519529312833,
+   0.18738131458572427,
+   0.30901699437494723,
+   0.42577929156507183,
+   0.53582679497899677,
+   0.6374239897486893,
+   0.72896862742141122,
+   0.80901699437494734,
+   0.87630668004386314,
+   0.92977648588825146,
+   0.96858316112863097,
+   0.99211470131447776
+};
+
+void TA_INT_HT_DFT( const double *smoothPrice,
+                    int           smoothPriceIdx,
+                    int           smoothPriceSize,
+                    int           period,
+                    double       *realPart,
+                    double       *imagPart )
+{
+   const double *sinRow, *cosRow;
+   double real, imag, angle, price;
+   int i, nbBeforeWrap;
+
+   real = 0.0;
+   imag = 0.0;
+
+   if( (period > TA_HT_DFT_MAX_PERIOD) || (period > smoothPriceSize) )
+   {
+      /* Not expected (the period is never more than 50), keep the
+       * original calculation.
+       */
+      angle = std_atan(1)*8.0;
+      for( i=0; i < period; i++ )
+      {
+         price = smoothPrice[smoothPriceIdx];
+         real += std_sin(((double)i*angle)/(double)period)*price;
+         imag += std_cos(((double)i*angle)/(double)period)*price;
+         if( smoothPriceIdx == 0 )
+            smoothPriceIdx = smoothPriceSize-1;
+         else
+            smoothPriceIdx--;
+      }
+   }
+   else if( period > 0 )
+   {
+      sinRow = &TA_HTDFTSin[(period*(period-1))/2];
+      cosRow = &TA_HTDFTCos[(period*(period-1))/2];
+
+      /* The prices are taken backward from the circular buffer:
+       * first down to its start, then from its end. The sums are
+       * done in the same order as the original loop.
+       */
+      nbBeforeWrap = smoothPriceIdx+1;
+      if( nbBeforeWrap > period )
+         nbBeforeWrap = period;
+
+      for( i=0; i < nbBeforeWrap; i++ )
+      {
+         price = smoothPrice[smoothPriceIdx-i];
+         real += sinRow[i]*price;
+         imag += cosRow[i]*price;
+      }
+      for( ; i < period; i++ )
+      {
+         price = smoothPrice[smoothPriceIdx+smoothPriceSize-i];
+         real += sinRow[i]*price;
+         imag += cosRow[i]*price;
+      }
+   }
+
+   *realPart = real;
+   *imagPart = imag;
+}
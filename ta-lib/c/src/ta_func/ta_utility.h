@@ -69,6 +69,36 @@ TA_RetCode TA_S_INT_EMA( int          startIdx,
                          double      *outReal );
 #endif
 
+/* Calculate a Relative Strength Index.
+ * This is an internal version, parameter are assumed validated.
+ * (startIdx and endIdx cannot be -1).
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_RSI( int           startIdx,
+                       int           endIdx,
+                       const double *inReal,
+                       int           optInTimePeriod, 
+                       int          *outBegIdx,
+                       int          *outNBElement,
+                       double       *outReal );
+
+TA_RetCode TA_S_INT_RSI( int          startIdx,
+                         int          endIdx,
+                         const float *inReal,
+                         int          optInTimePeriod, 
+                         int         *outBegIdx,
+                         int         *outNBElement,
+                         double      *outReal );
+#endif
+
+/* Copies of TA_INT_SMA, TA_INT_EMA and TA_INT_RSI specialized for the most
+ * used periods (generated by gen_code, see ta_fixed_period.c).
+ * Not needed to build gen_code itself.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( TA_GEN_CODE )
+   #include "ta_fixed_period.h"
+#endif
+
 /* Calculate a MACD
  * This is an internal version, parameter are assumed validated.
  * (startIdx and endIdx cannot be -1).
@@ -149,6 +179,29 @@ TA_RetCode TA_S_INT_VAR( int           startIdx,
                          double       *outReal );
 #endif
 
+/* Internal quantile function (QUANTILE, MEDIAN and MAD). */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_QUANTILE( int           startIdx,
+                            int           endIdx,
+                            const double *inReal,
+                            int           optInTimePeriod,
+                            double        optInQuantile,
+                            int           calcAbsDev,
+                            int          *outBegIdx,
+                            int          *outNBElement,
+                            double       *outReal );
+
+TA_RetCode TA_S_INT_QUANTILE( int           startIdx,
+                              int           endIdx,
+                              const float  *inReal,
+                              int           optInTimePeriod,
+                              double        optInQuantile,
+                              int           calcAbsDev,
+                              int          *outBegIdx,
+                              int          *outNBElement,
+                              double       *outReal );
+#endif
+
 /* A function to calculate a standard deviation.
  *
  * This function allows speed optimization when the
@@ -301,6 +354,49 @@ void TA_S_INT_stddev_using_precalc_ma( const float  *inReal,
 #define DO_HILBERT_ODD(varName,input)  DO_HILBERT_TRANSFORM(varName,input,Odd)
 #define DO_HILBERT_EVEN(varName,input) DO_HILBERT_TRANSFORM(varName,input,Even)
 
+/* Dominant cycle phase of HT_DCPHASE, HT_SINE and HT_TRENDMODE.
+ *
+ * The last 'period' smoothed prices are multiplied by the sine (realPart)
+ * and cosine (imagPart) of 'i*360/period' degrees. The C version takes
+ * these sine and cosine from tables generated by gen_code (ta_ht_dft.c)
+ * instead of calling std_sin/std_cos for every price of every bar.
+ */
+#define TA_HT_DFT_MAX_PERIOD 50
+#define TA_HT_DFT_TABLE_SIZE ((TA_HT_DFT_MAX_PERIOD*(TA_HT_DFT_MAX_PERIOD+1))/2)
+
+#if defined( _MANAGED ) || defined( _JAVA )
+#define DO_HT_DFT(smoothPrice,period,realPart,imagPart) { \
+         int dftIdx, dftI; \
+         double dftConst, dftAngle, dftPrice; \
+         dftConst = std_atan(1)*8.0; \
+         realPart = 0.0; \
+         imagPart = 0.0; \
+         dftIdx = smoothPrice##_Idx; \
+         for( dftI=0; dftI < period; dftI++ ) \
+         { \
+            dftAngle  = ((double)dftI*dftConst)/(double)period; \
+            dftPrice  = smoothPrice[dftIdx]; \
+            realPart += std_sin(dftAngle)*dftPrice; \
+            imagPart += std_cos(dftAngle)*dftPrice; \
+            if( dftIdx == 0 ) \
+               dftIdx = SMOOTH_PRICE_SIZE-1; \
+            else \
+               dftIdx--; \
+         } \
+         }
+#else
+void TA_INT_HT_DFT( const double *smoothPrice,
+                    int           smoothPriceIdx,
+                    int           smoothPriceSize,
+                    int           period,
+                    double       *realPart,
+                    double       *imagPart );
+
+#define DO_HT_DFT(smoothPrice,period,realPart,imagPart) \
+         TA_INT_HT_DFT( smoothPrice, smoothPrice##_Idx, SMOOTH_PRICE_SIZE, \
+                        period, &realPart, &imagPart )
+#endif
+
 /* Convert a period into the equivalent k:
  *
  *    k = 2 / (period + 1)
@@ -42,6 +42,7 @@
  *  CM       Craig Miller  (c-miller@users.sourceforge.net)
  *  RG       Richard Gomes
  *  AB       Anatol Belski (ab@php.net)
+ *  AG       agent <agent@local>
  *
  * Change history:
  *
@@ -74,6 +75,10 @@
  *  061608 MF    Add code to preserve proprietary code marker for TA-Lib pro.
  *  071808 MF    Add generation for Add-Ins express product (TA-Lib Pro only).
  *  082712 AB    Implemented java code generation on linux.
+ *  101826 AG    Add generation of ta_ht_dft.c (HT_* sine/cosine tables).
+ *  101826 AG    Add generation of ta_lib.hpp (C++ interface).
+ *  101826 AG    Add generation of ta_fixed_period.c/.h (fixed period kernels).
+ *  101826 AG    The TA functions account their calls to the statistics.
  */
 
 /* Description:
@@ -99,6 +104,7 @@
 #include <stdarg.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
                                                                                 
 #if !defined(__WIN32__) && !defined(__MSDOS__) && !defined(WIN32)
    #include <unistd.h>
@@ -193,10 +199,13 @@ FileHandle *gOutFunc_SWG;      /* For SWIG */
 FileHandle *gOutFunc_XML;      /* For "ta_func_api.xml" */
 FileHandle *gOutFuncAPI_C;     /* For "ta_func_api.c" */
 FileHandle *gOutMakefile_AM;   /* For "Makefile.am" */
+FileHandle *gOutCpp_HPP;       /* For "ta_lib.hpp" */
 
 FileHandle *gOutCore_Java;       /* For Core.Java */
 FileHandle *gOutJavaDefs_H;      /* For "java_defs.h" */
 FileHandle *gOutFunc_Annotation; /* For "CoreAnnotated.java" */
+FileHandle *gOutFunc_Invokers;   /* For "TaFuncInvokers.java" */
+FileHandle *gOutCoreVector_Java; /* For "CoreVector.java" */
 
 #ifdef _MSC_VER
 /* The following files are generated only on Windows platform. */
@@ -221,6 +230,26 @@ static void genJavaCodePhase2( const TA_FuncInfo *funcInfo );
 /* To generate CoreAnnotated.java */
 static void printJavaFunctionAnnotation(const TA_FuncInfo *funcInfo);
 
+/* To generate TaFuncInvokers.java */
+static void printJavaFunctionInvoker(const TA_FuncInfo *funcInfo);
+
+/* To generate CoreVector.java */
+static void printJavaVectorKernel(const TA_FuncInfo *funcInfo);
+
+/* Generate the functions of ta_lib.hpp */
+static void printCppFunction( FILE *out, const TA_FuncInfo *funcInfo );
+static void printCppCall( FILE *out, const TA_FuncInfo *funcInfo,
+                          unsigned int inputIsSinglePrecision );
+static void printCppOptInputArgs( FILE *out, const TA_FuncInfo *funcInfo,
+                                  unsigned int withType, const char *separator );
+
+/* Generate the TA_XXX/TA_S_XXX accounting the calls to the statistics. */
+static void printStatsWrapper( FILE *out, const TA_FuncInfo *funcInfo,
+                               unsigned int inputIsSinglePrecision );
+
+#define FUNCNAME_SIZE 100
+static void getJavaFuncName(char *funcName, const TA_FuncInfo *funcInfo);
+
 
 typedef void (*TA_ForEachGroup)( const char *groupName,
                                  unsigned int index,
@@ -250,6 +279,9 @@ static void doForEachUnstableFunction( const TA_FuncInfo *funcInfo,
 static void doDefsFile( void );
 
 static int gen_retcode( void );
+static int gen_htDFT( void );
+static void printHTDFTTable( FILE *out, const char *name, int useCos );
+static int gen_fixedPeriod( void );
 
 static void printIndent( FILE *out, unsigned int indent );
 
@@ -377,6 +409,12 @@ extern const TA_OptInputParameterInfo TA_DEF_UI_MA_Method;
  */
 int genPrefix = 0;
 
+/* Appended to the name of the C function printed by printFunc. The
+ * calculation of TA_XXX is in the static TA_XXX_Calc, called by the
+ * TA_XXX generated by printStatsWrapper.
+ */
+static const char *gFuncNameSuffix = "";
+
 void print( FILE *out, const char *text, ... )
 {
    va_list arglist;
@@ -449,9 +487,14 @@ int main(int argc, char* argv[])
          printf( "    12) ta-lib/c/ide/msvc/lib_proj/ta_func/ta_func.dsp (Win32 only)\n" );
          printf( "    13) ta-lib/java/src/com/tictactec/ta/lib/Core.java (Win32 only)\n" );
          printf( "    14) ta-lib/java/src/com/tictactec/ta/lib/CoreAnnotated.java (Win32 only)\n" );
-         printf( "    15) ta-lib/ta_func_api.xml\n" );
-         printf( "    16) ta-lib/c/src/ta_abstract/ta_func_api.c\n" );
-         printf( "    17) ... and more ...");
+         printf( "    15) ta-lib/java/src/com/tictactec/ta/lib/meta/TaFuncInvokers.java\n" );
+         printf( "    16) ta-lib/java/src-vector/com/tictactec/ta/lib/CoreVector.java\n" );
+         printf( "    17) ta-lib/ta_func_api.xml\n" );
+         printf( "    18) ta-lib/c/src/ta_abstract/ta_func_api.c\n" );
+         printf( "    19) ta-lib/c/src/ta_func/ta_ht_dft.c\n" );
+         printf( "    20) ta-lib/c/include/ta_lib.hpp\n" );
+         printf( "    21) ta-lib/c/src/ta_func/ta_fixed_period.c/.h\n" );
+         printf( "    22) ... and more ...");
          printf( "\n" );
          printf( "  The function header, parameters and validation code of all TA\n" );
          printf( "  function in c/src/ta_func are also updated.\n" );
@@ -861,6 +904,20 @@ static int genCode(int argc, char* argv[])
       return -1;
    }
 
+   /* Create ta_ht_dft.c */
+   if( gen_htDFT() != 0 )
+   {
+      printf( "\nCannot generate src/ta_func/ta_ht_dft.c\n" );
+      return -1;
+   }
+
+   /* Create ta_fixed_period.c and ta_fixed_period.h */
+   if( gen_fixedPeriod() != 0 )
+   {
+      printf( "\nCannot generate src/ta_func/ta_fixed_period.c\n" );
+      return -1;
+   }
+
    /* Create "ta_func.h" */
    gOutFunc_H = fileOpen( ta_fs_path(3, "..", "include", "ta_func.h"),
                           ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_func.h.template"),
@@ -872,6 +929,17 @@ static int genCode(int argc, char* argv[])
       return -1;
    }
 
+   /* Create "ta_lib.hpp" */
+   gOutCpp_HPP = fileOpen( ta_fs_path(3, "..", "include", "ta_lib.hpp"),
+                           ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_lib.hpp.template"),
+                           FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+   if( gOutCpp_HPP == NULL )
+   {
+      printf( "\nCannot access [%s]\n", gToOpen );
+      return -1;
+   }
+
    gOutFunc_XML = fileOpen( ta_fs_path(3, "..", "..", "ta_func_api.xml"), NULL, FILE_WRITE|WRITE_ON_CHANGE_ONLY );
    if(gOutFunc_XML == NULL)
    {
@@ -1009,6 +1077,26 @@ static int genCode(int argc, char* argv[])
 	      printf( "\nCannot access CoreAnnotated.java" );
       }
 
+      /* Create "TaFuncInvokers.java" */
+      gOutFunc_Invokers = fileOpen( ta_fs_path(10, "..", "..", "java", "src", "com", "tictactec", "ta", "lib", "meta", "TaFuncInvokers.java"),
+                                    ta_fs_path(5, "..", "src", "ta_abstract", "templates", "TaFuncInvokers.java.template"),
+                                    FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+      if(gOutFunc_Invokers == NULL)
+      {
+	      printf( "\nCannot access TaFuncInvokers.java" );
+      }
+
+      /* Create "CoreVector.java" */
+      gOutCoreVector_Java = fileOpen( ta_fs_path(9, "..", "..", "java", "src-vector", "com", "tictactec", "ta", "lib", "CoreVector.java"),
+                                      ta_fs_path(5, "..", "src", "ta_abstract", "templates", "CoreVector.java.template"),
+                                      FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+      if(gOutCoreVector_Java == NULL)
+      {
+	      printf( "\nCannot access CoreVector.java" );
+      }
+
    /* Re-open the Core.java template. */
    gOutCore_Java = fileOpen( FILE_CORE_JAVA_UNF, FILE_CORE_JAVA_TMP, FILE_WRITE|WRITE_ON_CHANGE_ONLY );
    if( gOutCore_Java == NULL )
@@ -1051,6 +1139,7 @@ static int genCode(int argc, char* argv[])
    /* Close all files who were updated with the list of TA functions. */
    fileClose( gOutFuncList_TXT );
    fileClose( gOutFunc_H );
+   fileClose( gOutCpp_HPP );
    fileClose( gOutFunc_SWG );
    fileClose( gOutFrame_H );
    fileClose( gOutFrame_C );
@@ -1059,6 +1148,8 @@ static int genCode(int argc, char* argv[])
    fileClose( gOutCore_Java );
    fileClose( gOutJavaDefs_H );
    fileClose( gOutFunc_Annotation );
+   fileClose( gOutFunc_Invokers );
+   fileClose( gOutCoreVector_Java );
    fileDelete( FILE_CORE_JAVA_TMP );
 
    #ifdef _MSC_VER
@@ -1726,6 +1817,15 @@ static void doForEachFunctionPhase2( const TA_FuncInfo *funcInfo,
       /* Generate CoreAnnotated */
       printJavaFunctionAnnotation( funcInfo );
 
+      /* Generate TaFuncInvokers */
+      printJavaFunctionInvoker( funcInfo );
+
+      /* Generate the Vector API kernel, if any */
+      printJavaVectorKernel( funcInfo );
+
+      /* Generate the C++ interface */
+      printCppFunction( gOutCpp_HPP->file, funcInfo );
+
    #ifdef _MSC_VER
       /* Generate the functions declaration for the .NET interface. */
       printFunc( gOutDotNet_H->file, NULL, funcInfo, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0 );
@@ -2083,14 +2183,16 @@ static void printFunc( FILE *out,
          else
          {
             if( inputIsSinglePrecision )
-               sprintf( gTempBuf, "%sTA_RetCode TA_S_%s( int    %s,\n",
+               sprintf( gTempBuf, "%sTA_RetCode TA_S_%s%s( int    %s,\n",
                         prefix? prefix:"",
                         funcName,
+                        gFuncNameSuffix,
                         startIdxString );
             else  
-               sprintf( gTempBuf, "%sTA_RetCode TA_%s( int    %s,\n",
+               sprintf( gTempBuf, "%sTA_RetCode TA_%s%s( int    %s,\n",
                         prefix? prefix:"",                        
                         funcName,
+                        gFuncNameSuffix,
                         startIdxString );
          }
          print( out, gTempBuf );
@@ -2998,7 +3100,9 @@ static void doFuncFile( const TA_FuncInfo *funcInfo )
    print( gOutFunc_C->file, "#elif defined( _JAVA )\n" );
    printFunc( gOutFunc_C->file, NULL, funcInfo, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0 );
    print( gOutFunc_C->file, "#else\n" );
-   printFunc( gOutFunc_C->file, NULL, funcInfo, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0 );
+   gFuncNameSuffix = "_Calc";
+   printFunc( gOutFunc_C->file, "static ", funcInfo, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0 );
+   gFuncNameSuffix = "";
    print( gOutFunc_C->file, "#endif\n" );
 
    /* Insert the internal logic of the function */
@@ -3015,6 +3119,16 @@ static void doFuncFile( const TA_FuncInfo *funcInfo )
    fclose(logicTmp);
    print( gOutFunc_C->file, "\n" );
 
+   /* The entry points of the C library. */
+   print( gOutFunc_C->file, "#if !defined( _MANAGED ) && !defined( _JAVA )\n" );
+   print( gOutFunc_C->file, "extern struct TA_FuncStats TA_STATS_%s;\n", funcInfo->name );
+   print( gOutFunc_C->file, "\n" );
+   printStatsWrapper( gOutFunc_C->file, funcInfo, 0 );
+   print( gOutFunc_C->file, "\n" );
+   printStatsWrapper( gOutFunc_C->file, funcInfo, 1 );
+   print( gOutFunc_C->file, "#endif\n" );
+   print( gOutFunc_C->file, "\n" );
+
    /* Add the suffix at the end of the file. */
    print( gOutFunc_C->file, "#if defined( _MANAGED )\n" );
    print( gOutFunc_C->file, "}}} // Close namespace TicTacTec.TA.Lib\n" );
@@ -3176,6 +3290,14 @@ static int createMSVCProjTemplate( FileHandle *in, FileHandle *out )
          fprintf( outFile, "\n");
          fprintf( outFile, "SOURCE=.." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH "src" TA_FS_SLASH "ta_func" TA_FS_SLASH "ta_utility.c\n");
          fprintf( outFile, "# End Source File\n");
+         fprintf( outFile, "# Begin Source File\n");
+         fprintf( outFile, "\n");
+         fprintf( outFile, "SOURCE=.." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH "src" TA_FS_SLASH "ta_func" TA_FS_SLASH "ta_ht_dft.c\n");
+         fprintf( outFile, "# End Source File\n");
+         fprintf( outFile, "# Begin Source File\n");
+         fprintf( outFile, "\n");
+         fprintf( outFile, "SOURCE=.." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH ".." TA_FS_SLASH "src" TA_FS_SLASH "ta_func" TA_FS_SLASH "ta_fixed_period.c\n");
+         fprintf( outFile, "# End Source File\n");
          fprintf( outFile, "# End Group\n");
          break;
       }
@@ -3245,6 +3367,8 @@ static int createVS2005ProjTemplate( FileHandle *in, FileHandle *out )
       {
          /* Add the "non TA function" source files. */
 	     printVS2005FileNode( outFile, "utility" );
+	     printVS2005FileNode( outFile, "ht_dft" );
+	     printVS2005FileNode( outFile, "fixed_period" );
          fprintf( outFile, "			</Filter>\n");
          break;
       }
@@ -3450,7 +3574,9 @@ static void writeFuncFile( const TA_FuncInfo *funcInfo )
 
    printFunc( out, NULL, funcInfo, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0 );
    print( out, "#else\n" );
-   printFunc( out, "TA_LIB_API ", funcInfo, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+   gFuncNameSuffix = "_Calc";
+   printFunc( out, "static ", funcInfo, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+   gFuncNameSuffix = "";
    print( out, "#endif\n" );
 
    genPrefix = 0;
@@ -3928,6 +4054,318 @@ gen_retcode_exit:
    return retValue; /* Success. */
 }
 
+/* Must be the same as TA_HT_DFT_MAX_PERIOD in ta_utility.h */
+#define HT_DFT_MAX_PERIOD 50
+
+/* The sine and cosine are calculated exactly like in the
+ * original loop of HT_DCPHASE, and printed with enough
+ * digits to get back the same double when compiled.
+ */
+static void printHTDFTTable( FILE *out, const char *name, int useCos )
+{
+   double constDeg2RadBy360, angle;
+   int period, i, nbValue;
+
+   constDeg2RadBy360 = atan(1)*8.0;
+
+   fprintf( out, "static const double %s[TA_HT_DFT_TABLE_SIZE] = {\n", name );
+   nbValue = 0;
+   for( period=1; period <= HT_DFT_MAX_PERIOD; period++ )
+   {
+      fprintf( out, "   /* Period %d */\n", period );
+      for( i=0; i < period; i++ )
+      {
+         angle = ((double)i*constDeg2RadBy360)/(double)period;
+         nbValue++;
+         fprintf( out, "   %.17g%s\n", useCos? cos(angle) : sin(angle),
+                  nbValue == (HT_DFT_MAX_PERIOD*(HT_DFT_MAX_PERIOD+1))/2? "" : "," );
+      }
+   }
+   fprintf( out, "};\n\n" );
+}
+
+static int gen_htDFT( void )
+{
+   FileHandle *out;
+
+   out = fileOpen( ta_fs_path(4, "..", "src", "ta_func", "ta_ht_dft.c"),
+                   ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_ht_dft.c.template"),
+                   FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+   if( out == NULL )
+   {
+      printf( "\nCannot access [%s]\n", gToOpen );
+      return -1;
+   }
+
+   printHTDFTTable( out->file, "TA_HTDFTSin", 0 );
+   printHTDFTTable( out->file, "TA_HTDFTCos", 1 );
+
+   fileClose( out );
+
+   return 0;
+}
+
+/* Internal kernels copied in ta_fixed_period.c with the period
+ * fixed at compile time. A call with one of these periods is
+ * dispatched to its copy, any other period is calculated by the
+ * original kernel.
+ *
+ * Add a period here when it is used often enough to be worth
+ * its copy (the kernel must start with TA_XXX_FIXED_PERIOD).
+ */
+typedef struct
+{
+   const char *fileName; /* In c/src/ta_func */
+   const char *kernel;   /* As in TA_PREFIX(kernel) */
+   int period[8];        /* Zero terminated */
+} FixedPeriodKernel;
+
+static const FixedPeriodKernel fixedPeriodKernels[] =
+{
+   /* SMA, BBANDS and the seed of ATR/NATR. */
+   { "ta_SMA.c", "INT_SMA", { 9, 12, 14, 20, 26, 50, 200, 0 } },
+
+   /* EMA, MACD, DEMA, TEMA and TRIX. */
+   { "ta_EMA.c", "INT_EMA", { 9, 12, 20, 26, 50, 200, 0 } },
+
+   /* RSI. */
+   { "ta_RSI.c", "INT_RSI", { 14, 0 } }
+};
+
+#define NB_FIXED_PERIOD_KERNEL (sizeof(fixedPeriodKernels)/sizeof(FixedPeriodKernel))
+
+/* Print an hand-written kernel of c/src/ta_func with a new name.
+ *
+ * The signature is taken from the C branch ("TA_RetCode TA_PREFIX(kernel)(")
+ * up to its "#endif". The body follows up to the first '}' on the
+ * first column. The declarations of the body end at its first empty
+ * line, where optInTimePeriod is defined as the constant (the
+ * parameter is kept in the signature but not used).
+ *
+ * When 'prefix' is NULL, the signature and body are printed as is
+ * (TA_PREFIX and INPUT_TYPE are defined by the caller). Else only
+ * the prototype is printed with the 'prefix' and 'inputType'.
+ */
+static int printFixedPeriodKernel( FILE *out,
+                                   const FixedPeriodKernel *def,
+                                   int period,
+                                   const char *prefix,
+                                   const char *inputType )
+{
+   FILE *in;
+   char signature[100];
+   char newName[100];
+   char *pos;
+   int state, shift, i, retValue;
+
+   in = fopen( ta_fs_path(4, "..", "src", "ta_func", def->fileName), "r" );
+   if( !in )
+   {
+      printf( "Cannot open [%s]\n", def->fileName );
+      return -1;
+   }
+
+   sprintf( signature, "TA_RetCode TA_PREFIX(%s)(", def->kernel );
+   if( prefix )
+      sprintf( newName, "TA_RetCode %s%s_P%d(", prefix, def->kernel, period );
+   else
+      sprintf( newName, "TA_RetCode TA_PREFIX(%s_P%d)(", def->kernel, period );
+   shift = (int)strlen(newName)-(int)strlen(signature);
+
+   /* state 0: Looking for the signature.
+    *       1: Within the signature.
+    *       2: Within the declarations of the body.
+    *       3: Within the body.
+    */
+   state = 0;
+   retValue = -1;
+   while( fgets( gTempBuf, BUFFER_SIZE, in ) )
+   {
+      if( state == 0 )
+      {
+         if( strncmp( gTempBuf, signature, strlen(signature) ) == 0 )
+         {
+            fprintf( out, "%s%s", newName, &gTempBuf[strlen(signature)] );
+            state = 1;
+         }
+      }
+      else if( state == 1 )
+      {
+         if( strncmp( gTempBuf, "#endif", 6 ) == 0 )
+         {
+            if( prefix )
+            {
+               fprintf( out, ";\n\n" );
+               retValue = 0;
+               break;
+            }
+            state = 2;
+         }
+         else
+         {
+            /* Keep the parameters aligned with the new name. */
+            i = 0;
+            if( shift < 0 )
+            {
+               while( (i < -shift) && (gTempBuf[i] == ' ') )
+                  i++;
+            }
+            else
+               printIndent( out, (unsigned int)shift );
+
+            /* In a prototype, remove the trailing spaces and the
+             * end of line of the last parameter (";" follows).
+             */
+            if( prefix )
+            {
+               pos = &gTempBuf[strlen(gTempBuf)];
+               while( (pos > gTempBuf) && isspace(pos[-1]) )
+                  *(--pos) = '\0';
+               if( pos[-1] != ')' )
+                  strcat( gTempBuf, "\n" );
+            }
+
+            if( inputType && ((pos = strstr( &gTempBuf[i], "INPUT_TYPE" )) != NULL) )
+            {
+               *pos = '\0';
+               fprintf( out, "%s%s%s", &gTempBuf[i], inputType, pos+10 );
+            }
+            else
+               fprintf( out, "%s", &gTempBuf[i] );
+         }
+      }
+      else
+      {
+         if( (state == 2) && ((gTempBuf[0] == '\n') || (gTempBuf[0] == '\r')) )
+         {
+            fprintf( out, "\n   (void)optInTimePeriod;\n" );
+            fprintf( out, "#define optInTimePeriod %d\n", period );
+            state = 3;
+         }
+         fprintf( out, "%s", gTempBuf );
+         if( gTempBuf[0] == '}' )
+         {
+            fprintf( out, "#undef optInTimePeriod\n\n" );
+            retValue = 0;
+            break;
+         }
+      }
+   }
+
+   fclose( in );
+
+   if( retValue != 0 )
+      printf( "Cannot find [%s] in [%s]\n", signature, def->fileName );
+
+   return retValue;
+}
+
+static int gen_fixedPeriod( void )
+{
+   FileHandle *out;
+   const FixedPeriodKernel *def;
+   unsigned int i, j;
+   int pass;
+
+   /* The header with the prototypes and the dispatch. */
+   out = fileOpen( ta_fs_path(4, "..", "src", "ta_func", "ta_fixed_period.h"),
+                   ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_fixed_period.h.template"),
+                   FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+   if( out == NULL )
+   {
+      printf( "\nCannot access [%s]\n", gToOpen );
+      return -1;
+   }
+
+   for( i=0; i < NB_FIXED_PERIOD_KERNEL; i++ )
+   {
+      def = &fixedPeriodKernels[i];
+      for( j=0; def->period[j] != 0; j++ )
+      {
+         for( pass=0; pass < 2; pass++ )
+         {
+            if( printFixedPeriodKernel( out->file, def, def->period[j],
+                                        pass? "TA_S_":"TA_",
+                                        pass? "float":"double" ) != 0 )
+            {
+               fileClose( out );
+               return -1;
+            }
+         }
+      }
+   }
+
+   fprintf( out->file, "#if defined( TA_FIXED_PERIOD_NO_DISPATCH )\n" );
+   for( i=0; i < NB_FIXED_PERIOD_KERNEL; i++ )
+      fprintf( out->file, "   #define TA_%s_FIXED_PERIOD(args)\n", fixedPeriodKernels[i].kernel );
+   fprintf( out->file, "#else\n" );
+   for( i=0; i < NB_FIXED_PERIOD_KERNEL; i++ )
+   {
+      def = &fixedPeriodKernels[i];
+      fprintf( out->file, "   #define TA_%s_FIXED_PERIOD(args) \\\n", def->kernel );
+      fprintf( out->file, "   switch( optInTimePeriod ) \\\n" );
+      fprintf( out->file, "   { \\\n" );
+      for( j=0; def->period[j] != 0; j++ )
+      {
+         sprintf( gTempBuf, "case %d:", def->period[j] );
+         fprintf( out->file, "   %-9s return TA_PREFIX(%s_P%d) args; \\\n",
+                  gTempBuf, def->kernel, def->period[j] );
+      }
+      fprintf( out->file, "   default:  break; \\\n" );
+      fprintf( out->file, "   }\n" );
+   }
+   fprintf( out->file, "#endif\n" );
+
+   fileClose( out );
+
+   /* The copies, for double and float input. */
+   out = fileOpen( ta_fs_path(4, "..", "src", "ta_func", "ta_fixed_period.c"),
+                   ta_fs_path(5, "..", "src", "ta_abstract", "templates", "ta_fixed_period.c.template"),
+                   FILE_WRITE|WRITE_ON_CHANGE_ONLY );
+
+   if( out == NULL )
+   {
+      printf( "\nCannot access [%s]\n", gToOpen );
+      return -1;
+   }
+
+   for( pass=0; pass < 2; pass++ )
+   {
+      if( pass == 0 )
+      {
+         fprintf( out->file, "#define TA_PREFIX(x) TA_##x\n" );
+         fprintf( out->file, "#define INPUT_TYPE   double\n\n" );
+      }
+      else
+      {
+         fprintf( out->file, "#define  USE_SINGLE_PRECISION_INPUT\n" );
+         fprintf( out->file, "#undef   TA_PREFIX\n" );
+         fprintf( out->file, "#define  TA_PREFIX(x) TA_S_##x\n" );
+         fprintf( out->file, "#undef   INPUT_TYPE\n" );
+         fprintf( out->file, "#define  INPUT_TYPE float\n\n" );
+      }
+
+      for( i=0; i < NB_FIXED_PERIOD_KERNEL; i++ )
+      {
+         def = &fixedPeriodKernels[i];
+         for( j=0; def->period[j] != 0; j++ )
+         {
+            if( printFixedPeriodKernel( out->file, def, def->period[j], NULL, NULL ) != 0 )
+            {
+               fileClose( out );
+               return -1;
+            }
+         }
+      }
+   }
+
+   fileClose( out );
+
+   return 0;
+}
+
 const char *doubleToStr( double value )
 {
    int length;
@@ -4481,28 +4919,9 @@ static void printJavaFunctionAnnotation(const TA_FuncInfo *funcInfo)
     TA_IntegerRange *integerRange;
     TA_IntegerList *intList;
 	unsigned int i, j;
-    #define FUNCNAME_SIZE 100
 	char funcName[FUNCNAME_SIZE];
-	   
-    memset(funcName, 0, FUNCNAME_SIZE);
-    if( strlen(funcInfo->name) > (FUNCNAME_SIZE-1) )
-    {
-        printf( "\n*** Error buffer size exceeded (printJavaFunctionAnnotation)\n" );
-        strcpy( funcName, "1A2"); /* Substitute name. Will cause Java compilation to fail */
-    }
-    else
-    {	   
-	   if (funcInfo->camelCaseName==NULL) {
-	      strcpy(funcName, funcInfo->name);
-		  for (i=0; funcName[i]; i++) {
-			funcName[i] = tolower(funcName[i]);
-		  }
-	   } else {
-	     strcpy(funcName, funcInfo->camelCaseName);
-         funcName[0] = tolower(funcName[0]);
-	   }
-    }
 
+    getJavaFuncName( funcName, funcInfo );
 
 	/*
 	 * Generate Lookback method
@@ -4827,7 +5246,616 @@ static void printJavaFunctionAnnotation(const TA_FuncInfo *funcInfo)
 
     fprintf(gOutFunc_Annotation->file, "); }\n\n\n");
 }
+
+static void getJavaFuncName(char *funcName, const TA_FuncInfo *funcInfo)
+{
+	unsigned int i;
+
+    memset(funcName, 0, FUNCNAME_SIZE);
+    if( strlen(funcInfo->name) > (FUNCNAME_SIZE-1) )
+    {
+        printf( "\n*** Error buffer size exceeded (getJavaFuncName)\n" );
+        strcpy( funcName, "1A2"); /* Substitute name. Will cause Java compilation to fail */
+    }
+    else
+    {	   
+	   if (funcInfo->camelCaseName==NULL) {
+	      strcpy(funcName, funcInfo->name);
+		  for (i=0; funcName[i]; i++) {
+			funcName[i] = tolower(funcName[i]);
+		  }
+	   } else {
+	     strcpy(funcName, funcInfo->camelCaseName);
+         funcName[0] = tolower(funcName[0]);
+	   }
+    }
+}
+
+static void printJavaOptInputArgs(const TA_FuncInfo *funcInfo, const char *separator)
+{
+	TA_OptInputParameterInfo *optInputInfo;
+	unsigned int i, nbInteger, nbReal;
+
+	nbInteger = nbReal = 0;
+	for(i=0; i<funcInfo->nbOptInput; i++)
+	{
+		TA_GetOptInputParameterInfo( funcInfo->handle, i, (void*)&optInputInfo );
+		if( i != 0 )
+			fprintf(gOutFunc_Invokers->file, "%s", separator);
+
+		if(optInputInfo->type == TA_OptInput_RealRange)
+			fprintf(gOutFunc_Invokers->file, "optInReal[%d]", nbReal++);
+		else if(optInputInfo->type == TA_OptInput_IntegerRange)
+			fprintf(gOutFunc_Invokers->file, "optInInteger[%d]", nbInteger++);
+		else if(optInputInfo->type == TA_OptInput_IntegerList)
+			fprintf(gOutFunc_Invokers->file, "MA_TYPES[optInInteger[%d]]", nbInteger++);
+		else
+			printf( "Unexpected error 1 (printJavaFunctionInvoker)\n");
+	}
+}
+
+/* Generate a TaFuncInvoker calling the function with its parameters
+ * taken from primitive arrays (see TaFuncInvoker.java for the layout).
+ */
+static void printJavaFunctionInvoker(const TA_FuncInfo *funcInfo)
+{
+	TA_InputParameterInfo *inputInfo;
+	TA_OutputParameterInfo *outputInfo;
+	unsigned int i, j, nbInteger, nbReal;
+	char funcName[FUNCNAME_SIZE];
+	FILE *out;
+
+	static const int priceFlags[6] = { TA_IN_PRICE_OPEN, TA_IN_PRICE_HIGH, TA_IN_PRICE_LOW,
+	                                   TA_IN_PRICE_CLOSE, TA_IN_PRICE_VOLUME, TA_IN_PRICE_OPENINTEREST };
+
+	out = gOutFunc_Invokers->file;
+	getJavaFuncName( funcName, funcInfo );
+
+	fprintf(out, "        invokers.put(\"%s\", new TaFuncInvoker() {\n", funcInfo->name);
+
+	/* Lookback */
+	fprintf(out, "            public int lookback(Core core, int[] optInInteger, double[] optInReal) {\n");
+	fprintf(out, "                return core.%sLookback(", funcName);
+	printJavaOptInputArgs( funcInfo, ", " );
+	fprintf(out, ");\n");
+	fprintf(out, "            }\n\n");
+
+	/* Function */
+	fprintf(out, "            public RetCode call(Core core, int startIdx, int endIdx,\n");
+	fprintf(out, "                                double[][] inReal, int[][] inInteger,\n");
+	fprintf(out, "                                int[] optInInteger, double[] optInReal,\n");
+	fprintf(out, "                                MInteger outBegIdx, MInteger outNBElement,\n");
+	fprintf(out, "                                double[][] outReal, int[][] outInteger) {\n");
+	fprintf(out, "                return core.%s(startIdx, endIdx,\n", funcName);
+
+	nbInteger = nbReal = 0;
+	for(i=0; i<funcInfo->nbInput; i++)
+	{
+		TA_GetInputParameterInfo( funcInfo->handle, i, (void*)&inputInfo );
+		if(inputInfo->type == TA_Input_Price)
+		{
+			if(inputInfo->flags & TA_IN_PRICE_TIMESTAMP)
+				printf( "Unexpected error 2 (printJavaFunctionInvoker)\n");
+			for(j=0; j<6; j++)
+			{
+				if(inputInfo->flags & priceFlags[j])
+					fprintf(out, "                        inReal[%d],\n", nbReal++);
+			}
+		}
+		else if(inputInfo->type == TA_Input_Real)
+			fprintf(out, "                        inReal[%d],\n", nbReal++);
+		else if(inputInfo->type == TA_Input_Integer)
+			fprintf(out, "                        inInteger[%d],\n", nbInteger++);
+		else
+			printf( "Unexpected error 3 (printJavaFunctionInvoker)\n");
+	}
+
+	if( funcInfo->nbOptInput != 0 )
+	{
+		fprintf(out, "                        ");
+		printJavaOptInputArgs( funcInfo, ",\n                        " );
+		fprintf(out, ",\n");
+	}
+
+	fprintf(out, "                        outBegIdx, outNBElement");
+
+	nbInteger = nbReal = 0;
+	for(i=0; i<funcInfo->nbOutput; i++)
+	{
+		TA_GetOutputParameterInfo( funcInfo->handle, i, (void*)&outputInfo );
+		if(outputInfo->type == TA_Output_Real)
+			fprintf(out, ",\n                        outReal[%d]", nbReal++);
+		else if(outputInfo->type == TA_Output_Integer)
+			fprintf(out, ",\n                        outInteger[%d]", nbInteger++);
+		else
+			printf( "Unexpected error 4 (printJavaFunctionInvoker)\n");
+	}
+	fprintf(out, ");\n");
+	fprintf(out, "            }\n");
+	fprintf(out, "        });\n\n");
+}
+
+/* Element-wise functions having a Vector API implementation in
+ * CoreVector.java. The vectors v0, v1... are loaded from the inputs,
+ * in the order they are passed to the function. The operations must
+ * be done in the same order as the scalar code to get the same result.
+ */
+typedef struct
+{
+   const char *name;
+   const char *vectorExpr;
+} JavaVectorKernel;
+
+static const JavaVectorKernel javaVectorKernels[] =
+{
+   /* Math Operators */
+   { "ADD",      "v0.add(v1)" },
+   { "DIV",      "v0.div(v1)" },
+   { "MULT",     "v0.mul(v1)" },
+   { "SUB",      "v0.sub(v1)" },
+
+   /* Math Transform. CEIL and FLOOR have no vector operator. Except
+    * SQRT, the vector operators are approximations that may differ
+    * from java.lang.Math by an ulp (documented in CoreVector).
+    */
+   { "ACOS",     "v0.lanewise(VectorOperators.ACOS)" },
+   { "ASIN",     "v0.lanewise(VectorOperators.ASIN)" },
+   { "ATAN",     "v0.lanewise(VectorOperators.ATAN)" },
+   { "COS",      "v0.lanewise(VectorOperators.COS)" },
+   { "COSH",     "v0.lanewise(VectorOperators.COSH)" },
+   { "EXP",      "v0.lanewise(VectorOperators.EXP)" },
+   { "LN",       "v0.lanewise(VectorOperators.LOG)" },
+   { "LOG10",    "v0.lanewise(VectorOperators.LOG10)" },
+   { "SIN",      "v0.lanewise(VectorOperators.SIN)" },
+   { "SINH",     "v0.lanewise(VectorOperators.SINH)" },
+   { "SQRT",     "v0.lanewise(VectorOperators.SQRT)" },
+   { "TAN",      "v0.lanewise(VectorOperators.TAN)" },
+   { "TANH",     "v0.lanewise(VectorOperators.TANH)" },
+
+   /* Price Transform (inputs are open, high, low, close in that order) */
+   { "AVGPRICE", "v1.add(v2).add(v3).add(v0).div(4.0)" },
+   { "MEDPRICE", "v0.add(v1).div(2.0)" },
+   { "TYPPRICE", "v0.add(v1).add(v2).div(3.0)" },
+   { "WCLPRICE", "v0.add(v1).add(v2.mul(2.0)).div(4.0)" }
+};
+
+#define NB_JAVA_VECTOR_KERNEL (sizeof(javaVectorKernels)/sizeof(JavaVectorKernel))
+
+static void printJavaVectorKernel(const TA_FuncInfo *funcInfo)
+{
+	TA_InputParameterInfo *inputInfo;
+	TA_OutputParameterInfo *outputInfo;
+	const JavaVectorKernel *kernel;
+	unsigned int i, j, nbVector;
+	char funcName[FUNCNAME_SIZE];
+	const char *inputName[6];
+	FILE *out;
+
+	static const int priceFlags[6] = { TA_IN_PRICE_OPEN, TA_IN_PRICE_HIGH, TA_IN_PRICE_LOW,
+	                                   TA_IN_PRICE_CLOSE, TA_IN_PRICE_VOLUME, TA_IN_PRICE_OPENINTEREST };
+	static const char *priceNames[6] = { "inOpen", "inHigh", "inLow", "inClose", "inVolume", "inOpenInterest" };
+
+	kernel = NULL;
+	for( i=0; i < NB_JAVA_VECTOR_KERNEL; i++ )
+	{
+		if( strcmp(javaVectorKernels[i].name, funcInfo->name) == 0 )
+			kernel = &javaVectorKernels[i];
+	}
+	if( !kernel )
+		return;
+
+	/* Only one real output and no optional input are expected. */
+	if( (funcInfo->nbOutput != 1) || (funcInfo->nbOptInput != 0) )
+	{
+		printf( "Unexpected error 1 (printJavaVectorKernel)\n");
+		return;
+	}
+	TA_GetOutputParameterInfo( funcInfo->handle, 0, (void*)&outputInfo );
+
+	/* Name of each input array. */
+	nbVector = 0;
+	for( i=0; i < funcInfo->nbInput; i++ )
+	{
+		TA_GetInputParameterInfo( funcInfo->handle, i, (void*)&inputInfo );
+		if( inputInfo->type == TA_Input_Price )
+		{
+			for( j=0; j < 6; j++ )
+			{
+				if( (inputInfo->flags & priceFlags[j]) && (nbVector < 6) )
+					inputName[nbVector++] = priceNames[j];
+			}
+		}
+		else if( (inputInfo->type == TA_Input_Real) && (nbVector < 6) )
+			inputName[nbVector++] = inputInfo->paramName;
+		else
+		{
+			printf( "Unexpected error 2 (printJavaVectorKernel)\n");
+			return;
+		}
+	}
+
+	out = gOutCoreVector_Java->file;
+	getJavaFuncName( funcName, funcInfo );
+
+	fprintf(out, "   @Override\n");
+	fprintf(out, "   public RetCode %s( int startIdx,\n", funcName);
+	fprintf(out, "      int endIdx,\n");
+	for( i=0; i < nbVector; i++ )
+		fprintf(out, "      double %s[],\n", inputName[i]);
+	fprintf(out, "      MInteger outBegIdx,\n");
+	fprintf(out, "      MInteger outNBElement,\n");
+	fprintf(out, "      double %s[] )\n", outputInfo->paramName);
+	fprintf(out, "   {\n");
+	fprintf(out, "      int outIdx, nbElement, upperBound;\n");
+	fprintf(out, "      VectorMask<Double> mask;\n");
+	fprintf(out, "      DoubleVector ");
+	for( i=0; i < nbVector; i++ )
+		fprintf(out, "%sv%d", i==0? "":", ", i);
+	fprintf(out, ";\n");
+	fprintf(out, "      if( startIdx < 0 )\n");
+	fprintf(out, "         return RetCode.OutOfRangeStartIndex ;\n");
+	fprintf(out, "      if( (endIdx < 0) || (endIdx < startIdx))\n");
+	fprintf(out, "         return RetCode.OutOfRangeEndIndex ;\n");
+	fprintf(out, "      nbElement = endIdx-startIdx+1;\n");
+	fprintf(out, "      upperBound = SPECIES.loopBound(nbElement);\n");
+	fprintf(out, "      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )\n");
+	fprintf(out, "      {\n");
+	for( i=0; i < nbVector; i++ )
+		fprintf(out, "         v%d = DoubleVector.fromArray(SPECIES, %s, startIdx+outIdx);\n", i, inputName[i]);
+	fprintf(out, "         %s.intoArray(%s, outIdx);\n", kernel->vectorExpr, outputInfo->paramName);
+	fprintf(out, "      }\n");
+	fprintf(out, "      if( outIdx < nbElement )\n");
+	fprintf(out, "      {\n");
+	fprintf(out, "         mask = SPECIES.indexInRange(outIdx, nbElement);\n");
+	for( i=0; i < nbVector; i++ )
+		fprintf(out, "         v%d = DoubleVector.fromArray(SPECIES, %s, startIdx+outIdx, mask);\n", i, inputName[i]);
+	fprintf(out, "         %s.intoArray(%s, outIdx, mask);\n", kernel->vectorExpr, outputInfo->paramName);
+	fprintf(out, "      }\n");
+	fprintf(out, "      outNBElement.value = nbElement;\n");
+	fprintf(out, "      outBegIdx.value = startIdx;\n");
+	fprintf(out, "      return RetCode.Success ;\n");
+	fprintf(out, "   }\n\n");
+}
+
 #ifdef TA_LIB_PRO
       /* Section for code distributed with TA-Lib Pro only. */
 #endif
 
+
+/* The price inputs are passed to the C function in this order. */
+static const int cppPriceFlags[6] = { TA_IN_PRICE_OPEN, TA_IN_PRICE_HIGH, TA_IN_PRICE_LOW,
+                                      TA_IN_PRICE_CLOSE, TA_IN_PRICE_VOLUME, TA_IN_PRICE_OPENINTEREST };
+static const char *cppPriceNames[6] = { "inOpen", "inHigh", "inLow",
+                                        "inClose", "inVolume", "inOpenInterest" };
+
+/* Call each 'inputName' for the inputs and outputs of the function, in
+ * the order of the C function. 'isReal' is false for integer parameters.
+ */
+typedef void (*CppParamFunc)( FILE *out, const char *name, int isInput,
+                              int isReal, int *isFirst, const char *realType );
+
+static void forEachCppParam( FILE *out, const TA_FuncInfo *funcInfo,
+                             CppParamFunc paramFunc, const char *realType )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i, j;
+   int isFirst;
+
+   isFirst = 1;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      if( inputInfo->type == TA_Input_Price )
+      {
+         for( j=0; j < 6; j++ )
+         {
+            if( inputInfo->flags & cppPriceFlags[j] )
+               (*paramFunc)( out, cppPriceNames[j], 1, 1, &isFirst, realType );
+         }
+      }
+      else
+         (*paramFunc)( out, inputInfo->paramName, 1,
+                       inputInfo->type == TA_Input_Real, &isFirst, realType );
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      (*paramFunc)( out, outputInfo->paramName, 0,
+                    outputInfo->type == TA_Output_Real, &isFirst, realType );
+   }
+}
+
+/* "std::span<const double> inReal," for the signature. */
+static void printCppParamDecl( FILE *out, const char *name, int isInput,
+                               int isReal, int *isFirst, const char *realType )
+{
+   if( !*isFirst )
+      fprintf( out, ",\n%*s", (int)strlen(gTempBuf), "" );
+   *isFirst = 0;
+
+   if( isInput )
+      fprintf( out, "std::span<const %s> %s", isReal? realType : "int", name );
+   else
+      fprintf( out, "std::span<%s> %s", isReal? "double" : "int", name );
+}
+
+/* "inReal, inHigh" for detail::nbBar and "outReal" for detail::outputFits. */
+static void printCppInputName( FILE *out, const char *name, int isInput,
+                               int isReal, int *isFirst, const char *realType )
+{
+   (void)isReal;
+   (void)realType;
+
+   if( !isInput )
+      return;
+   fprintf( out, "%s%s", *isFirst? "" : ", ", name );
+   *isFirst = 0;
+}
+
+static void printCppOutputName( FILE *out, const char *name, int isInput,
+                                int isReal, int *isFirst, const char *realType )
+{
+   (void)isReal;
+   (void)realType;
+   (void)isFirst;
+
+   if( !isInput )
+      fprintf( out, ", %s", name );
+}
+
+/* ".data()" arguments of the call. The outputs are after the opt inputs. */
+static void printCppInputData( FILE *out, const char *name, int isInput,
+                               int isReal, int *isFirst, const char *realType )
+{
+   (void)isReal;
+   (void)realType;
+
+   if( isInput )
+   {
+      fprintf( out, "%s%s.data()", *isFirst? "" : ", ", name );
+      *isFirst = 0;
+   }
+}
+
+static void printCppOutputData( FILE *out, const char *name, int isInput,
+                                int isReal, int *isFirst, const char *realType )
+{
+   (void)isReal;
+   (void)isFirst;
+   (void)realType;
+
+   if( !isInput )
+      fprintf( out, ",%s%s.data()", gTempBuf2, name );
+}
+
+static void printCppOptInputArgs( FILE *out, const TA_FuncInfo *funcInfo,
+                                  unsigned int withType, const char *separator )
+{
+   const TA_OptInputParameterInfo *optInputInfo;
+   const TA_IntegerList *intList;
+   unsigned int i, j;
+
+   for( i=0; i < funcInfo->nbOptInput; i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputInfo );
+      if( i != 0 )
+         fprintf( out, "%s", separator );
+
+      if( !withType )
+      {
+         fprintf( out, "%s", optInputInfo->paramName );
+         continue;
+      }
+
+      switch( optInputInfo->type )
+      {
+      case TA_OptInput_RealRange:
+      case TA_OptInput_RealList:
+         fprintf( out, "double %s = %s", optInputInfo->paramName,
+                  doubleToStr(optInputInfo->defaultValue) );
+         break;
+      case TA_OptInput_IntegerList:
+         if( optInputInfo->dataSet == TA_DEF_UI_MA_Method.dataSet )
+         {
+            /* Use the name of the enum for the default. */
+            intList = (const TA_IntegerList *)optInputInfo->dataSet;
+            for( j=0; j < intList->nbElement; j++ )
+            {
+               if( intList->data[j].value == (TA_Integer)optInputInfo->defaultValue )
+                  break;
+            }
+            if( j < intList->nbElement )
+               fprintf( out, "TA_MAType %s = TA_MAType_%s", optInputInfo->paramName,
+                        intList->data[j].string );
+            else
+               fprintf( out, "TA_MAType %s = (TA_MAType)%d", optInputInfo->paramName,
+                        (int)optInputInfo->defaultValue );
+            break;
+         }
+         /* Other lists are integers. */
+      case TA_OptInput_IntegerRange:
+         fprintf( out, "int %s = %d", optInputInfo->paramName,
+                  (int)optInputInfo->defaultValue );
+         break;
+      default:
+         printf( "Unexpected error 1 (printCppOptInputArgs)\n" );
+      }
+   }
+}
+
+static void printCppCall( FILE *out, const TA_FuncInfo *funcInfo,
+                          unsigned int inputIsSinglePrecision )
+{
+   const char *realType;
+
+   realType = inputIsSinglePrecision? "float" : "double";
+
+   /* Signature. gTempBuf is the indentation of the parameters. */
+   sprintf( gTempBuf, "inline Result %s( ", funcInfo->name );
+   fprintf( out, "%s", gTempBuf );
+   forEachCppParam( out, funcInfo, printCppParamDecl, realType );
+   if( funcInfo->nbOptInput != 0 )
+   {
+      fprintf( out, ",\n%*s", (int)strlen(gTempBuf), "" );
+      sprintf( gTempBuf2, ",\n%*s", (int)strlen(gTempBuf), "" );
+      printCppOptInputArgs( out, funcInfo, 1, gTempBuf2 );
+   }
+   fprintf( out, " ) noexcept\n" );
+
+   /* Body */
+   fprintf( out, "{\n" );
+   fprintf( out, "   Result result = { TA_SUCCESS, 0, 0 };\n" );
+   fprintf( out, "   int nbBar;\n\n" );
+   fprintf( out, "   nbBar = detail::nbBar( " );
+   forEachCppParam( out, funcInfo, printCppInputName, realType );
+   fprintf( out, " );\n" );
+   fprintf( out, "   if( (nbBar < 0) ||\n" );
+   fprintf( out, "       !detail::outputFits( nbBar,\n" );
+   fprintf( out, "                            [&]{ return %s_Lookback(%s", funcInfo->name,
+            funcInfo->nbOptInput? " " : "" );
+   printCppOptInputArgs( out, funcInfo, 0, ", " );
+   fprintf( out, "%s); }", funcInfo->nbOptInput? " " : "" );
+   forEachCppParam( out, funcInfo, printCppOutputName, realType );
+   fprintf( out, " ) )\n" );
+   fprintf( out, "      return detail::badParam();\n\n" );
+
+   sprintf( gTempBuf, "   result.retCode = TA_%s%s( ",
+            inputIsSinglePrecision? "S_" : "", funcInfo->name );
+   sprintf( gTempBuf2, "\n%*s", (int)strlen(gTempBuf), "" );
+   fprintf( out, "%s0, nbBar-1,%s", gTempBuf, gTempBuf2 );
+   forEachCppParam( out, funcInfo, printCppInputData, realType );
+   fprintf( out, ",%s", gTempBuf2 );
+   if( funcInfo->nbOptInput != 0 )
+   {
+      printCppOptInputArgs( out, funcInfo, 0, ", " );
+      fprintf( out, ",%s", gTempBuf2 );
+   }
+   fprintf( out, "&result.begIdx, &result.nbElement" );
+   forEachCppParam( out, funcInfo, printCppOutputData, realType );
+   fprintf( out, " );\n" );
+   fprintf( out, "   return result;\n" );
+   fprintf( out, "}\n\n" );
+}
+
+/* Call of TA_XXX_Calc (or TA_S_XXX_Calc) with the parameters of the
+ * C function, one line for each kind of parameter.
+ */
+static void printCalcCall( FILE *out, const TA_FuncInfo *funcInfo,
+                           const char *lead, const char *prefix )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i, j;
+   int indent;
+   char *args;
+
+   sprintf( gTempBuf, "%sTA_%s%s_Calc( ", lead, prefix, funcInfo->name );
+   indent = (int)strlen(gTempBuf);
+   print( out, "%sstartIdx, endIdx,\n", gTempBuf );
+
+   args = gTempBuf2;
+   args[0] = '\0';
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      if( inputInfo->type == TA_Input_Price )
+      {
+         for( j=0; j < 6; j++ )
+         {
+            if( inputInfo->flags & cppPriceFlags[j] )
+               sprintf( args+strlen(args), "%s, ", cppPriceNames[j] );
+         }
+      }
+      else
+         sprintf( args+strlen(args), "%s, ", inputInfo->paramName );
+   }
+   args[strlen(args)-1] = '\0';
+   print( out, "%*s%s\n", indent, "", args );
+
+   if( funcInfo->nbOptInput != 0 )
+   {
+      args[0] = '\0';
+      for( i=0; i < funcInfo->nbOptInput; i++ )
+      {
+         TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInputInfo );
+         sprintf( args+strlen(args), "%s, ", optInputInfo->paramName );
+      }
+      args[strlen(args)-1] = '\0';
+      print( out, "%*s%s\n", indent, "", args );
+   }
+
+   strcpy( args, "outBegIdx, outNBElement" );
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      sprintf( args+strlen(args), ", %s", outputInfo->paramName );
+   }
+   print( out, "%*s%s );\n", indent, "", args );
+}
+
+static void printStatsWrapper( FILE *out, const TA_FuncInfo *funcInfo,
+                               unsigned int inputIsSinglePrecision )
+{
+   const char *prefix;
+
+   prefix = inputIsSinglePrecision? "S_" : "";
+
+   printFunc( out, "TA_LIB_API ", funcInfo, 1, 0, 0, 0, 0, 0, 0, inputIsSinglePrecision, 0, 0, 0, 0, 0 );
+   print( out, "{\n" );
+   print( out, "   TA_StatsCall statsCall;\n" );
+   print( out, "   TA_RetCode retCode;\n" );
+   print( out, "\n" );
+   print( out, "   if( !TA_Globals->statsEnabled )\n" );
+   printCalcCall( out, funcInfo, "      return ", prefix );
+   print( out, "\n" );
+   print( out, "   TA_StatsCallBegin( &statsCall );\n" );
+   printCalcCall( out, funcInfo, "   retCode = ", prefix );
+   print( out, "   TA_StatsCallEnd( &TA_STATS_%s, &statsCall, endIdx-startIdx+1 );\n", funcInfo->name );
+   print( out, "   return retCode;\n" );
+   print( out, "}\n" );
+}
+
+static void printCppFunction( FILE *out, const TA_FuncInfo *funcInfo )
+{
+   const TA_InputParameterInfo *inputInfo;
+   unsigned int i, hasRealInput;
+
+   fprintf( out, "/* %s - %s */\n", funcInfo->name, funcInfo->hint );
+
+   /* Lookback */
+   if( funcInfo->nbOptInput == 0 )
+   {
+      fprintf( out, "inline int %s_Lookback() noexcept\n", funcInfo->name );
+      fprintf( out, "{\n" );
+      fprintf( out, "   return TA_%s_Lookback();\n", funcInfo->name );
+   }
+   else
+   {
+      sprintf( gTempBuf, "inline int %s_Lookback( ", funcInfo->name );
+      fprintf( out, "%s", gTempBuf );
+      sprintf( gTempBuf2, ",\n%*s", (int)strlen(gTempBuf), "" );
+      printCppOptInputArgs( out, funcInfo, 1, gTempBuf2 );
+      fprintf( out, " ) noexcept\n" );
+      fprintf( out, "{\n" );
+      fprintf( out, "   return TA_%s_Lookback( ", funcInfo->name );
+      printCppOptInputArgs( out, funcInfo, 0, ", " );
+      fprintf( out, " );\n" );
+   }
+   fprintf( out, "}\n\n" );
+
+   printCppCall( out, funcInfo, 0 );
+
+   /* The float overload, only when there is something to convert. */
+   hasRealInput = 0;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      if( inputInfo->type != TA_Input_Integer )
+         hasRealInput = 1;
+   }
+   if( hasRealInput )
+      printCppCall( out, funcInfo, 1 );
+}
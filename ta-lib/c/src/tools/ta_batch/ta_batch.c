@@ -0,0 +1,1195 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ */
+
+/* Description:
+ *    Calculate a list of indicators over many files, in parallel.
+ *
+ *    The indicators are listed in a text file (the "spec"), one per
+ *    line with a name, the function and its optional inputs:
+ *
+ *       # name   function  parameters
+ *       sma20    SMA       TimePeriod=20
+ *       ema50    EMA       TimePeriod=50 inReal=high
+ *       bb       BBANDS    TimePeriod=20 NbDevUp=2 NbDevDn=2 MAType=EMA
+ *       macd     MACD
+ *
+ *    The parameters are the optional inputs of the function (with or
+ *    without the "optIn" prefix). The missing ones take their default.
+ *    A TA_Input_Real input uses the close unless another column is
+ *    given with the name of the input (ex: inReal=high).
+ *
+ *    Each input file is a CSV file with a header line (the columns
+ *    open, high, low, close, volume and openinterest are used, the
+ *    others are ignored) or a columnar file as written by ta_batch.
+ *
+ *    For each input file, a file with the same name is written in the
+ *    output directory. It has one column per output, aligned with the
+ *    input bars (NaN when there is not enough data for a value).
+ *
+ *    Columnar file (".tab"), all in the native byte order:
+ *       char   magic[8]      "TABATCH1"
+ *       UInt32 nbColumn
+ *       UInt32 reserved      (0)
+ *       UInt64 nbRow
+ *       char   name[nbColumn][32]
+ *       double data[nbColumn][nbRow]   (one column after the other)
+ *
+ *    POSIX only (pthread, mmap).
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "ta_libc.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define MAX_NAME       32   /* Name of a column, including the terminating zero. */
+#define MAX_PARAM      16   /* Inputs, optional inputs or outputs of a function. */
+#define MAX_LINE       1024
+
+/* The columns of the input, in the order of the TA_IN_PRICE_XXX flags. */
+#define NB_COLUMN      6
+#define COLUMN_CLOSE   3
+
+static const char *columnName[NB_COLUMN] =
+{
+   "open", "high", "low", "close", "volume", "openinterest"
+};
+
+#define TAB_MAGIC        "TABATCH1"
+#define TAB_HEADER_SIZE  24
+
+typedef enum
+{
+   FORMAT_TAB,
+   FORMAT_CSV
+} OutputFormat;
+
+typedef struct
+{
+   char name[MAX_NAME];
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+
+   /* Optional inputs given in the spec. */
+   unsigned int nbOpt;
+   unsigned int optIndex[MAX_PARAM];
+   double optValue[MAX_PARAM];
+   int optIsInteger[MAX_PARAM];
+
+   /* Column of each TA_Input_Real/TA_Input_Integer input. */
+   int inColumn[MAX_PARAM];
+
+   /* Index of its first output in the output columns. */
+   unsigned int firstColumn;
+} Indicator;
+
+typedef struct
+{
+   int nbBar;
+   const double *column[NB_COLUMN]; /* NULL when not in the file. */
+
+   /* What must be released. */
+   void *map;
+   size_t mapSize;
+   double *owned;
+} InputData;
+
+typedef struct
+{
+   /* One param holder per indicator, allocated once. */
+   TA_ParamHolder **params;
+
+   /* Output columns, 'capacity' elements each. */
+   double *out;
+   TA_Integer *intBuffer;
+   int capacity;
+} Worker;
+
+/**** Local functions declarations.    ****/
+static int readSpec( const char *fileName );
+static int parseIndicator( char *line, int lineNb, Indicator *indicator );
+static int readFileList( const char *fileName );
+static int addFile( const char *fileName );
+static void *workerThread( void *arg );
+static int processFile( Worker *worker, const char *fileName );
+static int loadInput( const char *fileName, InputData *input, char *error );
+static int loadTab( const char *fileName, InputData *input, char *error );
+static int loadCsv( const char *fileName, InputData *input, char *error );
+static void freeInput( InputData *input );
+static int calcIndicator( Worker *worker, const Indicator *indicator,
+                          TA_ParamHolder *params, const InputData *input,
+                          char *error );
+static int writeOutput( const Worker *worker, const char *fileName, int nbBar, char *error );
+static int columnIndex( const char *name );
+static int sameName( const char *a, const char *b );
+static void printUsage( void );
+
+/**** Local variables definitions.     ****/
+static Indicator *indicator;
+static unsigned int nbIndicator;
+
+static char (*outColumnName)[MAX_NAME];
+static unsigned int nbOutColumn;
+
+static const char *outDir;
+static OutputFormat outFormat;
+
+static char **fileList;
+static unsigned int nbFile;
+static unsigned int fileListSize;
+
+static pthread_mutex_t fileMutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int nextFile;
+static unsigned int nbFailed;
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   const char *specFile;
+   pthread_t *threadId;
+   Worker *worker;
+   unsigned int nbThread, i, j;
+   struct timespec begin, end;
+   struct stat status;
+   long nbCpu;
+   int retValue;
+
+   specFile  = NULL;
+   outDir    = NULL;
+   outFormat = FORMAT_TAB;
+   nbCpu     = sysconf( _SC_NPROCESSORS_ONLN );
+   nbThread  = nbCpu > 0? (unsigned int)nbCpu : 1;
+
+   if( TA_Initialize() != TA_SUCCESS )
+   {
+      printf( "ta_batch: TA_Initialize failed\n" );
+      return 1;
+   }
+
+   retValue = 0;
+   for( i=1; (i < (unsigned int)argc) && (retValue == 0); i++ )
+   {
+      if( (strcmp( argv[i], "-s" ) == 0) && (i+1 < (unsigned int)argc) )
+         specFile = argv[++i];
+      else if( (strcmp( argv[i], "-o" ) == 0) && (i+1 < (unsigned int)argc) )
+         outDir = argv[++i];
+      else if( (strcmp( argv[i], "-j" ) == 0) && (i+1 < (unsigned int)argc) )
+         nbThread = (unsigned int)atoi( argv[++i] );
+      else if( (strcmp( argv[i], "-f" ) == 0) && (i+1 < (unsigned int)argc) )
+      {
+         i++;
+         if( strcmp( argv[i], "tab" ) == 0 )
+            outFormat = FORMAT_TAB;
+         else if( strcmp( argv[i], "csv" ) == 0 )
+            outFormat = FORMAT_CSV;
+         else
+            retValue = -1;
+      }
+      else if( (strcmp( argv[i], "-l" ) == 0) && (i+1 < (unsigned int)argc) )
+         retValue = readFileList( argv[++i] );
+      else if( argv[i][0] == '-' )
+         retValue = -1;
+      else
+         retValue = addFile( argv[i] );
+   }
+
+   if( (retValue != 0) || !specFile || !outDir || (nbThread == 0) )
+   {
+      printUsage();
+      TA_Shutdown();
+      return 1;
+   }
+
+   if( (stat( outDir, &status ) != 0) || !S_ISDIR(status.st_mode) )
+   {
+      printf( "ta_batch: [%s] is not a directory\n", outDir );
+      TA_Shutdown();
+      return 1;
+   }
+
+   if( readSpec( specFile ) != 0 )
+   {
+      TA_Shutdown();
+      return 1;
+   }
+
+   if( nbThread > nbFile )
+      nbThread = nbFile? nbFile : 1;
+
+   /* Each worker has its own param holders, with the optional
+    * inputs set once for all the files.
+    */
+   worker   = (Worker *)calloc( nbThread, sizeof(Worker) );
+   threadId = (pthread_t *)calloc( nbThread, sizeof(pthread_t) );
+   if( !worker || !threadId )
+      return 1;
+
+   for( i=0; i < nbThread; i++ )
+   {
+      worker[i].params = (TA_ParamHolder **)calloc( nbIndicator, sizeof(TA_ParamHolder *) );
+      if( !worker[i].params )
+         return 1;
+
+      for( j=0; j < nbIndicator; j++ )
+      {
+         if( TA_ParamHolderAlloc( indicator[j].handle, &worker[i].params[j] ) != TA_SUCCESS )
+            return 1;
+      }
+   }
+
+   for( j=0; j < nbIndicator; j++ )
+   {
+      for( i=0; i < indicator[j].nbOpt; i++ )
+      {
+         unsigned int k;
+         TA_RetCode retCode;
+
+         for( k=0; k < nbThread; k++ )
+         {
+            if( indicator[j].optIsInteger[i] )
+               retCode = TA_SetOptInputParamInteger( worker[k].params[j], indicator[j].optIndex[i],
+                                                     (TA_Integer)indicator[j].optValue[i] );
+            else
+               retCode = TA_SetOptInputParamReal( worker[k].params[j], indicator[j].optIndex[i],
+                                                  indicator[j].optValue[i] );
+            if( retCode != TA_SUCCESS )
+            {
+               printf( "ta_batch: %s: invalid parameter value\n", indicator[j].name );
+               return 1;
+            }
+         }
+      }
+   }
+
+   clock_gettime( CLOCK_MONOTONIC, &begin );
+
+   for( i=0; i < nbThread; i++ )
+   {
+      if( pthread_create( &threadId[i], NULL, workerThread, &worker[i] ) != 0 )
+      {
+         printf( "ta_batch: cannot create the threads\n" );
+         return 1;
+      }
+   }
+
+   for( i=0; i < nbThread; i++ )
+      pthread_join( threadId[i], NULL );
+
+   clock_gettime( CLOCK_MONOTONIC, &end );
+
+   printf( "ta_batch: %u files (%u failed), %u columns, %.3f seconds\n",
+           nbFile, nbFailed, nbOutColumn,
+           (double)(end.tv_sec-begin.tv_sec)+(end.tv_nsec-begin.tv_nsec)/1e9 );
+
+   for( i=0; i < nbThread; i++ )
+   {
+      for( j=0; j < nbIndicator; j++ )
+         TA_ParamHolderFree( worker[i].params[j] );
+      free( worker[i].params );
+      free( worker[i].out );
+      free( worker[i].intBuffer );
+   }
+   free( worker );
+   free( threadId );
+   free( indicator );
+   free( outColumnName );
+   for( i=0; i < nbFile; i++ )
+      free( fileList[i] );
+   free( fileList );
+
+   TA_Shutdown();
+
+   return nbFailed? 1 : 0;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   printf( "Usage: ta_batch -s spec -o outDir [-j nbThread] [-f tab|csv] [-l fileList] file...\n" );
+   printf( "\n" );
+   printf( "  -s  File with the indicators to calculate (see ReadMe.txt)\n" );
+   printf( "  -o  Directory where the output files are written\n" );
+   printf( "  -j  Number of files processed in parallel (default: number of CPUs)\n" );
+   printf( "  -f  Format of the output files (default tab)\n" );
+   printf( "  -l  File with the input files, one per line\n" );
+}
+
+static int readSpec( const char *fileName )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   char line[MAX_LINE];
+   Indicator *current;
+   FILE *file;
+   unsigned int i, j, size;
+   const char *outName;
+   int lineNb;
+
+   file = fopen( fileName, "r" );
+   if( !file )
+   {
+      printf( "ta_batch: cannot open [%s]\n", fileName );
+      return -1;
+   }
+
+   size = 0;
+   lineNb = 0;
+   while( fgets( line, sizeof(line), file ) )
+   {
+      lineNb++;
+
+      if( nbIndicator == size )
+      {
+         size = size? size*2 : 64;
+         current = (Indicator *)realloc( indicator, size*sizeof(Indicator) );
+         if( !current )
+            break;
+         indicator = current;
+      }
+
+      switch( parseIndicator( line, lineNb, &indicator[nbIndicator] ) )
+      {
+      case 1:
+         nbIndicator++;
+         break;
+      case 0:
+         break; /* Empty line or comment. */
+      default:
+         fclose( file );
+         return -1;
+      }
+   }
+   fclose( file );
+
+   if( nbIndicator == 0 )
+   {
+      printf( "ta_batch: no indicator in [%s]\n", fileName );
+      return -1;
+   }
+
+   /* Name the output columns. */
+   nbOutColumn = 0;
+   for( i=0; i < nbIndicator; i++ )
+   {
+      indicator[i].firstColumn = nbOutColumn;
+      nbOutColumn += indicator[i].funcInfo->nbOutput;
+   }
+
+   outColumnName = (char (*)[MAX_NAME])calloc( nbOutColumn, MAX_NAME );
+   if( !outColumnName )
+      return -1;
+
+   for( i=0; i < nbIndicator; i++ )
+   {
+      for( j=0; j < indicator[i].funcInfo->nbOutput; j++ )
+      {
+         char *name = outColumnName[indicator[i].firstColumn+j];
+
+         if( indicator[i].funcInfo->nbOutput == 1 )
+            strcpy( name, indicator[i].name );
+         else
+         {
+            /* Ex: "bb.RealUpperBand" for outRealUpperBand. */
+            TA_GetOutputParameterInfo( indicator[i].handle, j, &outputInfo );
+            outName = outputInfo->paramName;
+            if( strncmp( outName, "out", 3 ) == 0 )
+               outName += 3;
+            sprintf( name, "%.*s.%.*s", (int)strlen(indicator[i].name), indicator[i].name,
+                     (int)(MAX_NAME-2-strlen(indicator[i].name)), outName );
+         }
+      }
+   }
+
+   return 0;
+}
+
+/* Return 1 for an indicator, 0 for an empty line and -1 on error. */
+static int parseIndicator( char *line, int lineNb, Indicator *ind )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInfo;
+   const TA_IntegerList *intList;
+   const TA_RealList *realList;
+   char *token, *value, *end, *name;
+   unsigned int i;
+   int found;
+
+   memset( ind, 0, sizeof(Indicator) );
+
+   token = strchr( line, '#' );
+   if( token )
+      *token = '\0';
+
+   name = strtok( line, " \t\r\n" );
+   if( !name )
+      return 0;
+
+   token = strtok( NULL, " \t\r\n" );
+   if( !token )
+   {
+      printf( "ta_batch: spec line %d: function missing\n", lineNb );
+      return -1;
+   }
+
+   if( strlen(name) >= MAX_NAME-8 )
+   {
+      printf( "ta_batch: spec line %d: name too long\n", lineNb );
+      return -1;
+   }
+   strcpy( ind->name, name );
+
+   for( i=0; token[i]; i++ )
+      token[i] = (char)toupper( token[i] );
+
+   if( (TA_GetFuncHandle( token, &ind->handle ) != TA_SUCCESS) ||
+       (TA_GetFuncInfo( ind->handle, &ind->funcInfo ) != TA_SUCCESS) )
+   {
+      printf( "ta_batch: spec line %d: unknown function [%s]\n", lineNb, token );
+      return -1;
+   }
+
+   if( (ind->funcInfo->nbInput > MAX_PARAM) || (ind->funcInfo->nbOptInput > MAX_PARAM) )
+      return -1;
+
+   for( i=0; i < ind->funcInfo->nbInput; i++ )
+      ind->inColumn[i] = COLUMN_CLOSE;
+
+   while( (token = strtok( NULL, " \t\r\n" )) != NULL )
+   {
+      value = strchr( token, '=' );
+      if( !value )
+      {
+         printf( "ta_batch: spec line %d: [%s] is not name=value\n", lineNb, token );
+         return -1;
+      }
+      *value++ = '\0';
+
+      /* An input? */
+      found = 0;
+      for( i=0; (i < ind->funcInfo->nbInput) && !found; i++ )
+      {
+         TA_GetInputParameterInfo( ind->handle, i, &inputInfo );
+         if( (inputInfo->type != TA_Input_Price) && sameName( token, inputInfo->paramName ) )
+         {
+            ind->inColumn[i] = columnIndex( value );
+            if( ind->inColumn[i] < 0 )
+            {
+               printf( "ta_batch: spec line %d: unknown column [%s]\n", lineNb, value );
+               return -1;
+            }
+            found = 1;
+         }
+      }
+      if( found )
+         continue;
+
+      /* An optional input? */
+      for( i=0; i < ind->funcInfo->nbOptInput; i++ )
+      {
+         TA_GetOptInputParameterInfo( ind->handle, i, &optInfo );
+         if( sameName( token, optInfo->paramName ) ||
+             sameName( token, optInfo->paramName+5 ) )
+            break;
+      }
+
+      if( i == ind->funcInfo->nbOptInput )
+      {
+         printf( "ta_batch: spec line %d: %s has no parameter [%s]\n", lineNb,
+                 ind->funcInfo->name, token );
+         return -1;
+      }
+
+      ind->optIndex[ind->nbOpt] = i;
+      ind->optIsInteger[ind->nbOpt] = (optInfo->type == TA_OptInput_IntegerRange) ||
+                                      (optInfo->type == TA_OptInput_IntegerList);
+
+      /* A number, or the name of a value in a list (ex: MAType=EMA). */
+      ind->optValue[ind->nbOpt] = strtod( value, &end );
+      if( (end == value) || (*end != '\0') )
+      {
+         found = 0;
+         if( optInfo->type == TA_OptInput_IntegerList )
+         {
+            intList = (const TA_IntegerList *)optInfo->dataSet;
+            for( i=0; (i < intList->nbElement) && !found; i++ )
+            {
+               if( sameName( value, intList->data[i].string ) )
+               {
+                  ind->optValue[ind->nbOpt] = intList->data[i].value;
+                  found = 1;
+               }
+            }
+         }
+         else if( optInfo->type == TA_OptInput_RealList )
+         {
+            realList = (const TA_RealList *)optInfo->dataSet;
+            for( i=0; (i < realList->nbElement) && !found; i++ )
+            {
+               if( sameName( value, realList->data[i].string ) )
+               {
+                  ind->optValue[ind->nbOpt] = realList->data[i].value;
+                  found = 1;
+               }
+            }
+         }
+
+         if( !found )
+         {
+            printf( "ta_batch: spec line %d: invalid value [%s]\n", lineNb, value );
+            return -1;
+         }
+      }
+
+      ind->nbOpt++;
+   }
+
+   return 1;
+}
+
+static int readFileList( const char *fileName )
+{
+   char line[MAX_LINE];
+   FILE *file;
+   size_t length;
+
+   file = fopen( fileName, "r" );
+   if( !file )
+   {
+      printf( "ta_batch: cannot open [%s]\n", fileName );
+      return -1;
+   }
+
+   while( fgets( line, sizeof(line), file ) )
+   {
+      length = strlen( line );
+      while( (length > 0) && isspace( (unsigned char)line[length-1] ) )
+         line[--length] = '\0';
+
+      if( (length > 0) && (addFile( line ) != 0) )
+      {
+         fclose( file );
+         return -1;
+      }
+   }
+
+   fclose( file );
+   return 0;
+}
+
+static int addFile( const char *fileName )
+{
+   char **newList;
+
+   if( nbFile == fileListSize )
+   {
+      fileListSize = fileListSize? fileListSize*2 : 256;
+      newList = (char **)realloc( fileList, fileListSize*sizeof(char *) );
+      if( !newList )
+         return -1;
+      fileList = newList;
+   }
+
+   fileList[nbFile] = (char *)malloc( strlen(fileName)+1 );
+   if( !fileList[nbFile] )
+      return -1;
+   strcpy( fileList[nbFile++], fileName );
+
+   return 0;
+}
+
+static void *workerThread( void *arg )
+{
+   Worker *worker;
+   unsigned int fileIdx;
+
+   worker = (Worker *)arg;
+
+   for( ;; )
+   {
+      pthread_mutex_lock( &fileMutex );
+      fileIdx = nextFile++;
+      pthread_mutex_unlock( &fileMutex );
+
+      if( fileIdx >= nbFile )
+         break;
+
+      if( processFile( worker, fileList[fileIdx] ) != 0 )
+      {
+         pthread_mutex_lock( &fileMutex );
+         nbFailed++;
+         pthread_mutex_unlock( &fileMutex );
+      }
+   }
+
+   return NULL;
+}
+
+static int processFile( Worker *worker, const char *fileName )
+{
+   InputData input;
+   char error[MAX_LINE];
+   unsigned int i;
+   int retValue;
+   void *newBuffer;
+
+   error[0] = '\0';
+   retValue = loadInput( fileName, &input, error );
+
+   /* Output columns for all the bars. */
+   if( (retValue == 0) && (input.nbBar > worker->capacity) )
+   {
+      newBuffer = realloc( worker->out, (size_t)nbOutColumn*input.nbBar*sizeof(double) );
+      if( newBuffer )
+         worker->out = (double *)newBuffer;
+
+      if( newBuffer )
+      {
+         newBuffer = realloc( worker->intBuffer, (size_t)input.nbBar*MAX_PARAM*sizeof(TA_Integer) );
+         if( newBuffer )
+            worker->intBuffer = (TA_Integer *)newBuffer;
+      }
+
+      if( newBuffer )
+         worker->capacity = input.nbBar;
+      else
+      {
+         strcpy( error, "out of memory" );
+         retValue = -1;
+      }
+   }
+
+   for( i=0; (i < nbIndicator) && (retValue == 0); i++ )
+      retValue = calcIndicator( worker, &indicator[i], worker->params[i], &input, error );
+
+   if( retValue == 0 )
+      retValue = writeOutput( worker, fileName, input.nbBar, error );
+
+   freeInput( &input );
+
+   if( retValue != 0 )
+      printf( "ta_batch: %s: %s\n", fileName, error );
+
+   return retValue;
+}
+
+static int calcIndicator( Worker *worker, const Indicator *ind,
+                          TA_ParamHolder *params, const InputData *input,
+                          char *error )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const double *price[NB_COLUMN];
+   TA_Integer *intInput, *intOutput;
+   double *out;
+   unsigned int i, j;
+   int k, outBegIdx, outNbElement;
+   TA_RetCode retCode;
+   TA_RetCodeInfo retCodeInfo;
+
+   if( input->nbBar == 0 )
+      return 0;
+
+   intInput  = worker->intBuffer;
+   intOutput = worker->intBuffer+(size_t)MAX_PARAM/2*worker->capacity;
+
+   retCode = TA_SUCCESS;
+   for( i=0; (i < ind->funcInfo->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetInputParameterInfo( ind->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         for( j=0; j < NB_COLUMN; j++ )
+         {
+            price[j] = NULL;
+            if( inputInfo->flags & (TA_IN_PRICE_OPEN<<j) )
+            {
+               price[j] = input->column[j];
+               if( !price[j] )
+               {
+                  sprintf( error, "%s needs the column %s", ind->name, columnName[j] );
+                  return -1;
+               }
+            }
+         }
+         retCode = TA_SetInputParamPricePtr( params, i, price[0], price[1], price[2],
+                                             price[3], price[4], price[5] );
+         break;
+
+      case TA_Input_Real:
+      case TA_Input_Integer:
+         if( !input->column[ind->inColumn[i]] )
+         {
+            sprintf( error, "%s needs the column %s", ind->name, columnName[ind->inColumn[i]] );
+            return -1;
+         }
+         if( inputInfo->type == TA_Input_Real )
+            retCode = TA_SetInputParamRealPtr( params, i, input->column[ind->inColumn[i]] );
+         else
+         {
+            for( k=0; k < input->nbBar; k++ )
+               intInput[k] = (TA_Integer)input->column[ind->inColumn[i]][k];
+            retCode = TA_SetInputParamIntegerPtr( params, i, intInput );
+            intInput += worker->capacity;
+         }
+         break;
+      }
+   }
+
+   for( i=0; (i < ind->funcInfo->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetOutputParameterInfo( ind->handle, i, &outputInfo );
+      out = worker->out+(size_t)(ind->firstColumn+i)*worker->capacity;
+      if( outputInfo->type == TA_Output_Integer )
+         retCode = TA_SetOutputParamIntegerPtr( params, i, intOutput+(size_t)i*worker->capacity );
+      else
+         retCode = TA_SetOutputParamRealPtr( params, i, out );
+   }
+
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFuncAligned( params, 0, input->nbBar-1, &outBegIdx, &outNbElement );
+
+   if( retCode != TA_SUCCESS )
+   {
+      TA_SetRetCodeInfo( retCode, &retCodeInfo );
+      sprintf( error, "%s: %s", ind->name, retCodeInfo.enumStr );
+      return -1;
+   }
+
+   /* The integer outputs are written as double, NaN where there is
+    * no value.
+    */
+   for( i=0; i < ind->funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( ind->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+      {
+         out = worker->out+(size_t)(ind->firstColumn+i)*worker->capacity;
+         for( k=0; k < input->nbBar; k++ )
+         {
+            out[k] = (intOutput[(size_t)i*worker->capacity+k] == TA_INTEGER_DEFAULT)?
+                     NAN : (double)intOutput[(size_t)i*worker->capacity+k];
+         }
+      }
+   }
+
+   return 0;
+}
+
+static int loadInput( const char *fileName, InputData *input, char *error )
+{
+   char magic[8];
+   FILE *file;
+   size_t nbRead;
+
+   memset( input, 0, sizeof(InputData) );
+
+   file = fopen( fileName, "rb" );
+   if( !file )
+   {
+      sprintf( error, "cannot open (%s)", strerror(errno) );
+      return -1;
+   }
+   nbRead = fread( magic, 1, sizeof(magic), file );
+   fclose( file );
+
+   if( (nbRead == sizeof(magic)) && (memcmp( magic, TAB_MAGIC, sizeof(magic) ) == 0) )
+      return loadTab( fileName, input, error );
+
+   return loadCsv( fileName, input, error );
+}
+
+/* A columnar file is mapped, the functions read it directly. */
+static int loadTab( const char *fileName, InputData *input, char *error )
+{
+   const char *base, *name;
+   struct stat status;
+   unsigned int nbColumn, i;
+   UInt64 nbRow;
+   int fd, column;
+
+   fd = open( fileName, O_RDONLY );
+   if( fd < 0 )
+   {
+      sprintf( error, "cannot open (%s)", strerror(errno) );
+      return -1;
+   }
+
+   if( (fstat( fd, &status ) != 0) || (status.st_size < TAB_HEADER_SIZE) )
+   {
+      close( fd );
+      strcpy( error, "invalid file" );
+      return -1;
+   }
+
+   input->mapSize = (size_t)status.st_size;
+   input->map = mmap( NULL, input->mapSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+   close( fd );
+   if( input->map == MAP_FAILED )
+   {
+      input->map = NULL;
+      sprintf( error, "cannot map (%s)", strerror(errno) );
+      return -1;
+   }
+
+   base = (const char *)input->map;
+   memcpy( &nbColumn, base+8, sizeof(nbColumn) );
+   memcpy( &nbRow, base+16, sizeof(nbRow) );
+
+   if( (nbRow > 0x7FFFFFFF) ||
+       ((UInt64)TAB_HEADER_SIZE+(UInt64)nbColumn*MAX_NAME+(UInt64)nbColumn*nbRow*sizeof(double) > (UInt64)status.st_size) )
+   {
+      strcpy( error, "invalid file" );
+      return -1;
+   }
+   input->nbBar = (int)nbRow;
+
+   for( i=0; i < nbColumn; i++ )
+   {
+      name = base+TAB_HEADER_SIZE+(size_t)i*MAX_NAME;
+      if( memchr( name, '\0', MAX_NAME ) == NULL )
+         continue;
+      column = columnIndex( name );
+      if( column >= 0 )
+      {
+         input->column[column] = (const double *)(base+TAB_HEADER_SIZE+(size_t)nbColumn*MAX_NAME+
+                                                  (size_t)i*nbRow*sizeof(double));
+      }
+   }
+
+   return 0;
+}
+
+/* The whole file is read at once and parsed in place. */
+static int loadCsv( const char *fileName, InputData *input, char *error )
+{
+   char *buffer, *pos, *end, *next;
+   int fieldColumn[64];
+   unsigned int nbField, field, i;
+   double *owned;
+   struct stat status;
+   int fd, nbLine, lineNb;
+   ssize_t nbRead;
+   size_t size;
+
+   fd = open( fileName, O_RDONLY );
+   if( (fd < 0) || (fstat( fd, &status ) != 0) )
+   {
+      sprintf( error, "cannot open (%s)", strerror(errno) );
+      if( fd >= 0 )
+         close( fd );
+      return -1;
+   }
+
+   size = (size_t)status.st_size;
+   buffer = (char *)malloc( size+1 );
+   if( !buffer )
+   {
+      close( fd );
+      strcpy( error, "out of memory" );
+      return -1;
+   }
+
+   for( pos=buffer; pos < buffer+size; pos += nbRead )
+   {
+      nbRead = read( fd, pos, (size_t)(buffer+size-pos) );
+      if( nbRead <= 0 )
+         break;
+   }
+   close( fd );
+   if( pos != buffer+size )
+   {
+      free( buffer );
+      strcpy( error, "read failed" );
+      return -1;
+   }
+   buffer[size] = '\0';
+
+   /* The header gives the column of each field. */
+   end = strchr( buffer, '\n' );
+   if( end )
+      *end = '\0';
+
+   nbField = 0;
+   for( pos=buffer; pos && (nbField < 64); nbField++ )
+   {
+      next = strchr( pos, ',' );
+      if( next )
+         *next++ = '\0';
+      while( isspace( (unsigned char)*pos ) || (*pos == '"') )
+         pos++;
+      for( i=(unsigned int)strlen(pos); (i > 0) && (isspace( (unsigned char)pos[i-1] ) || (pos[i-1] == '"')); i-- )
+         pos[i-1] = '\0';
+      fieldColumn[nbField] = columnIndex( pos );
+      pos = next;
+   }
+
+   /* Upper bound of the number of bars. */
+   nbLine = 0;
+   for( pos=end? end+1 : buffer+size; *pos; pos++ )
+   {
+      if( *pos == '\n' )
+         nbLine++;
+   }
+   nbLine++;
+
+   owned = (double *)malloc( (size_t)NB_COLUMN*nbLine*sizeof(double) );
+   if( !owned )
+   {
+      free( buffer );
+      strcpy( error, "out of memory" );
+      return -1;
+   }
+   input->owned = owned;
+
+   for( i=0; i < nbField; i++ )
+   {
+      if( fieldColumn[i] >= 0 )
+         input->column[fieldColumn[i]] = owned+(size_t)fieldColumn[i]*nbLine;
+   }
+
+   /* The rows. */
+   lineNb = 1;
+   pos = end? end+1 : buffer+size;
+   while( *pos )
+   {
+      lineNb++;
+
+      /* Skip the empty lines. */
+      if( (*pos == '\n') || (*pos == '\r') )
+      {
+         pos++;
+         continue;
+      }
+
+      for( field=0; field < nbField; field++ )
+      {
+         if( fieldColumn[field] >= 0 )
+         {
+            ((double *)input->column[fieldColumn[field]])[input->nbBar] = strtod( pos, &next );
+            if( next == pos )
+            {
+               sprintf( error, "line %d: invalid number", lineNb );
+               free( buffer );
+               return -1;
+            }
+            pos = next;
+         }
+
+         while( *pos && (*pos != ',') && (*pos != '\n') )
+            pos++;
+
+         if( *pos == ',' )
+            pos++;
+         else if( field+1 < nbField )
+         {
+            sprintf( error, "line %d: %u fields expected", lineNb, nbField );
+            free( buffer );
+            return -1;
+         }
+      }
+
+      while( *pos && (*pos != '\n') )
+         pos++;
+      if( *pos == '\n' )
+         pos++;
+
+      input->nbBar++;
+   }
+
+   free( buffer );
+   return 0;
+}
+
+static void freeInput( InputData *input )
+{
+   if( input->map )
+      munmap( input->map, input->mapSize );
+   free( input->owned );
+   memset( input, 0, sizeof(InputData) );
+}
+
+/* Written in a temporary file, renamed when complete. */
+static int writeOutput( const Worker *worker, const char *fileName, int nbBar, char *error )
+{
+   char outName[MAX_LINE], tmpName[MAX_LINE+8];
+   const char *baseName, *extension;
+   char header[TAB_HEADER_SIZE];
+   unsigned int nbColumn, i, reserved;
+   UInt64 nbRow;
+   const double *column;
+   FILE *out;
+   int k, ok, length;
+
+   baseName = strrchr( fileName, '/' );
+   baseName = baseName? baseName+1 : fileName;
+   extension = strrchr( baseName, '.' );
+   length = extension? (int)(extension-baseName) : (int)strlen(baseName);
+
+   if( strlen(outDir)+strlen(baseName)+8 >= MAX_LINE )
+   {
+      strcpy( error, "path too long" );
+      return -1;
+   }
+   sprintf( outName, "%s/%.*s.%s", outDir, length, baseName,
+            outFormat == FORMAT_TAB? "tab" : "csv" );
+   sprintf( tmpName, "%s.tmp", outName );
+
+   out = fopen( tmpName, "wb" );
+   if( !out )
+   {
+      sprintf( error, "cannot create the output (%s)", strerror(errno) );
+      return -1;
+   }
+
+   ok = 1;
+   if( outFormat == FORMAT_TAB )
+   {
+      nbColumn = nbOutColumn;
+      reserved = 0;
+      nbRow    = (UInt64)nbBar;
+      memcpy( header, TAB_MAGIC, 8 );
+      memcpy( header+8, &nbColumn, sizeof(nbColumn) );
+      memcpy( header+12, &reserved, sizeof(reserved) );
+      memcpy( header+16, &nbRow, sizeof(nbRow) );
+      ok = (fwrite( header, TAB_HEADER_SIZE, 1, out ) == 1) &&
+           (fwrite( outColumnName, MAX_NAME, nbColumn, out ) == nbColumn);
+
+      for( i=0; (i < nbColumn) && ok && (nbBar > 0); i++ )
+      {
+         column = worker->out+(size_t)i*worker->capacity;
+         ok = fwrite( column, sizeof(double), (size_t)nbBar, out ) == (size_t)nbBar;
+      }
+   }
+   else
+   {
+      for( i=0; i < nbOutColumn; i++ )
+         fprintf( out, "%s%s", i? "," : "", outColumnName[i] );
+      fprintf( out, "\n" );
+
+      for( k=0; k < nbBar; k++ )
+      {
+         for( i=0; i < nbOutColumn; i++ )
+         {
+            column = worker->out+(size_t)i*worker->capacity;
+            if( i )
+               fputc( ',', out );
+            if( !isnan(column[k]) )
+               fprintf( out, "%.17g", column[k] );
+         }
+         fputc( '\n', out );
+      }
+   }
+
+   if( fclose( out ) != 0 )
+      ok = 0;
+
+   if( !ok || (rename( tmpName, outName ) != 0) )
+   {
+      sprintf( error, "cannot write the output (%s)", strerror(errno) );
+      unlink( tmpName );
+      return -1;
+   }
+
+   return 0;
+}
+
+/* Index of an input column, -1 when not one of the columns used. */
+static int columnIndex( const char *name )
+{
+   char lower[MAX_NAME];
+   unsigned int i, j;
+
+   /* "Open Interest", "open_interest"... are all "openinterest". */
+   j = 0;
+   for( i=0; name[i] && (j < MAX_NAME-1); i++ )
+   {
+      if( !isspace( (unsigned char)name[i] ) && (name[i] != '_') )
+         lower[j++] = (char)tolower( (unsigned char)name[i] );
+   }
+   lower[j] = '\0';
+
+   for( i=0; i < NB_COLUMN; i++ )
+   {
+      if( strcmp( lower, columnName[i] ) == 0 )
+         return (int)i;
+   }
+
+   return -1;
+}
+
+static int sameName( const char *a, const char *b )
+{
+   while( *a && *b && (tolower( (unsigned char)*a ) == tolower( (unsigned char)*b )) )
+   {
+      a++;
+      b++;
+   }
+
+   return (*a == '\0') && (*b == '\0');
+}
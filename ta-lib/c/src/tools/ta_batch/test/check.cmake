@@ -0,0 +1,21 @@
+# Golden-output check of ta_batch, run by ctest (see c/CMakeLists.txt):
+# calculate test.spec over test.csv and compare with test_expected.csv.
+#
+# Defined by the caller: TA_BATCH (the executable), TEST_DIR (this
+# directory) and OUT_DIR (a scratch directory).
+FILE(REMOVE_RECURSE ${OUT_DIR})
+FILE(MAKE_DIRECTORY ${OUT_DIR})
+
+EXECUTE_PROCESS(COMMAND ${TA_BATCH} -s ${TEST_DIR}/test.spec -o ${OUT_DIR}
+                        -f csv -j 1 ${TEST_DIR}/test.csv
+                RESULT_VARIABLE result)
+IF(NOT result EQUAL 0)
+	MESSAGE(FATAL_ERROR "ta_batch failed (${result})")
+ENDIF(NOT result EQUAL 0)
+
+EXECUTE_PROCESS(COMMAND ${CMAKE_COMMAND} -E compare_files
+                        ${OUT_DIR}/test.csv ${TEST_DIR}/test_expected.csv
+                RESULT_VARIABLE result)
+IF(NOT result EQUAL 0)
+	MESSAGE(FATAL_ERROR "${OUT_DIR}/test.csv differs from test_expected.csv")
+ENDIF(NOT result EQUAL 0)
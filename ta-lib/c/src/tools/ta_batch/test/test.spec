@@ -0,0 +1,9 @@
+# Indicators of the golden-output check (see check.cmake).
+# Prices in quarters and periods of 4 or 5: the sums are exact and the
+# output does not depend on the compiler or its optimizations.
+sma4    SMA       TimePeriod=4
+max5    MAX       TimePeriod=5 inReal=high
+min5    MIN       TimePeriod=5 inReal=low
+bb      BBANDS    TimePeriod=4 NbDevUp=2 NbDevDn=2 MAType=SMA
+mid     MIDPRICE  TimePeriod=4
+tr      TRANGE
@@ -0,0 +1,235 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Read the CPU hardware counters around the calls profiled
+ *     with the '-c' option of ta_regtest.
+ *
+ *     Uses perf_event_open on Linux. The counters are only for
+ *     the user space of the calling thread. On other platforms,
+ *     or when the kernel refuses (see
+ *     /proc/sys/kernel/perf_event_paranoid), the counters are
+ *     reported as not available.
+ */
+
+/**** Headers ****/
+#if defined( __linux__ )
+   #include <unistd.h>
+   #include <sys/ioctl.h>
+   #include <sys/syscall.h>
+   #include <linux/perf_event.h>
+#endif
+
+#include <string.h>
+#include "ta_test_priv.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+/* None */
+
+/**** Local functions declarations.    ****/
+/* None */
+
+/**** Local variables definitions.     ****/
+#if defined( __linux__ )
+/* One file descriptor per counter, the first one is the group
+ * leader. -1 when the counter could not be opened.
+ */
+static int perfFd[PERF_NB_COUNTER] = { -1, -1, -1, -1, -1 };
+
+/* Position of each counter in the values read from the group. */
+static int perfPos[PERF_NB_COUNTER];
+static int perfNbOpen = 0;
+#endif
+
+/**** Global functions definitions.   ****/
+#if defined( __linux__ )
+int perfCountersOpen( void )
+{
+   struct perf_event_attr attr;
+   int i;
+
+   if( perfNbOpen )
+      return 1;
+
+   for( i=0; i < PERF_NB_COUNTER; i++ )
+   {
+      memset( &attr, 0, sizeof(attr) );
+      attr.size = sizeof(attr);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP |
+                         PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      switch( i )
+      {
+      case PERF_CYCLES:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CPU_CYCLES;
+         attr.disabled = 1; /* Only the leader is disabled. */
+         break;
+      case PERF_INSTRUCTIONS:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+         break;
+      case PERF_L1D_MISSES:
+         attr.type   = PERF_TYPE_HW_CACHE;
+         attr.config = PERF_COUNT_HW_CACHE_L1D |
+                       (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+         break;
+      case PERF_LLC_MISSES:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CACHE_MISSES;
+         break;
+      case PERF_BRANCH_MISSES:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+         break;
+      }
+
+      perfFd[i] = (int)syscall( __NR_perf_event_open, &attr, 0, -1,
+                                i == 0? -1 : perfFd[0], 0 );
+
+      if( perfFd[i] < 0 )
+      {
+         /* Without cycles, there is no group. */
+         if( i == 0 )
+            return 0;
+         perfPos[i] = -1;
+      }
+      else
+         perfPos[i] = perfNbOpen++;
+   }
+
+   return 1;
+}
+
+void perfCountersClose( void )
+{
+   int i;
+
+   for( i=0; i < PERF_NB_COUNTER; i++ )
+   {
+      if( perfFd[i] >= 0 )
+         close( perfFd[i] );
+      perfFd[i] = -1;
+   }
+   perfNbOpen = 0;
+}
+
+void perfCountersStart( void )
+{
+   if( !perfNbOpen )
+      return;
+
+   ioctl( perfFd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+   ioctl( perfFd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+}
+
+void perfCountersStop( PerfCounters *counters )
+{
+   /* nr, time enabled, time running and one value per counter. */
+   UInt64 data[3+PERF_NB_COUNTER];
+   double scale;
+   int i;
+
+   if( !perfNbOpen )
+      return;
+
+   ioctl( perfFd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+   if( read( perfFd[0], data, sizeof(data) ) < (ssize_t)(3*sizeof(UInt64)) )
+      return;
+
+   /* Not scheduled at all (counters taken by something else). */
+   if( data[2] == 0 )
+      return;
+
+   /* Scale when the group was multiplexed with other events. */
+   scale = (double)data[1]/(double)data[2];
+
+   for( i=0; i < PERF_NB_COUNTER; i++ )
+   {
+      if( perfPos[i] >= 0 )
+      {
+         counters->value[i] += (double)data[3+perfPos[i]]*scale;
+         counters->valid[i] = 1;
+      }
+   }
+}
+#else
+int perfCountersOpen( void )
+{
+   return 0;
+}
+
+void perfCountersClose( void )
+{
+}
+
+void perfCountersStart( void )
+{
+}
+
+void perfCountersStop( PerfCounters *counters )
+{
+   (void)counters;
+}
+#endif
+
+/**** Local functions definitions.     ****/
+/* None */
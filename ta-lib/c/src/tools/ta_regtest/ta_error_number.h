@@ -33,6 +33,7 @@ typedef enum
   TA_REGTEST_HISTORYALLOC_19          = 24,
   TA_REGTEST_ADDDSOURCE_FAILED        = 25,
   TA_REGTEST_OPTIMIZATION_REF_ERROR   = 26,
+  TA_REGTEST_PERF_COUNTERS_FAILED     = 27,
 
   /* Error code for test in test_util.c */
   TA_TESTUTIL_INIT_FAILED             = 101,
@@ -223,6 +224,41 @@ typedef enum
   TA_ABS_TST_FAIL_STARTEND_ZERO         = 617,
   TA_ABS_TST_FAIL_FUNCTION_DESC_SMALL   = 618,
   TA_ABS_TST_FAIL_FUNCTION_DESC_LARGE   = 619,
+  TA_ABS_TST_FAIL_INPLACE_FLAG          = 620,
+  TA_ABS_TST_FAIL_INPLACE_CALLFUNC      = 621,
+  TA_ABS_TST_FAIL_INPLACE_BEGIDX        = 622,
+  TA_ABS_TST_FAIL_INPLACE_NBELEMENT     = 623,
+  TA_ABS_TST_FAIL_INPLACE_DIFF          = 624,
+  TA_ABS_TST_FAIL_INDICES_CALLFUNC      = 625,
+  TA_ABS_TST_FAIL_INDICES_BEGIDX        = 626,
+  TA_ABS_TST_FAIL_INDICES_NBELEMENT     = 627,
+  TA_ABS_TST_FAIL_INDICES_DIFF          = 628,
+  TA_ABS_TST_FAIL_SERIES_INDEX_ALLOC    = 629,
+  TA_ABS_TST_FAIL_SERIES_INDEX_CALLFUNC = 630,
+  TA_ABS_TST_FAIL_SERIES_INDEX_DIFF     = 631,
+  TA_ABS_TST_FAIL_SEGMENTS_CALLFUNC     = 632,
+  TA_ABS_TST_FAIL_SEGMENTS_BEGIDX       = 633,
+  TA_ABS_TST_FAIL_SEGMENTS_NBELEMENT    = 634,
+  TA_ABS_TST_FAIL_SEGMENTS_DIFF         = 635,
+  TA_ABS_TST_FAIL_ALIGNED_CALLFUNC      = 636,
+  TA_ABS_TST_FAIL_ALIGNED_RANGE         = 637,
+  TA_ABS_TST_FAIL_ALIGNED_DIFF          = 638,
+  TA_ABS_TST_FAIL_STATS_CALLFUNC        = 639,
+  TA_ABS_TST_FAIL_STATS_GET             = 640,
+  TA_ABS_TST_FAIL_STATS_VALUE           = 641,
+  TA_ABS_TST_FAIL_CHECKPOINT_CALLFUNC   = 642,
+  TA_ABS_TST_FAIL_CHECKPOINT_RESUME     = 643,
+  TA_ABS_TST_FAIL_CHECKPOINT_DIFF       = 644,
+  TA_ABS_TST_FAIL_CACHE_ALLOC           = 645,
+  TA_ABS_TST_FAIL_CACHE_CALLFUNC        = 646,
+  TA_ABS_TST_FAIL_CACHE_DIFF            = 647,
+  TA_ABS_TST_FAIL_CACHE_STATS           = 648,
+  TA_ABS_TST_FAIL_TIMEFRAMES_ALLOC      = 649,
+  TA_ABS_TST_FAIL_TIMEFRAMES_CALLFUNC   = 650,
+  TA_ABS_TST_FAIL_TIMEFRAMES_DIFF       = 651,
+  TA_ABS_TST_FAIL_GETMAXLOOKBACK        = 652,
+  TA_ABS_TST_FAIL_COMPACT_CALLFUNC      = 653,
+  TA_ABS_TST_FAIL_COMPACT_DIFF          = 654,
 
   /* Error code related to internal tests. */
   TA_INTERNAL_CIRC_BUFF_FAIL_0      = 700,
@@ -237,6 +273,13 @@ typedef enum
   TA_INTERNAL_TIMESTAMP_TEST_FAILED = 709,
   TA_INTERNAL_PSEUDORANDOM_UINT32   = 710,
   TA_INTERNAL_PSEUDORANDOM_DOUBLE   = 711,
+  TA_INTERNAL_BAR_BUILDER_ALLOC     = 712,
+  TA_INTERNAL_BAR_BUILDER_ADD       = 713,
+  TA_INTERNAL_BAR_BUILDER_VALUE     = 714,
+  TA_INTERNAL_BAR_QUEUE_ALLOC       = 715,
+  TA_INTERNAL_BAR_QUEUE_PUSH        = 716,
+  TA_INTERNAL_BAR_QUEUE_POP         = 717,
+  TA_INTERNAL_BAR_QUEUE_VALUE       = 718,
 
   /* Error code related to CSI data source tests. */
   TA_CSI_ADDDATASOURCE_FAILED    = 800,
@@ -285,6 +328,12 @@ typedef enum
   TA_TSTMERGE_ASCII_BAD_PATTERN_CLOSE = 1018,
   TA_TSTMERGE_ASCII_BAD_PATTERN_TS    = 1019,  
 
+  /* Error code related to test_differential */
+  TA_DIFF_TST_ALLOC_FAILED            = 1100,
+  TA_DIFF_TST_REF_CALLFUNC            = 1101,
+  TA_DIFF_TST_PATH_CALLFUNC           = 1102,
+  TA_DIFF_TST_GATE                    = 1103,
+
   /* Error code related to bug fix documentented on SourceForge. */
   TA_TEST_FAIL_BUG1359452_1  = 2000,
   TA_TEST_FAIL_BUG1359452_2  = 2001,
@@ -38,6 +38,7 @@
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
  *  AB       Anatoliy Belsky
+ *  AG       agent <agent@local>
  *
  *
  * Change history:
@@ -50,6 +51,10 @@
  *  122506 MF   Add MININDEX,MAXINDEX,MINMAX and MINMAXINDEX.
  *  101812 AB   Add AVGDEV.
  *  101912 AB   Add IMI.
+ *  101826 AG   Add -c option (hardware counters profiling).
+ *  101826 AG   Add differential tests (-d option).
+ *  101826 AG   Add MEDIAN, QUANTILE and MAD.
+ *  101826 AG   Add CROSSOVER, CROSSUNDER and THRESHOLD_EVENTS.
  */
 
 /* Description:
@@ -82,9 +87,13 @@ double timeInProfiledCall;
 double worstProfiledCall;
 int insufficientClockPrecision;
 int doExtensiveProfiling;
+int doCounterProfiling;
 
 /**** Local declarations.              ****/
-/* None */
+
+/* Size of the series for the differential tests. */
+#define DIFF_NB_BAR_REGTEST 5000
+#define DIFF_NB_BAR_REPORT  10000000
 
 /**** Local functions declarations.    ****/
 static ErrorNumber testTAFunction_ALL( void );
@@ -101,6 +110,7 @@ int main( int argc, char **argv )
 	LARGE_INTEGER QPFrequency;
 #endif
    double freq;
+   int nbBar;
 
    ErrorNumber retValue;
 
@@ -111,11 +121,34 @@ int main( int argc, char **argv )
    worstProfiledCall = 0.0;
    nbProfiledCall = 0;
    doExtensiveProfiling = 0;
+   doCounterProfiling = 0;
 
    printf( "\n" );
    printf( "ta_regtest V%s - Regression Tests of TA-Lib code\n", TA_GetVersionString() );
    printf( "\n" );
 
+   /* Only the differential tests, on long series. */
+   if( (argc >= 2) && (argc <= 3) && (strcmp( argv[1], "-d" ) == 0) )
+   {
+      nbBar = (argc == 3)? atoi( argv[2] ) : DIFF_NB_BAR_REPORT;
+      if( nbBar < 100 )
+      {
+         printUsage();
+         return TA_REGTEST_BAD_USER_PARAM;
+      }
+
+      printf( "Testing the alternate paths on synthetic series\n" );
+      retValue = test_differential( nbBar, 1 );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "\nFailed: Differential Tests (error number = %d)\n", retValue );
+         return retValue;
+      }
+
+      printf( "\n* All differential tests succeeded. *\n" );
+      return TA_TEST_PASS;
+   }
+
    if( argc == 2 )
    {
 	   /* Detect option to perform extended profiling. */
@@ -123,6 +156,17 @@ int main( int argc, char **argv )
 	   {
 		   doExtensiveProfiling = 1;
 	   }
+	   else if( (argv[1][0] == '-') && (argv[1][1] == 'c') && (argv[1][2] == '\0'))
+	   {
+		   /* Same as '-p', with the hardware counters. */
+		   if( !perfCountersOpen() )
+		   {
+			   printf( "Hardware performance counters not available.\n" );
+			   return TA_REGTEST_PERF_COUNTERS_FAILED;
+		   }
+		   doExtensiveProfiling = 1;
+		   doCounterProfiling = 1;
+	   }
 	   else
 	   {
 		   printUsage();
@@ -149,6 +193,8 @@ int main( int argc, char **argv )
 
    /* Test abstract interface. */
    retValue = test_abstract();
+   if( doCounterProfiling )
+      perfCountersClose();
    if( retValue != TA_TEST_PASS )
    {
       printf( "Failed: Abstract interface Tests (error number = %d)\n", retValue );
@@ -158,6 +204,15 @@ int main( int argc, char **argv )
    /* Perform all regresstions tests (except when ta_regtest is executed for profiling only). */
    if( !doExtensiveProfiling )
    {
+      /* Compare the alternate paths with TA_CallFunc. */
+      printf( "Testing the alternate paths on synthetic series\n" );
+      retValue = test_differential( DIFF_NB_BAR_REGTEST, 0 );
+      if( retValue != TA_TEST_PASS )
+      {
+         printf( "Failed: Differential Tests (error number = %d)\n", retValue );
+         return retValue;
+      }
+
       retValue = test_with_simulator();
       if( retValue != TA_TEST_PASS )
          return retValue;
@@ -272,6 +327,8 @@ static ErrorNumber testTAFunction_ALL( void )
    DO_TEST( test_func_trange,   "TRANGE,ATR" );
    DO_TEST( test_func_stddev,   "STDDEV,VAR" );
    DO_TEST( test_func_avgdev,   "AVGDEV" );
+   DO_TEST( test_func_quantile, "MEDIAN,QUANTILE,MAD" );
+   DO_TEST( test_func_cross,    "CROSSOVER,CROSSUNDER,THRESHOLD_EVENTS" );
    DO_TEST( test_func_bbands,   "BBANDS" );
    DO_TEST( test_candlestick,   "All Candlesticks" );
 
@@ -280,7 +337,7 @@ static ErrorNumber testTAFunction_ALL( void )
 
 static void printUsage(void)
 {
-      printf( "Usage: ta_regtest [-p]\n" );
+      printf( "Usage: ta_regtest [-p|-c|-d [nbBar]]\n" );
       printf( "\n" );
       printf( "   No parameter needed for regression testing.\n" );
       printf( "\n" );
@@ -295,6 +352,18 @@ static void printUsage(void)
       printf( "       intended only for the TA-Lib developers. It is\n" );
       printf( "       not further documented for general use.\n" );
       printf( "\n" );
+      printf( "    -c Same as -p, but report for each function and input\n" );
+      printf( "       size the CPU cycles, instructions, L1 data and last\n" );
+      printf( "       level cache misses and branch mispredicts per output\n" );
+      printf( "       bar (Linux perf_event_open only).\n" );
+      printf( "\n" );
+      printf( "    -d Only the differential tests: all the functions\n" );
+      printf( "       through each alternate path (aligned, in-place,\n" );
+      printf( "       segments, cache, float inputs...) compared with\n" );
+      printf( "       TA_CallFunc on synthetic series of nbBar bars\n" );
+      printf( "       (default 10000000). Report the largest error of\n" );
+      printf( "       each function for each path.\n" );
+      printf( "\n" );
       printf( "   On success, the exit code is 0.\n" );
       printf( "   On failure, the exit code is a number that can be\n" );
       printf( "   found in c/src/tools/ta_regtest/ta_error_number.h\n" );
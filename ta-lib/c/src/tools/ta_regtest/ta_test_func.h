@@ -24,5 +24,7 @@ ErrorNumber test_func_1in_1out( TA_History *history );
 ErrorNumber test_func_1in_2out( TA_History *history );
 ErrorNumber test_func_avgdev  ( TA_History *history );
 ErrorNumber test_func_imi     ( TA_History *history );
+ErrorNumber test_func_quantile( TA_History *history );
+ErrorNumber test_func_cross   ( TA_History *history );
 
 #endif
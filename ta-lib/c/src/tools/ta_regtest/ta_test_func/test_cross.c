@@ -0,0 +1,363 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Test CROSSOVER, CROSSUNDER and THRESHOLD_EVENTS functions.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_CROSSOVER_TEST,
+   TA_CROSSUNDER_TEST,
+   TA_THRESHOLD_EVENTS_TEST
+} TA_TestId;
+
+#define NB_TEST_ID 3
+
+typedef struct
+{
+   TA_TestId      theFunction;
+   const TA_Real *inReal0;
+   const TA_Real *inReal1;   /* Not used by THRESHOLD_EVENTS. */
+   TA_Real        threshold; /* THRESHOLD_EVENTS only. */
+} TA_RangeTestParam;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test_small( void );
+static ErrorNumber do_test_reference( const TA_History *history );
+
+static TA_RetCode callFunc( const TA_RangeTestParam *param,
+                            TA_Integer startIdx,
+                            TA_Integer endIdx,
+                            TA_Integer *outBegIdx,
+                            TA_Integer *outNbElement,
+                            TA_Integer *outInteger,
+                            TA_Integer *lookback );
+
+static TA_Integer referenceValue( const TA_RangeTestParam *param, int i );
+
+/**** Local variables definitions.     ****/
+
+/* The second series is constant, so the three functions
+ * must agree with each other. The values equal to the
+ * threshold test the ties.
+ */
+static const TA_Real smallIn0[]  = { 1.0, 2.0, 3.0, 2.0, 2.0, 3.0, 1.0, 2.0, 2.0 };
+static const TA_Real smallIn1[]  = { 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0 };
+
+static const TA_Integer smallCrossOver[]  = { 0, 100, 0, 0, 100,    0, 0, 0 };
+static const TA_Integer smallCrossUnder[] = { 0,   0, 0, 0,   0,  100, 0, 0 };
+static const TA_Integer smallEvents[]     = { 0, 100, 0, 0, 100, -100, 0, 0 };
+
+#define NB_SMALL (sizeof(smallIn0)/sizeof(TA_Real))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_cross( TA_History *history )
+{
+   ErrorNumber retValue;
+
+   retValue = do_test_small();
+   if( retValue != 0 )
+      return retValue;
+
+   retValue = do_test_reference( history );
+   if( retValue != 0 )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode callFunc( const TA_RangeTestParam *param,
+                            TA_Integer startIdx,
+                            TA_Integer endIdx,
+                            TA_Integer *outBegIdx,
+                            TA_Integer *outNbElement,
+                            TA_Integer *outInteger,
+                            TA_Integer *lookback )
+{
+   TA_RetCode retCode;
+
+   switch( param->theFunction )
+   {
+   case TA_CROSSOVER_TEST:
+      retCode = TA_CROSSOVER( startIdx, endIdx,
+                              param->inReal0, param->inReal1,
+                              outBegIdx, outNbElement, outInteger );
+      *lookback = TA_CROSSOVER_Lookback();
+      break;
+   case TA_CROSSUNDER_TEST:
+      retCode = TA_CROSSUNDER( startIdx, endIdx,
+                               param->inReal0, param->inReal1,
+                               outBegIdx, outNbElement, outInteger );
+      *lookback = TA_CROSSUNDER_Lookback();
+      break;
+   case TA_THRESHOLD_EVENTS_TEST:
+      retCode = TA_THRESHOLD_EVENTS( startIdx, endIdx,
+                                     param->inReal0, param->threshold,
+                                     outBegIdx, outNbElement, outInteger );
+      *lookback = TA_THRESHOLD_EVENTS_Lookback( param->threshold );
+      break;
+   default:
+      retCode = TA_INTERNAL_ERROR(133);
+   }
+
+   return retCode;
+}
+
+/* Straightforward calculation of the output at 'i'. */
+static TA_Integer referenceValue( const TA_RangeTestParam *param, int i )
+{
+   const TA_Real *in0, *in1;
+   TA_Real prev1, cur1;
+
+   in0 = param->inReal0;
+   in1 = param->inReal1;
+   if( param->theFunction == TA_THRESHOLD_EVENTS_TEST )
+      prev1 = cur1 = param->threshold;
+   else
+   {
+      prev1 = in1[i-1];
+      cur1  = in1[i];
+   }
+
+   if( param->theFunction != TA_CROSSUNDER_TEST )
+   {
+      if( (in0[i-1] <= prev1) && (in0[i] > cur1) )
+         return 100;
+   }
+
+   if( param->theFunction != TA_CROSSOVER_TEST )
+   {
+      if( (in0[i-1] >= prev1) && (in0[i] < cur1) )
+         return (param->theFunction == TA_CROSSUNDER_TEST)? 100 : -100;
+   }
+
+   return 0;
+}
+
+static TA_RetCode rangeTestFunction( TA_Integer    startIdx,
+                                     TA_Integer    endIdx,
+                                     TA_Real      *outputBuffer,
+                                     TA_Integer   *outputBufferInt,
+                                     TA_Integer   *outBegIdx,
+                                     TA_Integer   *outNbElement,
+                                     TA_Integer   *lookback,
+                                     void         *opaqueData,
+                                     unsigned int  outputNb,
+                                     unsigned int *isOutputInteger )
+{
+   (void)outputNb;
+   (void)outputBuffer;
+
+   *isOutputInteger = 1;
+
+   return callFunc( (const TA_RangeTestParam *)opaqueData, startIdx, endIdx,
+                    outBegIdx, outNbElement, outputBufferInt, lookback );
+}
+
+static ErrorNumber do_test_small( void )
+{
+   static const TA_Integer *expected[NB_TEST_ID] =
+   {
+      smallCrossOver, smallCrossUnder, smallEvents
+   };
+   TA_RangeTestParam param;
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, lookback;
+   TA_Integer out[NB_SMALL];
+   int id, i;
+
+   param.inReal0   = smallIn0;
+   param.inReal1   = smallIn1;
+   param.threshold = 2.0;
+
+   for( id=0; id < NB_TEST_ID; id++ )
+   {
+      param.theFunction = (TA_TestId)id;
+
+      retCode = callFunc( &param, 0, NB_SMALL-1, &outBegIdx,
+                          &outNbElement, out, &lookback );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "Fail: cross test %d [%d]\n", id, retCode );
+         return TA_TESTUTIL_TFRR_BAD_RETCODE;
+      }
+
+      if( (outBegIdx != 1) || (lookback != 1) )
+      {
+         printf( "Fail: cross test %d begIdx=%d lookback=%d\n", id, outBegIdx, lookback );
+         return TA_TESTUTIL_TFRR_BAD_BEGIDX;
+      }
+
+      if( outNbElement != (TA_Integer)NB_SMALL-1 )
+      {
+         printf( "Fail: cross test %d nbElement=%d\n", id, outNbElement );
+         return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+      }
+
+      for( i=0; i < outNbElement; i++ )
+      {
+         if( out[i] != expected[id][i] )
+         {
+            printf( "Fail: cross test %d at %d (%d != %d)\n",
+                    id, i, out[i], expected[id][i] );
+            return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+         }
+      }
+
+      /* Nothing to calculate when only the first bar is requested. */
+      retCode = callFunc( &param, 0, 0, &outBegIdx,
+                          &outNbElement, out, &lookback );
+      if( (retCode != TA_SUCCESS) || (outBegIdx != 0) || (outNbElement != 0) )
+      {
+         printf( "Fail: cross test %d on the first bar only\n", id );
+         return TA_TESTUTIL_TFRR_BAD_OUTNBELEMENT;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* The close crossing its moving average and its mean. */
+static ErrorNumber do_test_reference( const TA_History *history )
+{
+   TA_RangeTestParam param;
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, lookback;
+   TA_Real *average;
+   TA_Integer *out;
+   TA_Real sum;
+   ErrorNumber errNb;
+   int nbBar, id, i, nbEvent;
+
+   nbBar   = history->nbBars;
+   average = gBuffer[0].in;
+   out     = (TA_Integer *)gBuffer[1].out0;
+
+   /* Moving average aligned with the close (the close
+    * itself during the lookback).
+    */
+   retCode = TA_SMA( 0, nbBar-1, history->close, 10,
+                     &outBegIdx, &outNbElement, gBuffer[0].out0 );
+   if( retCode != TA_SUCCESS )
+      return TA_TESTUTIL_TFRR_BAD_RETCODE;
+   for( i=0; i < outBegIdx; i++ )
+      average[i] = history->close[i];
+   for( i=0; i < outNbElement; i++ )
+      average[outBegIdx+i] = gBuffer[0].out0[i];
+
+   sum = 0.0;
+   for( i=0; i < nbBar; i++ )
+      sum += history->close[i];
+
+   param.inReal0   = history->close;
+   param.inReal1   = average;
+   param.threshold = sum/nbBar;
+
+   for( id=0; id < NB_TEST_ID; id++ )
+   {
+      param.theFunction = (TA_TestId)id;
+
+      retCode = callFunc( &param, 0, nbBar-1, &outBegIdx,
+                          &outNbElement, out, &lookback );
+      if( (retCode != TA_SUCCESS) || (outBegIdx != 1) ||
+          (outNbElement != nbBar-1) )
+      {
+         printf( "Fail: cross reference test %d [%d]\n", id, retCode );
+         return TA_TESTUTIL_TFRR_BAD_RETCODE;
+      }
+
+      nbEvent = 0;
+      for( i=0; i < outNbElement; i++ )
+      {
+         if( out[i] != referenceValue( &param, i+1 ) )
+         {
+            printf( "Fail: cross reference test %d at %d (%d != %d)\n",
+                    id, i, out[i], referenceValue( &param, i+1 ) );
+            return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+         }
+         if( out[i] != 0 )
+            nbEvent++;
+      }
+
+      /* Make sure the data has something to detect. */
+      if( nbEvent == 0 )
+      {
+         printf( "Fail: cross reference test %d has no event\n", id );
+         return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+      }
+
+      errNb = doRangeTest( rangeTestFunction,
+                           TA_FUNC_UNST_NONE,
+                           (void *)&param, 1, 0 );
+      if( errNb != TA_TEST_PASS )
+         return errNb;
+   }
+
+   return TA_TEST_PASS;
+}
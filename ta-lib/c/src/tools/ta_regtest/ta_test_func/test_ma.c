@@ -189,6 +189,11 @@ static TA_Test tableTest[] =
    { 0, TA_ANY_MA_TEST, 0, 0, 251, 30, TA_MAType_SMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS, 221, 107.95,  29,  252-29 },
    { 0, TA_ANY_MA_TEST, 0, 0, 251, 30, TA_MAType_SMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS, 222, 108.42,  29,  252-29 }, /* Last Value */
 
+   /* Period 20 (specialized copy of TA_INT_SMA) */
+   { 1, TA_ANY_MA_TEST, 0, 0, 251, 20, TA_MAType_SMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,   0,  92.8910, 19,  252-19 }, /* First Value */
+   { 0, TA_ANY_MA_TEST, 0, 0, 251, 20, TA_MAType_SMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,   1,  92.7347, 19,  252-19 },
+   { 0, TA_ANY_MA_TEST, 0, 0, 251, 20, TA_MAType_SMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS, 232, 110.5700, 19,  252-19 }, /* Last Value */
+
    /* Same test and result as TA_COMPATIBILITY_DEFAULT */
    { 1, TA_ANY_MA_TEST, 0, 0, 251,  2, TA_MAType_SMA, TA_COMPATIBILITY_METASTOCK, TA_SUCCESS,   0,   93.15,  1,  252-1  }, /* First Value */
    { 0, TA_ANY_MA_TEST, 0, 0, 251,  2, TA_MAType_SMA, TA_COMPATIBILITY_METASTOCK, TA_SUCCESS,   1,   94.59,  1,  252-1  },
@@ -275,6 +280,11 @@ static TA_Test tableTest[] =
    { 0, TA_ANY_MA_TEST, 0, 0, 251,  10, TA_MAType_EMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,   20,  86.46,  9, 243 },
    { 0, TA_ANY_MA_TEST, 0, 0, 251,  10, TA_MAType_EMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,  242, 108.97,  9, 243 }, /* Last Value */
 
+   /* Period 12 (specialized copy of TA_INT_EMA) */
+   { 1, TA_ANY_MA_TEST, 0, 0, 251,  12, TA_MAType_EMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,    0,  93.8025, 11, 241 }, /* First Value */
+   { 0, TA_ANY_MA_TEST, 0, 0, 251,  12, TA_MAType_EMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,    1,  94.5252, 11, 241 },
+   { 0, TA_ANY_MA_TEST, 0, 0, 251,  12, TA_MAType_EMA, TA_COMPATIBILITY_DEFAULT, TA_SUCCESS,  240, 108.9814, 11, 241 }, /* Last Value */
+
    /*******************************/
    /*   EMA TEST - Metastock      */
    /*******************************/
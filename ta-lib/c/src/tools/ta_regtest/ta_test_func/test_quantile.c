@@ -0,0 +1,424 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Test MEDIAN, QUANTILE and MAD functions.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum
+{
+   TA_MEDIAN_TEST,
+   TA_QUANTILE_TEST,
+   TA_MAD_TEST
+} TA_TestId;
+
+typedef struct
+{
+   TA_Integer doRangeTestFlag; /* One will do a call to doRangeTest */
+
+   TA_TestId  theFunction;
+
+   TA_Integer startIdx;
+   TA_Integer endIdx;
+
+   TA_Integer optInTimePeriod;
+   TA_Real    optInQuantile; /* QUANTILE only. */
+
+   TA_RetCode expectedRetCode;
+
+   TA_Integer oneOfTheExpectedOutRealIndex0;
+   TA_Real    oneOfTheExpectedOutReal0;
+
+   TA_Integer expectedBegIdx;
+   TA_Integer expectedNbElement;
+} TA_Test;
+
+typedef struct
+{
+   const TA_Test *test;
+   const TA_Real *close;
+} TA_RangeTestParam;
+
+/**** Local functions declarations.    ****/
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test );
+
+static ErrorNumber do_test_reference( const TA_History *history );
+
+static TA_RetCode callFunc( const TA_Test *test,
+                            TA_Integer startIdx,
+                            TA_Integer endIdx,
+                            const TA_Real *inReal,
+                            TA_Integer *outBegIdx,
+                            TA_Integer *outNbElement,
+                            TA_Real *outReal,
+                            TA_Integer *lookback );
+
+static int compareReal( const void *a, const void *b );
+static TA_Real sortedQuantile( const TA_Real *sorted, int nbElement, TA_Real quantile );
+
+/**** Local variables definitions.     ****/
+
+static TA_Test tableTest[] =
+{
+   /*************************/
+   /*      MEDIAN TEST      */
+   /*************************/
+   { 1, TA_MEDIAN_TEST, 0, 251,  5, 0.0, TA_SUCCESS,      0, 94.375,  4,  252-4  }, /* First Value */
+   { 0, TA_MEDIAN_TEST, 0, 251,  5, 0.0, TA_SUCCESS,      1, 94.625,  4,  252-4  },
+   { 0, TA_MEDIAN_TEST, 0, 251,  5, 0.0, TA_SUCCESS,  252-5, 109.0,   4,  252-4  }, /* Last Value */
+
+   { 1, TA_MEDIAN_TEST, 0, 251, 14, 0.0, TA_SUCCESS,      0, 94.0775, 13, 252-13 }, /* First Value */
+   { 0, TA_MEDIAN_TEST, 0, 251, 14, 0.0, TA_SUCCESS, 252-14, 109.195, 13, 252-13 }, /* Last Value */
+
+   /*************************/
+   /*     QUANTILE TEST     */
+   /*************************/
+   { 1, TA_QUANTILE_TEST, 0, 251, 10, 0.25, TA_SUCCESS,      0, 92.485,   9,  252-9  }, /* First Value */
+   { 0, TA_QUANTILE_TEST, 0, 251, 10, 0.25, TA_SUCCESS,      1, 92.585,   9,  252-9  },
+   { 0, TA_QUANTILE_TEST, 0, 251, 10, 0.25, TA_SUCCESS, 252-10, 108.6525, 9,  252-9  }, /* Last Value */
+
+   { 1, TA_QUANTILE_TEST, 0, 251, 14, 0.9,  TA_SUCCESS,      0, 96.9125,  13, 252-13 }, /* First Value */
+   { 0, TA_QUANTILE_TEST, 0, 251, 14, 0.9,  TA_SUCCESS, 252-14, 109.943,  13, 252-13 }, /* Last Value */
+
+   { 0, TA_QUANTILE_TEST, 0, 251, 14, 1.1,  TA_BAD_PARAM,     0, 0.0,      0, 0      },
+
+   /*************************/
+   /*       MAD TEST        */
+   /*************************/
+   { 1, TA_MAD_TEST, 0, 251,  5, 0.0, TA_SUCCESS,      0, 0.595,  4,  252-4  }, /* First Value */
+   { 0, TA_MAD_TEST, 0, 251,  5, 0.0, TA_SUCCESS,      1, 0.25,   4,  252-4  },
+   { 0, TA_MAD_TEST, 0, 251,  5, 0.0, TA_SUCCESS,  252-5, 0.75,   4,  252-4  }, /* Last Value */
+
+   { 1, TA_MAD_TEST, 0, 251, 14, 0.0, TA_SUCCESS,      0, 1.5775, 13, 252-13 }, /* First Value */
+   { 0, TA_MAD_TEST, 0, 251, 14, 0.0, TA_SUCCESS, 252-14, 0.565,  13, 252-13 }  /* Last Value */
+};
+
+#define NB_TEST (sizeof(tableTest)/sizeof(TA_Test))
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_quantile( TA_History *history )
+{
+   unsigned int i;
+   ErrorNumber retValue;
+
+   for( i=0; i < NB_TEST; i++ )
+   {
+      if( (int)tableTest[i].expectedNbElement > (int)history->nbBars )
+      {
+         printf( "%s Failed Bad Parameter for Test #%d (%d,%d)\n", __FILE__,
+                 i, tableTest[i].expectedNbElement, history->nbBars );
+         return TA_TESTUTIL_TFRR_BAD_PARAM;
+      }
+
+      retValue = do_test( history, &tableTest[i] );
+      if( retValue != 0 )
+      {
+         printf( "%s Failed Test #%d (Code=%d)\n", __FILE__,
+                 i, retValue );
+         return retValue;
+      }
+   }
+
+   retValue = do_test_reference( history );
+   if( retValue != 0 )
+      return retValue;
+
+   /* All test succeed. */
+   return TA_TEST_PASS; 
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode callFunc( const TA_Test *test,
+                            TA_Integer startIdx,
+                            TA_Integer endIdx,
+                            const TA_Real *inReal,
+                            TA_Integer *outBegIdx,
+                            TA_Integer *outNbElement,
+                            TA_Real *outReal,
+                            TA_Integer *lookback )
+{
+   TA_RetCode retCode;
+
+   switch( test->theFunction )
+   {
+   case TA_MEDIAN_TEST:
+      retCode = TA_MEDIAN( startIdx, endIdx, inReal,
+                           test->optInTimePeriod,
+                           outBegIdx, outNbElement, outReal );
+      *lookback = TA_MEDIAN_Lookback( test->optInTimePeriod );
+      break;
+   case TA_QUANTILE_TEST:
+      retCode = TA_QUANTILE( startIdx, endIdx, inReal,
+                             test->optInTimePeriod,
+                             test->optInQuantile,
+                             outBegIdx, outNbElement, outReal );
+      *lookback = TA_QUANTILE_Lookback( test->optInTimePeriod,
+                                        test->optInQuantile );
+      break;
+   case TA_MAD_TEST:
+      retCode = TA_MAD( startIdx, endIdx, inReal,
+                        test->optInTimePeriod,
+                        outBegIdx, outNbElement, outReal );
+      *lookback = TA_MAD_Lookback( test->optInTimePeriod );
+      break;
+   default:
+      retCode = TA_INTERNAL_ERROR(133);
+   }
+
+   return retCode;
+}
+
+static TA_RetCode rangeTestFunction( TA_Integer    startIdx,
+                                     TA_Integer    endIdx,
+                                     TA_Real      *outputBuffer,
+                                     TA_Integer   *outputBufferInt,
+                                     TA_Integer   *outBegIdx,
+                                     TA_Integer   *outNbElement,
+                                     TA_Integer   *lookback,
+                                     void         *opaqueData,
+                                     unsigned int  outputNb,
+                                     unsigned int *isOutputInteger )
+{
+   TA_RangeTestParam *testParam;
+
+   (void)outputNb;
+   (void)outputBufferInt;
+
+   *isOutputInteger = 0;
+  
+   testParam = (TA_RangeTestParam *)opaqueData;   
+
+   return callFunc( testParam->test, startIdx, endIdx, testParam->close,
+                    outBegIdx, outNbElement, outputBuffer, lookback );
+}
+
+static ErrorNumber do_test( const TA_History *history,
+                            const TA_Test *test )
+{
+   TA_RetCode retCode;
+   ErrorNumber errNb;
+   TA_Integer outBegIdx;
+   TA_Integer outNbElement;
+   TA_Integer lookback;
+   TA_RangeTestParam testParam;
+
+   /* Set to NAN all the elements of the gBuffers.  */
+   clearAllBuffers();
+
+   /* Build the input. */
+   setInputBuffer( 0, history->close, history->nbBars );
+   setInputBuffer( 1, history->close, history->nbBars );
+   
+   /* Make a simple first call. */
+   retCode = callFunc( test, test->startIdx, test->endIdx, gBuffer[0].in,
+                       &outBegIdx, &outNbElement, gBuffer[0].out0, &lookback );
+
+   errNb = checkDataSame( gBuffer[0].in, history->close,history->nbBars );
+   if( errNb != TA_TEST_PASS )
+      return errNb;
+
+   CHECK_EXPECTED_VALUE( gBuffer[0].out0, 0 );
+
+   outBegIdx = outNbElement = 0;
+
+   /* Make another call where the input and the output are the
+    * same buffer.
+    */
+   retCode = callFunc( test, test->startIdx, test->endIdx, gBuffer[1].in,
+                       &outBegIdx, &outNbElement, gBuffer[1].in, &lookback );
+
+   /* The previous call should have the same output as this call.
+    *
+    * checkSameContent verify that all value different than NAN in
+    * the first parameter is identical in the second parameter.
+    */
+   errNb = checkSameContent( gBuffer[0].out0, gBuffer[1].in );
+   if( errNb != TA_TEST_PASS )
+      return errNb;
+
+   CHECK_EXPECTED_VALUE( gBuffer[1].in, 0 );
+
+   if( errNb != TA_TEST_PASS )
+      return errNb;
+
+   /* Do a systematic test of most of the
+    * possible startIdx/endIdx range.
+    */
+   testParam.test  = test;
+   testParam.close = history->close;
+
+   if( test->doRangeTestFlag )
+   {
+      errNb = doRangeTest(
+                           rangeTestFunction, 
+                           TA_FUNC_UNST_NONE,
+                           (void *)&testParam, 1, 0 );
+      if( errNb != TA_TEST_PASS )
+         return errNb;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Compare with the window sorted at each bar, for many periods and
+ * quantiles (the interpolation is the same, so the output too). The
+ * input has many identical values to test the ties.
+ */
+static ErrorNumber do_test_reference( const TA_History *history )
+{
+   static const TA_Real quantile[] = { 0.0, 0.1, 0.25, 0.5, 0.75, 0.95, 1.0 };
+   TA_Test test;
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement, lookback;
+   TA_Real window[64], center, expected;
+   TA_Real *input;
+   int nbBar, period, i, j, k, nbQuantile;
+
+   nbBar = history->nbBars;
+   input = gBuffer[0].in;
+   for( i=0; i < nbBar; i++ )
+      input[i] = floor( history->close[i] );
+
+   nbQuantile = (int)(sizeof(quantile)/sizeof(quantile[0]));
+   memset( &test, 0, sizeof(test) );
+   for( period=2; period <= 64; period++ )
+   {
+      test.optInTimePeriod = period;
+      for( k=0; k < nbQuantile+2; k++ )
+      {
+         if( k < nbQuantile )
+         {
+            test.theFunction   = TA_QUANTILE_TEST;
+            test.optInQuantile = quantile[k];
+         }
+         else
+         {
+            test.theFunction   = (k == nbQuantile)? TA_MEDIAN_TEST : TA_MAD_TEST;
+            test.optInQuantile = 0.5;
+         }
+
+         retCode = callFunc( &test, 0, nbBar-1, input, &outBegIdx,
+                             &outNbElement, gBuffer[0].out0, &lookback );
+         if( (retCode != TA_SUCCESS) || (outBegIdx != period-1) ||
+             (outNbElement != nbBar-period+1) || (lookback != period-1) )
+         {
+            printf( "Fail: quantile test %d period %d [%d]\n", k, period, retCode );
+            return TA_TESTUTIL_TFRR_BAD_RETCODE;
+         }
+
+         for( i=0; i < outNbElement; i++ )
+         {
+            memcpy( window, &input[i], period*sizeof(TA_Real) );
+            qsort( window, period, sizeof(TA_Real), compareReal );
+            expected = sortedQuantile( window, period, test.optInQuantile );
+            if( test.theFunction == TA_MAD_TEST )
+            {
+               center = expected;
+               for( j=0; j < period; j++ )
+                  window[j] = fabs( input[i+j]-center );
+               qsort( window, period, sizeof(TA_Real), compareReal );
+               expected = sortedQuantile( window, period, 0.5 );
+            }
+
+            if( gBuffer[0].out0[i] != expected )
+            {
+               printf( "Fail: quantile test %d period %d at %d (%g != %g)\n",
+                       k, period, i, gBuffer[0].out0[i], expected );
+               return TA_TESTUTIL_TFRR_BAD_CALCULATION;
+            }
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static TA_Real sortedQuantile( const TA_Real *sorted, int nbElement, TA_Real quantile )
+{
+   TA_Real fraction;
+   int lowRank;
+
+   fraction = quantile*(nbElement-1);
+   lowRank  = (int)fraction;
+   fraction -= lowRank;
+   if( (lowRank >= nbElement-1) || (fraction <= 0.0) )
+      return sorted[lowRank < nbElement? lowRank : nbElement-1];
+
+   return sorted[lowRank]+fraction*(sorted[lowRank+1]-sorted[lowRank]);
+}
+
+static int compareReal( const void *a, const void *b )
+{
+   TA_Real valueA = *(const TA_Real *)a;
+   TA_Real valueB = *(const TA_Real *)b;
+
+   if( valueA < valueB )
+      return -1;
+   return (valueA > valueB)? 1 : 0;
+}
@@ -25,6 +25,37 @@ typedef struct
 ErrorNumber test_internals( void );
 ErrorNumber test_abstract( void );
 
+/* Compare the alternate paths of all the functions with a TA_CallFunc
+ * on synthetic series of 'nbBar' bars. With 'doReport', the largest
+ * error of each function for each path is printed.
+ */
+ErrorNumber test_differential( int nbBar, int doReport );
+
+/* Hardware counters (see perf_counters.c) accumulated
+ * with perfCountersStart/perfCountersStop.
+ */
+typedef enum
+{
+   PERF_CYCLES,
+   PERF_INSTRUCTIONS,
+   PERF_L1D_MISSES,
+   PERF_LLC_MISSES,
+   PERF_BRANCH_MISSES,
+   PERF_NB_COUNTER
+} PerfCounterId;
+
+typedef struct
+{
+   double value[PERF_NB_COUNTER];
+   int    valid[PERF_NB_COUNTER]; /* Zero when not available. */
+} PerfCounters;
+
+/* Return zero if the counters are not available. */
+int  perfCountersOpen ( void );
+void perfCountersClose( void );
+void perfCountersStart( void );
+void perfCountersStop ( PerfCounters *counters );
+
 ErrorNumber freeLib( void );
 ErrorNumber allocLib( void );
 
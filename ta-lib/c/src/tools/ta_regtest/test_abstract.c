@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  AC       Angelo Ciceri
+ *  AG       agent <agent@local>
  *
  *
  * Change history:
@@ -48,6 +49,8 @@
  *  062504 MF   Add test_default_calls.
  *  110206 AC   Change volume and open interest to double
  *  082607 MF   Add profiling feature.
+ *  101826 AG   Add test_compact_calls.
+ *  101826 AG   Verify the statistics from many threads.
  */
 
 /* Description:
@@ -69,6 +72,14 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <math.h>
+
+#if defined( WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+#endif
+
 #include "ta_test_priv.h"
 
 /**** External functions declarations. ****/
@@ -76,6 +87,7 @@
 
 /**** External variables declarations. ****/
 extern int doExtensiveProfiling;
+extern int doCounterProfiling;
 
 extern double gDataOpen[];
 extern double gDataHigh[];
@@ -102,6 +114,21 @@ typedef enum
 	PROFILING_100
 } ProfilingType;
 
+/* Threads calling MACD with the statistics enabled. */
+#define NB_STATS_THREAD 4
+#define NB_STATS_CALL   500
+typedef struct
+{
+   double outMACD[2000], outSignal[2000], outHist[2000];
+   volatile ErrorNumber retValue;
+} StatsCaller;
+
+#if defined( WIN32 )
+   #define THREAD_FUNC  DWORD WINAPI
+#else
+   #define THREAD_FUNC  void *
+#endif
+
 /**** Local functions declarations.    ****/
 static ErrorNumber testLookback(TA_ParamHolder *paramHolder );
 static ErrorNumber test_default_calls(void);
@@ -109,6 +136,37 @@ static ErrorNumber callWithDefaults( const char *funcName,
 									 const double *input,
 									 const int *input_int, int size );
 static ErrorNumber callAndProfile( const char *funcName, ProfilingType type );
+static void printCounters( const char *funcName, int inputSize,
+                           const PerfCounters *counters, double nbBar );
+static ErrorNumber test_inplace_calls(void);
+static ErrorNumber callInPlace( const TA_FuncInfo *funcInfo, int startIdx, int endIdx );
+static ErrorNumber test_indices_calls(void);
+static ErrorNumber callAtIndices( const TA_FuncInfo *funcInfo );
+static ErrorNumber test_series_index(void);
+static ErrorNumber callWithSeriesIndex( const TA_SeriesIndex *seriesIndex,
+                                        const char *funcName,
+                                        int period );
+static ErrorNumber test_segments_calls(void);
+static ErrorNumber callSegments( const TA_FuncInfo *funcInfo );
+static ErrorNumber test_aligned_calls(void);
+static ErrorNumber callAligned( const TA_FuncInfo *funcInfo, int startIdx, int perParamHolder );
+static ErrorNumber checkAligned( const TA_FuncInfo *funcInfo,
+                                 int startIdx, int endIdx,
+                                 int outBegIdx, int outNbElement,
+                                 const double *refOut, const int *refOut_int,
+                                 int refStride );
+static ErrorNumber test_stats(void);
+static ErrorNumber test_stats_threads(void);
+static THREAD_FUNC statsCaller( void *arg );
+static ErrorNumber test_checkpoints(void);
+static ErrorNumber callCheckpoint( const char *funcName, int period,
+                                   TA_Integer checkpointIdx );
+static ErrorNumber test_result_cache(void);
+static ErrorNumber callWithCache( const TA_FuncInfo *funcInfo );
+static ErrorNumber test_timeframes(void);
+static ErrorNumber callTimeframes( const TA_FuncInfo *funcInfo );
+static ErrorNumber test_compact_calls(void);
+static ErrorNumber callCompact( const TA_FuncInfo *funcInfo, int startIdx, int aligned );
 
 /**** Local variables definitions.     ****/
 static double inputNegData[100];
@@ -126,6 +184,29 @@ static int    inputRandomData_int[2000];
 static double output[10][2000];
 static int    output_int[10][2000];
 
+static double refOutput[10][2000];
+static int    refOutput_int[10][2000];
+static double inPlaceBuffer[2000];
+static double inputPeriods[2000];
+
+static int    testIndices[2000];
+
+static TA_ResultCache *resultCache;
+
+#define NB_TEST_TIMEFRAME 3
+static const TA_Integer testFactors[NB_TEST_TIMEFRAME] = { 1, 7, 30 };
+static TA_Timeframes *baseTimeframes;
+static double tfOutput[10][NB_TEST_TIMEFRAME*2000];
+static int    tfOutput_int[10][NB_TEST_TIMEFRAME*2000];
+static double tfPrice[4][2000];
+
+/* Threads calling MACD with the statistics enabled. */
+static StatsCaller statsCallers[NB_STATS_THREAD];
+
+#define COMPACT_SENTINEL ((signed char)99)
+static signed char   int8Output[10][2000];
+static unsigned char bitOutput[10][2000/8];
+
 /**** Global functions definitions.   ****/
 ErrorNumber test_abstract( void )
 {
@@ -188,6 +269,86 @@ ErrorNumber test_abstract( void )
       return retValue;
    }
 
+   /* Verify that all functions can calculate in-place. */
+   retValue = test_inplace_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract in-place call failed\n" );
+      return retValue;
+   }
+
+   /* Verify the calculation at specific indices. */
+   retValue = test_indices_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract call at indices failed\n" );
+      return retValue;
+   }
+
+   /* Verify the functions calculated from a TA_SeriesIndex. */
+   retValue = test_series_index();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract series index failed\n" );
+      return retValue;
+   }
+
+   /* Verify the calculation of many series in one call. */
+   retValue = test_segments_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract call on segments failed\n" );
+      return retValue;
+   }
+
+   /* Verify the output aligned with the input. */
+   retValue = test_aligned_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract aligned call failed\n" );
+      return retValue;
+   }
+
+   /* Verify the per-function statistics. */
+   retValue = test_stats();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract statistics failed\n" );
+      return retValue;
+   }
+
+   /* Verify the warm-start checkpoints. */
+   retValue = test_checkpoints();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract checkpoints failed\n" );
+      return retValue;
+   }
+
+   /* Verify the result cache. */
+   retValue = test_result_cache();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract result cache failed\n" );
+      return retValue;
+   }
+
+   /* Verify the multiple timeframes. */
+   retValue = test_timeframes();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract timeframes failed\n" );
+      return retValue;
+   }
+
+   /* Verify the int8 and bit outputs. */
+   retValue = test_compact_calls();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "TA-Abstract compact output failed\n" );
+      return retValue;
+   }
+
    retValue = freeLib();
    if( retValue != TA_TEST_PASS )
       return retValue;
@@ -222,6 +383,9 @@ static ErrorNumber testLookback( TA_ParamHolder *paramHolder )
 {
   TA_RetCode retCode;
   int lookback;
+  const TA_FuncHandle *handle;
+  TA_ParamHolder *smaHolder;
+  const TA_ParamHolder *holders[2];
 
   /* Change the parameters of STOCH and verify that TA_GetLookback respond correctly. */
   retCode = TA_SetOptInputParamInteger( paramHolder, 0, 3 );
@@ -292,7 +456,27 @@ static ErrorNumber testLookback( TA_ParamHolder *paramHolder )
      printf( "TA_GetLookback failed [%d != 7]\n", lookback );
      return TA_ABS_TST_FAIL_GETLOOKBACK_2;
   }
-  
+
+  /* The largest lookback of STOCH and of a SMA(30). */
+  retCode = TA_GetFuncHandle( "SMA", &handle );
+  if( retCode == TA_SUCCESS )
+     retCode = TA_ParamHolderAlloc( handle, &smaHolder );
+  if( retCode != TA_SUCCESS )
+  {
+     printf( "Can't alloc SMA param holder [%d]\n", retCode );
+     return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+  }
+  TA_SetOptInputParamInteger( smaHolder, 0, 30 );
+  holders[0] = paramHolder;
+  holders[1] = smaHolder;
+  retCode = TA_GetMaxLookback( holders, 2, &lookback );
+  TA_ParamHolderFree( smaHolder );
+  if( (retCode != TA_SUCCESS) || (lookback != 29) )
+  {
+     printf( "TA_GetMaxLookback failed [%d,%d != 29]\n", retCode, lookback );
+     return TA_ABS_TST_FAIL_GETMAXLOOKBACK;
+  }
+
   return TA_TEST_PASS;
 }
 
@@ -366,7 +550,8 @@ static void testDefault( const TA_FuncInfo *funcInfo, void *opaqueData )
    if( doExtensiveProfiling /*&& (nbFunctionDone<5)*/ )
    {
 	   nbFunctionDone++;
-	   printf( "%s ", funcInfo->name );
+	   if( !doCounterProfiling )
+	      printf( "%s ", funcInfo->name );
        CALL( PROFILING_100 );
        CALL( PROFILING_500 );
 	   CALL( PROFILING_1000 );
@@ -374,7 +559,8 @@ static void testDefault( const TA_FuncInfo *funcInfo, void *opaqueData )
        CALL( PROFILING_5000 );
        CALL( PROFILING_8000 );
 	   CALL( PROFILING_10000 );
-	   printf( "\n" );
+	   if( !doCounterProfiling )
+	      printf( "\n" );
    }
 }
 
@@ -571,6 +757,10 @@ static ErrorNumber test_default_calls(void)
    if( doExtensiveProfiling )
    {
 		   printf( "\n[PROFILING START]\n" );
+		   if( doCounterProfiling )
+		      printf( "%-20s %6s %10s %10s %6s %10s %10s %10s\n",
+		              "Function", "Size", "Cycles", "Instr.", "IPC",
+		              "L1D miss", "LLC miss", "Br. miss" );
    }
 
    TA_ForEachFunc( testDefault, &errNumber );
@@ -614,6 +804,12 @@ static ErrorNumber callAndProfile( const char *funcName, ProfilingType type )
    double timeInProfiledCallLocal;
    double worstProfiledCallLocal;
 
+   /* Hardware counters of the calls (when doCounterProfiling). */
+   PerfCounters counters;
+   double nbBar;
+
+   memset( &counters, 0, sizeof(counters) );
+   nbBar = 0.0;
    nbProfiledCallLocal = 0;
    timeInProfiledCallLocal = 0.0;
    worstProfiledCallLocal = 0.0;
@@ -734,8 +930,19 @@ static ErrorNumber callAndProfile( const char *funcName, ProfilingType type )
               startClock = clock();
            #endif
 
-		   /* Do the function call. */
-		   retCode = TA_CallFunc(paramHolder,0,inputSize-1,&outBegIdx,&outNbElement);
+		   /* Do the function call. The counters are only for the
+		    * second pass, once the caches are warm.
+		    */
+		   if( doCounterProfiling && (h == 1) )
+		   {
+		      perfCountersStart();
+		      retCode = TA_CallFunc(paramHolder,0,inputSize-1,&outBegIdx,&outNbElement);
+		      perfCountersStop( &counters );
+		      nbBar += (double)outNbElement;
+		   }
+		   else
+		      retCode = TA_CallFunc(paramHolder,0,inputSize-1,&outBegIdx,&outNbElement);
+
 		   if( retCode != TA_SUCCESS )
 		   {
 		      printf( "TA_CallFunc() failed zero data test [%d]\n", retCode );
@@ -775,7 +982,2029 @@ static ErrorNumber callAndProfile( const char *funcName, ProfilingType type )
    }
 
    /* Output statistic (remove worst call, average the others. */
-   printf( "%g ", (timeInProfiledCallLocal-worstProfiledCallLocal)/(double)(nbProfiledCallLocal-1));
+   if( doCounterProfiling )
+      printCounters( funcName, inputSize, &counters, nbBar );
+   else
+      printf( "%g ", (timeInProfiledCallLocal-worstProfiledCallLocal)/(double)(nbProfiledCallLocal-1));
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* One line per function and input size, all the counters are
+ * per output bar. "n/a" when the CPU (or the kernel) does not
+ * provide that counter.
+ */
+static void printCounters( const char *funcName, int inputSize,
+                           const PerfCounters *counters, double nbBar )
+{
+   int i;
+
+   printf( "%-20s %6d", funcName, inputSize );
+   for( i=0; i < PERF_NB_COUNTER; i++ )
+   {
+      if( !counters->valid[i] || (nbBar <= 0.0) )
+         printf( " %10s", "n/a" );
+      else
+         printf( " %10.3f", counters->value[i]/nbBar );
+
+      /* The IPC follows the instructions. */
+      if( i == PERF_INSTRUCTIONS )
+      {
+         if( counters->valid[PERF_CYCLES] && counters->valid[PERF_INSTRUCTIONS] &&
+             (counters->value[PERF_CYCLES] > 0.0) )
+            printf( " %6.2f", counters->value[PERF_INSTRUCTIONS]/counters->value[PERF_CYCLES] );
+         else
+            printf( " %6s", "n/a" );
+      }
+   }
+   printf( "\n" );
+}
+
+/* Setup all the input/output of a call for the in-place tests.
+ *
+ * The inputs are enumerated as a flat list of "source" arrays
+ * (each component of a price input counts as one source).
+ *
+ * When 'sourceIdx' is not negative, that source is replaced by a
+ * copy in inPlaceBuffer, and the output 'outputIdx' is also set to
+ * inPlaceBuffer.
+ *
+ * Return the number of sources for this function.
+ */
+static int setInPlaceParams( TA_ParamHolder *paramHolder,
+                             const TA_FuncInfo *funcInfo,
+                             int sourceIdx, int outputIdx )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const double *price[5];
+   const double *real;
+   unsigned int i;
+   int j, nbSource;
+
+   nbSource = 0;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch(inputInfo->type)
+      {
+      case TA_Input_Price:
+         price[0] = inputInfo->flags&TA_IN_PRICE_OPEN?gDataOpen:NULL;
+         price[1] = inputInfo->flags&TA_IN_PRICE_HIGH?gDataHigh:NULL;
+         price[2] = inputInfo->flags&TA_IN_PRICE_LOW?gDataLow:NULL;
+         price[3] = inputInfo->flags&TA_IN_PRICE_CLOSE?gDataClose:NULL;
+         price[4] = inputInfo->flags&TA_IN_PRICE_VOLUME?gDataClose:NULL;
+         for( j=0; j < 5; j++ )
+         {
+            if( !price[j] )
+               continue;
+            if( nbSource == sourceIdx )
+            {
+               memcpy( inPlaceBuffer, price[j], sizeof(inPlaceBuffer) );
+               price[j] = inPlaceBuffer;
+            }
+            nbSource++;
+         }
+         TA_SetInputParamPricePtr( paramHolder, i, price[0], price[1],
+                                   price[2], price[3], price[4], NULL );
+         break;
+      case TA_Input_Real:
+         real = (i==0)?gDataClose:gDataOpen;
+         if( strcmp( inputInfo->paramName, "inPeriods" ) == 0 )
+         {
+            /* The prices would all be clipped to optInMaxPeriod. */
+            for( j=0; j < 2000; j++ )
+               inputPeriods[j] = (double)(2+(j*7)%29);
+            real = inputPeriods;
+         }
+         if( nbSource == sourceIdx )
+         {
+            memcpy( inPlaceBuffer, real, sizeof(inPlaceBuffer) );
+            real = inPlaceBuffer;
+         }
+         nbSource++;
+         TA_SetInputParamRealPtr( paramHolder, i, real );
+         break;
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( paramHolder, i, inputRandomData_int );
+         break;
+      }
+   }
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      switch(outputInfo->type)
+      {
+      case TA_Output_Real:
+         for( j=0; j < 2000; j++ )
+            output[i][j] = TA_REAL_MIN;
+         if( (sourceIdx >= 0) && ((int)i == outputIdx) )
+            TA_SetOutputParamRealPtr(paramHolder,i,inPlaceBuffer);
+         else
+            TA_SetOutputParamRealPtr(paramHolder,i,&output[i][0]);
+         break;
+      case TA_Output_Integer:
+         for( j=0; j < 2000; j++ )
+            output_int[i][j] = TA_INTEGER_MIN;
+         TA_SetOutputParamIntegerPtr(paramHolder,i,&output_int[i][0]);
+         break;
+      }
+   }
+
+   return nbSource;
+}
+
+static int isSameReal( double a, double b )
+{
+   /* NAN are considered equal (some Math Transform
+    * functions are not defined for all the inputs).
+    */
+   return (a == b) || ((a != a) && (b != b));
+}
+
+static void testInPlace( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   if( !(funcInfo->flags & TA_FUNC_FLG_INPLACE) )
+   {
+      printf( "Missing TA_FUNC_FLG_INPLACE for [%s]\n", funcInfo->name );
+      *errorNumber = TA_ABS_TST_FAIL_INPLACE_FLAG;
+      return;
+   }
+
+   /* Test from the start of the input, and from a startIdx
+    * where the output does not begin at the input start.
+    */
+   *errorNumber = callInPlace( funcInfo, 0, 1999 );
+   if( *errorNumber == TA_TEST_PASS )
+      *errorNumber = callInPlace( funcInfo, 1000, 1999 );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed in-place test for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_inplace_calls(void)
+{
+   ErrorNumber errNumber;
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testInPlace, &errNumber );
+
+   return errNumber;
+}
+
+static ErrorNumber callInPlace( const TA_FuncInfo *funcInfo, int startIdx, int endIdx )
+{
+   TA_ParamHolder *paramHolder;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   unsigned int i, j;
+   int k, m, nbSource;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+   const double *result;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   /* Reference call, all outputs are in their own buffer. */
+   nbSource = setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   retCode = TA_CallFunc( paramHolder, startIdx, endIdx, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_INPLACE_CALLFUNC;
+   }
+   memcpy( refOutput, output, sizeof(output) );
+   memcpy( refOutput_int, output_int, sizeof(output_int) );
+
+   /* Re-do the call with each real output being the
+    * same buffer as each of the input.
+    */
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type != TA_Output_Real )
+         continue;
+
+      for( k=0; k < nbSource; k++ )
+      {
+         setInPlaceParams( paramHolder, funcInfo, k, (int)i );
+         retCode = TA_CallFunc( paramHolder, startIdx, endIdx, &outBegIdx, &outNbElement );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_CallFunc() failed in-place call [%d]\n", retCode );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_INPLACE_CALLFUNC;
+         }
+
+         if( outBegIdx != refBegIdx )
+         {
+            printf( "outBegIdx %d != %d (output #%d, input #%d)\n", outBegIdx, refBegIdx, i, k );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_INPLACE_BEGIDX;
+         }
+
+         if( outNbElement != refNbElement )
+         {
+            printf( "outNbElement %d != %d (output #%d, input #%d)\n", outNbElement, refNbElement, i, k );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_INPLACE_NBELEMENT;
+         }
+
+         for( j=0; j < funcInfo->nbOutput; j++ )
+         {
+            TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+            if( outputInfo->type == TA_Output_Integer )
+            {
+               if( memcmp( output_int[j], refOutput_int[j], outNbElement*sizeof(int) ) != 0 )
+               {
+                  printf( "Integer output #%d differs (output #%d, input #%d)\n", j, i, k );
+                  TA_ParamHolderFree( paramHolder );
+                  return TA_ABS_TST_FAIL_INPLACE_DIFF;
+               }
+               continue;
+            }
+
+            result = (j==i)?inPlaceBuffer:output[j];
+            for( m=0; m < outNbElement; m++ )
+            {
+               if( !isSameReal( result[m], refOutput[j][m] ) )
+               {
+                  printf( "Output #%d differs at [%d] %e != %e (output #%d, input #%d)\n",
+                          j, m, result[m], refOutput[j][m], i, k );
+                  TA_ParamHolderFree( paramHolder );
+                  return TA_ABS_TST_FAIL_INPLACE_DIFF;
+               }
+            }
+         }
+      }
+   }
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void testAtIndices( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   *errorNumber = callAtIndices( funcInfo );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed call at indices for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_indices_calls(void)
+{
+   ErrorNumber errNumber;
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testAtIndices, &errNumber );
+
+   return errNumber;
+}
+
+static ErrorNumber callAtIndices( const TA_FuncInfo *funcInfo )
+{
+   TA_ParamHolder *paramHolder;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   unsigned int j;
+   int i, k, nbIndices, lookback;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+   double ref, tolerance;
+
+   /* Mix of indices far apart, a contiguous block and
+    * indices closer than most lookback.
+    */
+   nbIndices = 0;
+   for( i=0; i < 1000; i += 37 )
+      testIndices[nbIndices++] = i;
+   for( i=1000; i < 1100; i++ )
+      testIndices[nbIndices++] = i;
+   for( i=1103; i < 2000; i += 3 )
+      testIndices[nbIndices++] = i;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   /* Reference call on the whole input. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   retCode = TA_CallFunc( paramHolder, 0, 1999, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_INDICES_CALLFUNC;
+   }
+   memcpy( refOutput, output, sizeof(output) );
+   memcpy( refOutput_int, output_int, sizeof(output_int) );
+
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   retCode = TA_CallFuncAtIndices( paramHolder, testIndices, nbIndices, &outBegIdx, &outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncAtIndices() failed [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_INDICES_CALLFUNC;
+   }
+
+   TA_GetLookback( paramHolder, &lookback );
+   for( k=0; (k < nbIndices) && (testIndices[k] < lookback); k++ );
+   if( outBegIdx != k )
+   {
+      printf( "outBegIdx %d != %d\n", outBegIdx, k );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_INDICES_BEGIDX;
+   }
+
+   if( outNbElement != nbIndices-k )
+   {
+      printf( "outNbElement %d != %d\n", outNbElement, nbIndices-k );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_INDICES_NBELEMENT;
+   }
+
+   /* The values must be the same as for the whole input, except
+    * for the rounding of running sums when the calculation does
+    * not start at the same index.
+    */
+   for( j=0; j < funcInfo->nbOutput; j++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+      for( k=0; k < outNbElement; k++ )
+      {
+         i = testIndices[outBegIdx+k]-refBegIdx;
+         if( outputInfo->type == TA_Output_Integer )
+         {
+            if( output_int[j][k] != refOutput_int[j][i] )
+            {
+               printf( "Integer output #%d differs at index %d: %d != %d\n",
+                       j, testIndices[outBegIdx+k], output_int[j][k], refOutput_int[j][i] );
+               TA_ParamHolderFree( paramHolder );
+               return TA_ABS_TST_FAIL_INDICES_DIFF;
+            }
+            continue;
+         }
+
+         ref = refOutput[j][i];
+         tolerance = 1e-8 * (fabs(ref) > 1.0? fabs(ref) : 1.0);
+         if( !isSameReal( output[j][k], ref ) && !(fabs(output[j][k]-ref) <= tolerance) )
+         {
+            printf( "Output #%d differs at index %d: %e != %e\n",
+                    j, testIndices[outBegIdx+k], output[j][k], ref );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_INDICES_DIFF;
+         }
+      }
+   }
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber test_series_index(void)
+{
+   static const char *funcNames[] = { "SUM", "SMA", "VAR", "STDDEV",
+                                      "MAX", "MIN", "MIDPOINT" };
+   static const int periods[] = { 1, 2, 3, 7, 30, 64, 1000, 3000 };
+
+   TA_SeriesIndex *seriesIndex;
+   TA_RetCode retCode;
+   ErrorNumber errNumber;
+   unsigned int i, j;
+
+   retCode = TA_SeriesIndexAlloc( gDataClose, 2000, &seriesIndex );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_SeriesIndexAlloc failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_SERIES_INDEX_ALLOC;
+   }
+
+   errNumber = TA_TEST_PASS;
+   for( i=0; (i < sizeof(funcNames)/sizeof(char *)) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      for( j=0; (j < sizeof(periods)/sizeof(int)) && (errNumber == TA_TEST_PASS); j++ )
+      {
+         errNumber = callWithSeriesIndex( seriesIndex, funcNames[i], periods[j] );
+         if( errNumber != TA_TEST_PASS )
+            printf( "Failed series index test for [%s] period %d\n", funcNames[i], periods[j] );
+      }
+   }
+
+   retCode = TA_SeriesIndexFree( seriesIndex );
+   if( (retCode != TA_SUCCESS) && (errNumber == TA_TEST_PASS) )
+   {
+      printf( "TA_SeriesIndexFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_SERIES_INDEX_ALLOC;
+   }
+
+   return errNumber;
+}
+
+static int isSameSeriesIndexValue( const char *funcName, double value, double ref )
+{
+   double tolerance;
+
+   /* The STDDEV is the square root of a variance having an error
+    * around 1e-12 (cancellation when the values are almost equal),
+    * so it is the variances that are compared.
+    */
+   if( strcmp( funcName, "STDDEV" ) == 0 )
+   {
+      value *= value;
+      ref *= ref;
+   }
+
+   tolerance = 1e-8 * (fabs(ref) > 1.0? fabs(ref) : 1.0);
+   return fabs(value-ref) <= tolerance;
+}
+
+static ErrorNumber callWithSeriesIndex( const TA_SeriesIndex *seriesIndex,
+                                        const char *funcName,
+                                        int period )
+{
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *paramHolder;
+   TA_RetCode retCode, refRetCode;
+   int i, k, startIdx, nbIndices;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+
+   retCode = TA_GetFuncHandle( funcName, &handle );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_ParamHolderAlloc( handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   TA_SetOptInputParamInteger( paramHolder, 0, period );
+   if( strcmp( funcName, "STDDEV" ) == 0 )
+      TA_SetOptInputParamReal( paramHolder, 1, 1.5 );
+   TA_SetOutputParamRealPtr( paramHolder, 0, &output[0][0] );
+
+   for( startIdx=0; startIdx < 2000; startIdx += 997 )
+   {
+      /* Reference call directly on the data. */
+      TA_SetInputParamRealPtr( paramHolder, 0, gDataClose );
+      refRetCode = TA_CallFunc( paramHolder, startIdx, 1999, &refBegIdx, &refNbElement );
+      memcpy( refOutput[0], output[0], sizeof(output[0]) );
+
+      /* Same call using the index. Invalid periods must fail the same way. */
+      TA_SetInputParamSeriesIndex( paramHolder, 0, seriesIndex );
+      retCode = TA_CallFunc( paramHolder, startIdx, 1999, &outBegIdx, &outNbElement );
+      if( retCode != refRetCode )
+      {
+         printf( "TA_CallFunc() with index returned %d instead of %d\n", retCode, refRetCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SERIES_INDEX_CALLFUNC;
+      }
+      if( retCode != TA_SUCCESS )
+         break;
+
+      if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+      {
+         printf( "Range [%d,%d] != [%d,%d]\n", outBegIdx, outNbElement, refBegIdx, refNbElement );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SERIES_INDEX_CALLFUNC;
+      }
+
+      for( i=0; i < outNbElement; i++ )
+      {
+         if( !isSameSeriesIndexValue( funcName, output[0][i], refOutput[0][i] ) )
+         {
+            printf( "Output differs at index %d: %e != %e\n", outBegIdx+i, output[0][i], refOutput[0][i] );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_SERIES_INDEX_DIFF;
+         }
+      }
+   }
+
+   /* Calculation at some indices using the index. */
+   if( refRetCode == TA_SUCCESS )
+   {
+      nbIndices = 0;
+      for( i=0; i < 2000; i += 13 )
+         testIndices[nbIndices++] = i;
+
+      retCode = TA_CallFuncAtIndices( paramHolder, testIndices, nbIndices, &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFuncAtIndices() with index failed [%d]\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SERIES_INDEX_CALLFUNC;
+      }
+
+      /* refOutput is from the last reference call. */
+      for( k=0; k < outNbElement; k++ )
+      {
+         i = testIndices[outBegIdx+k];
+         if( (i < refBegIdx) || (i >= refBegIdx+refNbElement) )
+            continue;
+         if( !isSameSeriesIndexValue( funcName, output[0][k], refOutput[0][i-refBegIdx] ) )
+         {
+            printf( "Output at indices differs at index %d: %e != %e\n", i, output[0][k], refOutput[0][i-refBegIdx] );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_SERIES_INDEX_DIFF;
+         }
+      }
+
+      /* The index knows the size of the data. */
+      retCode = TA_CallFunc( paramHolder, 0, 2000, &outBegIdx, &outNbElement );
+      if( retCode != TA_OUT_OF_RANGE_END_INDEX )
+      {
+         printf( "TA_CallFunc() with index beyond the data returned %d\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SERIES_INDEX_CALLFUNC;
+      }
+   }
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void testSegments( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   *errorNumber = callSegments( funcInfo );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed call on segments for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_segments_calls(void)
+{
+   ErrorNumber errNumber;
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testSegments, &errNumber );
+
+   return errNumber;
+}
+
+/* Set the inputs like setInPlaceParams, but starting at 'offset'. */
+static void setSegmentInputs( TA_ParamHolder *paramHolder,
+                              const TA_FuncInfo *funcInfo,
+                              int offset )
+{
+   const TA_InputParameterInfo *inputInfo;
+   unsigned int i;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch(inputInfo->type)
+      {
+      case TA_Input_Price:
+         TA_SetInputParamPricePtr( paramHolder, i,
+                                   inputInfo->flags&TA_IN_PRICE_OPEN?&gDataOpen[offset]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_HIGH?&gDataHigh[offset]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_LOW?&gDataLow[offset]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_CLOSE?&gDataClose[offset]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_VOLUME?&gDataClose[offset]:NULL,
+                                   NULL );
+         break;
+      case TA_Input_Real:
+         if( strcmp( inputInfo->paramName, "inPeriods" ) == 0 )
+            TA_SetInputParamRealPtr( paramHolder, i, &inputPeriods[offset] );
+         else
+            TA_SetInputParamRealPtr( paramHolder, i, (i==0)?&gDataClose[offset]:&gDataOpen[offset] );
+         break;
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( paramHolder, i, &inputRandomData_int[offset] );
+         break;
+      }
+   }
+}
+
+static ErrorNumber callSegments( const TA_FuncInfo *funcInfo )
+{
+   /* Segments of various length, including empty ones
+    * and some shorter than most lookback.
+    */
+   static const int segmentOffsets[] = { 0, 0, 5, 55, 455, 455, 700, 1000, 1350, 2000 };
+   #define NB_TEST_SEGMENT ((int)(sizeof(segmentOffsets)/sizeof(int))-1)
+
+   TA_ParamHolder *paramHolder;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   unsigned int j;
+   int i, k, offset;
+   int refBegIdx[NB_TEST_SEGMENT], refNbElement[NB_TEST_SEGMENT];
+   int outBegIdx[NB_TEST_SEGMENT], outNbElement[NB_TEST_SEGMENT];
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   /* Reference: one call per segment. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   for( i=0; i < NB_TEST_SEGMENT; i++ )
+   {
+      offset = segmentOffsets[i];
+      refBegIdx[i] = refNbElement[i] = 0;
+      if( segmentOffsets[i+1] == offset )
+         continue;
+      setSegmentInputs( paramHolder, funcInfo, offset );
+      retCode = TA_CallFunc( paramHolder, 0, segmentOffsets[i+1]-offset-1, &refBegIdx[i], &refNbElement[i] );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SEGMENTS_CALLFUNC;
+      }
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         memcpy( &refOutput[j][offset], output[j], refNbElement[i]*sizeof(double) );
+         memcpy( &refOutput_int[j][offset], output_int[j], refNbElement[i]*sizeof(int) );
+      }
+   }
+
+   /* All the segments in one call. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   retCode = TA_CallFuncSegments( paramHolder, segmentOffsets, NB_TEST_SEGMENT, outBegIdx, outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncSegments() failed [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_SEGMENTS_CALLFUNC;
+   }
+
+   for( i=0; i < NB_TEST_SEGMENT; i++ )
+   {
+      if( outBegIdx[i] != refBegIdx[i] )
+      {
+         printf( "outBegIdx %d != %d (segment #%d)\n", outBegIdx[i], refBegIdx[i], i );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SEGMENTS_BEGIDX;
+      }
+
+      if( outNbElement[i] != refNbElement[i] )
+      {
+         printf( "outNbElement %d != %d (segment #%d)\n", outNbElement[i], refNbElement[i], i );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SEGMENTS_NBELEMENT;
+      }
+
+      offset = segmentOffsets[i];
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+         for( k=offset; k < offset+outNbElement[i]; k++ )
+         {
+            if( ((outputInfo->type == TA_Output_Integer) && (output_int[j][k] != refOutput_int[j][k])) ||
+                ((outputInfo->type == TA_Output_Real) && !isSameReal( output[j][k], refOutput[j][k] )) )
+            {
+               printf( "Output #%d differs at [%d] (segment #%d)\n", j, k, i );
+               TA_ParamHolderFree( paramHolder );
+               return TA_ABS_TST_FAIL_SEGMENTS_DIFF;
+            }
+         }
+      }
+   }
+
+   /* Same with the output of each segment aligned with its input. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   TA_SetOutputAligned( paramHolder, 1 );
+   retCode = TA_CallFuncSegments( paramHolder, segmentOffsets, NB_TEST_SEGMENT, outBegIdx, outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncSegments() aligned failed [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_SEGMENTS_CALLFUNC;
+   }
+
+   for( i=0; i < NB_TEST_SEGMENT; i++ )
+   {
+      offset = segmentOffsets[i];
+      if( segmentOffsets[i+1] == offset )
+         continue;
+
+      if( (outBegIdx[i] != refBegIdx[i]) || (outNbElement[i] != refNbElement[i]) )
+      {
+         printf( "Aligned range [%d,%d] != [%d,%d] (segment #%d)\n",
+                 outBegIdx[i], outNbElement[i], refBegIdx[i], refNbElement[i], i );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_SEGMENTS_NBELEMENT;
+      }
+
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+         for( k=0; k < segmentOffsets[i+1]-offset; k++ )
+         {
+            if( (k < outBegIdx[i]) || (outNbElement[i] == 0) )
+            {
+               if( ((outputInfo->type == TA_Output_Integer) && (output_int[j][offset+k] != TA_INTEGER_DEFAULT)) ||
+                   ((outputInfo->type == TA_Output_Real) && (output[j][offset+k] == output[j][offset+k])) )
+               {
+                  printf( "Aligned output #%d not NaN at [%d] (segment #%d)\n", j, offset+k, i );
+                  TA_ParamHolderFree( paramHolder );
+                  return TA_ABS_TST_FAIL_SEGMENTS_DIFF;
+               }
+            }
+            else if( ((outputInfo->type == TA_Output_Integer) && (output_int[j][offset+k] != refOutput_int[j][offset+k-outBegIdx[i]])) ||
+                     ((outputInfo->type == TA_Output_Real) && !isSameReal( output[j][offset+k], refOutput[j][offset+k-outBegIdx[i]] )) )
+            {
+               printf( "Aligned output #%d differs at [%d] (segment #%d)\n", j, offset+k, i );
+               TA_ParamHolderFree( paramHolder );
+               return TA_ABS_TST_FAIL_SEGMENTS_DIFF;
+            }
+         }
+      }
+   }
+
+   #undef NB_TEST_SEGMENT
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void testAligned( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   /* With TA_CallFuncAligned and with the TA_ParamHolder setting. */
+   *errorNumber = callAligned( funcInfo, 0, 0 );
+   if( *errorNumber == TA_TEST_PASS )
+      *errorNumber = callAligned( funcInfo, 1000, 0 );
+   if( *errorNumber == TA_TEST_PASS )
+      *errorNumber = callAligned( funcInfo, 1000, 1 );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed aligned call for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_aligned_calls(void)
+{
+   ErrorNumber errNumber;
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testAligned, &errNumber );
+
+   return errNumber;
+}
+
+static ErrorNumber callAligned( const TA_FuncInfo *funcInfo, int startIdx, int perParamHolder )
+{
+   TA_ParamHolder *paramHolder;
+   TA_RetCode retCode;
+   ErrorNumber errNumber;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   /* Reference call, output packed from index zero. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   retCode = TA_CallFunc( paramHolder, startIdx, 1999, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_ALIGNED_CALLFUNC;
+   }
+   memcpy( refOutput, output, sizeof(output) );
+   memcpy( refOutput_int, output_int, sizeof(output_int) );
+
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   if( perParamHolder )
+   {
+      TA_SetOutputAligned( paramHolder, 1 );
+      retCode = TA_CallFunc( paramHolder, startIdx, 1999, &outBegIdx, &outNbElement );
+   }
+   else
+      retCode = TA_CallFuncAligned( paramHolder, startIdx, 1999, &outBegIdx, &outNbElement );
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Aligned call failed [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_ALIGNED_CALLFUNC;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+   {
+      printf( "Aligned range [%d,%d] != [%d,%d]\n", outBegIdx, outNbElement, refBegIdx, refNbElement );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_ALIGNED_RANGE;
+   }
+
+   errNumber = checkAligned( funcInfo, startIdx, 1999, outBegIdx, outNbElement,
+                             &refOutput[0][0], &refOutput_int[0][0], 2000 );
+   if( errNumber != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return errNumber;
+   }
+
+   retCode = TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ParamHolderFree failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERFREE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Verify 'output' against the packed reference: untouched before
+ * startIdx, NaN (or TA_INTEGER_DEFAULT) up to outBegIdx and then
+ * the same values as the reference.
+ */
+static ErrorNumber checkAligned( const TA_FuncInfo *funcInfo,
+                                 int startIdx, int endIdx,
+                                 int outBegIdx, int outNbElement,
+                                 const double *refOut, const int *refOut_int,
+                                 int refStride )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int j;
+   int i, padEnd, isInteger, isValid;
+
+   padEnd = outNbElement? outBegIdx : endIdx+1;
+
+   for( j=0; j < funcInfo->nbOutput; j++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+      isInteger = (outputInfo->type == TA_Output_Integer);
+      for( i=0; i <= endIdx; i++ )
+      {
+         if( i < startIdx )
+         {
+            if( isInteger )
+               isValid = (output_int[j][i] == TA_INTEGER_MIN);
+            else
+               isValid = (output[j][i] == TA_REAL_MIN);
+         }
+         else if( i < padEnd )
+         {
+            if( isInteger )
+               isValid = (output_int[j][i] == TA_INTEGER_DEFAULT);
+            else
+               isValid = (output[j][i] != output[j][i]);
+         }
+         else if( isInteger )
+            isValid = (output_int[j][i] == refOut_int[j*refStride+i-outBegIdx]);
+         else
+            isValid = isSameReal( output[j][i], refOut[j*refStride+i-outBegIdx] );
+
+         if( !isValid )
+         {
+            printf( "Aligned output #%d wrong at [%d] (startIdx=%d, outBegIdx=%d)\n",
+                    j, i, startIdx, outBegIdx );
+            return TA_ABS_TST_FAIL_ALIGNED_DIFF;
+         }
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* Call MACD (which allocates its temporary buffers on the heap)
+ * with the statistics enabled, then disabled, and verify what
+ * was accounted. The direct call of TA_MACD is accounted like
+ * the calls through the abstract interface.
+ */
+static ErrorNumber test_stats(void)
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *paramHolder;
+   TA_FuncStats stats;
+   TA_Integer outBegIdx, outNbElement;
+   ErrorNumber errNumber;
+   int i;
+
+   retCode = TA_GetFuncHandle( "MACD", &handle );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't get the function handle [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+   }
+
+   retCode = TA_ParamHolderAlloc( handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   TA_SetInputParamRealPtr( paramHolder, 0, gDataClose );
+   TA_SetOutputParamRealPtr( paramHolder, 0, output[0] );
+   TA_SetOutputParamRealPtr( paramHolder, 1, output[1] );
+   TA_SetOutputParamRealPtr( paramHolder, 2, output[2] );
+
+   TA_StatsReset();
+   TA_StatsEnable( 1 );
+   errNumber = TA_TEST_PASS;
+   for( i=0; (i < 3) && (errNumber == TA_TEST_PASS); i++ )
+   {
+      /* The last call is done with the statistics disabled. */
+      if( i == 2 )
+         TA_StatsEnable( 0 );
+
+      retCode = TA_CallFunc( paramHolder, 0, 1999, &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFunc failed [%d]\n", retCode );
+         errNumber = TA_ABS_TST_FAIL_STATS_CALLFUNC;
+      }
+   }
+   if( errNumber == TA_TEST_PASS )
+   {
+      TA_StatsEnable( 1 );
+      retCode = TA_MACD( 0, 1999, gDataClose, 12, 26, 9, &outBegIdx, &outNbElement,
+                         output[0], output[1], output[2] );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_MACD failed [%d]\n", retCode );
+         errNumber = TA_ABS_TST_FAIL_STATS_CALLFUNC;
+      }
+   }
+   TA_StatsEnable( 0 );
+   TA_ParamHolderFree( paramHolder );
+   if( errNumber != TA_TEST_PASS )
+      return errNumber;
+
+   retCode = TA_GetFuncStats( handle, &stats );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_GetFuncStats failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_STATS_GET;
+   }
+
+   if( (stats.nbCall != 3) ||
+       (stats.nbBar != 6000) ||
+       (stats.peakTime > stats.totalTime) ||
+       (stats.peakAllocBytes == 0) ||
+       (stats.allocBytes != 3*stats.peakAllocBytes) )
+   {
+      printf( "Wrong statistics (nbCall=%u, nbBar=%u, allocBytes=%u)\n",
+              (unsigned int)stats.nbCall, (unsigned int)stats.nbBar,
+              (unsigned int)stats.allocBytes );
+      return TA_ABS_TST_FAIL_STATS_VALUE;
+   }
+
+   TA_StatsReset();
+   retCode = TA_GetFuncStats( handle, &stats );
+   if( (retCode != TA_SUCCESS) || (stats.nbCall != 0) || (stats.allocBytes != 0) )
+   {
+      printf( "TA_StatsReset failed\n" );
+      return TA_ABS_TST_FAIL_STATS_VALUE;
+   }
+
+   if( TA_GetFuncStats( handle, NULL ) != TA_BAD_PARAM )
+      return TA_ABS_TST_FAIL_STATS_GET;
+
+   return test_stats_threads();
+}
+
+/* Many threads call MACD at the same time: no call must be lost
+ * in the statistics, and every call allocates the same bytes.
+ */
+static ErrorNumber test_stats_threads(void)
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_FuncStats stats;
+   ErrorNumber errNumber;
+   int i, nbThread;
+   #if defined( WIN32 )
+      HANDLE threads[NB_STATS_THREAD];
+   #else
+      pthread_t threads[NB_STATS_THREAD];
+   #endif
+
+   retCode = TA_GetFuncHandle( "MACD", &handle );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't get the function handle [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+   }
+
+   TA_StatsReset();
+   TA_StatsEnable( 1 );
+   errNumber = TA_TEST_PASS;
+   for( nbThread=0; nbThread < NB_STATS_THREAD; nbThread++ )
+   {
+      statsCallers[nbThread].retValue = TA_TEST_PASS;
+      #if defined( WIN32 )
+         threads[nbThread] = CreateThread( NULL, 0, statsCaller, &statsCallers[nbThread], 0, NULL );
+         if( threads[nbThread] == NULL )
+      #else
+         if( pthread_create( &threads[nbThread], NULL, statsCaller, &statsCallers[nbThread] ) != 0 )
+      #endif
+      {
+         printf( "Failed to create the thread %d\n", nbThread );
+         errNumber = TA_ABS_TST_FAIL_STATS_CALLFUNC;
+         break;
+      }
+   }
+
+   for( i=0; i < nbThread; i++ )
+   {
+      #if defined( WIN32 )
+         WaitForSingleObject( threads[i], INFINITE );
+         CloseHandle( threads[i] );
+      #else
+         pthread_join( threads[i], NULL );
+      #endif
+      if( statsCallers[i].retValue != TA_TEST_PASS )
+         errNumber = statsCallers[i].retValue;
+   }
+   TA_StatsEnable( 0 );
+   if( errNumber != TA_TEST_PASS )
+      return errNumber;
+
+   retCode = TA_GetFuncStats( handle, &stats );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_GetFuncStats failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_STATS_GET;
+   }
+
+   if( (stats.nbCall != NB_STATS_THREAD*NB_STATS_CALL) ||
+       (stats.nbBar != (UInt64)NB_STATS_THREAD*NB_STATS_CALL*2000) ||
+       (stats.peakTime > stats.totalTime) ||
+       (stats.peakAllocBytes == 0) ||
+       (stats.allocBytes != stats.nbCall*stats.peakAllocBytes) )
+   {
+      printf( "Wrong statistics from %d threads (nbCall=%u, nbBar=%u, allocBytes=%u)\n",
+              NB_STATS_THREAD, (unsigned int)stats.nbCall, (unsigned int)stats.nbBar,
+              (unsigned int)stats.allocBytes );
+      return TA_ABS_TST_FAIL_STATS_VALUE;
+   }
+
+   TA_StatsReset();
+
+   return TA_TEST_PASS;
+}
+
+static THREAD_FUNC statsCaller( void *arg )
+{
+   StatsCaller *caller;
+   TA_RetCode retCode;
+   TA_Integer outBegIdx, outNbElement;
+   int i;
+
+   caller = (StatsCaller *)arg;
+   for( i=0; i < NB_STATS_CALL; i++ )
+   {
+      retCode = TA_MACD( 0, 1999, gDataClose, 12, 26, 9, &outBegIdx, &outNbElement,
+                         caller->outMACD, caller->outSignal, caller->outHist );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_MACD failed [%d]\n", retCode );
+         caller->retValue = TA_ABS_TST_FAIL_STATS_CALLFUNC;
+         break;
+      }
+   }
+
+   return 0;
+}
+
+/* Verify that resuming from a checkpoint gives exactly the same
+ * output as a calculation from the start, with and without
+ * unstable period and for both compatibility.
+ */
+static ErrorNumber test_checkpoints(void)
+{
+   static const char *funcNames[] = { "EMA", "RSI", "CMO", "ATR", "T3", "ADX" };
+   static const int periods[] = { 2, 14, 30 };
+   static const TA_Integer checkpointIdx[] = { 30, 1000, 1998 };
+
+   ErrorNumber errNumber;
+   unsigned int i, j, k, l;
+
+   errNumber = TA_TEST_PASS;
+   for( l=0; (l < 4) && (errNumber == TA_TEST_PASS); l++ )
+   {
+      TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, (l&1)? 40 : 0 );
+      TA_SetCompatibility( (l&2)? TA_COMPATIBILITY_METASTOCK : TA_COMPATIBILITY_DEFAULT );
+
+      for( i=0; (i < sizeof(funcNames)/sizeof(char *)) && (errNumber == TA_TEST_PASS); i++ )
+      {
+         for( j=0; (j < sizeof(periods)/sizeof(int)) && (errNumber == TA_TEST_PASS); j++ )
+         {
+            for( k=0; (k < sizeof(checkpointIdx)/sizeof(TA_Integer)) && (errNumber == TA_TEST_PASS); k++ )
+            {
+               errNumber = callCheckpoint( funcNames[i], periods[j], checkpointIdx[k] );
+               if( errNumber != TA_TEST_PASS )
+                  printf( "Failed checkpoint test for [%s] period %d at %d (unstable=%d, metastock=%d)\n",
+                          funcNames[i], periods[j], checkpointIdx[k], l&1, (l&2)>>1 );
+            }
+         }
+      }
+   }
+
+   TA_SetUnstablePeriod( TA_FUNC_UNST_ALL, 0 );
+   TA_SetCompatibility( TA_COMPATIBILITY_DEFAULT );
+
+   return errNumber;
+}
+
+/* ATR and ADX have the high, low and close as input. */
+static int isCheckpointPriceInput( const char *funcName )
+{
+   return (strcmp( funcName, "ATR" ) == 0) || (strcmp( funcName, "ADX" ) == 0);
+}
+
+static void setCheckpointInput( TA_ParamHolder *paramHolder,
+                                const char *funcName, TA_Integer offset )
+{
+   if( isCheckpointPriceInput( funcName ) )
+      TA_SetInputParamPricePtr( paramHolder, 0, NULL, &gDataHigh[offset],
+                                &gDataLow[offset], &gDataClose[offset], NULL, NULL );
+   else
+      TA_SetInputParamRealPtr( paramHolder, 0, &gDataClose[offset] );
+}
+
+static ErrorNumber callCheckpoint( const char *funcName, int period,
+                                   TA_Integer checkpointIdx )
+{
+   TA_RetCode retCode;
+   const TA_FuncHandle *handle;
+   TA_ParamHolder *paramHolder;
+   TA_Checkpoint checkpoint, badCheckpoint;
+   TA_Integer refBegIdx, refNbElement, outBegIdx, outNbElement;
+   TA_Integer i, nbBar, firstBar, resumeNbElement;
+
+   retCode = TA_GetFuncHandle( funcName, &handle );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_GETFUNCHANDLE;
+
+   retCode = TA_ParamHolderAlloc( handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+
+   TA_SetOptInputParamInteger( paramHolder, 0, period );
+
+   /* Reference calculated from the start of the history. */
+   setCheckpointInput( paramHolder, funcName, 0 );
+   TA_SetOutputParamRealPtr( paramHolder, 0, refOutput[0] );
+   retCode = TA_CallFunc( paramHolder, 0, 1999, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_CHECKPOINT_CALLFUNC;
+   }
+
+   /* Same up to the checkpoint. */
+   TA_SetOutputParamRealPtr( paramHolder, 0, output[0] );
+   retCode = TA_CallFuncCheckpoint( paramHolder, 0, checkpointIdx,
+                                    &outBegIdx, &outNbElement, &checkpoint );
+
+   /* No state yet when the checkpoint is within the lookback. */
+   if( (checkpointIdx < refBegIdx) && (retCode == TA_OUT_OF_RANGE_END_INDEX) )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_TEST_PASS;
+   }
+
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncCheckpoint failed [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_CHECKPOINT_CALLFUNC;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outBegIdx+outNbElement-1 != checkpointIdx) ||
+       memcmp( output[0], refOutput[0], outNbElement*sizeof(TA_Real) ) != 0 )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_CHECKPOINT_DIFF;
+   }
+
+   /* Resume in two steps, in-place for the second one (the output
+    * is the input of the same bars, only for the single input).
+    */
+   firstBar = checkpointIdx+1;
+   resumeNbElement = 0;
+   while( firstBar < 2000 )
+   {
+      nbBar = 2000-firstBar;
+      if( (firstBar == checkpointIdx+1) && (nbBar > 1) )
+         nbBar /= 2;
+
+      if( (resumeNbElement != 0) && !isCheckpointPriceInput( funcName ) )
+      {
+         memcpy( inPlaceBuffer, &gDataClose[firstBar], nbBar*sizeof(TA_Real) );
+         TA_SetInputParamRealPtr( paramHolder, 0, inPlaceBuffer );
+         TA_SetOutputParamRealPtr( paramHolder, 0, inPlaceBuffer );
+      }
+      else
+      {
+         setCheckpointInput( paramHolder, funcName, firstBar );
+         TA_SetOutputParamRealPtr( paramHolder, 0, output[1] );
+      }
+
+      retCode = TA_CallFuncResume( paramHolder, &checkpoint, nbBar,
+                                   &outNbElement, &checkpoint );
+      if( (retCode != TA_SUCCESS) || (outNbElement != nbBar) )
+      {
+         printf( "TA_CallFuncResume failed [%d]\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_CHECKPOINT_RESUME;
+      }
+
+      for( i=0; i < nbBar; i++ )
+      {
+         if( ((resumeNbElement != 0) && !isCheckpointPriceInput( funcName )?
+               inPlaceBuffer[i] : output[1][i]) != refOutput[0][firstBar+i-refBegIdx] )
+         {
+            printf( "Resumed output differs at bar %d\n", firstBar+i );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_CHECKPOINT_DIFF;
+         }
+      }
+
+      resumeNbElement += nbBar;
+      firstBar += nbBar;
+   }
+
+   /* A checkpoint of another version or size (the second and third
+    * unsigned int of the header) is rejected.
+    */
+   for( i=1; i <= 2; i++ )
+   {
+      badCheckpoint = checkpoint;
+      badCheckpoint.data[i*sizeof(unsigned int)]++;
+      retCode = TA_CallFuncResume( paramHolder, &badCheckpoint, 1, &outNbElement, &badCheckpoint );
+      if( retCode != TA_BAD_PARAM )
+      {
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_CHECKPOINT_RESUME;
+      }
+   }
+
+   /* The checkpoint is only for the same function and optional inputs. */
+   if( strcmp( funcName, "T3" ) == 0 )
+   {
+      TA_SetOptInputParamReal( paramHolder, 1, 0.5 );
+      retCode = TA_CallFuncResume( paramHolder, &checkpoint, 1, &outNbElement, &checkpoint );
+      if( retCode != TA_BAD_PARAM )
+      {
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_CHECKPOINT_RESUME;
+      }
+      TA_SetOptInputParamReal( paramHolder, 1, 0.7 );
+   }
+
+   TA_SetOptInputParamInteger( paramHolder, 0, period+1 );
+   retCode = TA_CallFuncResume( paramHolder, &checkpoint, 1, &outNbElement, &checkpoint );
+   TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_BAD_PARAM )
+      return TA_ABS_TST_FAIL_CHECKPOINT_RESUME;
+
+   return TA_TEST_PASS;
+}
+
+static void testCache( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   *errorNumber = callWithCache( funcInfo );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed call with the result cache for [%s]\n", funcInfo->name );
+}
+
+/* Verify that the calls through a cache give the same output as
+ * without, for a series growing and then read again.
+ */
+static ErrorNumber test_result_cache(void)
+{
+   TA_RetCode retCode;
+   TA_ResultCacheStats stats;
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   ErrorNumber errNumber;
+
+   /* A few entries only, to exercise the eviction. */
+   retCode = TA_ResultCacheAlloc( 4, 16*1024*1024, &resultCache );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ResultCacheAlloc failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_CACHE_ALLOC;
+   }
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testCache, &errNumber );
+
+   TA_ResultCacheGetStats( resultCache, &stats );
+   if( (errNumber == TA_TEST_PASS) &&
+       ((stats.nbEntry > 4) || (stats.nbEvict == 0) || (stats.nbBytes == 0)) )
+   {
+      printf( "Wrong cache statistics (nbEntry=%u, nbEvict=%u)\n",
+              stats.nbEntry, (unsigned int)stats.nbEvict );
+      errNumber = TA_ABS_TST_FAIL_CACHE_STATS;
+   }
+
+   TA_ResultCacheClear( resultCache );
+   TA_ResultCacheGetStats( resultCache, &stats );
+   if( (errNumber == TA_TEST_PASS) && ((stats.nbEntry != 0) || (stats.nbBytes != 0)) )
+   {
+      printf( "TA_ResultCacheClear failed\n" );
+      errNumber = TA_ABS_TST_FAIL_CACHE_STATS;
+   }
+
+   TA_ResultCacheFree( resultCache );
+   resultCache = NULL;
+   if( errNumber != TA_TEST_PASS )
+      return errNumber;
+
+   /* A calculation larger than the cache is not kept. */
+   retCode = TA_ResultCacheAlloc( 4, 1000, &resultCache );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_ResultCacheAlloc failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_CACHE_ALLOC;
+   }
+
+   errNumber = TA_ABS_TST_FAIL_GETFUNCHANDLE;
+   if( (TA_GetFuncHandle( "MACD", &handle ) == TA_SUCCESS) &&
+       (TA_GetFuncInfo( handle, &funcInfo ) == TA_SUCCESS) )
+      errNumber = callWithCache( funcInfo );
+   TA_ResultCacheGetStats( resultCache, &stats );
+   if( (errNumber == TA_TEST_PASS) && ((stats.nbEntry != 0) || (stats.nbHit != 0)) )
+   {
+      printf( "Calculation kept in a cache too small\n" );
+      errNumber = TA_ABS_TST_FAIL_CACHE_STATS;
+   }
+
+   TA_ResultCacheFree( resultCache );
+   resultCache = NULL;
+
+   if( TA_ResultCacheAlloc( 0, 1000, &resultCache ) != TA_BAD_PARAM )
+      return TA_ABS_TST_FAIL_CACHE_ALLOC;
+
+   return errNumber;
+}
+
+static ErrorNumber callWithCache( const TA_FuncInfo *funcInfo )
+{
+   /* Miss, two extensions, a hit on a shorter range and a
+    * hit on the whole range. Then the same with the inputs
+    * identified by their content.
+    */
+   static const TA_Integer endIdx[] = { 700, 1400, 1999, 1000, 1999, 1999, 1999 };
+   #define NB_CACHE_CALL ((int)(sizeof(endIdx)/sizeof(TA_Integer)))
+
+   TA_ParamHolder *refHolder, *paramHolder;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_ResultCacheStats before, after;
+   TA_RetCode retCode;
+   ErrorNumber errNumber;
+   unsigned int j;
+   int i, k;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+   double ref, tolerance;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &refHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      TA_ParamHolderFree( refHolder );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   TA_ResultCacheGetStats( resultCache, &before );
+   errNumber = TA_TEST_PASS;
+   for( k=0; (k < NB_CACHE_CALL) && (errNumber == TA_TEST_PASS); k++ )
+   {
+      setInPlaceParams( refHolder, funcInfo, -1, -1 );
+      retCode = TA_CallFunc( refHolder, 0, endIdx[k], &refBegIdx, &refNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+         errNumber = TA_ABS_TST_FAIL_CACHE_CALLFUNC;
+         break;
+      }
+      memcpy( refOutput, output, sizeof(output) );
+      memcpy( refOutput_int, output_int, sizeof(output_int) );
+
+      setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+      TA_SetParamHolderCache( paramHolder, resultCache, k < 5? 1 : 0, 1 );
+      retCode = TA_CallFunc( paramHolder, 0, endIdx[k], &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFunc() failed with the cache [%d]\n", retCode );
+         errNumber = TA_ABS_TST_FAIL_CACHE_CALLFUNC;
+         break;
+      }
+
+      if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+      {
+         printf( "Call %d: output range %d/%d != %d/%d\n", k,
+                 outBegIdx, outNbElement, refBegIdx, refNbElement );
+         errNumber = TA_ABS_TST_FAIL_CACHE_DIFF;
+         break;
+      }
+
+      /* Same values, except for the rounding of the running sums
+       * when only the new bars were calculated.
+       */
+      for( j=0; (j < funcInfo->nbOutput) && (errNumber == TA_TEST_PASS); j++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+         for( i=0; i < outNbElement; i++ )
+         {
+            if( outputInfo->type == TA_Output_Integer )
+            {
+               if( output_int[j][i] != refOutput_int[j][i] )
+               {
+                  printf( "Call %d: integer output #%d differs at %d\n", k, j, i );
+                  errNumber = TA_ABS_TST_FAIL_CACHE_DIFF;
+                  break;
+               }
+               continue;
+            }
+
+            ref = refOutput[j][i];
+            tolerance = 1e-8 * (fabs(ref) > 1.0? fabs(ref) : 1.0);
+            if( !isSameReal( output[j][i], ref ) && !(fabs(output[j][i]-ref) <= tolerance) )
+            {
+               printf( "Call %d: output #%d differs at %d: %e != %e\n",
+                       k, j, i, output[j][i], ref );
+               errNumber = TA_ABS_TST_FAIL_CACHE_DIFF;
+               break;
+            }
+         }
+      }
+   }
+
+   TA_ParamHolderFree( refHolder );
+   if( errNumber != TA_TEST_PASS )
+   {
+      TA_ParamHolderFree( paramHolder );
+      return errNumber;
+   }
+
+   /* A large enough cache must have done each call as expected. */
+   TA_ResultCacheGetStats( resultCache, &after );
+   if( (after.nbBytes > 0) &&
+       ((after.nbMiss-before.nbMiss != 2) ||
+        (after.nbExtend-before.nbExtend != 2) ||
+        (after.nbHit-before.nbHit != 3)) )
+   {
+      printf( "Wrong cache statistics (nbMiss=%u, nbExtend=%u, nbHit=%u)\n",
+              (unsigned int)(after.nbMiss-before.nbMiss),
+              (unsigned int)(after.nbExtend-before.nbExtend),
+              (unsigned int)(after.nbHit-before.nbHit) );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_CACHE_STATS;
+   }
+
+   /* The aligned output uses the same cache entries: the whole
+    * range is a hit, moved at the index of the inputs.
+    */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   TA_SetParamHolderCache( paramHolder, resultCache, 1, 1 );
+   retCode = TA_CallFuncAligned( paramHolder, 0, 1999, &outBegIdx, &outNbElement );
+   TA_ParamHolderFree( paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFuncAligned() failed with the cache [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_CACHE_CALLFUNC;
+   }
+
+   if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+   {
+      printf( "Aligned call: output range %d/%d != %d/%d\n",
+              outBegIdx, outNbElement, refBegIdx, refNbElement );
+      return TA_ABS_TST_FAIL_CACHE_DIFF;
+   }
+
+   for( j=0; j < funcInfo->nbOutput; j++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+      for( i=0; i < outBegIdx+outNbElement; i++ )
+      {
+         if( outputInfo->type == TA_Output_Integer )
+         {
+            if( output_int[j][i] != ((i < outBegIdx)? TA_INTEGER_DEFAULT : refOutput_int[j][i-outBegIdx]) )
+            {
+               printf( "Aligned call: integer output #%d differs at %d\n", j, i );
+               return TA_ABS_TST_FAIL_CACHE_DIFF;
+            }
+         }
+         else if( i < outBegIdx )
+         {
+            if( output[j][i] == output[j][i] )
+            {
+               printf( "Aligned call: output #%d not NaN at %d\n", j, i );
+               return TA_ABS_TST_FAIL_CACHE_DIFF;
+            }
+         }
+         else
+         {
+            ref = refOutput[j][i-outBegIdx];
+            tolerance = 1e-8 * (fabs(ref) > 1.0? fabs(ref) : 1.0);
+            if( !isSameReal( output[j][i], ref ) && !(fabs(output[j][i]-ref) <= tolerance) )
+            {
+               printf( "Aligned call: output #%d differs at %d: %e != %e\n",
+                       j, i, output[j][i], ref );
+               return TA_ABS_TST_FAIL_CACHE_DIFF;
+            }
+         }
+      }
+   }
+
+   TA_ResultCacheGetStats( resultCache, &before );
+   if( (before.nbBytes > 0) && (before.nbHit-after.nbHit != 1) )
+   {
+      printf( "Aligned call not taken from the cache\n" );
+      return TA_ABS_TST_FAIL_CACHE_STATS;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void testTimeframes( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   *errorNumber = callTimeframes( funcInfo );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed call on timeframes for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_timeframes(void)
+{
+   TA_RetCode retCode;
+   ErrorNumber errNumber;
+
+   retCode = TA_TimeframesAlloc( gDataOpen, gDataHigh, gDataLow, gDataClose, NULL,
+                                 2000, testFactors, NB_TEST_TIMEFRAME, &baseTimeframes );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_TimeframesAlloc failed [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_TIMEFRAMES_ALLOC;
+   }
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testTimeframes, &errNumber );
+
+   TA_TimeframesFree( baseTimeframes );
+   baseTimeframes = NULL;
+
+   return errNumber;
+}
+
+/* Set the inputs like setInPlaceParams, on the prices aggregated
+ * in tfPrice (the volume being the close).
+ */
+static void setTimeframeInputs( TA_ParamHolder *paramHolder,
+                                const TA_FuncInfo *funcInfo )
+{
+   const TA_InputParameterInfo *inputInfo;
+   unsigned int i;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      if( inputInfo->type == TA_Input_Price )
+         TA_SetInputParamPricePtr( paramHolder, i,
+                                   inputInfo->flags&TA_IN_PRICE_OPEN?tfPrice[0]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_HIGH?tfPrice[1]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_LOW?tfPrice[2]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_CLOSE?tfPrice[3]:NULL,
+                                   inputInfo->flags&TA_IN_PRICE_VOLUME?tfPrice[3]:NULL,
+                                   NULL );
+      else if( inputInfo->type == TA_Input_Real )
+         TA_SetInputParamRealPtr( paramHolder, i, (i==0)?tfPrice[3]:tfPrice[0] );
+   }
+}
+
+static ErrorNumber callTimeframes( const TA_FuncInfo *funcInfo )
+{
+   TA_ParamHolder *paramHolder, *refHolder;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   ErrorNumber errNumber;
+   unsigned int j;
+   int i, k, t, projected, factor, nbAggBar, same;
+   int refBegIdx, refNbElement;
+   int outBegIdx[NB_TEST_TIMEFRAME], outNbElement[NB_TEST_TIMEFRAME];
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &refHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+
+   /* Only the base series can be aggregated, not the periods of MAVP. */
+   for( j=0; j < funcInfo->nbInput; j++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, j, &inputInfo );
+      if( strcmp( inputInfo->paramName, "inPeriods" ) == 0 )
+         TA_SetInputParamRealPtr( paramHolder, j, gDataOpen );
+   }
+
+   for( j=0; j < funcInfo->nbOutput; j++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( paramHolder, j, tfOutput_int[j] );
+      else
+         TA_SetOutputParamRealPtr( paramHolder, j, tfOutput[j] );
+   }
+
+   errNumber = TA_TEST_PASS;
+   for( projected=0; (projected < 2) && (errNumber == TA_TEST_PASS); projected++ )
+   {
+      retCode = TA_CallFuncTimeframes( paramHolder, baseTimeframes, projected,
+                                       outBegIdx, outNbElement );
+      if( retCode == TA_NOT_SUPPORTED )
+         break; /* Integer inputs. */
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFuncTimeframes() failed [%d]\n", retCode );
+         errNumber = TA_ABS_TST_FAIL_TIMEFRAMES_CALLFUNC;
+         break;
+      }
+
+      for( t=0; (t < NB_TEST_TIMEFRAME) && (errNumber == TA_TEST_PASS); t++ )
+      {
+         /* Reference: the function called on the aggregated prices. */
+         factor   = testFactors[t];
+         nbAggBar = (2000+factor-1)/factor;
+         for( k=0; k < nbAggBar; k++ )
+         {
+            tfPrice[0][k] = gDataOpen[k*factor];
+            tfPrice[1][k] = gDataHigh[k*factor];
+            tfPrice[2][k] = gDataLow[k*factor];
+            for( i=k*factor; (i < (k+1)*factor) && (i < 2000); i++ )
+            {
+               if( gDataHigh[i] > tfPrice[1][k] ) tfPrice[1][k] = gDataHigh[i];
+               if( gDataLow[i] < tfPrice[2][k] )  tfPrice[2][k] = gDataLow[i];
+               tfPrice[3][k] = gDataClose[i];
+            }
+         }
+
+         setInPlaceParams( refHolder, funcInfo, -1, -1 );
+         setTimeframeInputs( refHolder, funcInfo );
+         retCode = TA_CallFunc( refHolder, 0, nbAggBar-1, &refBegIdx, &refNbElement );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+            errNumber = TA_ABS_TST_FAIL_TIMEFRAMES_CALLFUNC;
+            break;
+         }
+
+         if( !projected && ((outBegIdx[t] != refBegIdx) || (outNbElement[t] != refNbElement)) )
+         {
+            printf( "Factor %d: output range %d/%d != %d/%d\n", factor,
+                    outBegIdx[t], outNbElement[t], refBegIdx, refNbElement );
+            errNumber = TA_ABS_TST_FAIL_TIMEFRAMES_DIFF;
+            break;
+         }
+
+         /* Projected, the base bar 'i' has the value of the last
+          * aggregated bar completed at 'i'.
+          */
+         for( j=0; (j < funcInfo->nbOutput) && (errNumber == TA_TEST_PASS); j++ )
+         {
+            TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+            for( i=0; i < (projected? 2000 : outNbElement[t]); i++ )
+            {
+               k = projected? (i+1)/factor-1-refBegIdx : i;
+               if( projected && ((k < 0) || (refNbElement == 0)) )
+               {
+                  if( outputInfo->type == TA_Output_Integer )
+                     same = (tfOutput_int[j][t*2000+i] == TA_INTEGER_DEFAULT);
+                  else
+                     same = (tfOutput[j][t*2000+i] != tfOutput[j][t*2000+i]);
+                  same = same && (i < outBegIdx[t] || (outNbElement[t] == 0));
+               }
+               else if( outputInfo->type == TA_Output_Integer )
+                  same = (tfOutput_int[j][t*2000+i] == output_int[j][k]);
+               else
+                  same = isSameReal( tfOutput[j][t*2000+i], output[j][k] );
+
+               if( !same )
+               {
+                  printf( "Factor %d%s: output #%d differs at %d\n", factor,
+                          projected? " projected" : "", j, i );
+                  errNumber = TA_ABS_TST_FAIL_TIMEFRAMES_DIFF;
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   TA_ParamHolderFree( refHolder );
+   TA_ParamHolderFree( paramHolder );
+
+   return errNumber;
+}
+
+static void testCompact( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   ErrorNumber *errorNumber;
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int j;
+   int hasInteger;
+
+   errorNumber = (ErrorNumber *)opaqueData;
+   if( *errorNumber != TA_TEST_PASS )
+      return;
+
+   hasInteger = 0;
+   for( j=0; j < funcInfo->nbOutput; j++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         hasInteger = 1;
+   }
+   if( !hasInteger )
+      return;
+
+   /* Starting at 500 calculates in chunks not aligned on the start. */
+   *errorNumber = callCompact( funcInfo, 0, 0 );
+   if( *errorNumber == TA_TEST_PASS )
+      *errorNumber = callCompact( funcInfo, 500, 0 );
+   if( *errorNumber == TA_TEST_PASS )
+      *errorNumber = callCompact( funcInfo, 500, 1 );
+
+   if( *errorNumber != TA_TEST_PASS )
+      printf( "Failed compact output for [%s]\n", funcInfo->name );
+}
+
+static ErrorNumber test_compact_calls(void)
+{
+   ErrorNumber errNumber;
+
+   errNumber = TA_TEST_PASS;
+   TA_ForEachFunc( testCompact, &errNumber );
+
+   return errNumber;
+}
+
+/* Verify the int8 and the bit outputs against the TA_Integer
+ * outputs of the same call. The elements not written must
+ * keep their previous value. The int8 must be rejected for
+ * the unbounded outputs (like MAXINDEX).
+ */
+static ErrorNumber callCompact( const TA_FuncInfo *funcInfo, int startIdx, int aligned )
+{
+   TA_ParamHolder *paramHolder;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_RetCode retCode;
+   int refBegIdx, refNbElement;
+   int outBegIdx, outNbElement;
+   int i, isBit, isWritten, ref, expected, value, divisor;
+   unsigned int j;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &paramHolder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "Can't allocate the param holder [%d]\n", retCode );
+      return TA_ABS_TST_FAIL_PARAMHOLDERALLOC;
+   }
+
+   /* Reference call. */
+   setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+   TA_SetOutputAligned( paramHolder, aligned );
+   retCode = TA_CallFunc( paramHolder, startIdx, 1999, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "TA_CallFunc() failed reference call [%d]\n", retCode );
+      TA_ParamHolderFree( paramHolder );
+      return TA_ABS_TST_FAIL_COMPACT_CALLFUNC;
+   }
+   memcpy( refOutput_int, output_int, sizeof(output_int) );
+
+   /* Only the bounded values can be stored as int8. */
+   if( strcmp( funcInfo->group, "Pattern Recognition" ) == 0 )
+   {
+      if( (strcmp( funcInfo->name, "CDLHIKKAKE" ) == 0) ||
+          (strcmp( funcInfo->name, "CDLHIKKAKEMOD" ) == 0) )
+         divisor = 100;
+      else
+         divisor = 1;
+   }
+   else if( (strcmp( funcInfo->name, "CROSSOVER"        ) == 0) ||
+            (strcmp( funcInfo->name, "CROSSUNDER"       ) == 0) ||
+            (strcmp( funcInfo->name, "HT_TRENDMODE"     ) == 0) ||
+            (strcmp( funcInfo->name, "THRESHOLD_EVENTS" ) == 0) )
+      divisor = 1;
+   else
+      divisor = 0;
+
+   for( isBit=0; isBit <= 1; isBit++ )
+   {
+      if( !isBit && (divisor == 0) )
+      {
+         for( j=0; j < funcInfo->nbOutput; j++ )
+         {
+            TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+            if( outputInfo->type != TA_Output_Integer )
+               continue;
+            retCode = TA_SetOutputParamInt8Ptr( paramHolder, j, &int8Output[j][0] );
+            if( retCode != TA_INVALID_PARAM_HOLDER_TYPE )
+            {
+               printf( "Int8 output not rejected [%d]\n", retCode );
+               TA_ParamHolderFree( paramHolder );
+               return TA_ABS_TST_FAIL_COMPACT_CALLFUNC;
+            }
+         }
+         continue;
+      }
+
+      setInPlaceParams( paramHolder, funcInfo, -1, -1 );
+      memset( int8Output, COMPACT_SENTINEL, sizeof(int8Output) );
+      memset( bitOutput, 0xAA, sizeof(bitOutput) );
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+         if( outputInfo->type != TA_Output_Integer )
+            continue;
+         if( isBit )
+            retCode = TA_SetOutputParamBitPtr( paramHolder, j, &bitOutput[j][0] );
+         else
+            retCode = TA_SetOutputParamInt8Ptr( paramHolder, j, &int8Output[j][0] );
+         if( retCode != TA_SUCCESS )
+         {
+            printf( "Can't set the compact output [%d]\n", retCode );
+            TA_ParamHolderFree( paramHolder );
+            return TA_ABS_TST_FAIL_COMPACT_CALLFUNC;
+         }
+      }
+
+      /* Not supported when calculating at specific indices. */
+      retCode = TA_CallFuncAtIndices( paramHolder, testIndices, 10,
+                                      &outBegIdx, &outNbElement );
+      if( retCode != TA_NOT_SUPPORTED )
+      {
+         printf( "TA_CallFuncAtIndices() with compact output [%d]\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_COMPACT_CALLFUNC;
+      }
+
+      retCode = TA_CallFunc( paramHolder, startIdx, 1999, &outBegIdx, &outNbElement );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "TA_CallFunc() failed with compact output [%d]\n", retCode );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_COMPACT_CALLFUNC;
+      }
+
+      if( (outBegIdx != refBegIdx) || (outNbElement != refNbElement) )
+      {
+         printf( "Compact range [%d,%d] != [%d,%d]\n", outBegIdx, outNbElement, refBegIdx, refNbElement );
+         TA_ParamHolderFree( paramHolder );
+         return TA_ABS_TST_FAIL_COMPACT_DIFF;
+      }
+
+      for( j=0; j < funcInfo->nbOutput; j++ )
+      {
+         TA_GetOutputParameterInfo( funcInfo->handle, j, &outputInfo );
+         if( outputInfo->type != TA_Output_Integer )
+            continue;
+
+         for( i=0; i < 2000; i++ )
+         {
+            if( aligned )
+               isWritten = (i >= startIdx);
+            else
+               isWritten = (i < outNbElement);
+            ref = refOutput_int[j][i];
+
+            if( isBit )
+            {
+               value = (bitOutput[j][i/8]>>(i%8))&1;
+               if( !isWritten )
+                  expected = (0xAA>>(i%8))&1;
+               else
+                  expected = (ref != 0) && (ref != TA_INTEGER_DEFAULT);
+            }
+            else
+            {
+               value = int8Output[j][i];
+               if( !isWritten )
+                  expected = COMPACT_SENTINEL;
+               else if( ref == TA_INTEGER_DEFAULT )
+                  expected = TA_INT8_DEFAULT;
+               else
+               {
+                  /* The value must be restored exactly. */
+                  expected = ref/divisor;
+                  if( (expected*divisor != ref) || (expected < -127) || (expected > 127) )
+                  {
+                     printf( "Value %d does not fit in an int8 at [%d]\n", ref, i );
+                     TA_ParamHolderFree( paramHolder );
+                     return TA_ABS_TST_FAIL_COMPACT_DIFF;
+                  }
+               }
+            }
+
+            if( value != expected )
+            {
+               printf( "Compact %s output #%d is %d instead of %d at [%d] (startIdx=%d, aligned=%d)\n",
+                       isBit? "bit" : "int8", j, value, expected, i, startIdx, aligned );
+               TA_ParamHolderFree( paramHolder );
+               return TA_ABS_TST_FAIL_COMPACT_DIFF;
+            }
+         }
+      }
+   }
 
    retCode = TA_ParamHolderFree( paramHolder );
    if( retCode != TA_SUCCESS )
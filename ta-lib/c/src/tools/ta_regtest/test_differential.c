@@ -0,0 +1,1176 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ */
+
+/* Description:
+ *     Differential tests of the alternate paths of the library.
+ *
+ *     Every function is called through each path giving the same
+ *     output by another way (aligned output, in-place, segments, at
+ *     indices, result cache, series index, checkpoints and the float
+ *     inputs of the TA_S_XXX functions). Each output is compared with
+ *     the reference: a plain TA_CallFunc on the same data.
+ *
+ *     The synthetic series are meant to be hard on the calculations:
+ *     random walk, monotonic, constant, spikes, denormals and huge
+ *     magnitudes.
+ *
+ *     Each path has a maximum relative error, zero when the output
+ *     must be identical. A difference of NaN, infinity, integer output
+ *     or range (outBegIdx/outNbElement) always fails.
+ *
+ *     ta_regtest runs these tests on short series. The '-d' option
+ *     runs them on long series (10 millions bars by default) and
+ *     reports the largest error of each function for each path.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ta_test_priv.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+#define DIFF_MAX_OUTPUT 3
+
+/* The series index needs about 40 doubles per bar: its
+ * path is tested on the first bars only.
+ */
+#define DIFF_MAX_INDEX_BAR 1000000
+
+typedef enum
+{
+   SHAPE_RANDOM,
+   SHAPE_MONOTONIC,
+   SHAPE_CONSTANT,
+   SHAPE_SPIKES,
+   SHAPE_DENORMAL,
+   SHAPE_HUGE,
+   NB_SHAPE
+} ShapeId;
+
+static const char *shapeName[NB_SHAPE] =
+{
+   "random", "monotonic", "constant", "spikes", "denormal", "huge"
+};
+
+/* The running sums of the reference keep the rounding error of the
+ * largest values (the spikes, the first bars of the monotonic series)
+ * for the rest of the series. A calculation from another start has
+ * another rounding: it is compared but the relative error does not
+ * fail the test (the mismatches still do).
+ */
+static const int illConditioned[NB_SHAPE] = { 0, 1, 0, 1, 0, 0 };
+
+typedef enum
+{
+   PATH_ALIGNED,
+   PATH_INPLACE,
+   PATH_INDICES,
+   PATH_CACHE,
+   PATH_INDEX,
+   PATH_CHECKPOINT,
+   PATH_SEGMENTS,
+   PATH_FLOAT,
+   NB_PATH
+} PathId;
+
+typedef struct
+{
+   const char *name;
+
+   /* Largest relative error accepted. */
+   double maxRelError;
+
+   /* The values smaller than this fraction of the largest output are
+    * compared relative to it: a value near zero is the result of a
+    * cancellation, its error is relative to the values cancelled.
+    */
+   double floor;
+} PathInfo;
+
+/* The calculation at indices, the result cache and the series index
+ * are calculating the running sums from another start, so with another
+ * rounding. The variances (VAR, STDDEV, CORREL, BETA...) are the
+ * difference of two of these sums: when the mean is large compared to
+ * the deviation, most of the digits cancel and the error is relative
+ * to the sum of the squares, not to the output.
+ *
+ * The TA_S_XXX functions are compared with the TA_XXX on the same
+ * values (the floats converted to double), but part of their
+ * calculation is done with floats.
+ */
+static const PathInfo pathInfo[NB_PATH] =
+{
+   { "aligned",  0.0,  0.0 },
+   { "inplace",  0.0,  0.0 },
+   { "indices",  1e-3, 1e-6 },
+   { "cache",    1e-3, 1e-6 },
+   { "index",    1e-3, 1e-6 },
+   { "checkpt",  0.0,  0.0 },
+   { "segments", 0.0,  0.0 },
+   { "float",    1e-2, 1e-3 }
+};
+
+typedef struct
+{
+   UInt64 nbCompared; /* Zero when the path was not tested. */
+   unsigned int nbMismatch;
+   double maxUlp;
+   double maxRelError;
+   double maxGatedRelError; /* Excluding the ill-conditioned shapes. */
+   ShapeId worstShape;
+} DiffResult;
+
+typedef struct
+{
+   const TA_FuncInfo *funcInfo;
+   DiffResult path[NB_PATH];
+} FuncDiff;
+
+/* The TA_S_XXX functions are called directly, there is no float
+ * input in the abstract interface.
+ */
+typedef TA_RetCode (*PeriodFunc)( int, int, const double *, int, int *, int *, double * );
+typedef TA_RetCode (*PeriodFuncS)( int, int, const float *, int, int *, int *, double * );
+typedef TA_RetCode (*TransformFunc)( int, int, const double *, int *, int *, double * );
+typedef TA_RetCode (*TransformFuncS)( int, int, const float *, int *, int *, double * );
+typedef TA_RetCode (*HLCPeriodFunc)( int, int, const double *, const double *, const double *,
+                                     int, int *, int *, double * );
+typedef TA_RetCode (*HLCPeriodFuncS)( int, int, const float *, const float *, const float *,
+                                      int, int *, int *, double * );
+
+#define FLOAT_FUNC(name) { #name, TA_##name, TA_S_##name }
+
+static const struct { const char *name; PeriodFunc func; PeriodFuncS funcS; } periodFunc[] =
+{
+   FLOAT_FUNC(SMA), FLOAT_FUNC(EMA), FLOAT_FUNC(WMA), FLOAT_FUNC(DEMA),
+   FLOAT_FUNC(TEMA), FLOAT_FUNC(TRIMA), FLOAT_FUNC(KAMA), FLOAT_FUNC(TRIX),
+   FLOAT_FUNC(RSI), FLOAT_FUNC(CMO), FLOAT_FUNC(MOM), FLOAT_FUNC(ROC),
+   FLOAT_FUNC(ROCP), FLOAT_FUNC(ROCR), FLOAT_FUNC(ROCR100), FLOAT_FUNC(SUM),
+   FLOAT_FUNC(MAX), FLOAT_FUNC(MIN), FLOAT_FUNC(MIDPOINT), FLOAT_FUNC(LINEARREG),
+   FLOAT_FUNC(LINEARREG_SLOPE), FLOAT_FUNC(LINEARREG_ANGLE),
+   FLOAT_FUNC(LINEARREG_INTERCEPT), FLOAT_FUNC(TSF)
+};
+
+static const struct { const char *name; TransformFunc func; TransformFuncS funcS; } transformFunc[] =
+{
+   FLOAT_FUNC(SQRT), FLOAT_FUNC(LN), FLOAT_FUNC(LOG10), FLOAT_FUNC(SIN),
+   FLOAT_FUNC(COS), FLOAT_FUNC(ATAN), FLOAT_FUNC(CEIL), FLOAT_FUNC(FLOOR),
+   FLOAT_FUNC(HT_DCPERIOD), FLOAT_FUNC(HT_DCPHASE), FLOAT_FUNC(HT_TRENDLINE)
+};
+
+/* Not CCI: the typical price is added in float, and the mean deviation
+ * of a short period can be smaller than the rounding of the prices.
+ */
+static const struct { const char *name; HLCPeriodFunc func; HLCPeriodFuncS funcS; } hlcPeriodFunc[] =
+{
+   FLOAT_FUNC(ATR), FLOAT_FUNC(NATR), FLOAT_FUNC(WILLR),
+   FLOAT_FUNC(ADX), FLOAT_FUNC(ADXR), FLOAT_FUNC(DX), FLOAT_FUNC(PLUS_DI),
+   FLOAT_FUNC(MINUS_DI)
+};
+
+#undef FLOAT_FUNC
+
+/* Periods used with the TA_S_XXX functions (20 is one of
+ * the fixed period kernels of SMA and EMA).
+ */
+static const int floatPeriod[] = { 2, 14, 20, 37 };
+
+#define NB_ELEMENT(x) ((int)(sizeof(x)/sizeof(x[0])))
+
+/* False for infinity and NaN. */
+#define IS_FINITE(x) (((x)-(x)) == 0.0)
+
+/**** Local functions declarations.    ****/
+static void addFunc( const TA_FuncInfo *funcInfo, void *opaqueData );
+static ErrorNumber allocSeries( int size );
+static void freeSeries( void );
+static void makeSeries( ShapeId shape );
+static double randomUniform( void );
+static void setInputs( TA_ParamHolder *params, const TA_FuncInfo *funcInfo,
+                       int offset, int inPlace );
+static void setOutputs( TA_ParamHolder *params, const TA_FuncInfo *funcInfo,
+                        double **real, int **integer, int offset );
+static void setScale( const TA_FuncInfo *funcInfo, int nbElement );
+static void compareValue( DiffResult *result, PathId path, ShapeId shape,
+                          double value, double ref, double scale );
+static void compareRange( DiffResult *result, PathId path, ShapeId shape,
+                          const TA_FuncInfo *funcInfo,
+                          double **real, int **integer,
+                          int altIdx, int refIdx, int nbElement );
+static ErrorNumber testFunc( FuncDiff *funcDiff, ShapeId shape );
+static ErrorNumber testSegments( FuncDiff *funcDiff, ShapeId shape,
+                                 TA_ParamHolder *params );
+static ErrorNumber testFloat( ShapeId shape );
+static void compareFloat( const char *name, ShapeId shape,
+                          TA_RetCode retCode, int begIdx, int nbElement,
+                          TA_RetCode refRetCode, int refBegIdx, int refNbElement );
+static FuncDiff *findFunc( const char *name );
+static ErrorNumber checkGates( int doReport );
+
+/**** Local variables definitions.     ****/
+static FuncDiff *funcDiff;
+static unsigned int nbFunc;
+
+static int nbBar;
+
+/* The series of the current shape. */
+static double *price[5];
+
+/* Same rounded to float, as float and as double. */
+static float  *priceS[3];
+static double *roundedPrice[3];
+
+static double *refReal[DIFF_MAX_OUTPUT];
+static int    *refInt[DIFF_MAX_OUTPUT];
+static double *altReal[DIFF_MAX_OUTPUT];
+static int    *altInt[DIFF_MAX_OUTPUT];
+static double *inPlaceBuffer;
+static int    *inputInt;
+static int    *indices;
+static int     nbIndices;
+
+/* Largest magnitude of each output of the reference. */
+static double refScale[DIFF_MAX_OUTPUT];
+
+static TA_ResultCache *resultCache;
+static TA_SeriesIndex *seriesIndex;
+static UInt64 randomState;
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_differential( int size, int doReport )
+{
+   ErrorNumber retValue;
+   unsigned int i;
+   int shape;
+   clock_t begin;
+
+   retValue = allocLib();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   nbFunc = 0;
+   funcDiff = NULL;
+   TA_ForEachFunc( addFunc, NULL );
+   if( !funcDiff )
+      return TA_DIFF_TST_ALLOC_FAILED;
+
+   retValue = allocSeries( size );
+
+   for( shape=0; (shape < NB_SHAPE) && (retValue == TA_TEST_PASS); shape++ )
+   {
+      begin = clock();
+      if( doReport )
+      {
+         printf( "%s series of %d bars...", shapeName[shape], nbBar );
+         fflush(stdout);
+      }
+
+      makeSeries( (ShapeId)shape );
+
+      for( i=0; (i < nbFunc) && (retValue == TA_TEST_PASS); i++ )
+         retValue = testFunc( &funcDiff[i], (ShapeId)shape );
+
+      if( retValue == TA_TEST_PASS )
+         retValue = testFloat( (ShapeId)shape );
+
+      if( seriesIndex )
+      {
+         TA_SeriesIndexFree( seriesIndex );
+         seriesIndex = NULL;
+      }
+
+      if( doReport )
+         printf( " %.1f seconds\n", (double)(clock()-begin)/CLOCKS_PER_SEC );
+   }
+
+   if( retValue == TA_TEST_PASS )
+      retValue = checkGates( doReport );
+
+   freeSeries();
+   free( funcDiff );
+   funcDiff = NULL;
+
+   if( retValue != TA_TEST_PASS )
+   {
+      freeLib();
+      return retValue;
+   }
+
+   return freeLib();
+}
+
+/**** Local functions definitions.     ****/
+static void addFunc( const TA_FuncInfo *funcInfo, void *opaqueData )
+{
+   FuncDiff *newArray;
+
+   (void)opaqueData;
+
+   newArray = (FuncDiff *)realloc( funcDiff, (nbFunc+1)*sizeof(FuncDiff) );
+   if( !newArray )
+   {
+      free( funcDiff );
+      funcDiff = NULL;
+      return;
+   }
+
+   funcDiff = newArray;
+   memset( &funcDiff[nbFunc], 0, sizeof(FuncDiff) );
+   funcDiff[nbFunc++].funcInfo = funcInfo;
+}
+
+static ErrorNumber allocSeries( int size )
+{
+   int i, ok;
+
+   nbBar = size;
+   ok = 1;
+
+   for( i=0; i < 5; i++ )
+      ok &= (price[i] = (double *)malloc( nbBar*sizeof(double) )) != NULL;
+
+   for( i=0; i < 3; i++ )
+   {
+      ok &= (priceS[i] = (float *)malloc( nbBar*sizeof(float) )) != NULL;
+      ok &= (roundedPrice[i] = (double *)malloc( nbBar*sizeof(double) )) != NULL;
+   }
+
+   for( i=0; i < DIFF_MAX_OUTPUT; i++ )
+   {
+      ok &= (refReal[i] = (double *)malloc( nbBar*sizeof(double) )) != NULL;
+      ok &= (refInt[i]  = (int *)malloc( nbBar*sizeof(int) )) != NULL;
+      ok &= (altReal[i] = (double *)malloc( nbBar*sizeof(double) )) != NULL;
+      ok &= (altInt[i]  = (int *)malloc( nbBar*sizeof(int) )) != NULL;
+   }
+
+   ok &= (inPlaceBuffer = (double *)malloc( nbBar*sizeof(double) )) != NULL;
+   ok &= (inputInt = (int *)malloc( nbBar*sizeof(int) )) != NULL;
+   ok &= (indices = (int *)malloc( nbBar*sizeof(int) )) != NULL;
+
+   /* Large enough for the whole output of any function. */
+   ok &= TA_ResultCacheAlloc( 4, 0x7FFFFFFF, &resultCache ) == TA_SUCCESS;
+
+   if( !ok )
+   {
+      printf( "Not enough memory for the differential tests (%d bars)\n", nbBar );
+      freeSeries();
+      return TA_DIFF_TST_ALLOC_FAILED;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void freeSeries( void )
+{
+   int i;
+
+   for( i=0; i < 5; i++ )
+   {
+      free( price[i] );
+      price[i] = NULL;
+   }
+
+   for( i=0; i < 3; i++ )
+   {
+      free( priceS[i] );
+      free( roundedPrice[i] );
+      priceS[i] = NULL;
+      roundedPrice[i] = NULL;
+   }
+
+   for( i=0; i < DIFF_MAX_OUTPUT; i++ )
+   {
+      free( refReal[i] );
+      free( refInt[i] );
+      free( altReal[i] );
+      free( altInt[i] );
+      refReal[i] = altReal[i] = NULL;
+      refInt[i] = altInt[i] = NULL;
+   }
+
+   free( inPlaceBuffer );
+   free( inputInt );
+   free( indices );
+   inPlaceBuffer = NULL;
+   inputInt = indices = NULL;
+
+   if( resultCache )
+      TA_ResultCacheFree( resultCache );
+   resultCache = NULL;
+}
+
+/* Same series on every run: the errors can be compared between runs. */
+static double randomUniform( void )
+{
+   /* xorshift64* */
+   randomState ^= randomState >> 12;
+   randomState ^= randomState << 25;
+   randomState ^= randomState >> 27;
+   return (double)((randomState * 2685821657736338717ULL) >> 11) / 9007199254740992.0;
+}
+
+static void makeSeries( ShapeId shape )
+{
+   double *open, *high, *low, *close, *volume;
+   double prevClose, scale;
+   int i, gap;
+
+   open   = price[0];
+   high   = price[1];
+   low    = price[2];
+   close  = price[3];
+   volume = price[4];
+
+   randomState = 0x9E3779B97F4A7C15ULL;
+
+   /* Random walk, the base of most shapes. */
+   prevClose = 100.0;
+   for( i=0; i < nbBar; i++ )
+   {
+      open[i]   = prevClose;
+      close[i]  = prevClose*(1.0+(randomUniform()-0.5)*0.02);
+      high[i]   = (open[i] > close[i]? open[i] : close[i])*(1.0+randomUniform()*0.005);
+      low[i]    = (open[i] < close[i]? open[i] : close[i])*(1.0-randomUniform()*0.005);
+      volume[i] = 1000.0+floor(randomUniform()*9000.0);
+      prevClose = close[i];
+   }
+
+   scale = 1.0;
+   switch( shape )
+   {
+   case SHAPE_RANDOM:
+      break;
+
+   case SHAPE_MONOTONIC:
+      for( i=0; i < nbBar; i++ )
+      {
+         close[i]  = 10.0+i*0.001;
+         open[i]   = close[i]-0.0005;
+         high[i]   = close[i]+0.001;
+         low[i]    = open[i]-0.001;
+         volume[i] = 1000.0+i;
+      }
+      break;
+
+   case SHAPE_CONSTANT:
+      for( i=0; i < nbBar; i++ )
+      {
+         open[i] = high[i] = low[i] = close[i] = 100.0;
+         volume[i] = 1000.0;
+      }
+      break;
+
+   case SHAPE_SPIKES:
+      /* About one bar in a thousand a million times larger or smaller. */
+      for( i=0; i < nbBar; i += gap )
+      {
+         scale = (randomUniform() < 0.5)? 1e6 : 1e-6;
+         open[i] *= scale;
+         high[i] *= scale;
+         low[i] *= scale;
+         close[i] *= scale;
+         volume[i] *= scale;
+         gap = 1+(int)(randomUniform()*2000.0);
+      }
+      scale = 1.0;
+      break;
+
+   case SHAPE_DENORMAL:
+      /* Below DBL_MIN, with less precision. */
+      scale = 1e-310;
+      break;
+
+   case SHAPE_HUGE:
+      /* The sums of squares of the whole series (series index)
+       * still within the range of a double.
+       */
+      scale = 1e100;
+      break;
+
+   case NB_SHAPE:
+      break;
+   }
+
+   if( scale != 1.0 )
+   {
+      for( i=0; i < nbBar; i++ )
+      {
+         open[i] *= scale;
+         high[i] *= scale;
+         low[i] *= scale;
+         close[i] *= scale;
+         volume[i] *= scale;
+      }
+   }
+
+   /* Periods for the integer inputs. */
+   for( i=0; i < nbBar; i++ )
+      inputInt[i] = 2+(int)(randomUniform()*40.0);
+
+   /* Strictly increasing indices, spaced by 1 to 64. The first is
+    * zero: the functions depending on the whole history then have
+    * the same output as the reference.
+    */
+   nbIndices = 0;
+   for( i=0; i < nbBar; i += 1+(int)(randomUniform()*64.0) )
+      indices[nbIndices++] = i;
+
+   /* High, low and close for the TA_S_XXX functions. */
+   for( i=0; i < nbBar; i++ )
+   {
+      priceS[0][i] = (float)high[i];
+      priceS[1][i] = (float)low[i];
+      priceS[2][i] = (float)close[i];
+      roundedPrice[0][i] = priceS[0][i];
+      roundedPrice[1][i] = priceS[1][i];
+      roundedPrice[2][i] = priceS[2][i];
+   }
+}
+
+/* The inputs start at 'offset'. With 'inPlace', the first of them is
+ * a copy in inPlaceBuffer (where the first output will be written).
+ */
+static void setInputs( TA_ParamHolder *params, const TA_FuncInfo *funcInfo,
+                       int offset, int inPlace )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const double *in[6];
+   unsigned int i;
+   int j;
+
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         for( j=0; j < 6; j++ )
+         {
+            in[j] = NULL;
+            if( inputInfo->flags & (TA_IN_PRICE_OPEN<<j) )
+            {
+               /* The open interest is the volume. */
+               in[j] = (j < 5? price[j] : price[4])+offset;
+               if( inPlace )
+               {
+                  memcpy( inPlaceBuffer, in[j], (nbBar-offset)*sizeof(double) );
+                  in[j] = inPlaceBuffer;
+                  inPlace = 0;
+               }
+            }
+         }
+         TA_SetInputParamPricePtr( params, i, in[0], in[1], in[2], in[3], in[4], in[5] );
+         break;
+
+      case TA_Input_Real:
+         in[0] = (i == 0? price[3] : price[0])+offset;
+         if( inPlace )
+         {
+            memcpy( inPlaceBuffer, in[0], (nbBar-offset)*sizeof(double) );
+            in[0] = inPlaceBuffer;
+            inPlace = 0;
+         }
+         TA_SetInputParamRealPtr( params, i, in[0] );
+         break;
+
+      case TA_Input_Integer:
+         TA_SetInputParamIntegerPtr( params, i, inputInt+offset );
+         break;
+      }
+   }
+}
+
+static void setOutputs( TA_ParamHolder *params, const TA_FuncInfo *funcInfo,
+                        double **real, int **integer, int offset )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         TA_SetOutputParamIntegerPtr( params, i, integer[i]+offset );
+      else
+         TA_SetOutputParamRealPtr( params, i, real[i]+offset );
+   }
+}
+
+static void setScale( const TA_FuncInfo *funcInfo, int nbElement )
+{
+   unsigned int i;
+   int k;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      refScale[i] = 0.0;
+      for( k=0; k < nbElement; k++ )
+      {
+         if( (fabs(refReal[i][k]) > refScale[i]) && IS_FINITE(refReal[i][k]) )
+            refScale[i] = fabs(refReal[i][k]);
+      }
+   }
+}
+
+static void compareValue( DiffResult *result, PathId path, ShapeId shape,
+                          double value, double ref, double scale )
+{
+   Int64 a, b;
+   double ulp, relError, magnitude;
+
+   result->nbCompared++;
+
+   if( (value == ref) || ((value != value) && (ref != ref)) )
+      return;
+
+   if( !IS_FINITE(value) || !IS_FINITE(ref) )
+   {
+      result->nbMismatch++;
+      result->worstShape = shape;
+      return;
+   }
+
+   /* Distance in units in the last place, with the doubles
+    * ordered as integers (negative ones reversed).
+    */
+   memcpy( &a, &value, sizeof(a) );
+   memcpy( &b, &ref, sizeof(b) );
+   if( a < 0 )
+      a = (Int64)(0x8000000000000000ULL-(UInt64)a);
+   if( b < 0 )
+      b = (Int64)(0x8000000000000000ULL-(UInt64)b);
+   ulp = fabs( (double)a-(double)b );
+
+   magnitude = fabs(value) > fabs(ref)? fabs(value) : fabs(ref);
+   if( magnitude < scale*pathInfo[path].floor )
+      magnitude = scale*pathInfo[path].floor;
+   relError = fabs(value-ref)/magnitude;
+
+   if( ulp > result->maxUlp )
+      result->maxUlp = ulp;
+
+   if( relError > result->maxRelError )
+      result->maxRelError = relError;
+
+   if( (relError > result->maxGatedRelError) && !illConditioned[shape] )
+   {
+      result->maxGatedRelError = relError;
+      result->worstShape = shape;
+   }
+}
+
+/* Compare the outputs from 'altIdx' with the reference from 'refIdx'. */
+static void compareRange( DiffResult *result, PathId path, ShapeId shape,
+                          const TA_FuncInfo *funcInfo,
+                          double **real, int **integer,
+                          int altIdx, int refIdx, int nbElement )
+{
+   const TA_OutputParameterInfo *outputInfo;
+   unsigned int i;
+   int k;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+      {
+         for( k=0; k < nbElement; k++ )
+         {
+            result->nbCompared++;
+            if( integer[i][altIdx+k] != refInt[i][refIdx+k] )
+            {
+               result->nbMismatch++;
+               result->worstShape = shape;
+            }
+         }
+      }
+      else
+      {
+         for( k=0; k < nbElement; k++ )
+            compareValue( result, path, shape, real[i][altIdx+k], refReal[i][refIdx+k], refScale[i] );
+      }
+   }
+}
+
+static ErrorNumber testFunc( FuncDiff *diff, ShapeId shape )
+{
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   TA_ParamHolder *params;
+   TA_Checkpoint checkpoint;
+   TA_RetCode retCode;
+   DiffResult *result;
+   double *real[DIFF_MAX_OUTPUT];
+   unsigned int i;
+   int k, split, idx, nbSkipped;
+   int refBegIdx, refNbElement, outBegIdx, outNbElement;
+   ErrorNumber retValue;
+
+   funcInfo = diff->funcInfo;
+   if( funcInfo->nbOutput > DIFF_MAX_OUTPUT )
+   {
+      printf( "%s has too many outputs for the differential tests\n", funcInfo->name );
+      return TA_DIFF_TST_ALLOC_FAILED;
+   }
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &params );
+   if( retCode != TA_SUCCESS )
+      return TA_DIFF_TST_ALLOC_FAILED;
+
+   /* Reference. */
+   setInputs( params, funcInfo, 0, 0 );
+   setOutputs( params, funcInfo, refReal, refInt, 0 );
+   retCode = TA_CallFunc( params, 0, nbBar-1, &refBegIdx, &refNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "%s failed on the %s series [%d]\n", funcInfo->name, shapeName[shape], retCode );
+      TA_ParamHolderFree( params );
+      return TA_DIFF_TST_REF_CALLFUNC;
+   }
+   setScale( funcInfo, refNbElement );
+
+   #define CHECK_PATH(pathId,ok) \
+   { \
+      if( retCode != TA_SUCCESS ) \
+      { \
+         printf( "%s %s failed on the %s series [%d]\n", funcInfo->name, \
+                 pathInfo[pathId].name, shapeName[shape], retCode ); \
+         TA_ParamHolderFree( params ); \
+         return TA_DIFF_TST_PATH_CALLFUNC; \
+      } \
+      if( !(ok) ) \
+      { \
+         diff->path[pathId].nbMismatch++; \
+         diff->path[pathId].worstShape = shape; \
+      } \
+   }
+
+   /* Aligned output. */
+   result = &diff->path[PATH_ALIGNED];
+   setOutputs( params, funcInfo, altReal, altInt, 0 );
+   retCode = TA_CallFuncAligned( params, 0, nbBar-1, &outBegIdx, &outNbElement );
+   CHECK_PATH( PATH_ALIGNED, (outBegIdx == refBegIdx) && (outNbElement == refNbElement) );
+   compareRange( result, PATH_ALIGNED, shape, funcInfo, altReal, altInt, refBegIdx, 0, refNbElement );
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      for( k=0; k < refBegIdx; k++ )
+      {
+         if( (outputInfo->type == TA_Output_Integer)? (altInt[i][k] != TA_INTEGER_DEFAULT) :
+                                                      (altReal[i][k] == altReal[i][k]) )
+         {
+            result->nbMismatch++;
+            result->worstShape = shape;
+         }
+      }
+   }
+
+   /* First output over the first input. */
+   TA_GetOutputParameterInfo( funcInfo->handle, 0, &outputInfo );
+   if( (funcInfo->flags & TA_FUNC_FLG_INPLACE) && (outputInfo->type == TA_Output_Real) )
+   {
+      setInputs( params, funcInfo, 0, 1 );
+      setOutputs( params, funcInfo, altReal, altInt, 0 );
+      TA_SetOutputParamRealPtr( params, 0, inPlaceBuffer );
+      retCode = TA_CallFunc( params, 0, nbBar-1, &outBegIdx, &outNbElement );
+      CHECK_PATH( PATH_INPLACE, (outBegIdx == refBegIdx) && (outNbElement == refNbElement) );
+      for( i=0; i < DIFF_MAX_OUTPUT; i++ )
+         real[i] = (i == 0)? inPlaceBuffer : altReal[i];
+      compareRange( &diff->path[PATH_INPLACE], PATH_INPLACE, shape, funcInfo, real, altInt, 0, 0, refNbElement );
+      setInputs( params, funcInfo, 0, 0 );
+   }
+
+   /* Sampled indices. */
+   setOutputs( params, funcInfo, altReal, altInt, 0 );
+   retCode = TA_CallFuncAtIndices( params, indices, nbIndices, &outBegIdx, &outNbElement );
+   for( nbSkipped=0; (nbSkipped < nbIndices) && (indices[nbSkipped] < refBegIdx); nbSkipped++ )
+      ;
+   CHECK_PATH( PATH_INDICES, (outBegIdx == nbSkipped) && (outNbElement == nbIndices-nbSkipped) );
+   if( outBegIdx == nbSkipped )
+   {
+      for( k=0; k < outNbElement; k++ )
+      {
+         idx = indices[outBegIdx+k]-refBegIdx;
+         compareRange( &diff->path[PATH_INDICES], PATH_INDICES, shape, funcInfo, altReal, altInt, k, idx, 1 );
+      }
+   }
+
+   /* Result cache: the first 60% of the bars, then extended to all. */
+   split = nbBar/5*3;
+   TA_ResultCacheClear( resultCache );
+   TA_SetParamHolderCache( params, resultCache, 1, (unsigned int)shape );
+   retCode = TA_CallFunc( params, 0, split-1, &outBegIdx, &outNbElement );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_CallFunc( params, 0, nbBar-1, &outBegIdx, &outNbElement );
+   TA_SetParamHolderCache( params, NULL, 0, 0 );
+   CHECK_PATH( PATH_CACHE, (outBegIdx == refBegIdx) && (outNbElement == refNbElement) );
+   compareRange( &diff->path[PATH_CACHE], PATH_CACHE, shape, funcInfo, altReal, altInt, 0, 0, refNbElement );
+
+   /* Series index, for the functions on a single series. */
+   TA_GetInputParameterInfo( funcInfo->handle, 0, &inputInfo );
+   if( (funcInfo->nbInput == 1) && (inputInfo->type == TA_Input_Real) )
+   {
+      split = nbBar < DIFF_MAX_INDEX_BAR? nbBar : DIFF_MAX_INDEX_BAR;
+      retCode = TA_SUCCESS;
+      if( !seriesIndex )
+         retCode = TA_SeriesIndexAlloc( price[3], split, &seriesIndex );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_SetInputParamSeriesIndex( params, 0, seriesIndex );
+      if( retCode == TA_SUCCESS )
+         retCode = TA_CallFunc( params, 0, split-1, &outBegIdx, &outNbElement );
+      CHECK_PATH( PATH_INDEX, outBegIdx == refBegIdx );
+      if( outBegIdx == refBegIdx )
+         compareRange( &diff->path[PATH_INDEX], PATH_INDEX, shape, funcInfo, altReal, altInt, 0, 0, outNbElement );
+      setInputs( params, funcInfo, 0, 0 );
+   }
+
+   /* Checkpoint at 60% of the bars, resumed for the others. */
+   split = nbBar/5*3;
+   retCode = TA_CallFuncCheckpoint( params, 0, split-1, &outBegIdx, &outNbElement, &checkpoint );
+   if( (retCode == TA_SUCCESS) && (outBegIdx == refBegIdx) )
+   {
+      setInputs( params, funcInfo, split, 0 );
+      setOutputs( params, funcInfo, altReal, altInt, split-refBegIdx );
+      retCode = TA_CallFuncResume( params, &checkpoint, nbBar-split, &outNbElement, &checkpoint );
+      CHECK_PATH( PATH_CHECKPOINT, outNbElement == nbBar-split );
+      compareRange( &diff->path[PATH_CHECKPOINT], PATH_CHECKPOINT, shape, funcInfo, altReal, altInt, 0, 0, refNbElement );
+      setInputs( params, funcInfo, 0, 0 );
+   }
+   else if( (retCode != TA_NOT_SUPPORTED) && (retCode != TA_OUT_OF_RANGE_END_INDEX) )
+      CHECK_PATH( PATH_CHECKPOINT, 0 );
+
+   #undef CHECK_PATH
+
+   /* Last, it replaces the reference by one call per segment. */
+   retValue = testSegments( diff, shape, params );
+
+   TA_ParamHolderFree( params );
+
+   return retValue;
+}
+
+static ErrorNumber testSegments( FuncDiff *diff, ShapeId shape, TA_ParamHolder *params )
+{
+   #define MAX_SEGMENT 40
+   const TA_FuncInfo *funcInfo;
+   TA_RetCode retCode;
+   int segmentOffsets[MAX_SEGMENT+1];
+   int refBegIdx[MAX_SEGMENT], refNbElement[MAX_SEGMENT];
+   int outBegIdx[MAX_SEGMENT], outNbElement[MAX_SEGMENT];
+   int nbSegment, s, length;
+
+   funcInfo = diff->funcInfo;
+
+   /* Of all lengths, from empty to a third of the bars. */
+   nbSegment = 0;
+   segmentOffsets[0] = 0;
+   while( (nbSegment < MAX_SEGMENT-1) && (segmentOffsets[nbSegment] < nbBar) )
+   {
+      length = (int)(randomUniform()*randomUniform()*(nbBar/3));
+      if( length > nbBar-segmentOffsets[nbSegment] )
+         length = nbBar-segmentOffsets[nbSegment];
+      segmentOffsets[nbSegment+1] = segmentOffsets[nbSegment]+length;
+      nbSegment++;
+   }
+   segmentOffsets[nbSegment+1] = nbBar;
+   nbSegment++;
+
+   /* Reference: one call per segment. */
+   for( s=0; s < nbSegment; s++ )
+   {
+      refBegIdx[s] = refNbElement[s] = 0;
+      if( segmentOffsets[s+1] == segmentOffsets[s] )
+         continue;
+      setInputs( params, funcInfo, segmentOffsets[s], 0 );
+      setOutputs( params, funcInfo, refReal, refInt, segmentOffsets[s] );
+      retCode = TA_CallFunc( params, 0, segmentOffsets[s+1]-segmentOffsets[s]-1,
+                             &refBegIdx[s], &refNbElement[s] );
+      if( retCode != TA_SUCCESS )
+      {
+         printf( "%s failed on a segment of the %s series [%d]\n", funcInfo->name,
+                 shapeName[shape], retCode );
+         return TA_DIFF_TST_REF_CALLFUNC;
+      }
+   }
+
+   setInputs( params, funcInfo, 0, 0 );
+   setOutputs( params, funcInfo, altReal, altInt, 0 );
+   retCode = TA_CallFuncSegments( params, segmentOffsets, nbSegment, outBegIdx, outNbElement );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "%s segments failed on the %s series [%d]\n", funcInfo->name,
+              shapeName[shape], retCode );
+      return TA_DIFF_TST_PATH_CALLFUNC;
+   }
+
+   for( s=0; s < nbSegment; s++ )
+   {
+      if( (outBegIdx[s] != refBegIdx[s]) || (outNbElement[s] != refNbElement[s]) )
+      {
+         diff->path[PATH_SEGMENTS].nbMismatch++;
+         diff->path[PATH_SEGMENTS].worstShape = shape;
+      }
+      else
+      {
+         compareRange( &diff->path[PATH_SEGMENTS], PATH_SEGMENTS, shape, funcInfo, altReal, altInt,
+                       segmentOffsets[s], segmentOffsets[s], outNbElement[s] );
+      }
+   }
+
+   #undef MAX_SEGMENT
+   return TA_TEST_PASS;
+}
+
+/* The TA_S_XXX functions compared with the TA_XXX functions on the
+ * same values. Not for the shapes out of the range of a float.
+ */
+static ErrorNumber testFloat( ShapeId shape )
+{
+   TA_RetCode retCode, refRetCode;
+   int i, j, begIdx, nbElement, refBegIdx, refNbElement;
+
+   if( (shape == SHAPE_DENORMAL) || (shape == SHAPE_HUGE) )
+      return TA_TEST_PASS;
+
+   for( i=0; i < NB_ELEMENT(periodFunc); i++ )
+   {
+      for( j=0; j < NB_ELEMENT(floatPeriod); j++ )
+      {
+         refRetCode = periodFunc[i].func( 0, nbBar-1, roundedPrice[2], floatPeriod[j],
+                                          &refBegIdx, &refNbElement, refReal[0] );
+         retCode = periodFunc[i].funcS( 0, nbBar-1, priceS[2], floatPeriod[j],
+                                        &begIdx, &nbElement, altReal[0] );
+         compareFloat( periodFunc[i].name, shape, retCode, begIdx, nbElement,
+                       refRetCode, refBegIdx, refNbElement );
+      }
+   }
+
+   for( i=0; i < NB_ELEMENT(transformFunc); i++ )
+   {
+      refRetCode = transformFunc[i].func( 0, nbBar-1, roundedPrice[2],
+                                          &refBegIdx, &refNbElement, refReal[0] );
+      retCode = transformFunc[i].funcS( 0, nbBar-1, priceS[2],
+                                        &begIdx, &nbElement, altReal[0] );
+      compareFloat( transformFunc[i].name, shape, retCode, begIdx, nbElement,
+                    refRetCode, refBegIdx, refNbElement );
+   }
+
+   for( i=0; i < NB_ELEMENT(hlcPeriodFunc); i++ )
+   {
+      for( j=0; j < NB_ELEMENT(floatPeriod); j++ )
+      {
+         refRetCode = hlcPeriodFunc[i].func( 0, nbBar-1, roundedPrice[0], roundedPrice[1],
+                                             roundedPrice[2], floatPeriod[j],
+                                             &refBegIdx, &refNbElement, refReal[0] );
+         retCode = hlcPeriodFunc[i].funcS( 0, nbBar-1, priceS[0], priceS[1], priceS[2],
+                                           floatPeriod[j], &begIdx, &nbElement, altReal[0] );
+         compareFloat( hlcPeriodFunc[i].name, shape, retCode, begIdx, nbElement,
+                       refRetCode, refBegIdx, refNbElement );
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+static void compareFloat( const char *name, ShapeId shape,
+                          TA_RetCode retCode, int begIdx, int nbElement,
+                          TA_RetCode refRetCode, int refBegIdx, int refNbElement )
+{
+   DiffResult *result;
+   FuncDiff *diff;
+   int k;
+
+   diff = findFunc( name );
+   if( !diff )
+      return;
+
+   result = &diff->path[PATH_FLOAT];
+   if( (retCode != refRetCode) || (begIdx != refBegIdx) || (nbElement != refNbElement) )
+   {
+      result->nbCompared++;
+      result->nbMismatch++;
+      result->worstShape = shape;
+      return;
+   }
+
+   refScale[0] = 0.0;
+   for( k=0; k < refNbElement; k++ )
+   {
+      if( (fabs(refReal[0][k]) > refScale[0]) && IS_FINITE(refReal[0][k]) )
+         refScale[0] = fabs(refReal[0][k]);
+   }
+
+   for( k=0; k < nbElement; k++ )
+      compareValue( result, PATH_FLOAT, shape, altReal[0][k], refReal[0][k], refScale[0] );
+}
+
+static FuncDiff *findFunc( const char *name )
+{
+   unsigned int i;
+
+   for( i=0; i < nbFunc; i++ )
+   {
+      if( strcmp( funcDiff[i].funcInfo->name, name ) == 0 )
+         return &funcDiff[i];
+   }
+
+   return NULL;
+}
+
+/* Print the failures (and all the errors with doReport). */
+static ErrorNumber checkGates( int doReport )
+{
+   const DiffResult *result;
+   DiffResult worst[NB_PATH];
+   ErrorNumber retValue;
+   double maxUlp;
+   unsigned int i;
+   int path, fail, funcFail;
+
+   if( doReport )
+   {
+      printf( "\nLargest relative error of each path (- when not tested, 0 when identical):\n\n" );
+      printf( "%-20s", "Function" );
+      for( path=0; path < NB_PATH; path++ )
+         printf( " %9s", pathInfo[path].name );
+      printf( " %9s\n", "max ULP" );
+   }
+
+   memset( worst, 0, sizeof(worst) );
+   for( i=0; i < nbFunc; i++ )
+   {
+      if( doReport )
+         printf( "%-20s", funcDiff[i].funcInfo->name );
+
+      maxUlp = 0.0;
+      funcFail = 0;
+      for( path=0; path < NB_PATH; path++ )
+      {
+         result = &funcDiff[i].path[path];
+         fail = (result->nbMismatch > 0) || (result->maxGatedRelError > pathInfo[path].maxRelError);
+
+         if( doReport )
+         {
+            if( result->nbCompared == 0 )
+               printf( " %9s", "-" );
+            else if( result->nbMismatch > 0 )
+               printf( " %9s", "MISMATCH" );
+            else if( result->maxRelError == 0.0 )
+               printf( " %9s", "0" );
+            else
+               printf( " %9.2e", result->maxRelError );
+         }
+
+         if( result->maxUlp > maxUlp )
+            maxUlp = result->maxUlp;
+
+         if( result->maxUlp > worst[path].maxUlp )
+            worst[path].maxUlp = result->maxUlp;
+         if( result->maxRelError > worst[path].maxRelError )
+            worst[path].maxRelError = result->maxRelError;
+         if( result->maxGatedRelError > worst[path].maxGatedRelError )
+            worst[path].maxGatedRelError = result->maxGatedRelError;
+         worst[path].nbCompared += result->nbCompared;
+         worst[path].nbMismatch += result->nbMismatch;
+
+         if( fail )
+            funcFail = 1;
+      }
+
+      if( doReport )
+         printf( " %9.3g%s\n", maxUlp, funcFail? "  FAILED" : "" );
+   }
+
+   if( doReport )
+   {
+      printf( "\n%-10s %14s %10s %12s %12s %12s %8s\n", "Path", "Values", "Mismatch",
+              "Max ULP", "Max rel.err", "Gated error", "Gate" );
+      for( path=0; path < NB_PATH; path++ )
+      {
+         printf( "%-10s %14.0f %10u %12.3g %12.3g %12.3g %8.0e  %s\n", pathInfo[path].name,
+                 (double)worst[path].nbCompared, worst[path].nbMismatch,
+                 worst[path].maxUlp, worst[path].maxRelError, worst[path].maxGatedRelError,
+                 pathInfo[path].maxRelError,
+                 ((worst[path].nbMismatch > 0) || (worst[path].maxGatedRelError > pathInfo[path].maxRelError))?
+                 "FAILED" : "ok" );
+      }
+      printf( "\n" );
+   }
+
+   /* The failures after the tables. */
+   retValue = TA_TEST_PASS;
+   for( i=0; i < nbFunc; i++ )
+   {
+      for( path=0; path < NB_PATH; path++ )
+      {
+         result = &funcDiff[i].path[path];
+         if( (result->nbMismatch > 0) || (result->maxGatedRelError > pathInfo[path].maxRelError) )
+         {
+            printf( "Differential test failed: %s %s on the %s series (%u mismatch, relative error %g)\n",
+                    funcDiff[i].funcInfo->name, pathInfo[path].name,
+                    shapeName[result->worstShape], result->nbMismatch, result->maxGatedRelError );
+            retValue = TA_DIFF_TST_GATE;
+         }
+      }
+   }
+
+   return retValue;
+}
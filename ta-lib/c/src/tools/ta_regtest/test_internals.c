@@ -36,6 +36,7 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
+ *  AG       agent <agent@local>
  *
  *
  * Change history:
@@ -47,11 +48,14 @@
  *  080605 MF   Add tests for pseudo-random generator.
  *  091705 MF   Add tests for TA_AddTimeToTimestamp (Fix#1293953).
  *  110906 MF   Remove pseudo-random to eliminate dependencies.
+ *  101826 AG   Add tests for TA_BarBuilder and TA_BarQueue.
+ *  101826 AG   Add a producer/consumer test of TA_BarQueue.
  */
 
 /* Description:
  *         Regression testing of some internal utility like: 
  *            - collections: List/Stack/Circular buffer.
+ *            - Bar builder and bar queue.
  *            - Memory allocation mechanism.
  *            etc...
  */
@@ -60,6 +64,13 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined( WIN32 )
+   #include <windows.h>
+#else
+   #include <pthread.h>
+   #include <sched.h>
+#endif
+
 #include "ta_test_priv.h"
 #include "ta_memory.h"
 #include "ta_defs.h"
@@ -76,10 +87,38 @@
 /* None */
 
 /**** Local declarations.              ****/
-/* None */
+
+/* Producer thread of the bar queue stress test. */
+typedef struct
+{
+   TA_BarQueue *queue;
+   int nbBar;
+   volatile ErrorNumber retValue;
+} QueueProducer;
+
+#define NB_STRESS_BAR     2000000
+#define STRESS_CAPACITY   64
+#define STRESS_HISTORY    16
+
+#if defined( WIN32 )
+   #define THREAD_FUNC  DWORD WINAPI
+   #define THREAD_YIELD Sleep(0)
+#else
+   #define THREAD_FUNC  void *
+   #define THREAD_YIELD sched_yield()
+#endif
 
 /**** Local functions declarations.    ****/
 static ErrorNumber testCircularBuffer( void );
+static ErrorNumber testBarBuilder( void );
+static ErrorNumber checkBar( const TA_Bars *bars, int idx, Int64 timestamp,
+                             double open, double high, double low,
+                             double close, double volume );
+static ErrorNumber testBarQueue( void );
+static ErrorNumber checkQueueBars( const TA_BarQueue *queue,
+                                   int nbBar, int firstBar );
+static ErrorNumber testBarQueueThreads( void );
+static THREAD_FUNC queueProducer( void *arg );
 
 static TA_RetCode circBufferFillFrom0ToSize( int size, int *buffer );
 
@@ -104,6 +143,27 @@ ErrorNumber test_internals( void )
       return retValue;
    }
 
+   retValue = testBarBuilder();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Bar builder tests (%d)\n", retValue );
+      return retValue;
+   }
+
+   retValue = testBarQueue();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Bar queue tests (%d)\n", retValue );
+      return retValue;
+   }
+
+   retValue = testBarQueueThreads();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Bar queue producer/consumer tests (%d)\n", retValue );
+      return retValue;
+   }
+
    return TA_TEST_PASS; /* Success. */
 }
 
@@ -272,3 +332,498 @@ static TA_RetCode circBufferFillFrom0ToSize( int size, int *buffer )
 
    return TA_SUCCESS;
 }
+
+static ErrorNumber testBarBuilder( void )
+{
+   /* No trade from 1100 to 1199. */
+   static const Int64 timeBarTimestamp[8] = { 1000, 1020, 1040, 1060, 1080, 1250, 1260, 1330 };
+
+   TA_RetCode retCode;
+   TA_BarBuilder *builder;
+   TA_Bars bars;
+   ErrorNumber retValue;
+   Int64 timestamp[40];
+   double price[40], size[40];
+   int i, nbNewBar;
+
+   retValue = allocLib();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Can't initialize the library\n" );
+      return retValue;
+   }
+
+   for( i=0; i < 40; i++ )
+   {
+      timestamp[i] = 1000+i*20;
+      price[i]     = (i%7)+10.0;
+      size[i]      = (i%3)+1.0;
+   }
+
+   /* Tick bars of 3 trades, only the last 4 bars kept. */
+   retCode = TA_BarBuilderAlloc( TA_BAR_TICK, 3.0, 4, &builder );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFailed TA_BarBuilderAlloc RetCode = %d\n", retCode );
+      return TA_INTERNAL_BAR_BUILDER_ALLOC;
+   }
+
+   retCode = TA_BarBuilderAdd( builder, 10, timestamp, price, size, &nbNewBar );
+   if( (retCode != TA_SUCCESS) || (nbNewBar != 3) )
+   {
+      printf( "\nFailed TA_BarBuilderAdd RetCode = %d (%d bars)\n", retCode, nbNewBar );
+      TA_BarBuilderFree( builder );
+      return TA_INTERNAL_BAR_BUILDER_ADD;
+   }
+
+   TA_BarBuilderGetBars( builder, &bars );
+   retValue = TA_TEST_PASS;
+   if( (bars.nbBar != 3) || (bars.firstBar != 0) )
+      retValue = TA_INTERNAL_BAR_BUILDER_VALUE;
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 0, 1000, 10.0, 12.0, 10.0, 12.0, 6.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 2, 1120, 16.0, 16.0, 10.0, 11.0, 6.0 );
+
+   /* The oldest bars are dropped, the last ones stay contiguous. */
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarBuilderAdd( builder, 30, &timestamp[10], &price[10], &size[10], &nbNewBar );
+      if( (retCode != TA_SUCCESS) || (nbNewBar != 10) )
+         retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+   }
+   if( retValue == TA_TEST_PASS )
+   {
+      TA_BarBuilderGetBars( builder, &bars );
+      if( (bars.nbBar != 4) || (bars.firstBar != 9) )
+         retValue = TA_INTERNAL_BAR_BUILDER_VALUE;
+   }
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 0, 1540, 16.0, 16.0, 10.0, 11.0, 6.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 3, 1720, 11.0, 13.0, 11.0, 13.0, 6.0 );
+
+   /* The last trade is in a bar closed by the flush. */
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarBuilderFlush( builder, &nbNewBar );
+      TA_BarBuilderGetBars( builder, &bars );
+      if( (retCode != TA_SUCCESS) || (nbNewBar != 1) || (bars.firstBar != 10) )
+         retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+   }
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 3, 1780, 14.0, 14.0, 14.0, 14.0, 1.0 );
+
+   /* Trades must be in chronological order. */
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarBuilderAdd( builder, 1, timestamp, price, size, &nbNewBar );
+      if( retCode != TA_BAD_PARAM )
+         retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+   }
+
+   TA_BarBuilderFree( builder );
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed tick bars\n" );
+      return retValue;
+   }
+
+   /* Time bars of 100, starting at the multiples of 100. */
+   retCode = TA_BarBuilderAlloc( TA_BAR_TIME, 100.0, 10, &builder );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_BAR_BUILDER_ALLOC;
+   retCode = TA_BarBuilderAdd( builder, 8, timeBarTimestamp, price, size, &nbNewBar );
+   TA_BarBuilderGetBars( builder, &bars );
+   if( (retCode != TA_SUCCESS) || (nbNewBar != 2) || (bars.nbBar != 2) )
+      retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 0, 1000, 10.0, 14.0, 10.0, 14.0, 9.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 1, 1200, 15.0, 16.0, 15.0, 16.0, 4.0 );
+   TA_BarBuilderFree( builder );
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed time bars\n" );
+      return retValue;
+   }
+
+   /* Volume bars closing when 5 is reached, and dollar bars. */
+   retCode = TA_BarBuilderAlloc( TA_BAR_VOLUME, 5.0, 10, &builder );
+   if( retCode != TA_SUCCESS )
+      return TA_INTERNAL_BAR_BUILDER_ALLOC;
+   retCode = TA_BarBuilderAdd( builder, 6, timestamp, price, size, &nbNewBar );
+   TA_BarBuilderGetBars( builder, &bars );
+   if( (retCode != TA_SUCCESS) || (nbNewBar != 2) )
+      retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 0, 1000, 10.0, 12.0, 10.0, 12.0, 6.0 );
+   if( retValue == TA_TEST_PASS )
+      retValue = checkBar( &bars, 1, 1060, 13.0, 15.0, 13.0, 15.0, 6.0 );
+   TA_BarBuilderFree( builder );
+
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarBuilderAlloc( TA_BAR_DOLLAR, 50.0, 10, &builder );
+      if( retCode != TA_SUCCESS )
+         return TA_INTERNAL_BAR_BUILDER_ALLOC;
+      retCode = TA_BarBuilderAdd( builder, 3, timestamp, price, size, &nbNewBar );
+      TA_BarBuilderGetBars( builder, &bars );
+      if( (retCode != TA_SUCCESS) || (nbNewBar != 1) )
+         retValue = TA_INTERNAL_BAR_BUILDER_ADD;
+      if( retValue == TA_TEST_PASS )
+         retValue = checkBar( &bars, 0, 1000, 10.0, 12.0, 10.0, 12.0, 6.0 );
+      TA_BarBuilderFree( builder );
+   }
+
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed volume/dollar bars\n" );
+      return retValue;
+   }
+
+   if( TA_BarBuilderAlloc( TA_BAR_TICK, 0.0, 10, &builder ) != TA_BAD_PARAM )
+      return TA_INTERNAL_BAR_BUILDER_ALLOC;
+
+   retValue = freeLib();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber checkBar( const TA_Bars *bars, int idx, Int64 timestamp,
+                             double open, double high, double low,
+                             double close, double volume )
+{
+   if( (bars->timestamp[idx] != timestamp) ||
+       (bars->open[idx] != open) || (bars->high[idx] != high) ||
+       (bars->low[idx] != low) || (bars->close[idx] != close) ||
+       (bars->volume[idx] != volume) )
+   {
+      printf( "\nWrong bar %d: %d %g %g %g %g %g\n", idx,
+              (int)bars->timestamp[idx], bars->open[idx], bars->high[idx],
+              bars->low[idx], bars->close[idx], bars->volume[idx] );
+      return TA_INTERNAL_BAR_BUILDER_VALUE;
+   }
+
+   return TA_TEST_PASS;
+}
+
+static ErrorNumber testBarQueue( void )
+{
+   TA_RetCode retCode;
+   TA_BarQueue *queue;
+   ErrorNumber retValue;
+   Int64 timestamp[40];
+   double open[40], high[40], low[40], close[40], volume[40];
+   int i, nbBar, nbPushed, nbNewBar;
+
+   retValue = allocLib();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Can't initialize the library\n" );
+      return retValue;
+   }
+
+   /* Bar 'i' is recognized by its values (see checkQueueBars). */
+   for( i=0; i < 40; i++ )
+   {
+      timestamp[i] = 1000+i*60;
+      open[i]      = i;
+      high[i]      = i+2.0;
+      low[i]       = i-1.0;
+      close[i]     = i+1.0;
+      volume[i]    = 1.0;
+   }
+
+   /* Capacity is rounded up to 8 bars, only the last 6 bars kept. */
+   retCode = TA_BarQueueAlloc( 5, 6, &queue );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFailed TA_BarQueueAlloc RetCode = %d\n", retCode );
+      return TA_INTERNAL_BAR_QUEUE_ALLOC;
+   }
+
+   /* Queue full after 8 bars. */
+   retCode = TA_BarQueuePush( queue, 10, timestamp, open, high, low, close, volume, &nbPushed );
+   if( (retCode != TA_SUCCESS) || (nbPushed != 8) )
+   {
+      printf( "\nFailed TA_BarQueuePush RetCode = %d (%d bars)\n", retCode, nbPushed );
+      TA_BarQueueFree( queue );
+      return TA_INTERNAL_BAR_QUEUE_PUSH;
+   }
+
+   retCode = TA_BarQueuePop( queue, 3, &nbNewBar );
+   if( (retCode != TA_SUCCESS) || (nbNewBar != 3) )
+      retValue = TA_INTERNAL_BAR_QUEUE_POP;
+   if( retValue == TA_TEST_PASS )
+      retValue = checkQueueBars( queue, 3, 0 );
+
+   /* Only 3 free slots, then the history wraps around. */
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarQueuePush( queue, 6, &timestamp[8], &open[8], &high[8],
+                                 &low[8], &close[8], &volume[8], &nbPushed );
+      if( (retCode != TA_SUCCESS) || (nbPushed != 3) )
+         retValue = TA_INTERNAL_BAR_QUEUE_PUSH;
+   }
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarQueuePop( queue, 100, &nbNewBar );
+      if( (retCode != TA_SUCCESS) || (nbNewBar != 8) )
+         retValue = TA_INTERNAL_BAR_QUEUE_POP;
+   }
+   if( retValue == TA_TEST_PASS )
+      retValue = checkQueueBars( queue, 6, 5 );
+
+   /* Empty queue. */
+   if( retValue == TA_TEST_PASS )
+   {
+      retCode = TA_BarQueuePop( queue, 100, &nbNewBar );
+      if( (retCode != TA_SUCCESS) || (nbNewBar != 0) )
+         retValue = TA_INTERNAL_BAR_QUEUE_POP;
+   }
+
+   /* Many turns of the ring. */
+   nbBar = 11;
+   for( i=0; (i < 50) && (retValue == TA_TEST_PASS); i++ )
+   {
+      retCode = TA_BarQueuePush( queue, 5, &timestamp[nbBar%30], &open[nbBar%30],
+                                 &high[nbBar%30], &low[nbBar%30], &close[nbBar%30],
+                                 &volume[nbBar%30], &nbPushed );
+      if( (retCode != TA_SUCCESS) || (nbPushed != 5) )
+         retValue = TA_INTERNAL_BAR_QUEUE_PUSH;
+      else
+      {
+         retCode = TA_BarQueuePop( queue, 5, &nbNewBar );
+         if( (retCode != TA_SUCCESS) || (nbNewBar != 5) )
+            retValue = TA_INTERNAL_BAR_QUEUE_POP;
+      }
+      nbBar += 5;
+   }
+   if( retValue == TA_TEST_PASS )
+   {
+      /* Last pushes were the bars 11 to 15 then 16 to 20. */
+      retValue = checkQueueBars( queue, 6, 15 );
+   }
+
+   TA_BarQueueFree( queue );
+
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed bar queue\n" );
+      return retValue;
+   }
+
+   if( TA_BarQueueAlloc( 0, 10, &queue ) != TA_BAD_PARAM )
+      return TA_INTERNAL_BAR_QUEUE_ALLOC;
+
+   retValue = freeLib();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   return TA_TEST_PASS;
+}
+
+/* Verify that the history has 'nbBar' bars starting with the bar
+ * 'firstBar' of the test data.
+ */
+static ErrorNumber checkQueueBars( const TA_BarQueue *queue,
+                                   int nbBar, int firstBar )
+{
+   TA_Bars bars;
+   int i, k;
+
+   if( (TA_BarQueueGetBars( queue, &bars ) != TA_SUCCESS) ||
+       (bars.nbBar != nbBar) )
+   {
+      printf( "\nWrong number of bars %d\n", bars.nbBar );
+      return TA_INTERNAL_BAR_QUEUE_VALUE;
+   }
+
+   for( i=0; i < nbBar; i++ )
+   {
+      k = firstBar+i;
+      if( (bars.timestamp[i] != 1000+k*60) || (bars.open[i] != k) ||
+          (bars.high[i] != k+2.0) || (bars.low[i] != k-1.0) ||
+          (bars.close[i] != k+1.0) || (bars.volume[i] != 1.0) )
+      {
+         printf( "\nWrong bar %d (expected %d)\n", i, k );
+         return TA_INTERNAL_BAR_QUEUE_VALUE;
+      }
+   }
+
+   return TA_TEST_PASS;
+}
+
+/* A producer thread pushes NB_STRESS_BAR bars in batches of varying
+ * sizes while this thread pops them, also in varying sizes. Bar 'n'
+ * has the values of checkQueueBars: every history must be the
+ * bars just before the next expected one, without gap, duplicate
+ * or torn bar.
+ */
+static ErrorNumber testBarQueueThreads( void )
+{
+   TA_RetCode retCode;
+   TA_BarQueue *queue;
+   TA_Bars bars;
+   QueueProducer producer;
+   ErrorNumber retValue;
+   int i, k, nbNewBar, nextBar, maxBar;
+   #if defined( WIN32 )
+      HANDLE thread;
+   #else
+      pthread_t thread;
+   #endif
+
+   retValue = allocLib();
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed: Can't initialize the library\n" );
+      return retValue;
+   }
+
+   retCode = TA_BarQueueAlloc( STRESS_CAPACITY, STRESS_HISTORY, &queue );
+   if( retCode != TA_SUCCESS )
+   {
+      printf( "\nFailed TA_BarQueueAlloc RetCode = %d\n", retCode );
+      return TA_INTERNAL_BAR_QUEUE_ALLOC;
+   }
+
+   producer.queue    = queue;
+   producer.nbBar    = NB_STRESS_BAR;
+   producer.retValue = TA_TEST_PASS;
+
+   #if defined( WIN32 )
+      thread = CreateThread( NULL, 0, queueProducer, &producer, 0, NULL );
+      if( thread == NULL )
+   #else
+      if( pthread_create( &thread, NULL, queueProducer, &producer ) != 0 )
+   #endif
+   {
+      printf( "\nFailed to create the producer thread\n" );
+      TA_BarQueueFree( queue );
+      return TA_INTERNAL_BAR_QUEUE_PUSH;
+   }
+
+   nextBar = 0;
+   maxBar  = 1;
+   while( (nextBar < NB_STRESS_BAR) && (retValue == TA_TEST_PASS) )
+   {
+      retCode = TA_BarQueuePop( queue, maxBar, &nbNewBar );
+      if( (retCode != TA_SUCCESS) || (nbNewBar < 0) || (nbNewBar > maxBar) )
+      {
+         printf( "\nFailed TA_BarQueuePop RetCode = %d (%d bars)\n", retCode, nbNewBar );
+         retValue = TA_INTERNAL_BAR_QUEUE_POP;
+         break;
+      }
+
+      if( nbNewBar == 0 )
+      {
+         if( producer.retValue != TA_TEST_PASS )
+            break;
+         THREAD_YIELD;
+         continue;
+      }
+
+      nextBar += nbNewBar;
+      if( (TA_BarQueueGetBars( queue, &bars ) != TA_SUCCESS) ||
+          (bars.nbBar != ((nextBar < STRESS_HISTORY)? nextBar : STRESS_HISTORY)) )
+      {
+         printf( "\nWrong number of bars %d after bar %d\n", bars.nbBar, nextBar );
+         retValue = TA_INTERNAL_BAR_QUEUE_VALUE;
+         break;
+      }
+
+      for( i=0; i < bars.nbBar; i++ )
+      {
+         k = nextBar-bars.nbBar+i;
+         if( (bars.timestamp[i] != 1000+(Int64)k*60) || (bars.open[i] != k) ||
+             (bars.high[i] != k+2.0) || (bars.low[i] != k-1.0) ||
+             (bars.close[i] != k+1.0) || (bars.volume[i] != 1.0) )
+         {
+            printf( "\nWrong bar %d (expected %d)\n", i, k );
+            retValue = TA_INTERNAL_BAR_QUEUE_VALUE;
+            break;
+         }
+      }
+
+      maxBar = (maxBar%STRESS_HISTORY)+1;
+   }
+
+   /* On failure, the producer may wait for room forever. */
+   if( retValue != TA_TEST_PASS )
+   {
+      printf( "\nFailed bar queue producer/consumer\n" );
+      return retValue;
+   }
+
+   #if defined( WIN32 )
+      WaitForSingleObject( thread, INFINITE );
+      CloseHandle( thread );
+   #else
+      pthread_join( thread, NULL );
+   #endif
+
+   TA_BarQueueFree( queue );
+
+   if( producer.retValue != TA_TEST_PASS )
+      return producer.retValue;
+
+   retValue = freeLib();
+   if( retValue != TA_TEST_PASS )
+      return retValue;
+
+   return TA_TEST_PASS;
+}
+
+static THREAD_FUNC queueProducer( void *arg )
+{
+   QueueProducer *producer;
+   Int64 timestamp[STRESS_CAPACITY];
+   double open[STRESS_CAPACITY], high[STRESS_CAPACITY], low[STRESS_CAPACITY];
+   double close[STRESS_CAPACITY], volume[STRESS_CAPACITY];
+   TA_RetCode retCode;
+   int i, k, nbBar, batchSize, nbPushed;
+
+   producer = (QueueProducer *)arg;
+   nbBar = 0;
+   batchSize = 1;
+   while( nbBar < producer->nbBar )
+   {
+      /* Batches of 1 to 37 bars, often more than the room
+       * left when the consumer is late.
+       */
+      if( batchSize > producer->nbBar-nbBar )
+         batchSize = producer->nbBar-nbBar;
+
+      for( i=0; i < batchSize; i++ )
+      {
+         k = nbBar+i;
+         timestamp[i] = 1000+(Int64)k*60;
+         open[i]      = k;
+         high[i]      = k+2.0;
+         low[i]       = k-1.0;
+         close[i]     = k+1.0;
+         volume[i]    = 1.0;
+      }
+
+      retCode = TA_BarQueuePush( producer->queue, batchSize, timestamp, open,
+                                 high, low, close, volume, &nbPushed );
+      if( (retCode != TA_SUCCESS) || (nbPushed < 0) || (nbPushed > batchSize) )
+      {
+         printf( "\nFailed TA_BarQueuePush RetCode = %d (%d bars)\n", retCode, nbPushed );
+         producer->retValue = TA_INTERNAL_BAR_QUEUE_PUSH;
+         break;
+      }
+
+      if( nbPushed == 0 )
+         THREAD_YIELD;
+
+      nbBar += nbPushed;
+      batchSize = (batchSize%37)+1;
+   }
+
+   return 0;
+}
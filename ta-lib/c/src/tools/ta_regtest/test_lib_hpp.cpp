@@ -0,0 +1,231 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ *
+ */
+
+/* Description:
+ *     Compile the C++20 interface (ta_lib.hpp) and call it for one
+ *     function of each shape of inputs and outputs: one or two real
+ *     inputs, an array of periods, the prices (HL, HLC, OHLC, HLCV),
+ *     several real outputs and integer outputs, with double and float
+ *     inputs.
+ *
+ *     Each call must give the same output as the C function it
+ *     forwards to. Built and run by CMake (ctest) when the compiler
+ *     supports C++20.
+ */
+
+/**** Headers ****/
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include "ta_lib.hpp"
+
+/**** Local declarations.              ****/
+#define NB_BAR 300
+
+namespace {
+
+int nbFailed = 0;
+
+/* Compare the result of a ta:: call with the C function. */
+void check( const char *name, const ta::Result &result,
+            TA_RetCode retCode, int begIdx, int nbElement )
+{
+   if( (result.retCode != retCode) || (result.begIdx != begIdx) ||
+       (result.nbElement != nbElement) )
+   {
+      std::printf( "%s: result %d/%d/%d != %d/%d/%d\n", name,
+                   result.retCode, result.begIdx, result.nbElement,
+                   retCode, begIdx, nbElement );
+      nbFailed++;
+   }
+}
+
+template<typename T>
+void checkOutput( const char *name, const std::vector<T> &output,
+                  const std::vector<T> &ref, int nbElement )
+{
+   int i;
+
+   for( i=0; i < nbElement; i++ )
+   {
+      if( output[i] != ref[i] )
+      {
+         std::printf( "%s: output differs at %d\n", name, i );
+         nbFailed++;
+         return;
+      }
+   }
+}
+
+} /* namespace */
+
+int main( void )
+{
+   std::vector<double> open(NB_BAR), high(NB_BAR), low(NB_BAR), close(NB_BAR), volume(NB_BAR);
+   std::vector<double> periods(NB_BAR);
+   std::vector<float> closeFloat(NB_BAR);
+   std::vector<double> out0(NB_BAR), out1(NB_BAR), out2(NB_BAR);
+   std::vector<double> ref0(NB_BAR), ref1(NB_BAR), ref2(NB_BAR);
+   std::vector<int> outInt0(NB_BAR), outInt1(NB_BAR), refInt0(NB_BAR), refInt1(NB_BAR);
+   TA_RetCode retCode;
+   TA_Integer begIdx, nbElement;
+   ta::Result result;
+   int i;
+
+   if( TA_Initialize() != TA_SUCCESS )
+   {
+      std::printf( "TA_Initialize failed\n" );
+      return 1;
+   }
+
+   for( i=0; i < NB_BAR; i++ )
+   {
+      close[i]      = 100.0+10.0*std::sin(i*0.1)+(i%7)*0.3;
+      open[i]       = close[i]-0.5+(i%3)*0.4;
+      high[i]       = (open[i] > close[i]? open[i] : close[i])+1.0+(i%5)*0.1;
+      low[i]        = (open[i] < close[i]? open[i] : close[i])-1.0-(i%4)*0.1;
+      volume[i]     = 1000.0+(i%11)*100.0;
+      periods[i]    = 2+(i%20);
+      closeFloat[i] = (float)close[i];
+   }
+
+   /* One real input, default optional input. */
+   result  = ta::SMA( close, out0 );
+   retCode = TA_SMA( 0, NB_BAR-1, close.data(), 30, &begIdx, &nbElement, ref0.data() );
+   check( "SMA", result, retCode, begIdx, nbElement );
+   checkOutput( "SMA", out0, ref0, nbElement );
+
+   /* Float input (TA_S_XXX). */
+   result  = ta::SMA( closeFloat, out0, 10 );
+   retCode = TA_S_SMA( 0, NB_BAR-1, closeFloat.data(), 10, &begIdx, &nbElement, ref0.data() );
+   check( "SMA float", result, retCode, begIdx, nbElement );
+   checkOutput( "SMA float", out0, ref0, nbElement );
+
+   /* Three outputs. */
+   result  = ta::MACD( close, out0, out1, out2, 5, 13 );
+   retCode = TA_MACD( 0, NB_BAR-1, close.data(), 5, 13, 9, &begIdx, &nbElement,
+                      ref0.data(), ref1.data(), ref2.data() );
+   check( "MACD", result, retCode, begIdx, nbElement );
+   checkOutput( "MACD", out0, ref0, nbElement );
+   checkOutput( "MACD", out1, ref1, nbElement );
+   checkOutput( "MACD", out2, ref2, nbElement );
+
+   /* Two real inputs. */
+   result  = ta::ADD( high, low, out0 );
+   retCode = TA_ADD( 0, NB_BAR-1, high.data(), low.data(), &begIdx, &nbElement, ref0.data() );
+   check( "ADD", result, retCode, begIdx, nbElement );
+   checkOutput( "ADD", out0, ref0, nbElement );
+
+   /* Real input and an array of periods. */
+   result  = ta::MAVP( close, periods, out0, 2, 20 );
+   retCode = TA_MAVP( 0, NB_BAR-1, close.data(), periods.data(), 2, 20, TA_MAType_SMA,
+                      &begIdx, &nbElement, ref0.data() );
+   check( "MAVP", result, retCode, begIdx, nbElement );
+   checkOutput( "MAVP", out0, ref0, nbElement );
+
+   /* High and low. */
+   result  = ta::MIDPRICE( high, low, out0 );
+   retCode = TA_MIDPRICE( 0, NB_BAR-1, high.data(), low.data(), 14, &begIdx, &nbElement, ref0.data() );
+   check( "MIDPRICE", result, retCode, begIdx, nbElement );
+   checkOutput( "MIDPRICE", out0, ref0, nbElement );
+
+   /* High, low and close. */
+   result  = ta::ATR( high, low, close, out0, 10 );
+   retCode = TA_ATR( 0, NB_BAR-1, high.data(), low.data(), close.data(), 10,
+                     &begIdx, &nbElement, ref0.data() );
+   check( "ATR", result, retCode, begIdx, nbElement );
+   checkOutput( "ATR", out0, ref0, nbElement );
+
+   /* Open, high, low and close, integer output. */
+   result  = ta::CDLDOJI( open, high, low, close, outInt0 );
+   retCode = TA_CDLDOJI( 0, NB_BAR-1, open.data(), high.data(), low.data(), close.data(),
+                         &begIdx, &nbElement, refInt0.data() );
+   check( "CDLDOJI", result, retCode, begIdx, nbElement );
+   checkOutput( "CDLDOJI", outInt0, refInt0, nbElement );
+
+   /* High, low, close and volume. */
+   result  = ta::MFI( high, low, close, volume, out0 );
+   retCode = TA_MFI( 0, NB_BAR-1, high.data(), low.data(), close.data(), volume.data(), 14,
+                     &begIdx, &nbElement, ref0.data() );
+   check( "MFI", result, retCode, begIdx, nbElement );
+   checkOutput( "MFI", out0, ref0, nbElement );
+
+   /* Two integer outputs. */
+   result  = ta::MINMAXINDEX( close, outInt0, outInt1, 15 );
+   retCode = TA_MINMAXINDEX( 0, NB_BAR-1, close.data(), 15, &begIdx, &nbElement,
+                             refInt0.data(), refInt1.data() );
+   check( "MINMAXINDEX", result, retCode, begIdx, nbElement );
+   checkOutput( "MINMAXINDEX", outInt0, refInt0, nbElement );
+   checkOutput( "MINMAXINDEX", outInt1, refInt1, nbElement );
+
+   /* The lookback forwards the optional inputs. */
+   if( ta::SMA_Lookback( 10 ) != TA_SMA_Lookback( 10 ) )
+   {
+      std::printf( "SMA_Lookback differs\n" );
+      nbFailed++;
+   }
+
+   /* Inputs of different sizes, output too small. */
+   result = ta::ADD( std::span<const double>( high.data(), NB_BAR ),
+                     std::span<const double>( low.data(), NB_BAR-1 ), out0 );
+   check( "ADD sizes", result, TA_BAD_PARAM, 0, 0 );
+
+   result = ta::SMA( close, std::span<double>( out0.data(), NB_BAR-40 ), 30 );
+   check( "SMA output size", result, TA_BAD_PARAM, 0, 0 );
+
+   TA_Shutdown();
+
+   if( nbFailed != 0 )
+   {
+      std::printf( "ta_lib.hpp: %d failed\n", nbFailed );
+      return 1;
+   }
+
+   std::printf( "ta_lib.hpp: all calls succeeded\n" );
+   return 0;
+}
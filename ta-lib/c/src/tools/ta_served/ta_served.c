@@ -0,0 +1,1342 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ *
+ * Change history:
+ *
+ *  MMDDYY BY   Description
+ *  -------------------------------------------------------------------
+ *  101826 AG   First version.
+ */
+
+/* Description:
+ *    Daemon calculating the TA functions for the other processes of
+ *    the same host. The requests come through a Unix socket and the
+ *    data is exchanged in POSIX shared memory (see ta_served.h).
+ *
+ *    The requests are calculated by a pool of worker threads, with a
+ *    result cache shared by all the clients.
+ *
+ *    Linux only.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "ta_libc.h"
+#include "ta_served.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+/* None */
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+
+/* The cache is split in shards, each with its own lock, so that the
+ * calculations on different series are done in parallel.
+ */
+#define NB_CACHE_SHARD 16
+
+/* Mappings kept when no request is using them. */
+#define MAX_UNUSED_SEGMENT 64
+
+typedef struct Segment
+{
+   char name[TA_SERVED_MAX_NAME];
+   int writable;
+
+   /* Identify the shared memory object, it can be replaced by a new
+    * one with the same name.
+    */
+   dev_t dev;
+   ino_t ino;
+
+   void *addr;
+   size_t size;
+
+   unsigned int refCount;
+   struct Segment *next;
+} Segment;
+
+typedef struct Connection
+{
+   int fd;
+   pthread_mutex_t writeMutex;
+
+   /* The reader thread plus the requests not yet answered. */
+   unsigned int refCount;
+} Connection;
+
+typedef struct Job
+{
+   TA_ServedRequest request;
+   Connection *connection;
+   struct Job *next;
+} Job;
+
+typedef struct
+{
+   pthread_mutex_t mutex;
+   TA_ResultCache *cache;
+} CacheShard;
+
+typedef struct
+{
+   const char *socketPath;
+   unsigned int nbWorker;
+   unsigned int maxEntry;
+   unsigned int maxBytes;
+} ServerConfig;
+
+/**** Local functions declarations.    ****/
+static int startServer( const ServerConfig *config );
+static void stopServer( void );
+static void *acceptThread( void *arg );
+static void *readerThread( void *arg );
+static void *workerThread( void *arg );
+static void releaseConnection( Connection *connection );
+static void processRequest( TA_ServedRequest *request, TA_ServedResponse *response );
+static TA_RetCode callFunction( const TA_ServedRequest *request,
+                                const TA_FuncInfo *funcInfo,
+                                const void *inBase,
+                                void *outBase,
+                                int useCache,
+                                TA_ServedResponse *response );
+static Segment *acquireSegment( const char *name, int writable );
+static void releaseSegment( Segment *segment );
+static void closeAllSegments( void );
+static UInt64 seriesIdOf( const TA_ServedRequest *request );
+static int isInSegment( UInt64 offset, UInt64 nbElement,
+                        UInt64 elementSize, UInt64 segmentSize );
+static int readAll( int fd, void *buffer, size_t size );
+static int writeAll( int fd, const void *buffer, size_t size );
+static int selfTest( const char *socketPath );
+static void printUsage( void );
+
+/**** Local variables definitions.     ****/
+static int listenFd = -1;
+static const char *listenPath;
+static pthread_t acceptThreadId;
+
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  jobCond  = PTHREAD_COND_INITIALIZER;
+static Job *jobHead;
+static Job *jobTail;
+static int stopping;
+static pthread_t *workerThreadId;
+static unsigned int nbWorkerThread;
+
+static pthread_mutex_t segmentMutex = PTHREAD_MUTEX_INITIALIZER;
+static Segment *segmentList;
+
+static CacheShard cacheShard[NB_CACHE_SHARD];
+
+/**** Global functions definitions.   ****/
+int main( int argc, char **argv )
+{
+   ServerConfig config;
+   sigset_t signalSet;
+   int i, sig, doSelfTest, retValue;
+   long nbCpu;
+   char testPath[108];
+
+   config.socketPath = TA_SERVED_DEFAULT_SOCKET;
+   nbCpu = sysconf( _SC_NPROCESSORS_ONLN );
+   config.nbWorker = nbCpu > 0? (unsigned int)nbCpu : 4;
+   config.maxEntry = 4096;
+   config.maxBytes = 256*1024*1024;
+   doSelfTest = 0;
+
+   for( i=1; i < argc; i++ )
+   {
+      if( (strcmp( argv[i], "-s" ) == 0) && (i+1 < argc) )
+         config.socketPath = argv[++i];
+      else if( (strcmp( argv[i], "-w" ) == 0) && (i+1 < argc) )
+         config.nbWorker = (unsigned int)atoi( argv[++i] );
+      else if( (strcmp( argv[i], "-e" ) == 0) && (i+1 < argc) )
+         config.maxEntry = (unsigned int)atoi( argv[++i] );
+      else if( (strcmp( argv[i], "-m" ) == 0) && (i+1 < argc) )
+         config.maxBytes = (unsigned int)atoi( argv[++i] )*1024*1024;
+      else if( strcmp( argv[i], "-t" ) == 0 )
+         doSelfTest = 1;
+      else
+      {
+         printUsage();
+         return 1;
+      }
+   }
+
+   if( (config.nbWorker == 0) || (config.maxEntry == 0) || (config.maxBytes == 0) )
+   {
+      printUsage();
+      return 1;
+   }
+
+   if( doSelfTest )
+   {
+      sprintf( testPath, "/tmp/ta_served_test.%d.sock", (int)getpid() );
+      config.socketPath = testPath;
+   }
+
+   /* The signals are handled by the main thread only (sigwait). A
+    * client closing its socket must not kill the daemon.
+    */
+   sigemptyset( &signalSet );
+   sigaddset( &signalSet, SIGINT );
+   sigaddset( &signalSet, SIGTERM );
+   pthread_sigmask( SIG_BLOCK, &signalSet, NULL );
+   signal( SIGPIPE, SIG_IGN );
+
+   if( TA_Initialize() != TA_SUCCESS )
+   {
+      printf( "ta_served: TA_Initialize failed\n" );
+      return 1;
+   }
+
+   if( startServer( &config ) != 0 )
+   {
+      TA_Shutdown();
+      return 1;
+   }
+
+   if( doSelfTest )
+      retValue = selfTest( config.socketPath );
+   else
+   {
+      printf( "ta_served: listening on %s (%u workers)\n",
+              config.socketPath, config.nbWorker );
+      fflush( stdout );
+      sigwait( &signalSet, &sig );
+      retValue = 0;
+   }
+
+   stopServer();
+   TA_Shutdown();
+
+   return retValue;
+}
+
+/**** Local functions definitions.     ****/
+static void printUsage( void )
+{
+   printf( "Usage: ta_served [-s socket] [-w nbWorker] [-e maxEntry] [-m maxMB] [-t]\n" );
+   printf( "\n" );
+   printf( "  -s  Path of the Unix socket (default %s)\n", TA_SERVED_DEFAULT_SOCKET );
+   printf( "  -w  Number of worker threads (default: number of CPUs)\n" );
+   printf( "  -e  Maximum number of calculations in the cache (default 4096)\n" );
+   printf( "  -m  Maximum size of the cache in MB (default 256)\n" );
+   printf( "  -t  Self test: start the daemon, send it requests and exit\n" );
+}
+
+static int startServer( const ServerConfig *config )
+{
+   struct sockaddr_un address;
+   unsigned int i;
+
+   for( i=0; i < NB_CACHE_SHARD; i++ )
+   {
+      pthread_mutex_init( &cacheShard[i].mutex, NULL );
+      if( TA_ResultCacheAlloc( (config->maxEntry+NB_CACHE_SHARD-1)/NB_CACHE_SHARD,
+                               config->maxBytes/NB_CACHE_SHARD,
+                               &cacheShard[i].cache ) != TA_SUCCESS )
+      {
+         printf( "ta_served: cannot allocate the result cache\n" );
+         return -1;
+      }
+   }
+
+   if( strlen(config->socketPath) >= sizeof(address.sun_path) )
+   {
+      printf( "ta_served: socket path too long\n" );
+      return -1;
+   }
+
+   listenFd = socket( AF_UNIX, SOCK_STREAM, 0 );
+   if( listenFd < 0 )
+   {
+      printf( "ta_served: socket failed (%s)\n", strerror(errno) );
+      return -1;
+   }
+
+   memset( &address, 0, sizeof(address) );
+   address.sun_family = AF_UNIX;
+   strcpy( address.sun_path, config->socketPath );
+
+   /* Remove the socket left by a previous run. */
+   unlink( config->socketPath );
+
+   if( (bind( listenFd, (struct sockaddr *)&address, sizeof(address) ) != 0) ||
+       (listen( listenFd, 64 ) != 0) )
+   {
+      printf( "ta_served: cannot listen on %s (%s)\n", config->socketPath, strerror(errno) );
+      close( listenFd );
+      listenFd = -1;
+      return -1;
+   }
+   listenPath = config->socketPath;
+
+   workerThreadId = (pthread_t *)malloc( config->nbWorker*sizeof(pthread_t) );
+   if( !workerThreadId )
+      return -1;
+
+   for( nbWorkerThread=0; nbWorkerThread < config->nbWorker; nbWorkerThread++ )
+   {
+      if( pthread_create( &workerThreadId[nbWorkerThread], NULL, workerThread, NULL ) != 0 )
+         return -1;
+   }
+
+   if( pthread_create( &acceptThreadId, NULL, acceptThread, NULL ) != 0 )
+      return -1;
+
+   return 0;
+}
+
+static void stopServer( void )
+{
+   TA_ResultCacheStats stats, total;
+   unsigned int i;
+
+   /* Stop accepting new clients. */
+   if( listenFd >= 0 )
+   {
+      shutdown( listenFd, SHUT_RDWR );
+      pthread_join( acceptThreadId, NULL );
+      close( listenFd );
+      unlink( listenPath );
+      listenFd = -1;
+   }
+
+   /* Let the workers finish the pending requests. */
+   pthread_mutex_lock( &jobMutex );
+   stopping = 1;
+   pthread_cond_broadcast( &jobCond );
+   pthread_mutex_unlock( &jobMutex );
+
+   for( i=0; i < nbWorkerThread; i++ )
+      pthread_join( workerThreadId[i], NULL );
+   free( workerThreadId );
+   workerThreadId = NULL;
+   nbWorkerThread = 0;
+
+   memset( &total, 0, sizeof(total) );
+   for( i=0; i < NB_CACHE_SHARD; i++ )
+   {
+      if( cacheShard[i].cache )
+      {
+         TA_ResultCacheGetStats( cacheShard[i].cache, &stats );
+         total.nbHit    += stats.nbHit;
+         total.nbExtend += stats.nbExtend;
+         total.nbMiss   += stats.nbMiss;
+         total.nbEvict  += stats.nbEvict;
+         TA_ResultCacheFree( cacheShard[i].cache );
+         cacheShard[i].cache = NULL;
+      }
+      pthread_mutex_destroy( &cacheShard[i].mutex );
+   }
+
+   printf( "ta_served: cache hit %lu, extend %lu, miss %lu, evict %lu\n",
+           (unsigned long)total.nbHit, (unsigned long)total.nbExtend,
+           (unsigned long)total.nbMiss, (unsigned long)total.nbEvict );
+
+   closeAllSegments();
+}
+
+static void *acceptThread( void *arg )
+{
+   Connection *connection;
+   pthread_t threadId;
+   int fd;
+
+   (void)arg;
+
+   for( ;; )
+   {
+      fd = accept( listenFd, NULL, NULL );
+      if( fd < 0 )
+      {
+         if( errno == EINTR )
+            continue;
+         break; /* Stopping. */
+      }
+
+      connection = (Connection *)malloc( sizeof(Connection) );
+      if( !connection )
+      {
+         close( fd );
+         continue;
+      }
+      connection->fd = fd;
+      connection->refCount = 1;
+      pthread_mutex_init( &connection->writeMutex, NULL );
+
+      if( pthread_create( &threadId, NULL, readerThread, connection ) != 0 )
+      {
+         releaseConnection( connection );
+         continue;
+      }
+      pthread_detach( threadId );
+   }
+
+   return NULL;
+}
+
+/* One per client: read the requests and queue them for the workers. */
+static void *readerThread( void *arg )
+{
+   Connection *connection;
+   Job *job;
+
+   connection = (Connection *)arg;
+
+   for( ;; )
+   {
+      job = (Job *)malloc( sizeof(Job) );
+      if( !job )
+         break;
+
+      if( (readAll( connection->fd, &job->request, sizeof(TA_ServedRequest) ) != 0) ||
+          (job->request.magic != TA_SERVED_MAGIC) )
+      {
+         /* Disconnected or not a client. */
+         free( job );
+         break;
+      }
+
+      job->connection = connection;
+      job->next = NULL;
+
+      pthread_mutex_lock( &jobMutex );
+      connection->refCount++;
+      if( jobTail )
+         jobTail->next = job;
+      else
+         jobHead = job;
+      jobTail = job;
+      pthread_cond_signal( &jobCond );
+      pthread_mutex_unlock( &jobMutex );
+   }
+
+   releaseConnection( connection );
+   return NULL;
+}
+
+static void *workerThread( void *arg )
+{
+   TA_ServedResponse response;
+   Job *job;
+
+   (void)arg;
+
+   for( ;; )
+   {
+      pthread_mutex_lock( &jobMutex );
+      while( !jobHead && !stopping )
+         pthread_cond_wait( &jobCond, &jobMutex );
+      job = jobHead;
+      if( job )
+      {
+         jobHead = job->next;
+         if( !jobHead )
+            jobTail = NULL;
+      }
+      pthread_mutex_unlock( &jobMutex );
+
+      if( !job )
+         break;
+
+      processRequest( &job->request, &response );
+
+      /* The responses of the workers must not be interleaved. A client
+       * already gone is ignored.
+       */
+      pthread_mutex_lock( &job->connection->writeMutex );
+      writeAll( job->connection->fd, &response, sizeof(response) );
+      pthread_mutex_unlock( &job->connection->writeMutex );
+
+      releaseConnection( job->connection );
+      free( job );
+   }
+
+   return NULL;
+}
+
+static void releaseConnection( Connection *connection )
+{
+   unsigned int refCount;
+
+   pthread_mutex_lock( &jobMutex );
+   refCount = --connection->refCount;
+   pthread_mutex_unlock( &jobMutex );
+
+   if( refCount == 0 )
+   {
+      close( connection->fd );
+      pthread_mutex_destroy( &connection->writeMutex );
+      free( connection );
+   }
+}
+
+static void processRequest( TA_ServedRequest *request, TA_ServedResponse *response )
+{
+   const TA_FuncHandle *handle;
+   const TA_FuncInfo *funcInfo;
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   Segment *inSegment, *outSegment;
+   UInt64 size, nbIn, nbOut, outEnd;
+   UInt64 inElementSize[TA_SERVED_MAX_ARRAY], inEnd[TA_SERVED_MAX_ARRAY];
+   UInt64 outElementSize[TA_SERVED_MAX_OUTPUT];
+   unsigned int i, j, flag, nbArray;
+   int useCache, valid;
+   TA_RetCode retCode;
+
+   response->magic        = TA_SERVED_MAGIC;
+   response->requestId    = request->requestId;
+   response->retCode      = TA_BAD_PARAM;
+   response->outBegIdx    = 0;
+   response->outNbElement = 0;
+   response->cacheResult  = TA_SERVED_CACHE_NONE;
+
+   request->funcName[TA_SERVED_MAX_NAME-1]   = '\0';
+   request->inSegment[TA_SERVED_MAX_NAME-1]  = '\0';
+   request->outSegment[TA_SERVED_MAX_NAME-1] = '\0';
+
+   retCode = TA_GetFuncHandle( request->funcName, &handle );
+   if( retCode == TA_SUCCESS )
+      retCode = TA_GetFuncInfo( handle, &funcInfo );
+   if( retCode != TA_SUCCESS )
+   {
+      response->retCode = retCode;
+      return;
+   }
+
+   if( request->startIdx < 0 )
+   {
+      response->retCode = TA_OUT_OF_RANGE_START_INDEX;
+      return;
+   }
+   if( request->endIdx < request->startIdx )
+   {
+      response->retCode = TA_OUT_OF_RANGE_END_INDEX;
+      return;
+   }
+
+   if( (request->nbOptInput > funcInfo->nbOptInput) ||
+       (request->nbOptInput > TA_SERVED_MAX_OPTINPUT) ||
+       (request->nbOutput != funcInfo->nbOutput) ||
+       (request->nbOutput > TA_SERVED_MAX_OUTPUT) ||
+       (request->nbInArray > TA_SERVED_MAX_ARRAY) )
+      return;
+
+   /* Check the alignment of the arrays. */
+   nbArray = 0;
+   for( i=0; i < funcInfo->nbInput; i++ )
+   {
+      TA_GetInputParameterInfo( handle, i, &inputInfo );
+      for( flag=TA_IN_PRICE_OPEN; flag <= TA_IN_PRICE_OPENINTEREST; flag <<= 1 )
+      {
+         if( (inputInfo->type == TA_Input_Price) && !(inputInfo->flags & flag) )
+            continue;
+
+         if( nbArray >= request->nbInArray )
+            return;
+
+         size = inputInfo->type == TA_Input_Integer? sizeof(TA_Integer) : sizeof(TA_Real);
+         if( request->inOffset[nbArray] % size )
+            return;
+         inElementSize[nbArray] = size;
+         nbArray++;
+
+         if( inputInfo->type != TA_Input_Price )
+            break;
+      }
+   }
+   if( nbArray != request->nbInArray )
+      return;
+
+   for( i=0; i < funcInfo->nbOutput; i++ )
+   {
+      TA_GetOutputParameterInfo( handle, i, &outputInfo );
+      size = outputInfo->type == TA_Output_Integer? sizeof(TA_Integer) : sizeof(TA_Real);
+      if( request->outOffset[i] % size )
+         return;
+      outElementSize[i] = size;
+   }
+
+   inSegment = acquireSegment( request->inSegment, 0 );
+   if( !inSegment )
+      return;
+
+   outSegment = acquireSegment( request->outSegment, 1 );
+   if( !outSegment )
+   {
+      releaseSegment( inSegment );
+      return;
+   }
+
+   /* Check that all the arrays are within the segments. The offsets
+    * come from the client: they are checked before any sum is done.
+    */
+   valid = 1;
+   nbIn  = (UInt64)request->endIdx+1;
+   for( j=0; j < nbArray; j++ )
+   {
+      if( !isInSegment( request->inOffset[j], nbIn, inElementSize[j], inSegment->size ) )
+         valid = 0;
+      else
+         inEnd[j] = request->inOffset[j]+nbIn*inElementSize[j];
+   }
+
+   /* The inputs overwritten by an output would not be the data known
+    * by the cache any more: such calculation is not cached.
+    */
+   useCache = !(request->flags & TA_SERVED_FLG_NO_CACHE);
+
+   nbOut = (UInt64)(request->endIdx-request->startIdx)+1;
+   for( i=0; (i < funcInfo->nbOutput) && valid; i++ )
+   {
+      if( !isInSegment( request->outOffset[i], nbOut, outElementSize[i], outSegment->size ) )
+      {
+         valid = 0;
+         break;
+      }
+      outEnd = request->outOffset[i]+nbOut*outElementSize[i];
+
+      if( useCache && (strcmp( request->inSegment, request->outSegment ) == 0) )
+      {
+         for( j=0; j < nbArray; j++ )
+         {
+            if( (request->outOffset[i] < inEnd[j]) && (request->inOffset[j] < outEnd) )
+               useCache = 0;
+         }
+      }
+   }
+
+   if( !valid )
+   {
+      releaseSegment( outSegment );
+      releaseSegment( inSegment );
+      return;
+   }
+
+   response->retCode = callFunction( request, funcInfo,
+                                     inSegment->addr, outSegment->addr,
+                                     useCache, response );
+
+   releaseSegment( outSegment );
+   releaseSegment( inSegment );
+}
+
+static TA_RetCode callFunction( const TA_ServedRequest *request,
+                                const TA_FuncInfo *funcInfo,
+                                const void *inBase,
+                                void *outBase,
+                                int useCache,
+                                TA_ServedResponse *response )
+{
+   const TA_InputParameterInfo *inputInfo;
+   const TA_OptInputParameterInfo *optInfo;
+   const TA_OutputParameterInfo *outputInfo;
+   const TA_Real *price[6];
+   TA_ResultCacheStats before, after;
+   TA_ParamHolder *params;
+   CacheShard *shard;
+   UInt64 seriesId;
+   unsigned int i, j, nbArray;
+   TA_RetCode retCode;
+
+   retCode = TA_ParamHolderAlloc( funcInfo->handle, &params );
+   if( retCode != TA_SUCCESS )
+      return retCode;
+
+   nbArray = 0;
+   for( i=0; (i < funcInfo->nbInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetInputParameterInfo( funcInfo->handle, i, &inputInfo );
+      switch( inputInfo->type )
+      {
+      case TA_Input_Price:
+         for( j=0; j < 6; j++ )
+         {
+            price[j] = NULL;
+            if( inputInfo->flags & (TA_IN_PRICE_OPEN<<j) )
+               price[j] = (const TA_Real *)((const char *)inBase+request->inOffset[nbArray++]);
+         }
+         retCode = TA_SetInputParamPricePtr( params, i, price[0], price[1], price[2],
+                                             price[3], price[4], price[5] );
+         break;
+      case TA_Input_Real:
+         retCode = TA_SetInputParamRealPtr( params, i,
+                      (const TA_Real *)((const char *)inBase+request->inOffset[nbArray++]) );
+         break;
+      case TA_Input_Integer:
+         retCode = TA_SetInputParamIntegerPtr( params, i,
+                      (const TA_Integer *)((const char *)inBase+request->inOffset[nbArray++]) );
+         break;
+      }
+   }
+
+   for( i=0; (i < request->nbOptInput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetOptInputParameterInfo( funcInfo->handle, i, &optInfo );
+      if( (optInfo->type == TA_OptInput_RealRange) || (optInfo->type == TA_OptInput_RealList) )
+         retCode = TA_SetOptInputParamReal( params, i, request->optInput[i] );
+      else if( !((request->optInput[i] >= (double)TA_INTEGER_DEFAULT) &&
+                 (request->optInput[i] <= (double)TA_INTEGER_MAX)) )
+      {
+         /* NaN, infinite or out of the range of an integer: the cast
+          * would be undefined.
+          */
+         retCode = TA_BAD_PARAM;
+      }
+      else
+         retCode = TA_SetOptInputParamInteger( params, i, (TA_Integer)request->optInput[i] );
+   }
+
+   for( i=0; (i < funcInfo->nbOutput) && (retCode == TA_SUCCESS); i++ )
+   {
+      TA_GetOutputParameterInfo( funcInfo->handle, i, &outputInfo );
+      if( outputInfo->type == TA_Output_Integer )
+         retCode = TA_SetOutputParamIntegerPtr( params, i,
+                      (TA_Integer *)((char *)outBase+request->outOffset[i]) );
+      else
+         retCode = TA_SetOutputParamRealPtr( params, i,
+                      (TA_Real *)((char *)outBase+request->outOffset[i]) );
+   }
+
+   if( retCode == TA_SUCCESS )
+   {
+      if( useCache )
+      {
+         seriesId = seriesIdOf( request );
+         shard = &cacheShard[seriesId%NB_CACHE_SHARD];
+
+         pthread_mutex_lock( &shard->mutex );
+         TA_SetParamHolderCache( params, shard->cache, seriesId, request->seriesVersion );
+         TA_ResultCacheGetStats( shard->cache, &before );
+         retCode = TA_CallFunc( params, request->startIdx, request->endIdx,
+                                &response->outBegIdx, &response->outNbElement );
+         TA_ResultCacheGetStats( shard->cache, &after );
+         pthread_mutex_unlock( &shard->mutex );
+
+         if( after.nbHit != before.nbHit )
+            response->cacheResult = TA_SERVED_CACHE_HIT;
+         else if( after.nbExtend != before.nbExtend )
+            response->cacheResult = TA_SERVED_CACHE_EXTEND;
+         else if( after.nbMiss != before.nbMiss )
+            response->cacheResult = TA_SERVED_CACHE_MISS;
+      }
+      else
+      {
+         retCode = TA_CallFunc( params, request->startIdx, request->endIdx,
+                                &response->outBegIdx, &response->outNbElement );
+      }
+   }
+
+   TA_ParamHolderFree( params );
+
+   return retCode;
+}
+
+/* The series is identified by the segment and the offsets of the
+ * inputs (FNV-1a). Never zero, which would mean "hash the data".
+ */
+static UInt64 seriesIdOf( const TA_ServedRequest *request )
+{
+   const unsigned char *data;
+   UInt64 hash;
+   size_t i;
+
+   hash = 14695981039346656037ULL;
+   data = (const unsigned char *)request->inSegment;
+   for( i=0; data[i] != '\0'; i++ )
+      hash = (hash^data[i])*1099511628211ULL;
+
+   data = (const unsigned char *)request->inOffset;
+   for( i=0; i < request->nbInArray*sizeof(UInt64); i++ )
+      hash = (hash^data[i])*1099511628211ULL;
+
+   return hash? hash : 1;
+}
+
+/* Return 1 when 'nbElement' elements of 'elementSize' bytes at 'offset'
+ * are within a segment of 'segmentSize' bytes. Nothing is added to the
+ * offset, so it cannot wrap around whatever the client sends.
+ */
+static int isInSegment( UInt64 offset, UInt64 nbElement,
+                        UInt64 elementSize, UInt64 segmentSize )
+{
+   return (offset <= segmentSize) &&
+          (nbElement <= (segmentSize-offset)/elementSize);
+}
+
+/* Map a segment, or reuse its mapping when it is still the same
+ * shared memory object with the same size.
+ */
+static Segment *acquireSegment( const char *name, int writable )
+{
+   Segment *segment, *prev, *unused;
+   struct stat status;
+   unsigned int nbUnused;
+   void *addr;
+   int fd;
+
+   fd = shm_open( name, writable? O_RDWR : O_RDONLY, 0 );
+   if( fd < 0 )
+      return NULL;
+
+   if( (fstat( fd, &status ) != 0) || (status.st_size <= 0) )
+   {
+      close( fd );
+      return NULL;
+   }
+
+   pthread_mutex_lock( &segmentMutex );
+
+   for( segment=segmentList; segment; segment=segment->next )
+   {
+      if( (segment->writable == writable) &&
+          (segment->dev == status.st_dev) &&
+          (segment->ino == status.st_ino) &&
+          (segment->size == (size_t)status.st_size) &&
+          (strcmp( segment->name, name ) == 0) )
+         break;
+   }
+
+   if( !segment )
+   {
+      addr = mmap( NULL, (size_t)status.st_size,
+                   writable? PROT_READ|PROT_WRITE : PROT_READ,
+                   MAP_SHARED, fd, 0 );
+      if( addr != MAP_FAILED )
+      {
+         segment = (Segment *)calloc( 1, sizeof(Segment) );
+         if( segment )
+         {
+            strcpy( segment->name, name );
+            segment->writable = writable;
+            segment->dev  = status.st_dev;
+            segment->ino  = status.st_ino;
+            segment->addr = addr;
+            segment->size = (size_t)status.st_size;
+            segment->next = segmentList;
+            segmentList   = segment;
+         }
+         else
+            munmap( addr, (size_t)status.st_size );
+      }
+   }
+
+   if( segment )
+      segment->refCount++;
+
+   /* Unmap the oldest unused mappings (segments replaced, grown or
+    * not used any more).
+    */
+   nbUnused = 0;
+   prev = NULL;
+   unused = segmentList;
+   while( unused )
+   {
+      if( (unused->refCount == 0) && (++nbUnused > MAX_UNUSED_SEGMENT) )
+      {
+         if( prev )
+            prev->next = unused->next;
+         else
+            segmentList = unused->next;
+         munmap( unused->addr, unused->size );
+         free( unused );
+         unused = prev? prev->next : segmentList;
+         continue;
+      }
+      prev = unused;
+      unused = unused->next;
+   }
+
+   pthread_mutex_unlock( &segmentMutex );
+
+   close( fd );
+
+   return segment;
+}
+
+static void releaseSegment( Segment *segment )
+{
+   pthread_mutex_lock( &segmentMutex );
+   segment->refCount--;
+   pthread_mutex_unlock( &segmentMutex );
+}
+
+static void closeAllSegments( void )
+{
+   Segment *segment;
+
+   pthread_mutex_lock( &segmentMutex );
+   while( segmentList )
+   {
+      segment = segmentList;
+      segmentList = segment->next;
+      munmap( segment->addr, segment->size );
+      free( segment );
+   }
+   pthread_mutex_unlock( &segmentMutex );
+}
+
+static int readAll( int fd, void *buffer, size_t size )
+{
+   ssize_t nbRead;
+
+   while( size > 0 )
+   {
+      nbRead = read( fd, buffer, size );
+      if( nbRead < 0 && errno == EINTR )
+         continue;
+      if( nbRead <= 0 )
+         return -1;
+      buffer = (char *)buffer+nbRead;
+      size -= (size_t)nbRead;
+   }
+
+   return 0;
+}
+
+static int writeAll( int fd, const void *buffer, size_t size )
+{
+   ssize_t nbWritten;
+
+   while( size > 0 )
+   {
+      nbWritten = send( fd, buffer, size, MSG_NOSIGNAL );
+      if( nbWritten < 0 && errno == EINTR )
+         continue;
+      if( nbWritten <= 0 )
+         return -1;
+      buffer = (const char *)buffer+nbWritten;
+      size -= (size_t)nbWritten;
+   }
+
+   return 0;
+}
+
+/**** Self test ****/
+
+#define TEST_NB_BAR      5000
+#define TEST_NB_PIPELINE 200
+
+/* Layout of the test segment: high, low, close, then the outputs. */
+#define TEST_HIGH   0
+#define TEST_LOW    1
+#define TEST_CLOSE  2
+#define TEST_OUT1   3
+#define TEST_OUT2   4
+#define TEST_OUT3   5
+#define TEST_NB_ARRAY 6
+
+#define TEST_OFFSET(array) ((UInt64)(array)*TEST_NB_BAR*sizeof(TA_Real))
+
+static int testConnect( const char *socketPath )
+{
+   struct sockaddr_un address;
+   int fd;
+
+   fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+   if( fd < 0 )
+      return -1;
+
+   memset( &address, 0, sizeof(address) );
+   address.sun_family = AF_UNIX;
+   strcpy( address.sun_path, socketPath );
+   if( connect( fd, (struct sockaddr *)&address, sizeof(address) ) != 0 )
+   {
+      close( fd );
+      return -1;
+   }
+
+   return fd;
+}
+
+static void testRequest( TA_ServedRequest *request,
+                         const char *segmentName,
+                         const char *funcName,
+                         int endIdx )
+{
+   memset( request, 0, sizeof(TA_ServedRequest) );
+   request->magic = TA_SERVED_MAGIC;
+   strcpy( request->funcName, funcName );
+   strcpy( request->inSegment, segmentName );
+   strcpy( request->outSegment, segmentName );
+   request->startIdx = 0;
+   request->endIdx = endIdx;
+   request->nbOutput = 1;
+   request->outOffset[0] = TEST_OFFSET(TEST_OUT1);
+}
+
+static int testCall( int fd, const TA_ServedRequest *request, TA_ServedResponse *response )
+{
+   if( (writeAll( fd, request, sizeof(TA_ServedRequest) ) != 0) ||
+       (readAll( fd, response, sizeof(TA_ServedResponse) ) != 0) ||
+       (response->magic != TA_SERVED_MAGIC) ||
+       (response->requestId != request->requestId) )
+      return -1;
+
+   return 0;
+}
+
+static int testSame( const TA_Real *a, const TA_Real *b, int nbElement )
+{
+   return memcmp( a, b, nbElement*sizeof(TA_Real) ) == 0;
+}
+
+/* The new bars of a window function are calculated from a new start,
+ * the last digits can differ from a calculation done in one pass.
+ */
+static int testClose( const TA_Real *a, const TA_Real *b, int nbElement )
+{
+   int i;
+
+   for( i=0; i < nbElement; i++ )
+   {
+      if( fabs( a[i]-b[i] ) > 1e-10*(fabs(b[i])+1.0) )
+         return 0;
+   }
+
+   return 1;
+}
+
+static int selfTest( const char *socketPath )
+{
+   TA_ServedRequest request;
+   TA_ServedResponse response;
+   TA_Real *data, *expected, *expected2;
+   char segmentName[TA_SERVED_MAX_NAME];
+   int fd1, fd2, fd, i, outBegIdx, outNbElement, retValue;
+   unsigned int nbAnswered, seen[TEST_NB_PIPELINE];
+   const char *failed;
+   size_t size;
+
+   sprintf( segmentName, "/ta_served_test.%d", (int)getpid() );
+   size = TEST_NB_ARRAY*TEST_NB_BAR*sizeof(TA_Real);
+
+   /* The client side: a segment with the data. */
+   fd = shm_open( segmentName, O_RDWR|O_CREAT|O_EXCL, 0600 );
+   if( fd < 0 )
+   {
+      printf( "ta_served: shm_open failed (%s)\n", strerror(errno) );
+      return 1;
+   }
+   if( ftruncate( fd, (off_t)size ) != 0 )
+   {
+      close( fd );
+      shm_unlink( segmentName );
+      return 1;
+   }
+   data = (TA_Real *)mmap( NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0 );
+   close( fd );
+   if( data == MAP_FAILED )
+   {
+      shm_unlink( segmentName );
+      return 1;
+   }
+
+   for( i=0; i < TEST_NB_BAR; i++ )
+   {
+      data[TEST_CLOSE*TEST_NB_BAR+i] = 100.0+10.0*sin( i/40.0 )+(i%7)*0.25;
+      data[TEST_HIGH*TEST_NB_BAR+i]  = data[TEST_CLOSE*TEST_NB_BAR+i]+1.0+(i%3)*0.5;
+      data[TEST_LOW*TEST_NB_BAR+i]   = data[TEST_CLOSE*TEST_NB_BAR+i]-1.0-(i%5)*0.25;
+   }
+
+   expected  = (TA_Real *)malloc( TEST_NB_BAR*sizeof(TA_Real) );
+   expected2 = (TA_Real *)malloc( TEST_NB_BAR*sizeof(TA_Real) );
+   fd1 = testConnect( socketPath );
+   fd2 = testConnect( socketPath );
+
+   failed = NULL;
+   if( !expected || !expected2 || (fd1 < 0) || (fd2 < 0) )
+      failed = "setup";
+
+   /* SMA by a first client: calculated. */
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 1;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.nbOptInput = 1;
+      request.optInput[0] = 30;
+      TA_SMA( 0, TEST_NB_BAR-1, &data[TEST_CLOSE*TEST_NB_BAR], 30,
+              &outBegIdx, &outNbElement, expected );
+
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.cacheResult != TA_SERVED_CACHE_MISS) ||
+          (response.outBegIdx != outBegIdx) ||
+          (response.outNbElement != outNbElement) ||
+          !testSame( &data[TEST_OUT1*TEST_NB_BAR], expected, outNbElement ) )
+         failed = "SMA";
+   }
+
+   /* Same SMA by a second client: from the cache. */
+   if( !failed )
+   {
+      memset( &data[TEST_OUT1*TEST_NB_BAR], 0, TEST_NB_BAR*sizeof(TA_Real) );
+      request.requestId = 2;
+      if( (testCall( fd2, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.cacheResult != TA_SERVED_CACHE_HIT) ||
+          (response.outNbElement != outNbElement) ||
+          !testSame( &data[TEST_OUT1*TEST_NB_BAR], expected, outNbElement ) )
+         failed = "SMA from the cache";
+   }
+
+   /* Without the cache. */
+   if( !failed )
+   {
+      request.requestId = 3;
+      request.flags = TA_SERVED_FLG_NO_CACHE;
+      if( (testCall( fd2, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.cacheResult != TA_SERVED_CACHE_NONE) ||
+          !testSame( &data[TEST_OUT1*TEST_NB_BAR], expected, outNbElement ) )
+         failed = "SMA without the cache";
+   }
+
+   /* Price input and two outputs. */
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "STOCH", TEST_NB_BAR-1 );
+      request.requestId = 4;
+      request.nbInArray = 3;
+      request.inOffset[0] = TEST_OFFSET(TEST_HIGH);
+      request.inOffset[1] = TEST_OFFSET(TEST_LOW);
+      request.inOffset[2] = TEST_OFFSET(TEST_CLOSE);
+      request.nbOutput = 2;
+      request.outOffset[1] = TEST_OFFSET(TEST_OUT2);
+      TA_STOCH( 0, TEST_NB_BAR-1,
+                &data[TEST_HIGH*TEST_NB_BAR], &data[TEST_LOW*TEST_NB_BAR],
+                &data[TEST_CLOSE*TEST_NB_BAR], 5, 3, TA_MAType_SMA, 3, TA_MAType_SMA,
+                &outBegIdx, &outNbElement, expected, expected2 );
+
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.outBegIdx != outBegIdx) ||
+          (response.outNbElement != outNbElement) ||
+          !testSame( &data[TEST_OUT1*TEST_NB_BAR], expected, outNbElement ) ||
+          !testSame( &data[TEST_OUT2*TEST_NB_BAR], expected2, outNbElement ) )
+         failed = "STOCH";
+   }
+
+   /* New bars appended to the series: only these are calculated. */
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1001 );
+      request.requestId = 5;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.nbOptInput = 1;
+      request.optInput[0] = 10;
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.cacheResult != TA_SERVED_CACHE_MISS) )
+         failed = "SMA before the new bars";
+   }
+
+   if( !failed )
+   {
+      request.requestId = 6;
+      request.endIdx = TEST_NB_BAR-1;
+      TA_SMA( 0, TEST_NB_BAR-1, &data[TEST_CLOSE*TEST_NB_BAR], 10,
+              &outBegIdx, &outNbElement, expected );
+      if( (testCall( fd2, &request, &response ) != 0) ||
+          (response.retCode != TA_SUCCESS) ||
+          (response.cacheResult != TA_SERVED_CACHE_EXTEND) ||
+          (response.outBegIdx != outBegIdx) ||
+          (response.outNbElement != outNbElement) ||
+          !testClose( &data[TEST_OUT1*TEST_NB_BAR], expected, outNbElement ) )
+         failed = "SMA with the new bars";
+   }
+
+   /* Invalid requests. */
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "NOTAFUNC", TEST_NB_BAR-1 );
+      request.requestId = 7;
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_FUNC_NOT_FOUND) )
+         failed = "unknown function";
+   }
+
+   if( !failed )
+   {
+      /* The output goes beyond the end of the segment. */
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 8;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.outOffset[0] = TEST_OFFSET(TEST_OUT3)+sizeof(TA_Real);
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_BAD_PARAM) )
+         failed = "output out of the segment";
+   }
+
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 9;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      strcpy( request.inSegment, "/ta_served_test.missing" );
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_BAD_PARAM) )
+         failed = "missing segment";
+   }
+
+   if( !failed )
+   {
+      /* The end of the input would wrap around 64 bits. */
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 10;
+      request.nbInArray = 1;
+      request.inOffset[0] = ~(UInt64)0-sizeof(TA_Real)+1;
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_BAD_PARAM) )
+         failed = "input offset wrapping around";
+   }
+
+   if( !failed )
+   {
+      /* The end of the output would wrap around 64 bits. */
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 11;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.outOffset[0] = ~(UInt64)0-TEST_NB_BAR*sizeof(TA_Real)+9;
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_BAD_PARAM) )
+         failed = "output offset wrapping around";
+   }
+
+   for( i=0; (i < 3) && !failed; i++ )
+   {
+      /* An integer optional input that is not an int. */
+      testRequest( &request, segmentName, "SMA", TEST_NB_BAR-1 );
+      request.requestId = 12+i;
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.nbOptInput = 1;
+      request.optInput[0] = i == 0? 4.0e9 : (i == 1? HUGE_VAL : sqrt(-1.0));
+      if( (testCall( fd1, &request, &response ) != 0) ||
+          (response.retCode != TA_BAD_PARAM) )
+         failed = "optional input out of the range of an int";
+   }
+
+   /* Many requests sent before reading the responses: they are
+    * calculated by all the workers and answered in any order.
+    */
+   if( !failed )
+   {
+      testRequest( &request, segmentName, "EMA", TEST_NB_BAR-1 );
+      request.nbInArray = 1;
+      request.inOffset[0] = TEST_OFFSET(TEST_CLOSE);
+      request.outOffset[0] = TEST_OFFSET(TEST_OUT3);
+      request.nbOptInput = 1;
+      request.optInput[0] = 20;
+      for( i=0; (i < TEST_NB_PIPELINE) && !failed; i++ )
+      {
+         request.requestId = 1000+i;
+         seen[i] = 0;
+         if( writeAll( fd2, &request, sizeof(request) ) != 0 )
+            failed = "pipelined requests";
+      }
+
+      for( nbAnswered=0; (nbAnswered < TEST_NB_PIPELINE) && !failed; nbAnswered++ )
+      {
+         if( (readAll( fd2, &response, sizeof(response) ) != 0) ||
+             (response.retCode != TA_SUCCESS) ||
+             (response.requestId < 1000) ||
+             (response.requestId >= 1000+TEST_NB_PIPELINE) ||
+             seen[response.requestId-1000]++ )
+            failed = "pipelined responses";
+      }
+
+      TA_EMA( 0, TEST_NB_BAR-1, &data[TEST_CLOSE*TEST_NB_BAR], 20,
+              &outBegIdx, &outNbElement, expected );
+      if( !failed && !testSame( &data[TEST_OUT3*TEST_NB_BAR], expected, outNbElement ) )
+         failed = "pipelined output";
+   }
+
+   if( failed )
+   {
+      printf( "ta_served: self test failed (%s)\n", failed );
+      retValue = 1;
+   }
+   else
+   {
+      printf( "ta_served: self test succeeded\n" );
+      retValue = 0;
+   }
+
+   if( fd1 >= 0 )
+      close( fd1 );
+   if( fd2 >= 0 )
+      close( fd2 );
+   free( expected );
+   free( expected2 );
+   munmap( data, size );
+   shm_unlink( segmentName );
+
+   return retValue;
+}
@@ -451,6 +451,50 @@ namespace TicTacTec
              #endif
 
 
+             #if defined( USE_SUBARRAY )
+             static  enum class RetCode TA_INT_RSI( int           startIdx,
+					                int           endIdx,
+					                SubArray<double>^ inReal_0,
+					                int           optInTimePeriod_0,
+					                [Out]int% outBegIdx,
+					                [Out]int% outNbElement,
+					                SubArray<double>^ outReal_0);
+
+             static  enum class RetCode TA_INT_RSI( int           startIdx,
+					                int           endIdx,
+					                SubArray<float>^ inReal_0,
+					                int           optInTimePeriod_0,
+					                [Out]int% outBegIdx,
+					                [Out]int% outNbElement,
+					                SubArray<double>^ outReal_0)
+			 {
+                 return TA_INT_RSI( startIdx,
+					                endIdx,
+					                gcnew SubArrayFloatToDouble(inReal_0),
+					                optInTimePeriod_0,
+					                outBegIdx,
+					                outNbElement,
+					                outReal_0);
+
+			 }
+             #else
+			 static  enum class RetCode TA_INT_RSI( int     startIdx,
+									int     endIdx,
+									cli::array<double>^ inReal_0,
+									int     optInTimePeriod_0, 
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									cli::array<double>^ outReal_0);
+			 static  enum class RetCode TA_INT_RSI( int     startIdx,
+									int     endIdx,
+									cli::array<float>^ inReal_0,
+									int     optInTimePeriod_0, 
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									cli::array<double>^ outReal_0 );
+             #endif
+
+
              #if defined( USE_SUBARRAY )
              static  enum class RetCode TA_INT_MACD( int           startIdx,
 					                 int           endIdx,
@@ -619,6 +663,58 @@ namespace TicTacTec
 									cli::array<double>^ outReal_0);
              #endif
 
+             #if defined( USE_SUBARRAY )
+			 static  enum class RetCode TA_INT_QUANTILE( int    startIdx,
+									int    endIdx,
+									SubArray<double>^ inReal_0,
+									int    optInTimePeriod_0,
+									double optInQuantile_1,
+									int    calcAbsDev,
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									SubArray<double>^ outReal_0);
+
+			 static  enum class RetCode TA_INT_QUANTILE( int    startIdx,
+									int    endIdx,
+									SubArray<float>^ inReal_0,
+									int    optInTimePeriod_0,
+									double optInQuantile_1,
+									int    calcAbsDev,
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									SubArray<double>^ outReal_0)
+			 {
+				 return TA_INT_QUANTILE( startIdx,
+									endIdx,
+									gcnew SubArrayFloatToDouble(inReal_0),
+									optInTimePeriod_0,
+									optInQuantile_1,
+									calcAbsDev,
+									outBegIdx,
+									outNbElement,
+									outReal_0);
+			 }
+             #else
+			 static  enum class RetCode TA_INT_QUANTILE( int    startIdx,
+									int    endIdx,
+									cli::array<double>^ inReal_0,
+									int    optInTimePeriod_0,
+									double optInQuantile_1,
+									int    calcAbsDev,
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									cli::array<double>^ outReal_0);
+			 static  enum class RetCode TA_INT_QUANTILE( int    startIdx,
+									int    endIdx,
+									cli::array<float>^ inReal_0,
+									int    optInTimePeriod_0,
+									double optInQuantile_1,
+									int    calcAbsDev,
+									[Out]int% outBegIdx,
+									[Out]int% outNbElement,
+									cli::array<double>^ outReal_0);
+             #endif
+
 
 
              #if defined( USE_SUBARRAY )
@@ -7704,6 +7800,140 @@ namespace TicTacTec
          #define TA_COSH Core::Cosh
          #define TA_COSH_Lookback Core::CoshLookback
 
+         static int CrossOverLookback( void );
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              SubArray<double>^ inReal0,
+                                              SubArray<double>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              SubArray<int>^  outInteger );
+
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              SubArray<float>^ inReal0,
+                                              SubArray<float>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              SubArray<int>^  outInteger );
+
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              cli::array<double>^ inReal0,
+                                              cli::array<double>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              cli::array<int>^  outInteger )
+         { return CrossOver( startIdx,     endIdx,
+                              gcnew SubArrayFrom1D<double>(inReal0,0),
+                              gcnew SubArrayFrom1D<double>(inReal1,0),
+                 outBegIdx,
+                 outNBElement,
+                    gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              cli::array<float>^ inReal0,
+                                              cli::array<float>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              cli::array<int>^  outInteger )
+         { return CrossOver( startIdx,     endIdx,
+                              gcnew SubArrayFrom1D<float>(inReal0,0),
+                              gcnew SubArrayFrom1D<float>(inReal1,0),
+                 outBegIdx,
+                 outNBElement,
+                    gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              cli::array<double>^ inReal0,
+                                              cli::array<double>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              cli::array<int>^  outInteger );
+         static enum class RetCode CrossOver( int    startIdx,
+                                              int    endIdx,
+                                              cli::array<float>^ inReal0,
+                                              cli::array<float>^ inReal1,
+                                              [Out]int%    outBegIdx,
+                                              [Out]int%    outNBElement,
+                                              cli::array<int>^  outInteger );
+         #endif
+
+         #define TA_CROSSOVER Core::CrossOver
+         #define TA_CROSSOVER_Lookback Core::CrossOverLookback
+
+         static int CrossUnderLookback( void );
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               SubArray<double>^ inReal0,
+                                               SubArray<double>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               SubArray<int>^  outInteger );
+
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               SubArray<float>^ inReal0,
+                                               SubArray<float>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               SubArray<int>^  outInteger );
+
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               cli::array<double>^ inReal0,
+                                               cli::array<double>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               cli::array<int>^  outInteger )
+         { return CrossUnder( startIdx,      endIdx,
+                               gcnew SubArrayFrom1D<double>(inReal0,0),
+                               gcnew SubArrayFrom1D<double>(inReal1,0),
+                  outBegIdx,
+                  outNBElement,
+                     gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               cli::array<float>^ inReal0,
+                                               cli::array<float>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               cli::array<int>^  outInteger )
+         { return CrossUnder( startIdx,      endIdx,
+                               gcnew SubArrayFrom1D<float>(inReal0,0),
+                               gcnew SubArrayFrom1D<float>(inReal1,0),
+                  outBegIdx,
+                  outNBElement,
+                     gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               cli::array<double>^ inReal0,
+                                               cli::array<double>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               cli::array<int>^  outInteger );
+         static enum class RetCode CrossUnder( int    startIdx,
+                                               int    endIdx,
+                                               cli::array<float>^ inReal0,
+                                               cli::array<float>^ inReal1,
+                                               [Out]int%    outBegIdx,
+                                               [Out]int%    outNBElement,
+                                               cli::array<int>^  outInteger );
+         #endif
+
+         #define TA_CROSSUNDER Core::CrossUnder
+         #define TA_CROSSUNDER_Lookback Core::CrossUnderLookback
+
          static int DemaLookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
          #if defined( _MANAGED ) && defined( USE_SUBARRAY )
@@ -9390,6 +9620,73 @@ namespace TicTacTec
          #define TA_MACDFIX Core::MacdFix
          #define TA_MACDFIX_Lookback Core::MacdFixLookback
 
+         static int MedianAbsDevLookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 SubArray<double>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 SubArray<double>^  outReal );
+
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 SubArray<float>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 SubArray<double>^  outReal );
+
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<double>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 cli::array<double>^  outReal )
+         { return MedianAbsDev( startIdx,        endIdx,
+                                 gcnew SubArrayFrom1D<double>(inReal,0),
+                     optInTimePeriod, /* From 2 to 100000 */
+                    outBegIdx,
+                    outNBElement,
+                       gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<float>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 cli::array<double>^  outReal )
+         { return MedianAbsDev( startIdx,        endIdx,
+                                 gcnew SubArrayFrom1D<float>(inReal,0),
+                     optInTimePeriod, /* From 2 to 100000 */
+                    outBegIdx,
+                    outNBElement,
+                       gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<double>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 cli::array<double>^  outReal );
+         static enum class RetCode MedianAbsDev( int    startIdx,
+                                                 int    endIdx,
+                                                 cli::array<float>^ inReal,
+                                                 int           optInTimePeriod, /* From 2 to 100000 */
+                                                 [Out]int%    outBegIdx,
+                                                 [Out]int%    outNBElement,
+                                                 cli::array<double>^  outReal );
+         #endif
+
+         #define TA_MAD Core::MedianAbsDev
+         #define TA_MAD_Lookback Core::MedianAbsDevLookback
+
          static int MamaLookback( double        optInFastLimit, /* From 0.01 to 0.99 */
                                 double        optInSlowLimit );  /* From 0.01 to 0.99 */
 
@@ -9700,6 +9997,73 @@ namespace TicTacTec
          #define TA_MAXINDEX Core::MaxIndex
          #define TA_MAXINDEX_Lookback Core::MaxIndexLookback
 
+         static int MedianLookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           SubArray<double>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           SubArray<double>^  outReal );
+
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           SubArray<float>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           SubArray<double>^  outReal );
+
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           cli::array<double>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           cli::array<double>^  outReal )
+         { return Median( startIdx,  endIdx,
+                           gcnew SubArrayFrom1D<double>(inReal,0),
+               optInTimePeriod, /* From 2 to 100000 */
+              outBegIdx,
+              outNBElement,
+                 gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           cli::array<float>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           cli::array<double>^  outReal )
+         { return Median( startIdx,  endIdx,
+                           gcnew SubArrayFrom1D<float>(inReal,0),
+               optInTimePeriod, /* From 2 to 100000 */
+              outBegIdx,
+              outNBElement,
+                 gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           cli::array<double>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           cli::array<double>^  outReal );
+         static enum class RetCode Median( int    startIdx,
+                                           int    endIdx,
+                                           cli::array<float>^ inReal,
+                                           int           optInTimePeriod, /* From 2 to 100000 */
+                                           [Out]int%    outBegIdx,
+                                           [Out]int%    outNBElement,
+                                           cli::array<double>^  outReal );
+         #endif
+
+         #define TA_MEDIAN Core::Median
+         #define TA_MEDIAN_Lookback Core::MedianLookback
+
          static int MedPriceLookback( void );
 
          #if defined( _MANAGED ) && defined( USE_SUBARRAY )
@@ -10968,6 +11332,82 @@ namespace TicTacTec
          #define TA_PPO Core::Ppo
          #define TA_PPO_Lookback Core::PpoLookback
 
+         static int QuantileLookback( int           optInTimePeriod, /* From 2 to 100000 */
+                                    double        optInQuantile );  /* From 0 to 1 */
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             SubArray<double>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             SubArray<double>^  outReal );
+
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             SubArray<float>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             SubArray<double>^  outReal );
+
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             cli::array<double>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             cli::array<double>^  outReal )
+         { return Quantile( startIdx,    endIdx,
+                             gcnew SubArrayFrom1D<double>(inReal,0),
+                 optInTimePeriod, /* From 2 to 100000 */
+                 optInQuantile, /* From 0 to 1 */
+                outBegIdx,
+                outNBElement,
+                   gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             cli::array<float>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             cli::array<double>^  outReal )
+         { return Quantile( startIdx,    endIdx,
+                             gcnew SubArrayFrom1D<float>(inReal,0),
+                 optInTimePeriod, /* From 2 to 100000 */
+                 optInQuantile, /* From 0 to 1 */
+                outBegIdx,
+                outNBElement,
+                   gcnew SubArrayFrom1D<double>(outReal,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             cli::array<double>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             cli::array<double>^  outReal );
+         static enum class RetCode Quantile( int    startIdx,
+                                             int    endIdx,
+                                             cli::array<float>^ inReal,
+                                             int           optInTimePeriod, /* From 2 to 100000 */
+                                             double        optInQuantile, /* From 0 to 1 */
+                                             [Out]int%    outBegIdx,
+                                             [Out]int%    outNBElement,
+                                             cli::array<double>^  outReal );
+         #endif
+
+         #define TA_QUANTILE Core::Quantile
+         #define TA_QUANTILE_Lookback Core::QuantileLookback
+
          static int RocLookback( int           optInTimePeriod );  /* From 1 to 100000 */
 
          #if defined( _MANAGED ) && defined( USE_SUBARRAY )
@@ -12575,6 +13015,73 @@ namespace TicTacTec
          #define TA_TEMA Core::Tema
          #define TA_TEMA_Lookback Core::TemaLookback
 
+         static int ThresholdEventsLookback( double        optInThreshold );  /* From TA_REAL_MIN to TA_REAL_MAX */
+
+         #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    SubArray<double>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    SubArray<int>^  outInteger );
+
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    SubArray<float>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    SubArray<int>^  outInteger );
+
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    cli::array<double>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    cli::array<int>^  outInteger )
+         { return ThresholdEvents( startIdx,           endIdx,
+                                    gcnew SubArrayFrom1D<double>(inReal,0),
+                        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                       outBegIdx,
+                       outNBElement,
+                          gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    cli::array<float>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    cli::array<int>^  outInteger )
+         { return ThresholdEvents( startIdx,           endIdx,
+                                    gcnew SubArrayFrom1D<float>(inReal,0),
+                        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                       outBegIdx,
+                       outNBElement,
+                          gcnew SubArrayFrom1D<int>(outInteger,0) );
+         }
+         #elif defined( _MANAGED )
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    cli::array<double>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    cli::array<int>^  outInteger );
+         static enum class RetCode ThresholdEvents( int    startIdx,
+                                                    int    endIdx,
+                                                    cli::array<float>^ inReal,
+                                                    double        optInThreshold, /* From TA_REAL_MIN to TA_REAL_MAX */
+                                                    [Out]int%    outBegIdx,
+                                                    [Out]int%    outNBElement,
+                                                    cli::array<int>^  outInteger );
+         #endif
+
+         #define TA_THRESHOLD_EVENTS Core::ThresholdEvents
+         #define TA_THRESHOLD_EVENTS_Lookback Core::ThresholdEventsLookback
+
          static int TrueRangeLookback( void );
 
          #if defined( _MANAGED ) && defined( USE_SUBARRAY )
@@ -0,0 +1,810 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* DO NOT MODIFY this file.
+ * This file is automatically generated by gen_code.
+ *
+ * If you are not re-generating the java code (which is most
+ * likely the case), just ignore this file.
+ */
+
+package com.tictactec.ta.lib;
+
+import jdk.incubator.vector.DoubleVector;
+import jdk.incubator.vector.VectorMask;
+import jdk.incubator.vector.VectorOperators;
+import jdk.incubator.vector.VectorSpecies;
+
+/**
+ * Core with the element-wise functions (Math Operators, Math Transform
+ * and Price Transform) calculated with the Vector API.
+ * 
+ * <p>The Math Operators, SQRT and the Price Transform functions do the
+ * same operations in the same order as Core and give the same values.
+ * The other Math Transform functions (ACOS, ASIN, ATAN, COS, COSH, EXP,
+ * LN, LOG10, SIN, SINH, TAN and TANH) use the vector approximations of
+ * the JDK, which are within 1 ulp of the exact result like the
+ * java.lang.Math functions used by Core, but not always the same value:
+ * they may differ from Core by up to 2 ulps. Use Core when the output
+ * must be bit identical.
+ * 
+ * <p>This class is built separately by the "build-vector" ant target
+ * (JDK 16 or later) and needs "--add-modules jdk.incubator.vector" at
+ * run time. Use Core.newInstance() to get it when it is available.
+ */
+public class CoreVector extends Core {
+
+   private static final VectorSpecies<Double> SPECIES = DoubleVector.SPECIES_PREFERRED;
+
+   public CoreVector() {
+      super();
+   }
+
+   public CoreVector(Core that) {
+      super(that);
+   }
+
+   @Override
+   public RetCode acos( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.ACOS).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.ACOS).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode add( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx);
+         v0.add(v1).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx, mask);
+         v0.add(v1).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode asin( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.ASIN).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.ASIN).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode atan( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.ATAN).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.ATAN).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode avgPrice( int startIdx,
+      int endIdx,
+      double inOpen[],
+      double inHigh[],
+      double inLow[],
+      double inClose[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1, v2, v3;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inOpen, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx);
+         v2 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx);
+         v3 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx);
+         v1.add(v2).add(v3).add(v0).div(4.0).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inOpen, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx, mask);
+         v2 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx, mask);
+         v3 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx, mask);
+         v1.add(v2).add(v3).add(v0).div(4.0).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode cos( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.COS).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.COS).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode cosh( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.COSH).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.COSH).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode div( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx);
+         v0.div(v1).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx, mask);
+         v0.div(v1).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode exp( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.EXP).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.EXP).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode ln( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.LOG).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.LOG).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode log10( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.LOG10).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.LOG10).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode medPrice( int startIdx,
+      int endIdx,
+      double inHigh[],
+      double inLow[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx);
+         v0.add(v1).div(2.0).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx, mask);
+         v0.add(v1).div(2.0).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode mult( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx);
+         v0.mul(v1).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx, mask);
+         v0.mul(v1).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode sin( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.SIN).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.SIN).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode sinh( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.SINH).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.SINH).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode sqrt( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.SQRT).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.SQRT).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode sub( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx);
+         v0.sub(v1).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal0, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inReal1, startIdx+outIdx, mask);
+         v0.sub(v1).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode tan( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.TAN).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.TAN).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode tanh( int startIdx,
+      int endIdx,
+      double inReal[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx);
+         v0.lanewise(VectorOperators.TANH).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inReal, startIdx+outIdx, mask);
+         v0.lanewise(VectorOperators.TANH).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode typPrice( int startIdx,
+      int endIdx,
+      double inHigh[],
+      double inLow[],
+      double inClose[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1, v2;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx);
+         v2 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx);
+         v0.add(v1).add(v2).div(3.0).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx, mask);
+         v2 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx, mask);
+         v0.add(v1).add(v2).div(3.0).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+   @Override
+   public RetCode wclPrice( int startIdx,
+      int endIdx,
+      double inHigh[],
+      double inLow[],
+      double inClose[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx, nbElement, upperBound;
+      VectorMask<Double> mask;
+      DoubleVector v0, v1, v2;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      nbElement = endIdx-startIdx+1;
+      upperBound = SPECIES.loopBound(nbElement);
+      for( outIdx=0; outIdx < upperBound; outIdx += SPECIES.length() )
+      {
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx);
+         v2 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx);
+         v0.add(v1).add(v2.mul(2.0)).div(4.0).intoArray(outReal, outIdx);
+      }
+      if( outIdx < nbElement )
+      {
+         mask = SPECIES.indexInRange(outIdx, nbElement);
+         v0 = DoubleVector.fromArray(SPECIES, inHigh, startIdx+outIdx, mask);
+         v1 = DoubleVector.fromArray(SPECIES, inLow, startIdx+outIdx, mask);
+         v2 = DoubleVector.fromArray(SPECIES, inClose, startIdx+outIdx, mask);
+         v0.add(v1).add(v2.mul(2.0)).div(4.0).intoArray(outReal, outIdx, mask);
+      }
+      outNBElement.value = nbElement;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+
+}
+
+/***************
+ * End of File *
+ ***************/
@@ -37,6 +37,7 @@
  *  -------------------------------------------------------------------
  *  MF       Mario Fortier
  *  BT       Barry Tsung
+ *  AG       agent <agent@local>
  *
  * Change history:
  *
@@ -46,6 +47,8 @@
  *  022206 BT     1. initialization of candleSettings
  *                2. add SetCompatibility and GetCompatibility
  *                3. add SetUnstablePeriod, GetUnstablePeriod
+ *  101826 AG     Add copy constructor
+ *  101826 AG     Add newInstance to select the Vector API kernels
  */
 
 package com.tictactec.ta.lib;
@@ -70,6 +73,47 @@ public class Core {
       }
    }
    
+   /** Creates a new instance of Core with the same settings (unstable
+    *  periods, candle settings and compatibility) as another instance.
+    *  Use one instance per thread when calculating concurrently.
+    */
+   public Core(Core that) {
+      unstablePeriod = that.unstablePeriod.clone();
+      compatibility = that.compatibility;
+      candleSettings = new CandleSetting[that.candleSettings.length];
+      for(int i=0;i<candleSettings.length;i++){
+         candleSettings[i] = new CandleSetting(that.candleSettings[i]);
+      }
+   }
+   
+   /** Returns a new CoreVector when the Vector API kernels were built
+    *  (see the "build-vector" ant target) and the jdk.incubator.vector
+    *  module is available, else a new Core. Setting the system property
+    *  "ta-lib.vector" to "false" always returns a Core.
+    */
+   public static Core newInstance() {
+      return newInstance(null);
+   }
+   
+   /** Same as newInstance() but with the settings copied from another
+    *  instance (see Core(Core)). 
+    */
+   public static Core newInstance(Core settings) {
+      if (!"false".equals(System.getProperty("ta-lib.vector"))) {
+         try {
+            Class<?> vectorClass = Class.forName("com.tictactec.ta.lib.CoreVector");
+            if (settings == null)
+               return (Core) vectorClass.getConstructor().newInstance();
+            return (Core) vectorClass.getConstructor(Core.class).newInstance(settings);
+         } catch (Exception e) {
+            /* Not built. Fall back to the scalar code. */
+         } catch (LinkageError e) {
+            /* Vector API module not available. */
+         }
+      }
+      return (settings == null) ? new Core() : new Core(settings);
+   }
+   
    public RetCode SetCandleSettings(CandleSettingType settingType,
       RangeType rangeType, int avgPeriod, double factor) {
       if (settingType.ordinal() >= CandleSettingType.AllCandleSettings
@@ -12402,6 +12446,128 @@ public class Core {
       return RetCode.Success ;
    }
    /* Generated */
+   public int crossOverLookback( )
+   {
+      return 1;
+   }
+   public RetCode crossOver( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+         outInteger[outIdx++] = ((inReal0[i] > inReal1[i]) & (inReal0[i-1] <= inReal1[i-1]))? 100 : 0;
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   public RetCode crossOver( int startIdx,
+      int endIdx,
+      float inReal0[],
+      float inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+         outInteger[outIdx++] = ((inReal0[i] > inReal1[i]) & (inReal0[i-1] <= inReal1[i-1]))? 100 : 0;
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   /* Generated */
+   public int crossUnderLookback( )
+   {
+      return 1;
+   }
+   public RetCode crossUnder( int startIdx,
+      int endIdx,
+      double inReal0[],
+      double inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+         outInteger[outIdx++] = ((inReal0[i] < inReal1[i]) & (inReal0[i-1] >= inReal1[i-1]))? 100 : 0;
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   public RetCode crossUnder( int startIdx,
+      int endIdx,
+      float inReal0[],
+      float inReal1[],
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+         outInteger[outIdx++] = ((inReal0[i] < inReal1[i]) & (inReal0[i-1] >= inReal1[i-1]))? 100 : 0;
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   /* Generated */
    public int demaLookback( int optInTimePeriod )
    {
       if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
@@ -13422,10 +13588,9 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, constDeg2RadBy360;
+      double rad2Deg;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
-      int idx;
       int DCPeriodInt;
       double DCPhase, DCPeriod, imagPart, realPart;
       if( startIdx < 0 )
@@ -13435,7 +13600,6 @@ public class Core {
       { smoothPrice = new double[maxIdx_smoothPrice +1]; } ;
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtDcPhase.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -13530,20 +13694,7 @@ public class Core {
          smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -13595,10 +13746,9 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, constDeg2RadBy360;
+      double rad2Deg;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
-      int idx;
       int DCPeriodInt;
       double DCPhase, DCPeriod, imagPart, realPart;
       if( startIdx < 0 )
@@ -13608,7 +13758,6 @@ public class Core {
       { smoothPrice = new double[maxIdx_smoothPrice +1]; } ;
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtDcPhase.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -13703,20 +13852,7 @@ public class Core {
          smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -14047,10 +14183,9 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, deg2Rad, constDeg2RadBy360;
+      double rad2Deg, deg2Rad;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
-      int idx;
       int DCPeriodInt;
       double DCPhase, DCPeriod, imagPart, realPart;
       if( startIdx < 0 )
@@ -14061,7 +14196,6 @@ public class Core {
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
       deg2Rad = 1.0/rad2Deg;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtSine.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -14156,20 +14290,7 @@ public class Core {
          smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -14223,10 +14344,9 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, deg2Rad, constDeg2RadBy360;
+      double rad2Deg, deg2Rad;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
-      int idx;
       int DCPeriodInt;
       double DCPhase, DCPeriod, imagPart, realPart;
       if( startIdx < 0 )
@@ -14237,7 +14357,6 @@ public class Core {
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
       deg2Rad = 1.0/rad2Deg;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtSine.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -14332,20 +14451,7 @@ public class Core {
          smoothPeriod = (0.33*period)+(0.67*smoothPeriod);
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -14715,7 +14821,7 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, deg2Rad, constDeg2RadBy360;
+      double rad2Deg, deg2Rad;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
       int idx;
@@ -14737,7 +14843,6 @@ public class Core {
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
       deg2Rad = 1.0/rad2Deg;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtTrendMode.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -14833,20 +14938,7 @@ public class Core {
          prevDCPhase = DCPhase;
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -14934,7 +15026,7 @@ public class Core {
       double Q2, I2, prevQ2, prevI2, Re, Im;
       double I1ForOddPrev2, I1ForOddPrev3;
       double I1ForEvenPrev2, I1ForEvenPrev3;
-      double rad2Deg, deg2Rad, constDeg2RadBy360;
+      double rad2Deg, deg2Rad;
       double todayValue, smoothPeriod;
       int smoothPrice_Idx = 0; double []smoothPrice; int maxIdx_smoothPrice = ( 50 -1) ;
       int idx;
@@ -14956,7 +15048,6 @@ public class Core {
       tempReal = Math.atan (1);
       rad2Deg = 45.0/tempReal;
       deg2Rad = 1.0/rad2Deg;
-      constDeg2RadBy360 = tempReal*8.0;
       lookbackTotal = 63 + (this.unstablePeriod[FuncUnstId.HtTrendMode.ordinal()]) ;
       if( startIdx < lookbackTotal )
          startIdx = lookbackTotal;
@@ -15052,20 +15143,7 @@ public class Core {
          prevDCPhase = DCPhase;
          DCPeriod = smoothPeriod+0.5;
          DCPeriodInt = (int)DCPeriod;
-         realPart = 0.0;
-         imagPart = 0.0;
-         idx = smoothPrice_Idx;
-         for( i=0; i < DCPeriodInt; i++ )
-         {
-            tempReal = ((double)i*constDeg2RadBy360)/(double)DCPeriodInt;
-            tempReal2 = smoothPrice[idx];
-            realPart += Math.sin (tempReal)*tempReal2;
-            imagPart += Math.cos (tempReal)*tempReal2;
-            if( idx == 0 )
-               idx = 50 -1;
-            else
-               idx--;
-         }
+         { int dftIdx, dftI; double dftConst, dftAngle, dftPrice; dftConst = Math.atan (1)*8.0; realPart = 0.0; imagPart = 0.0; dftIdx = smoothPrice_Idx; for( dftI=0; dftI < DCPeriodInt; dftI++ ) { dftAngle = ((double)dftI*dftConst)/(double)DCPeriodInt; dftPrice = smoothPrice[dftIdx]; realPart += Math.sin (dftAngle)*dftPrice; imagPart += Math.cos (dftAngle)*dftPrice; if( dftIdx == 0 ) dftIdx = 50 -1; else dftIdx--; } };
          tempReal = Math.abs (imagPart);
          if( tempReal > 0.0 )
             DCPhase = Math.atan (realPart/imagPart)*rad2Deg;
@@ -16813,6 +16891,55 @@ public class Core {
          outMACDHist );
    }
    /* Generated */
+   public int medianAbsDevLookback( int optInTimePeriod )
+   {
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return -1;
+      return optInTimePeriod-1;
+   }
+   public RetCode medianAbsDev( int startIdx,
+      int endIdx,
+      double inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, 0.5, 1,
+         outBegIdx, outNBElement, outReal );
+   }
+   public RetCode medianAbsDev( int startIdx,
+      int endIdx,
+      float inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, 0.5, 1,
+         outBegIdx, outNBElement, outReal );
+   }
+   /* Generated */
    public int mamaLookback( double optInFastLimit,
       double optInSlowLimit )
    {
@@ -17187,6 +17314,7 @@ public class Core {
       int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
       int []localPeriodArray ;
       double []localOutputArray ;
+      double []outArray ;
       MInteger localBegIdx = new MInteger() ;
       MInteger localNbElement = new MInteger() ;
       RetCode retCode;
@@ -17233,6 +17361,10 @@ public class Core {
             tempInt = optInMaxPeriod;
          localPeriodArray[i] = tempInt;
       }
+      if( outReal == inReal )
+         outArray = new double[outputSize] ;
+      else
+         outArray = outReal;
       for( i=0; i < outputSize; i++ )
       {
          curPeriod = localPeriodArray[i];
@@ -17247,17 +17379,21 @@ public class Core {
                outNBElement.value = 0 ;
                return retCode;
             }
-            outReal[i] = localOutputArray[i];
+            outArray[i] = localOutputArray[i];
             for( j=i+1; j < outputSize; j++ )
             {
                if( localPeriodArray[j] == curPeriod )
                {
                   localPeriodArray[j] = 0;
-                  outReal[j] = localOutputArray[j];
+                  outArray[j] = localOutputArray[j];
                }
             }
          }
       }
+      if( outArray != outReal )
+      {
+         System.arraycopy(outArray,0,outReal,0,outputSize);
+      }
       outBegIdx.value = startIdx;
       outNBElement.value = outputSize;
       return RetCode.Success ;
@@ -17276,6 +17412,7 @@ public class Core {
       int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
       int []localPeriodArray ;
       double []localOutputArray ;
+      double []outArray ;
       MInteger localBegIdx = new MInteger() ;
       MInteger localNbElement = new MInteger() ;
       RetCode retCode;
@@ -17322,6 +17459,7 @@ public class Core {
             tempInt = optInMaxPeriod;
          localPeriodArray[i] = tempInt;
       }
+      outArray = outReal;
       for( i=0; i < outputSize; i++ )
       {
          curPeriod = localPeriodArray[i];
@@ -17336,17 +17474,21 @@ public class Core {
                outNBElement.value = 0 ;
                return retCode;
             }
-            outReal[i] = localOutputArray[i];
+            outArray[i] = localOutputArray[i];
             for( j=i+1; j < outputSize; j++ )
             {
                if( localPeriodArray[j] == curPeriod )
                {
                   localPeriodArray[j] = 0;
-                  outReal[j] = localOutputArray[j];
+                  outArray[j] = localOutputArray[j];
                }
             }
          }
       }
+      if( outArray != outReal )
+      {
+         System.arraycopy(outArray,0,outReal,0,outputSize);
+      }
       outBegIdx.value = startIdx;
       outNBElement.value = outputSize;
       return RetCode.Success ;
@@ -17626,6 +17768,55 @@ public class Core {
       return RetCode.Success ;
    }
    /* Generated */
+   public int medianLookback( int optInTimePeriod )
+   {
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return -1;
+      return optInTimePeriod-1;
+   }
+   public RetCode median( int startIdx,
+      int endIdx,
+      double inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, 0.5, 0,
+         outBegIdx, outNBElement, outReal );
+   }
+   public RetCode median( int startIdx,
+      int endIdx,
+      float inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, 0.5, 0,
+         outBegIdx, outNBElement, outReal );
+   }
+   /* Generated */
    public int medPriceLookback( )
    {
       return 0;
@@ -19605,7 +19796,7 @@ public class Core {
          if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
             outReal[outIdx] = (prevATR/tempValue)*100.0;
          else
-            outReal[0] = 0.0;
+            outReal[outIdx] = 0.0;
          outIdx++;
       }
       outBegIdx.value = startIdx;
@@ -19695,7 +19886,7 @@ public class Core {
          if( ! (((- (0.00000000000001) )<tempValue)&&(tempValue< (0.00000000000001) )) )
             outReal[outIdx] = (prevATR/tempValue)*100.0;
          else
-            outReal[0] = 0.0;
+            outReal[outIdx] = 0.0;
          outIdx++;
       }
       outBegIdx.value = startIdx;
@@ -20423,6 +20614,418 @@ public class Core {
       return retCode;
    }
    /* Generated */
+   public int quantileLookback( int optInTimePeriod,
+      double optInQuantile )
+   {
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return -1;
+      if( optInQuantile == (-4e+37) )
+         optInQuantile = 5.000000e-1;
+      else if( (optInQuantile < 0.000000e+0) || (optInQuantile > 1.000000e+0) )
+         return -1;
+      return optInTimePeriod-1;
+   }
+   public RetCode quantile( int startIdx,
+      int endIdx,
+      double inReal[],
+      int optInTimePeriod,
+      double optInQuantile,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      if( optInQuantile == (-4e+37) )
+         optInQuantile = 5.000000e-1;
+      else if( (optInQuantile < 0.000000e+0) || (optInQuantile > 1.000000e+0) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, optInQuantile, 0,
+         outBegIdx, outNBElement, outReal );
+   }
+   public RetCode TA_INT_QUANTILE( int startIdx,
+      int endIdx,
+      double inReal[],
+      int optInTimePeriod,
+      double optInQuantile,
+      int calcAbsDev,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      double []key ;
+      int []tree ;
+      double fraction, value, highValue, center, tempReal, tempReal2;
+      int i, outIdx, nbInitialElementNeeded, lowRank, nbRank, nbBelow, nbAbove;
+      int slot, node, child, seed, rank, j, lo, hi, mid;
+      int treeRoot, treeParent, treeGrandParent, treeChild, treeNode, treeRank;
+      nbInitialElementNeeded = (optInTimePeriod-1);
+      if( startIdx < nbInitialElementNeeded )
+         startIdx = nbInitialElementNeeded;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      fraction = optInQuantile*(optInTimePeriod-1);
+      lowRank = (int)fraction;
+      fraction -= lowRank;
+      if( lowRank >= optInTimePeriod-1 )
+      {
+         lowRank = optInTimePeriod-1;
+         fraction = 0.0;
+      }
+      nbRank = (fraction > 0.0)? 2 : 1;
+      key = new double[optInTimePeriod] ;
+      tree = new int[5*optInTimePeriod] ;
+      seed = 1;
+      for( slot=0; slot < optInTimePeriod; slot++ )
+      {
+         seed = 16807*(seed%127773) - 2836*(seed/127773);
+         if( seed <= 0 )
+            seed += 2147483647;
+         tree[(4*optInTimePeriod)+(slot)] = seed;
+      }
+      treeRoot = (-1) ;
+      slot = 0;
+      outIdx = 0;
+      i = startIdx-nbInitialElementNeeded;
+      do
+      {
+         if( (treeRoot != (-1)) && (tree[(3*optInTimePeriod)+(treeRoot)] == optInTimePeriod) )
+         {
+            while( (tree[(slot)] != (-1)) && (tree[optInTimePeriod+(slot)] != (-1)) )
+            {
+               if( tree[(4*optInTimePeriod)+(tree[(slot)])] > tree[(4*optInTimePeriod)+(tree[optInTimePeriod+(slot)])] )
+                  child = tree[(slot)];
+               else
+                  child = tree[optInTimePeriod+(slot)];
+               { treeParent = tree[(2*optInTimePeriod)+(child)]; treeGrandParent = tree[(2*optInTimePeriod)+(treeParent)]; if( tree[(treeParent)] == (child) ) { treeChild = tree[optInTimePeriod+(child)]; tree[(treeParent)] = treeChild; tree[optInTimePeriod+(child)] = treeParent; } else { treeChild = tree[(child)]; tree[optInTimePeriod+(treeParent)] = treeChild; tree[(child)] = treeParent; } if( treeChild != (-1) ) tree[(2*optInTimePeriod)+(treeChild)] = treeParent; tree[(2*optInTimePeriod)+(treeParent)] = (child); tree[(2*optInTimePeriod)+(child)] = treeGrandParent; if( treeGrandParent == (-1) ) treeRoot = (child); else if( tree[(treeGrandParent)] == treeParent ) tree[(treeGrandParent)] = (child); else tree[optInTimePeriod+(treeGrandParent)] = (child); tree[(3*optInTimePeriod)+(child)] = tree[(3*optInTimePeriod)+(treeParent)]; tree[(3*optInTimePeriod)+(treeParent)] = 1+(((tree[(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeParent)])])+(((tree[optInTimePeriod+(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[optInTimePeriod+(treeParent)])]); } ;
+            }
+            child = (tree[(slot)] != (-1))? tree[(slot)] : tree[optInTimePeriod+(slot)];
+            node = tree[(2*optInTimePeriod)+(slot)];
+            if( child != (-1) )
+               tree[(2*optInTimePeriod)+(child)] = node;
+            if( node == (-1) )
+               treeRoot = child;
+            else if( tree[(node)] == slot )
+               tree[(node)] = child;
+            else
+               tree[optInTimePeriod+(node)] = child;
+            while( node != (-1) )
+            {
+               tree[(3*optInTimePeriod)+(node)]--;
+               node = tree[(2*optInTimePeriod)+(node)];
+            }
+         }
+         key[slot] = inReal[i++];
+         tree[(slot)] = (-1) ;
+         tree[optInTimePeriod+(slot)] = (-1) ;
+         tree[(2*optInTimePeriod)+(slot)] = (-1) ;
+         tree[(3*optInTimePeriod)+(slot)] = 1;
+         if( treeRoot == (-1) )
+            treeRoot = slot;
+         else
+         {
+            node = treeRoot;
+            for( ;; )
+            {
+               tree[(3*optInTimePeriod)+(node)]++;
+               if( key[slot] < key[node] )
+               {
+                  if( tree[(node)] == (-1) )
+                  {
+                     tree[(node)] = slot;
+                     break;
+                  }
+                  node = tree[(node)];
+               }
+               else
+               {
+                  if( tree[optInTimePeriod+(node)] == (-1) )
+                  {
+                     tree[optInTimePeriod+(node)] = slot;
+                     break;
+                  }
+                  node = tree[optInTimePeriod+(node)];
+               }
+            }
+            tree[(2*optInTimePeriod)+(slot)] = node;
+            while( (tree[(2*optInTimePeriod)+(slot)] != (-1)) &&
+               (tree[(4*optInTimePeriod)+(slot)] > tree[(4*optInTimePeriod)+(tree[(2*optInTimePeriod)+(slot)])]) )
+            {
+               { treeParent = tree[(2*optInTimePeriod)+(slot)]; treeGrandParent = tree[(2*optInTimePeriod)+(treeParent)]; if( tree[(treeParent)] == (slot) ) { treeChild = tree[optInTimePeriod+(slot)]; tree[(treeParent)] = treeChild; tree[optInTimePeriod+(slot)] = treeParent; } else { treeChild = tree[(slot)]; tree[optInTimePeriod+(treeParent)] = treeChild; tree[(slot)] = treeParent; } if( treeChild != (-1) ) tree[(2*optInTimePeriod)+(treeChild)] = treeParent; tree[(2*optInTimePeriod)+(treeParent)] = (slot); tree[(2*optInTimePeriod)+(slot)] = treeGrandParent; if( treeGrandParent == (-1) ) treeRoot = (slot); else if( tree[(treeGrandParent)] == treeParent ) tree[(treeGrandParent)] = (slot); else tree[optInTimePeriod+(treeGrandParent)] = (slot); tree[(3*optInTimePeriod)+(slot)] = tree[(3*optInTimePeriod)+(treeParent)]; tree[(3*optInTimePeriod)+(treeParent)] = 1+(((tree[(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeParent)])])+(((tree[optInTimePeriod+(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[optInTimePeriod+(treeParent)])]); } ;
+            }
+         }
+         if( ++slot == optInTimePeriod )
+            slot = 0;
+         if( i > startIdx )
+         {
+            { treeRank = (lowRank); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } value = key[treeNode]; } ;
+            if( nbRank == 2 )
+            {
+               { treeRank = (lowRank+1); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } highValue = key[treeNode]; } ;
+               value += fraction*(highValue-value);
+            }
+            if( calcAbsDev != 0 )
+            {
+               center = value;
+               nbBelow = lowRank+1;
+               nbAbove = optInTimePeriod-nbBelow;
+               for( j=0; j < nbRank; j++ )
+               {
+                  rank = lowRank+j;
+                  lo = rank+1-nbAbove;
+                  if( lo < 0 )
+                     lo = 0;
+                  hi = rank+1;
+                  if( hi > nbBelow )
+                     hi = nbBelow;
+                  while( lo < hi )
+                  {
+                     mid = (lo+hi)>>1;
+                     { treeRank = (nbBelow+rank-mid); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal = key[treeNode]; } ;
+                     { treeRank = (lowRank-mid); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     if( (tempReal-center) > (center-tempReal2) )
+                        lo = mid+1;
+                     else
+                        hi = mid;
+                  }
+                  tempReal = 0.0;
+                  if( lo > 0 )
+                  {
+                     { treeRank = (lowRank-lo+1); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     tempReal = center-tempReal2;
+                  }
+                  if( lo < rank+1 )
+                  {
+                     { treeRank = (nbBelow+rank-lo); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     if( (tempReal2-center) > tempReal )
+                        tempReal = tempReal2-center;
+                  }
+                  if( j == 0 )
+                     value = tempReal;
+                  else
+                     value += fraction*(tempReal-value);
+               }
+            }
+            outReal[outIdx++] = value;
+         }
+      } while( i <= endIdx );
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   public RetCode quantile( int startIdx,
+      int endIdx,
+      float inReal[],
+      int optInTimePeriod,
+      double optInQuantile,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
+         optInTimePeriod = 14;
+      else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+         return RetCode.BadParam ;
+      if( optInQuantile == (-4e+37) )
+         optInQuantile = 5.000000e-1;
+      else if( (optInQuantile < 0.000000e+0) || (optInQuantile > 1.000000e+0) )
+         return RetCode.BadParam ;
+      return TA_INT_QUANTILE( startIdx, endIdx, inReal,
+         optInTimePeriod, optInQuantile, 0,
+         outBegIdx, outNBElement, outReal );
+   }
+   public RetCode TA_INT_QUANTILE( int startIdx,
+      int endIdx,
+      float inReal[],
+      int optInTimePeriod,
+      double optInQuantile,
+      int calcAbsDev,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      double []key ;
+      int []tree ;
+      double fraction, value, highValue, center, tempReal, tempReal2;
+      int i, outIdx, nbInitialElementNeeded, lowRank, nbRank, nbBelow, nbAbove;
+      int slot, node, child, seed, rank, j, lo, hi, mid;
+      int treeRoot, treeParent, treeGrandParent, treeChild, treeNode, treeRank;
+      nbInitialElementNeeded = (optInTimePeriod-1);
+      if( startIdx < nbInitialElementNeeded )
+         startIdx = nbInitialElementNeeded;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      fraction = optInQuantile*(optInTimePeriod-1);
+      lowRank = (int)fraction;
+      fraction -= lowRank;
+      if( lowRank >= optInTimePeriod-1 )
+      {
+         lowRank = optInTimePeriod-1;
+         fraction = 0.0;
+      }
+      nbRank = (fraction > 0.0)? 2 : 1;
+      key = new double[optInTimePeriod] ;
+      tree = new int[5*optInTimePeriod] ;
+      seed = 1;
+      for( slot=0; slot < optInTimePeriod; slot++ )
+      {
+         seed = 16807*(seed%127773) - 2836*(seed/127773);
+         if( seed <= 0 )
+            seed += 2147483647;
+         tree[(4*optInTimePeriod)+(slot)] = seed;
+      }
+      treeRoot = (-1) ;
+      slot = 0;
+      outIdx = 0;
+      i = startIdx-nbInitialElementNeeded;
+      do
+      {
+         if( (treeRoot != (-1)) && (tree[(3*optInTimePeriod)+(treeRoot)] == optInTimePeriod) )
+         {
+            while( (tree[(slot)] != (-1)) && (tree[optInTimePeriod+(slot)] != (-1)) )
+            {
+               if( tree[(4*optInTimePeriod)+(tree[(slot)])] > tree[(4*optInTimePeriod)+(tree[optInTimePeriod+(slot)])] )
+                  child = tree[(slot)];
+               else
+                  child = tree[optInTimePeriod+(slot)];
+               { treeParent = tree[(2*optInTimePeriod)+(child)]; treeGrandParent = tree[(2*optInTimePeriod)+(treeParent)]; if( tree[(treeParent)] == (child) ) { treeChild = tree[optInTimePeriod+(child)]; tree[(treeParent)] = treeChild; tree[optInTimePeriod+(child)] = treeParent; } else { treeChild = tree[(child)]; tree[optInTimePeriod+(treeParent)] = treeChild; tree[(child)] = treeParent; } if( treeChild != (-1) ) tree[(2*optInTimePeriod)+(treeChild)] = treeParent; tree[(2*optInTimePeriod)+(treeParent)] = (child); tree[(2*optInTimePeriod)+(child)] = treeGrandParent; if( treeGrandParent == (-1) ) treeRoot = (child); else if( tree[(treeGrandParent)] == treeParent ) tree[(treeGrandParent)] = (child); else tree[optInTimePeriod+(treeGrandParent)] = (child); tree[(3*optInTimePeriod)+(child)] = tree[(3*optInTimePeriod)+(treeParent)]; tree[(3*optInTimePeriod)+(treeParent)] = 1+(((tree[(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeParent)])])+(((tree[optInTimePeriod+(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[optInTimePeriod+(treeParent)])]); } ;
+            }
+            child = (tree[(slot)] != (-1))? tree[(slot)] : tree[optInTimePeriod+(slot)];
+            node = tree[(2*optInTimePeriod)+(slot)];
+            if( child != (-1) )
+               tree[(2*optInTimePeriod)+(child)] = node;
+            if( node == (-1) )
+               treeRoot = child;
+            else if( tree[(node)] == slot )
+               tree[(node)] = child;
+            else
+               tree[optInTimePeriod+(node)] = child;
+            while( node != (-1) )
+            {
+               tree[(3*optInTimePeriod)+(node)]--;
+               node = tree[(2*optInTimePeriod)+(node)];
+            }
+         }
+         key[slot] = inReal[i++];
+         tree[(slot)] = (-1) ;
+         tree[optInTimePeriod+(slot)] = (-1) ;
+         tree[(2*optInTimePeriod)+(slot)] = (-1) ;
+         tree[(3*optInTimePeriod)+(slot)] = 1;
+         if( treeRoot == (-1) )
+            treeRoot = slot;
+         else
+         {
+            node = treeRoot;
+            for( ;; )
+            {
+               tree[(3*optInTimePeriod)+(node)]++;
+               if( key[slot] < key[node] )
+               {
+                  if( tree[(node)] == (-1) )
+                  {
+                     tree[(node)] = slot;
+                     break;
+                  }
+                  node = tree[(node)];
+               }
+               else
+               {
+                  if( tree[optInTimePeriod+(node)] == (-1) )
+                  {
+                     tree[optInTimePeriod+(node)] = slot;
+                     break;
+                  }
+                  node = tree[optInTimePeriod+(node)];
+               }
+            }
+            tree[(2*optInTimePeriod)+(slot)] = node;
+            while( (tree[(2*optInTimePeriod)+(slot)] != (-1)) &&
+               (tree[(4*optInTimePeriod)+(slot)] > tree[(4*optInTimePeriod)+(tree[(2*optInTimePeriod)+(slot)])]) )
+            {
+               { treeParent = tree[(2*optInTimePeriod)+(slot)]; treeGrandParent = tree[(2*optInTimePeriod)+(treeParent)]; if( tree[(treeParent)] == (slot) ) { treeChild = tree[optInTimePeriod+(slot)]; tree[(treeParent)] = treeChild; tree[optInTimePeriod+(slot)] = treeParent; } else { treeChild = tree[(slot)]; tree[optInTimePeriod+(treeParent)] = treeChild; tree[(slot)] = treeParent; } if( treeChild != (-1) ) tree[(2*optInTimePeriod)+(treeChild)] = treeParent; tree[(2*optInTimePeriod)+(treeParent)] = (slot); tree[(2*optInTimePeriod)+(slot)] = treeGrandParent; if( treeGrandParent == (-1) ) treeRoot = (slot); else if( tree[(treeGrandParent)] == treeParent ) tree[(treeGrandParent)] = (slot); else tree[optInTimePeriod+(treeGrandParent)] = (slot); tree[(3*optInTimePeriod)+(slot)] = tree[(3*optInTimePeriod)+(treeParent)]; tree[(3*optInTimePeriod)+(treeParent)] = 1+(((tree[(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeParent)])])+(((tree[optInTimePeriod+(treeParent)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[optInTimePeriod+(treeParent)])]); } ;
+            }
+         }
+         if( ++slot == optInTimePeriod )
+            slot = 0;
+         if( i > startIdx )
+         {
+            { treeRank = (lowRank); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } value = key[treeNode]; } ;
+            if( nbRank == 2 )
+            {
+               { treeRank = (lowRank+1); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } highValue = key[treeNode]; } ;
+               value += fraction*(highValue-value);
+            }
+            if( calcAbsDev != 0 )
+            {
+               center = value;
+               nbBelow = lowRank+1;
+               nbAbove = optInTimePeriod-nbBelow;
+               for( j=0; j < nbRank; j++ )
+               {
+                  rank = lowRank+j;
+                  lo = rank+1-nbAbove;
+                  if( lo < 0 )
+                     lo = 0;
+                  hi = rank+1;
+                  if( hi > nbBelow )
+                     hi = nbBelow;
+                  while( lo < hi )
+                  {
+                     mid = (lo+hi)>>1;
+                     { treeRank = (nbBelow+rank-mid); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal = key[treeNode]; } ;
+                     { treeRank = (lowRank-mid); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     if( (tempReal-center) > (center-tempReal2) )
+                        lo = mid+1;
+                     else
+                        hi = mid;
+                  }
+                  tempReal = 0.0;
+                  if( lo > 0 )
+                  {
+                     { treeRank = (lowRank-lo+1); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     tempReal = center-tempReal2;
+                  }
+                  if( lo < rank+1 )
+                  {
+                     { treeRank = (nbBelow+rank-lo); treeNode = treeRoot; while( treeRank != (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) { if( treeRank < (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])]) ) treeNode = tree[(treeNode)]; else { treeRank -= (((tree[(treeNode)])==(-1))?0:tree[(3*optInTimePeriod)+(tree[(treeNode)])])+1; treeNode = tree[optInTimePeriod+(treeNode)]; } } tempReal2 = key[treeNode]; } ;
+                     if( (tempReal2-center) > tempReal )
+                        tempReal = tempReal2-center;
+                  }
+                  if( j == 0 )
+                     value = tempReal;
+                  else
+                     value += fraction*(tempReal-value);
+               }
+            }
+            outReal[outIdx++] = value;
+         }
+      } while( i <= endIdx );
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   /* Generated */
    public int rocLookback( int optInTimePeriod )
    {
       if( (int)optInTimePeriod == ( Integer.MIN_VALUE ) )
@@ -20815,10 +21418,6 @@ public class Core {
       MInteger outNBElement,
       double outReal[] )
    {
-      int outIdx;
-      int today, lookbackTotal, unstablePeriod, i;
-      double prevGain, prevLoss, prevValue, savePrevValue;
-      double tempValue1, tempValue2;
       if( startIdx < 0 )
          return RetCode.OutOfRangeStartIndex ;
       if( (endIdx < 0) || (endIdx < startIdx))
@@ -20827,6 +21426,22 @@ public class Core {
          optInTimePeriod = 14;
       else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
          return RetCode.BadParam ;
+      return TA_INT_RSI ( startIdx, endIdx,
+         inReal, optInTimePeriod,
+         outBegIdx, outNBElement, outReal );
+   }
+   RetCode TA_INT_RSI( int startIdx,
+      int endIdx,
+      double inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx;
+      int today, lookbackTotal, unstablePeriod, i;
+      double prevGain, prevLoss, prevValue, savePrevValue;
+      double tempValue1, tempValue2;
       outBegIdx.value = 0 ;
       outNBElement.value = 0 ;
       lookbackTotal = rsiLookback ( optInTimePeriod );
@@ -20950,11 +21565,6 @@ public class Core {
       MInteger outNBElement,
       double outReal[] )
    {
-      int outIdx;
-      int today, lookbackTotal, unstablePeriod, i;
-      double prevGain, prevLoss, prevValue, savePrevValue;
-      double tempValue1, tempValue2;
-      int mmmixi, mmmixdestIdx, mmmixsrcIdx ;
       if( startIdx < 0 )
          return RetCode.OutOfRangeStartIndex ;
       if( (endIdx < 0) || (endIdx < startIdx))
@@ -20963,6 +21573,23 @@ public class Core {
          optInTimePeriod = 14;
       else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
          return RetCode.BadParam ;
+      return TA_INT_RSI ( startIdx, endIdx,
+         inReal, optInTimePeriod,
+         outBegIdx, outNBElement, outReal );
+   }
+   RetCode TA_INT_RSI( int startIdx,
+      int endIdx,
+      float inReal[],
+      int optInTimePeriod,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      double outReal[] )
+   {
+      int outIdx;
+      int today, lookbackTotal, unstablePeriod, i;
+      double prevGain, prevLoss, prevValue, savePrevValue;
+      double tempValue1, tempValue2;
+      int mmmixi, mmmixdestIdx, mmmixsrcIdx ;
       outBegIdx.value = 0 ;
       outNBElement.value = 0 ;
       lookbackTotal = rsiLookback ( optInTimePeriod );
@@ -22425,12 +23052,6 @@ public class Core {
       {
          tempBuffer = outSlowK;
       }
-      else if( (outSlowD == inHigh) ||
-         (outSlowD == inLow) ||
-         (outSlowD == inClose) )
-      {
-         tempBuffer = outSlowD;
-      }
       else
       {
          tempBuffer = new double[endIdx-today+1] ;
@@ -22719,12 +23340,6 @@ public class Core {
       {
          tempBuffer = outFastK;
       }
-      else if( (outFastD == inHigh) ||
-         (outFastD == inLow) ||
-         (outFastD == inClose) )
-      {
-         tempBuffer = outFastD;
-      }
       else
       {
          tempBuffer = new double[endIdx-today+1] ;
@@ -23773,6 +24388,85 @@ public class Core {
       return RetCode.Success ;
    }
    /* Generated */
+   public int thresholdEventsLookback( double optInThreshold )
+   {
+      if( optInThreshold == (-4e+37) )
+         optInThreshold = 0.000000e+0;
+      else if( (optInThreshold < -3.000000e+37) || (optInThreshold > 3.000000e+37) )
+         return -1;
+      return 1;
+   }
+   public RetCode thresholdEvents( int startIdx,
+      int endIdx,
+      double inReal[],
+      double optInThreshold,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( optInThreshold == (-4e+37) )
+         optInThreshold = 0.000000e+0;
+      else if( (optInThreshold < -3.000000e+37) || (optInThreshold > 3.000000e+37) )
+         return RetCode.BadParam ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+      {
+         outInteger[outIdx++] = (((inReal[i] > optInThreshold) & (inReal[i-1] <= optInThreshold))? 100 : 0)
+            -(((inReal[i] < optInThreshold) & (inReal[i-1] >= optInThreshold))? 100 : 0);
+      }
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   public RetCode thresholdEvents( int startIdx,
+      int endIdx,
+      float inReal[],
+      double optInThreshold,
+      MInteger outBegIdx,
+      MInteger outNBElement,
+      int outInteger[] )
+   {
+      int i, outIdx;
+      if( startIdx < 0 )
+         return RetCode.OutOfRangeStartIndex ;
+      if( (endIdx < 0) || (endIdx < startIdx))
+         return RetCode.OutOfRangeEndIndex ;
+      if( optInThreshold == (-4e+37) )
+         optInThreshold = 0.000000e+0;
+      else if( (optInThreshold < -3.000000e+37) || (optInThreshold > 3.000000e+37) )
+         return RetCode.BadParam ;
+      if( startIdx < 1 )
+         startIdx = 1;
+      if( startIdx > endIdx )
+      {
+         outBegIdx.value = 0 ;
+         outNBElement.value = 0 ;
+         return RetCode.Success ;
+      }
+      outIdx = 0;
+      for( i=startIdx; i <= endIdx; i++ )
+      {
+         outInteger[outIdx++] = (((inReal[i] > optInThreshold) & (inReal[i-1] <= optInThreshold))? 100 : 0)
+            -(((inReal[i] < optInThreshold) & (inReal[i-1] >= optInThreshold))? 100 : 0);
+      }
+      outNBElement.value = outIdx;
+      outBegIdx.value = startIdx;
+      return RetCode.Success ;
+   }
+   /* Generated */
    public int trueRangeLookback( )
    {
       return 1;
@@ -36,12 +36,15 @@
  *  Initial  Name/description
  *  -------------------------------------------------------------------
  *  RG       Richard Gomes
+ *  AG       agent <agent@local>
  *
  * Change history:
  *
  *  YYYYMMDD BY     Description
  *  -------------------------------------------------------------------
  *  20070311 RG     First Version
+ *  20261018 AG     Calls through a precompiled TaFuncInvoker
+ *  20261018 AG     Accessors for TaFuncBatch
  */
 
 package com.tictactec.ta.lib.meta;
@@ -62,6 +65,7 @@ import com.tictactec.ta.lib.MAType;
 import com.tictactec.ta.lib.MInteger;
 import com.tictactec.ta.lib.RetCode;
 import com.tictactec.ta.lib.meta.annotation.FuncInfo;
+import com.tictactec.ta.lib.meta.annotation.InputFlags;
 import com.tictactec.ta.lib.meta.annotation.InputParameterInfo;
 import com.tictactec.ta.lib.meta.annotation.InputParameterType;
 import com.tictactec.ta.lib.meta.annotation.IntegerList;
@@ -107,11 +111,17 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
     private static transient final Class<CoreAnnotated> coreClass = CoreAnnotated.class;
     private static transient final String LOOKBACK_SUFFIX = "Lookback";
 
+    // Price components, in the order they are passed to the TA functions.
+    private static transient final int PRICE_FLAGS[] = {
+        InputFlags.TA_IN_PRICE_OPEN, InputFlags.TA_IN_PRICE_HIGH, InputFlags.TA_IN_PRICE_LOW,
+        InputFlags.TA_IN_PRICE_CLOSE, InputFlags.TA_IN_PRICE_VOLUME, InputFlags.TA_IN_PRICE_OPENINTEREST };
+
     private static transient CoreAnnotated taCore = null;
 
     private String name = null;
     private Method function = null;
     private Method lookback = null;
+    private TaFuncInvoker invoker = null;
     
     private static transient Map<String, CoreMetaData> taFuncMap = null;
     private static transient Map<String, Set<CoreMetaData> > taGrpMap = null;
@@ -119,6 +129,20 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
     private transient Object callInputParams[] = null;
     private transient Object callOutputParams[] = null;
     private transient Object callOptInputParams[] = null;
+
+    // Slot of each parameter in the arrays passed to the invoker.
+    // These are computed once and shared by all clones.
+    private transient int inputSlot[] = null;
+    private transient int optInputSlot[] = null;
+    private transient int outputSlot[] = null;
+    private transient int nbInReal, nbInInteger, nbOptInReal, nbOptInInteger, nbOutReal, nbOutInteger;
+
+    private transient double callInReal[][] = null;
+    private transient int callInInteger[][] = null;
+    private transient double callOptInReal[] = null;
+    private transient int callOptInInteger[] = null;
+    private transient double callOutReal[][] = null;
+    private transient int callOutInteger[][] = null;
     
     private transient FuncInfo funcInfo;
     private transient Annotation[][] parameterAnnotations;
@@ -184,6 +208,7 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
                     mi.name = funcName;
                     mi.function = funcMethod;
                     mi.lookback = lookbackMethod;
+                    mi.invoker = TaFuncInvokers.get(funcName);
                     result.put(funcName, mi);
                 }
             }
@@ -219,6 +244,12 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         mi.callInputParams = null;
         mi.callOutputParams = null;
         mi.callOptInputParams = null;
+        mi.callOptInReal = null;
+        mi.callOptInInteger = null;
+        mi.callInReal = null;
+        mi.callInInteger = null;
+        mi.callOutReal = null;
+        mi.callOutInteger = null;
         if (mi != null) return mi;
         throw new NoSuchMethodException("Function " + name);
     }
@@ -241,10 +272,17 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         try {
 			getFuncInfo();
 			getParameterAnnotations();
+			getInvokerSlots();
             CoreMetaData clone = (CoreMetaData) super.clone();
-            callInputParams = null;
-            callOutputParams = null;
-            callOptInputParams = null;
+            clone.callInputParams = null;
+            clone.callOutputParams = null;
+            clone.callOptInputParams = null;
+            clone.callOptInReal = null;
+            clone.callOptInInteger = null;
+            clone.callInReal = null;
+            clone.callInInteger = null;
+            clone.callOutReal = null;
+            clone.callOutInteger = null;
             return clone;
         } catch (CloneNotSupportedException e) {
             //we implement Cloneable interface, this exception cannot happen
@@ -385,6 +423,139 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         return (RealRange) getParameterInfo(paramIndex, OptInputParameterInfo.class, RealRange.class);
     }
 
+    private void getInvokerSlots() {
+        if (inputSlot != null) return;
+
+        int in[] = new int[getFuncInfo().nbInput()];
+        int real = 0, integer = 0;
+        for (int i=0; i<in.length; i++) {
+            InputParameterInfo param = getInputParameterInfo(i);
+            if (param==null) throw new InternalError(CONTACT_DEVELOPERS);
+            if (param.type()==InputParameterType.TA_Input_Integer) {
+                in[i] = integer++;
+            } else {
+                in[i] = real;
+                if (param.type()==InputParameterType.TA_Input_Price) {
+                    for (int flag : PRICE_FLAGS) {
+                        if ((param.flags()&flag)!=0) real++;
+                    }
+                } else {
+                    real++;
+                }
+            }
+        }
+        nbInReal = real;
+        nbInInteger = integer;
+
+        int optIn[] = new int[getFuncInfo().nbOptInput()];
+        real = integer = 0;
+        for (int i=0; i<optIn.length; i++) {
+            OptInputParameterInfo param = getOptInputParameterInfo(i);
+            if (param==null) throw new InternalError(CONTACT_DEVELOPERS);
+            if ((param.type()==OptInputParameterType.TA_OptInput_RealRange) ||
+                (param.type()==OptInputParameterType.TA_OptInput_RealList)) {
+                optIn[i] = real++;
+            } else {
+                optIn[i] = integer++;
+            }
+        }
+        nbOptInReal = real;
+        nbOptInInteger = integer;
+
+        int out[] = new int[getFuncInfo().nbOutput()];
+        real = integer = 0;
+        for (int i=0; i<out.length; i++) {
+            OutputParameterInfo param = getOutputParameterInfo(i);
+            if (param==null) throw new InternalError(CONTACT_DEVELOPERS);
+            if (param.type()==OutputParameterType.TA_Output_Integer) {
+                out[i] = integer++;
+            } else {
+                out[i] = real++;
+            }
+        }
+        nbOutReal = real;
+        nbOutInteger = integer;
+
+        optInputSlot = optIn;
+        outputSlot = out;
+        inputSlot = in;
+    }
+
+    // Allocates the arrays passed to the invoker and assigns the
+    // default value to all optional inputs. Done once per instance.
+    private void getInvokerParams() {
+        if (callOptInInteger != null) return;
+        getInvokerSlots();
+        callInReal = new double[nbInReal][];
+        callInInteger = new int[nbInInteger][];
+        callOutReal = new double[nbOutReal][];
+        callOutInteger = new int[nbOutInteger][];
+        callOptInReal = new double[nbOptInReal];
+        int optInInteger[] = new int[nbOptInInteger];
+        for (int i=0; i<optInputSlot.length; i++) {
+            OptInputParameterInfo param = getOptInputParameterInfo(i);
+            if (param.type()==OptInputParameterType.TA_OptInput_IntegerList) {
+                optInInteger[optInputSlot[i]] = getOptInputIntegerList(i).defaultValue();
+            } else if (param.type()==OptInputParameterType.TA_OptInput_IntegerRange) {
+                optInInteger[optInputSlot[i]] = getOptInputIntegerRange(i).defaultValue();
+            } else if (param.type()==OptInputParameterType.TA_OptInput_RealList) {
+                callOptInReal[optInputSlot[i]] = getOptInputRealList(i).defaultValue();
+            } else if (param.type()==OptInputParameterType.TA_OptInput_RealRange) {
+                callOptInReal[optInputSlot[i]] = getOptInputRealRange(i).defaultValue();
+            } else {
+                throw new InternalError(CONTACT_DEVELOPERS);
+            }
+        }
+        callOptInInteger = optInInteger;
+    }
+
+    // Used by TaFuncBatch to run this function on other threads. The
+    // optional inputs are copied so the batch is not affected by later
+    // changes to this instance.
+    TaFuncInvoker getInvoker() {
+        return invoker;
+    }
+
+    int[] getInvokerOptInInteger() {
+        getInvokerParams();
+        return callOptInInteger.clone();
+    }
+
+    double[] getInvokerOptInReal() {
+        getInvokerParams();
+        return callOptInReal.clone();
+    }
+
+    int getNbInvokerInReal() {
+        getInvokerSlots();
+        return nbInReal;
+    }
+
+    int getNbInvokerInInteger() {
+        getInvokerSlots();
+        return nbInInteger;
+    }
+
+    int getNbInvokerOutReal() {
+        getInvokerSlots();
+        return nbOutReal;
+    }
+
+    int getNbInvokerOutInteger() {
+        getInvokerSlots();
+        return nbOutInteger;
+    }
+
+    private void setInvokerPrice(final int paramIndex, final int flags, final Object[] prices) {
+        getInvokerParams();
+        int slot = inputSlot[paramIndex];
+        for (int i=0; i<PRICE_FLAGS.length; i++) {
+            if ((flags&PRICE_FLAGS[i])!=0) {
+                callInReal[slot++] = (double[]) prices[i];
+            }
+        }
+    }
+
     /**
      * Assigns an <b>int</b> value to an optional input parameter
      * which is expected to be assignment compatible to <b>int</b>.
@@ -414,6 +585,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
                         if (maType.name().toUpperCase().equals(strValue.toUpperCase())) {
                             if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                             callOptInputParams[paramIndex] = maType;
+                            getInvokerParams();
+                            callOptInInteger[optInputSlot[paramIndex]] = maType.ordinal();
                             return;
                         }
                     }
@@ -424,6 +597,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
             if ((value >= range.min())&&(value <= range.max())) {
                 if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                 callOptInputParams[paramIndex] = value;
+                getInvokerParams();
+                callOptInInteger[optInputSlot[paramIndex]] = value;
                 return;
             }
         } 
@@ -458,6 +633,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
                 if (value.name().toUpperCase().equals(string.toUpperCase())) {
                     if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                     callOptInputParams[paramIndex] = value;
+                    getInvokerParams();
+                    callOptInInteger[optInputSlot[paramIndex]] = value.ordinal();
                     return;
                 }
             }
@@ -481,6 +658,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
                 if (value==entry) {
                     if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                     callOptInputParams[paramIndex] = value;
+                    getInvokerParams();
+                    callOptInReal[optInputSlot[paramIndex]] = value;
                     return;
                 }
             }
@@ -489,6 +668,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
             if ((value >= range.min())&&(value <= range.max())) {
                 if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                 callOptInputParams[paramIndex] = value;
+                getInvokerParams();
+                callOptInReal[optInputSlot[paramIndex]] = value;
                 return;
             }
         }
@@ -517,6 +698,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
                         if (callOptInputParams==null) callOptInputParams = new Object[getFuncInfo().nbOptInput()];
                         double value = list.value()[i];
                         callOptInputParams[paramIndex] = value;
+                        getInvokerParams();
+                        callOptInReal[optInputSlot[paramIndex]] = value;
                         return;
                     }
                 }
@@ -541,6 +724,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         if (! (array instanceof double[]) ) throw new IllegalArgumentException(DOUBLE_ARRAY_EXPECTED);
         if (callInputParams==null) callInputParams = new Object[getFuncInfo().nbInput()];
         callInputParams[paramIndex] = array;
+        getInvokerParams();
+        callInReal[inputSlot[paramIndex]] = (double[]) array;
     }
 
     /**
@@ -559,6 +744,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         if (! (array instanceof int[]) ) throw new IllegalArgumentException(INT_ARRAY_EXPECTED);
         if (callInputParams==null) callInputParams = new Object[getFuncInfo().nbInput()];
         callInputParams[paramIndex] = array;
+        getInvokerParams();
+        callInInteger[inputSlot[paramIndex]] = (int[]) array;
     }
 
     /**
@@ -584,7 +771,9 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         InputParameterInfo param = getInputParameterInfo(paramIndex);
         if ((param==null) || (param.type()!=InputParameterType.TA_Input_Price)) throw new InternalError(CONTACT_DEVELOPERS);
         if (callInputParams==null) callInputParams = new Object[getFuncInfo().nbInput()];
-        callInputParams[paramIndex] = new PriceHolder(param.flags(), open, high, low, close, volume, openInterest);
+        PriceHolder holder = new PriceHolder(param.flags(), open, high, low, close, volume, openInterest);
+        callInputParams[paramIndex] = holder;
+        setInvokerPrice(paramIndex, param.flags(), holder.toArrays());
     }
 
     /**
@@ -603,6 +792,7 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         if (! (array instanceof PriceHolder) ) throw new IllegalArgumentException(PRICE_EXPECTED);
         if (callInputParams==null) callInputParams = new Object[getFuncInfo().nbInput()];
         callInputParams[paramIndex] = array;
+        setInvokerPrice(paramIndex, param.flags(), ((PriceHolder)array).toArrays());
     }
 
     /**
@@ -622,6 +812,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         if (! (array instanceof double[]) ) throw new IllegalArgumentException(DOUBLE_ARRAY_EXPECTED);
         if (callOutputParams==null) callOutputParams = new Object[getFuncInfo().nbOutput()];
         callOutputParams[paramIndex] = array;
+        getInvokerParams();
+        callOutReal[outputSlot[paramIndex]] = (double[]) array;
     }
 
     /**
@@ -641,6 +833,8 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
         if (! (array instanceof int[]) ) throw new IllegalArgumentException(INT_ARRAY_EXPECTED);
         if (callOutputParams==null) callOutputParams = new Object[getFuncInfo().nbOutput()];
         callOutputParams[paramIndex] = array;
+        getInvokerParams();
+        callOutInteger[outputSlot[paramIndex]] = (int[]) array;
     }
 
     /**
@@ -709,6 +903,10 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
      * @throws InvocationTargetException
      */
     public int getLookback() throws IllegalArgumentException, IllegalAccessException, InvocationTargetException {
+        if (invoker != null) {
+            getInvokerParams();
+            return invoker.lookback(taCore, callOptInInteger, callOptInReal);
+        }
         Object[] params = getOptInputParameters();
         return (Integer) lookback.invoke(taCore, params);
     }
@@ -733,6 +931,14 @@ public class CoreMetaData implements Comparable<CoreMetaData>, Cloneable {
     public void callFunc(final int startIndex, final int endIndex, MInteger outBegIdx, MInteger outNbElement) 
             throws IllegalArgumentException, IllegalAccessException, InvocationTargetException {
 
+        if (invoker != null) {
+            getInvokerParams();
+            invoker.call(taCore, startIndex, endIndex,
+                         callInReal, callInInteger, callOptInInteger, callOptInReal,
+                         outBegIdx, outNbElement, callOutReal, callOutInteger);
+            return;
+        }
+
         int count = 0;
         for (Object item : callInputParams) {
             if (PriceHolder.class.isAssignableFrom(item.getClass())) {
@@ -0,0 +1,234 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  YYYYMMDD BY     Description
+ *  -------------------------------------------------------------------
+ *  20261018 AG     First Version
+ *  20261018 AG     Workers use the Vector API kernels when available
+ */
+
+package com.tictactec.ta.lib.meta;
+
+import java.util.List;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.RecursiveAction;
+
+import com.tictactec.ta.lib.Core;
+import com.tictactec.ta.lib.MInteger;
+import com.tictactec.ta.lib.RetCode;
+
+/**
+ * TaFuncBatch calculates one TA function over many series in parallel.
+ * 
+ * <p>The series are split among the threads of a ForkJoinPool. Each worker
+ * thread has its own Core, created with the settings (unstable periods,
+ * candle settings and compatibility) of the Core given to the constructor,
+ * so the workers share no state. Each worker also keeps its output buffers
+ * from one series to the next.
+ * 
+ * <p>The inputs of a series are given as one <b>double[]</b> for each
+ * component, in the order of the input parameters of the function. A price
+ * input takes one array for each of its components, in the order open, high,
+ * low, close, volume and open interest.
+ * 
+ * <pre>
+ *   CoreMetaData func = CoreMetaData.getInstance("SMA");
+ *   func.setOptInputParamInteger(0, 20);
+ *   new TaFuncBatch(pool, new Core()).execute(func, series, listener);
+ * </pre>
+ * 
+ * @see TaFuncBatchListener
+ */
+public class TaFuncBatch {
+
+    // Under this number of series a task is not split further.
+    private static final int MIN_SPLIT = 4;
+
+    private final ForkJoinPool pool;
+    private final Core settings;
+
+    private final ThreadLocal<Worker> workers = new ThreadLocal<Worker>() {
+        @Override
+        protected Worker initialValue() {
+            return new Worker(Core.newInstance(settings));
+        }
+    };
+
+    /**
+     * @param pool executes the calculations
+     * @param settings is copied once; later changes to it do not affect this batch
+     */
+    public TaFuncBatch(final ForkJoinPool pool, final Core settings) {
+        if (pool==null || settings==null) throw new NullPointerException();
+        this.pool = pool;
+        this.settings = new Core(settings);
+    }
+
+    /**
+     * Calculates <b>func</b>, with its current optional inputs, over all the
+     * series. Returns when all results were passed to the listener.
+     * 
+     * @param func is the TA function to calculate
+     * @param series holds the inputs of each series
+     * @param listener receives the output of each series
+     * @throws Exception thrown by the listener
+     */
+    public void execute(final CoreMetaData func, final List<double[][]> series, final TaFuncBatchListener listener)
+            throws Exception {
+        TaFuncInvoker invoker = func.getInvoker();
+        if (invoker==null) throw new IllegalArgumentException("No invoker for " + func.getFuncInfo().name());
+        if (func.getNbInvokerInInteger()!=0) throw new IllegalArgumentException("Integer inputs not supported");
+
+        Job job = new Job(invoker, func.getInvokerOptInInteger(), func.getInvokerOptInReal(),
+                          func.getNbInvokerInReal(), func.getNbInvokerOutReal(), func.getNbInvokerOutInteger(),
+                          series, listener);
+        try {
+            pool.invoke(new Slice(job, 0, series.size()));
+        } catch (JobException e) {
+            throw e.cause;
+        }
+    }
+
+    private static final class Job {
+        final TaFuncInvoker invoker;
+        final int[] optInInteger;
+        final double[] optInReal;
+        final int nbInReal;
+        final int nbOutReal;
+        final int nbOutInteger;
+        final List<double[][]> series;
+        final TaFuncBatchListener listener;
+
+        Job(TaFuncInvoker invoker, int[] optInInteger, double[] optInReal,
+            int nbInReal, int nbOutReal, int nbOutInteger,
+            List<double[][]> series, TaFuncBatchListener listener) {
+            this.invoker = invoker;
+            this.optInInteger = optInInteger;
+            this.optInReal = optInReal;
+            this.nbInReal = nbInReal;
+            this.nbOutReal = nbOutReal;
+            this.nbOutInteger = nbOutInteger;
+            this.series = series;
+            this.listener = listener;
+        }
+    }
+
+    private static final class Worker {
+        final Core core;
+        final MInteger outBegIdx = new MInteger();
+        final MInteger outNbElement = new MInteger();
+        final int[][] noInteger = new int[0][];
+        double[][] outReal = new double[0][];
+        int[][] outInteger = new int[0][];
+
+        Worker(Core core) {
+            this.core = core;
+        }
+
+        // Grows the output buffers as needed. They are never shrunk.
+        void reserve(final int nbOutReal, final int nbOutInteger, final int size) {
+            if (outReal.length!=nbOutReal) outReal = new double[nbOutReal][];
+            for (int i=0; i<nbOutReal; i++) {
+                if (outReal[i]==null || outReal[i].length<size) outReal[i] = new double[size];
+            }
+            if (outInteger.length!=nbOutInteger) outInteger = new int[nbOutInteger][];
+            for (int i=0; i<nbOutInteger; i++) {
+                if (outInteger[i]==null || outInteger[i].length<size) outInteger[i] = new int[size];
+            }
+        }
+
+        void calculate(final Job job, final int index) throws Exception {
+            double[][] inReal = job.series.get(index);
+            if (inReal==null || inReal.length!=job.nbInReal) {
+                throw new IllegalArgumentException("Series " + index + ": " + job.nbInReal + " input arrays expected");
+            }
+            int size = (inReal.length==0) ? 0 : inReal[0].length;
+            reserve(job.nbOutReal, job.nbOutInteger, size);
+            RetCode retCode = job.invoker.call(core, 0, size-1,
+                                               inReal, noInteger, job.optInInteger, job.optInReal,
+                                               outBegIdx, outNbElement, outReal, outInteger);
+            job.listener.result(index, retCode, outBegIdx.value, outNbElement.value, outReal, outInteger);
+        }
+    }
+
+    // Carries a checked exception of the listener out of the pool.
+    private static final class JobException extends RuntimeException {
+        private static final long serialVersionUID = 1L;
+        final Exception cause;
+
+        JobException(Exception cause) {
+            super(cause);
+            this.cause = cause;
+        }
+    }
+
+    private final class Slice extends RecursiveAction {
+        private static final long serialVersionUID = 1L;
+        private final Job job;
+        private final int begin;
+        private final int end;
+
+        Slice(final Job job, final int begin, final int end) {
+            this.job = job;
+            this.begin = begin;
+            this.end = end;
+        }
+
+        @Override
+        protected void compute() {
+            if (end-begin <= MIN_SPLIT) {
+                Worker worker = workers.get();
+                try {
+                    for (int i=begin; i<end; i++) {
+                        worker.calculate(job, i);
+                    }
+                } catch (RuntimeException e) {
+                    throw e;
+                } catch (Exception e) {
+                    throw new JobException(e);
+                }
+            } else {
+                int middle = (begin+end) >>> 1;
+                invokeAll(new Slice(job, begin, middle), new Slice(job, middle, end));
+            }
+        }
+    }
+}
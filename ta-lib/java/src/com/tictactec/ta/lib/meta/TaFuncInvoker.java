@@ -0,0 +1,72 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* List of contributors:
+ *
+ *  Initial  Name/description
+ *  -------------------------------------------------------------------
+ *  AG       agent <agent@local>
+ *
+ * Change history:
+ *
+ *  YYYYMMDD BY     Description
+ *  -------------------------------------------------------------------
+ *  20261018 AG     First Version
+ */
+
+package com.tictactec.ta.lib.meta;
+
+import com.tictactec.ta.lib.Core;
+import com.tictactec.ta.lib.MInteger;
+import com.tictactec.ta.lib.RetCode;
+
+/**
+ * TaFuncInvoker calls one TA function with its parameters already stored in
+ * primitive arrays. An implementation for each function is generated by gen_code
+ * (see TaFuncInvokers) and bound once by CoreMetaData, so a call does not need
+ * reflection, boxing or any allocation.
+ * 
+ * <p>The parameters are stored in "slots" in the order they are declared by the
+ * function. A price input uses one <b>inReal</b> slot for each of its components,
+ * in the order open, high, low, close, volume and open interest. An optional input
+ * of type IntegerList is stored in <b>optInInteger</b> as the ordinal of its MAType.
+ */
+public interface TaFuncInvoker {
+    public int lookback(Core core, int[] optInInteger, double[] optInReal);
+
+    public RetCode call(Core core, int startIdx, int endIdx,
+                        double[][] inReal, int[][] inInteger,
+                        int[] optInInteger, double[] optInReal,
+                        MInteger outBegIdx, MInteger outNBElement,
+                        double[][] outReal, int[][] outInteger);
+}
@@ -0,0 +1,3300 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* DO NOT MODIFY this file.
+ * This file is automatically generated by gen_code.
+ *
+ * If you are not re-generating the java code (which is most
+ * likely the case), just ignore this file.
+ */
+
+package com.tictactec.ta.lib.meta;
+
+import java.util.HashMap;
+import java.util.Map;
+
+import com.tictactec.ta.lib.Core;
+import com.tictactec.ta.lib.MAType;
+import com.tictactec.ta.lib.MInteger;
+import com.tictactec.ta.lib.RetCode;
+
+/**
+ * Precompiled TaFuncInvoker for each TA function, indexed by function name.
+ */
+final class TaFuncInvokers {
+
+    private static final MAType[] MA_TYPES = MAType.values();
+
+    private static final Map<String, TaFuncInvoker> invokers = new HashMap<String, TaFuncInvoker>();
+
+    private TaFuncInvokers() {
+    }
+
+    static TaFuncInvoker get(final String name) {
+        return invokers.get(name);
+    }
+
+    static {
+        invokers.put("ACCBANDS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.accbandsLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.accbands(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1],
+                        outReal[2]);
+            }
+        });
+
+        invokers.put("ACOS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.acosLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.acos(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("AD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.adLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ad(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ADD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.addLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.add(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ADOSC", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.adOscLookback(optInInteger[0], optInInteger[1]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.adOsc(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInInteger[0],
+                        optInInteger[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ADX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.adxLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.adx(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ADXR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.adxrLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.adxr(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("APO", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.apoLookback(optInInteger[0], optInInteger[1], MA_TYPES[optInInteger[2]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.apo(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInInteger[1],
+                        MA_TYPES[optInInteger[2]],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("AROON", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.aroonLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.aroon(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("AROONOSC", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.aroonOscLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.aroonOsc(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ASIN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.asinLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.asin(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ATAN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.atanLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.atan(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ATR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.atrLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.atr(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("AVGPRICE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.avgPriceLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.avgPrice(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("AVGDEV", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.avgDevLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.avgDev(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("BBANDS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.bbandsLookback(optInInteger[0], optInReal[0], optInReal[1], MA_TYPES[optInInteger[1]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.bbands(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInReal[0],
+                        optInReal[1],
+                        MA_TYPES[optInInteger[1]],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1],
+                        outReal[2]);
+            }
+        });
+
+        invokers.put("BETA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.betaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.beta(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("BOP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.bopLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.bop(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("CCI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cciLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cci(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("CDL2CROWS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl2CrowsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl2Crows(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3BLACKCROWS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3BlackCrowsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3BlackCrows(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3INSIDE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3InsideLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3Inside(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3LINESTRIKE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3LineStrikeLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3LineStrike(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3OUTSIDE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3OutsideLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3Outside(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3STARSINSOUTH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3StarsInSouthLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3StarsInSouth(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDL3WHITESOLDIERS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdl3WhiteSoldiersLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdl3WhiteSoldiers(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLABANDONEDBABY", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlAbandonedBabyLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlAbandonedBaby(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLADVANCEBLOCK", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlAdvanceBlockLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlAdvanceBlock(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLBELTHOLD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlBeltHoldLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlBeltHold(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLBREAKAWAY", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlBreakawayLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlBreakaway(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLCLOSINGMARUBOZU", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlClosingMarubozuLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlClosingMarubozu(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLCONCEALBABYSWALL", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlConcealBabysWallLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlConcealBabysWall(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLCOUNTERATTACK", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlCounterAttackLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlCounterAttack(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLDARKCLOUDCOVER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlDarkCloudCoverLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlDarkCloudCover(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLDOJI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlDojiLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlDoji(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLDOJISTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlDojiStarLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlDojiStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLDRAGONFLYDOJI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlDragonflyDojiLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlDragonflyDoji(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLENGULFING", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlEngulfingLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlEngulfing(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLEVENINGDOJISTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlEveningDojiStarLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlEveningDojiStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLEVENINGSTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlEveningStarLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlEveningStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLGAPSIDESIDEWHITE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlGapSideSideWhiteLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlGapSideSideWhite(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLGRAVESTONEDOJI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlGravestoneDojiLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlGravestoneDoji(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHAMMER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHammerLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHammer(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHANGINGMAN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHangingManLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHangingMan(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHARAMI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHaramiLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHarami(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHARAMICROSS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHaramiCrossLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHaramiCross(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHIGHWAVE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHignWaveLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHignWave(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHIKKAKE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHikkakeLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHikkake(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHIKKAKEMOD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHikkakeModLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHikkakeMod(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLHOMINGPIGEON", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlHomingPigeonLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlHomingPigeon(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLIDENTICAL3CROWS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlIdentical3CrowsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlIdentical3Crows(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLINNECK", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlInNeckLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlInNeck(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLINVERTEDHAMMER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlInvertedHammerLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlInvertedHammer(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLKICKING", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlKickingLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlKicking(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLKICKINGBYLENGTH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlKickingByLengthLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlKickingByLength(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLLADDERBOTTOM", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlLadderBottomLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlLadderBottom(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLLONGLEGGEDDOJI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlLongLeggedDojiLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlLongLeggedDoji(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLLONGLINE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlLongLineLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlLongLine(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLMARUBOZU", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlMarubozuLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlMarubozu(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLMATCHINGLOW", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlMatchingLowLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlMatchingLow(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLMATHOLD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlMatHoldLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlMatHold(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLMORNINGDOJISTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlMorningDojiStarLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlMorningDojiStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLMORNINGSTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlMorningStarLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlMorningStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLONNECK", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlOnNeckLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlOnNeck(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLPIERCING", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlPiercingLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlPiercing(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLRICKSHAWMAN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlRickshawManLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlRickshawMan(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLRISEFALL3METHODS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlRiseFall3MethodsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlRiseFall3Methods(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSEPARATINGLINES", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlSeperatingLinesLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlSeperatingLines(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSHOOTINGSTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlShootingStarLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlShootingStar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSHORTLINE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlShortLineLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlShortLine(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSPINNINGTOP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlSpinningTopLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlSpinningTop(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSTALLEDPATTERN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlStalledPatternLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlStalledPattern(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLSTICKSANDWICH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlStickSandwhichLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlStickSandwhich(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLTAKURI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlTakuriLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlTakuri(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLTASUKIGAP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlTasukiGapLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlTasukiGap(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLTHRUSTING", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlThrustingLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlThrusting(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLTRISTAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlTristarLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlTristar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLUNIQUE3RIVER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlUnique3RiverLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlUnique3River(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLUPSIDEGAP2CROWS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlUpsideGap2CrowsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlUpsideGap2Crows(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CDLXSIDEGAP3METHODS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cdlXSideGap3MethodsLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cdlXSideGap3Methods(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CEIL", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.ceilLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ceil(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("CMO", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cmoLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cmo(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("CORREL", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.correlLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.correl(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("COS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.cosLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cos(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("COSH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.coshLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.cosh(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("CROSSOVER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.crossOverLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.crossOver(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("CROSSUNDER", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.crossUnderLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.crossUnder(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("DEMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.demaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.dema(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("DIV", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.divLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.div(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("DX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.dxLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.dx(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("EMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.emaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ema(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("EXP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.expLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.exp(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("FLOOR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.floorLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.floor(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("HT_DCPERIOD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htDcPeriodLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htDcPeriod(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("HT_DCPHASE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htDcPhaseLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htDcPhase(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("HT_PHASOR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htPhasorLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htPhasor(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("HT_SINE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htSineLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htSine(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("HT_TRENDLINE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htTrendlineLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htTrendline(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("HT_TRENDMODE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.htTrendModeLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.htTrendMode(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("IMI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.imiLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.imi(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("KAMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.kamaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.kama(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LINEARREG", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.linearRegLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.linearReg(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LINEARREG_ANGLE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.linearRegAngleLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.linearRegAngle(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LINEARREG_INTERCEPT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.linearRegInterceptLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.linearRegIntercept(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LINEARREG_SLOPE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.linearRegSlopeLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.linearRegSlope(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.lnLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ln(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("LOG10", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.log10Lookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.log10(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.movingAverageLookback(optInInteger[0], MA_TYPES[optInInteger[1]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.movingAverage(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        MA_TYPES[optInInteger[1]],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MACD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.macdLookback(optInInteger[0], optInInteger[1], optInInteger[2]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.macd(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInInteger[1],
+                        optInInteger[2],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1],
+                        outReal[2]);
+            }
+        });
+
+        invokers.put("MACDEXT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.macdExtLookback(optInInteger[0], MA_TYPES[optInInteger[1]], optInInteger[2], MA_TYPES[optInInteger[3]], optInInteger[4], MA_TYPES[optInInteger[5]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.macdExt(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        MA_TYPES[optInInteger[1]],
+                        optInInteger[2],
+                        MA_TYPES[optInInteger[3]],
+                        optInInteger[4],
+                        MA_TYPES[optInInteger[5]],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1],
+                        outReal[2]);
+            }
+        });
+
+        invokers.put("MACDFIX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.macdFixLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.macdFix(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1],
+                        outReal[2]);
+            }
+        });
+
+        invokers.put("MAD", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.medianAbsDevLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.medianAbsDev(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MAMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.mamaLookback(optInReal[0], optInReal[1]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.mama(startIdx, endIdx,
+                        inReal[0],
+                        optInReal[0],
+                        optInReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("MAVP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.movingAverageVariablePeriodLookback(optInInteger[0], optInInteger[1], MA_TYPES[optInInteger[2]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.movingAverageVariablePeriod(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        optInInteger[1],
+                        MA_TYPES[optInInteger[2]],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MAX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.maxLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.max(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MAXINDEX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.maxIndexLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.maxIndex(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("MEDIAN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.medianLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.median(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MEDPRICE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.medPriceLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.medPrice(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MFI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.mfiLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.mfi(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        inReal[3],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MIDPOINT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.midPointLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.midPoint(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MIDPRICE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.midPriceLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.midPrice(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MIN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.min(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MININDEX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minIndexLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.minIndex(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("MINMAX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minMaxLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.minMax(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("MINMAXINDEX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minMaxIndexLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.minMaxIndex(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0],
+                        outInteger[1]);
+            }
+        });
+
+        invokers.put("MINUS_DI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minusDILookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.minusDI(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MINUS_DM", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.minusDMLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.minusDM(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MOM", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.momLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.mom(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("MULT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.multLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.mult(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("NATR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.natrLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.natr(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("OBV", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.obvLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.obv(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("PLUS_DI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.plusDILookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.plusDI(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("PLUS_DM", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.plusDMLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.plusDM(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("PPO", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.ppoLookback(optInInteger[0], optInInteger[1], MA_TYPES[optInInteger[2]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ppo(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInInteger[1],
+                        MA_TYPES[optInInteger[2]],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("QUANTILE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.quantileLookback(optInInteger[0], optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.quantile(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ROC", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.rocLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.roc(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ROCP", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.rocPLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.rocP(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ROCR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.rocRLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.rocR(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ROCR100", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.rocR100Lookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.rocR100(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("RSI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.rsiLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.rsi(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sarLookback(optInReal[0], optInReal[1]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sar(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInReal[0],
+                        optInReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SAREXT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sarExtLookback(optInReal[0], optInReal[1], optInReal[2], optInReal[3], optInReal[4], optInReal[5], optInReal[6], optInReal[7]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sarExt(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        optInReal[0],
+                        optInReal[1],
+                        optInReal[2],
+                        optInReal[3],
+                        optInReal[4],
+                        optInReal[5],
+                        optInReal[6],
+                        optInReal[7],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SIN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sinLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sin(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SINH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sinhLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sinh(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.smaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sma(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SQRT", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sqrtLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sqrt(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("STDDEV", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.stdDevLookback(optInInteger[0], optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.stdDev(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("STOCH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.stochLookback(optInInteger[0], optInInteger[1], MA_TYPES[optInInteger[2]], optInInteger[3], MA_TYPES[optInInteger[4]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.stoch(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        optInInteger[1],
+                        MA_TYPES[optInInteger[2]],
+                        optInInteger[3],
+                        MA_TYPES[optInInteger[4]],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("STOCHF", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.stochFLookback(optInInteger[0], optInInteger[1], MA_TYPES[optInInteger[2]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.stochF(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        optInInteger[1],
+                        MA_TYPES[optInInteger[2]],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("STOCHRSI", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.stochRsiLookback(optInInteger[0], optInInteger[1], optInInteger[2], MA_TYPES[optInInteger[3]]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.stochRsi(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInInteger[1],
+                        optInInteger[2],
+                        MA_TYPES[optInInteger[3]],
+                        outBegIdx, outNBElement,
+                        outReal[0],
+                        outReal[1]);
+            }
+        });
+
+        invokers.put("SUB", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.subLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sub(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("SUM", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.sumLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.sum(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("T3", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.t3Lookback(optInInteger[0], optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.t3(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TAN", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.tanLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.tan(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TANH", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.tanhLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.tanh(startIdx, endIdx,
+                        inReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TEMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.temaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.tema(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("THRESHOLD_EVENTS", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.thresholdEventsLookback(optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.thresholdEvents(startIdx, endIdx,
+                        inReal[0],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outInteger[0]);
+            }
+        });
+
+        invokers.put("TRANGE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.trueRangeLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.trueRange(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TRIMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.trimaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.trima(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TRIX", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.trixLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.trix(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TSF", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.tsfLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.tsf(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("TYPPRICE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.typPriceLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.typPrice(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("ULTOSC", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.ultOscLookback(optInInteger[0], optInInteger[1], optInInteger[2]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.ultOsc(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        optInInteger[1],
+                        optInInteger[2],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("VAR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.varianceLookback(optInInteger[0], optInReal[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.variance(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        optInReal[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("WCLPRICE", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.wclPriceLookback();
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.wclPrice(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("WILLR", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.willRLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.willR(startIdx, endIdx,
+                        inReal[0],
+                        inReal[1],
+                        inReal[2],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+        invokers.put("WMA", new TaFuncInvoker() {
+            public int lookback(Core core, int[] optInInteger, double[] optInReal) {
+                return core.wmaLookback(optInInteger[0]);
+            }
+
+            public RetCode call(Core core, int startIdx, int endIdx,
+                                double[][] inReal, int[][] inInteger,
+                                int[] optInInteger, double[] optInReal,
+                                MInteger outBegIdx, MInteger outNBElement,
+                                double[][] outReal, int[][] outInteger) {
+                return core.wma(startIdx, endIdx,
+                        inReal[0],
+                        optInInteger[0],
+                        outBegIdx, outNBElement,
+                        outReal[0]);
+            }
+        });
+
+    }
+}
+
+/***************
+ * End of File *
+ ***************/
@@ -55,4 +55,5 @@ public class FuncFlags {
                                                                      * unstable period. See Documentation.
                                                                      */
     static public final int TA_FUNC_FLG_CANDLESTICK = 0x10000000;   /* Output shall be a candlestick */
+    static public final int TA_FUNC_FLG_INPLACE     = 0x20000000;   /* Outputs can be the same arrays as the inputs. */
 }
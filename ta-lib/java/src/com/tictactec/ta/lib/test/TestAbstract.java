@@ -46,9 +46,21 @@
 
 package com.tictactec.ta.lib.test;
 
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ForkJoinPool;
+
 import junit.framework.TestCase;
 import com.tictactec.ta.lib.Core;
+import com.tictactec.ta.lib.MAType;
+import com.tictactec.ta.lib.MInteger;
+import com.tictactec.ta.lib.RetCode;
+import com.tictactec.ta.lib.meta.CoreMetaData;
 import com.tictactec.ta.lib.meta.CoreMetaInfo;
+import com.tictactec.ta.lib.meta.TaFuncBatch;
+import com.tictactec.ta.lib.meta.TaFuncBatchListener;
 
 public class TestAbstract extends TestCase 
 {
@@ -74,5 +86,236 @@ public class TestAbstract extends TestCase
    {
       new CoreMetaInfo().forEach( new TestAbstractClosure(talib, testData.getAllInputData()) );
    }
+
+   /* CoreMetaData calls through a generated invoker. Verify the
+    * parameters reach the function in the right order by comparing
+    * with direct calls to Core.
+    */
+   public void testCoreMetaDataCall() throws Exception
+   {
+      int size = 300;
+      double high[]  = new double[size];
+      double low[]   = new double[size];
+      double close[] = new double[size];
+      for( int i=0; i < size; i++ )
+      {
+         close[i] = 100.0+10.0*Math.sin(i/7.0)+i*0.05;
+         high[i]  = close[i]+1.0+Math.abs(Math.cos(i/3.0));
+         low[i]   = close[i]-1.0-Math.abs(Math.sin(i/5.0));
+      }
+
+      MInteger begIdx = new MInteger();
+      MInteger nbElement = new MInteger();
+      MInteger metaBegIdx = new MInteger();
+      MInteger metaNbElement = new MInteger();
+
+      /* MA with an IntegerList optional input. */
+      double expected[] = new double[size];
+      double output[] = new double[size];
+      RetCode retCode = talib.movingAverage( 0, size-1, close, 12, MAType.Ema, begIdx, nbElement, expected );
+      assertEquals( RetCode.Success, retCode );
+
+      CoreMetaData ma = CoreMetaData.getInstance("MA");
+      ma.setInputParamReal( 0, close );
+      ma.setOptInputParamInteger( 0, 12 );
+      ma.setOptInputParamInteger( 1, "Ema" );
+      ma.setOutputParamReal( 0, output );
+      assertEquals( talib.movingAverageLookback(12, MAType.Ema), ma.getLookback() );
+      ma.callFunc( 0, size-1, metaBegIdx, metaNbElement );
+      assertOutput( begIdx, nbElement, expected, metaBegIdx, metaNbElement, output );
+
+      /* STOCH with a price input and two outputs. */
+      double expectedD[] = new double[size];
+      double outputD[] = new double[size];
+      retCode = talib.stoch( 0, size-1, high, low, close, 9, 4, MAType.Wma, 5, MAType.Sma,
+                             begIdx, nbElement, expected, expectedD );
+      assertEquals( RetCode.Success, retCode );
+
+      CoreMetaData stoch = CoreMetaData.getInstance("STOCH");
+      stoch.setInputParamPrice( 0, null, high, low, close, null, null );
+      stoch.setOptInputParamInteger( 0, 9 );
+      stoch.setOptInputParamInteger( 1, 4 );
+      stoch.setOptInputParamInteger( 2, MAType.Wma.ordinal() );
+      stoch.setOptInputParamInteger( 3, 5 );
+      stoch.setOutputParamReal( 0, output );
+      stoch.setOutputParamReal( 1, outputD );
+      stoch.callFunc( 0, size-1, metaBegIdx, metaNbElement );
+      assertOutput( begIdx, nbElement, expected, metaBegIdx, metaNbElement, output );
+      assertOutput( begIdx, nbElement, expectedD, metaBegIdx, metaNbElement, outputD );
+
+      /* BBANDS with real optional inputs left to their default. */
+      double expectedUp[] = new double[size];
+      double expectedDn[] = new double[size];
+      double outputUp[] = new double[size];
+      double outputDn[] = new double[size];
+      retCode = talib.bbands( 0, size-1, close, 5, 2.0, 2.0, MAType.Sma,
+                              begIdx, nbElement, expectedUp, expected, expectedDn );
+      assertEquals( RetCode.Success, retCode );
+
+      CoreMetaData bbands = CoreMetaData.getInstance("BBANDS");
+      bbands.setInputParamReal( 0, close );
+      bbands.setOutputParamReal( 0, outputUp );
+      bbands.setOutputParamReal( 1, output );
+      bbands.setOutputParamReal( 2, outputDn );
+      bbands.callFunc( 0, size-1, metaBegIdx, metaNbElement );
+      assertOutput( begIdx, nbElement, expectedUp, metaBegIdx, metaNbElement, outputUp );
+      assertOutput( begIdx, nbElement, expected, metaBegIdx, metaNbElement, output );
+      assertOutput( begIdx, nbElement, expectedDn, metaBegIdx, metaNbElement, outputDn );
+   }
+
+   /* Calculate STOCH over many series in parallel and compare
+    * with sequential calls to Core.
+    */
+   public void testBatch() throws Exception
+   {
+      final int nbSeries = 200;
+      List<double[][]> series = new ArrayList<double[][]>();
+      for( int s=0; s < nbSeries; s++ )
+      {
+         int size = 50+(s*37)%400;
+         double high[]  = new double[size];
+         double low[]   = new double[size];
+         double close[] = new double[size];
+         for( int i=0; i < size; i++ )
+         {
+            close[i] = 50.0+s+5.0*Math.sin((i+s)/6.0);
+            high[i]  = close[i]+0.5+Math.abs(Math.cos(i/4.0));
+            low[i]   = close[i]-0.5-Math.abs(Math.sin(i/3.0));
+         }
+         series.add( new double[][] { high, low, close } );
+      }
+
+      final double slowK[][] = new double[nbSeries][];
+      final double slowD[][] = new double[nbSeries][];
+      final int begIdx[] = new int[nbSeries];
+      final RetCode retCodes[] = new RetCode[nbSeries];
+
+      CoreMetaData stoch = CoreMetaData.getInstance("STOCH");
+      stoch.setOptInputParamInteger( 0, 7 );
+      stoch.setOptInputParamInteger( 2, MAType.Ema.ordinal() );
+
+      ForkJoinPool pool = new ForkJoinPool(4);
+      try {
+         new TaFuncBatch( pool, talib ).execute( stoch, series, new TaFuncBatchListener() {
+            public void result( int s, RetCode retCode, int outBegIdx, int outNbElement,
+                                double[][] outReal, int[][] outInteger )
+            {
+               retCodes[s] = retCode;
+               begIdx[s] = outBegIdx;
+               slowK[s] = Arrays.copyOf( outReal[0], outNbElement );
+               slowD[s] = Arrays.copyOf( outReal[1], outNbElement );
+            }
+         });
+      } finally {
+         pool.shutdown();
+      }
+
+      MInteger outBegIdx = new MInteger();
+      MInteger outNbElement = new MInteger();
+      for( int s=0; s < nbSeries; s++ )
+      {
+         double in[][] = series.get(s);
+         int size = in[0].length;
+         double expectedK[] = new double[size];
+         double expectedD[] = new double[size];
+         RetCode retCode = talib.stoch( 0, size-1, in[0], in[1], in[2], 7, 3, MAType.Ema, 3, MAType.Sma,
+                                        outBegIdx, outNbElement, expectedK, expectedD );
+         assertEquals( retCode, retCodes[s] );
+         assertEquals( outBegIdx.value, begIdx[s] );
+         assertEquals( outNbElement.value, slowK[s].length );
+         for( int i=0; i < outNbElement.value; i++ )
+         {
+            assertEquals( expectedK[i], slowK[s][i], 0.0 );
+            assertEquals( expectedD[i], slowD[s][i], 0.0 );
+         }
+      }
+   }
+
+   /* When the Vector API kernels are available, verify they give the
+    * same result as the scalar code. The transcendental functions may
+    * differ by up to 2 ulps (see CoreVector).
+    */
+   public void testVectorKernels() throws Exception
+   {
+      Core vector = Core.newInstance();
+      if( vector.getClass() == Core.class )
+         return; /* Not built or module not available. */
+
+      String exact[] = { "add", "sub", "mult", "div", "sqrt",
+                         "avgPrice", "medPrice", "typPrice", "wclPrice" };
+      String approx[] = { "acos", "asin", "atan", "cos", "cosh", "exp", "ln",
+                          "log10", "sin", "sinh", "tan", "tanh" };
+      for( String name : exact )
+         compareVectorKernel( vector, name, 0 );
+      for( String name : approx )
+         compareVectorKernel( vector, name, 2 );
+   }
+
+   private void compareVectorKernel( Core vector, String name, int maxUlp ) throws Exception
+   {
+      Method method = null;
+      for( Method m : Core.class.getMethods() )
+      {
+         Class<?> types[] = m.getParameterTypes();
+         if( m.getName().equals(name) && (types.length > 2) && (types[2] == double[].class) )
+            method = m;
+      }
+      assertNotNull( name, method );
+      int nbInput = method.getParameterTypes().length-5;
+
+      int size = 1003;
+      Object args[] = new Object[nbInput+5];
+      for( int k=0; k < nbInput; k++ )
+      {
+         double in[] = new double[size];
+         for( int i=0; i < size; i++ )
+            in[i] = 0.05+0.9*Math.abs(Math.sin(i*0.37+k));
+         args[2+k] = in;
+      }
+
+      /* Ranges not a multiple of the vector length, and in-place. */
+      int ranges[][] = { {0, size-1}, {3, size-2}, {7, 7}, {0, 4} };
+      for( int range[] : ranges )
+      {
+         for( int inPlace=0; inPlace <= 1; inPlace++ )
+         {
+            double expected[] = new double[size];
+            double output[] = (inPlace == 1)? ((double[])args[2]).clone() : new double[size];
+            MInteger begIdx = new MInteger();
+            MInteger nbElement = new MInteger();
+            MInteger vectorBegIdx = new MInteger();
+            MInteger vectorNbElement = new MInteger();
+
+            args[0] = range[0];
+            args[1] = range[1];
+            args[nbInput+2] = begIdx;
+            args[nbInput+3] = nbElement;
+            args[nbInput+4] = expected;
+            assertEquals( RetCode.Success, method.invoke(talib, args) );
+
+            Object vectorArgs[] = args.clone();
+            if( inPlace == 1 )
+               vectorArgs[2] = output;
+            vectorArgs[nbInput+2] = vectorBegIdx;
+            vectorArgs[nbInput+3] = vectorNbElement;
+            vectorArgs[nbInput+4] = output;
+            assertEquals( RetCode.Success, method.invoke(vector, vectorArgs) );
+
+            assertEquals( name, begIdx.value, vectorBegIdx.value );
+            assertEquals( name, nbElement.value, vectorNbElement.value );
+            for( int i=0; i < nbElement.value; i++ )
+               assertEquals( name, expected[i], output[i], maxUlp*Math.ulp(expected[i]) );
+         }
+      }
+   }
+
+   private void assertOutput( MInteger begIdx, MInteger nbElement, double expected[],
+                              MInteger metaBegIdx, MInteger metaNbElement, double output[] )
+   {
+      assertEquals( begIdx.value, metaBegIdx.value );
+      assertEquals( nbElement.value, metaNbElement.value );
+      for( int i=0; i < nbElement.value; i++ )
+         assertEquals( expected[i], output[i], 0.0 );
+   }
    
 }
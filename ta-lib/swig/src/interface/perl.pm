@@ -7,6 +7,11 @@ use strict;
 
 our $VERSION = v0.5.0;
 
+# When true, the output arrays of the TA functions are returned as
+# packed strings of native doubles (or ints), see unpack("d*", ...).
+# A reference to such a string can be given as input.
+our $OUTPUT_PACKED = 0;
+
 package Finance::TA::TA_RetCodeInfo;
 
 # Redefine &new to a friendler version accepting an optional parameter
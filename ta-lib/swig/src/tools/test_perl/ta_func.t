@@ -6,7 +6,7 @@
 use strict;
 use lib "../../../lib/perl";
 use Test;
-BEGIN { plan tests => 38 }
+BEGIN { plan tests => 48 }
 
 use Finance::TA v0.5.0;
 
@@ -110,5 +110,25 @@ ok( abs($$result1[2] - 86.942) < 1e-3 );
 ok( abs($$result1[3] - 87.089) < 1e-3 );
 ok( abs($$result1[4] - 87.656) < 1e-3 );
 
+print "Testing packed buffers...\n";
+($retCode, $begIdx, $result1) = TA_MAX(0, $#series, \pack("d*", @series), 4);
+ok( $retCode, $TA_SUCCESS );
+ok( $begIdx, TA_MAX_Lookback(4) );
+ok( $$result1[2], 95.095 );
+{
+    local $Finance::TA::OUTPUT_PACKED = 1;
+    ($retCode, $begIdx, $result2) = TA_MAX(0, $#series, \pack("d*", @series), 4);
+}
+ok( $retCode, $TA_SUCCESS );
+ok( length($result2), 8 * scalar(@$result1) );
+ok( join(",", unpack("d*", $result2)), join(",", @$result1) );
+# A packed input shorter than endIdx+1 is padded with zeros
+($retCode, $begIdx, $result2) = TA_MAX(0, $#series, \pack("d*", @series[0..9]), 4);
+ok( $retCode, $TA_SUCCESS );
+ok( $$result2[$#$result2], 0 );
+# A plain scalar is not taken as a packed string
+ok( !defined eval { TA_MAX(0, $#series, pack("d*", @series), 4) } );
 
-
+my $pdl = eval { require PDL; PDL->pdl(\@series) };
+($retCode, $begIdx, $result2) = TA_MAX(0, $#series, $pdl, 4) if defined $pdl;
+skip( defined $pdl ? 0 : "PDL is not installed", sub { join(",", @$result2) }, join(",", @$result1) );